@@ -0,0 +1,265 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Almost Montgomery multiplication in radix 2^52 with the AVX-512 IFMA
+# instructions VPMADD52LUQ and VPMADD52HUQ.
+#
+# void bn_amm52x20_x1_ifma(uint64_t *r, const uint64_t *a,
+#     const uint64_t *b, const uint64_t *m, const uint64_t k0[1]);
+# void bn_amm52x20_x2_ifma(uint64_t *r, const uint64_t *a,
+#     const uint64_t *b, const uint64_t *m, const uint64_t k0[2]);
+#
+# void bn_gather52x20_ifma(uint64_t *r, const uint64_t *table,
+#     size_t stride, int idx);
+#
+# and likewise for 30 and 40 limbs, that is, 1536 and 2048-bit moduli.
+#
+# Numbers are arrays of 52-bit limbs, padded with zero limbs to a multiple
+# of eight. The _x2 variants perform two independent multiplications at
+# once; each of r, a, b and m then holds the two operands one after the
+# other. k0 is -m^-1 mod 2^52. If a, b < 2m and 4m < 2^(52n), then r =
+# a * b / 2^(52n) mod m and r < 2m. r may alias a or b.
+#
+# The caller must check that the CPU supports AVX512F and AVX512IFMA.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($rp,$ap,$bp,$np)=("%rdi","%rsi","%r8","%rcx");
+($mask,$cnt)=("%r11","%ebp");
+@k0=("%r9","%r10");
+@acc0=("%r12","%r13");
+($lo,$hi,$hi2)=("%rax","%rbx","%r14");
+
+$code.=<<___;
+.text
+___
+
+# The accumulator R holds the limbs of the running sum in vector registers,
+# with limb 0 kept in a scalar register instead: it is needed to compute y
+# in each round, and moving it out of the vector unit every time would put
+# the round trip on the critical path. Lane 0 of R is therefore ignored.
+sub amm52 {
+my ($n,$x)=@_;
+my $L=($n+7)>>3;		# vectors per number
+my $S=64*$L;			# distance between the operands of _x2
+my $zero="%zmm16";
+my (@R,@B,@Y);
+
+    for (my $j=0; $j<$x; $j++) {
+	@{$R[$j]}=map("%zmm".($j*$L+$_),(0..$L-1));
+	$B[$j]="%zmm".(10+$j);
+	$Y[$j]="%zmm".(12+$j);
+    }
+
+$code.=<<___;
+
+.globl	bn_amm52x${n}_x${x}_ifma
+.type	bn_amm52x${n}_x${x}_ifma,\@function,5
+.align	32
+bn_amm52x${n}_x${x}_ifma:
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+
+	mov	0(%r8),$k0[0]
+___
+$code.=<<___	if ($x==2);
+	mov	8(%r8),$k0[1]
+___
+$code.=<<___;
+	mov	%rdx,$bp
+	mov	\$0xfffffffffffff,$mask
+	vpxorq	$zero,$zero,$zero
+___
+    for (my $j=0; $j<$x; $j++) {
+	$code.="\txor	$acc0[$j],$acc0[$j]\n";
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvmovdqa64	$zero,$R[$j][$k]\n";
+	}
+    }
+$code.=<<___;
+	mov	\$$n,$cnt
+	jmp	.Lamm52x${n}_x${x}_loop
+
+.align	32
+.Lamm52x${n}_x${x}_loop:
+___
+    # limb 0: acc0 += a[0] * b[i], y = acc0 * k0 mod 2^52,
+    # acc0 = (acc0 + m[0] * y) / 2^52
+    for (my $j=0; $j<$x; $j++) {
+	$code.=<<___;
+	mov	`$j*$S`($bp),%rdx
+	vpbroadcastq	%rdx,$B[$j]
+	mulx	`$j*$S`($ap),$lo,$hi
+	add	$lo,$acc0[$j]
+	adc	\$0,$hi
+	mov	$acc0[$j],%rdx
+	imul	$k0[$j],%rdx
+	and	$mask,%rdx
+	vpbroadcastq	%rdx,$Y[$j]
+	mulx	`$j*$S`($np),$lo,$hi2
+	add	$lo,$acc0[$j]
+	adc	$hi2,$hi
+	shrd	\$52,$hi,$acc0[$j]
+___
+    }
+    # R += a * b[i] + m * y, low halves
+    for (my $j=0; $j<$x; $j++) {
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvpmadd52luq	".($j*$S+64*$k)."($ap),$B[$j],$R[$j][$k]\n";
+	}
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvpmadd52luq	".($j*$S+64*$k)."($np),$Y[$j],$R[$j][$k]\n";
+	}
+    }
+    # R >>= 52 and move the new limb 0 to acc0
+    for (my $j=0; $j<$x; $j++) {
+	for (my $k=0; $k<$L-1; $k++) {
+	    $code.="\tvalignq	\$1,$R[$j][$k],$R[$j][$k+1],$R[$j][$k]\n";
+	}
+	$code.="\tvalignq	\$1,$R[$j][$L-1],$zero,$R[$j][$L-1]\n";
+	my $r0=$R[$j][0]; $r0=~s/zmm/xmm/;
+	$code.=<<___;
+	vmovq	$r0,$lo
+	add	$lo,$acc0[$j]
+___
+    }
+    # the high halves of both products go one limb up, which is now
+    # the same position; those of limb 0 are already in acc0
+    for (my $j=0; $j<$x; $j++) {
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvpmadd52huq	".($j*$S+64*$k)."($ap),$B[$j],$R[$j][$k]\n";
+	}
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvpmadd52huq	".($j*$S+64*$k)."($np),$Y[$j],$R[$j][$k]\n";
+	}
+    }
+$code.=<<___;
+	lea	8($bp),$bp
+	dec	$cnt
+	jnz	.Lamm52x${n}_x${x}_loop
+
+___
+    for (my $j=0; $j<$x; $j++) {
+	for (my $k=0; $k<$L; $k++) {
+	    $code.="\tvmovdqu64	$R[$j][$k],".($j*$S+64*$k)."($rp)\n";
+	}
+    }
+    # propagate the carries so that every limb fits in 52 bits again
+    for (my $j=0; $j<$x; $j++) {
+	$code.="\tmov	$acc0[$j],%rax\n";
+	for (my $i=0; $i<$n; $i++) {
+	    my $off=$j*$S+8*$i;
+	    $code.="\tadd	$off($rp),%rax\n" if ($i>0);
+	    $code.=<<___;
+	mov	%rax,%rbx
+	shr	\$52,%rax
+	and	$mask,%rbx
+	mov	%rbx,$off($rp)
+___
+	}
+    }
+$code.=<<___;
+
+	vzeroupper
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	ret
+.size	bn_amm52x${n}_x${x}_ifma,.-bn_amm52x${n}_x${x}_ifma
+___
+}
+
+# Copy entry idx of a table of 32 entries, stride limbs apart, to r,
+# reading every entry.
+sub gather52 {
+my ($n)=@_;
+my $L=($n+7)>>3;
+my @acc=map("%zmm$_",(0..$L-1));
+my ($mvec,$tmp)=("%zmm16","%zmm17");
+
+$code.=<<___;
+
+.globl	bn_gather52x${n}_ifma
+.type	bn_gather52x${n}_ifma,\@function,4
+.align	32
+bn_gather52x${n}_ifma:
+	mov	%ecx,%ecx		# zero extend idx
+	shl	\$3,%rdx
+___
+    for (my $k=0; $k<$L; $k++) {
+	$code.="\tvpxorq	$acc[$k],$acc[$k],$acc[$k]\n";
+    }
+$code.=<<___;
+	xor	%eax,%eax
+.Lgather52x${n}_loop:
+	mov	%rax,%r8		# all ones if i == idx, else zero
+	xor	%rcx,%r8
+	sub	\$1,%r8
+	sar	\$63,%r8
+	vpbroadcastq	%r8,$mvec
+___
+    for (my $k=0; $k<$L; $k++) {
+	$code.=<<___;
+	vpandq	`64*$k`(%rsi),$mvec,$tmp
+	vporq	$tmp,$acc[$k],$acc[$k]
+___
+    }
+$code.=<<___;
+	add	%rdx,%rsi
+	inc	%eax
+	cmp	\$32,%eax
+	jb	.Lgather52x${n}_loop
+
+___
+    for (my $k=0; $k<$L; $k++) {
+	$code.="\tvmovdqu64	$acc[$k],`64*$k`(%rdi)\n";
+    }
+$code.=<<___;
+	vzeroupper
+	ret
+.size	bn_gather52x${n}_ifma,.-bn_gather52x${n}_ifma
+___
+}
+
+foreach $n (20, 30, 40) {
+    amm52($n, 1);
+    amm52($n, 2);
+    gather52($n);
+}
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
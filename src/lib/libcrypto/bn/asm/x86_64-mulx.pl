@@ -0,0 +1,220 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Fixed size multiplication and squaring of 4, 6, 8, 9 and 16 words, using
+# the BMI2 MULX and ADX ADCX/ADOX instructions.
+#
+# void bn_mul_mulxN(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+# void bn_sqr_mulxN(BN_ULONG *r, const BN_ULONG *a);
+#
+# The product is accumulated one row a * b[i] at a time. Within a row the
+# low halves of the partial products are added with the ADCX carry chain
+# and the high halves with the ADOX chain, so the two chains run in
+# parallel and MULX does not touch either. Up to 8 words the accumulator
+# is kept in registers, beyond that it lives in r. Squaring computes the
+# products a[i] * a[j] with i < j in r the same way, then doubles them and
+# adds the squares a[i]^2 in one more pass, again with one chain each.
+#
+# The caller must check that the CPU supports BMI2 and ADX. r must not
+# overlap a or b.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($r,$a,$b,$zero)=("%rdi","%rsi","%rcx","%r10");
+@hi=("%r8","%r9");
+
+# Add a[first..n-1] * %rdx to r[off + first..], writing r[off + n] fresh.
+# If $add is false, r[off + first..off + n - 1] is written rather than
+# added to. Expects both carry flags clear and $zero to be zero.
+sub row {
+my ($n,$off,$first,$add)=@_;
+my $code="";
+my $h=0;
+
+    $code.="\tmulx\t".8*$first."($a),%rax,$hi[$h]\n";
+    $code.="\tadcx\t".8*($off+$first)."($r),%rax\n" if ($add);
+    $code.="\tmov\t%rax,".8*($off+$first)."($r)\n";
+    for (my $j=$first+1; $j<$n; $j++) {
+	$code.="\tmulx\t".8*$j."($a),%rax,$hi[$h^1]\n";
+	if ($add) {
+	    $code.="\tadcx\t".8*($off+$j)."($r),%rax\n";
+	    $code.="\tadox\t$hi[$h],%rax\n";
+	} else {
+	    $code.="\tadcx\t$hi[$h],%rax\n";
+	}
+	$code.="\tmov\t%rax,".8*($off+$j)."($r)\n";
+	$h^=1;
+    }
+    $code.="\tadcx\t$zero,$hi[$h]\n";
+    $code.="\tadox\t$zero,$hi[$h]\n" if ($add);
+    $code.="\tmov\t$hi[$h],".8*($off+$n)."($r)\n";
+    return $code;
+}
+
+# Multiply with the n + 1 word accumulator of a row in registers, for
+# n <= 8. Once a row is done, its lowest word is final and is stored.
+sub mul_regs {
+my $n=shift;
+my @acc=("%rbx","%rbp",map("%r$_",(8..15)));
+my $t=pop(@acc);
+my $code="";
+
+    $code.=<<___;
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	mov	%rdx,$b
+
+	mov	0($b),%rdx		# a * b[0]
+	xor	%eax,%eax
+	mulx	0($a),$acc[0],$acc[1]
+___
+    for (my $j=1; $j<$n; $j++) {
+	$code.="\tmulx\t".8*$j."($a),%rax,$acc[$j+1]\n";
+	$code.="\tadcx\t%rax,$acc[$j]\n";
+    }
+    $code.="\tadc\t\$0,$acc[$n]\n";
+    $code.="\tmov\t$acc[0],0($r)\n";
+    push(@acc,shift(@acc));
+
+    for (my $i=1; $i<$n; $i++) {
+	$code.="\n\tmov\t".8*$i."($b),%rdx\t\t# a * b[$i]\n";
+	$code.="\txor\t$acc[$n],$acc[$n]\n";
+	for (my $j=0; $j<$n; $j++) {
+	    $code.="\tmulx\t".8*$j."($a),%rax,$t\n";
+	    $code.="\tadcx\t%rax,$acc[$j]\n";
+	    $code.="\tadox\t$t,$acc[$j+1]\n";
+	}
+	$code.="\tadc\t\$0,$acc[$n]\n";
+	$code.="\tmov\t$acc[0],".8*$i."($r)\n";
+	push(@acc,shift(@acc));
+    }
+
+    $code.="\n";
+    for (my $j=0; $j<$n; $j++) {
+	$code.="\tmov\t$acc[$j],".8*($n+$j)."($r)\n";
+    }
+    $code.=<<___;
+
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+___
+    return $code;
+}
+
+$code.=<<___;
+.text
+___
+
+foreach my $n (4, 6, 8, 9, 16) {
+$code.=<<___;
+
+.globl	bn_mul_mulx$n
+.type	bn_mul_mulx$n,\@function,3
+.align	32
+bn_mul_mulx$n:
+___
+if ($n <= 8) {
+$code.=mul_regs($n);
+} else {
+$code.=<<___;
+	mov	%rdx,$b
+	xor	%r10d,%r10d
+
+	mov	0($b),%rdx		# a * b[0]
+___
+$code.=row($n, 0, 0, 0);
+for (my $i=1; $i<$n; $i++) {
+$code.=<<___;
+
+	mov	`8*$i`($b),%rdx		# a * b[$i]
+	xor	%r10d,%r10d
+___
+$code.=row($n, $i, 0, 1);
+}
+}
+$code.=<<___;
+	ret
+.size	bn_mul_mulx$n,.-bn_mul_mulx$n
+
+.globl	bn_sqr_mulx$n
+.type	bn_sqr_mulx$n,\@function,2
+.align	32
+bn_sqr_mulx$n:
+	xor	%r10d,%r10d
+	mov	$zero,0($r)
+	mov	$zero,`8*(2*$n-1)`($r)
+
+	mov	0($a),%rdx		# a[1..] * a[0]
+___
+$code.=row($n, 0, 1, 0);
+for (my $i=1; $i<$n-1; $i++) {
+$code.=<<___;
+
+	mov	`8*$i`($a),%rdx		# a[`$i+1`..] * a[$i]
+	xor	%r10d,%r10d
+___
+$code.=row($n, $i, $i+1, 1);
+}
+$code.=<<___;
+
+	xor	%r10d,%r10d		# 2 * r + a[i]^2
+___
+for (my $i=0; $i<$n; $i++) {
+$code.=<<___;
+	mov	`8*$i`($a),%rdx
+	mulx	%rdx,%rax,%r8
+	mov	`16*$i`($r),%r9
+	mov	`16*$i+8`($r),%r11
+	adcx	%r9,%r9
+	adcx	%r11,%r11
+	adox	%rax,%r9
+	adox	%r8,%r11
+	mov	%r9,`16*$i`($r)
+	mov	%r11,`16*$i+8`($r)
+___
+}
+$code.=<<___;
+	ret
+.size	bn_sqr_mulx$n,.-bn_sqr_mulx$n
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
@@ -489,6 +489,10 @@ int	BN_is_prime_fasttest(const BIGNUM *p, int nchecks,
 /* Newer versions */
 int	BN_generate_prime_ex(BIGNUM *ret, int bits, int safe, const BIGNUM *add,
     const BIGNUM *rem, BN_GENCB *cb);
+int	BN_generate_prime_mt(BIGNUM *ret, int bits, int safe, const BIGNUM *add,
+    const BIGNUM *rem, int nthreads,
+    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+    void *arg, BN_GENCB *cb);
 int	BN_is_prime_ex(const BIGNUM *p, int nchecks, BN_CTX *ctx, BN_GENCB *cb);
 int	BN_is_prime_fasttest_ex(const BIGNUM *p, int nchecks, BN_CTX *ctx,
     int do_trial_division, BN_GENCB *cb);
@@ -60,7 +60,9 @@
 #endif
 #endif
 
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <openssl/opensslconf.h>
@@ -85,6 +87,10 @@
 #define BN_CTX_POOL_SIZE	16
 /* The stack frame info is resizing, set a first-time expansion size; */
 #define BN_CTX_START_FRAMES	32
+/* How many freed BN_CTXs each thread keeps for reuse */
+#define BN_CTX_CACHE_SIZE	4
+/* BN_CTXs that have grown beyond this many bignums are not kept */
+#define BN_CTX_CACHE_MAX	(8 * BN_CTX_POOL_SIZE)
 
 /***********/
 /* BN_POOL */
@@ -108,6 +114,7 @@ typedef struct bignum_pool {
 
 static void		BN_POOL_init(BN_POOL *);
 static void		BN_POOL_finish(BN_POOL *);
+static void		BN_POOL_clear(BN_POOL *);
 #ifndef OPENSSL_NO_DEPRECATED
 static void		BN_POOL_reset(BN_POOL *);
 #endif
@@ -152,6 +159,31 @@ struct bignum_ctx {
 	int too_many;
 };
 
+/************/
+/* BN_CACHE */
+/************/
+
+/*
+ * Every thread keeps the last few BN_CTXs that it freed, together with their
+ * pool items and the limbs of their bignums, and hands them out again from
+ * BN_CTX_new(). Code that sets up a BN_CTX for every operation thus stops
+ * calling malloc once the limbs have grown to the size the operation needs.
+ * All limbs of the bignums of a BN_CTX are cleared, in one pass, when it goes
+ * into the cache, so a cached BN_CTX holds no values of its previous user.
+ * As before, BN_CTX_end() leaves the values of released bignums to be
+ * overwritten by later users of the same BN_CTX.
+ */
+typedef struct bignum_ctx_cache {
+	BN_CTX *ctxs[BN_CTX_CACHE_SIZE];
+	unsigned int num;
+	struct bn_ctx_stats stats;
+} BN_CACHE;
+
+static BN_CACHE *	BN_CACHE_get(void);
+static int		BN_CACHE_put(BN_CTX *);
+
+static void		BN_CTX_destroy(BN_CTX *);
+
 /* Enable this to find BN_CTX bugs */
 #ifdef BN_CTX_DEBUG
 static const char *ctxdbg_cur = NULL;
@@ -223,7 +255,18 @@ BN_CTX_init(BN_CTX *ctx)
 BN_CTX *
 BN_CTX_new(void)
 {
-	BN_CTX *ret = malloc(sizeof(BN_CTX));
+	BN_CACHE *cache;
+	BN_CTX *ret;
+
+	if ((cache = BN_CACHE_get()) != NULL) {
+		cache->stats.ctx_new++;
+		if (cache->num > 0) {
+			cache->stats.ctx_reused++;
+			return cache->ctxs[--cache->num];
+		}
+	}
+
+	ret = malloc(sizeof(BN_CTX));
 	if (!ret) {
 		BNerror(ERR_R_MALLOC_FAILURE);
 		return NULL;
@@ -259,6 +302,14 @@ BN_CTX_free(BN_CTX *ctx)
 		fprintf(stderr, "\n");
 	}
 #endif
+	if (BN_CACHE_put(ctx))
+		return;
+	BN_CTX_destroy(ctx);
+}
+
+static void
+BN_CTX_destroy(BN_CTX *ctx)
+{
 	BN_STACK_finish(&ctx->stack);
 	BN_POOL_finish(&ctx->pool);
 	free(ctx);
@@ -325,6 +376,102 @@ BN_CTX_get(BN_CTX *ctx)
 	return ret;
 }
 
+int
+bn_ctx_stats(struct bn_ctx_stats *stats)
+{
+	BN_CACHE *cache;
+
+	if ((cache = BN_CACHE_get()) == NULL)
+		return 0;
+	*stats = cache->stats;
+	return 1;
+}
+
+/************/
+/* BN_CACHE */
+/************/
+
+static pthread_once_t bn_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t bn_cache_key;
+static int bn_cache_key_ok;
+
+/* Runs on thread exit */
+static void
+BN_CACHE_free(void *arg)
+{
+	BN_CACHE *cache = arg;
+
+	while (cache->num > 0)
+		BN_CTX_destroy(cache->ctxs[--cache->num]);
+	free(cache);
+}
+
+static void
+BN_CACHE_init(void)
+{
+	if (pthread_key_create(&bn_cache_key, BN_CACHE_free) == 0)
+		bn_cache_key_ok = 1;
+}
+
+/*
+ * Runs when libcrypto is unloaded. Delete the key so that threads that exit
+ * later don't call BN_CACHE_free() after it is gone. The caches of other
+ * threads that are still running are leaked.
+ */
+static void __attribute__((__destructor__))
+BN_CACHE_unload(void)
+{
+	BN_CACHE *cache;
+
+	if (!bn_cache_key_ok)
+		return;
+	bn_cache_key_ok = 0;
+	if ((cache = pthread_getspecific(bn_cache_key)) != NULL)
+		BN_CACHE_free(cache);
+	(void)pthread_key_delete(bn_cache_key);
+}
+
+static BN_CACHE *
+BN_CACHE_get(void)
+{
+	BN_CACHE *cache;
+
+	if (pthread_once(&bn_cache_once, BN_CACHE_init) != 0 ||
+	    !bn_cache_key_ok)
+		return NULL;
+	if ((cache = pthread_getspecific(bn_cache_key)) != NULL)
+		return cache;
+	if ((cache = calloc(1, sizeof(BN_CACHE))) == NULL)
+		return NULL;
+	if (pthread_setspecific(bn_cache_key, cache) != 0) {
+		free(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+/* Release everything ctx still hands out and keep it, if there is room. */
+static int
+BN_CACHE_put(BN_CTX *ctx)
+{
+	BN_CACHE *cache;
+
+	if ((cache = BN_CACHE_get()) == NULL)
+		return 0;
+	if (cache->num == BN_CTX_CACHE_SIZE ||
+	    ctx->pool.size > BN_CTX_CACHE_MAX)
+		return 0;
+
+	BN_POOL_clear(&ctx->pool);
+	ctx->stack.depth = 0;
+	ctx->used = 0;
+	ctx->err_stack = 0;
+	ctx->too_many = 0;
+
+	cache->ctxs[cache->num++] = ctx;
+	return 1;
+}
+
 /************/
 /* BN_STACK */
 /************/
@@ -409,6 +556,27 @@ BN_POOL_finish(BN_POOL *p)
 	}
 }
 
+/* Clear the limbs of all bignums and release them. */
+static void
+BN_POOL_clear(BN_POOL *p)
+{
+	BN_POOL_ITEM *item;
+	BIGNUM *bn;
+	unsigned int i;
+
+	for (item = p->head; item != NULL; item = item->next) {
+		for (i = 0; i < BN_CTX_POOL_SIZE; i++) {
+			bn = &item->vals[i];
+			if (bn->d != NULL &&
+			    !BN_get_flags(bn, BN_FLG_STATIC_DATA))
+				explicit_bzero(bn->d,
+				    bn->dmax * sizeof(bn->d[0]));
+		}
+	}
+	p->current = p->head;
+	p->used = 0;
+}
+
 #ifndef OPENSSL_NO_DEPRECATED
 static void
 BN_POOL_reset(BN_POOL *p)
@@ -435,9 +603,12 @@ BN_POOL_get(BN_POOL *p)
 	if (p->used == p->size) {
 		BIGNUM *bn;
 		unsigned int loop = 0;
+		BN_CACHE *cache;
 		BN_POOL_ITEM *item = malloc(sizeof(BN_POOL_ITEM));
 		if (!item)
 			return NULL;
+		if ((cache = BN_CACHE_get()) != NULL)
+			cache->stats.pool_allocs++;
 		/* Initialise the structure */
 		bn = item->vals;
 		while (loop++ < BN_CTX_POOL_SIZE)
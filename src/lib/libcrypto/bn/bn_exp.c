@@ -680,6 +680,11 @@ BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
 		return ret;
 	}
 
+#ifdef OPENSSL_BN_ASM_IFMA
+	if (bn_mod_exp_ifma_usable(&m, 1))
+		return bn_mod_exp_ifma(&rr, &a, &p, &m, 1, ctx);
+#endif
+
 	BN_CTX_start(ctx);
 
 	/* Allocate a montgomery context if it was not supplied by the caller.
@@ -905,6 +910,30 @@ err:
 	return (ret);
 }
 
+/*
+ * Compute rr1 = a1^p1 mod m1 and rr2 = a2^p2 mod m2 in constant time. Where
+ * the CPU allows, both are done at once, which costs little more than one
+ * of them; this suits the two CRT halves of an RSA private key operation.
+ */
+int
+bn_mod_exp_mont_consttime_x2(BIGNUM *rr1, const BIGNUM *a1, const BIGNUM *p1,
+    const BIGNUM *m1, BN_MONT_CTX *in_mont1, BIGNUM *rr2, const BIGNUM *a2,
+    const BIGNUM *p2, const BIGNUM *m2, BN_MONT_CTX *in_mont2, BN_CTX *ctx)
+{
+#ifdef OPENSSL_BN_ASM_IFMA
+	BIGNUM *rr[2] = { rr1, rr2 };
+	const BIGNUM *a[2] = { a1, a2 };
+	const BIGNUM *p[2] = { p1, p2 };
+	const BIGNUM *m[2] = { m1, m2 };
+
+	if (bn_mod_exp_ifma_usable(m, 2))
+		return bn_mod_exp_ifma(rr, a, p, m, 2, ctx);
+#endif
+	if (!BN_mod_exp_mont_consttime(rr1, a1, p1, m1, ctx, in_mont1))
+		return 0;
+	return BN_mod_exp_mont_consttime(rr2, a2, p2, m2, ctx, in_mont2);
+}
+
 int
 BN_mod_exp_mont_word(BIGNUM *rr, BN_ULONG a, const BIGNUM *p, const BIGNUM *m,
     BN_CTX *ctx, BN_MONT_CTX *in_mont)
@@ -0,0 +1,327 @@
+/*	$OpenBSD$	*/
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Constant time modular exponentiation for 1024, 1536 and 2048-bit moduli
+ * using the radix 2^52 AVX-512 IFMA multiplication in x86_64-ifma.pl.
+ * Two exponentiations with moduli of the same size, such as the two CRT
+ * halves of an RSA private key operation, can be done at once for little
+ * more than the cost of one.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/err.h>
+
+#include "bn_lcl.h"
+#include "constant_time_locl.h"
+#include "cryptlib.h"
+#include "x86_arch.h"
+
+#define BN_IFMA_MASK52	0xfffffffffffffULL
+#define BN_IFMA_WINDOW	5
+
+void bn_amm52x20_x1_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_amm52x20_x2_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_gather52x20_ifma(uint64_t *, const uint64_t *, size_t, int);
+void bn_amm52x30_x1_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_amm52x30_x2_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_gather52x30_ifma(uint64_t *, const uint64_t *, size_t, int);
+void bn_amm52x40_x1_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_amm52x40_x2_ifma(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+void bn_gather52x40_ifma(uint64_t *, const uint64_t *, size_t, int);
+
+typedef void (*bn_amm52_func)(uint64_t *, const uint64_t *, const uint64_t *,
+    const uint64_t *, const uint64_t *);
+
+static const struct bn_ifma_method {
+	int bits;
+	int n;
+	bn_amm52_func amm[2];
+	void (*gather)(uint64_t *, const uint64_t *, size_t, int);
+} bn_ifma_methods[] = {
+	{
+		.bits = 1024,
+		.n = 20,
+		.amm = { bn_amm52x20_x1_ifma, bn_amm52x20_x2_ifma },
+		.gather = bn_gather52x20_ifma,
+	},
+	{
+		.bits = 1536,
+		.n = 30,
+		.amm = { bn_amm52x30_x1_ifma, bn_amm52x30_x2_ifma },
+		.gather = bn_gather52x30_ifma,
+	},
+	{
+		.bits = 2048,
+		.n = 40,
+		.amm = { bn_amm52x40_x1_ifma, bn_amm52x40_x2_ifma },
+		.gather = bn_gather52x40_ifma,
+	},
+};
+
+#define N_BN_IFMA_METHODS \
+    (sizeof(bn_ifma_methods) / sizeof(bn_ifma_methods[0]))
+
+static const struct bn_ifma_method *
+bn_ifma_method(const BIGNUM *m)
+{
+	size_t i;
+
+	for (i = 0; i < N_BN_IFMA_METHODS; i++) {
+		if (BN_num_bits(m) == bn_ifma_methods[i].bits)
+			return &bn_ifma_methods[i];
+	}
+	return NULL;
+}
+
+int
+bn_mod_exp_ifma_usable(const BIGNUM *m[], int num)
+{
+	const uint32_t ifma = IA32CAP_MASK2_AVX512F | IA32CAP_MASK2_AVX512IFMA;
+	const struct bn_ifma_method *meth;
+	int i;
+
+	if ((OPENSSL_cpu_caps_ext() & ifma) != ifma)
+		return 0;
+	if (num < 1 || num > 2)
+		return 0;
+	if ((meth = bn_ifma_method(m[0])) == NULL)
+		return 0;
+	for (i = 0; i < num; i++) {
+		if (bn_ifma_method(m[i]) != meth || !BN_is_odd(m[i]))
+			return 0;
+	}
+	return 1;
+}
+
+/* Convert the nonnegative a < 2^(52n) to n limbs of 52 bits. */
+static void
+bn_to_radix52(uint64_t *r, int n, const BIGNUM *a)
+{
+	int i, bit, w, s;
+	uint64_t v;
+
+	for (i = 0, bit = 0; i < n; i++, bit += 52) {
+		w = bit / BN_BITS2;
+		s = bit % BN_BITS2;
+		v = 0;
+		if (w < a->top) {
+			v = a->d[w] >> s;
+			if (s > BN_BITS2 - 52 && w + 1 < a->top)
+				v |= a->d[w + 1] << (BN_BITS2 - s);
+		}
+		r[i] = v & BN_IFMA_MASK52;
+	}
+}
+
+static int
+bn_from_radix52(BIGNUM *r, const uint64_t *a, int n)
+{
+	int i, bit, w, s, top;
+
+	top = (52 * n + BN_BITS2 - 1) / BN_BITS2;
+	if (bn_wexpand(r, top) == NULL)
+		return 0;
+	memset(r->d, 0, top * sizeof(r->d[0]));
+	for (i = 0, bit = 0; i < n; i++, bit += 52) {
+		w = bit / BN_BITS2;
+		s = bit % BN_BITS2;
+		r->d[w] |= a[i] << s;
+		if (s > BN_BITS2 - 52)
+			r->d[w + 1] |= a[i] >> (BN_BITS2 - s);
+	}
+	r->top = top;
+	r->neg = 0;
+	bn_correct_top(r);
+	return 1;
+}
+
+/* Returns -m^-1 mod 2^52 for odd m. */
+static uint64_t
+bn_ifma_k0(const uint64_t *m)
+{
+	uint64_t x;
+	int i;
+
+	x = m[0];		/* correct to 3 bits since m^2 = 1 mod 8 */
+	for (i = 0; i < 5; i++)
+		x *= 2 - m[0] * x;
+	return -x & BN_IFMA_MASK52;
+}
+
+/*
+ * Reduce a < 2m to a mod m, in constant time. All limbs are 52 bits; tmp
+ * holds n limbs.
+ */
+static void
+bn_ifma_reduce(uint64_t *a, const uint64_t *m, uint64_t *tmp, int n)
+{
+	uint64_t borrow = 0, mask;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		tmp[i] = a[i] - m[i] - borrow;
+		borrow = tmp[i] >> 63;
+		tmp[i] &= BN_IFMA_MASK52;
+	}
+	/* keep a if the subtraction borrowed, that is, if a < m */
+	mask = 0 - borrow;
+	for (i = 0; i < n; i++)
+		a[i] = (a[i] & mask) | (tmp[i] & ~mask);
+}
+
+/* Returns the BN_IFMA_WINDOW bits of p starting at bit. */
+static int
+bn_ifma_window(const BIGNUM *p, int bit)
+{
+	BN_ULONG v;
+	int w, s;
+
+	w = bit / BN_BITS2;
+	s = bit % BN_BITS2;
+	if (w >= p->top)
+		return 0;
+	v = p->d[w] >> s;
+	if (s > BN_BITS2 - BN_IFMA_WINDOW && w + 1 < p->top)
+		v |= p->d[w + 1] << (BN_BITS2 - s);
+	return v & ((1 << BN_IFMA_WINDOW) - 1);
+}
+
+/*
+ * Computes rr[i] = a[i]^p[i] mod m[i] for num operands, num being 1 or 2,
+ * with a fixed window and a constant time table lookup. The caller must
+ * have checked bn_mod_exp_ifma_usable() for m.
+ */
+int
+bn_mod_exp_ifma(BIGNUM *rr[], const BIGNUM *a[], const BIGNUM *p[],
+    const BIGNUM *m[], int num, BN_CTX *ctx)
+{
+	const struct bn_ifma_method *meth;
+	bn_amm52_func amm;
+	BIGNUM *t;
+	uint64_t *buf = NULL, *table, *mm, *rrm, *acc, *tmp, *one;
+	uint64_t k0[2];
+	size_t buflen = 0;
+	int n, len, stride;
+	int i, j, bits, bit, wvalue;
+	int ret = 0;
+
+	BN_CTX_start(ctx);
+
+	if ((t = BN_CTX_get(ctx)) == NULL)
+		goto err;
+
+	if ((meth = bn_ifma_method(m[0])) == NULL || num < 1 || num > 2) {
+		BNerror(ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+		goto err;
+	}
+	n = meth->n;
+	amm = meth->amm[num - 1];
+
+	/*
+	 * Every value is held as num operands of len limbs each, zero padded
+	 * to a whole number of 512-bit vectors.
+	 */
+	len = (n + 7) & ~7;
+	stride = num * len;
+	buflen = ((1 << BN_IFMA_WINDOW) + 5) * stride * sizeof(uint64_t);
+	if ((buf = calloc(1, buflen)) == NULL) {
+		BNerror(ERR_R_MALLOC_FAILURE);
+		goto err;
+	}
+	table = buf;
+	mm = table + (1 << BN_IFMA_WINDOW) * stride;
+	rrm = mm + stride;
+	acc = rrm + stride;
+	tmp = acc + stride;
+	one = tmp + stride;
+
+	bits = 0;
+	for (i = 0; i < num; i++) {
+		bn_to_radix52(&mm[i * len], n, m[i]);
+		k0[i] = bn_ifma_k0(&mm[i * len]);
+		one[i * len] = 1;
+
+		/* rrm = R^2 mod m, where R = 2^(52n) */
+		BN_zero(t);
+		if (!BN_set_bit(t, 2 * 52 * n))
+			goto err;
+		if (!BN_mod_ct(t, t, m[i], ctx))
+			goto err;
+		bn_to_radix52(&rrm[i * len], n, t);
+
+		if (a[i]->neg || BN_ucmp(a[i], m[i]) >= 0) {
+			if (!BN_nnmod(t, a[i], m[i], ctx))
+				goto err;
+			bn_to_radix52(&acc[i * len], n, t);
+		} else
+			bn_to_radix52(&acc[i * len], n, a[i]);
+
+		if (BN_num_bits(p[i]) > bits)
+			bits = BN_num_bits(p[i]);
+	}
+
+	/* table[i] = a^i R mod m */
+	amm(&table[0], rrm, one, mm, k0);
+	amm(&table[stride], acc, rrm, mm, k0);
+	for (i = 2; i < (1 << BN_IFMA_WINDOW); i++)
+		amm(&table[i * stride], &table[(i - 1) * stride],
+		    &table[stride], mm, k0);
+
+	bits = (bits + BN_IFMA_WINDOW - 1) / BN_IFMA_WINDOW * BN_IFMA_WINDOW;
+	if (bits == 0)
+		bits = BN_IFMA_WINDOW;
+
+	bit = bits - BN_IFMA_WINDOW;
+	for (i = 0; i < num; i++) {
+		wvalue = bn_ifma_window(p[i], bit);
+		meth->gather(&acc[i * len], &table[i * len], stride, wvalue);
+	}
+	while (bit > 0) {
+		bit -= BN_IFMA_WINDOW;
+		for (j = 0; j < BN_IFMA_WINDOW; j++)
+			amm(acc, acc, acc, mm, k0);
+		for (i = 0; i < num; i++) {
+			wvalue = bn_ifma_window(p[i], bit);
+			meth->gather(&tmp[i * len], &table[i * len], stride,
+			    wvalue);
+		}
+		amm(acc, acc, tmp, mm, k0);
+	}
+
+	/* Leave the Montgomery domain and reduce fully. */
+	amm(acc, acc, one, mm, k0);
+	for (i = 0; i < num; i++) {
+		bn_ifma_reduce(&acc[i * len], &mm[i * len], tmp, n);
+		if (!bn_from_radix52(rr[i], &acc[i * len], n))
+			goto err;
+	}
+
+	ret = 1;
+
+ err:
+	freezero(buf, buflen);
+	BN_CTX_end(ctx);
+	return ret;
+}
@@ -139,6 +139,13 @@ struct bn_mont_ctx_st {
 	int flags;
 };
 
+/* Per-thread BN_CTX cache counters, see bn_ctx.c */
+struct bn_ctx_stats {
+	unsigned long ctx_new;		/* BN_CTX_new() calls */
+	unsigned long ctx_reused;	/* of which served from the cache */
+	unsigned long pool_allocs;	/* BN_CTX pool item allocations */
+};
+
 /* Used for reciprocal division/mod functions
  * It cannot be shared between threads
  */
@@ -641,6 +648,19 @@ int BN_mod_exp_mont_ct(BIGNUM *r, const BIGNUM *a, const BIGNUM *p,
     const BIGNUM *m, BN_CTX *ctx, BN_MONT_CTX *m_ctx);
 int BN_mod_exp_mont_nonct(BIGNUM *r, const BIGNUM *a, const BIGNUM *p,
     const BIGNUM *m, BN_CTX *ctx, BN_MONT_CTX *m_ctx);
+int bn_mod_exp_mont_consttime_x2(BIGNUM *rr1, const BIGNUM *a1,
+    const BIGNUM *p1, const BIGNUM *m1, BN_MONT_CTX *in_mont1, BIGNUM *rr2,
+    const BIGNUM *a2, const BIGNUM *p2, const BIGNUM *m2,
+    BN_MONT_CTX *in_mont2, BN_CTX *ctx);
+#ifdef OPENSSL_BN_ASM_MULX
+int bn_mul_mulx(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b, int n);
+int bn_sqr_mulx(BN_ULONG *r, const BN_ULONG *a, int n);
+#endif
+#ifdef OPENSSL_BN_ASM_IFMA
+int bn_mod_exp_ifma_usable(const BIGNUM *m[], int num);
+int bn_mod_exp_ifma(BIGNUM *rr[], const BIGNUM *a[], const BIGNUM *p[],
+    const BIGNUM *m[], int num, BN_CTX *ctx);
+#endif
 int BN_div_nonct(BIGNUM *dv, BIGNUM *rem, const BIGNUM *m, const BIGNUM *d,
     BN_CTX *ctx);
 int BN_div_ct(BIGNUM *dv, BIGNUM *rem, const BIGNUM *m, const BIGNUM *d,
@@ -661,5 +681,12 @@ int bn_is_perfect_square(int *out_perfect, const BIGNUM *n, BN_CTX *ctx);
 
 int bn_is_prime_bpsw(int *is_prime, const BIGNUM *n, BN_CTX *in_ctx);
 
+int bn_generate_prime_from(BIGNUM *ret, const BIGNUM *start, int safe,
+    const BIGNUM *step, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb);
+
+int bn_ctx_stats(struct bn_ctx_stats *stats);
+
 __END_HIDDEN_DECLS
 #endif
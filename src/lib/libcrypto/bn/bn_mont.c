@@ -518,30 +518,31 @@ BN_MONT_CTX *
 BN_MONT_CTX_set_locked(BN_MONT_CTX **pmont, int lock, const BIGNUM *mod,
     BN_CTX *ctx)
 {
-	int got_write_lock = 0;
 	BN_MONT_CTX *ret;
 
-	CRYPTO_r_lock(lock);
+	/*
+	 * Once published, *pmont does not change until its owner is freed,
+	 * so the common case does not need the lock.  The barriers order
+	 * the initialisation of the BN_MONT_CTX before the store of the
+	 * pointer and the load of the pointer before any use of it.
+	 */
+	if ((ret = *(BN_MONT_CTX * volatile *)pmont) != NULL) {
+		__sync_synchronize();
+		return ret;
+	}
+
+	CRYPTO_w_lock(lock);
 	if (!*pmont) {
-		CRYPTO_r_unlock(lock);
-		CRYPTO_w_lock(lock);
-		got_write_lock = 1;
-
-		if (!*pmont) {
-			ret = BN_MONT_CTX_new();
-			if (ret && !BN_MONT_CTX_set(ret, mod, ctx))
-				BN_MONT_CTX_free(ret);
-			else
-				*pmont = ret;
+		ret = BN_MONT_CTX_new();
+		if (ret && !BN_MONT_CTX_set(ret, mod, ctx))
+			BN_MONT_CTX_free(ret);
+		else {
+			__sync_synchronize();
+			*pmont = ret;
 		}
 	}
-
 	ret = *pmont;
-
-	if (got_write_lock)
-		CRYPTO_w_unlock(lock);
-	else
-		CRYPTO_r_unlock(lock);
+	CRYPTO_w_unlock(lock);
 
 	return ret;
 }
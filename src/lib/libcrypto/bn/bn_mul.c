@@ -69,6 +69,51 @@
 
 #include "bn_lcl.h"
 
+#ifdef OPENSSL_BN_ASM_MULX
+#include "cryptlib.h"
+#include "x86_arch.h"
+
+void bn_mul_mulx4(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+void bn_mul_mulx6(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+void bn_mul_mulx8(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+void bn_mul_mulx9(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+void bn_mul_mulx16(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b);
+
+/*
+ * Set r to the 2n word product of a and b with the MULX/ADX kernels from
+ * x86_64-mulx.pl. Returns 0 if the CPU lacks BMI2 or ADX, or if there is
+ * no kernel for n words.
+ */
+int
+bn_mul_mulx(BN_ULONG *r, const BN_ULONG *a, const BN_ULONG *b, int n)
+{
+	const uint32_t mulx_adx = IA32CAP_MASK2_BMI2 | IA32CAP_MASK2_ADX;
+
+	if ((OPENSSL_cpu_caps_ext() & mulx_adx) != mulx_adx)
+		return 0;
+
+	switch (n) {
+	case 4:
+		bn_mul_mulx4(r, a, b);
+		return 1;
+	case 6:
+		bn_mul_mulx6(r, a, b);
+		return 1;
+	case 8:
+		bn_mul_mulx8(r, a, b);
+		return 1;
+	case 9:
+		bn_mul_mulx9(r, a, b);
+		return 1;
+	case 16:
+		bn_mul_mulx16(r, a, b);
+		return 1;
+	}
+
+	return 0;
+}
+#endif
+
 #if defined(OPENSSL_NO_ASM) || !defined(OPENSSL_BN_ASM_PART_WORDS)
 /* Here follows specialised variants of bn_add_words() and
    bn_sub_words().  They have the property performing operations on
@@ -443,6 +488,14 @@ bn_mul_recursive(BN_ULONG *r, BN_ULONG *a, BN_ULONG *b, int n2, int dna,
 # ifdef BN_COUNT
 	fprintf(stderr, " bn_mul_recursive %d%+d * %d%+d\n",n2,dna,n2,dnb);
 # endif
+# ifdef OPENSSL_BN_ASM_MULX
+	/*
+	 * With the MULX kernels the recursion bottoms out at 16 words, where
+	 * the kernel is about twice as fast as one more Karatsuba step.
+	 */
+	if (dna == 0 && dnb == 0 && bn_mul_mulx(r, a, b, n2))
+		return;
+# endif
 # ifdef BN_MUL_COMBA
 #  if 0
 	if (n2 == 4) {
@@ -980,6 +1033,14 @@ BN_mul(BIGNUM *r, const BIGNUM *a, const BIGNUM *b, BN_CTX *ctx)
 #endif
 #ifdef BN_MUL_COMBA
 	if (i == 0) {
+# ifdef OPENSSL_BN_ASM_MULX
+		if (bn_wexpand(rr, top) == NULL)
+			goto err;
+		if (bn_mul_mulx(rr->d, a->d, b->d, al)) {
+			rr->top = top;
+			goto end;
+		}
+# endif
 # if 0
 		if (al == 4) {
 			if (bn_wexpand(rr, 8) == NULL)
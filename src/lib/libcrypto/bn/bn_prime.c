@@ -109,7 +109,9 @@
  *
  */
 
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 
 #include <openssl/err.h>
@@ -253,6 +255,353 @@ err:
 	return found;
 }
 
+/*
+ * Multi-threaded prime generation. A random starting point is drawn once and
+ * the candidates start + k * step are sieved incrementally: the residues of
+ * the current candidate modulo the small primes are advanced by those of the
+ * step rather than recomputed with BN_mod_word(). Candidates that survive
+ * the sieve are handed out in order to the calling thread and to workers run
+ * on threads provided by the caller, and the one with the smallest k that
+ * passes the primality test is returned. The result thus depends only on the
+ * starting point, not on the number of threads or on how they are scheduled.
+ * libcrypto never creates threads itself.
+ */
+
+#define BN_PRIME_MT_MAX_THREADS	64
+
+struct bn_prime_search {
+	pthread_mutex_t lock;
+	pthread_cond_t done;
+	int running;
+	const BIGNUM *start;
+	const BIGNUM *step;
+	int safe;
+
+	/* residues of the next candidate and of the step; q = p >> 1 */
+	prime_t mods[NUMPRIMES];
+	prime_t steps[NUMPRIMES];
+	prime_t qmods[NUMPRIMES];
+	prime_t qsteps[NUMPRIMES];
+	BN_ULONG next;
+
+	BN_ULONG found;
+	BIGNUM *result;
+	int failed;
+
+	BN_GENCB *cb;
+	int ncalls;
+};
+
+/* Returns k for the next candidate that survives the sieve. */
+static BN_ULONG
+bn_prime_search_next(struct bn_prime_search *s)
+{
+	BN_ULONG k;
+	int i, composite;
+
+	do {
+		composite = 0;
+		for (i = 1; i < NUMPRIMES; i++) {
+			if (s->safe) {
+				/* gcd(p, primes) == gcd(q, primes) == 1 */
+				composite |= s->mods[i] == 0 || s->qmods[i] == 0;
+				s->qmods[i] += s->qsteps[i];
+				if (s->qmods[i] >= primes[i])
+					s->qmods[i] -= primes[i];
+			} else {
+				/* p is not a small prime and
+				 * gcd(p - 1, primes) == 1 (except for 2) */
+				composite |= s->mods[i] <= 1;
+			}
+			s->mods[i] += s->steps[i];
+			if (s->mods[i] >= primes[i])
+				s->mods[i] -= primes[i];
+		}
+		k = s->next++;
+	} while (composite);
+
+	return k;
+}
+
+static void
+bn_prime_search_run(struct bn_prime_search *s, int caller)
+{
+	BN_CTX *ctx;
+	BIGNUM *p, *q;
+	BN_ULONG k;
+	int is_prime;
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		goto fail;
+	BN_CTX_start(ctx);
+	if ((p = BN_CTX_get(ctx)) == NULL)
+		goto fail;
+	if ((q = BN_CTX_get(ctx)) == NULL)
+		goto fail;
+
+	for (;;) {
+		pthread_mutex_lock(&s->lock);
+		if (s->failed || s->found != BN_MASK2) {
+			/* all candidates before the one found are taken */
+			pthread_mutex_unlock(&s->lock);
+			break;
+		}
+		k = bn_prime_search_next(s);
+		pthread_mutex_unlock(&s->lock);
+
+		/* Only the calling thread may invoke the callback. */
+		if (caller && !BN_GENCB_call(s->cb, 0, s->ncalls++))
+			goto fail;
+
+		if (!BN_copy(p, s->step))
+			goto fail;
+		if (!BN_mul_word(p, k))
+			goto fail;
+		if (!BN_add(p, p, s->start))
+			goto fail;
+
+		is_prime = BN_is_prime_fasttest_ex(p, BN_prime_checks, ctx, 0,
+		    NULL);
+		if (is_prime == 1 && s->safe) {
+			if (!BN_rshift1(q, p))
+				goto fail;
+			is_prime = BN_is_prime_fasttest_ex(q, BN_prime_checks,
+			    ctx, 0, NULL);
+		}
+		if (is_prime == -1)
+			goto fail;
+		if (is_prime == 0)
+			continue;
+
+		pthread_mutex_lock(&s->lock);
+		if (k < s->found) {
+			s->found = k;
+			if (!BN_copy(s->result, p))
+				s->failed = 1;
+		}
+		pthread_mutex_unlock(&s->lock);
+	}
+
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+	return;
+
+ fail:
+	pthread_mutex_lock(&s->lock);
+	s->failed = 1;
+	pthread_mutex_unlock(&s->lock);
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+}
+
+static void
+bn_prime_search_worker(void *arg)
+{
+	struct bn_prime_search *s = arg;
+
+	bn_prime_search_run(s, 0);
+
+	pthread_mutex_lock(&s->lock);
+	if (--s->running == 0)
+		pthread_cond_signal(&s->done);
+	pthread_mutex_unlock(&s->lock);
+}
+
+/*
+ * Find the first prime (or safe prime) in the sequence start + k * step for
+ * k = 0, 1, ..., on the calling thread and on up to nthreads - 1 workers
+ * handed to start_thread. The starting point must satisfy the congruences
+ * required for the result; for safe primes step must be even.
+ */
+int
+bn_generate_prime_from(BIGNUM *ret, const BIGNUM *start, int safe,
+    const BIGNUM *step, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb)
+{
+	struct bn_prime_search *s;
+	BIGNUM *qstart = NULL;
+	BN_ULONG mod;
+	int i, n;
+	int ret_val = 0;
+
+	if ((s = calloc(1, sizeof(*s))) == NULL) {
+		BNerror(ERR_R_MALLOC_FAILURE);
+		return 0;
+	}
+	if (pthread_mutex_init(&s->lock, NULL) != 0) {
+		free(s);
+		return 0;
+	}
+	if (pthread_cond_init(&s->done, NULL) != 0) {
+		pthread_mutex_destroy(&s->lock);
+		free(s);
+		return 0;
+	}
+	s->start = start;
+	s->step = step;
+	s->safe = safe;
+	s->found = BN_MASK2;
+	s->result = ret;
+	s->cb = cb;
+
+	if (safe && (qstart = BN_new()) == NULL)
+		goto err;
+	if (safe && !BN_rshift1(qstart, start))
+		goto err;
+	for (i = 1; i < NUMPRIMES; i++) {
+		if ((mod = BN_mod_word(start, primes[i])) == (BN_ULONG)-1)
+			goto err;
+		s->mods[i] = mod;
+		if ((mod = BN_mod_word(step, primes[i])) == (BN_ULONG)-1)
+			goto err;
+		s->steps[i] = mod;
+		if (!safe)
+			continue;
+		if ((mod = BN_mod_word(qstart, primes[i])) == (BN_ULONG)-1)
+			goto err;
+		s->qmods[i] = mod;
+		/* q advances by step / 2 */
+		s->qsteps[i] = (s->steps[i] + (s->steps[i] & 1) * primes[i]) / 2;
+	}
+
+	if (start_thread == NULL)
+		nthreads = 1;
+	if (nthreads > BN_PRIME_MT_MAX_THREADS)
+		nthreads = BN_PRIME_MT_MAX_THREADS;
+	for (n = 1; n < nthreads; n++) {
+		/* A worker may be done before start_thread returns. */
+		pthread_mutex_lock(&s->lock);
+		s->running++;
+		pthread_mutex_unlock(&s->lock);
+		if (!start_thread(bn_prime_search_worker, s, arg)) {
+			/* Carry on with fewer threads. */
+			pthread_mutex_lock(&s->lock);
+			s->running--;
+			pthread_mutex_unlock(&s->lock);
+			break;
+		}
+	}
+	bn_prime_search_run(s, 1);
+
+	/* The workers use s until they return. */
+	pthread_mutex_lock(&s->lock);
+	while (s->running > 0)
+		pthread_cond_wait(&s->done, &s->lock);
+	pthread_mutex_unlock(&s->lock);
+
+	if (s->failed || s->found == BN_MASK2)
+		goto err;
+
+	ret_val = 1;
+
+ err:
+	BN_free(qstart);
+	pthread_cond_destroy(&s->done);
+	pthread_mutex_destroy(&s->lock);
+	free(s);
+	bn_check_top(ret);
+	return ret_val;
+}
+
+int
+BN_generate_prime_mt(BIGNUM *ret, int bits, int safe, const BIGNUM *add,
+    const BIGNUM *rem, int nthreads,
+    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+    void *arg, BN_GENCB *cb)
+{
+	BN_CTX *ctx;
+	BIGNUM *start, *step, *t;
+	int found = 0;
+
+	/*
+	 * The sieve assumes that the candidates are larger than the small
+	 * primes. The serial code handles the small sizes just as well.
+	 */
+	if (bits < 64)
+		return BN_generate_prime_ex(ret, bits, safe, add, rem, cb);
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		return 0;
+	BN_CTX_start(ctx);
+	if ((start = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if ((step = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if ((t = BN_CTX_get(ctx)) == NULL)
+		goto err;
+
+	if (add == NULL && !safe) {
+		/* as in probable_prime() */
+		if (!BN_rand(start, bits, 1, 1))
+			goto err;
+		if (!BN_set_word(step, 2))
+			goto err;
+	} else if (!safe) {
+		/* as in probable_prime_dh(): start = rem mod add */
+		if (!BN_rand(start, bits, 0, 1))
+			goto err;
+		if (!BN_mod_ct(t, start, add, ctx))
+			goto err;
+		if (!BN_sub(start, start, t))
+			goto err;
+		if (rem == NULL) {
+			if (!BN_add_word(start, 1))
+				goto err;
+		} else {
+			if (!BN_add(start, start, rem))
+				goto err;
+		}
+		if (!BN_copy(step, add))
+			goto err;
+	} else {
+		/*
+		 * As in probable_prime_dh_safe(), with q = (p - 1) / 2 drawn
+		 * first. Safe primes above 7 are 3 mod 4, which serves when
+		 * no congruence is given.
+		 */
+		if (add == NULL) {
+			if (!BN_set_word(step, 4))
+				goto err;
+		} else {
+			if (!BN_copy(step, add))
+				goto err;
+		}
+		if (!BN_rand(start, bits - 1, 0, 1))
+			goto err;
+		if (!BN_rshift1(t, step))
+			goto err;
+		if (!BN_mod_ct(t, start, t, ctx))
+			goto err;
+		if (!BN_sub(start, start, t))
+			goto err;
+		if (add == NULL) {
+			if (!BN_add_word(start, 1))
+				goto err;
+		} else if (rem == NULL) {
+			if (!BN_add_word(start, 1))
+				goto err;
+		} else {
+			if (!BN_rshift1(t, rem))
+				goto err;
+			if (!BN_add(start, start, t))
+				goto err;
+		}
+		if (!BN_lshift1(start, start))
+			goto err;
+		if (!BN_add_word(start, 1))
+			goto err;
+	}
+
+	found = bn_generate_prime_from(ret, start, safe, step, nthreads,
+	    start_thread, arg, cb);
+
+ err:
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+	return found;
+}
+
 int
 BN_is_prime_ex(const BIGNUM *a, int checks, BN_CTX *ctx_passed, BN_GENCB *cb)
 {
@@ -61,6 +61,51 @@
 
 #include "bn_lcl.h"
 
+#ifdef OPENSSL_BN_ASM_MULX
+#include "cryptlib.h"
+#include "x86_arch.h"
+
+void bn_sqr_mulx4(BN_ULONG *r, const BN_ULONG *a);
+void bn_sqr_mulx6(BN_ULONG *r, const BN_ULONG *a);
+void bn_sqr_mulx8(BN_ULONG *r, const BN_ULONG *a);
+void bn_sqr_mulx9(BN_ULONG *r, const BN_ULONG *a);
+void bn_sqr_mulx16(BN_ULONG *r, const BN_ULONG *a);
+
+/*
+ * Set r to the 2n word square of a with the MULX/ADX kernels from
+ * x86_64-mulx.pl. Returns 0 if the CPU lacks BMI2 or ADX, or if there is
+ * no kernel for n words.
+ */
+int
+bn_sqr_mulx(BN_ULONG *r, const BN_ULONG *a, int n)
+{
+	const uint32_t mulx_adx = IA32CAP_MASK2_BMI2 | IA32CAP_MASK2_ADX;
+
+	if ((OPENSSL_cpu_caps_ext() & mulx_adx) != mulx_adx)
+		return 0;
+
+	switch (n) {
+	case 4:
+		bn_sqr_mulx4(r, a);
+		return 1;
+	case 6:
+		bn_sqr_mulx6(r, a);
+		return 1;
+	case 8:
+		bn_sqr_mulx8(r, a);
+		return 1;
+	case 9:
+		bn_sqr_mulx9(r, a);
+		return 1;
+	case 16:
+		bn_sqr_mulx16(r, a);
+		return 1;
+	}
+
+	return 0;
+}
+#endif
+
 /* r must not be a */
 /* I've just gone over this and it is now %20 faster on x86 - eay - 27 Jun 96 */
 int
@@ -92,6 +137,10 @@ BN_sqr(BIGNUM *r, const BIGNUM *a, BN_CTX *ctx)
 	if (bn_wexpand(rr, max) == NULL)
 		goto err;
 
+#ifdef OPENSSL_BN_ASM_MULX
+	if (bn_sqr_mulx(rr->d, a->d, al))
+		goto done;
+#endif
 	if (al == 4) {
 #ifndef BN_SQR_COMBA
 		BN_ULONG t[8];
@@ -134,6 +183,9 @@ BN_sqr(BIGNUM *r, const BIGNUM *a, BN_CTX *ctx)
 #endif
 	}
 
+#ifdef OPENSSL_BN_ASM_MULX
+ done:
+#endif
 	rr->neg = 0;
 	/* If the most-significant half of the top word of 'a' is zero, then
 	 * the square of 'a' will max-1 words. */
@@ -209,6 +261,10 @@ bn_sqr_recursive(BN_ULONG *r, const BN_ULONG *a, int n2, BN_ULONG *t)
 
 #ifdef BN_COUNT
 	fprintf(stderr, " bn_sqr_recursive %d * %d\n", n2, n2);
+#endif
+#ifdef OPENSSL_BN_ASM_MULX
+	if (bn_sqr_mulx(r, a, n2))
+		return;
 #endif
 	if (n2 == 4) {
 #ifndef BN_SQR_COMBA
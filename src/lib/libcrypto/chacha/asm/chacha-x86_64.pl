@@ -0,0 +1,497 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Multi-block ChaCha20 for SSSE3, AVX2 and AVX-512.
+#
+# The state is kept "vertically": vector register i holds state word i
+# of 4 (SSSE3), 8 (AVX2) or 16 (AVX-512) consecutive blocks, so that the
+# four quarter rounds of a column or diagonal round run on independent
+# registers and no shuffling is needed between rounds. The keystream is
+# transposed back into block order only once, after the 20 rounds.
+#
+# With 16 registers, SSSE3 and AVX2 cannot hold the 16 state words plus
+# temporaries, so words 8 to 11 live on the stack and are brought in
+# two at a time; the order of the quarter rounds is chosen so that this
+# only costs two loads and two stores per double round. AVX-512 has 32
+# registers and uses vprold for the rotations.
+#
+# void chacha_blocks_ssse3(unsigned char *out, const unsigned char *in,
+#     size_t blocks, const uint32_t input[16]);
+# void chacha_blocks_avx2(unsigned char *out, const unsigned char *in,
+#     size_t blocks, const uint32_t input[16]);
+# void chacha_blocks_avx512(unsigned char *out, const unsigned char *in,
+#     size_t blocks, const uint32_t input[16]);
+#
+# blocks must be a non-zero multiple of 4, 8 and 16 respectively. The
+# block counter is input[12] + i for block i; only the low 32 bits of
+# the counter are incremented and input is not updated, so the caller
+# is responsible for advancing the counter and for never letting a call
+# cross a 2^32 block boundary.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($out,$inp,$blocks,$key)=("%rdi","%rsi","%rdx","%rcx");
+
+# Quarter round on state words a, b, c and d, with t as a temporary,
+# returned as a list of instructions.
+sub qr_ssse3 {
+my ($a,$b,$c,$d,$t)=@_;
+    return (
+	"paddd	$b,$a",
+	"pxor	$a,$d",
+	"pshufb	.Lrot16(%rip),$d",
+	"paddd	$d,$c",
+	"pxor	$c,$b",
+	"movdqa	$b,$t",
+	"pslld	\$12,$b",
+	"psrld	\$20,$t",
+	"por	$t,$b",
+	"paddd	$b,$a",
+	"pxor	$a,$d",
+	"pshufb	.Lrot24(%rip),$d",
+	"paddd	$d,$c",
+	"pxor	$c,$b",
+	"movdqa	$b,$t",
+	"pslld	\$7,$b",
+	"psrld	\$25,$t",
+	"por	$t,$b");
+}
+
+sub qr_avx2 {
+my ($a,$b,$c,$d,$t)=@_;
+    return (
+	"vpaddd	$b,$a,$a",
+	"vpxor	$a,$d,$d",
+	"vpshufb	.Lrot16(%rip),$d,$d",
+	"vpaddd	$d,$c,$c",
+	"vpxor	$c,$b,$b",
+	"vpslld	\$12,$b,$t",
+	"vpsrld	\$20,$b,$b",
+	"vpor	$t,$b,$b",
+	"vpaddd	$b,$a,$a",
+	"vpxor	$a,$d,$d",
+	"vpshufb	.Lrot24(%rip),$d,$d",
+	"vpaddd	$d,$c,$c",
+	"vpxor	$c,$b,$b",
+	"vpslld	\$7,$b,$t",
+	"vpsrld	\$25,$b,$b",
+	"vpor	$t,$b,$b");
+}
+
+sub qr_avx512 {
+my ($a,$b,$c,$d)=@_;
+    return (
+	"vpaddd	$b,$a,$a",
+	"vpxord	$a,$d,$d",
+	"vprold	\$16,$d,$d",
+	"vpaddd	$d,$c,$c",
+	"vpxord	$c,$b,$b",
+	"vprold	\$12,$b,$b",
+	"vpaddd	$b,$a,$a",
+	"vpxord	$a,$d,$d",
+	"vprold	\$8,$d,$d",
+	"vpaddd	$d,$c,$c",
+	"vpxord	$c,$b,$b",
+	"vprold	\$7,$b,$b");
+}
+
+# Interleave the instructions of independent quarter rounds.
+sub interleave {
+my @qr=@_;
+my $s="";
+
+    for (my $i=0; $i<scalar(@{$qr[0]}); $i++) {
+	$s.="\t$_->[$i]\n" for (@qr);
+    }
+    return $s;
+}
+
+######################################################################
+# SSSE3 and AVX2, 16 registers.
+#
+# Registers hold words 0-7 and 12-15; words 8-11 are spilled to the
+# stack and loaded two at a time into the @c pair.
+
+sub blocks16 {
+my ($isa)=@_;
+my $avx=($isa eq "avx2");
+my $x=$avx?"%ymm":"%xmm";
+my $sz=$avx?32:16;
+my $n=$avx?8:4;
+my @x=map("$x$_",(0..7,-1,-1,-1,-1,8..11));	# words 8-11 are spilled
+my @c=("${x}12","${x}13");
+my ($t0,$t1)=("${x}14","${x}15");
+my $qr=$avx?\&qr_avx2:\&qr_ssse3;
+my $mov=$avx?"vmovdqa":"movdqa";
+my $spill=0;			# words 8-11
+my $ctr=4*$sz;			# counter vector
+my $ks=5*$sz;			# keystream, words 0-15
+my $frame=$ks+16*$sz;
+my $code="";
+
+# Broadcast input[$i] into register $r.
+my $bcast=sub {
+my ($i,$r)=@_;
+    return $avx?
+	"\tvpbroadcastd	4*$i($key),$r\n" :
+	"\tmovd	4*$i($key),$r\n\tpshufd	\$0,$r,$r\n";
+};
+my $add=sub {
+my ($s,$d)=@_;
+    return $avx?"\tvpaddd	$s,$d,$d\n":"\tpaddd	$s,$d\n";
+};
+
+$code.=<<___;
+.globl	chacha_blocks_$isa
+.type	chacha_blocks_$isa,\@function,4
+.align	32
+chacha_blocks_$isa:
+	push	%rbp
+	mov	%rsp,%rbp
+	sub	\$$frame,%rsp
+	and	\$-64,%rsp
+
+___
+    $code.=&$bcast(12,$t0);
+    $code.=&$add(".Linc(%rip)",$t0);
+$code.=<<___;
+	$mov	$t0,$ctr(%rsp)
+
+.align	32
+.L${isa}_loop:
+___
+    for (my $i=0; $i<16; $i++) {
+	next if ($i>=8 && $i<12);
+	if ($i==12) {
+	    $code.="\t$mov	$ctr(%rsp),$x[$i]\n";
+	} else {
+	    $code.=&$bcast($i,$x[$i]);
+	}
+    }
+    $code.=&$bcast(8,$c[0]);
+    $code.=&$bcast(9,$c[1]);
+    $code.=&$bcast(10,$t0);
+    $code.=&$bcast(11,$t1);
+$code.=<<___;
+	$mov	$t0,$spill+2*$sz(%rsp)
+	$mov	$t1,$spill+3*$sz(%rsp)
+	mov	\$10,%eax
+	jmp	.L${isa}_rounds
+
+.align	32
+.L${isa}_rounds:
+___
+    # column round
+    $code.=interleave([&$qr(@x[0,4],$c[0],$x[12],$t0)],
+	[&$qr(@x[1,5],$c[1],$x[13],$t1)]);
+$code.=<<___;
+	$mov	$c[0],$spill+0*$sz(%rsp)
+	$mov	$c[1],$spill+1*$sz(%rsp)
+	$mov	$spill+2*$sz(%rsp),$c[0]
+	$mov	$spill+3*$sz(%rsp),$c[1]
+___
+    $code.=interleave([&$qr(@x[2,6],$c[0],$x[14],$t0)],
+	[&$qr(@x[3,7],$c[1],$x[15],$t1)]);
+    # diagonal round
+    $code.=interleave([&$qr(@x[0,5],$c[0],$x[15],$t0)],
+	[&$qr(@x[1,6],$c[1],$x[12],$t1)]);
+$code.=<<___;
+	$mov	$c[0],$spill+2*$sz(%rsp)
+	$mov	$c[1],$spill+3*$sz(%rsp)
+	$mov	$spill+0*$sz(%rsp),$c[0]
+	$mov	$spill+1*$sz(%rsp),$c[1]
+___
+    $code.=interleave([&$qr(@x[2,7],$c[0],$x[13],$t0)],
+	[&$qr(@x[3,4],$c[1],$x[14],$t1)]);
+$code.=<<___;
+	dec	%eax
+	jnz	.L${isa}_rounds
+
+___
+    # Add the input state and store the keystream words.
+    for (my $i=0; $i<16; $i++) {
+	my $r;
+
+	if ($i==8 || $i==9) {
+	    $r=$c[$i-8];
+	} elsif ($i==10 || $i==11) {
+	    $r=$c[$i-10];
+	    $code.="\t$mov	".($spill+$sz*($i-8))."(%rsp),$r\n";
+	} else {
+	    $r=$x[$i];
+	}
+	if ($i==12) {
+	    $code.=&$add("$ctr(%rsp)",$r);
+	} else {
+	    $code.=&$bcast($i,$t0);
+	    $code.=&$add($t0,$r);
+	}
+	$code.="\t$mov	$r,$ks+$sz*$i(%rsp)\n";
+    }
+
+    # Transpose four words at a time back into block order, xor with
+    # the input and store.
+    my @r=map("$x$_",(0..3));
+    my ($u0,$u1)=("${x}4","${x}5");
+    for (my $g=0; $g<4; $g++) {
+	$code.="\t$mov	".($ks+$sz*(4*$g+$_))."(%rsp),$r[$_]\n"
+	    for (0..3);
+	if ($avx) {
+	    $code.=<<___;
+	vpunpckldq	$r[1],$r[0],$u0
+	vpunpckhdq	$r[1],$r[0],$u1
+	vpunpckldq	$r[3],$r[2],$r[0]
+	vpunpckhdq	$r[3],$r[2],$r[1]
+	vpunpcklqdq	$r[0],$u0,$r[2]
+	vpunpckhqdq	$r[0],$u0,$r[3]
+	vpunpcklqdq	$r[1],$u1,$r[0]
+	vpunpckhqdq	$r[1],$u1,$r[1]
+___
+	    # Each register now holds words 4g..4g+3 of block j in its
+	    # low lane and of block j+4 in its high lane; keep groups
+	    # 0/1 and 2/3 together to write out 32 bytes at a time.
+	    my @o=@r[2,3,0,1];
+	    if ($g%2==0) {
+		$code.="\tvmovdqa	$o[$_],%ymm".(6+$_)."\n" for (0..3);
+		next;
+	    }
+	    for (my $j=0; $j<4; $j++) {
+		my $off=64*$j+16*($g-1);
+		$code.=<<___;
+	vperm2i128	\$0x20,$o[$j],%ymm`6+$j`,$u0
+	vperm2i128	\$0x31,$o[$j],%ymm`6+$j`,$u1
+	vpxor	$off($inp),$u0,$u0
+	vpxor	$off+256($inp),$u1,$u1
+	vmovdqu	$u0,$off($out)
+	vmovdqu	$u1,$off+256($out)
+___
+	    }
+	} else {
+	    $code.=<<___;
+	movdqa	$r[0],$u0
+	punpckldq	$r[1],$u0
+	punpckhdq	$r[1],$r[0]
+	movdqa	$r[2],$u1
+	punpckldq	$r[3],$u1
+	punpckhdq	$r[3],$r[2]
+	movdqa	$u0,$r[1]
+	punpcklqdq	$u1,$r[1]
+	punpckhqdq	$u1,$u0
+	movdqa	$r[0],$r[3]
+	punpcklqdq	$r[2],$r[3]
+	punpckhqdq	$r[2],$r[0]
+___
+	    # block 0 in $r[1], 1 in $u0, 2 in $r[3], 3 in $r[0]
+	    my @o=($r[1],$u0,$r[3],$r[0]);
+	    for (my $j=0; $j<4; $j++) {
+		my $off=64*$j+16*$g;
+		$code.=<<___;
+	movdqu	$off($inp),$u1
+	pxor	$u1,$o[$j]
+	movdqu	$o[$j],$off($out)
+___
+	    }
+	}
+    }
+
+$code.=<<___;
+
+	$mov	$ctr(%rsp),$t0
+___
+    $code.=&$add(".Lfour(%rip)",$t0) if (!$avx);
+    $code.=&$add(".Leight(%rip)",$t0) if ($avx);
+$code.=<<___;
+	$mov	$t0,$ctr(%rsp)
+	lea	64*$n($inp),$inp
+	lea	64*$n($out),$out
+	sub	\$$n,$blocks
+	jnz	.L${isa}_loop
+
+___
+    $code.="\tvzeroupper\n" if ($avx);
+$code.=<<___;
+	mov	%rbp,%rsp
+	pop	%rbp
+	ret
+.size	chacha_blocks_$isa,.-chacha_blocks_$isa
+
+___
+    return $code;
+}
+
+######################################################################
+# AVX-512, 32 registers.
+#
+# %zmm0-15 hold the state words, %zmm16 the counter vector and
+# %zmm17-31 are temporaries.
+
+sub blocks_avx512 {
+my @x=map("%zmm$_",(0..15));
+my $ctr="%zmm16";
+my @t=map("%zmm$_",(17..31));
+my $code="";
+
+$code.=<<___;
+.globl	chacha_blocks_avx512
+.type	chacha_blocks_avx512,\@function,4
+.align	32
+chacha_blocks_avx512:
+	vpbroadcastd	4*12($key),$ctr
+	vpaddd	.Linc(%rip),$ctr,$ctr
+	jmp	.Lavx512_loop
+
+.align	32
+.Lavx512_loop:
+___
+    for (my $i=0; $i<16; $i++) {
+	if ($i==12) {
+	    $code.="\tvmovdqa32	$ctr,$x[$i]\n";
+	} else {
+	    $code.="\tvpbroadcastd	4*$i($key),$x[$i]\n";
+	}
+    }
+$code.=<<___;
+	mov	\$10,%eax
+	jmp	.Lavx512_rounds
+
+.align	32
+.Lavx512_rounds:
+___
+    $code.=interleave([qr_avx512(@x[0,4,8,12])],[qr_avx512(@x[1,5,9,13])],
+	[qr_avx512(@x[2,6,10,14])],[qr_avx512(@x[3,7,11,15])]);
+    $code.=interleave([qr_avx512(@x[0,5,10,15])],[qr_avx512(@x[1,6,11,12])],
+	[qr_avx512(@x[2,7,8,13])],[qr_avx512(@x[3,4,9,14])]);
+$code.=<<___;
+	dec	%eax
+	jnz	.Lavx512_rounds
+
+___
+    for (my $i=0; $i<16; $i++) {
+	if ($i==12) {
+	    $code.="\tvpaddd	$ctr,$x[$i],$x[$i]\n";
+	} else {
+	    my $t=$t[$i%8];
+	    $code.=<<___;
+	vpbroadcastd	4*$i($key),$t
+	vpaddd	$t,$x[$i],$x[$i]
+___
+	}
+    }
+
+    # Transpose words within each 128-bit lane. Afterwards, for group g
+    # (words 4g..4g+3) and j in 0..3, $grp[g][j] holds those words of
+    # blocks j, j+4, j+8 and j+12.
+    my @grp;
+    for (my $g=0; $g<4; $g++) {
+	my ($a,$b,$c,$d)=@x[4*$g..4*$g+3];
+	my ($u0,$u1)=@t[0,1];
+	$code.=<<___;
+	vpunpckldq	$b,$a,$u0
+	vpunpckhdq	$b,$a,$u1
+	vpunpckldq	$d,$c,$a
+	vpunpckhdq	$d,$c,$b
+	vpunpcklqdq	$a,$u0,$c
+	vpunpckhqdq	$a,$u0,$d
+	vpunpcklqdq	$b,$u1,$a
+	vpunpckhqdq	$b,$u1,$b
+___
+	$grp[$g]=[$c,$d,$a,$b];
+    }
+
+    # Transpose the 128-bit lanes across groups, xor with the input and
+    # store.
+    for (my $j=0; $j<4; $j++) {
+	my @r=map($grp[$_][$j],(0..3));
+	my ($u0,$u1,$u2,$u3)=@t[0..3];
+	$code.=<<___;
+	vshufi32x4	\$0x44,$r[1],$r[0],$u0
+	vshufi32x4	\$0xee,$r[1],$r[0],$u1
+	vshufi32x4	\$0x44,$r[3],$r[2],$u2
+	vshufi32x4	\$0xee,$r[3],$r[2],$u3
+	vshufi32x4	\$0x88,$u2,$u0,$r[0]
+	vshufi32x4	\$0xdd,$u2,$u0,$r[1]
+	vshufi32x4	\$0x88,$u3,$u1,$r[2]
+	vshufi32x4	\$0xdd,$u3,$u1,$r[3]
+___
+	for (my $l=0; $l<4; $l++) {
+	    my $off=64*($j+4*$l);
+	    $code.=<<___;
+	vpxord	$off($inp),$r[$l],$r[$l]
+	vmovdqu32	$r[$l],$off($out)
+___
+	}
+    }
+
+$code.=<<___;
+
+	vpaddd	.Lsixteen(%rip),$ctr,$ctr
+	lea	64*16($inp),$inp
+	lea	64*16($out),$out
+	sub	\$16,$blocks
+	jnz	.Lavx512_loop
+
+	vzeroupper
+	ret
+.size	chacha_blocks_avx512,.-chacha_blocks_avx512
+
+___
+    return $code;
+}
+
+$code=".text\n\n";
+$code.=blocks16("ssse3");
+$code.=blocks16("avx2");
+$code.=blocks_avx512();
+
+$code.=<<___;
+.align	64
+.Lrot16:
+	.byte	2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13
+	.byte	2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13
+.Lrot24:
+	.byte	3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14
+	.byte	3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14
+.Linc:
+	.long	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15
+.Lfour:
+	.long	4,4,4,4
+.align	32
+.Leight:
+	.long	8,8,8,8,8,8,8,8
+.align	64
+.Lsixteen:
+	.long	16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16
+.align	64
+___
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
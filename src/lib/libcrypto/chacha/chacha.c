@@ -21,6 +21,73 @@
 
 #include "chacha-merged.c"
 
+#ifdef CHACHA_ASM
+#include <openssl/crypto.h>
+
+#include "cryptlib.h"
+#include "x86_arch.h"
+
+void chacha_blocks_ssse3(u8 *out, const u8 *in, size_t blocks,
+    const u32 input[16]);
+void chacha_blocks_avx2(u8 *out, const u8 *in, size_t blocks,
+    const u32 input[16]);
+void chacha_blocks_avx512(u8 *out, const u8 *in, size_t blocks,
+    const u32 input[16]);
+
+/*
+ * Process as many whole blocks as possible with the multi-block
+ * implementations and return the number of bytes processed; the
+ * remainder is left to chacha_encrypt_bytes(). The assembly only
+ * increments the low word of the block counter, so calls are split at
+ * 2^32 block boundaries and the carry into input[13] is done here.
+ */
+static size_t
+chacha_encrypt_blocks(chacha_ctx *x, const u8 *m, u8 *c, size_t bytes)
+{
+	uint64_t caps = OPENSSL_cpu_caps();
+	uint32_t ext = OPENSSL_cpu_caps_ext();
+	size_t blocks, n, done = 0;
+	uint64_t wrap;
+
+	if ((caps & CPUCAP_MASK_SSSE3) == 0)
+		return 0;
+
+	while (bytes >= 4 * CHACHA_BLOCKLEN) {
+		blocks = bytes / CHACHA_BLOCKLEN;
+		wrap = (1ULL << 32) - x->input[12];
+		if (wrap < 4) {
+			/* Let the C code handle the counter carry. */
+			n = wrap;
+			chacha_encrypt_bytes(x, m, c, n * CHACHA_BLOCKLEN);
+		} else {
+			if (blocks > wrap)
+				blocks = wrap;
+			if (blocks >= 16 && (ext & IA32CAP_MASK2_AVX512F) != 0) {
+				n = blocks & ~15;
+				chacha_blocks_avx512(c, m, n, x->input);
+			} else if (blocks >= 8 &&
+			    (ext & IA32CAP_MASK2_AVX2) != 0) {
+				n = blocks & ~7;
+				chacha_blocks_avx2(c, m, n, x->input);
+			} else {
+				n = blocks & ~3;
+				chacha_blocks_ssse3(c, m, n, x->input);
+			}
+			x->input[12] += n;
+			if (x->input[12] == 0)
+				x->input[13]++;
+		}
+
+		m += n * CHACHA_BLOCKLEN;
+		c += n * CHACHA_BLOCKLEN;
+		bytes -= n * CHACHA_BLOCKLEN;
+		done += n * CHACHA_BLOCKLEN;
+	}
+
+	return done;
+}
+#endif
+
 void
 ChaCha_set_key(ChaCha_ctx *ctx, const unsigned char *key, uint32_t keybits)
 {
@@ -53,6 +120,13 @@ ChaCha(ChaCha_ctx *ctx, unsigned char *out, const unsigned char *in, size_t len)
 		len -= l;
 	}
 
+#ifdef CHACHA_ASM
+	n = chacha_encrypt_blocks((chacha_ctx *)ctx, in, out, len);
+	in += n;
+	out += n;
+	len -= n;
+#endif
+
 	while (len > 0) {
 		if ((n = len) > UINT32_MAX)
 			n = UINT32_MAX;
@@ -84,6 +158,13 @@ CRYPTO_chacha_20(unsigned char *out, const unsigned char *in, size_t len,
 		ctx.input[13] = (uint32_t)(counter >> 32);
 	}
 
+#ifdef CHACHA_ASM
+	n = chacha_encrypt_blocks(&ctx, in, out, len);
+	in += n;
+	out += n;
+	len -= n;
+#endif
+
 	while (len > 0) {
 		if ((n = len) > UINT32_MAX)
 			n = UINT32_MAX;
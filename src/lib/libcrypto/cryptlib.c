@@ -305,6 +305,7 @@ CRYPTO_THREADID_hash(const CRYPTO_THREADID *id)
 	defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
 
 uint64_t OPENSSL_ia32cap_P;
+uint32_t OPENSSL_ia32cap_ext_P;
 
 uint64_t
 OPENSSL_cpu_caps(void)
@@ -312,6 +313,12 @@ OPENSSL_cpu_caps(void)
 	return OPENSSL_ia32cap_P;
 }
 
+uint32_t
+OPENSSL_cpu_caps_ext(void)
+{
+	return OPENSSL_ia32cap_ext_P;
+}
+
 #if defined(OPENSSL_CPUID_OBJ) && !defined(OPENSSL_NO_ASM)
 #define OPENSSL_CPUID_SETUP
 void
@@ -319,11 +326,15 @@ OPENSSL_cpuid_setup(void)
 {
 	static int trigger = 0;
 	uint64_t OPENSSL_ia32_cpuid(void);
+	uint32_t OPENSSL_ia32_cpuid_ext(void);
 
 	if (trigger)
 		return;
 	trigger = 1;
 	OPENSSL_ia32cap_P = OPENSSL_ia32_cpuid();
+#if defined(__x86_64) || defined(__x86_64__)
+	OPENSSL_ia32cap_ext_P = OPENSSL_ia32_cpuid_ext();
+#endif
 }
 #endif
 
@@ -333,6 +344,12 @@ OPENSSL_cpu_caps(void)
 {
 	return 0;
 }
+
+uint32_t
+OPENSSL_cpu_caps_ext(void)
+{
+	return 0;
+}
 #endif
 
 #if !defined(OPENSSL_CPUID_SETUP) && !defined(OPENSSL_CPUID_OBJ)
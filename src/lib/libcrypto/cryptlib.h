@@ -59,6 +59,8 @@
 #ifndef HEADER_CRYPTLIB_H
 #define HEADER_CRYPTLIB_H
 
+#include <stdint.h>
+
 #include <openssl/opensslconf.h>
 
 #ifdef  __cplusplus
@@ -76,6 +78,7 @@ extern "C" {
 #define CTLOG_FILE_EVP		"CTLOG_FILE"
 
 void OPENSSL_cpuid_setup(void);
+uint32_t OPENSSL_cpu_caps_ext(void);
 
 #ifdef  __cplusplus
 }
@@ -0,0 +1,351 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Field arithmetic modulo 2^255 - 19 for X25519, using the BMI2 MULX and
+# ADX ADCX/ADOX instructions.
+#
+# Field elements are four 64-bit limbs holding a value below 2^256 that
+# is only partially reduced: 2^256 = 38 mod p, so the high half of a
+# product, and any carry out of the top limb, is folded back in with a
+# multiplication by 38. Only x25519_fe64_tobytes() produces the unique
+# representative in [0, p).
+#
+# void x25519_fe64_mul(fe64 h, const fe64 f, const fe64 g);
+# void x25519_fe64_sqr(fe64 h, const fe64 f);
+# void x25519_fe64_mul121666(fe64 h, const fe64 f);
+# void x25519_fe64_add(fe64 h, const fe64 f, const fe64 g);
+# void x25519_fe64_sub(fe64 h, const fe64 f, const fe64 g);
+# void x25519_fe64_tobytes(uint8_t s[32], const fe64 f);
+#
+# The caller must check that the CPU supports BMI2 and ADX before calling
+# the first three functions. The outputs may alias the inputs.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($out,$a,$b)=("%rdi","%rsi","%rcx");
+@acc=map("%r$_",(8..15));
+
+# Reduce the 512-bit value in @acc[0..7] to four limbs in @acc[0..3] and
+# store them to $out. Clobbers %rax, %rbx, %rdx and %rbp.
+sub reduce {
+my ($a0,$a1,$a2,$a3,$a4,$a5,$a6,$a7)=@acc;
+    return <<___;
+	mov	\$38,%edx
+	xor	%ebp,%ebp
+	mulx	$a4,%rax,%rbx
+	adcx	%rax,$a0
+	adox	%rbx,$a1
+	mulx	$a5,%rax,%rbx
+	adcx	%rax,$a1
+	adox	%rbx,$a2
+	mulx	$a6,%rax,%rbx
+	adcx	%rax,$a2
+	adox	%rbx,$a3
+	mulx	$a7,%rax,$a4
+	adcx	%rax,$a3
+	adox	%rbp,$a4
+	adcx	%rbp,$a4
+
+	imul	\$38,$a4,%rax
+	add	%rax,$a0
+	adc	\$0,$a1
+	adc	\$0,$a2
+	adc	\$0,$a3
+	sbb	%rax,%rax		# carry implies $a0 < 38 * 39
+	and	\$38,%eax
+	add	%rax,$a0
+
+	mov	$a0,0($out)
+	mov	$a1,8($out)
+	mov	$a2,16($out)
+	mov	$a3,24($out)
+___
+}
+
+my $push=<<___;
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+___
+my $pop=<<___;
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+___
+
+$code.=<<___;
+.text
+
+.globl	x25519_fe64_mul
+.type	x25519_fe64_mul,\@function,3
+.align	32
+x25519_fe64_mul:
+$push
+	mov	%rdx,$b
+
+	mov	0($b),%rdx		# f * g[0]
+	mulx	0($a),@acc[0],%rax
+	mulx	8($a),@acc[1],%rbx
+	add	%rax,@acc[1]
+	mulx	16($a),@acc[2],%rax
+	adc	%rbx,@acc[2]
+	mulx	24($a),@acc[3],@acc[4]
+	adc	%rax,@acc[3]
+	adc	\$0,@acc[4]
+___
+for (my $i=1; $i<4; $i++) {
+$code.=<<___;
+
+	mov	8*$i($b),%rdx		# f * g[$i]
+	xor	%ebp,%ebp
+	mulx	0($a),%rax,%rbx
+	adcx	%rax,@acc[$i+0]
+	adox	%rbx,@acc[$i+1]
+	mulx	8($a),%rax,%rbx
+	adcx	%rax,@acc[$i+1]
+	adox	%rbx,@acc[$i+2]
+	mulx	16($a),%rax,%rbx
+	adcx	%rax,@acc[$i+2]
+	adox	%rbx,@acc[$i+3]
+	mulx	24($a),%rax,@acc[$i+4]
+	adcx	%rax,@acc[$i+3]
+	adox	%rbp,@acc[$i+4]
+	adcx	%rbp,@acc[$i+4]
+___
+}
+$code.=<<___;
+
+___
+$code.=reduce();
+$code.=<<___;
+$pop
+	ret
+.size	x25519_fe64_mul,.-x25519_fe64_mul
+
+.globl	x25519_fe64_sqr
+.type	x25519_fe64_sqr,\@function,2
+.align	32
+x25519_fe64_sqr:
+$push
+	mov	0($a),%rdx		# off-diagonal products
+	mulx	8($a),@acc[1],@acc[2]
+	mulx	16($a),%rax,@acc[3]
+	add	%rax,@acc[2]
+	mulx	24($a),%rax,@acc[4]
+	adc	%rax,@acc[3]
+	adc	\$0,@acc[4]
+
+	mov	8($a),%rdx
+	xor	%ebp,%ebp
+	mulx	16($a),%rax,%rbx
+	adcx	%rax,@acc[3]
+	adox	%rbx,@acc[4]
+	mulx	24($a),%rax,@acc[5]
+	adcx	%rax,@acc[4]
+	adox	%rbp,@acc[5]
+	adcx	%rbp,@acc[5]
+
+	mov	16($a),%rdx
+	mulx	24($a),%rax,@acc[6]
+	add	%rax,@acc[5]
+	adc	\$0,@acc[6]
+
+	xor	@acc[7]d,@acc[7]d	# double them
+	add	@acc[1],@acc[1]
+	adc	@acc[2],@acc[2]
+	adc	@acc[3],@acc[3]
+	adc	@acc[4],@acc[4]
+	adc	@acc[5],@acc[5]
+	adc	@acc[6],@acc[6]
+	adc	@acc[7],@acc[7]
+
+	mov	0($a),%rdx		# add the squares
+	mulx	%rdx,@acc[0],%rax
+	mov	8($a),%rdx
+	mulx	%rdx,%rbx,%rcx
+	add	%rax,@acc[1]
+	adc	%rbx,@acc[2]
+	adc	%rcx,@acc[3]
+	mov	16($a),%rdx
+	mulx	%rdx,%rax,%rbx
+	adc	%rax,@acc[4]
+	adc	%rbx,@acc[5]
+	mov	24($a),%rdx
+	mulx	%rdx,%rax,%rbx
+	adc	%rax,@acc[6]
+	adc	%rbx,@acc[7]
+
+___
+$code.=reduce();
+$code.=<<___;
+$pop
+	ret
+.size	x25519_fe64_sqr,.-x25519_fe64_sqr
+
+.globl	x25519_fe64_mul121666
+.type	x25519_fe64_mul121666,\@function,2
+.align	32
+x25519_fe64_mul121666:
+	mov	\$121666,%edx
+	mulx	0($a),%r8,%rax
+	mulx	8($a),%r9,%rcx
+	add	%rax,%r9
+	mulx	16($a),%r10,%rax
+	adc	%rcx,%r10
+	mulx	24($a),%r11,%rcx
+	adc	%rax,%r11
+	adc	\$0,%rcx
+
+	imul	\$38,%rcx,%rax
+	add	%rax,%r8
+	adc	\$0,%r9
+	adc	\$0,%r10
+	adc	\$0,%r11
+	sbb	%rax,%rax
+	and	\$38,%eax
+	add	%rax,%r8
+
+	mov	%r8,0($out)
+	mov	%r9,8($out)
+	mov	%r10,16($out)
+	mov	%r11,24($out)
+	ret
+.size	x25519_fe64_mul121666,.-x25519_fe64_mul121666
+
+.globl	x25519_fe64_add
+.type	x25519_fe64_add,\@function,3
+.align	32
+x25519_fe64_add:
+	mov	0($a),%r8
+	add	0(%rdx),%r8
+	mov	8($a),%r9
+	adc	8(%rdx),%r9
+	mov	16($a),%r10
+	adc	16(%rdx),%r10
+	mov	24($a),%r11
+	adc	24(%rdx),%r11
+
+	sbb	%rax,%rax		# fold the carry, 2^256 = 38
+	and	\$38,%eax
+	add	%rax,%r8
+	adc	\$0,%r9
+	adc	\$0,%r10
+	adc	\$0,%r11
+	sbb	%rax,%rax		# carry implies %r8 < 38
+	and	\$38,%eax
+	add	%rax,%r8
+
+	mov	%r8,0($out)
+	mov	%r9,8($out)
+	mov	%r10,16($out)
+	mov	%r11,24($out)
+	ret
+.size	x25519_fe64_add,.-x25519_fe64_add
+
+.globl	x25519_fe64_sub
+.type	x25519_fe64_sub,\@function,3
+.align	32
+x25519_fe64_sub:
+	mov	0($a),%r8
+	sub	0(%rdx),%r8
+	mov	8($a),%r9
+	sbb	8(%rdx),%r9
+	mov	16($a),%r10
+	sbb	16(%rdx),%r10
+	mov	24($a),%r11
+	sbb	24(%rdx),%r11
+
+	sbb	%rax,%rax		# fold the borrow, 2^256 = 38
+	and	\$38,%eax
+	sub	%rax,%r8
+	sbb	\$0,%r9
+	sbb	\$0,%r10
+	sbb	\$0,%r11
+	sbb	%rax,%rax		# borrow implies %r8 > 2^64 - 38
+	and	\$38,%eax
+	sub	%rax,%r8
+
+	mov	%r8,0($out)
+	mov	%r9,8($out)
+	mov	%r10,16($out)
+	mov	%r11,24($out)
+	ret
+.size	x25519_fe64_sub,.-x25519_fe64_sub
+
+.globl	x25519_fe64_tobytes
+.type	x25519_fe64_tobytes,\@function,2
+.align	32
+x25519_fe64_tobytes:
+	mov	0($a),%r8
+	mov	8($a),%r9
+	mov	16($a),%r10
+	mov	24($a),%r11
+
+	mov	%r11,%rax		# fold bit 255, 2^255 = 19
+	shr	\$63,%rax
+	btr	\$63,%r11
+	imul	\$19,%rax,%rax
+	add	%rax,%r8
+	adc	\$0,%r9
+	adc	\$0,%r10
+	adc	\$0,%r11
+
+	mov	%r8,%rax		# subtract p if the value is at least p,
+	add	\$19,%rax		# that is, if bit 255 of value + 19 is set
+	mov	%r9,%rcx
+	adc	\$0,%rcx
+	mov	%r10,%rdx
+	adc	\$0,%rdx
+	mov	%r11,%rsi
+	adc	\$0,%rsi
+	btr	\$63,%rsi
+	cmovc	%rax,%r8
+	cmovc	%rcx,%r9
+	cmovc	%rdx,%r10
+	cmovc	%rsi,%r11
+
+	mov	%r8,0($out)
+	mov	%r9,8($out)
+	mov	%r10,16($out)
+	mov	%r11,24($out)
+	ret
+.size	x25519_fe64_tobytes,.-x25519_fe64_tobytes
+___
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
@@ -0,0 +1,453 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * X25519 for 64-bit targets.
+ *
+ * x25519_scalar_mult_fe51() represents field elements as five 51-bit limbs
+ * and needs a 128-bit integer type for the products. On amd64,
+ * x25519_scalar_mult_fe64() uses four 64-bit limbs and the MULX/ADX field
+ * arithmetic in x25519-x86_64.pl. Both use the same Montgomery ladder as
+ * x25519_scalar_mult_generic() and are constant time.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "curve25519_internal.h"
+
+#ifdef X25519_FE51
+
+typedef __uint128_t u128;
+
+/*
+ * fe51 means field element with radix 2^51: t represents the integer
+ * t[0] + 2^51 t[1] + 2^102 t[2] + 2^153 t[3] + 2^204 t[4]. The limbs of
+ * the outputs of fe51_mul(), fe51_sq() and fe51_mul121666() are below
+ * 2^52; all functions accept limbs of up to 2^54.
+ */
+typedef uint64_t fe51[5];
+
+#define MASK51	0x7ffffffffffffULL
+
+static uint64_t
+load_8(const uint8_t *in)
+{
+	uint64_t result;
+	int i;
+
+	result = 0;
+	for (i = 7; i >= 0; i--)
+		result = result << 8 | in[i];
+	return result;
+}
+
+static void
+store_8(uint8_t *out, uint64_t in)
+{
+	int i;
+
+	for (i = 0; i < 8; i++)
+		out[i] = in >> (8 * i);
+}
+
+/* Ignores the top bit of s, as required by RFC 7748. */
+static void
+fe51_frombytes(fe51 h, const uint8_t s[32])
+{
+	uint64_t w0, w1, w2, w3;
+
+	w0 = load_8(s);
+	w1 = load_8(s + 8);
+	w2 = load_8(s + 16);
+	w3 = load_8(s + 24) & 0x7fffffffffffffffULL;
+
+	h[0] = w0 & MASK51;
+	h[1] = (w0 >> 51 | w1 << 13) & MASK51;
+	h[2] = (w1 >> 38 | w2 << 26) & MASK51;
+	h[3] = (w2 >> 25 | w3 << 39) & MASK51;
+	h[4] = w3 >> 12;
+}
+
+static void
+fe51_tobytes(uint8_t s[32], const fe51 f)
+{
+	uint64_t h0 = f[0], h1 = f[1], h2 = f[2], h3 = f[3], h4 = f[4];
+	uint64_t q;
+
+	/* Carry, so that each limb is below 2^51 and h < 2^255 + 19 * 8. */
+	h1 += h0 >> 51; h0 &= MASK51;
+	h2 += h1 >> 51; h1 &= MASK51;
+	h3 += h2 >> 51; h2 &= MASK51;
+	h4 += h3 >> 51; h3 &= MASK51;
+	h0 += 19 * (h4 >> 51); h4 &= MASK51;
+	h1 += h0 >> 51; h0 &= MASK51;
+
+	/* q = 1 if h >= p, that is, if h + 19 >= 2^255. */
+	q = (h0 + 19) >> 51;
+	q = (h1 + q) >> 51;
+	q = (h2 + q) >> 51;
+	q = (h3 + q) >> 51;
+	q = (h4 + q) >> 51;
+
+	/* h - q * p = h + 19 * q - 2^255 * q. */
+	h0 += 19 * q;
+	h1 += h0 >> 51; h0 &= MASK51;
+	h2 += h1 >> 51; h1 &= MASK51;
+	h3 += h2 >> 51; h2 &= MASK51;
+	h4 += h3 >> 51; h3 &= MASK51;
+	h4 &= MASK51;
+
+	store_8(s, h0 | h1 << 51);
+	store_8(s + 8, h1 >> 13 | h2 << 38);
+	store_8(s + 16, h2 >> 26 | h3 << 25);
+	store_8(s + 24, h3 >> 39 | h4 << 12);
+}
+
+static void
+fe51_copy(fe51 h, const fe51 f)
+{
+	memcpy(h, f, sizeof(fe51));
+}
+
+static void
+fe51_0(fe51 h)
+{
+	memset(h, 0, sizeof(fe51));
+}
+
+static void
+fe51_1(fe51 h)
+{
+	memset(h, 0, sizeof(fe51));
+	h[0] = 1;
+}
+
+static void
+fe51_add(fe51 h, const fe51 f, const fe51 g)
+{
+	int i;
+
+	for (i = 0; i < 5; i++)
+		h[i] = f[i] + g[i];
+}
+
+/* h = f + 4p - g, which requires the limbs of g to be below 2^53. */
+static void
+fe51_sub(fe51 h, const fe51 f, const fe51 g)
+{
+	h[0] = f[0] + 0x1fffffffffffb4ULL - g[0];
+	h[1] = f[1] + 0x1ffffffffffffcULL - g[1];
+	h[2] = f[2] + 0x1ffffffffffffcULL - g[2];
+	h[3] = f[3] + 0x1ffffffffffffcULL - g[3];
+	h[4] = f[4] + 0x1ffffffffffffcULL - g[4];
+}
+
+static void
+fe51_carry(fe51 h, u128 r0, u128 r1, u128 r2, u128 r3, u128 r4)
+{
+	r1 += (uint64_t)(r0 >> 51);
+	r2 += (uint64_t)(r1 >> 51);
+	r3 += (uint64_t)(r2 >> 51);
+	r4 += (uint64_t)(r3 >> 51);
+	r0 = ((uint64_t)r0 & MASK51) + (u128)(uint64_t)(r4 >> 51) * 19;
+	r1 = ((uint64_t)r1 & MASK51) + (uint64_t)(r0 >> 51);
+
+	h[0] = (uint64_t)r0 & MASK51;
+	h[1] = (uint64_t)r1;
+	h[2] = (uint64_t)r2 & MASK51;
+	h[3] = (uint64_t)r3 & MASK51;
+	h[4] = (uint64_t)r4 & MASK51;
+}
+
+static void
+fe51_mul(fe51 h, const fe51 f, const fe51 g)
+{
+	uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+	uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2;
+	uint64_t g3_19 = 19 * g3, g4_19 = 19 * g4;
+	u128 r0, r1, r2, r3, r4;
+
+	r0 = (u128)f0 * g0 + (u128)f1 * g4_19 + (u128)f2 * g3_19 +
+	    (u128)f3 * g2_19 + (u128)f4 * g1_19;
+	r1 = (u128)f0 * g1 + (u128)f1 * g0 + (u128)f2 * g4_19 +
+	    (u128)f3 * g3_19 + (u128)f4 * g2_19;
+	r2 = (u128)f0 * g2 + (u128)f1 * g1 + (u128)f2 * g0 +
+	    (u128)f3 * g4_19 + (u128)f4 * g3_19;
+	r3 = (u128)f0 * g3 + (u128)f1 * g2 + (u128)f2 * g1 +
+	    (u128)f3 * g0 + (u128)f4 * g4_19;
+	r4 = (u128)f0 * g4 + (u128)f1 * g3 + (u128)f2 * g2 +
+	    (u128)f3 * g1 + (u128)f4 * g0;
+
+	fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+static void
+fe51_sq(fe51 h, const fe51 f)
+{
+	uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+	uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+	uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+	u128 r0, r1, r2, r3, r4;
+
+	r0 = (u128)f0 * f0 + (u128)f1_2 * f4_19 + (u128)(2 * f2) * f3_19;
+	r1 = (u128)f0_2 * f1 + (u128)(2 * f2) * f4_19 + (u128)f3 * f3_19;
+	r2 = (u128)f0_2 * f2 + (u128)f1 * f1 + (u128)(2 * f3) * f4_19;
+	r3 = (u128)f0_2 * f3 + (u128)f1_2 * f2 + (u128)f4 * f4_19;
+	r4 = (u128)f0_2 * f4 + (u128)f1_2 * f3 + (u128)f2 * f2;
+
+	fe51_carry(h, r0, r1, r2, r3, r4);
+}
+
+static void
+fe51_sq_n(fe51 h, const fe51 f, int n)
+{
+	fe51_sq(h, f);
+	while (--n > 0)
+		fe51_sq(h, h);
+}
+
+static void
+fe51_mul121666(fe51 h, const fe51 f)
+{
+	fe51_carry(h, (u128)f[0] * 121666, (u128)f[1] * 121666,
+	    (u128)f[2] * 121666, (u128)f[3] * 121666, (u128)f[4] * 121666);
+}
+
+/* Swap f and g if b == 1, leave them alone if b == 0. */
+static void
+fe51_cswap(fe51 f, fe51 g, unsigned int b)
+{
+	uint64_t mask = 0 - (uint64_t)b, x;
+	int i;
+
+	for (i = 0; i < 5; i++) {
+		x = mask & (f[i] ^ g[i]);
+		f[i] ^= x;
+		g[i] ^= x;
+	}
+}
+
+/* out = z^(p - 2) = z^(2^255 - 21) */
+static void
+fe51_invert(fe51 out, const fe51 z)
+{
+	fe51 z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t;
+
+	fe51_sq(z2, z);
+	fe51_sq_n(t, z2, 2);
+	fe51_mul(z9, t, z);
+	fe51_mul(z11, z9, z2);
+	fe51_sq(t, z11);
+	fe51_mul(z2_5_0, t, z9);
+	fe51_sq_n(t, z2_5_0, 5);
+	fe51_mul(z2_10_0, t, z2_5_0);
+	fe51_sq_n(t, z2_10_0, 10);
+	fe51_mul(z2_20_0, t, z2_10_0);
+	fe51_sq_n(t, z2_20_0, 20);
+	fe51_mul(t, t, z2_20_0);
+	fe51_sq_n(t, t, 10);
+	fe51_mul(z2_50_0, t, z2_10_0);
+	fe51_sq_n(t, z2_50_0, 50);
+	fe51_mul(z2_100_0, t, z2_50_0);
+	fe51_sq_n(t, z2_100_0, 100);
+	fe51_mul(t, t, z2_100_0);
+	fe51_sq_n(t, t, 50);
+	fe51_mul(t, t, z2_50_0);
+	fe51_sq_n(t, t, 5);
+	fe51_mul(out, t, z11);
+}
+
+void
+x25519_scalar_mult_fe51(uint8_t out[32], const uint8_t scalar[32],
+    const uint8_t point[32])
+{
+	fe51 x1, x2, z2, x3, z3, tmp0, tmp1;
+	uint8_t e[32];
+	unsigned int swap, b;
+	int pos;
+
+	memcpy(e, scalar, 32);
+	e[0] &= 248;
+	e[31] &= 127;
+	e[31] |= 64;
+	fe51_frombytes(x1, point);
+	fe51_1(x2);
+	fe51_0(z2);
+	fe51_copy(x3, x1);
+	fe51_1(z3);
+
+	swap = 0;
+	for (pos = 254; pos >= 0; --pos) {
+		b = 1 & (e[pos / 8] >> (pos & 7));
+		swap ^= b;
+		fe51_cswap(x2, x3, swap);
+		fe51_cswap(z2, z3, swap);
+		swap = b;
+		fe51_sub(tmp0, x3, z3);
+		fe51_sub(tmp1, x2, z2);
+		fe51_add(x2, x2, z2);
+		fe51_add(z2, x3, z3);
+		fe51_mul(z3, tmp0, x2);
+		fe51_mul(z2, z2, tmp1);
+		fe51_sq(tmp0, tmp1);
+		fe51_sq(tmp1, x2);
+		fe51_add(x3, z3, z2);
+		fe51_sub(z2, z3, z2);
+		fe51_mul(x2, tmp1, tmp0);
+		fe51_sub(tmp1, tmp1, tmp0);
+		fe51_sq(z2, z2);
+		fe51_mul121666(z3, tmp1);
+		fe51_sq(x3, x3);
+		fe51_add(tmp0, tmp0, z3);
+		fe51_mul(z3, x1, z2);
+		fe51_mul(z2, tmp1, tmp0);
+	}
+	fe51_cswap(x2, x3, swap);
+	fe51_cswap(z2, z3, swap);
+
+	fe51_invert(z2, z2);
+	fe51_mul(x2, x2, z2);
+	fe51_tobytes(out, x2);
+
+	explicit_bzero(e, sizeof(e));
+}
+
+#ifdef X25519_ASM
+/*
+ * fe64 means field element with four 64-bit limbs, holding any value
+ * below 2^256; see x25519-x86_64.pl.
+ */
+typedef uint64_t fe64[4];
+
+void x25519_fe64_mul(fe64 h, const fe64 f, const fe64 g);
+void x25519_fe64_sqr(fe64 h, const fe64 f);
+void x25519_fe64_mul121666(fe64 h, const fe64 f);
+void x25519_fe64_add(fe64 h, const fe64 f, const fe64 g);
+void x25519_fe64_sub(fe64 h, const fe64 f, const fe64 g);
+void x25519_fe64_tobytes(uint8_t s[32], const fe64 f);
+
+static void
+fe64_sqr_n(fe64 h, const fe64 f, int n)
+{
+	x25519_fe64_sqr(h, f);
+	while (--n > 0)
+		x25519_fe64_sqr(h, h);
+}
+
+static void
+fe64_cswap(fe64 f, fe64 g, unsigned int b)
+{
+	uint64_t mask = 0 - (uint64_t)b, x;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		x = mask & (f[i] ^ g[i]);
+		f[i] ^= x;
+		g[i] ^= x;
+	}
+}
+
+static void
+fe64_invert(fe64 out, const fe64 z)
+{
+	fe64 z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t;
+
+	x25519_fe64_sqr(z2, z);
+	fe64_sqr_n(t, z2, 2);
+	x25519_fe64_mul(z9, t, z);
+	x25519_fe64_mul(z11, z9, z2);
+	x25519_fe64_sqr(t, z11);
+	x25519_fe64_mul(z2_5_0, t, z9);
+	fe64_sqr_n(t, z2_5_0, 5);
+	x25519_fe64_mul(z2_10_0, t, z2_5_0);
+	fe64_sqr_n(t, z2_10_0, 10);
+	x25519_fe64_mul(z2_20_0, t, z2_10_0);
+	fe64_sqr_n(t, z2_20_0, 20);
+	x25519_fe64_mul(t, t, z2_20_0);
+	fe64_sqr_n(t, t, 10);
+	x25519_fe64_mul(z2_50_0, t, z2_10_0);
+	fe64_sqr_n(t, z2_50_0, 50);
+	x25519_fe64_mul(z2_100_0, t, z2_50_0);
+	fe64_sqr_n(t, z2_100_0, 100);
+	x25519_fe64_mul(t, t, z2_100_0);
+	fe64_sqr_n(t, t, 50);
+	x25519_fe64_mul(t, t, z2_50_0);
+	fe64_sqr_n(t, t, 5);
+	x25519_fe64_mul(out, t, z11);
+}
+
+void
+x25519_scalar_mult_fe64(uint8_t out[32], const uint8_t scalar[32],
+    const uint8_t point[32])
+{
+	fe64 x1, x2, z2, x3, z3, tmp0, tmp1;
+	uint8_t e[32];
+	unsigned int swap, b;
+	int pos;
+
+	memcpy(e, scalar, 32);
+	e[0] &= 248;
+	e[31] &= 127;
+	e[31] |= 64;
+	x1[0] = load_8(point);
+	x1[1] = load_8(point + 8);
+	x1[2] = load_8(point + 16);
+	x1[3] = load_8(point + 24) & 0x7fffffffffffffffULL;
+	memset(x2, 0, sizeof(x2));
+	x2[0] = 1;
+	memset(z2, 0, sizeof(z2));
+	memcpy(x3, x1, sizeof(x3));
+	memcpy(z3, x2, sizeof(z3));
+
+	swap = 0;
+	for (pos = 254; pos >= 0; --pos) {
+		b = 1 & (e[pos / 8] >> (pos & 7));
+		swap ^= b;
+		fe64_cswap(x2, x3, swap);
+		fe64_cswap(z2, z3, swap);
+		swap = b;
+		x25519_fe64_sub(tmp0, x3, z3);
+		x25519_fe64_sub(tmp1, x2, z2);
+		x25519_fe64_add(x2, x2, z2);
+		x25519_fe64_add(z2, x3, z3);
+		x25519_fe64_mul(z3, tmp0, x2);
+		x25519_fe64_mul(z2, z2, tmp1);
+		x25519_fe64_sqr(tmp0, tmp1);
+		x25519_fe64_sqr(tmp1, x2);
+		x25519_fe64_add(x3, z3, z2);
+		x25519_fe64_sub(z2, z3, z2);
+		x25519_fe64_mul(x2, tmp1, tmp0);
+		x25519_fe64_sub(tmp1, tmp1, tmp0);
+		x25519_fe64_sqr(z2, z2);
+		x25519_fe64_mul121666(z3, tmp1);
+		x25519_fe64_sqr(x3, x3);
+		x25519_fe64_add(tmp0, tmp0, z3);
+		x25519_fe64_mul(z3, x1, z2);
+		x25519_fe64_mul(z2, tmp1, tmp0);
+	}
+	fe64_cswap(x2, x3, swap);
+	fe64_cswap(z2, z3, swap);
+
+	fe64_invert(z2, z2);
+	x25519_fe64_mul(x2, x2, z2);
+	x25519_fe64_tobytes(out, x2);
+
+	explicit_bzero(e, sizeof(e));
+}
+#endif /* X25519_ASM */
+
+#endif /* X25519_FE51 */
@@ -26,9 +26,26 @@
 
 #include "curve25519_internal.h"
 
+#ifdef X25519_ASM
+#include "cryptlib.h"
+#include "x86_arch.h"
+#endif
+
 void
 x25519_scalar_mult(uint8_t out[32], const uint8_t scalar[32],
     const uint8_t point[32])
 {
+#ifdef X25519_ASM
+	const uint32_t mulx_adx = IA32CAP_MASK2_BMI2 | IA32CAP_MASK2_ADX;
+
+	if ((OPENSSL_cpu_caps_ext() & mulx_adx) == mulx_adx) {
+		x25519_scalar_mult_fe64(out, scalar, point);
+		return;
+	}
+#endif
+#ifdef X25519_FE51
+	x25519_scalar_mult_fe51(out, scalar, point);
+#else
 	x25519_scalar_mult_generic(out, scalar, point);
+#endif
 }
@@ -28,10 +28,7 @@
 #include <string.h>
 
 #include <openssl/curve25519.h>
-
-#ifdef ED25519
 #include <openssl/sha.h>
-#endif
 
 #include "curve25519_internal.h"
 
@@ -979,7 +976,6 @@ void x25519_ge_tobytes(uint8_t *s, const ge_p2 *h) {
   s[31] ^= fe_isnegative(x) << 7;
 }
 
-#ifdef ED25519
 static void ge_p3_tobytes(uint8_t *s, const ge_p3 *h) {
   fe recip;
   fe x;
@@ -991,7 +987,6 @@ static void ge_p3_tobytes(uint8_t *s, const ge_p3 *h) {
   fe_tobytes(s, y);
   s[31] ^= fe_isnegative(x) << 7;
 }
-#endif
 
 static const fe d = {-10913610, 13857413, -15372611, 6949391,   114729,
                      -8787816,  -6275908, -3247719,  -18696448, -12055116};
@@ -1146,7 +1141,6 @@ static void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
   fe_sub(r->T, t0, r->T);
 }
 
-#ifdef ED25519
 /* r = p - q */
 static void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
   fe t0;
@@ -1162,7 +1156,6 @@ static void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q) {
   fe_sub(r->Z, t0, r->T);
   fe_add(r->T, t0, r->T);
 }
-#endif
 
 /* r = p + q */
 void x25519_ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q) {
@@ -3624,7 +3617,6 @@ void x25519_ge_scalarmult(ge_p2 *r, const uint8_t *scalar, const ge_p3 *A) {
   }
 }
 
-#ifdef ED25519
 static void slide(signed char *r, const uint8_t *a) {
   int i;
   int b;
@@ -3659,6 +3651,23 @@ static void slide(signed char *r, const uint8_t *a) {
   }
 }
 
+/* Ai[i] = (2 * i + 1) * A, for use with the digits produced by slide(). */
+static void ge_precompute_odd_multiples(ge_cached Ai[8], const ge_p3 *A) {
+  ge_p1p1 t;
+  ge_p3 u;
+  ge_p3 A2;
+  int i;
+
+  x25519_ge_p3_to_cached(&Ai[0], A);
+  ge_p3_dbl(&t, A);
+  x25519_ge_p1p1_to_p3(&A2, &t);
+  for (i = 1; i < 8; i++) {
+    x25519_ge_add(&t, &A2, &Ai[i - 1]);
+    x25519_ge_p1p1_to_p3(&u, &t);
+    x25519_ge_p3_to_cached(&Ai[i], &u);
+  }
+}
+
 static const ge_precomp Bi[8] = {
     {
         {25967493, -14356035, 29566456, 3660896, -12694345, 4014787, 27544626,
@@ -3729,46 +3738,20 @@ static const ge_precomp Bi[8] = {
 /* r = a * A + b * B
  * where a = a[0]+256*a[1]+...+256^31 a[31].
  * and b = b[0]+256*b[1]+...+256^31 b[31].
- * B is the Ed25519 base point (x,4/5) with x positive. */
+ * B is the Ed25519 base point (x,4/5) with x positive.
+ * Ai holds A,3A,5A,7A,9A,11A,13A,15A, see ge_precompute_odd_multiples. */
 static void
 ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
-    const ge_p3 *A, const uint8_t *b) {
+    const ge_cached Ai[8], const uint8_t *b) {
   signed char aslide[256];
   signed char bslide[256];
-  ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
   ge_p1p1 t;
   ge_p3 u;
-  ge_p3 A2;
   int i;
 
   slide(aslide, a);
   slide(bslide, b);
 
-  x25519_ge_p3_to_cached(&Ai[0], A);
-  ge_p3_dbl(&t, A);
-  x25519_ge_p1p1_to_p3(&A2, &t);
-  x25519_ge_add(&t, &A2, &Ai[0]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[1], &u);
-  x25519_ge_add(&t, &A2, &Ai[1]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[2], &u);
-  x25519_ge_add(&t, &A2, &Ai[2]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[3], &u);
-  x25519_ge_add(&t, &A2, &Ai[3]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[4], &u);
-  x25519_ge_add(&t, &A2, &Ai[4]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[5], &u);
-  x25519_ge_add(&t, &A2, &Ai[5]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[6], &u);
-  x25519_ge_add(&t, &A2, &Ai[6]);
-  x25519_ge_p1p1_to_p3(&u, &t);
-  x25519_ge_p3_to_cached(&Ai[7], &u);
-
   ge_p2_0(r);
 
   for (i = 255; i >= 0; --i) {
@@ -3799,7 +3782,6 @@ ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
     x25519_ge_p1p1_to_p2(r, &t);
   }
 }
-#endif
 
 /* The set of scalars is \Z/l
  * where l = 2^252 + 27742317777372353535851937790883648493. */
@@ -4145,7 +4127,6 @@ x25519_sc_reduce(uint8_t *s) {
   s[31] = s11 >> 17;
 }
 
-#ifdef ED25519
 /* Input:
  *   a[0]+256*a[1]+...+256^31*a[31] = a
  *   b[0]+256*b[1]+...+256^31*b[31] = b
@@ -4636,9 +4617,7 @@ sc_muladd(uint8_t *s, const uint8_t *a, const uint8_t *b,
   s[30] = s11 >> 9;
   s[31] = s11 >> 17;
 }
-#endif
 
-#ifdef ED25519
 void ED25519_keypair(uint8_t out_public_key[32], uint8_t out_private_key[64]) {
   uint8_t seed[32];
   arc4random_buf(seed, 32);
@@ -4658,15 +4637,28 @@ void ED25519_keypair(uint8_t out_public_key[32], uint8_t out_private_key[64]) {
   memmove(out_private_key + 32, out_public_key, 32);
 }
 
-int ED25519_sign(uint8_t *out_sig, const uint8_t *message, size_t message_len,
-                 const uint8_t private_key[64]) {
+struct ed25519_expanded_key_st {
+  /* The clamped secret scalar and the nonce prefix, SHA-512 of the seed. */
   uint8_t az[SHA512_DIGEST_LENGTH];
-  SHA512(private_key, 32, az);
+  uint8_t public_key[32];
+  /* Odd multiples of -A, for ge_double_scalarmult_vartime. */
+  ge_cached neg_Ai[8];
+  int has_private;
+};
+
+static void ed25519_expand_seed(uint8_t az[SHA512_DIGEST_LENGTH],
+                                const uint8_t seed[32]) {
+  SHA512(seed, 32, az);
 
   az[0] &= 248;
   az[31] &= 63;
   az[31] |= 64;
+}
 
+static void ed25519_sign_expanded(uint8_t *out_sig, const uint8_t *message,
+                                  size_t message_len,
+                                  const uint8_t az[SHA512_DIGEST_LENGTH],
+                                  const uint8_t public_key[32]) {
   SHA512_CTX hash_ctx;
   SHA512_Init(&hash_ctx);
   SHA512_Update(&hash_ctx, az + 32, 32);
@@ -4681,7 +4673,7 @@ int ED25519_sign(uint8_t *out_sig, const uint8_t *message, size_t message_len,
 
   SHA512_Init(&hash_ctx);
   SHA512_Update(&hash_ctx, out_sig, 32);
-  SHA512_Update(&hash_ctx, private_key + 32, 32);
+  SHA512_Update(&hash_ctx, public_key, 32);
   SHA512_Update(&hash_ctx, message, message_len);
   uint8_t hram[SHA512_DIGEST_LENGTH];
   SHA512_Final(hram, &hash_ctx);
@@ -4689,22 +4681,32 @@ int ED25519_sign(uint8_t *out_sig, const uint8_t *message, size_t message_len,
   x25519_sc_reduce(hram);
   sc_muladd(out_sig + 32, hram, az, nonce);
 
-  return 1;
+  explicit_bzero(nonce, sizeof(nonce));
 }
 
-int ED25519_verify(const uint8_t *message, size_t message_len,
-                   const uint8_t signature[64], const uint8_t public_key[32]) {
+/* Decodes public_key and stores the odd multiples of its negation. */
+static int ed25519_public_key_precompute(ge_cached neg_Ai[8],
+                                         const uint8_t public_key[32]) {
   ge_p3 A;
-  if ((signature[63] & 224) != 0 ||
-      x25519_ge_frombytes_vartime(&A, public_key) != 0) {
+  if (x25519_ge_frombytes_vartime(&A, public_key) != 0) {
     return 0;
   }
 
   fe_neg(A.X, A.X);
   fe_neg(A.T, A.T);
 
-  uint8_t pkcopy[32];
-  memcpy(pkcopy, public_key, 32);
+  ge_precompute_odd_multiples(neg_Ai, &A);
+  return 1;
+}
+
+static int ed25519_verify_expanded(const uint8_t *message, size_t message_len,
+                                   const uint8_t signature[64],
+                                   const uint8_t public_key[32],
+                                   const ge_cached neg_Ai[8]) {
+  if ((signature[63] & 224) != 0) {
+    return 0;
+  }
+
   uint8_t rcopy[32];
   memcpy(rcopy, signature, 32);
   uint8_t scopy[32];
@@ -4721,14 +4723,290 @@ int ED25519_verify(const uint8_t *message, size_t message_len,
   x25519_sc_reduce(h);
 
   ge_p2 R;
-  ge_double_scalarmult_vartime(&R, h, &A, scopy);
+  ge_double_scalarmult_vartime(&R, h, neg_Ai, scopy);
 
   uint8_t rcheck[32];
   x25519_ge_tobytes(rcheck, &R);
 
   return timingsafe_memcmp(rcheck, rcopy, sizeof(rcheck)) == 0;
 }
-#endif
+
+int ED25519_sign(uint8_t *out_sig, const uint8_t *message, size_t message_len,
+                 const uint8_t private_key[64]) {
+  uint8_t az[SHA512_DIGEST_LENGTH];
+
+  ed25519_expand_seed(az, private_key);
+  ed25519_sign_expanded(out_sig, message, message_len, az, private_key + 32);
+
+  explicit_bzero(az, sizeof(az));
+
+  return 1;
+}
+
+int ED25519_verify(const uint8_t *message, size_t message_len,
+                   const uint8_t signature[64], const uint8_t public_key[32]) {
+  ge_cached neg_Ai[8];
+
+  if ((signature[63] & 224) != 0 ||
+      !ed25519_public_key_precompute(neg_Ai, public_key)) {
+    return 0;
+  }
+
+  return ed25519_verify_expanded(message, message_len, signature, public_key,
+                                 neg_Ai);
+}
+
+ED25519_EXPANDED_KEY *ED25519_expanded_key_from_private(
+    const uint8_t private_key[64]) {
+  ED25519_EXPANDED_KEY *key;
+
+  if ((key = ED25519_expanded_key_from_public(private_key + 32)) == NULL) {
+    return NULL;
+  }
+
+  ed25519_expand_seed(key->az, private_key);
+  key->has_private = 1;
+
+  return key;
+}
+
+ED25519_EXPANDED_KEY *ED25519_expanded_key_from_public(
+    const uint8_t public_key[32]) {
+  ED25519_EXPANDED_KEY *key;
+
+  if ((key = calloc(1, sizeof(*key))) == NULL) {
+    return NULL;
+  }
+
+  memcpy(key->public_key, public_key, 32);
+  if (!ed25519_public_key_precompute(key->neg_Ai, public_key)) {
+    ED25519_expanded_key_free(key);
+    return NULL;
+  }
+
+  return key;
+}
+
+void ED25519_expanded_key_free(ED25519_EXPANDED_KEY *key) {
+  freezero(key, sizeof(*key));
+}
+
+int ED25519_sign_with_expanded_key(uint8_t *out_sig, const uint8_t *message,
+                                   size_t message_len,
+                                   const ED25519_EXPANDED_KEY *key) {
+  if (!key->has_private) {
+    return 0;
+  }
+
+  ed25519_sign_expanded(out_sig, message, message_len, key->az,
+                        key->public_key);
+
+  return 1;
+}
+
+int ED25519_verify_with_expanded_key(const uint8_t *message,
+                                     size_t message_len,
+                                     const uint8_t signature[64],
+                                     const ED25519_EXPANDED_KEY *key) {
+  return ed25519_verify_expanded(message, message_len, signature,
+                                 key->public_key, key->neg_Ai);
+}
+
+/* Number of signatures combined into one multi-scalar multiplication by
+ * ED25519_verify_batch. */
+#define ED25519_BATCH_CHUNK 64
+
+typedef struct {
+  ge_cached Ri[8];
+  ge_cached Ai[8];
+  signed char zslide[256];
+  signed char cslide[256];
+} ed25519_batch_item;
+
+/* Returns one if |s| is the canonical encoding of a point: y < p, and the
+ * sign bit is clear if x = 0, that is, if y = 1 or y = -1. The encoding
+ * produced by ge_p3_tobytes is always canonical, so ED25519_verify rejects
+ * signatures with a non-canonical R. */
+static int ge_bytes_is_canonical(const uint8_t s[32]) {
+  static const uint8_t kOne[32] = {1};
+  static const uint8_t kMinusOne[32] = {
+      0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+  };
+  uint8_t y[32];
+  int i;
+
+  memcpy(y, s, 32);
+  y[31] &= 0x7f;
+
+  if (y[0] >= 0xed && y[31] == 0x7f) {
+    for (i = 1; i < 31; i++) {
+      if (y[i] != 0xff) {
+        break;
+      }
+    }
+    if (i == 31) {
+      return 0;
+    }
+  }
+
+  if ((s[31] & 0x80) != 0 &&
+      (memcmp(y, kOne, 32) == 0 || memcmp(y, kMinusOne, 32) == 0)) {
+    return 0;
+  }
+
+  return 1;
+}
+
+/* h += b * A, where b is a digit produced by slide(). */
+static void ge_add_digit(ge_p3 *h, const ge_cached Ai[8], signed char b) {
+  ge_p1p1 t;
+
+  if (b > 0) {
+    x25519_ge_add(&t, h, &Ai[b / 2]);
+    x25519_ge_p1p1_to_p3(h, &t);
+  } else if (b < 0) {
+    x25519_ge_sub(&t, h, &Ai[(-b) / 2]);
+    x25519_ge_p1p1_to_p3(h, &t);
+  }
+}
+
+/* ed25519_batch_check picks random 128-bit z_i and checks that
+ *
+ *   8 * (sum(z_i * R_i) + sum(z_i * h_i * A_i) - sum(z_i * s_i) * B) = 0
+ *
+ * with one multi-scalar multiplication (Straus's method, with the signed
+ * window of ge_double_scalarmult_vartime). It returns zero if this does not
+ * hold or if any of the n signatures is malformed. */
+static int ed25519_batch_check(ed25519_batch_item *items,
+                               const uint8_t *const messages[],
+                               const size_t message_lens[],
+                               const uint8_t *const signatures[],
+                               const uint8_t *const public_keys[], size_t n) {
+  static const uint8_t kZero[32] = {0};
+  uint8_t z[32], c[32], zs[32];
+  uint8_t h[SHA512_DIGEST_LENGTH];
+  signed char bslide[256];
+  SHA512_CTX hash_ctx;
+  ge_p1p1 t;
+  ge_p3 A, R, u;
+  fe check;
+  size_t i;
+  int pos, ret = 0;
+
+  memset(zs, 0, sizeof(zs));
+
+  for (i = 0; i < n; i++) {
+    const uint8_t *sig = signatures[i];
+
+    if ((sig[63] & 224) != 0 || !ge_bytes_is_canonical(sig) ||
+        x25519_ge_frombytes_vartime(&R, sig) != 0 ||
+        x25519_ge_frombytes_vartime(&A, public_keys[i]) != 0) {
+      goto err;
+    }
+
+    SHA512_Init(&hash_ctx);
+    SHA512_Update(&hash_ctx, sig, 32);
+    SHA512_Update(&hash_ctx, public_keys[i], 32);
+    SHA512_Update(&hash_ctx, messages[i], message_lens[i]);
+    SHA512_Final(h, &hash_ctx);
+    x25519_sc_reduce(h);
+
+    memset(z, 0, sizeof(z));
+    arc4random_buf(z, 16);
+    sc_muladd(c, z, h, kZero);
+    sc_muladd(zs, z, sig + 32, zs);
+
+    slide(items[i].zslide, z);
+    slide(items[i].cslide, c);
+    ge_precompute_odd_multiples(items[i].Ri, &R);
+    ge_precompute_odd_multiples(items[i].Ai, &A);
+  }
+  slide(bslide, zs);
+
+  ge_p3_0(&u);
+  for (pos = 255; pos >= 0; --pos) {
+    ge_p3_dbl(&t, &u);
+    x25519_ge_p1p1_to_p3(&u, &t);
+
+    for (i = 0; i < n; i++) {
+      ge_add_digit(&u, items[i].Ri, items[i].zslide[pos]);
+      ge_add_digit(&u, items[i].Ai, items[i].cslide[pos]);
+    }
+
+    if (bslide[pos] > 0) {
+      ge_msub(&t, &u, &Bi[bslide[pos] / 2]);
+      x25519_ge_p1p1_to_p3(&u, &t);
+    } else if (bslide[pos] < 0) {
+      ge_madd(&t, &u, &Bi[(-bslide[pos]) / 2]);
+      x25519_ge_p1p1_to_p3(&u, &t);
+    }
+  }
+
+  /* Clear any small order component. */
+  for (i = 0; i < 3; i++) {
+    ge_p3_dbl(&t, &u);
+    x25519_ge_p1p1_to_p3(&u, &t);
+  }
+
+  /* The identity is (0 : Z : Z). */
+  fe_sub(check, u.Y, u.Z);
+  ret = !fe_isnonzero(u.X) && !fe_isnonzero(check);
+
+ err:
+  explicit_bzero(z, sizeof(z));
+  explicit_bzero(c, sizeof(c));
+  explicit_bzero(zs, sizeof(zs));
+  return ret;
+}
+
+int ED25519_verify_batch(const uint8_t *const messages[],
+                         const size_t message_lens[],
+                         const uint8_t *const signatures[],
+                         const uint8_t *const public_keys[], size_t num,
+                         int valid[]) {
+  ed25519_batch_item *items;
+  size_t i, j, n;
+  int ok, ret = 1;
+
+  /* Without memory for the tables, verify the signatures one at a time. */
+  items = calloc(ED25519_BATCH_CHUNK, sizeof(*items));
+
+  for (i = 0; i < num; i += n) {
+    n = num - i;
+    if (n > ED25519_BATCH_CHUNK) {
+      n = ED25519_BATCH_CHUNK;
+    }
+
+    if (items != NULL && n > 1 &&
+        ed25519_batch_check(items, messages + i, message_lens + i,
+                            signatures + i, public_keys + i, n)) {
+      if (valid != NULL) {
+        for (j = 0; j < n; j++) {
+          valid[i + j] = 1;
+        }
+      }
+      continue;
+    }
+
+    /* Find the bad signatures. */
+    for (j = 0; j < n; j++) {
+      ok = ED25519_verify(messages[i + j], message_lens[i + j],
+                          signatures[i + j], public_keys[i + j]);
+      if (valid != NULL) {
+        valid[i + j] = ok;
+      }
+      if (!ok) {
+        ret = 0;
+      }
+    }
+  }
+
+  freezero(items, ED25519_BATCH_CHUNK * sizeof(*items));
+
+  return ret;
+}
 
 /* Replace (f,g) with (g,f) if b == 1;
  * replace (f,g) with (f,g) if b == 0.
@@ -18,6 +18,7 @@
 #ifndef HEADER_CURVE25519_INTERNAL_H
 #define HEADER_CURVE25519_INTERNAL_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 __BEGIN_HIDDEN_DECLS
@@ -94,6 +95,70 @@ void x25519_scalar_mult(uint8_t out[32], const uint8_t scalar[32],
 void x25519_scalar_mult_generic(uint8_t out[32], const uint8_t scalar[32],
     const uint8_t point[32]);
 
+/* 64-bit implementations in curve25519-64.c, need a 128-bit integer type. */
+#if defined(__SIZEOF_INT128__) && __SIZEOF_INT128__ == 16
+#define X25519_FE51
+void x25519_scalar_mult_fe51(uint8_t out[32], const uint8_t scalar[32],
+    const uint8_t point[32]);
+#ifdef X25519_ASM
+void x25519_scalar_mult_fe64(uint8_t out[32], const uint8_t scalar[32],
+    const uint8_t point[32]);
+#endif
+#endif
+
+void ED25519_keypair(uint8_t out_public_key[32], uint8_t out_private_key[64]);
+int ED25519_sign(uint8_t *out_sig, const uint8_t *message, size_t message_len,
+    const uint8_t private_key[64]);
+int ED25519_verify(const uint8_t *message, size_t message_len,
+    const uint8_t signature[64], const uint8_t public_key[32]);
+
+/*
+ * An ED25519_EXPANDED_KEY holds what ED25519_sign and ED25519_verify derive
+ * from a key on every call: the SHA-512 expansion of the private seed and
+ * a table of multiples of the decoded public key point. It is created once
+ * with ED25519_expanded_key_from_private (from the 64-byte private key of
+ * ED25519_keypair) or ED25519_expanded_key_from_public, which return NULL
+ * if the public key does not decode or on allocation failure. A key created
+ * from a public key can only be used to verify.
+ */
+typedef struct ed25519_expanded_key_st ED25519_EXPANDED_KEY;
+
+ED25519_EXPANDED_KEY *ED25519_expanded_key_from_private(
+    const uint8_t private_key[64]);
+ED25519_EXPANDED_KEY *ED25519_expanded_key_from_public(
+    const uint8_t public_key[32]);
+void ED25519_expanded_key_free(ED25519_EXPANDED_KEY *key);
+int ED25519_sign_with_expanded_key(uint8_t *out_sig, const uint8_t *message,
+    size_t message_len, const ED25519_EXPANDED_KEY *key);
+int ED25519_verify_with_expanded_key(const uint8_t *message,
+    size_t message_len, const uint8_t signature[64],
+    const ED25519_EXPANDED_KEY *key);
+
+/*
+ * ED25519_verify_batch verifies num signatures at once, where signature i
+ * is over messages[i] (of length message_lens[i]) and is checked against
+ * public_keys[i]. It returns one if all signatures are valid and zero
+ * otherwise. If valid is not NULL, valid[i] is set to one or zero for each
+ * signature.
+ *
+ * Signatures are combined with random weights and checked with one
+ * multi-scalar multiplication per group of up to 64. If a group fails, its
+ * signatures are checked one at a time with ED25519_verify.
+ *
+ * ED25519_verify is cofactorless: it checks [s]B - [k]A == R exactly. The
+ * batch equation is cofactored: it checks 8([s]B - [k]A - R) == 0, since
+ * the random weights cannot cancel a small order component reliably. The
+ * two agree on every signature whose R and public key lie in the prime
+ * order subgroup, which includes all honestly generated ones, and on every
+ * signature that fails for any other reason. A signature that ED25519_verify
+ * rejects only because R or the public key has a small order component may
+ * be reported as valid here, both in the return value and in valid[].
+ * Callers that need ED25519_verify's exact answer must not use this.
+ */
+int ED25519_verify_batch(const uint8_t *const messages[],
+    const size_t message_lens[], const uint8_t *const signatures[],
+    const uint8_t *const public_keys[], size_t num, int valid[]);
+
 __END_HIDDEN_DECLS
 
 #endif  /* HEADER_CURVE25519_INTERNAL_H */
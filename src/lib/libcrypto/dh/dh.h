@@ -170,6 +170,10 @@ DH *	DH_generate_parameters(int prime_len,int generator,
 
 /* New version */
 int	DH_generate_parameters_ex(DH *dh, int prime_len,int generator, BN_GENCB *cb);
+int	DH_generate_parameters_mt(DH *dh, int prime_len, int generator,
+	    int nthreads,
+	    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+	    void *arg, BN_GENCB *cb);
 
 int	DH_check(const DH *dh,int *codes);
 int	DH_check_pub_key(const DH *dh,const BIGNUM *pub_key, int *codes);
@@ -0,0 +1,198 @@
+/*	$OpenBSD$	*/
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Fixed-base exponentiation g^x mod p for the RFC 3526 groups with g = 2,
+ * using the Lim-Lee comb method with the tables in dh_comb_table.h, which
+ * are generated by dh_comb.pl. The exponent is split into
+ * DH_COMB_TABLES * DH_COMB_TEETH rows of d bits; each of the d steps
+ * costs one squaring and one multiplication per table, against one
+ * squaring per exponent bit for a sliding window. Table entries are read
+ * in constant time.
+ */
+
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/dh.h>
+
+#include "bn_lcl.h"
+#include "constant_time_locl.h"
+#include "dh_local.h"
+
+#if BN_BITS2 != 64
+#define	TOBN(hi,lo)	lo,hi
+#else
+#define	TOBN(hi,lo)	((BN_ULONG)hi << 32 | lo)
+#endif
+
+#include "dh_comb_table.h"
+
+#define DH_COMB_ROWS	(DH_COMB_TABLES * DH_COMB_TEETH)
+
+struct dh_comb {
+	int bits;
+	const BN_ULONG *p;
+	const BN_ULONG *table;
+};
+
+static const struct dh_comb dh_combs[] = {
+	{ 2048, dh_comb_p2048, &dh_comb_table2048[0][0] },
+	{ 3072, dh_comb_p3072, &dh_comb_table3072[0][0] },
+	{ 4096, dh_comb_p4096, &dh_comb_table4096[0][0] },
+};
+
+#define N_DH_COMBS (sizeof(dh_combs) / sizeof(dh_combs[0]))
+
+/*
+ * Return the comb for the group of dh if there is one and the exponent e
+ * fits into it, otherwise NULL. The comb costs about as much for any
+ * exponent, so short exponents, as set with DH_set_length(), are left to
+ * the generic code, which is faster for them.
+ */
+const struct dh_comb *
+dh_comb_find(const DH *dh, const BIGNUM *e)
+{
+	const struct dh_comb *comb;
+	int bits, rows_bits;
+	size_t i;
+
+	if (dh->p == NULL || dh->g == NULL || !BN_is_word(dh->g, 2))
+		return NULL;
+	if (BN_is_negative(dh->p) || BN_is_negative(e))
+		return NULL;
+
+	bits = BN_num_bits(dh->p);
+	for (i = 0; i < N_DH_COMBS; i++) {
+		comb = &dh_combs[i];
+		if (comb->bits != bits || dh->p->top != bits / BN_BITS2)
+			continue;
+		if (memcmp(dh->p->d, comb->p, bits / 8) != 0)
+			continue;
+		rows_bits = (bits + DH_COMB_ROWS - 1) / DH_COMB_ROWS *
+		    DH_COMB_ROWS;
+		if (BN_num_bits(e) <= bits / 2 || BN_num_bits(e) > rows_bits)
+			return NULL;
+		return comb;
+	}
+
+	return NULL;
+}
+
+/*
+ * Load entry idx of a table into r, in constant time. r is left at the
+ * full width of n words, even if its top words are zero, so that its top
+ * does not depend on idx; it is only passed to BN_mod_mul_montgomery(),
+ * which works on such values.
+ */
+static void
+dh_comb_select(BIGNUM *r, const BN_ULONG *table, int n, int idx)
+{
+	BN_ULONG mask;
+	int i, j;
+
+	memset(r->d, 0, n * sizeof(BN_ULONG));
+	for (i = 0; i < 1 << DH_COMB_TEETH; i++, table += n) {
+		mask = (BN_ULONG)0 - (constant_time_eq_int(i, idx) & 1);
+		for (j = 0; j < n; j++)
+			r->d[j] |= table[j] & mask;
+	}
+	r->top = n;
+	r->neg = 0;
+}
+
+/*
+ * Compute r = 2^e mod p for the group of comb. mont may be NULL, or must
+ * be set up for p.
+ */
+int
+dh_comb_mod_exp(const struct dh_comb *comb, BIGNUM *r, const BIGNUM *e,
+    BN_MONT_CTX *mont, BN_CTX *ctx)
+{
+	BN_MONT_CTX *new_mont = NULL;
+	BIGNUM *acc, *t, *p, *k = NULL;
+	int n, d, nw, idx, bit;
+	int i, j, l;
+	int ret = 0;
+
+	n = comb->bits / BN_BITS2;
+	d = (comb->bits + DH_COMB_ROWS - 1) / DH_COMB_ROWS;
+	nw = (DH_COMB_ROWS * d + BN_BITS2 - 1) / BN_BITS2;
+
+	BN_CTX_start(ctx);
+	if ((acc = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if ((t = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if ((k = BN_CTX_get(ctx)) == NULL)
+		goto err;
+
+	if (mont == NULL) {
+		if ((p = BN_CTX_get(ctx)) == NULL)
+			goto err;
+		if (bn_wexpand(p, n) == NULL)
+			goto err;
+		memcpy(p->d, comb->p, n * sizeof(BN_ULONG));
+		p->top = n;
+		if ((new_mont = BN_MONT_CTX_new()) == NULL)
+			goto err;
+		if (!BN_MONT_CTX_set(new_mont, p, ctx))
+			goto err;
+		mont = new_mont;
+	}
+
+	/* Pad the exponent so that every row can be read without checks. */
+	if (bn_wexpand(t, n) == NULL)
+		goto err;
+	if (bn_wexpand(k, nw) == NULL)
+		goto err;
+	memset(k->d, 0, nw * sizeof(BN_ULONG));
+	memcpy(k->d, e->d, e->top * sizeof(BN_ULONG));
+
+	if (!BN_to_montgomery(acc, BN_value_one(), mont, ctx))
+		goto err;
+
+	for (i = d - 1; i >= 0; i--) {
+		if (i != d - 1) {
+			if (!BN_mod_mul_montgomery(acc, acc, acc, mont, ctx))
+				goto err;
+		}
+		for (j = 0; j < DH_COMB_TABLES; j++) {
+			idx = 0;
+			for (l = 0; l < DH_COMB_TEETH; l++) {
+				bit = (j * DH_COMB_TEETH + l) * d + i;
+				idx |= ((k->d[bit / BN_BITS2] >>
+				    (bit % BN_BITS2)) & 1) << l;
+			}
+			dh_comb_select(t, comb->table +
+			    (j << DH_COMB_TEETH) * n, n, idx);
+			if (!BN_mod_mul_montgomery(acc, acc, t, mont, ctx))
+				goto err;
+		}
+	}
+
+	if (!BN_from_montgomery(r, acc, mont, ctx))
+		goto err;
+
+	ret = 1;
+
+ err:
+	if (k != NULL)
+		BN_clear(k);
+	BN_CTX_end(ctx);
+	BN_MONT_CTX_free(new_mont);
+
+	return ret;
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Generate the comb tables for fixed-base exponentiation in the RFC 3526
+# groups used by dh_comb.c.
+#
+# usage: dh_comb.pl bn_const.c dh_comb_table.h
+#
+# The output is kept in the tree and is not rebuilt by the Makefile, as
+# this takes about a minute. Run it from lib/libcrypto after changing the
+# primes or the comb parameters:
+#
+#	perl dh/dh_comb.pl bn/bn_const.c dh/dh_comb_table.h
+#
+# The primes are read from bn_const.c. For a prime p of n bits the
+# exponent is split into ROWS rows of d = ceil(n / ROWS) bits, and the
+# rows are grouped into TABLES tables of TEETH rows each. Entry i of
+# table t is the product of g^(2^(r * d)) over the rows r = t * TEETH + j
+# for which bit j of i is set, in Montgomery form with R = 2^n.
+
+use strict;
+use warnings;
+use Math::BigInt try => 'GMP';
+
+my $TEETH = 6;
+my $TABLES = 2;
+my $ROWS = $TEETH * $TABLES;
+my $G = 2;
+my @BITS = (2048, 3072, 4096);
+
+my ($in, $out) = @ARGV;
+die "usage: dh_comb.pl bn_const.c dh_comb_table.h\n"
+    unless defined($in) && defined($out);
+
+open(my $fh, '<', $in) or die "$in: $!\n";
+my $src = do { local $/; <$fh> };
+close($fh);
+
+# Print a number as little-endian 64-bit words, two per line.
+sub words {
+	my ($x, $n) = @_;
+	my $hex = substr($x->as_hex(), 2);
+	my @w;
+
+	$hex = ('0' x ($n / 4 - length($hex))) . $hex;
+	for (my $i = $n / 4; $i > 0; $i -= 16) {
+		my $word = substr($hex, $i - 16, 16);
+		push(@w, sprintf("TOBN(0x%s, 0x%s)",
+		    substr($word, 0, 8), substr($word, 8, 8)));
+	}
+	my $s = "";
+	for (my $i = 0; $i < @w; $i += 2) {
+		$s .= "\t" . join(", ", @w[$i .. $i + 1]) . ",\n";
+	}
+	return $s;
+}
+
+open(my $oh, '>', "$out.tmp") or die "$out.tmp: $!\n";
+print $oh <<EOF;
+/*
+ * THIS FILE IS GENERATED FROM bn_const.c BY dh_comb.pl. DO NOT EDIT.
+ */
+
+__BEGIN_HIDDEN_DECLS
+
+#define DH_COMB_TEETH	$TEETH
+#define DH_COMB_TABLES	$TABLES
+EOF
+
+foreach my $bits (@BITS) {
+	$src =~ /RFC3526_PRIME_$bits\[\]\s*=\s*\{([^}]*)\}/
+	    or die "$in: no RFC3526_PRIME_$bits\n";
+	my $bytes = $1;
+	$bytes =~ s/0x//g;
+	$bytes =~ s/[\s,]//g;
+	my $p = Math::BigInt->from_hex($bytes);
+	die "$in: RFC3526_PRIME_$bits has the wrong size\n"
+	    unless length($p->as_bin()) - 2 == $bits;
+
+	my $d = int(($bits + $ROWS - 1) / $ROWS);
+	my $r = Math::BigInt->new(2)->bpow($bits)->bmod($p);
+	my $e = Math::BigInt->new(2)->bpow($d);
+	my @base = (Math::BigInt->new($G));
+	for (my $i = 1; $i < $ROWS; $i++) {
+		push(@base, $base[$i - 1]->copy()->bmodpow($e, $p));
+	}
+
+	print $oh "\nstatic const BN_ULONG dh_comb_p$bits\[] = {\n";
+	print $oh words($p, $bits);
+	print $oh "};\n";
+	print $oh "\nstatic const BN_ULONG\n";
+	print $oh "dh_comb_table$bits\[DH_COMB_TABLES << DH_COMB_TEETH]";
+	print $oh "[$bits / BN_BITS2] = {\n";
+	for (my $t = 0; $t < $TABLES; $t++) {
+		my @entry = (Math::BigInt->new(1));
+		for (my $i = 1; $i < (1 << $TEETH); $i++) {
+			my $j = 0;
+			$j++ while (($i >> $j) > 1);
+			push(@entry, $entry[$i & ~(1 << $j)]->copy()->
+			    bmul($base[$t * $TEETH + $j])->bmod($p));
+		}
+		foreach my $x (@entry) {
+			print $oh "    {\n";
+			print $oh words($x->copy()->bmul($r)->bmod($p), $bits);
+			print $oh "    },\n";
+		}
+	}
+	print $oh "};\n";
+}
+
+print $oh "\n__END_HIDDEN_DECLS\n";
+close($oh) or die "$out.tmp: $!\n";
+rename("$out.tmp", $out) or die "$out: $!\n";
@@ -0,0 +1,10087 @@
+/*
+ * THIS FILE IS GENERATED FROM bn_const.c BY dh_comb.pl. DO NOT EDIT.
+ */
+
+__BEGIN_HIDDEN_DECLS
+
+#define DH_COMB_TEETH	6
+#define DH_COMB_TABLES	2
+
+static const BN_ULONG dh_comb_p2048[] = {
+	TOBN(0xffffffff, 0xffffffff), TOBN(0x15728e5a, 0x8aacaa68),
+	TOBN(0x15d22618, 0x98fa0510), TOBN(0x3995497c, 0xea956ae5),
+	TOBN(0xde2bcbf6, 0x95581718), TOBN(0xb5c55df0, 0x6f4c52c9),
+	TOBN(0x9b2783a2, 0xec07a28f), TOBN(0xe39e772c, 0x180e8603),
+	TOBN(0x32905e46, 0x2e36ce3b), TOBN(0xf1746c08, 0xca18217c),
+	TOBN(0x670c354e, 0x4abc9804), TOBN(0x9ed52907, 0x7096966d),
+	TOBN(0x1c62f356, 0x208552bb), TOBN(0x83655d23, 0xdca3ad96),
+	TOBN(0x69163fa8, 0xfd24cf5f), TOBN(0x98da4836, 0x1c55d39a),
+	TOBN(0xc2007cb8, 0xa163bf05), TOBN(0x49286651, 0xece45b3d),
+	TOBN(0xae9f2411, 0x7c4b1fe6), TOBN(0xee386bfb, 0x5a899fa5),
+	TOBN(0x0bff5cb6, 0xf406b7ed), TOBN(0xf44c42e9, 0xa637ed6b),
+	TOBN(0xe485b576, 0x625e7ec6), TOBN(0x4fe1356d, 0x6d51c245),
+	TOBN(0x302b0a6d, 0xf25f1437), TOBN(0xef9519b3, 0xcd3a431b),
+	TOBN(0x514a0879, 0x8e3404dd), TOBN(0x020bbea6, 0x3b139b22),
+	TOBN(0x29024e08, 0x8a67cc74), TOBN(0xc4c6628b, 0x80dc1cd1),
+	TOBN(0xc90fdaa2, 0x2168c234), TOBN(0xffffffff, 0xffffffff),
+};
+
+static const BN_ULONG
+dh_comb_table2048[DH_COMB_TABLES << DH_COMB_TEETH][2048 / BN_BITS2] = {
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xea8d71a5, 0x75535597),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x00000000, 0x00000002), TOBN(0xd51ae34a, 0xeaa6ab2e),
+	TOBN(0xd45bb3ce, 0xce0bf5df), TOBN(0x8cd56d06, 0x2ad52a35),
+	TOBN(0x43a86812, 0xd54fd1cf), TOBN(0x9475441f, 0x21675a6c),
+	TOBN(0xc9b0f8ba, 0x27f0bae0), TOBN(0x38c311a7, 0xcfe2f3f8),
+	TOBN(0x9adf4373, 0xa3926388), TOBN(0x1d1727ee, 0x6bcfbd07),
+	TOBN(0x31e79563, 0x6a86cff6), TOBN(0xc255adf1, 0x1ed2d325),
+	TOBN(0xc73a1953, 0xbef55a88), TOBN(0xf93545b8, 0x46b8a4d3),
+	TOBN(0x2dd380ae, 0x05b66140), TOBN(0xce4b6f93, 0xc75458cb),
+	TOBN(0x7bff068e, 0xbd3881f4), TOBN(0x6daf335c, 0x26374984),
+	TOBN(0xa2c1b7dd, 0x0769c033), TOBN(0x238f2809, 0x4aecc0b4),
+	TOBN(0xe8014692, 0x17f29024), TOBN(0x17677a2c, 0xb3902529),
+	TOBN(0x36f49513, 0x3b430272), TOBN(0x603d9525, 0x255c7b74),
+	TOBN(0x9fa9eb24, 0x1b41d791), TOBN(0x20d5cc98, 0x658b79c9),
+	TOBN(0x5d6bef0c, 0xe397f644), TOBN(0xfbe882b3, 0x89d8c9bb),
+	TOBN(0xadfb63ee, 0xeb306717), TOBN(0x76733ae8, 0xfe47c65d),
+	TOBN(0x6de04abb, 0xbd2e7b96), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0xd8ebadd4, 0x6df83bbe), TOBN(0xe2673059, 0x947be9be),
+	TOBN(0x75d07cb2, 0xa0304a8b), TOBN(0xdd2826ca, 0xc3b55a9d),
+	TOBN(0xafc06195, 0xdf057e68), TOBN(0x96449ccd, 0x5f9fd9b5),
+	TOBN(0xc1e2418d, 0x589bebde), TOBN(0xd00867fe, 0xc18ec8ab),
+	TOBN(0xb8259501, 0x7bfcf15c), TOBN(0xd955b4bb, 0x9f246af7),
+	TOBN(0xb525a799, 0xd57d1e66), TOBN(0xb2279b41, 0x50137b96),
+	TOBN(0xffe16d6f, 0x069ae564), TOBN(0xc8ea7a33, 0xc4a1dceb),
+	TOBN(0x264af96d, 0x81f2b2f3), TOBN(0x7e0ea46f, 0xce2554a8),
+	TOBN(0xadf6895e, 0xb34c85c7), TOBN(0x94f01a92, 0xfdff8107),
+	TOBN(0x06c98be3, 0x3d8bd34c), TOBN(0x68ac9c2a, 0xa9b30391),
+	TOBN(0xebae14e9, 0x4e9b94ef), TOBN(0x15b76dea, 0x9e7f590c),
+	TOBN(0x8dbbf554, 0xd6a69d62), TOBN(0xdec2ad68, 0x55414a5a),
+	TOBN(0x046ff80a, 0x97daeaf7), TOBN(0x2072452a, 0xa4f37db4),
+	TOBN(0xd78d6f0b, 0xe7ecd20a), TOBN(0xa27513ab, 0x1877e20c),
+	TOBN(0x00d1f5d3, 0x85fdaaa4), TOBN(0xa429c5ec, 0xa4ca5893),
+	TOBN(0xe930fa0a, 0x0eff7039), TOBN(0x889c5f2e, 0x632b96ae),
+    },
+    {
+	TOBN(0xb1d75ba8, 0xdbf0777d), TOBN(0xaf5bd258, 0x9e4b2914),
+	TOBN(0xd5ced34c, 0xa7669007), TOBN(0x80bb0418, 0x9cd54a55),
+	TOBN(0x8154f735, 0x28b2e5b9), TOBN(0x76c3dbaa, 0x4ff360a1),
+	TOBN(0xe89cff77, 0xc530352d), TOBN(0xbc7258d1, 0x6b0f0b53),
+	TOBN(0x3dbacbbc, 0xc9c3147d), TOBN(0xc136fd6e, 0x7430b473),
+	TOBN(0x033f19e5, 0x603da4c8), TOBN(0xc57a0d7b, 0x2f9060c0),
+	TOBN(0xe35fe787, 0xecb0780d), TOBN(0x0e6f9743, 0xaca00c41),
+	TOBN(0xe37fb332, 0x06c09688), TOBN(0x634300a9, 0x7ff4d5b5),
+	TOBN(0x99ec9604, 0xc5354c89), TOBN(0xe0b7ced4, 0x0f1aa6d1),
+	TOBN(0x5ef3f3b4, 0xfecc86b2), TOBN(0xe320cc59, 0xf8dc677c),
+	TOBN(0xcb5ccd1b, 0xa93071f0), TOBN(0x372298eb, 0x96c6c4ae),
+	TOBN(0x36f23533, 0x4aeebbfd), TOBN(0x6da42563, 0x3d30d26f),
+	TOBN(0xd8b4e5a7, 0x3d56c1b8), TOBN(0x514f70a1, 0x7cacb84c),
+	TOBN(0x5dd0d59e, 0x41a59f36), TOBN(0x42de68af, 0xf5dc28f7),
+	TOBN(0xd8a19d9e, 0x819388d5), TOBN(0x838d294d, 0xc8b89454),
+	TOBN(0x09521971, 0xfc961e3e), TOBN(0x1138be5c, 0xc6572d5e),
+    },
+    {
+	TOBN(0x5138bcf3, 0xf21ed29c), TOBN(0x8f742b81, 0x8cf93f6c),
+	TOBN(0xa6724279, 0x5d482c69), TOBN(0xfd4dd921, 0xc32dfa78),
+	TOBN(0x1aa97f70, 0x80b9983b), TOBN(0x01d7b2f1, 0x3e2b7332),
+	TOBN(0xa4ed7b3c, 0x82a203a8), TOBN(0x4ab8fb1b, 0x5a00c601),
+	TOBN(0xdea6c917, 0x5493da30), TOBN(0xddca4176, 0x26af5253),
+	TOBN(0x0a4d8b81, 0xb8a291f7), TOBN(0xaccc68c7, 0xde14ee58),
+	TOBN(0x42c8f1bd, 0xa44bc7f4), TOBN(0x38c7f261, 0xb7d0c660),
+	TOBN(0xb18cb9ef, 0xc06abaaf), TOBN(0xec1e23b8, 0xd2333b70),
+	TOBN(0x0ce19397, 0x1b041f69), TOBN(0x853fdb64, 0x51ec55e1),
+	TOBN(0x98ad375e, 0x2b5760d5), TOBN(0x94f5863b, 0xb76144f5),
+	TOBN(0x3ee0d8cc, 0x7f23b5fa), TOBN(0xc9dfca54, 0x61555d46),
+	TOBN(0xed3b68ba, 0x62821af9), TOBN(0xf126e12d, 0x0393372a),
+	TOBN(0x4c51dd7a, 0x6c5d565d), TOBN(0x1c9da773, 0xab29cbea),
+	TOBN(0x5e61cae1, 0x0ff997f0), TOBN(0x0b0967ef, 0xa7e07d0d),
+	TOBN(0x8d967243, 0x70ff5478), TOBN(0xf98084b6, 0x9d2f3ca5),
+	TOBN(0xb12aa92d, 0xc6232cdd), TOBN(0x543a149b, 0x542d524c),
+    },
+    {
+	TOBN(0xa27179e7, 0xe43da538), TOBN(0x1ee85703, 0x19f27ed8),
+	TOBN(0x4ce484f2, 0xba9058d3), TOBN(0xfa9bb243, 0x865bf4f1),
+	TOBN(0x3552fee1, 0x01733077), TOBN(0x03af65e2, 0x7c56e664),
+	TOBN(0x49daf679, 0x05440750), TOBN(0x9571f636, 0xb4018c03),
+	TOBN(0xbd4d922e, 0xa927b460), TOBN(0xbb9482ec, 0x4d5ea4a7),
+	TOBN(0x149b1703, 0x714523ef), TOBN(0x5998d18f, 0xbc29dcb0),
+	TOBN(0x8591e37b, 0x48978fe9), TOBN(0x718fe4c3, 0x6fa18cc0),
+	TOBN(0x631973df, 0x80d5755e), TOBN(0xd83c4771, 0xa46676e1),
+	TOBN(0x19c3272e, 0x36083ed3), TOBN(0x0a7fb6c8, 0xa3d8abc2),
+	TOBN(0x315a6ebc, 0x56aec1ab), TOBN(0x29eb0c77, 0x6ec289eb),
+	TOBN(0x7dc1b198, 0xfe476bf5), TOBN(0x93bf94a8, 0xc2aaba8c),
+	TOBN(0xda76d174, 0xc50435f3), TOBN(0xe24dc25a, 0x07266e55),
+	TOBN(0x98a3baf4, 0xd8baacbb), TOBN(0x393b4ee7, 0x565397d4),
+	TOBN(0xbcc395c2, 0x1ff32fe0), TOBN(0x1612cfdf, 0x4fc0fa1a),
+	TOBN(0x1b2ce486, 0xe1fea8f0), TOBN(0xf301096d, 0x3a5e794b),
+	TOBN(0x6255525b, 0x8c4659bb), TOBN(0xa8742936, 0xa85aa499),
+    },
+    {
+	TOBN(0x6ee6d228, 0x4e784b5e), TOBN(0x59cba2a8, 0xc8a5baf4),
+	TOBN(0x048ac715, 0x635786d4), TOBN(0x30bf2f45, 0xb2c5e5fb),
+	TOBN(0x542c594d, 0xb93ed821), TOBN(0x987b987e, 0xf1b4744b),
+	TOBN(0x92287e6e, 0x56cc9e31), TOBN(0xa81d9992, 0x78abe56b),
+	TOBN(0x608d8c71, 0xe674ab02), TOBN(0xa8aafff3, 0x3e214420),
+	TOBN(0x219be3bb, 0x5769262b), TOBN(0x955bd50c, 0xcf099048),
+	TOBN(0x4d16d0fb, 0xd7db3c11), TOBN(0xdeb9a0b8, 0xcb7ccc0a),
+	TOBN(0xa2c26685, 0x47286bc6), TOBN(0x15d8130c, 0xc7debd97),
+	TOBN(0x9c43aad2, 0xf80424cb), TOBN(0x4eb82c7c, 0xfb2626eb),
+	TOBN(0x3af05dde, 0x206e07c3), TOBN(0x2b5125b3, 0x0d0a0b82),
+	TOBN(0x3e862ff8, 0xaaa4bb8a), TOBN(0xa5127900, 0x65cc79f8),
+	TOBN(0xcd87073d, 0xad73856d), TOBN(0xd83b3e0d, 0xaa05bb84),
+	TOBN(0xc51e5fa5, 0x50d39464), TOBN(0xea9261c3, 0xc6286cc8),
+	TOBN(0x96e45db6, 0x1bd3f0cd), TOBN(0xf0ff95d2, 0x691af7c6),
+	TOBN(0x2890bd52, 0x8750e56b), TOBN(0x1d76e72b, 0x079efda5),
+	TOBN(0x98499d11, 0x23462747), TOBN(0x11150d8f, 0x85a967fb),
+    },
+    {
+	TOBN(0xddcda450, 0x9cf096bc), TOBN(0xb3974551, 0x914b75e8),
+	TOBN(0x09158e2a, 0xc6af0da8), TOBN(0x617e5e8b, 0x658bcbf6),
+	TOBN(0xa858b29b, 0x727db042), TOBN(0x30f730fd, 0xe368e896),
+	TOBN(0x2450fcdc, 0xad993c63), TOBN(0x503b3324, 0xf157cad7),
+	TOBN(0xc11b18e3, 0xcce95605), TOBN(0x5155ffe6, 0x7c428840),
+	TOBN(0x4337c776, 0xaed24c57), TOBN(0x2ab7aa19, 0x9e132090),
+	TOBN(0x9a2da1f7, 0xafb67823), TOBN(0xbd734171, 0x96f99814),
+	TOBN(0x4584cd0a, 0x8e50d78d), TOBN(0x2bb02619, 0x8fbd7b2f),
+	TOBN(0x388755a5, 0xf0084996), TOBN(0x9d7058f9, 0xf64c4dd7),
+	TOBN(0x75e0bbbc, 0x40dc0f86), TOBN(0x56a24b66, 0x1a141704),
+	TOBN(0x7d0c5ff1, 0x55497714), TOBN(0x4a24f200, 0xcb98f3f0),
+	TOBN(0x9b0e0e7b, 0x5ae70adb), TOBN(0xb0767c1b, 0x540b7709),
+	TOBN(0x8a3cbf4a, 0xa1a728c9), TOBN(0xd524c387, 0x8c50d991),
+	TOBN(0x2dc8bb6c, 0x37a7e19b), TOBN(0xe1ff2ba4, 0xd235ef8d),
+	TOBN(0x51217aa5, 0x0ea1cad7), TOBN(0x3aedce56, 0x0f3dfb4a),
+	TOBN(0x30933a22, 0x468c4e8e), TOBN(0x222a1b1f, 0x0b52cff7),
+    },
+    {
+	TOBN(0x6400bb38, 0x6908d485), TOBN(0x33c9f10c, 0x0c0de401),
+	TOBN(0x2adf61df, 0x7d1b4501), TOBN(0x15f3c7c2, 0x5d314d43),
+	TOBN(0x3baaa842, 0x48018bcd), TOBN(0x129007dc, 0xe2640edb),
+	TOBN(0xe752e053, 0x49664251), TOBN(0xc030f67c, 0xd23e4033),
+	TOBN(0xb16c3106, 0xb8de5b78), TOBN(0xc5446589, 0x3bfeca2e),
+	TOBN(0x3f11034a, 0xd41253cb), TOBN(0x7bdbb148, 0x209fe6cf),
+	TOBN(0x161b5aa0, 0xa7133190), TOBN(0x551df623, 0xc241bbad),
+	TOBN(0xc7c161a7, 0xde20a9d0), TOBN(0x0c7c5dde, 0x0307a7cb),
+	TOBN(0xae1680a5, 0x3da0e5c5), TOBN(0x5f69f37b, 0x7724a8ec),
+	TOBN(0x4bad7068, 0x308d10c9), TOBN(0x831d1799, 0x47dc4a28),
+	TOBN(0x922cd59e, 0x1f680e84), TOBN(0xec9f759f, 0xffab1876),
+	TOBN(0xd1e99f8a, 0xb7085548), TOBN(0xdaba2ff5, 0xa77704d5),
+	TOBN(0x22dedf65, 0x1ef29a3c), TOBN(0x7c6b6e17, 0x6d1f1774),
+	TOBN(0x9f96e01c, 0x1b8547ee), TOBN(0x22fb789c, 0xd5818539),
+	TOBN(0x45167292, 0x506cea6b), TOBN(0xcebbcdbc, 0x518ff481),
+	TOBN(0x65058a11, 0xd76ad954), TOBN(0x10305d89, 0xe3ec7325),
+    },
+    {
+	TOBN(0xc8017670, 0xd211a90a), TOBN(0x6793e218, 0x181bc802),
+	TOBN(0x55bec3be, 0xfa368a02), TOBN(0x2be78f84, 0xba629a86),
+	TOBN(0x77555084, 0x9003179a), TOBN(0x25200fb9, 0xc4c81db6),
+	TOBN(0xcea5c0a6, 0x92cc84a2), TOBN(0x8061ecf9, 0xa47c8067),
+	TOBN(0x62d8620d, 0x71bcb6f1), TOBN(0x8a88cb12, 0x77fd945d),
+	TOBN(0x7e220695, 0xa824a797), TOBN(0xf7b76290, 0x413fcd9e),
+	TOBN(0x2c36b541, 0x4e266320), TOBN(0xaa3bec47, 0x8483775a),
+	TOBN(0x8f82c34f, 0xbc4153a0), TOBN(0x18f8bbbc, 0x060f4f97),
+	TOBN(0x5c2d014a, 0x7b41cb8a), TOBN(0xbed3e6f6, 0xee4951d9),
+	TOBN(0x975ae0d0, 0x611a2192), TOBN(0x063a2f32, 0x8fb89450),
+	TOBN(0x2459ab3c, 0x3ed01d09), TOBN(0xd93eeb3f, 0xff5630ed),
+	TOBN(0xa3d33f15, 0x6e10aa91), TOBN(0xb5745feb, 0x4eee09ab),
+	TOBN(0x45bdbeca, 0x3de53479), TOBN(0xf8d6dc2e, 0xda3e2ee8),
+	TOBN(0x3f2dc038, 0x370a8fdc), TOBN(0x45f6f139, 0xab030a73),
+	TOBN(0x8a2ce524, 0xa0d9d4d6), TOBN(0x9d779b78, 0xa31fe902),
+	TOBN(0xca0b1423, 0xaed5b2a9), TOBN(0x2060bb13, 0xc7d8e64a),
+    },
+    {
+	TOBN(0xc076e8a7, 0x6c0610f2), TOBN(0x5230509d, 0x0590f6d5),
+	TOBN(0x3ba33723, 0x1f539675), TOBN(0xd6b213ed, 0x053236a6),
+	TOBN(0x37491f54, 0xc5e1e91e), TOBN(0xd5601f41, 0x3ca4446b),
+	TOBN(0x86799824, 0x902e7876), TOBN(0x80988c64, 0x7b363b85),
+	TOBN(0x3b1a450a, 0xae9eb514), TOBN(0x821dbb7b, 0xc30cb45d),
+	TOBN(0xbfe5669f, 0xbe2a438a), TOBN(0x9c2a0537, 0x343b5122),
+	TOBN(0xcc79d8ee, 0xf67a1a65), TOBN(0x941876aa, 0x15416779),
+	TOBN(0x2139428b, 0x3967e249), TOBN(0xaf6a0d01, 0x24cc1ea5),
+	TOBN(0x825420cc, 0xb3728f0e), TOBN(0x70b2f82a, 0x63c25e48),
+	TOBN(0x00656a2d, 0xe71fd8e8), TOBN(0x266915fa, 0x96bc0f20),
+	TOBN(0x4319577d, 0x0c9ef8d3), TOBN(0x60467a3f, 0x9e88c552),
+	TOBN(0xa2de5959, 0x188b1cc8), TOBN(0x2c64a32f, 0xa4e274aa),
+	TOBN(0x9cfedad5, 0xc1b6e3bb), TOBN(0x2382be74, 0xee7a53e2),
+	TOBN(0x52d32e5a, 0xa4d1c68e), TOBN(0x9e029174, 0xbe529e30),
+	TOBN(0xf26f4bce, 0x64dbb7c3), TOBN(0x3ca54d58, 0xed972b55),
+	TOBN(0xb985ecb2, 0x84dab5b2), TOBN(0xccb61201, 0x918198ef),
+    },
+    {
+	TOBN(0x80edd14e, 0xd80c21e5), TOBN(0x8eee12df, 0x80754342),
+	TOBN(0x6174482d, 0xa5ad27da), TOBN(0x73cede5d, 0x1fcf0267),
+	TOBN(0x906672b2, 0xf66bbb25), TOBN(0xf4fae092, 0x09fc360c),
+	TOBN(0x71cbaca6, 0x34554e5d), TOBN(0x1d92a19c, 0xde5df107),
+	TOBN(0x43a42bcf, 0x2f069bed), TOBN(0x12c70aee, 0xbc01473e),
+	TOBN(0x18be97f1, 0x3197ef10), TOBN(0x997ee166, 0xf7e00bd8),
+	TOBN(0x7c90be87, 0xcc6ee20f), TOBN(0xa4cb9030, 0x4ddf215d),
+	TOBN(0xd95c456d, 0x75aaf533), TOBN(0xc5f9d1cc, 0x2d4269af),
+	TOBN(0x42a7c4e0, 0xc5815f17), TOBN(0x983d8a02, 0xdaa06153),
+	TOBN(0x522bb04a, 0x51f491ea), TOBN(0x5e99bff9, 0xd2ee7e9a),
+	TOBN(0x7a335243, 0x253739b8), TOBN(0xcc40b195, 0x96d99d39),
+	TOBN(0x6136fd3b, 0xceb7bac9), TOBN(0x08e810f1, 0xdc73270f),
+	TOBN(0x09d2ab3d, 0x910eb33f), TOBN(0x57706336, 0x0fba64aa),
+	TOBN(0x545c543b, 0xbb6f883e), TOBN(0x39f96443, 0x4191a13e),
+	TOBN(0xbbdc4994, 0x3f4fa313), TOBN(0xb4843826, 0x5a5239da),
+	TOBN(0xa9fbfec2, 0xe84ca92f), TOBN(0x996c2403, 0x230331df),
+    },
+    {
+	TOBN(0x85ef829a, 0x0f2ddbc6), TOBN(0x97b281e2, 0xcbca9c9c),
+	TOBN(0x9a113e9d, 0x3c9316d5), TOBN(0xe48e78bd, 0xd8905644),
+	TOBN(0x45176d92, 0xbdd700c9), TOBN(0xa24aafe9, 0xbd7832ea),
+	TOBN(0xaada395b, 0xf24dca1f), TOBN(0xb8ea0cd4, 0xf2707df0),
+	TOBN(0xe8485799, 0xc2ca99ec), TOBN(0x6536c7fb, 0x00b1ff44),
+	TOBN(0xba029d51, 0x3025a05e), TOBN(0x16064f5a, 0x609ce6b0),
+	TOBN(0x5eda1390, 0x9be977c1), TOBN(0x82eee170, 0xb124a1f1),
+	TOBN(0x0476360f, 0xd13ae81c), TOBN(0xaa8da424, 0xb5bbb278),
+	TOBN(0xe0fb8963, 0x687830d4), TOBN(0x0523b5ce, 0x3df02f42),
+	TOBN(0x95b90a56, 0xd2b29d26), TOBN(0x0a8e71cf, 0xc36b13f5),
+	TOBN(0x93e6c0b5, 0xc941f48b), TOBN(0x91552aab, 0x49ea8aa3),
+	TOBN(0x9a343ec0, 0x47d7d126), TOBN(0x5c110932, 0x2038c3d4),
+	TOBN(0x235e38a1, 0xd8086057), TOBN(0x082520fe, 0xb4dba63d),
+	TOBN(0x9f62ad5e, 0x3c7f80db), TOBN(0xebb92c4b, 0x790f1086),
+	TOBN(0x8d7de006, 0x01ced081), TOBN(0x3314b4f2, 0x1db696b5),
+	TOBN(0xebd1d326, 0x06fbd19b), TOBN(0x7059f9db, 0xeffc888f),
+    },
+    {
+	TOBN(0x0bdf0534, 0x1e5bb78c), TOBN(0x2f6503c5, 0x97953939),
+	TOBN(0x34227d3a, 0x79262dab), TOBN(0xc91cf17b, 0xb120ac89),
+	TOBN(0x8a2edb25, 0x7bae0193), TOBN(0x44955fd3, 0x7af065d4),
+	TOBN(0x55b472b7, 0xe49b943f), TOBN(0x71d419a9, 0xe4e0fbe1),
+	TOBN(0xd090af33, 0x859533d9), TOBN(0xca6d8ff6, 0x0163fe89),
+	TOBN(0x74053aa2, 0x604b40bc), TOBN(0x2c0c9eb4, 0xc139cd61),
+	TOBN(0xbdb42721, 0x37d2ef82), TOBN(0x05ddc2e1, 0x624943e2),
+	TOBN(0x08ec6c1f, 0xa275d039), TOBN(0x551b4849, 0x6b7764f0),
+	TOBN(0xc1f712c6, 0xd0f061a9), TOBN(0x0a476b9c, 0x7be05e85),
+	TOBN(0x2b7214ad, 0xa5653a4c), TOBN(0x151ce39f, 0x86d627eb),
+	TOBN(0x27cd816b, 0x9283e916), TOBN(0x22aa5556, 0x93d51547),
+	TOBN(0x34687d80, 0x8fafa24d), TOBN(0xb8221264, 0x407187a9),
+	TOBN(0x46bc7143, 0xb010c0ae), TOBN(0x104a41fd, 0x69b74c7a),
+	TOBN(0x3ec55abc, 0x78ff01b6), TOBN(0xd7725896, 0xf21e210d),
+	TOBN(0x1afbc00c, 0x039da103), TOBN(0x662969e4, 0x3b6d2d6b),
+	TOBN(0xd7a3a64c, 0x0df7a336), TOBN(0xe0b3f3b7, 0xdff9111f),
+    },
+    {
+	TOBN(0x1ac25934, 0xa4fe5d62), TOBN(0xbb714f43, 0x3663bd07),
+	TOBN(0x2214c4b8, 0x15273557), TOBN(0xcc705617, 0x9dab1384),
+	TOBN(0x063d39aa, 0x332f8e5b), TOBN(0x887ac0a5, 0x8519e154),
+	TOBN(0x46263d87, 0x16f28dc6), TOBN(0xc1342b54, 0xf6119370),
+	TOBN(0x9a16f996, 0x490be33e), TOBN(0xab11e585, 0x7994a8c6),
+	TOBN(0x5c3780ae, 0x48560d29), TOBN(0x172607a7, 0xd48c52af),
+	TOBN(0xb7f242ce, 0xe9ac2e32), TOBN(0x0ba54168, 0x7d26298e),
+	TOBN(0x633ba7c3, 0xd59d7273), TOBN(0xb9fe612d, 0x159120d8),
+	TOBN(0xbce5c0b5, 0x8d488596), TOBN(0xfaf30af0, 0x0e9ed80d),
+	TOBN(0xf09adce8, 0xd2c91978), TOBN(0xb951f107, 0xd1673489),
+	TOBN(0xc744575f, 0x738a425e), TOBN(0xab6763c2, 0xf539b7c3),
+	TOBN(0xb2d2d3c3, 0x8ad32a23), TOBN(0xe2152462, 0x2019e22c),
+	TOBN(0xd9cc7a79, 0x2a9bb93d), TOBN(0x5dc8cb2f, 0x3e3c26f9),
+	TOBN(0x54aff9f2, 0x6e3f73b7), TOBN(0x1687c3cc, 0xf8805e0a),
+	TOBN(0xd706cdd0, 0x1cfe5cc7), TOBN(0x43b6a213, 0xbd6855c0),
+	TOBN(0xabd08541, 0xc1ac9639), TOBN(0xae61612e, 0xbe59cc96),
+    },
+    {
+	TOBN(0x3584b269, 0x49fcbac5), TOBN(0x6170102b, 0xe21acfa5),
+	TOBN(0x2e576357, 0x9154659f), TOBN(0x5f4b62b2, 0x50c0bc23),
+	TOBN(0x2e4ea75d, 0xd107059f), TOBN(0x5b30235a, 0x9ae76fde),
+	TOBN(0xf124f76b, 0x41dd78fd), TOBN(0x9ec9df7d, 0xd414a0dc),
+	TOBN(0x019d94e6, 0x63e0f841), TOBN(0x64af5f02, 0x29113011),
+	TOBN(0x5162cc0e, 0x45ef824e), TOBN(0x8f76e648, 0x38820ef1),
+	TOBN(0x53819247, 0xb2d309a8), TOBN(0x93e525ad, 0x1da8a587),
+	TOBN(0x5d610fde, 0xae161586), TOBN(0xdb227a24, 0x0ecc6e16),
+	TOBN(0xb7cb04b2, 0x792d4c27), TOBN(0xacbdaf8e, 0x305954dd),
+	TOBN(0x329695c0, 0x2947130b), TOBN(0x846b7614, 0x4844c96e),
+	TOBN(0x82895207, 0xf30dcccf), TOBN(0x6282849c, 0x443b821c),
+	TOBN(0x811ff210, 0xb347d580), TOBN(0x74491356, 0xd2e20213),
+	TOBN(0x836dea84, 0x62d85e44), TOBN(0xcbfc7caa, 0xaf3e0ad8),
+	TOBN(0x5815eb6b, 0x4e4ae290), TOBN(0x2b03c8f3, 0xb5ed20f2),
+	TOBN(0x850b4d97, 0xaf94ed1a), TOBN(0xc2a6e19b, 0xf9f48eb0),
+	TOBN(0x8e912fe1, 0x61f06a3d), TOBN(0x5cc2c25d, 0x7cb3992d),
+    },
+    {
+	TOBN(0x71cbfe55, 0xef1013ef), TOBN(0x1b699a71, 0x6fcd55d0),
+	TOBN(0xaa41d91d, 0x931f6a75), TOBN(0x0ef0061e, 0x572a02bb),
+	TOBN(0x2ff1415a, 0xee9a8ec5), TOBN(0xad666e84, 0x582b0d80),
+	TOBN(0x9dfc5eb7, 0xb5fed5de), TOBN(0xaa732e13, 0x56d5e2db),
+	TOBN(0x9732e8ed, 0x4651ef1b), TOBN(0xd82d35b1, 0xfa53f0ef),
+	TOBN(0xe902e0b3, 0x25fa0d5b), TOBN(0x9a0e2194, 0x5dd7fedb),
+	TOBN(0x672be541, 0xd5585a57), TOBN(0xbe02b769, 0x42072129),
+	TOBN(0xd5f32174, 0x43598e41), TOBN(0x7f81a838, 0x7923d2ba),
+	TOBN(0x6ec8eb83, 0x8ddf3a05), TOBN(0xff9c379e, 0xe522d91b),
+	TOBN(0x03650a35, 0x294d44b5), TOBN(0x28e3c4b9, 0x460aa600),
+	TOBN(0xcfadf47c, 0x57f8262a), TOBN(0xeab2a52e, 0xeabe7742),
+	TOBN(0x62432764, 0x176fdd73), TOBN(0x3d89f309, 0xb08e6842),
+	TOBN(0x64fed472, 0x7f39bf91), TOBN(0xa1ab953a, 0x2cfb7547),
+	TOBN(0xd920ece9, 0x8e4df2a5), TOBN(0xfe300cf7, 0xb188843b),
+	TOBN(0x3a698b25, 0xa30e3500), TOBN(0x50a3eb94, 0x3f777fc8),
+	TOBN(0xbf1127b0, 0x10509b84), TOBN(0x1244ab9d, 0xa0d0e240),
+    },
+    {
+	TOBN(0xe397fcab, 0xde2027de), TOBN(0x36d334e2, 0xdf9aaba0),
+	TOBN(0x5483b23b, 0x263ed4ea), TOBN(0x1de00c3c, 0xae540577),
+	TOBN(0x5fe282b5, 0xdd351d8a), TOBN(0x5accdd08, 0xb0561b00),
+	TOBN(0x3bf8bd6f, 0x6bfdabbd), TOBN(0x54e65c26, 0xadabc5b7),
+	TOBN(0x2e65d1da, 0x8ca3de37), TOBN(0xb05a6b63, 0xf4a7e1df),
+	TOBN(0xd205c166, 0x4bf41ab7), TOBN(0x341c4328, 0xbbaffdb7),
+	TOBN(0xce57ca83, 0xaab0b4af), TOBN(0x7c056ed2, 0x840e4252),
+	TOBN(0xabe642e8, 0x86b31c83), TOBN(0xff035070, 0xf247a575),
+	TOBN(0xdd91d707, 0x1bbe740a), TOBN(0xff386f3d, 0xca45b236),
+	TOBN(0x06ca146a, 0x529a896b), TOBN(0x51c78972, 0x8c154c00),
+	TOBN(0x9f5be8f8, 0xaff04c54), TOBN(0xd5654a5d, 0xd57cee85),
+	TOBN(0xc4864ec8, 0x2edfbae7), TOBN(0x7b13e613, 0x611cd084),
+	TOBN(0xc9fda8e4, 0xfe737f22), TOBN(0x43572a74, 0x59f6ea8e),
+	TOBN(0xb241d9d3, 0x1c9be54b), TOBN(0xfc6019ef, 0x63110877),
+	TOBN(0x74d3164b, 0x461c6a01), TOBN(0xa147d728, 0x7eeeff90),
+	TOBN(0x7e224f60, 0x20a13708), TOBN(0x2489573b, 0x41a1c481),
+    },
+    {
+	TOBN(0xb319e5f2, 0x83f20b10), TOBN(0xb834053d, 0x02506073),
+	TOBN(0xfd2c39e0, 0xf8fa7fca), TOBN(0x3cd8f03a, 0x3280034c),
+	TOBN(0x7453ffa8, 0x24613b09), TOBN(0x85ba01ee, 0x7218f013),
+	TOBN(0x384fb6bf, 0x7cf62ea3), TOBN(0x29649dbb, 0x1c318652),
+	TOBN(0x46a92976, 0xed9e36dc), TOBN(0x93ff3329, 0x5535746b),
+	TOBN(0xb5671f8c, 0xa1ff5780), TOBN(0x9905e04b, 0x7b24cd26),
+	TOBN(0x9b3694df, 0x0dc8e20b), TOBN(0xf8cb0550, 0xd90c5fa5),
+	TOBN(0xdb5910f5, 0xbe07d33f), TOBN(0xf22bb0bc, 0xca853817),
+	TOBN(0x7f3545c8, 0x10a4d21d), TOBN(0x49aaeefc, 0xb2b3cc05),
+	TOBN(0x9668b81f, 0xcc309053), TOBN(0xba9d5edb, 0xd873dd04),
+	TOBN(0xe25b3701, 0x27f5df51), TOBN(0x6579d796, 0xb390f919),
+	TOBN(0x678d5b90, 0x3019786e), TOBN(0x747bfa2c, 0x237f6d16),
+	TOBN(0xc22e1f9f, 0x52008ed8), TOBN(0x39f9aa96, 0xbb698cf6),
+	TOBN(0xe5ae65b2, 0xb956b790), TOBN(0x8f52bcb3, 0xe86a8735),
+	TOBN(0x2aa9ace7, 0x79eb5b75), TOBN(0x0efe20bb, 0x682bf7d3),
+	TOBN(0x22521126, 0x1170391d), TOBN(0x18a8ad87, 0x1e1e3599),
+    },
+    {
+	TOBN(0x6633cbe5, 0x07e41620), TOBN(0x70680a7a, 0x04a0c0e7),
+	TOBN(0xfa5873c1, 0xf1f4ff95), TOBN(0x79b1e074, 0x65000699),
+	TOBN(0xe8a7ff50, 0x48c27612), TOBN(0x0b7403dc, 0xe431e026),
+	TOBN(0x709f6d7e, 0xf9ec5d47), TOBN(0x52c93b76, 0x38630ca4),
+	TOBN(0x8d5252ed, 0xdb3c6db8), TOBN(0x27fe6652, 0xaa6ae8d6),
+	TOBN(0x6ace3f19, 0x43feaf01), TOBN(0x320bc096, 0xf6499a4d),
+	TOBN(0x366d29be, 0x1b91c417), TOBN(0xf1960aa1, 0xb218bf4b),
+	TOBN(0xb6b221eb, 0x7c0fa67f), TOBN(0xe4576179, 0x950a702f),
+	TOBN(0xfe6a8b90, 0x2149a43b), TOBN(0x9355ddf9, 0x6567980a),
+	TOBN(0x2cd1703f, 0x986120a6), TOBN(0x753abdb7, 0xb0e7ba09),
+	TOBN(0xc4b66e02, 0x4febbea3), TOBN(0xcaf3af2d, 0x6721f233),
+	TOBN(0xcf1ab720, 0x6032f0dc), TOBN(0xe8f7f458, 0x46feda2c),
+	TOBN(0x845c3f3e, 0xa4011db0), TOBN(0x73f3552d, 0x76d319ed),
+	TOBN(0xcb5ccb65, 0x72ad6f20), TOBN(0x1ea57967, 0xd0d50e6b),
+	TOBN(0x555359ce, 0xf3d6b6eb), TOBN(0x1dfc4176, 0xd057efa6),
+	TOBN(0x44a4224c, 0x22e0723a), TOBN(0x31515b0e, 0x3c3c6b32),
+    },
+    {
+	TOBN(0x20e481c1, 0xd0bd3906), TOBN(0x4bce2cbf, 0xf229c621),
+	TOBN(0x21e97ed0, 0xe0237ceb), TOBN(0xfa77cf65, 0x41a97635),
+	TOBN(0x3dec2039, 0xf58c6f6e), TOBN(0x51a5ea60, 0xb94e8576),
+	TOBN(0xd52cf209, 0xd4402532), TOBN(0xd056358c, 0x2ff37605),
+	TOBN(0xe52d410c, 0x9e81bb55), TOBN(0x5813175f, 0xc393d9e4),
+	TOBN(0xa16056d3, 0x21136c8c), TOBN(0xae023fef, 0x7b8285a6),
+	TOBN(0xe9d971c8, 0xc57aecbe), TOBN(0xd4d11d8b, 0xe2875de5),
+	TOBN(0x8e6aa18c, 0x3c830638), TOBN(0x769288ee, 0x8c1a6ef5),
+	TOBN(0xd98de38f, 0x8d1651c5), TOBN(0xc747189c, 0x40888ba0),
+	TOBN(0xc5dc3d82, 0x5c51de56), TOBN(0x910b928b, 0x66704927),
+	TOBN(0x38c4c911, 0xd2eb7811), TOBN(0xa2cdecd0, 0xfc3ae170),
+	TOBN(0x58745190, 0x62917f85), TOBN(0x3419949d, 0x16fde56e),
+	TOBN(0x8c04d8ae, 0x49496005), TOBN(0xab3d69e2, 0x4dbb51ba),
+	TOBN(0x8686ec6c, 0xb5d28c49), TOBN(0x7a477bbf, 0x85192741),
+	TOBN(0x7298e928, 0xd0c47a10), TOBN(0xfb5f2060, 0x6b3d1f8c),
+	TOBN(0x21316e3f, 0xfe0ca429), TOBN(0x099726fe, 0x624f592d),
+    },
+    {
+	TOBN(0x41c90383, 0xa17a720c), TOBN(0x979c597f, 0xe4538c42),
+	TOBN(0x43d2fda1, 0xc046f9d6), TOBN(0xf4ef9eca, 0x8352ec6a),
+	TOBN(0x7bd84073, 0xeb18dedd), TOBN(0xa34bd4c1, 0x729d0aec),
+	TOBN(0xaa59e413, 0xa8804a64), TOBN(0xa0ac6b18, 0x5fe6ec0b),
+	TOBN(0xca5a8219, 0x3d0376ab), TOBN(0xb0262ebf, 0x8727b3c9),
+	TOBN(0x42c0ada6, 0x4226d918), TOBN(0x5c047fde, 0xf7050b4d),
+	TOBN(0xd3b2e391, 0x8af5d97d), TOBN(0xa9a23b17, 0xc50ebbcb),
+	TOBN(0x1cd54318, 0x79060c71), TOBN(0xed2511dd, 0x1834ddeb),
+	TOBN(0xb31bc71f, 0x1a2ca38a), TOBN(0x8e8e3138, 0x81111741),
+	TOBN(0x8bb87b04, 0xb8a3bcad), TOBN(0x22172516, 0xcce0924f),
+	TOBN(0x71899223, 0xa5d6f023), TOBN(0x459bd9a1, 0xf875c2e0),
+	TOBN(0xb0e8a320, 0xc522ff0b), TOBN(0x6833293a, 0x2dfbcadc),
+	TOBN(0x1809b15c, 0x9292c00a), TOBN(0x567ad3c4, 0x9b76a375),
+	TOBN(0x0d0dd8d9, 0x6ba51893), TOBN(0xf48ef77f, 0x0a324e83),
+	TOBN(0xe531d251, 0xa188f420), TOBN(0xf6be40c0, 0xd67a3f18),
+	TOBN(0x4262dc7f, 0xfc194853), TOBN(0x132e4dfc, 0xc49eb25a),
+    },
+    {
+	TOBN(0xd1ab91fa, 0xbd8a210b), TOBN(0x89e01c1a, 0x40b33692),
+	TOBN(0x65be4823, 0x87329b18), TOBN(0x0eb30b39, 0xec3114ff),
+	TOBN(0x655d3c32, 0xc93cb596), TOBN(0x14aacc87, 0xc12448a1),
+	TOBN(0x03ace911, 0x56335315), TOBN(0x54860905, 0x1d950dd4),
+	TOBN(0xd08907ff, 0x55eceba6), TOBN(0x54a379aa, 0xcf31127c),
+	TOBN(0x38e4ff96, 0x672d8417), TOBN(0x7e0c378d, 0x1469b242),
+	TOBN(0xbaa4f1af, 0x345e8fc0), TOBN(0xed20d699, 0x2e67179a),
+	TOBN(0xdad56a37, 0x1e28476f), TOBN(0xfecde05a, 0x8276d6f2),
+	TOBN(0xbd517f7d, 0x67a31965), TOBN(0x789976c1, 0x57aeb17e),
+	TOBN(0xa673fb73, 0x7a3e50ef), TOBN(0xbb05c21b, 0xc82ad8b5),
+	TOBN(0x2452a606, 0xc89276a4), TOBN(0x80dcf573, 0xd44153fe),
+	TOBN(0x96c50497, 0x937d5d69), TOBN(0xb3e0dff1, 0x1633c578),
+	TOBN(0x063bbe08, 0x003b4750), TOBN(0x0dd12974, 0x3d60b464),
+	TOBN(0x8fc4c3c2, 0x0cb679e7), TOBN(0x03f0ebda, 0x0586e358),
+	TOBN(0x3c04188b, 0x77933078), TOBN(0xccf43eaa, 0xc89e8977),
+	TOBN(0xec75d770, 0xd8bc2763), TOBN(0xa7f58343, 0xe6ae4531),
+    },
+    {
+	TOBN(0xa35723f5, 0x7b144217), TOBN(0xfe4da9d9, 0xf6b9c2bc),
+	TOBN(0xb5aa6a2e, 0x756b3120), TOBN(0xe3d0ccf6, 0xedccbf19),
+	TOBN(0xec8eac6e, 0xfd215413), TOBN(0x73903b1f, 0x12fc3e78),
+	TOBN(0x6c324e7f, 0xc05f039a), TOBN(0xc56d9ade, 0x231b95a4),
+	TOBN(0x6e81b1b8, 0x7da30910), TOBN(0xb7d2874c, 0xd44a037d),
+	TOBN(0x0abdc9de, 0x839e7029), TOBN(0x5d434612, 0xb83cce17),
+	TOBN(0x58e6f008, 0x4837ccc5), TOBN(0x56dc500e, 0x802a819f),
+	TOBN(0x4c9494c5, 0x3f2bbf80), TOBN(0x64c1787e, 0xe897da4b),
+	TOBN(0xb8a28242, 0x2de273c6), TOBN(0xa80a8730, 0xc27907bf),
+	TOBN(0x9e48d2d5, 0x783181f8), TOBN(0x87d3183c, 0x35cc11c5),
+	TOBN(0x3ca5ef56, 0x9d1e355b), TOBN(0x0d6da7fe, 0x024aba91),
+	TOBN(0x490453b8, 0xc49c3c0c), TOBN(0x17e08a74, 0xbf15c8ab),
+	TOBN(0xdc4c71a2, 0x0e177a6a), TOBN(0x2c0d3934, 0xad8725ac),
+	TOBN(0xce3f7f0a, 0x8b38eef0), TOBN(0x05d6190d, 0xcffa2b8e),
+	TOBN(0x4f05e30e, 0x64be947c), TOBN(0xd5221aca, 0x1060f61d),
+	TOBN(0x0fdbd43f, 0x900f8c92), TOBN(0x4feb0687, 0xcd5c8a64),
+    },
+    {
+	TOBN(0x3f8e6978, 0x9be38739), TOBN(0x9aac56a9, 0x6b52c05a),
+	TOBN(0x75a08d9e, 0x911dcfb3), TOBN(0x353903af, 0xcf47c174),
+	TOBN(0xcb65b756, 0x49ca98a8), TOBN(0x62bd030b, 0x87cb4b88),
+	TOBN(0x2ec1ce2b, 0xef02abfc), TOBN(0x357cad8b, 0x13fa8e1e),
+	TOBN(0xdc3daf1a, 0x79d84a6d), TOBN(0x22531adc, 0x033e9815),
+	TOBN(0xf9aff936, 0x773854ed), TOBN(0x1c3e7654, 0x015734e9),
+	TOBN(0x7e3dbadd, 0x089a46e9), TOBN(0x0bbe9749, 0xd2c694b7),
+	TOBN(0xf6eba710, 0x34e0c99c), TOBN(0x96db77e8, 0xd232bf8d),
+	TOBN(0x3f36f131, 0x304922da), TOBN(0xb98e31bd, 0x005eb3df),
+	TOBN(0xb41e9037, 0xccf2f395), TOBN(0xe7b2b3e3, 0xfb30e386),
+	TOBN(0x34cb7b69, 0x38cc723b), TOBN(0xf8a48bb6, 0x996945a0),
+	TOBN(0x9a5872c6, 0x3bdb4e72), TOBN(0x307ce266, 0x66ec1c3c),
+	TOBN(0xf2f2824c, 0x70d7fa87), TOBN(0xb12a34a6, 0xc9ff29ef),
+	TOBN(0xaeddd123, 0x9ce38266), TOBN(0x8fd9a43e, 0x9e4a582a),
+	TOBN(0xae009cdb, 0x2653d6c6), TOBN(0xff18fd15, 0x86aa67fe),
+	TOBN(0xa093b5a5, 0x347890bb), TOBN(0x76edfc12, 0x9499119c),
+    },
+    {
+	TOBN(0x7f1cd2f1, 0x37c70e72), TOBN(0x3558ad52, 0xd6a580b4),
+	TOBN(0xeb411b3d, 0x223b9f67), TOBN(0x6a72075f, 0x9e8f82e8),
+	TOBN(0x96cb6eac, 0x93953150), TOBN(0xc57a0617, 0x0f969711),
+	TOBN(0x5d839c57, 0xde0557f8), TOBN(0x6af95b16, 0x27f51c3c),
+	TOBN(0xb87b5e34, 0xf3b094da), TOBN(0x44a635b8, 0x067d302b),
+	TOBN(0xf35ff26c, 0xee70a9da), TOBN(0x387ceca8, 0x02ae69d3),
+	TOBN(0xfc7b75ba, 0x11348dd2), TOBN(0x177d2e93, 0xa58d296e),
+	TOBN(0xedd74e20, 0x69c19338), TOBN(0x2db6efd1, 0xa4657f1b),
+	TOBN(0x7e6de262, 0x609245b5), TOBN(0x731c637a, 0x00bd67be),
+	TOBN(0x683d206f, 0x99e5e72b), TOBN(0xcf6567c7, 0xf661c70d),
+	TOBN(0x6996f6d2, 0x7198e477), TOBN(0xf149176d, 0x32d28b40),
+	TOBN(0x34b0e58c, 0x77b69ce5), TOBN(0x60f9c4cc, 0xcdd83879),
+	TOBN(0xe5e50498, 0xe1aff50e), TOBN(0x6254694d, 0x93fe53df),
+	TOBN(0x5dbba247, 0x39c704cd), TOBN(0x1fb3487d, 0x3c94b055),
+	TOBN(0x5c0139b6, 0x4ca7ad8d), TOBN(0xfe31fa2b, 0x0d54cffd),
+	TOBN(0x41276b4a, 0x68f12177), TOBN(0xeddbf825, 0x29322339),
+    },
+    {
+	TOBN(0x213f813c, 0x25817271), TOBN(0x9f598471, 0x4509eb15),
+	TOBN(0x265663c6, 0x2c9a8f00), TOBN(0x64df3f69, 0xdfc63c17),
+	TOBN(0xbce0c802, 0x62450f78), TOBN(0x94c41581, 0x019ab726),
+	TOBN(0x6ad525ec, 0x24042f7a), TOBN(0x4bc37049, 0xf1f41638),
+	TOBN(0x9b485acc, 0x3f97aadb), TOBN(0xd5c2aee8, 0x721a7ae0),
+	TOBN(0xe6471e82, 0x4523c9ca), TOBN(0xe5c32ad0, 0xa3b919c7),
+	TOBN(0xeb3a97e7, 0x83886e59), TOBN(0x4879cf0b, 0x041592d7),
+	TOBN(0xcf54fe0b, 0xf4157063), TOBN(0x47d88ea0, 0xc4887352),
+	TOBN(0x84180309, 0x0aa834c6), TOBN(0x1e3ae8d7, 0x54ca439f),
+	TOBN(0x201aa6ff, 0xc3de8f37), TOBN(0xd08e9cfc, 0x4cfc7561),
+	TOBN(0xea264011, 0xb57dbc3a), TOBN(0x131f08c2, 0xb682ade0),
+	TOBN(0x99ed3b6d, 0xad9f8209), TOBN(0xc41f6f16, 0xed105bc7),
+	TOBN(0x380fc10b, 0x87e83624), TOBN(0x79b9a606, 0xe4f9e0f1),
+	TOBN(0x6fffc93c, 0x4f280077), TOBN(0x77b1c758, 0xbe86c279),
+	TOBN(0x963c3074, 0xdd6091cc), TOBN(0x26cce07d, 0x779972f4),
+	TOBN(0x359700b4, 0xbfc16f2d), TOBN(0x34bcd02b, 0xa1405988),
+    },
+    {
+	TOBN(0x427f0278, 0x4b02e4e2), TOBN(0x3eb308e2, 0x8a13d62a),
+	TOBN(0x4cacc78c, 0x59351e01), TOBN(0xc9be7ed3, 0xbf8c782e),
+	TOBN(0x79c19004, 0xc48a1ef0), TOBN(0x29882b02, 0x03356e4d),
+	TOBN(0xd5aa4bd8, 0x48085ef5), TOBN(0x9786e093, 0xe3e82c70),
+	TOBN(0x3690b598, 0x7f2f55b6), TOBN(0xab855dd0, 0xe434f5c1),
+	TOBN(0xcc8e3d04, 0x8a479395), TOBN(0xcb8655a1, 0x4772338f),
+	TOBN(0xd6752fcf, 0x0710dcb3), TOBN(0x90f39e16, 0x082b25af),
+	TOBN(0x9ea9fc17, 0xe82ae0c6), TOBN(0x8fb11d41, 0x8910e6a5),
+	TOBN(0x08300612, 0x1550698c), TOBN(0x3c75d1ae, 0xa994873f),
+	TOBN(0x40354dff, 0x87bd1e6e), TOBN(0xa11d39f8, 0x99f8eac2),
+	TOBN(0xd44c8023, 0x6afb7875), TOBN(0x263e1185, 0x6d055bc1),
+	TOBN(0x33da76db, 0x5b3f0412), TOBN(0x883ede2d, 0xda20b78f),
+	TOBN(0x701f8217, 0x0fd06c49), TOBN(0xf3734c0d, 0xc9f3c1e2),
+	TOBN(0xdfff9278, 0x9e5000ee), TOBN(0xef638eb1, 0x7d0d84f2),
+	TOBN(0x2c7860e9, 0xbac12398), TOBN(0x4d99c0fa, 0xef32e5e9),
+	TOBN(0x6b2e0169, 0x7f82de5a), TOBN(0x6979a057, 0x4280b310),
+    },
+    {
+	TOBN(0xa857026b, 0x8c51a82b), TOBN(0x00863bba, 0x02effe34),
+	TOBN(0x32ea37d1, 0x3ea16ea4), TOBN(0x27b49d6b, 0xafec68ad),
+	TOBN(0x503ca4b7, 0x18aebd75), TOBN(0x529be04d, 0x1b570dea),
+	TOBN(0xbdcf0791, 0x99df0ecf), TOBN(0x8c6e3fb4, 0xe47aef6e),
+	TOBN(0x3bfa9c6d, 0xbf150802), TOBN(0xba785dab, 0x20287968),
+	TOBN(0x48ab98e9, 0xbb0a89a5), TOBN(0xdbe43a90, 0x77151272),
+	TOBN(0x8261fabc, 0x6c270ab4), TOBN(0x64f69680, 0x60c0db35),
+	TOBN(0x1c1c25d5, 0x7bcc17e0), TOBN(0x63317701, 0xe8899df2),
+	TOBN(0xad06cdce, 0x950b234e), TOBN(0x78da39db, 0x7396f75a),
+	TOBN(0xdb8f85d6, 0x625524ca), TOBN(0x9cb994b2, 0x99d1e953),
+	TOBN(0x5c7f7e0a, 0x21a5765c), TOBN(0x1accd382, 0xdd1af5eb),
+	TOBN(0xfb6fe2b4, 0x1285e54c), TOBN(0xc8fcb7c1, 0xd05fe7fb),
+	TOBN(0x28c4e231, 0x9c937524), TOBN(0x3dbc7339, 0x2a8ffe8d),
+	TOBN(0xcd550309, 0x854a49d0), TOBN(0xdd55c15a, 0xd00eae0e),
+	TOBN(0x632fce64, 0xf21da384), TOBN(0x2e79de09, 0x19243412),
+	TOBN(0x5b5e34ff, 0xbe854d37), TOBN(0xea4a85b4, 0x145a058e),
+    },
+    {
+	TOBN(0x50ae04d7, 0x18a35057), TOBN(0xeb99e919, 0x7b335200),
+	TOBN(0x50024989, 0xe448d837), TOBN(0x15d3f15a, 0x75436675),
+	TOBN(0xc24d7d77, 0x9c0563d2), TOBN(0xef7262a9, 0xc761c90a),
+	TOBN(0xe0768b80, 0x47b67b0e), TOBN(0x353e083d, 0xb0e758d9),
+	TOBN(0x4564da95, 0x4ff341c9), TOBN(0x837c4f4d, 0x7638d154),
+	TOBN(0x2a4afc85, 0x2b587b46), TOBN(0x18f34c19, 0x7d938e77),
+	TOBN(0xe8610222, 0xb7c8c2ae), TOBN(0x4687cfdc, 0xe4de08d4),
+	TOBN(0xcf220c01, 0xfa736061), TOBN(0x2d88a5cd, 0xb4bd6849),
+	TOBN(0x980d1ee4, 0x88b28797), TOBN(0xa88c0d64, 0xfa499377),
+	TOBN(0x087fe79b, 0x485f29ae), TOBN(0x4b3abd69, 0xd91a3302),
+	TOBN(0xacff9f5d, 0x4f4434cb), TOBN(0x414d641c, 0x13fdfe6b),
+	TOBN(0x125a0ff1, 0xc2ad4bd1), TOBN(0x42183a16, 0x336e0db2),
+	TOBN(0x215eb9f5, 0x46c7d612), TOBN(0x8be3ccbe, 0x87e5b9ff),
+	TOBN(0x495ffd99, 0x7c608ec2), TOBN(0xb89fc40f, 0x6509c0fb),
+	TOBN(0x9d5d4ec1, 0x59d37a95), TOBN(0x982d5986, 0xb16c4b53),
+	TOBN(0xedac8f5d, 0x5ba1d839), TOBN(0xd4950b68, 0x28b40b1c),
+    },
+    {
+	TOBN(0xc4509671, 0xe681115e), TOBN(0x4c61148d, 0x6abad146),
+	TOBN(0x64441f91, 0x7ac452ae), TOBN(0xfbd8f05c, 0xad930433),
+	TOBN(0x4c2acc74, 0xaf077f5f), TOBN(0x0735a9eb, 0x40053a8c),
+	TOBN(0x9131e24c, 0xd45ec129), TOBN(0x0bddf744, 0xe26b63bc),
+	TOBN(0xfafc882d, 0x689aae66), TOBN(0x5b3bd463, 0x0e867a0d),
+	TOBN(0x136d0690, 0xeafa3c48), TOBN(0xfbeb3eae, 0x57002118),
+	TOBN(0x9524f6fe, 0xc4fda160), TOBN(0x2f19dfcf, 0xaf0e8be2),
+	TOBN(0x472b2cd7, 0x691eab65), TOBN(0x2f063c4d, 0x99b51b7c),
+	TOBN(0xb6bc6c9c, 0x8183a6ae), TOBN(0x0bfca498, 0x6eddd880),
+	TOBN(0x31d324f8, 0xd7c9bf0d), TOBN(0xa66203ff, 0x5d5c4ee7),
+	TOBN(0xdfdc0e32, 0x4affc847), TOBN(0x42b7d2be, 0x7e0d098a),
+	TOBN(0xc96d52aa, 0x009a4911), TOBN(0xe849552c, 0xf04630c9),
+	TOBN(0xa200d721, 0xc6b359cb), TOBN(0xaa08b0c1, 0xddb4fc79),
+	TOBN(0x30e70c8f, 0x2831b73f), TOBN(0x3ce647c8, 0x3fea6170),
+	TOBN(0x96689ccf, 0x5aa049a4), TOBN(0x257d0958, 0xcfdb10e5),
+	TOBN(0x098e7875, 0xe4fe1a99), TOBN(0xd1c5fa3e, 0xd21b3ca8),
+    },
+    {
+	TOBN(0x88a12ce3, 0xcd0222bd), TOBN(0x834f9ac0, 0x4ac8f824),
+	TOBN(0xb2b6190a, 0x5c8ea04c), TOBN(0xbe1c973c, 0x70909d81),
+	TOBN(0xba29ccf2, 0xc8b6e7a7), TOBN(0x58a5f5e6, 0x10be224e),
+	TOBN(0x873c40f6, 0xbcb5dfc2), TOBN(0x341d775d, 0xacc84175),
+	TOBN(0xc368b214, 0xa2fe8e90), TOBN(0xc5033cbd, 0x52f4d29f),
+	TOBN(0xbfcdd7d3, 0x8b37e08b), TOBN(0x59015455, 0x3d69abc2),
+	TOBN(0x0de6faa7, 0x6975f006), TOBN(0xdace627b, 0x81796a2f),
+	TOBN(0x25401a05, 0xd518876a), TOBN(0xc5323065, 0x1714635e),
+	TOBN(0xab785c80, 0x61a38e56), TOBN(0xced0e2de, 0xf0d755c3),
+	TOBN(0xb50725e0, 0x33485e33), TOBN(0x5e8b9c03, 0x602efe28),
+	TOBN(0xb3b8bfad, 0xa1f8d8a1), TOBN(0x91236293, 0x55e225aa),
+	TOBN(0xae54efdd, 0x9ed6135b), TOBN(0x80b174ec, 0x733a9f4d),
+	TOBN(0x13d6a3d5, 0x9b079f60), TOBN(0x647c47cf, 0xee2fb5d8),
+	TOBN(0x108410a4, 0xc22f69a1), TOBN(0x77c0d0ea, 0x44c127be),
+	TOBN(0x03ceeb96, 0x2ad8c6d4), TOBN(0x8633b026, 0x1eda04fa),
+	TOBN(0x4a0d1649, 0xa89372fd), TOBN(0xa38bf47d, 0xa4367950),
+    },
+    {
+	TOBN(0xb0ca7478, 0x9f63fa75), TOBN(0xa80d3648, 0x53aa8a2c),
+	TOBN(0x7a8ae00d, 0x9fae57be), TOBN(0x6edf681d, 0xe2ba6fc4),
+	TOBN(0x087ab7c2, 0x1ecf8f23), TOBN(0x83129727, 0x0c45c1ee),
+	TOBN(0x10555217, 0x70027c3f), TOBN(0x545dafec, 0x092164b6),
+	TOBN(0xac503b49, 0xadb9214b), TOBN(0x1673e424, 0x8c4d642c),
+	TOBN(0xb0f499de, 0xfcb8d22a), TOBN(0x245bd17d, 0x7e2a5da5),
+	TOBN(0x6c076528, 0xdc983c40), TOBN(0x2003e563, 0x5d592965),
+	TOBN(0x49706d50, 0x63846fc7), TOBN(0x976c2ee8, 0xaacd03f9),
+	TOBN(0xd8319bb6, 0xf2e7004e), TOBN(0x0a0c9cdb, 0xf7afe282),
+	TOBN(0xdbd23fa4, 0x64058ced), TOBN(0x12fbe9f5, 0x4b3a8f0c),
+	TOBN(0xc1fb9e6c, 0x53901754), TOBN(0x6afc0f4c, 0x8255c242),
+	TOBN(0x59f057b5, 0x9e24078d), TOBN(0x51995428, 0xf188b8f1),
+	TOBN(0x797b17d5, 0xd1d6d095), TOBN(0x2145a03d, 0x43fb8e3c),
+	TOBN(0x3d8e783f, 0xb1068a23), TOBN(0x8daac3e6, 0x45243dd2),
+	TOBN(0x6544b314, 0xdc32727b), TOBN(0x6cc1130e, 0x8078903a),
+	TOBN(0xa6afbe42, 0xf98799d5), TOBN(0x4cbd7934, 0x27600683),
+    },
+    {
+	TOBN(0x6194e8f1, 0x3ec7f4ea), TOBN(0x501a6c90, 0xa7551459),
+	TOBN(0xf515c01b, 0x3f5caf7d), TOBN(0xddbed03b, 0xc574df88),
+	TOBN(0x10f56f84, 0x3d9f1e46), TOBN(0x06252e4e, 0x188b83dc),
+	TOBN(0x20aaa42e, 0xe004f87f), TOBN(0xa8bb5fd8, 0x1242c96c),
+	TOBN(0x58a07693, 0x5b724296), TOBN(0x2ce7c849, 0x189ac859),
+	TOBN(0x61e933bd, 0xf971a454), TOBN(0x48b7a2fa, 0xfc54bb4b),
+	TOBN(0xd80eca51, 0xb9307880), TOBN(0x4007cac6, 0xbab252ca),
+	TOBN(0x92e0daa0, 0xc708df8e), TOBN(0x2ed85dd1, 0x559a07f2),
+	TOBN(0xb063376d, 0xe5ce009d), TOBN(0x141939b7, 0xef5fc505),
+	TOBN(0xb7a47f48, 0xc80b19da), TOBN(0x25f7d3ea, 0x96751e19),
+	TOBN(0x83f73cd8, 0xa7202ea8), TOBN(0xd5f81e99, 0x04ab8485),
+	TOBN(0xb3e0af6b, 0x3c480f1a), TOBN(0xa332a851, 0xe31171e2),
+	TOBN(0xf2f62fab, 0xa3ada12a), TOBN(0x428b407a, 0x87f71c78),
+	TOBN(0x7b1cf07f, 0x620d1446), TOBN(0x1b5587cc, 0x8a487ba4),
+	TOBN(0xca896629, 0xb864e4f7), TOBN(0xd982261d, 0x00f12074),
+	TOBN(0x4d5f7c85, 0xf30f33aa), TOBN(0x997af268, 0x4ec00d07),
+    },
+    {
+	TOBN(0x1a1e211b, 0x9d162de1), TOBN(0x92bbf04f, 0xfca7141a),
+	TOBN(0x377840d3, 0x18632ad8), TOBN(0x9af629cf, 0xb63bc4e2),
+	TOBN(0x31f58f2c, 0x7adec1d6), TOBN(0x0851c55b, 0x1056faa7),
+	TOBN(0x46c846e1, 0x75ec51a4), TOBN(0x476628f9, 0x86b637f1),
+	TOBN(0x95faa74c, 0x14ff6b8e), TOBN(0xc08e4898, 0x652d6747),
+	TOBN(0x95c6e037, 0x12627c44), TOBN(0x182997b0, 0x8b01650d),
+	TOBN(0x82d25930, 0xb15bc3da), TOBN(0x0ba62606, 0xde6d503b),
+	TOBN(0x2e40ced8, 0x309dcce7), TOBN(0x7850b4b5, 0xc034e8d0),
+	TOBN(0x06947c06, 0x512d0843), TOBN(0x3df902c6, 0x3a4f9e58),
+	TOBN(0xf8adf88c, 0x6f8ca9ec), TOBN(0x3011ed4f, 0xc4fca61a),
+	TOBN(0xb9ede057, 0xb867a8e2), TOBN(0xeddf2779, 0xd9225f65),
+	TOBN(0xf15c6b91, 0xd566fb40), TOBN(0x2b1c6205, 0x570b291d),
+	TOBN(0xd4883793, 0x92ec9a17), TOBN(0xec25909e, 0xe8ae711f),
+	TOBN(0x931ce6f9, 0xb71f813d), TOBN(0xde0d2136, 0xca96a08c),
+	TOBN(0x16031b09, 0x5e1842db), TOBN(0xa3fd211f, 0x26df74b5),
+	TOBN(0x719deecf, 0xee7f560d), TOBN(0x5dc3b4c9, 0x29c9307d),
+    },
+    {
+	TOBN(0x343c4237, 0x3a2c5bc2), TOBN(0x2577e09f, 0xf94e2834),
+	TOBN(0x6ef081a6, 0x30c655b1), TOBN(0x35ec539f, 0x6c7789c4),
+	TOBN(0x63eb1e58, 0xf5bd83ad), TOBN(0x10a38ab6, 0x20adf54e),
+	TOBN(0x8d908dc2, 0xebd8a348), TOBN(0x8ecc51f3, 0x0d6c6fe2),
+	TOBN(0x2bf54e98, 0x29fed71c), TOBN(0x811c9130, 0xca5ace8f),
+	TOBN(0x2b8dc06e, 0x24c4f889), TOBN(0x30532f61, 0x1602ca1b),
+	TOBN(0x05a4b261, 0x62b787b4), TOBN(0x174c4c0d, 0xbcdaa077),
+	TOBN(0x5c819db0, 0x613b99ce), TOBN(0xf0a1696b, 0x8069d1a0),
+	TOBN(0x0d28f80c, 0xa25a1086), TOBN(0x7bf2058c, 0x749f3cb0),
+	TOBN(0xf15bf118, 0xdf1953d8), TOBN(0x6023da9f, 0x89f94c35),
+	TOBN(0x73dbc0af, 0x70cf51c4), TOBN(0xdbbe4ef3, 0xb244becb),
+	TOBN(0xe2b8d723, 0xaacdf681), TOBN(0x5638c40a, 0xae16523b),
+	TOBN(0xa9106f27, 0x25d9342e), TOBN(0xd84b213d, 0xd15ce23f),
+	TOBN(0x2639cdf3, 0x6e3f027b), TOBN(0xbc1a426d, 0x952d4119),
+	TOBN(0x2c063612, 0xbc3085b7), TOBN(0x47fa423e, 0x4dbee96a),
+	TOBN(0xe33bdd9f, 0xdcfeac1b), TOBN(0xbb876992, 0x539260fa),
+    },
+    {
+	TOBN(0xb5ceed37, 0xbf85cb64), TOBN(0x1c79c0a6, 0xd2dc34f5),
+	TOBN(0x4d453b36, 0x4371a0c0), TOBN(0xc4e90417, 0xf3382a7c),
+	TOBN(0x950d4637, 0xb3c3818a), TOBN(0xd182299d, 0x510e2ced),
+	TOBN(0x6875964c, 0xd290bc0b), TOBN(0xad0b14b2, 0xa8217805),
+	TOBN(0x0db0f865, 0x2c25f7a3), TOBN(0x9ce77cab, 0xc9af9605),
+	TOBN(0xece6492e, 0xa50764b0), TOBN(0x5602440d, 0xf75019b7),
+	TOBN(0xb2c49d84, 0x225d903d), TOBN(0xea681b7a, 0x06bb571e),
+	TOBN(0xf285ecac, 0x95c0c19c), TOBN(0xeb9a5206, 0x4aff3509),
+	TOBN(0x9f10064c, 0x6151b89c), TOBN(0x2677916b, 0xe82447cb),
+	TOBN(0x881dc3bf, 0x0a300602), TOBN(0x2da1c3be, 0xf667ed86),
+	TOBN(0x887476c9, 0x44f02290), TOBN(0x1d9ea829, 0x4458e230),
+	TOBN(0xb428ad6a, 0x45d2b715), TOBN(0x5d26ff4a, 0x7ddb8342),
+	TOBN(0xfe194265, 0x5c8844fc), TOBN(0x6c8e1c20, 0x6914abe2),
+	TOBN(0xa28f5591, 0xd8be1f62), TOBN(0xa8319ef1, 0x5892af95),
+	TOBN(0x95ccb821, 0x45cdcefd), TOBN(0x21931564, 0x47bb45e5),
+	TOBN(0xb7af04c9, 0x8e73e5fc), TOBN(0xfa9e2246, 0xc97e3c17),
+    },
+    {
+	TOBN(0x6b9dda6f, 0x7f0b96c9), TOBN(0x2380f2f3, 0x1b0bbf82),
+	TOBN(0x84b85053, 0xede93c70), TOBN(0x503cbeb2, 0xfbdaea13),
+	TOBN(0x4beec078, 0xd22eebfd), TOBN(0xed3ef54a, 0x32d00711),
+	TOBN(0x35c3a8f6, 0xb919d587), TOBN(0x7677b239, 0x38346a07),
+	TOBN(0xe8d19284, 0x2a15210b), TOBN(0x485a8d4e, 0xc9470a8d),
+	TOBN(0x72c05d0e, 0xff52315c), TOBN(0x0d2f5f14, 0x7e099d02),
+	TOBN(0x492647b2, 0x2435cdbf), TOBN(0x516ad9d0, 0x30d300a7),
+	TOBN(0x7bf599b0, 0x2e5cb3da), TOBN(0x3e5a5bd6, 0x79a89679),
+	TOBN(0x7c1f8fe0, 0x213fb234), TOBN(0x03c6bc85, 0xe3643459),
+	TOBN(0x619c636c, 0x9814ec1e), TOBN(0x6d0b1b82, 0x92463b67),
+	TOBN(0x04e990db, 0x95d98d32), TOBN(0x46f10d68, 0xe279d6f6),
+	TOBN(0x83cba55e, 0x2946ef63), TOBN(0x6a6cc927, 0x8e65443f),
+	TOBN(0xcc077a5c, 0xc6b175c1), TOBN(0xe9871e8d, 0x04ef14aa),
+	TOBN(0xf3d4a2aa, 0x234839e6), TOBN(0x4e577f3c, 0x7611c408),
+	TOBN(0x0297223a, 0x0133d187), TOBN(0x7e5fc83d, 0x0e9a6efa),
+	TOBN(0xa64e2ef0, 0xfb7f09c3), TOBN(0xf53c448d, 0x92fc782f),
+    },
+    {
+	TOBN(0x3c40a716, 0x0b33c7cf), TOBN(0x1ce48c01, 0xb3c913fe),
+	TOBN(0xbda90890, 0xbe507845), TOBN(0x29b6113a, 0x4fb9af18),
+	TOBN(0xac67514b, 0xe91115ff), TOBN(0x4d66520e, 0x8199672c),
+	TOBN(0x2aae0133, 0x6b7ddbc5), TOBN(0x73806416, 0x6e2cd0a5),
+	TOBN(0x575b6152, 0x10b9506d), TOBN(0xc9ecf50b, 0xc5396bb1),
+	TOBN(0xd6236b42, 0x156951f1), TOBN(0x0600cd8d, 0x2a94cb3f),
+	TOBN(0xe79efcd6, 0x3d3ebf45), TOBN(0xf2357a67, 0xa0f5c90a),
+	TOBN(0x10d7e841, 0x502abefd), TOBN(0x2c0f3f24, 0x90d339c8),
+	TOBN(0x623a567e, 0x7f978e20), TOBN(0xaed001aa, 0x723ee44d),
+	TOBN(0x9ef45d86, 0x0f33facd), TOBN(0x32dd9f2b, 0xfbe8d41f),
+	TOBN(0xe488b657, 0xbac77ed8), TOBN(0x81866de4, 0xa78ec55a),
+	TOBN(0xbfde5c87, 0xf43096d3), TOBN(0x331dac8d, 0x6bd6c0d5),
+	TOBN(0x6122bb6e, 0x203f863a), TOBN(0x6a171d32, 0xa7fc689d),
+	TOBN(0x6c956109, 0x5a135d84), TOBN(0x649d0f78, 0x8e7d60dc),
+	TOBN(0x82220413, 0xfd5fc3b8), TOBN(0xaef98b7a, 0x79284276),
+	TOBN(0xd33e2188, 0x15c14b21), TOBN(0xa8990459, 0x9b91b715),
+    },
+    {
+	TOBN(0x78814e2c, 0x16678f9f), TOBN(0x245689a8, 0xdce57d93),
+	TOBN(0x657feb08, 0xe3a6eb7a), TOBN(0x19d6d8f7, 0xb4ddf34c),
+	TOBN(0x7aa2d6a1, 0x3cca14e6), TOBN(0xe507462c, 0x93e67b8f),
+	TOBN(0xba347ec3, 0xeaf414fa), TOBN(0x03625100, 0xc44b1b46),
+	TOBN(0x7c26645d, 0xf33bd29f), TOBN(0xa2657e0e, 0xc05ab5e6),
+	TOBN(0x453aa135, 0xe0160bde), TOBN(0x6d2c7212, 0xe4930012),
+	TOBN(0xb2db0656, 0x59f82bce), TOBN(0x610597ab, 0x6547e47f),
+	TOBN(0xb89990d9, 0xa330ae9c), TOBN(0xbf443613, 0x05509ff5),
+	TOBN(0x02743044, 0x5dcb5d3a), TOBN(0x14779d02, 0xf7996d5d),
+	TOBN(0x8f4996fa, 0xa21cd5b5), TOBN(0x7782d25c, 0x9d480899),
+	TOBN(0xbd120ff8, 0x818845c2), TOBN(0x0ec098df, 0xa8e59d4a),
+	TOBN(0x9b370399, 0x8602aee0), TOBN(0x165a23ad, 0x6a5bbf65),
+	TOBN(0x921a6c6e, 0x4e1ff83d), TOBN(0xe49920b1, 0x82be8e1f),
+	TOBN(0x87e0b999, 0x25f2b62a), TOBN(0xc72e604a, 0xe1e72696),
+	TOBN(0xdb41ba1f, 0x7057bafc), TOBN(0x992cb469, 0x7174681b),
+	TOBN(0xdd6c686e, 0x0a19d40e), TOBN(0x513208b3, 0x37236e2b),
+    },
+    {
+	TOBN(0x06b43007, 0x9e769b26), TOBN(0x50369585, 0x288d66b7),
+	TOBN(0x8e39ea98, 0x37dac314), TOBN(0x47b53f17, 0xfbbeb189),
+	TOBN(0xbd6d98fb, 0x84e83587), TOBN(0x646dc110, 0xcd408a34),
+	TOBN(0xf0400573, 0x91eca666), TOBN(0xbafd2fec, 0x9bfc7655),
+	TOBN(0xf3bf1ed2, 0x27686b7e), TOBN(0xbac149f0, 0xb006e3dd),
+	TOBN(0xcab96707, 0x3244ce82), TOBN(0xa3c00b49, 0x98e395e5),
+	TOBN(0x6c8c5799, 0xf1dde8eb), TOBN(0xe1ff436a, 0xb1f70663),
+	TOBN(0x884053e5, 0x049e17c1), TOBN(0xfbe7c365, 0x128a7a9f),
+	TOBN(0x90896814, 0xa6daa6d9), TOBN(0x3b29379e, 0xdd35a679),
+	TOBN(0x7ceb83ec, 0x1f587329), TOBN(0xdee66aef, 0xfd239040),
+	TOBN(0x74cc2c07, 0xb8fdcf9d), TOBN(0xde35a900, 0xc23bdeeb),
+	TOBN(0x53c50810, 0xa7035ada), TOBN(0x1a59243d, 0xc586bb70),
+	TOBN(0xef35f1f4, 0x7a54dc7d), TOBN(0x8261b85e, 0x16dd8274),
+	TOBN(0x0dd9a5d8, 0xa95ea102), TOBN(0xd9de5c45, 0x96f67512),
+	TOBN(0xe1c15809, 0xd88ee69f), TOBN(0xb143eab3, 0x78ba2811),
+	TOBN(0x1f107c0b, 0x8b9281e3), TOBN(0xe85b366e, 0xc4cd9f9d),
+    },
+    {
+	TOBN(0x0d68600f, 0x3ced364d), TOBN(0x8afa9caf, 0xc66e2305),
+	TOBN(0x06a1af17, 0xd6bb8118), TOBN(0x55d534b3, 0x0ce7f82e),
+	TOBN(0x9caf6600, 0x747853f6), TOBN(0x13162431, 0x2b34c19f),
+	TOBN(0x45588744, 0x37d1aa3d), TOBN(0x925be8ad, 0x1fea66a8),
+	TOBN(0xb4eddf5e, 0x209a08c1), TOBN(0x840e27d8, 0x95f5a63f),
+	TOBN(0x2e6698c0, 0x19cd0500), TOBN(0xa8aaed8b, 0xc130955e),
+	TOBN(0xbcb5bbdd, 0xc3367f1b), TOBN(0x409929b1, 0x874a5f30),
+	TOBN(0xa76a6821, 0x0c176024), TOBN(0x5ef53e94, 0x08bf21a4),
+	TOBN(0x5f125370, 0xac518eae), TOBN(0x2d2a08eb, 0xcd86f1b5),
+	TOBN(0x4b37e3c6, 0xc265c66c), TOBN(0xcf9469e4, 0x9fbd80db),
+	TOBN(0xdd98fb58, 0x7df4e74d), TOBN(0xc81f0f17, 0xde3fd06b),
+	TOBN(0xc3045aaa, 0xeba836ee), TOBN(0xe4d1130e, 0x1dbbb49a),
+	TOBN(0xae40d97b, 0x024aa4c2), TOBN(0x152e5708, 0x6080c1ce),
+	TOBN(0xca694337, 0xc4893d27), TOBN(0xb1b0f9e4, 0xf2d94f01),
+	TOBN(0x9a80620b, 0x26b600cb), TOBN(0x9dc172db, 0x70983352),
+	TOBN(0x75111d74, 0xf5bc4192), TOBN(0xd0b66cdd, 0x899b3f3a),
+    },
+    {
+	TOBN(0xc56ad9cf, 0x74c6f142), TOBN(0x104b83b9, 0x15ac07de),
+	TOBN(0x2057bb38, 0xdc51bd10), TOBN(0x48290802, 0xc31360b5),
+	TOBN(0xc836eb2b, 0x87079f08), TOBN(0x6293f152, 0xd6c44801),
+	TOBN(0x482555ee, 0xa2bf1d6f), TOBN(0x67a8755f, 0x84979999),
+	TOBN(0x0e3a13c4, 0xc50f2c0c), TOBN(0xcf12935d, 0x6892eb55),
+	TOBN(0x3a0a24ee, 0x5357173e), TOBN(0x6151bda9, 0x99be41bb),
+	TOBN(0xfb275897, 0xc8f5b1df), TOBN(0xda57c9b1, 0x0c149913),
+	TOBN(0xbf469294, 0x33c83d7e), TOBN(0xd8ee8c9d, 0x781a4576),
+	TOBN(0xd09e2c74, 0xce65366d), TOBN(0xdd0a0a00, 0x79a976f2),
+	TOBN(0xc40eb03d, 0xfb149f7c), TOBN(0x09a7c49e, 0x2f6f3406),
+	TOBN(0x1a8eb56d, 0x123ce4c4), TOBN(0xd69fc935, 0x5808ceb0),
+	TOBN(0x81199699, 0x8d3d02a0), TOBN(0x47b58226, 0x85786dd7),
+	TOBN(0xc9f0ccc7, 0xe23a1a6b), TOBN(0x7abe054e, 0xd09c6427),
+	TOBN(0x21430592, 0xd96ea805), TOBN(0x1ade1fc6, 0x8a2d0e9d),
+	TOBN(0x99365edf, 0x6b5a2f43), TOBN(0x6bc413ea, 0x92f7a9c1),
+	TOBN(0x5a69e6cd, 0xba850b39), TOBN(0x413f0830, 0x45323b86),
+    },
+    {
+	TOBN(0x8ad5b39e, 0xe98de284), TOBN(0x20970772, 0x2b580fbd),
+	TOBN(0x40af7671, 0xb8a37a20), TOBN(0x90521005, 0x8626c16a),
+	TOBN(0x906dd657, 0x0e0f3e10), TOBN(0xc527e2a5, 0xad889003),
+	TOBN(0x904aabdd, 0x457e3ade), TOBN(0xcf50eabf, 0x092f3332),
+	TOBN(0x1c742789, 0x8a1e5818), TOBN(0x9e2526ba, 0xd125d6aa),
+	TOBN(0x741449dc, 0xa6ae2e7d), TOBN(0xc2a37b53, 0x337c8376),
+	TOBN(0xf64eb12f, 0x91eb63be), TOBN(0xb4af9362, 0x18293227),
+	TOBN(0x7e8d2528, 0x67907afd), TOBN(0xb1dd193a, 0xf0348aed),
+	TOBN(0xa13c58e9, 0x9cca6cdb), TOBN(0xba141400, 0xf352ede5),
+	TOBN(0x881d607b, 0xf6293ef9), TOBN(0x134f893c, 0x5ede680d),
+	TOBN(0x351d6ada, 0x2479c988), TOBN(0xad3f926a, 0xb0119d60),
+	TOBN(0x02332d33, 0x1a7a0541), TOBN(0x8f6b044d, 0x0af0dbaf),
+	TOBN(0x93e1998f, 0xc47434d6), TOBN(0xf57c0a9d, 0xa138c84f),
+	TOBN(0x42860b25, 0xb2dd500a), TOBN(0x35bc3f8d, 0x145a1d3a),
+	TOBN(0x326cbdbe, 0xd6b45e86), TOBN(0xd78827d5, 0x25ef5383),
+	TOBN(0xb4d3cd9b, 0x750a1672), TOBN(0x827e1060, 0x8a64770c),
+    },
+    {
+	TOBN(0x63281d09, 0x5bbf845c), TOBN(0x2004c35c, 0x658b92d5),
+	TOBN(0x06b23ff0, 0xf4f237c2), TOBN(0x769dea60, 0x90bfac5d),
+	TOBN(0xbfc7d3ac, 0x1e08c427), TOBN(0xe7dd0ab3, 0xbc4de1e5),
+	TOBN(0x8a141ef9, 0x978f05db), TOBN(0xcdd72d4d, 0x73b49439),
+	TOBN(0x0a75d4fb, 0x3b6461f7), TOBN(0x8a61481d, 0xb38b59fa),
+	TOBN(0x34bb1280, 0xf4b3bb55), TOBN(0x51ae35b5, 0x503400e9),
+	TOBN(0xf2c0a0b6, 0x8c8dcf02), TOBN(0x21b5aac5, 0x20931885),
+	TOBN(0x2cd8a0c0, 0xe811b49e), TOBN(0x3e4c36a7, 0x4bad2321),
+	TOBN(0x4031ca68, 0x9e523388), TOBN(0x030c541f, 0x06054763),
+	TOBN(0x308bd3a2, 0xb64af518), TOBN(0xca17ba86, 0xf2cbf4e9),
+	TOBN(0x8991e030, 0xd5ef2356), TOBN(0x8b7632e9, 0x2a04b4bb),
+	TOBN(0x44e01b38, 0xb48739e8), TOBN(0xa3ddaa0a, 0xe0dfccdb),
+	TOBN(0x5bfee27e, 0x980553cb), TOBN(0xdac8921c, 0xa5861193),
+	TOBN(0x593e58fd, 0x777f5df5), TOBN(0xf250d88f, 0x5a94932a),
+	TOBN(0xf146fc1b, 0xee395108), TOBN(0x6ebf2c7f, 0xdb34afcd),
+	TOBN(0xfb97c61e, 0x1f909bf1), TOBN(0xa6cb48e0, 0x8551a02e),
+    },
+    {
+	TOBN(0xc6503a12, 0xb77f08b9), TOBN(0x2a96f85e, 0x406a7b41),
+	TOBN(0xf79259c9, 0x50ea6a74), TOBN(0xb3a68b44, 0x36e9edd4),
+	TOBN(0xa163db61, 0xa6b97136), TOBN(0x19f4b777, 0x094f7101),
+	TOBN(0x7900ba50, 0x43166928), TOBN(0xb80fe36e, 0xcf5aa26f),
+	TOBN(0xe25b4bb0, 0x4891f5b3), TOBN(0x234e2432, 0x9cfe9277),
+	TOBN(0x0269efb3, 0x9eaadea6), TOBN(0x04874263, 0x2fd16b65),
+	TOBN(0xc91e4e16, 0xf8964b49), TOBN(0xc005f866, 0x64828375),
+	TOBN(0xf09b01d8, 0xd2fe99dc), TOBN(0xe3be2518, 0x7b0472a7),
+	TOBN(0xbe631818, 0x9b40a80a), TOBN(0xbcf041ec, 0x1f263388),
+	TOBN(0xb2788333, 0xf04aca49), TOBN(0xa5f70912, 0x8b0e4a2c),
+	TOBN(0x072463aa, 0xb7d78ebf), TOBN(0x22a022e8, 0xadd17c0c),
+	TOBN(0xa53a80fb, 0x06aff50a), TOBN(0xf7da1ea8, 0x546dd770),
+	TOBN(0x87d2ba8f, 0x3dab935f), TOBN(0xc5fc0a85, 0x7dd1e00b),
+	TOBN(0x6132a981, 0x60cab70d), TOBN(0xe295f278, 0x7a158b32),
+	TOBN(0xb98baa2f, 0x520ad59d), TOBN(0x18b7f674, 0x358d42ca),
+	TOBN(0x2e1fb19a, 0x1db875ae), TOBN(0x4d9691c1, 0x0aa3405e),
+    },
+    {
+	TOBN(0xd3df98e4, 0x0d11f0fe), TOBN(0x50dc5919, 0x6042a3d8),
+	TOBN(0x9eac42d0, 0x07103882), TOBN(0x8686ea0f, 0x7e55c09f),
+	TOBN(0xebccbc68, 0xd41ab7e4), TOBN(0x4c2f707d, 0x9132ae53),
+	TOBN(0x9376ecb2, 0x6391b67b), TOBN(0x596cc59b, 0x308af246),
+	TOBN(0xa24498bc, 0xa831e89c), TOBN(0x6f1bf37e, 0xf366b2aa),
+	TOBN(0x0145ddd4, 0x604b24cf), TOBN(0xd205ed71, 0xce29e900),
+	TOBN(0x36be018e, 0x7375251b), TOBN(0xd36d79da, 0xec4969c9),
+	TOBN(0x6a3b5417, 0xbd16ccfc), TOBN(0x168ea423, 0x20f13fa2),
+	TOBN(0x345c0a96, 0xe0e8482d), TOBN(0x6c72cb79, 0xaae55ee4),
+	TOBN(0x9f0d293d, 0x30745750), TOBN(0x8dc8da09, 0x73454fc9),
+	TOBN(0x47265a61, 0x254d065a), TOBN(0x67c4af99, 0x4184537c),
+	TOBN(0x0404ff0d, 0x4e346ca4), TOBN(0xd9a2fe11, 0x9e2b09d0),
+	TOBN(0x2674b624, 0x2090568e), TOBN(0x9e14fb4a, 0x71fbd63a),
+	TOBN(0x6543ed44, 0x134bb4d4), TOBN(0x9cba2b67, 0x67e163e5),
+	TOBN(0xdcd8654b, 0x249f9ee5), TOBN(0x1d6aae8c, 0xb9276c37),
+	TOBN(0xda33f3d4, 0x3bd62bb7), TOBN(0xfe7dec0d, 0x09e30d20),
+    },
+    {
+	TOBN(0xa7bf31c8, 0x1a23e1fd), TOBN(0x8c4623d8, 0x35d89d48),
+	TOBN(0x27865f87, 0x75266bf4), TOBN(0xd3788aa2, 0x1216165a),
+	TOBN(0xf96dacdb, 0x12dd58b0), TOBN(0xe299830a, 0xb31909dd),
+	TOBN(0x8bc655c1, 0xdb1bca66), TOBN(0xcf3b140a, 0x49075e89),
+	TOBN(0x11f8d333, 0x222d02fc), TOBN(0xecc37af5, 0x1cb543d9),
+	TOBN(0x9b7f865a, 0x75d9b199), TOBN(0x0536b1dc, 0x2bbd3b92),
+	TOBN(0x51190fc6, 0xc664f77c), TOBN(0x23759691, 0xfbef25fc),
+	TOBN(0x6b606886, 0x7d08ca9a), TOBN(0x94430010, 0x258cabaa),
+	TOBN(0xa6b79875, 0x206cd154), TOBN(0x8fbd30a1, 0x68e6628a),
+	TOBN(0x8f7b2e68, 0xe49d8eba), TOBN(0x2d594817, 0x8c00ffed),
+	TOBN(0x824d580b, 0x569354c7), TOBN(0xdb3d1c48, 0xdcd0b98d),
+	TOBN(0x238448a4, 0x3a0a5a81), TOBN(0x6364c6b5, 0xcf04515a),
+	TOBN(0x1cbe61da, 0x4ec198e6), TOBN(0x4c94dce1, 0x16bd6959),
+	TOBN(0x793dd20e, 0x986364cb), TOBN(0x37689828, 0x94af2ca8),
+	TOBN(0x90ae7c8d, 0xbed77157), TOBN(0x760efa8d, 0xf172bb9e),
+	TOBN(0xeb580d06, 0x56439539), TOBN(0xfcfbd81a, 0x13c61a41),
+    },
+    {
+	TOBN(0x46d04c89, 0xfad76a50), TOBN(0xda4e1226, 0x9b8e16d3),
+	TOBN(0xb79c566a, 0x8de32f8b), TOBN(0xe214262e, 0x837a94a2),
+	TOBN(0x4872c2ec, 0xef0fc7d7), TOBN(0x1f8bc9fd, 0x0cadf9fe),
+	TOBN(0xd577c578, 0x4f47da50), TOBN(0x26219d91, 0xe0417107),
+	TOBN(0xd6f25966, 0xd9f28772), TOBN(0x3675d7fa, 0x569a258c),
+	TOBN(0x7db86c3b, 0xd3fa1672), TOBN(0x06f06d36, 0xc3866136),
+	TOBN(0xd3684320, 0xbfbb8eae), TOBN(0xd11664ca, 0xbbaecc47),
+	TOBN(0x64257ee3, 0x7dddfa35), TOBN(0xe25ecbcc, 0xf4a78a27),
+	TOBN(0x5620b517, 0x4198bbe1), TOBN(0xec9d6a30, 0x6f1a1575),
+	TOBN(0x2783348f, 0x795e97e1), TOBN(0x697df688, 0x510d38b9),
+	TOBN(0xfc48e3db, 0x5dec53a4), TOBN(0x959a6e4e, 0x5fb78c0a),
+	TOBN(0xf838dc7e, 0x1a0b7af5), TOBN(0x29bbaf9b, 0x67af8297),
+	TOBN(0xc4e432d2, 0x8bda10dc), TOBN(0xc23f0b6f, 0xf03cd663),
+	TOBN(0x41cb024a, 0x01c2740a), TOBN(0x972e8906, 0x61683955),
+	TOBN(0x30b5991c, 0xe55e5203), TOBN(0xb70a9256, 0x94bab3b8),
+	TOBN(0x33bf475d, 0x0be4c708), TOBN(0x66221c92, 0xa5aa5c2d),
+    },
+    {
+	TOBN(0x8da09913, 0xf5aed4a0), TOBN(0xb49c244d, 0x371c2da6),
+	TOBN(0x6f38acd5, 0x1bc65f17), TOBN(0xc4284c5d, 0x06f52945),
+	TOBN(0x90e585d9, 0xde1f8faf), TOBN(0x3f1793fa, 0x195bf3fc),
+	TOBN(0xaaef8af0, 0x9e8fb4a0), TOBN(0x4c433b23, 0xc082e20f),
+	TOBN(0xade4b2cd, 0xb3e50ee4), TOBN(0x6cebaff4, 0xad344b19),
+	TOBN(0xfb70d877, 0xa7f42ce4), TOBN(0x0de0da6d, 0x870cc26c),
+	TOBN(0xa6d08641, 0x7f771d5c), TOBN(0xa22cc995, 0x775d988f),
+	TOBN(0xc84afdc6, 0xfbbbf46b), TOBN(0xc4bd9799, 0xe94f144e),
+	TOBN(0xac416a2e, 0x833177c3), TOBN(0xd93ad460, 0xde342aea),
+	TOBN(0x4f06691e, 0xf2bd2fc3), TOBN(0xd2fbed10, 0xa21a7172),
+	TOBN(0xf891c7b6, 0xbbd8a748), TOBN(0x2b34dc9c, 0xbf6f1815),
+	TOBN(0xf071b8fc, 0x3416f5eb), TOBN(0x53775f36, 0xcf5f052f),
+	TOBN(0x89c865a5, 0x17b421b8), TOBN(0x847e16df, 0xe079acc7),
+	TOBN(0x83960494, 0x0384e815), TOBN(0x2e5d120c, 0xc2d072aa),
+	TOBN(0x616b3239, 0xcabca407), TOBN(0x6e1524ad, 0x29756770),
+	TOBN(0x677e8eba, 0x17c98e11), TOBN(0xcc443925, 0x4b54b85a),
+    },
+    {
+	TOBN(0x2492cdac, 0xaa9d9718), TOBN(0xbdff3d31, 0xea3204cf),
+	TOBN(0x3aca1498, 0x9ad51148), TOBN(0x4f1247cc, 0x2171ba06),
+	TOBN(0xb92f4d1e, 0x1d8dbaa4), TOBN(0xcf365265, 0xb8e1f9cf),
+	TOBN(0x2b9541d1, 0x0ae9774d), TOBN(0x1dd18cb2, 0x8f1479e5),
+	TOBN(0xab2ff56e, 0xe414b593), TOBN(0x6d3af076, 0x7fe08268),
+	TOBN(0xaaf62a7e, 0xd4a460f1), TOBN(0x94b977ea, 0x7591060a),
+	TOBN(0x45dc72b3, 0x00fa166f), TOBN(0xea785895, 0xcef8080a),
+	TOBN(0xcd0aaaa1, 0x76aa9a25), TOBN(0x97f86fa7, 0xa58fedb3),
+	TOBN(0x9429b658, 0x28f69e50), TOBN(0x2bf40f19, 0xf345a55d),
+	TOBN(0x24a8d349, 0x3b464c77), TOBN(0xb426b025, 0xbf56719a),
+	TOBN(0xd8a5ea4d, 0xd7a25c2b), TOBN(0x6a9b00fa, 0xd4098d14),
+	TOBN(0xccd2587a, 0x123b1759), TOBN(0xa53f8f2a, 0x666d40be),
+	TOBN(0x341234aa, 0x386cf454), TOBN(0xcfdc784d, 0xa14d9757),
+	TOBN(0x95aa5d47, 0x9e53d4aa), TOBN(0x958991b1, 0xb9538839),
+	TOBN(0x4005664a, 0x615350ff), TOBN(0x9a95df7c, 0xb779840e),
+	TOBN(0x1950489f, 0xf8cc8c52), TOBN(0xf0d496f1, 0x5abb7e58),
+    },
+    {
+	TOBN(0x49259b59, 0x553b2e31), TOBN(0x668bec09, 0x49b75f35),
+	TOBN(0x5fc20318, 0x9cb01d81), TOBN(0x648f461b, 0x584e0927),
+	TOBN(0x9432ce45, 0xa5c35e30), TOBN(0xe8a746db, 0x0277a0d5),
+	TOBN(0xbc02ffff, 0x29cb4c0b), TOBN(0x5804a239, 0x061a6dc6),
+	TOBN(0x23cf8c97, 0x99f29cea), TOBN(0xe90174e4, 0x35a8e355),
+	TOBN(0xeee01faf, 0x5e8c29dd), TOBN(0x8a9dc6cd, 0x7a8b75a7),
+	TOBN(0x6f55f20f, 0xe16eda23), TOBN(0x518b5407, 0xc14c627e),
+	TOBN(0x30ff1599, 0xf03064ec), TOBN(0x97169719, 0x2eca07cd),
+	TOBN(0x6652eff7, 0xb0897d9b), TOBN(0x0ebfb7e1, 0xf9a6ef7d),
+	TOBN(0x9ab28280, 0xfa417908), TOBN(0x7a14f450, 0x2423438e),
+	TOBN(0xa54c77e4, 0xbb3e0069), TOBN(0xe0e9bf0c, 0x01db2cbe),
+	TOBN(0xb51efb7d, 0xc217afeb), TOBN(0xfa9de8e7, 0x5f88bf37),
+	TOBN(0x37f95ee6, 0x7e7ad471), TOBN(0xb023d6e7, 0x7560eb93),
+	TOBN(0xda0ab215, 0xae73a477), TOBN(0x290764bd, 0x37937550),
+	TOBN(0x57087e8c, 0x383ed58b), TOBN(0x70655c6d, 0xee16eb4b),
+	TOBN(0x6990b69d, 0xd0305670), TOBN(0xe1a92de2, 0xb576fcb0),
+    },
+    {
+	TOBN(0xac01b2a5, 0x6ad8abfc), TOBN(0xabcfd9d8, 0x9825435b),
+	TOBN(0x1b1aaf85, 0xaf7b2938), TOBN(0x5cfaf4ff, 0x54f26a58),
+	TOBN(0xb6dc1233, 0xc56924b3), TOBN(0xfaa6e6cf, 0x043b1cad),
+	TOBN(0xc30f65c3, 0xe966968f), TOBN(0xd7cb39bc, 0xd56f94b8),
+	TOBN(0x557efe15, 0x5b629228), TOBN(0x5ad7d2be, 0x8f30d44f),
+	TOBN(0x716d8bd8, 0xfe9cfbaa), TOBN(0xb799e6bd, 0x99f68076),
+	TOBN(0xec3b6b61, 0xe385dc94), TOBN(0x75a41f66, 0x0dd1afd7),
+	TOBN(0xa206fec2, 0xa3d0f0dd), TOBN(0x27540eb7, 0x1f60f7d5),
+	TOBN(0x01453a06, 0x2decc78d), TOBN(0xb4ce7edd, 0xcf685f8a),
+	TOBN(0xc7d77b04, 0xad689aca), TOBN(0xe5a35abb, 0x0e32f621),
+	TOBN(0x3377d87c, 0xab99ee9e), TOBN(0xf9189528, 0x06715bdf),
+	TOBN(0xb9a21d97, 0xc74d12f6), TOBN(0x2d2ac61d, 0xd6b0ec2f),
+	TOBN(0x919d28b4, 0xaabc9d99), TOBN(0x74aabad2, 0xc4cc0269),
+	TOBN(0x4971991e, 0x8b2e0f75), TOBN(0xd30aad19, 0x2bc067a3),
+	TOBN(0x0922f3d3, 0x2ff839af), TOBN(0x1ff2b8c5, 0xad192b0e),
+	TOBN(0x985dc1b5, 0x00a0b399), TOBN(0xdba020dd, 0x5ef22243),
+    },
+    {
+	TOBN(0x5803654a, 0xd5b157f9), TOBN(0x422d2556, 0xa59ddc4e),
+	TOBN(0x206338f2, 0xc5fc4d61), TOBN(0x8060a081, 0xbf4f69cb),
+	TOBN(0x8f8c5870, 0xf57a324e), TOBN(0x3f886fad, 0x9929e691),
+	TOBN(0xeaf747e4, 0xe6c58a90), TOBN(0xcbf7fc4d, 0x92d0a36d),
+	TOBN(0x786d9de4, 0x888e5615), TOBN(0xc43b3974, 0x54498722),
+	TOBN(0x7bcee263, 0xb27d5f4f), TOBN(0xd05ea473, 0xc3566a7f),
+	TOBN(0xbc13e36d, 0xa686666d), TOBN(0x67e2e1a8, 0x3effb219),
+	TOBN(0xdaf7bddc, 0x4a7d125b), TOBN(0xb5cdd538, 0x226c1c10),
+	TOBN(0x4089f753, 0xba75d014), TOBN(0x20749769, 0xb1ec63d6),
+	TOBN(0xe10fd1f7, 0xde8615af), TOBN(0xdd0e497a, 0xc1dc4c9d),
+	TOBN(0x5af05442, 0x632d254f), TOBN(0xfde4e766, 0x66aaca53),
+	TOBN(0x8ebe85b9, 0x2c3ba726), TOBN(0x0a7456ce, 0x40101619),
+	TOBN(0xf30f46fb, 0x631a26fb), TOBN(0xf9c05bf1, 0xbc5dc1b7),
+	TOBN(0x419929c3, 0x88281a0c), TOBN(0xa4099b8c, 0x1c6d3424),
+	TOBN(0xe943999d, 0xd588a6eb), TOBN(0x7b1f0eff, 0xd956394a),
+	TOBN(0x67aba8c7, 0xdfd8a4fd), TOBN(0xb74041ba, 0xbde44487),
+    },
+    {
+	TOBN(0xeae0c4ac, 0x99aa23d0), TOBN(0xf56cd5da, 0xf8060c68),
+	TOBN(0x300f4927, 0x7a531042), TOBN(0x856d9fd6, 0x0926f45f),
+	TOBN(0x0f309c57, 0xbfeb6a88), TOBN(0x708e416c, 0x2d94f715),
+	TOBN(0x222bf85e, 0x7eec49e0), TOBN(0xf74aa96b, 0xf45be511),
+	TOBN(0x26a5b1c3, 0x0871ef57), TOBN(0xc9a1765f, 0xf7187e1a),
+	TOBN(0x3dd20d0c, 0xc05d6a66), TOBN(0xa088e508, 0x0b0074db),
+	TOBN(0x5800d468, 0x6d43abf0), TOBN(0x7290a9f0, 0xf026ce4d),
+	TOBN(0x689480fe, 0x01467c4b), TOBN(0xed0e9caf, 0xe6c20e45),
+	TOBN(0xf2aea5c3, 0x52fe9bf7), TOBN(0x5bc3e557, 0xa82f0c1b),
+	TOBN(0x17afa7c4, 0x347ad717), TOBN(0x508b58fc, 0xd9453411),
+	TOBN(0x2feaa2fc, 0xfd35addc), TOBN(0x9445dd27, 0x8265dbc0),
+	TOBN(0xed16b695, 0x0d0dedaf), TOBN(0x33feb35e, 0xd8beb044),
+	TOBN(0xd9dbcdba, 0x37175029), TOBN(0x404e21b3, 0x5d4fe152),
+	TOBN(0x7ab7dbdf, 0xdccbb7f0), TOBN(0x04bf5378, 0xe05fda9e),
+	TOBN(0x96c36d8d, 0x4b483668), TOBN(0x94755cb8, 0x86eaa83d),
+	TOBN(0x935c37c4, 0x11b23732), TOBN(0x866352e0, 0x8b76e126),
+    },
+    {
+	TOBN(0xd5c18959, 0x335447a1), TOBN(0xd5671d5b, 0x655f6e68),
+	TOBN(0x4a4c6c36, 0x5bac1b75), TOBN(0xd145f62f, 0x27b87dd9),
+	TOBN(0x40356cb8, 0xea7ebdf8), TOBN(0x2b5724e7, 0xebdd9b60),
+	TOBN(0xa9306d1a, 0x11d0f131), TOBN(0x0af6dbab, 0xd0a9441e),
+	TOBN(0x1abb053f, 0xe2ad1074), TOBN(0xa1ce80b7, 0x2418dab8),
+	TOBN(0x1497e4cb, 0x35fe3cc8), TOBN(0xa23ca108, 0xa56a5349),
+	TOBN(0x939eb57a, 0xba020525), TOBN(0x61bbf6be, 0x03a9ef04),
+	TOBN(0x6812c253, 0x05682937), TOBN(0x4142f129, 0xb12e48f0),
+	TOBN(0x235ccece, 0x049978ea), TOBN(0x6e5f645d, 0x6379bcfa),
+	TOBN(0x80c02b76, 0xecaa8e48), TOBN(0xb2de45fe, 0x5800c87c),
+	TOBN(0x53d5e943, 0x0664a3ca), TOBN(0x343f7765, 0x5e93ca15),
+	TOBN(0xf5a7b7b3, 0xb7bd5c98), TOBN(0x181c3150, 0x442b9e43),
+	TOBN(0x838c9106, 0x7bcf8c1b), TOBN(0x910729b2, 0xed657f8a),
+	TOBN(0xa425af46, 0x2b636b02), TOBN(0x0772e84b, 0x85ac1a1a),
+	TOBN(0x04848d12, 0x0c28a05c), TOBN(0x642456e5, 0x8cf933aa),
+	TOBN(0x5da894e6, 0x01fbac30), TOBN(0x0cc6a5c1, 0x16edc24d),
+    },
+    {
+	TOBN(0x1376473f, 0xde70dd6a), TOBN(0x65d293e5, 0x1d702293),
+	TOBN(0x468cde6a, 0x0ea7d56b), TOBN(0x09dce59b, 0xe256cd00),
+	TOBN(0x3be9d454, 0xfd7c63cd), TOBN(0xc456bb06, 0x8e07dd56),
+	TOBN(0x9af04640, 0xd1127efc), TOBN(0xb9384849, 0x347d2a9d),
+	TOBN(0x16b712e3, 0xf53efc2a), TOBN(0xe9e81215, 0x1b517f39),
+	TOBN(0xc06e7fa3, 0x6270b2aa), TOBN(0x5432ecf0, 0x170c0f28),
+	TOBN(0x52ccf1f1, 0xfc409dbb), TOBN(0x029e4b78, 0x8df9a842),
+	TOBN(0x6e6169ac, 0x3eee259c), TOBN(0x55775a66, 0xd30224fb),
+	TOBN(0x1ed63c09, 0x9aa42cd9), TOBN(0x416ea474, 0x09a1b3ef),
+	TOBN(0x376801d3, 0x645d3a45), TOBN(0x46a26552, 0xf1e2d29d),
+	TOBN(0x03ec65a3, 0x0bb099bb), TOBN(0xc4471caf, 0x013cd185),
+	TOBN(0xeb202009, 0x540a40f3), TOBN(0x5852390c, 0x6f1b0cf7),
+	TOBN(0xc4d71b93, 0xa65dec2e), TOBN(0xdb8a06e5, 0x66b1e3a2),
+	TOBN(0xb6e69039, 0xc5dc8824), TOBN(0x510254da, 0xfd7727d5),
+	TOBN(0x8b2e7a4c, 0x48d594bb), TOBN(0x594883a3, 0x887088ec),
+	TOBN(0x11d07b80, 0xcf0ffac9), TOBN(0xbf2a61b3, 0x7077df74),
+    },
+    {
+	TOBN(0x26ec8e7f, 0xbce1bad5), TOBN(0xb632996f, 0xb0339abd),
+	TOBN(0x774796bb, 0x8455a5c6), TOBN(0xda2481ba, 0xda182f1b),
+	TOBN(0x99a7dcb3, 0x65a0b081), TOBN(0xd2e8181c, 0xacc367e2),
+	TOBN(0x9ab908de, 0xb61d5b69), TOBN(0x8ed21966, 0x50ebcf37),
+	TOBN(0xfaddc781, 0xbc472a19), TOBN(0xe25bb821, 0x6c8adcf5),
+	TOBN(0x19d0c9f8, 0x7a24cd50), TOBN(0x0990b0d8, 0xbd8187e4),
+	TOBN(0x8936f08d, 0xd7fbe8bb), TOBN(0x81d739cd, 0x3f4fa2ee),
+	TOBN(0x73ac93af, 0x80b77bd8), TOBN(0x12146c97, 0x89ae765c),
+	TOBN(0x7babfb5a, 0x93e49aad), TOBN(0x39b4e296, 0x265f0ca0),
+	TOBN(0xc030df95, 0x4c6f54a4), TOBN(0x9f0c5eaa, 0x893c0594),
+	TOBN(0xfbd96e8f, 0x235a7b88), TOBN(0x9441f674, 0x5c41b59e),
+	TOBN(0xf1ba8a9c, 0x45b60320), TOBN(0x60c33cab, 0x70e457a9),
+	TOBN(0x59832cb9, 0x5a5cc425), TOBN(0xc77ef417, 0x0029842a),
+	TOBN(0x1c8317f9, 0xfd850b6b), TOBN(0x9ff8eb0f, 0xbfdab489),
+	TOBN(0xed5aa690, 0x07435d02), TOBN(0xedcaa4bb, 0x9004f507),
+	TOBN(0x5a911c5f, 0x7cb7335d), TOBN(0x7e54c366, 0xe0efbee8),
+    },
+    {
+	TOBN(0xc25dbdee, 0xd2c1c0e8), TOBN(0x520be7c8, 0x5d64be11),
+	TOBN(0xeba910da, 0xb801f648), TOBN(0x49310935, 0xc933de93),
+	TOBN(0xceaa55ad, 0x9061265c), TOBN(0x8bf8a7e0, 0x49ba8e88),
+	TOBN(0x1daf0600, 0x04ab8d5a), TOBN(0x02a5ed01, 0xb39124d4),
+	TOBN(0x8daa865b, 0x3e9485c7), TOBN(0x8dab047d, 0x1df96af5),
+	TOBN(0x1890f980, 0x3943248c), TOBN(0xa902b0bc, 0xcb93d62d),
+	TOBN(0x496c766c, 0x05f7b89c), TOBN(0x49f5599c, 0x57cb4b95),
+	TOBN(0x96220c0d, 0xdfeafa51), TOBN(0x09350fd3, 0x722b19d5),
+	TOBN(0x68cdd5d4, 0x3130d67c), TOBN(0x8ede7338, 0x50ecc5ec),
+	TOBN(0x67aaeac3, 0x57bbba3f), TOBN(0xac59e867, 0x030fd4dd),
+	TOBN(0x4c16c29d, 0x4c6c1dec), TOBN(0xb764c5dc, 0xf3685a28),
+	TOBN(0x8846289b, 0x8953c456), TOBN(0x5ddb6649, 0x6a1999d4),
+	TOBN(0xb05f4680, 0x53c866e3), TOBN(0x6fad4e4d, 0xcbeaa67b),
+	TOBN(0x13a5b4c8, 0x2d106588), TOBN(0xffadc64b, 0x4a45a9ab),
+	TOBN(0x00e70781, 0xf3ab36a8), TOBN(0xfd70a2ed, 0x1b049de7),
+	TOBN(0xc539e6b7, 0x29e6df11), TOBN(0xa3702d8c, 0x698b0f41),
+    },
+    {
+	TOBN(0x84bb7bdd, 0xa58381d1), TOBN(0x8ea54136, 0x301cd1ba),
+	TOBN(0xc17ffb9c, 0xd709e780), TOBN(0x58ccc8ee, 0xa7d25242),
+	TOBN(0xbf28df64, 0x8b6a35a0), TOBN(0x622bf1d0, 0x2428ca47),
+	TOBN(0xa036885d, 0x1d4f7825), TOBN(0x21ad62d7, 0x4f13c3a4),
+	TOBN(0xe8c4ae70, 0x4ef23d52), TOBN(0x29e19cf1, 0x71dab46e),
+	TOBN(0xca15bdb2, 0x27c9b114), TOBN(0xb3303872, 0x269115ec),
+	TOBN(0x7675f981, 0xeb6a1e7d), TOBN(0x10855614, 0xd2f2e994),
+	TOBN(0xc32dd872, 0xc2b12543), TOBN(0x798fd770, 0xc8006010),
+	TOBN(0x0f9b2eef, 0xc0fdedf2), TOBN(0xd494801e, 0xb4f5309b),
+	TOBN(0x20b6b175, 0x332c5498), TOBN(0x6a7b64d2, 0xab960a15),
+	TOBN(0x8c2e2883, 0xa4d183eb), TOBN(0x7a7d48d0, 0x4098c6e5),
+	TOBN(0x2c069bc0, 0xb04909e6), TOBN(0x6bd59725, 0x66e17163),
+	TOBN(0x30938292, 0xb531b98f), TOBN(0xefc582e7, 0xca9b09dc),
+	TOBN(0xd6016116, 0xcbecc632), TOBN(0xfd4fcdf0, 0x5977b833),
+	TOBN(0xd8cbc0fb, 0x5ceea0dd), TOBN(0x361ae34e, 0xb52d1efc),
+	TOBN(0xc163f2cc, 0x3264fbef), TOBN(0x46e05b18, 0xd3161e83),
+    },
+    {
+	TOBN(0xc99fb1fe, 0xf5207479), TOBN(0x7693d69d, 0xca53b44f),
+	TOBN(0x619446ba, 0x348cbf76), TOBN(0x47c1a943, 0xe34d8334),
+	TOBN(0xcd8d976c, 0xbcc9895f), TOBN(0x9d017508, 0xb35b662b),
+	TOBN(0xa90f6995, 0xec490467), TOBN(0xa20fd84d, 0xf6160b47),
+	TOBN(0x4f880615, 0x9ee5e678), TOBN(0x906484c0, 0xb4e6dabb),
+	TOBN(0xa9a26b15, 0x74efe5fa), TOBN(0x01310529, 0x367db60f),
+	TOBN(0x77ae4776, 0x12ecf8f4), TOBN(0x2e0ff27f, 0x06a23998),
+	TOBN(0x0a6ed08c, 0x936a4e4a), TOBN(0x9caa26d6, 0x02c5cfc7),
+	TOBN(0xc976c148, 0x81368bee), TOBN(0x251c1922, 0x24971271),
+	TOBN(0xb145ccaa, 0x61f7f97d), TOBN(0x8a5d7114, 0x260fa8f2),
+	TOBN(0xaea4997a, 0x4347e6c1), TOBN(0xd5ba570b, 0x20de5492),
+	TOBN(0x48b420f3, 0xb5748837), TOBN(0xec34937f, 0xddf10297),
+	TOBN(0xb6ee3446, 0x44e08f62), TOBN(0x2cd88e0b, 0xf8703def),
+	TOBN(0x52330dfa, 0x495952f8), TOBN(0xaa3833e1, 0x51be95f0),
+	TOBN(0xa85d8974, 0x44eab70d), TOBN(0x87511abc, 0x6e16bd84),
+	TOBN(0x78909391, 0x32ed084d), TOBN(0x7c41be63, 0xc7ae71ee),
+    },
+    {
+	TOBN(0x933f63fd, 0xea40e8f2), TOBN(0xed27ad3b, 0x94a7689f),
+	TOBN(0xc3288d74, 0x69197eec), TOBN(0x8f835287, 0xc69b0668),
+	TOBN(0x9b1b2ed9, 0x799312be), TOBN(0x3a02ea11, 0x66b6cc57),
+	TOBN(0x521ed32b, 0xd89208cf), TOBN(0x441fb09b, 0xec2c168f),
+	TOBN(0x9f100c2b, 0x3dcbccf1), TOBN(0x20c90981, 0x69cdb576),
+	TOBN(0x5344d62a, 0xe9dfcbf5), TOBN(0x02620a52, 0x6cfb6c1f),
+	TOBN(0xef5c8eec, 0x25d9f1e8), TOBN(0x5c1fe4fe, 0x0d447330),
+	TOBN(0x14dda119, 0x26d49c94), TOBN(0x39544dac, 0x058b9f8e),
+	TOBN(0x92ed8291, 0x026d17dd), TOBN(0x4a383244, 0x492e24e3),
+	TOBN(0x628b9954, 0xc3eff2fa), TOBN(0x14bae228, 0x4c1f51e5),
+	TOBN(0x5d4932f4, 0x868fcd83), TOBN(0xab74ae16, 0x41bca925),
+	TOBN(0x916841e7, 0x6ae9106f), TOBN(0xd86926ff, 0xbbe2052e),
+	TOBN(0x6ddc688c, 0x89c11ec5), TOBN(0x59b11c17, 0xf0e07bdf),
+	TOBN(0xa4661bf4, 0x92b2a5f0), TOBN(0x547067c2, 0xa37d2be0),
+	TOBN(0x50bb12e8, 0x89d56e1b), TOBN(0x0ea23578, 0xdc2d7b09),
+	TOBN(0xf1212722, 0x65da109b), TOBN(0xf8837cc7, 0x8f5ce3dc),
+    },
+    {
+	TOBN(0xd658bdfc, 0xa60170fd), TOBN(0x1051db8e, 0x0ee13d02),
+	TOBN(0xea7bd201, 0xbbfd02ef), TOBN(0x22880585, 0xa12c8a02),
+	TOBN(0x11c47c3b, 0x162d245b), TOBN(0x3a11768f, 0x9f593538),
+	TOBN(0x7f8f51e5, 0x123b9319), TOBN(0xced99e23, 0xc553016a),
+	TOBN(0x1ff94fe8, 0xd53aae52), TOBN(0xee7ff6fe, 0x497d3ed3),
+	TOBN(0x07e9b7e4, 0x600503d5), TOBN(0x60176b7a, 0x3c8476cf),
+	TOBN(0xd0e7e0c0, 0x4302704a), TOBN(0x9ed2b266, 0xf1d9c33e),
+	TOBN(0x3d768768, 0x01499534), TOBN(0xa150bac0, 0x601ae4ca),
+	TOBN(0xbbad466f, 0x2efa131a), TOBN(0xf249c6cc, 0xdf1d391c),
+	TOBN(0x6d19a5af, 0x86cae8c1), TOBN(0x4b0a88c9, 0x2e4214a9),
+	TOBN(0x54a2889b, 0x5afb2bbd), TOBN(0x4f6cc415, 0x18d60c21),
+	TOBN(0xbe5f0b97, 0xbdbe5ad1), TOBN(0x9decb137, 0x31b94a26),
+	TOBN(0xd80bec6c, 0x9f5f887a), TOBN(0xce88da58, 0xbbaa4ae8),
+	TOBN(0x463c60b2, 0xbb1144c7), TOBN(0x6ff5fe44, 0x16dd30b8),
+	TOBN(0x171f75b1, 0x3769cc8e), TOBN(0x3737cce7, 0x013e99fe),
+	TOBN(0x9b1a24f1, 0x8bb766de), TOBN(0x595c84f4, 0xa1f8d6bd),
+    },
+    {
+	TOBN(0xacb17bf9, 0x4c02e1fa), TOBN(0x20a3b71c, 0x1dc27a05),
+	TOBN(0xd4f7a403, 0x77fa05de), TOBN(0x45100b0b, 0x42591405),
+	TOBN(0x2388f876, 0x2c5a48b6), TOBN(0x7422ed1f, 0x3eb26a70),
+	TOBN(0xff1ea3ca, 0x24772632), TOBN(0x9db33c47, 0x8aa602d4),
+	TOBN(0x3ff29fd1, 0xaa755ca5), TOBN(0xdcffedfc, 0x92fa7da6),
+	TOBN(0x0fd36fc8, 0xc00a07ab), TOBN(0xc02ed6f4, 0x7908ed9e),
+	TOBN(0xa1cfc180, 0x8604e094), TOBN(0x3da564cd, 0xe3b3867d),
+	TOBN(0x7aed0ed0, 0x02932a69), TOBN(0x42a17580, 0xc035c994),
+	TOBN(0x775a8cde, 0x5df42635), TOBN(0xe4938d99, 0xbe3a7239),
+	TOBN(0xda334b5f, 0x0d95d183), TOBN(0x96151192, 0x5c842952),
+	TOBN(0xa9451136, 0xb5f6577a), TOBN(0x9ed9882a, 0x31ac1842),
+	TOBN(0x7cbe172f, 0x7b7cb5a2), TOBN(0x3bd9626e, 0x6372944d),
+	TOBN(0xb017d8d9, 0x3ebf10f5), TOBN(0x9d11b4b1, 0x775495d1),
+	TOBN(0x8c78c165, 0x7622898f), TOBN(0xdfebfc88, 0x2dba6170),
+	TOBN(0x2e3eeb62, 0x6ed3991c), TOBN(0x6e6f99ce, 0x027d33fc),
+	TOBN(0x363449e3, 0x176ecdbc), TOBN(0xb2b909e9, 0x43f1ad7b),
+    },
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xea8d71a5, 0x75535597),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0xcd1fa34e, 0x20b681c7), TOBN(0x839847c1, 0x5e7fb2e6),
+	TOBN(0x01eee26d, 0xa9a59ee5), TOBN(0x4c316c5e, 0x27df8053),
+	TOBN(0xe824b36e, 0xfa664e25), TOBN(0x3e226571, 0x740b9dc6),
+	TOBN(0x2efff41e, 0x552102c2), TOBN(0xed961be3, 0x85f8f26e),
+	TOBN(0x88b8f191, 0x6c65c319), TOBN(0x07d3bfa9, 0x0e15c47c),
+	TOBN(0x35657bcf, 0xdbb0cd90), TOBN(0x30ba0d73, 0xe7a34750),
+	TOBN(0x2d690df6, 0xbc12ffff), TOBN(0xe15cd1a1, 0xd395c102),
+	TOBN(0x29f21161, 0xbe2f36e9), TOBN(0x5ed4b61f, 0x89c36a82),
+	TOBN(0x6b26f69e, 0xd1d0cdc2), TOBN(0x6162bff4, 0xe3f622e9),
+	TOBN(0x19db55c5, 0x5b826e63), TOBN(0xced9b231, 0x2e58e29b),
+	TOBN(0x4f742f0e, 0xb3ac6356), TOBN(0x21199fc3, 0x072b6d32),
+	TOBN(0xc487b78c, 0x01d8297f), TOBN(0x610e6084, 0xd520e010),
+	TOBN(0x1483392d, 0xbc57b430), TOBN(0xae1a897d, 0x0379a46b),
+	TOBN(0x27369fa3, 0x6caf5949), TOBN(0x2bed71fc, 0x9d04f9e4),
+	TOBN(0xd4b3ee5f, 0x9627f33f), TOBN(0x5c7f9f1b, 0x7c8b2105),
+	TOBN(0x76f10ec6, 0x81b847d0), TOBN(0x6052042d, 0xb5717547),
+    },
+    {
+	TOBN(0x43dee1eb, 0xd0f46a87), TOBN(0x87ee2efd, 0x4e5b7d1e),
+	TOBN(0xcbc53b1d, 0x30dce723), TOBN(0x8d45e3da, 0xb2062cc6),
+	TOBN(0x67faee8a, 0x8f00b739), TOBN(0x7c8f8b9f, 0x17b4bfd2),
+	TOBN(0x9f97e46f, 0x6195e47e), TOBN(0x8a68f1fd, 0x1e395597),
+	TOBN(0x14524694, 0x3913c805), TOBN(0x53d7309c, 0x480877c0),
+	TOBN(0xb86d5850, 0x76d42e72), TOBN(0xea6f9aa5, 0xe0ed84b2),
+	TOBN(0x89b8e02b, 0x8d3f82a5), TOBN(0x83bb1e2d, 0xfbdf6c24),
+	TOBN(0x813d80af, 0x76a6fb2e), TOBN(0xb270e186, 0x52503000),
+	TOBN(0x6c405e9a, 0x4cdce8f5), TOBN(0xcc6832d1, 0xe34a4c66),
+	TOBN(0x665426d4, 0xdbd8f6c8), TOBN(0xe334043f, 0x6a51a580),
+	TOBN(0x085d9e31, 0x0c0875a8), TOBN(0xb20b14b2, 0xb23de74b),
+	TOBN(0xcc8db0fb, 0xf204815a), TOBN(0xe13d1c69, 0xc330fa76),
+	TOBN(0x961b20a5, 0xc59ccd3a), TOBN(0x4e2fd854, 0xb3a67ed0),
+	TOBN(0xb890ad3c, 0x9759dac1), TOBN(0x8ce2abcf, 0x08029244),
+	TOBN(0x2736a2e9, 0x9f10a766), TOBN(0x84118d0e, 0x00473463),
+	TOBN(0xf6d412ea, 0x3499be8f), TOBN(0xdb6ce3f2, 0x0b142ac3),
+    },
+    {
+	TOBN(0xea539082, 0x3385561f), TOBN(0x1c88bf35, 0x9c96b8d0),
+	TOBN(0xacc7c7de, 0x4a51ad1c), TOBN(0xcf690713, 0x3be99be6),
+	TOBN(0x6b3dff8a, 0x6b41d6c4), TOBN(0x0a5894b4, 0x8203de24),
+	TOBN(0xf4f8e3eb, 0x69ec2569), TOBN(0x75563d32, 0x2bed0f75),
+	TOBN(0x2bb706f3, 0xe01a172b), TOBN(0x5faffcb7, 0xc87ddeb2),
+	TOBN(0xf870963b, 0x156b25c5), TOBN(0x04733dc0, 0x6405ff24),
+	TOBN(0xcb4be775, 0xc7b3e82f), TOBN(0xc564364b, 0xabd8c8c9),
+	TOBN(0x3253a47b, 0x080a5e48), TOBN(0x424df408, 0x32bd13e7),
+	TOBN(0xdf99e9bc, 0x68d1a879), TOBN(0x4fb229ca, 0x5324eb72),
+	TOBN(0xe94992bd, 0xd0e0aade), TOBN(0xe3ab083b, 0x167549fe),
+	TOBN(0x60942c74, 0xfcbc733d), TOBN(0x47d2d670, 0xd19454a2),
+	TOBN(0xb3a6da7c, 0x14cc033f), TOBN(0x3f47be6b, 0xeef24604),
+	TOBN(0x105130fc, 0xf9e95cba), TOBN(0xc12b4c65, 0x9ccebb4c),
+	TOBN(0x6fa44b74, 0xba1dd1f1), TOBN(0x4429e0c8, 0x89011f0d),
+	TOBN(0xf7c7e92e, 0xce1b8edb), TOBN(0xfb9845ae, 0x2a47350b),
+	TOBN(0x71704ca7, 0x11fa4ab2), TOBN(0x43e9d66c, 0xe4c313d4),
+    },
+    {
+	TOBN(0x9602accf, 0x88744ab5), TOBN(0xda191df0, 0x33372ac8),
+	TOBN(0xcdd25c91, 0x04dcbaf7), TOBN(0xfc7761fd, 0x91ed98d0),
+	TOBN(0xd6f0c6fd, 0x25699283), TOBN(0x2e4585a7, 0x67b84529),
+	TOBN(0x0e542e9b, 0x26a1f931), TOBN(0x2132a49e, 0xd4269e11),
+	TOBN(0x1b36edea, 0xf3b08b9d), TOBN(0x6ebf9469, 0x6b3812e7),
+	TOBN(0x976c88a5, 0xde2d1d49), TOBN(0x7ae033e7, 0xfb5939fc),
+	TOBN(0x6662c237, 0x37a366c0), TOBN(0x01820621, 0x87c100c5),
+	TOBN(0x912688a3, 0x40f6e48f), TOBN(0xad7602b7, 0x2efa3048),
+	TOBN(0x7e843f6b, 0x55c57827), TOBN(0xdcb3810c, 0x589120a1),
+	TOBN(0xb69d6eee, 0x81c9690b), TOBN(0x7bfc1c1c, 0xf2d41753),
+	TOBN(0x872329d2, 0x2b0b9a23), TOBN(0x965c8144, 0x7c615842),
+	TOBN(0xc8dd70c7, 0xa5dcc749), TOBN(0x732bd565, 0xb9952d08),
+	TOBN(0xfcef3b05, 0xfdcb1221), TOBN(0x65e94dcf, 0xbcc2626c),
+	TOBN(0xbec20095, 0xdf10a725), TOBN(0xe500aa58, 0xd799b32e),
+	TOBN(0xe953ad1c, 0xcd5ac8de), TOBN(0xdcf4bf38, 0x19276e06),
+	TOBN(0xf8d9d912, 0x977d8cdf), TOBN(0x840edb7f, 0xcde2afad),
+    },
+    {
+	TOBN(0x7382b358, 0x87e4fa16), TOBN(0x266cc7a5, 0x632248ef),
+	TOBN(0xa82bb935, 0xb877620c), TOBN(0x24ce117a, 0x0e9d731f),
+	TOBN(0x7e0fa30b, 0x88fb0fd4), TOBN(0x93af658e, 0x4d4b1371),
+	TOBN(0xac2b9ef9, 0x24e18472), TOBN(0x1ee92e41, 0xdd018feb),
+	TOBN(0x71193546, 0x02371a55), TOBN(0xa0bdceaa, 0xd53bf839),
+	TOBN(0xf54e51a3, 0x6017301d), TOBN(0x2c3d3bec, 0x3b0a0fd3),
+	TOBN(0x3649e477, 0xf1f46910), TOBN(0x7122cbff, 0x702aef4d),
+	TOBN(0x50c8ef07, 0x354091c0), TOBN(0x841fdaa2, 0x6d4613f6),
+	TOBN(0xace0c7b2, 0x38043100), TOBN(0x74642c9a, 0x9bb68bd2),
+	TOBN(0x6ef0ba9f, 0x7d75bbb6), TOBN(0x087c77ba, 0xdfcd9d78),
+	TOBN(0x42492bf6, 0x82488a0b), TOBN(0x9c5a1f3d, 0xdd072997),
+	TOBN(0x1bb861df, 0x3957a9a6), TOBN(0x40be8339, 0x4a926d06),
+	TOBN(0x38d3656d, 0xe22dd347), TOBN(0xb06d6696, 0x12ec390e),
+	TOBN(0x929d717a, 0xcd133285), TOBN(0xfe42a506, 0xbca0b0ee),
+	TOBN(0x4602d569, 0x311681d5), TOBN(0xce987ec1, 0xfa2b00a7),
+	TOBN(0x4dc67fa5, 0xa85ef597), TOBN(0xcfb03324, 0x0207ed6d),
+    },
+    {
+	TOBN(0x2f198b82, 0x05b2aeca), TOBN(0xbbf5649f, 0x5b0c481b),
+	TOBN(0x1c0267e7, 0xc09f9ac7), TOBN(0x40fdc923, 0x9f497289),
+	TOBN(0x48788b8b, 0x614a678d), TOBN(0x4c617e6f, 0xe13c05c7),
+	TOBN(0x814260cb, 0xbaeae2fd), TOBN(0xf47c80c5, 0xfc4ae38b),
+	TOBN(0x746f28a9, 0xf77e2d07), TOBN(0xc39ec551, 0x9437fa79),
+	TOBN(0x4a664bd6, 0x254d4788), TOBN(0x49b4f08a, 0x9cb11aae),
+	TOBN(0xa9433f11, 0x7c95417e), TOBN(0x5cebe45e, 0xc5f44bb8),
+	TOBN(0x007823d4, 0x7617efbd), TOBN(0x607ce057, 0xdb876c17),
+	TOBN(0xfa3a47fa, 0xc8368d2b), TOBN(0xdffbb87f, 0xdfa0ec35),
+	TOBN(0xc5683d1e, 0x4abf9e04), TOBN(0xb5a753ae, 0x09b39092),
+	TOBN(0x2552ccc9, 0x4b57e07e), TOBN(0xbf4e762e, 0xf4396903),
+	TOBN(0x315a59c4, 0xbf7afd9d), TOBN(0x53adc720, 0xe0864e81),
+	TOBN(0xeaafb0ff, 0x70c3b182), TOBN(0x2a91159b, 0x08ec5c88),
+	TOBN(0x349c1a96, 0xe721f2e3), TOBN(0x5188dc40, 0xc1a02f5b),
+	TOBN(0xe755a312, 0xcbcf40cd), TOBN(0x5981cf9d, 0x29bbb4dc),
+	TOBN(0xe6b28f3c, 0xdfbf1270), TOBN(0x25ae4e0d, 0xc1828e37),
+    },
+    {
+	TOBN(0xd76473ad, 0x0767f782), TOBN(0xee659e48, 0xa98df603),
+	TOBN(0xc2dc968f, 0x93645242), TOBN(0xdd9d4d33, 0x23864a93),
+	TOBN(0x5a41add4, 0x82aa053b), TOBN(0x06fb3607, 0xb84cd01c),
+	TOBN(0xc52ec284, 0x2de99744), TOBN(0x3ca3b93b, 0x17a6012e),
+	TOBN(0xe86c545f, 0x968aa84a), TOBN(0xa72ab35f, 0x29a095a5),
+	TOBN(0x200b1c92, 0x79665735), TOBN(0xa8bdfd76, 0xd7b3efa9),
+	TOBN(0xab5113a9, 0x84cc1cc1), TOBN(0x088075ac, 0xf4de02d6),
+	TOBN(0x0c633dd3, 0x97da508e), TOBN(0x315aae4d, 0xef4674f8),
+	TOBN(0xbd80ebf2, 0xf0000293), TOBN(0x4e2c62d7, 0x907dff11),
+	TOBN(0xcec6d4fe, 0xc2945dec), TOBN(0x25eea927, 0x0f65c4b8),
+	TOBN(0x3d208124, 0x5ed2b99e), TOBN(0x5533ab0a, 0x49051e13),
+	TOBN(0xa3650faf, 0xeeceeeaa), TOBN(0x2e7fbf12, 0xfa7c7bb3),
+	TOBN(0x10c28d50, 0x31230299), TOBN(0x6939c150, 0xda05188c),
+	TOBN(0x93e67aa5, 0x0a7cc9fb), TOBN(0x70a0fcb8, 0x2dab4966),
+	TOBN(0xe8739d80, 0x851d4096), TOBN(0xbbd4308d, 0x51bf2714),
+	TOBN(0x0eb609bb, 0x9a4ffd63), TOBN(0xb34e17f9, 0xca8bef91),
+    },
+    {
+	TOBN(0x4b1309ea, 0xdaaed341), TOBN(0x8f095893, 0x6d8689df),
+	TOBN(0xf12b963e, 0x7458608a), TOBN(0xe6d183b0, 0x51547ea1),
+	TOBN(0x04526431, 0x6d09b119), TOBN(0xd9f78d8c, 0x5f25d47c),
+	TOBN(0x68fb2fde, 0x351e5685), TOBN(0x1d4c2c12, 0x383ce04e),
+	TOBN(0xfdd59633, 0x23779e75), TOBN(0xf204ca64, 0x966c27ea),
+	TOBN(0xc4acac6b, 0x6f217233), TOBN(0x3951354e, 0x5b51a81c),
+	TOBN(0x9c04e8a0, 0x0883faef), TOBN(0x2aaf8a49, 0xdbdf1974),
+	TOBN(0x8462c361, 0x35ae156c), TOBN(0xfc331805, 0xf890986a),
+	TOBN(0xfd04e97f, 0x278e0c6e), TOBN(0xb15e7cec, 0xaafbb0bc),
+	TOBN(0x91591467, 0x62dfc68a), TOBN(0x5d7ef3ca, 0x8d062080),
+	TOBN(0xa75817e7, 0x3e52ef90), TOBN(0x4f7f71fd, 0x937cfbb8),
+	TOBN(0xe3ebdebd, 0x8267b8bf), TOBN(0x7adbee23, 0x5071a751),
+	TOBN(0xb8bd448f, 0xc783d99a), TOBN(0x6370b7ae, 0x10a413c2),
+	TOBN(0x74a22c62, 0xbba55065), TOBN(0xd5bb5e92, 0x4ee26b47),
+	TOBN(0xf3b74ca4, 0x0a88ce10), TOBN(0x29ea22e0, 0xab9c1b82),
+	TOBN(0xe54c5e53, 0x058f9704), TOBN(0xb675e4de, 0xead5f025),
+    },
+    {
+	TOBN(0x38a47784, 0xeef9c6a4), TOBN(0x16141b71, 0x79c41726),
+	TOBN(0x6b8c3df2, 0xca67c480), TOBN(0x907615cd, 0xf908c1b2),
+	TOBN(0x7125d999, 0xb78e5022), TOBN(0xb6755b89, 0x0255f2ab),
+	TOBN(0xa0c1d793, 0x99684793), TOBN(0x97da6bf9, 0xdb45fb57),
+	TOBN(0x9a0e929d, 0x24144590), TOBN(0x661accb6, 0x5933ccdc),
+	TOBN(0x585697b7, 0xd28f92ed), TOBN(0xe56bb866, 0x917c4abd),
+	TOBN(0xef92e279, 0xeaa7639e), TOBN(0x661d9abf, 0xc1e5b247),
+	TOBN(0xc65b6917, 0x9fcebc96), TOBN(0xd7d89c6e, 0xc416983b),
+	TOBN(0xf3c23928, 0x552a4573), TOBN(0xcc35631b, 0x3987cfd7),
+	TOBN(0x01bd94cb, 0xfefbc8c8), TOBN(0x4b46069b, 0x626ca554),
+	TOBN(0x84604517, 0x23274c66), TOBN(0xefe5a0f8, 0x0a58bf0a),
+	TOBN(0x1e665b97, 0x30f5793b), TOBN(0x408c90a0, 0x64a7b8f8),
+	TOBN(0xcce87f9d, 0xf6fcf908), TOBN(0xe7ad66f8, 0x0f463c1f),
+	TOBN(0x6b44ecc1, 0xae73c1bf), TOBN(0xda2e55bf, 0xf7282c81),
+	TOBN(0x2222802d, 0x2eaa27dc), TOBN(0xe5d3b856, 0x7eee0b91),
+	TOBN(0xd93f91c1, 0xe4c61f6c), TOBN(0x22e31ec6, 0xa004578b),
+    },
+    {
+	TOBN(0x88c2f821, 0xe39be283), TOBN(0x68e9c49a, 0x35943cad),
+	TOBN(0xade160b7, 0xb6c0d5b6), TOBN(0xbf3d900b, 0x0d97438f),
+	TOBN(0x41bdd664, 0x2b698591), TOBN(0x50276c4e, 0x38aa1421),
+	TOBN(0xb71ac13d, 0x35941ada), TOBN(0x0cdd2902, 0x75e482e5),
+	TOBN(0xf212dd6c, 0x6ece19a3), TOBN(0x115a83b1, 0xf430fd0a),
+	TOBN(0x945f6097, 0xe4e2958b), TOBN(0xe108f869, 0xbde0b14d),
+	TOBN(0x05f14e5a, 0x142f30ba), TOBN(0xd9374a37, 0x93cda72f),
+	TOBN(0x6cf03640, 0xfb295965), TOBN(0x48b87bd2, 0xc0646099),
+	TOBN(0x58e960ce, 0x4bf2462e), TOBN(0x2bc42b21, 0x30f9a580),
+	TOBN(0x3cdf0933, 0x3c4b50da), TOBN(0xf9938922, 0xf8e3dd9b),
+	TOBN(0xc1a97436, 0xa0a10749), TOBN(0xb157184b, 0xa0889cc2),
+	TOBN(0x11820344, 0x35832945), TOBN(0xf8057abc, 0x1d0c8b8b),
+	TOBN(0x6b310faf, 0x55498896), TOBN(0x2bea1c2e, 0x83fa6de7),
+	TOBN(0x870c1b73, 0x68956bbd), TOBN(0xc25b663c, 0xd09d59d3),
+	TOBN(0xeb45d3c8, 0x7d556d78), TOBN(0xf6b2d2ff, 0xa297b2a2),
+	TOBN(0xd66ca6f3, 0xd8db9b28), TOBN(0xefa8199e, 0x6f0bba30),
+    },
+    {
+	TOBN(0x3f8a4f7f, 0x2f420a43), TOBN(0x65ce96a5, 0xfb7ae40d),
+	TOBN(0xa68e626a, 0xf5cb4aea), TOBN(0x9c61e9e3, 0x8e9f04b5),
+	TOBN(0x9bf8cd98, 0x11566e20), TOBN(0xf4ca70f6, 0x4d909ae9),
+	TOBN(0xf4d01838, 0x1f93dec1), TOBN(0x57756718, 0x21b45c22),
+	TOBN(0xe44faee2, 0x23fdaff7), TOBN(0xceffc244, 0x9d483473),
+	TOBN(0x295e84ee, 0x42cc2c78), TOBN(0xfed55f4c, 0x5b6d9818),
+	TOBN(0x78be2494, 0x5425ed5c), TOBN(0x876600c3, 0xec3c70b4),
+	TOBN(0x31c109bd, 0x989a5821), TOBN(0xdbe26703, 0x66f29338),
+	TOBN(0xbde63c17, 0x8f6a8b22), TOBN(0xfba3b153, 0x2c148cc9),
+	TOBN(0x4a2857c7, 0xe3310bf1), TOBN(0x8b618efc, 0x66a5ffd7),
+	TOBN(0x0102013f, 0xc5f4c087), TOBN(0xb598ef83, 0x175a676a),
+	TOBN(0x5ad601de, 0x9c6d691e), TOBN(0xe0a232f5, 0xb56c7891),
+	TOBN(0x93ab991a, 0xc65aca08), TOBN(0x791c8978, 0xfd63e14a),
+	TOBN(0xb5718e32, 0xe41e637d), TOBN(0xf7d46191, 0x24d8607e),
+	TOBN(0x52ceec9c, 0x6f49dd8e), TOBN(0x1dd22c19, 0x20aac487),
+	TOBN(0xc75e0b6a, 0x729ece4c), TOBN(0x144773d5, 0x5f99a651),
+    },
+    {
+	TOBN(0x587ded54, 0x71e18b54), TOBN(0x9c1c1fb6, 0xabf14543),
+	TOBN(0xa8d51001, 0xde52ffc5), TOBN(0xb4f2b1a0, 0x17f35dd8),
+	TOBN(0x097fffa5, 0xe20cb42d), TOBN(0x9c6c4858, 0xb0bae273),
+	TOBN(0x2838ba16, 0x105a577f), TOBN(0x672961c3, 0xdbd3e542),
+	TOBN(0xe5ce60e5, 0xc8dc4b36), TOBN(0x7ec119ca, 0x01236f6d),
+	TOBN(0x171e0ee5, 0x50a4de66), TOBN(0x28d7bea2, 0x1a5ca280),
+	TOBN(0x856968a7, 0xbca5ea93), TOBN(0x4c7de6bf, 0x04fb5bc0),
+	TOBN(0xd3e28798, 0x20a5b64f), TOBN(0xf0cb1550, 0xdfdb6181),
+	TOBN(0xab51e867, 0x862f4c45), TOBN(0x123371f0, 0x4e211f54),
+	TOBN(0xe0828f5f, 0xd812b1ba), TOBN(0x1034b422, 0x6bb4c91e),
+	TOBN(0x55dd39f3, 0xd81d5437), TOBN(0x1a7a71d8, 0xcd9c9f07),
+	TOBN(0x60339000, 0x2309eef0), TOBN(0x435486fa, 0xa47abb23),
+	TOBN(0xbc6f868e, 0x0011a4c0), TOBN(0xb16c4c37, 0xc475c8ed),
+	TOBN(0x096f15a4, 0xc176dd47), TOBN(0xa3d91b5f, 0xff11df29),
+	TOBN(0x4b360e27, 0xf777119e), TOBN(0x46337c6a, 0x53e25e0a),
+	TOBN(0xa13f49a0, 0xbdb85b78), TOBN(0x50289750, 0xd6e4e60c),
+    },
+    {
+	TOBN(0xaf721231, 0x125ba462), TOBN(0x535e9325, 0x04a09aeb),
+	TOBN(0xe63812d9, 0x28a6a21d), TOBN(0xc834bfbe, 0xa58f0fde),
+	TOBN(0xe5637a89, 0x9187653a), TOBN(0xd19a268c, 0xbf14b82d),
+	TOBN(0xefe4748a, 0x69fa3d8e), TOBN(0x32e71426, 0x562ded21),
+	TOBN(0x5d4b1288, 0x3bb32ce8), TOBN(0x1f29a321, 0xa1d8dec3),
+	TOBN(0x40735f3f, 0xcd81a4a7), TOBN(0x97f12607, 0x8faeacdc),
+	TOBN(0xa9121f89, 0x7f524b52), TOBN(0x4edabae6, 0xa72efac3),
+	TOBN(0xdb6b664c, 0x69fa381e), TOBN(0xfcbebe51, 0xb9ed2f7c),
+	TOBN(0xc33de825, 0x08523940), TOBN(0x314f53c0, 0x8c1abfda),
+	TOBN(0xc2d73bc4, 0x362672ec), TOBN(0x3384037c, 0x5a768279),
+	TOBN(0x706e2141, 0x20da4ca6), TOBN(0xf3f446be, 0xbdcd02fd),
+	TOBN(0x3fe934f1, 0x7edf8996), TOBN(0xb377d96b, 0xdc1693b4),
+	TOBN(0x559b7b1c, 0xe7c23463), TOBN(0xfc4cf98f, 0x0b534fed),
+	TOBN(0x1281ee19, 0xc791caaa), TOBN(0x8a37578e, 0xbcb15e29),
+	TOBN(0x298cb7a0, 0xfc26b50b), TOBN(0xf5be05e1, 0xaec503b1),
+	TOBN(0xf5a46f43, 0xff3e234a), TOBN(0x2ad58b3b, 0xaa29af5f),
+    },
+    {
+	TOBN(0x9c0799f2, 0x0c82bb52), TOBN(0xc2b98ad7, 0x1ab7a3cc),
+	TOBN(0x8d5200ca, 0xd18838fd), TOBN(0xe2bfca0b, 0x37ff5a6f),
+	TOBN(0x8056ed97, 0x645b2bbe), TOBN(0x7bbe1ae3, 0x8afdf5f8),
+	TOBN(0xa4e63c37, 0x86ff1227), TOBN(0x7a820c81, 0xae4606c4),
+	TOBN(0xdada14a3, 0x204e0ed4), TOBN(0xc216696c, 0xf58c3f21),
+	TOBN(0x6e13d1ff, 0x3e5c9755), TOBN(0xcf48045e, 0xa018ac7c),
+	TOBN(0x15c45a71, 0x8df591fa), TOBN(0x5199bd1e, 0xbb3490ec),
+	TOBN(0x574a5d61, 0x4954dcd3), TOBN(0x37a54dcd, 0x3a102383),
+	TOBN(0xd96a6de2, 0x095aa440), TOBN(0x40526254, 0xe282b54c),
+	TOBN(0x349455fb, 0x37bc865f), TOBN(0xb1cdcbe0, 0x953ee408),
+	TOBN(0x5df4f3a7, 0x0eab31bc), TOBN(0xd304b5e0, 0x174998dd),
+	TOBN(0xcd995c13, 0xf07fa15c), TOBN(0xca37cdfc, 0x6248e16c),
+	TOBN(0xced3da20, 0x1b29adeb), TOBN(0x508d105d, 0xed1e020d),
+	TOBN(0x9ec9d2a3, 0xb2635e23), TOBN(0x798d2e4a, 0x2be7ecaf),
+	TOBN(0xf721bfce, 0x9aab60ed), TOBN(0xc1ab5414, 0xddc9d9cd),
+	TOBN(0x78816e61, 0x8352f31d), TOBN(0x5acd1fdd, 0x3a1e2618),
+    },
+    {
+	TOBN(0x656684e3, 0x17ad49fb), TOBN(0x679f9b34, 0x1c90727c),
+	TOBN(0x45e16021, 0x0f386960), TOBN(0x524cb1fd, 0x5fd85487),
+	TOBN(0x7ef94d2c, 0x49cfb667), TOBN(0x4bd79c0f, 0x2bbe538a),
+	TOBN(0x3c459c85, 0x30c79a2a), TOBN(0x8ee6e27f, 0xb11ca110),
+	TOBN(0xdf4506c0, 0x3735de3e), TOBN(0x0a1782a2, 0x58da32f4),
+	TOBN(0x39147ff7, 0xd0ca03d5), TOBN(0x203b5dc5, 0x26231a92),
+	TOBN(0x4460e1bb, 0xa00580ab), TOBN(0xf9b670b8, 0x94662b49),
+	TOBN(0x5bc033b4, 0xaadf9f89), TOBN(0x5e4c3e57, 0x3494915e),
+	TOBN(0x6a89442a, 0x94672b0e), TOBN(0x606f8f12, 0x99b5b470),
+	TOBN(0xdbeaa8e3, 0x06fe708c), TOBN(0x2164e71c, 0x272969ea),
+	TOBN(0x0644d007, 0x77e36404), TOBN(0x396719c4, 0x157ac802),
+	TOBN(0xad187414, 0x2c577e6b), TOBN(0x418111bb, 0x6e681140),
+	TOBN(0x42023f4f, 0x78e770ff), TOBN(0xf9fd1068, 0x5d6f35f6),
+	TOBN(0xb24d8dbf, 0x668958e4), TOBN(0x8ccb1a1d, 0x4fa4c2ce),
+	TOBN(0x9907a00d, 0xd875c0c5), TOBN(0xc964e790, 0x47679d5f),
+	TOBN(0x09e830a1, 0x9f17b5df), TOBN(0xb8361742, 0x51773ccf),
+    },
+    {
+	TOBN(0xa39078b4, 0xc9f406c5), TOBN(0x5af0ebbb, 0x9f2dc15e),
+	TOBN(0x4b5f891c, 0xc36318cc), TOBN(0xc50bcd5d, 0x98efc23b),
+	TOBN(0x4befdb24, 0x55fad88e), TOBN(0xf07cfaa6, 0x8cc3b4e7),
+	TOBN(0xbd6457a6, 0x8a4b8a5c), TOBN(0xc583d870, 0x9c4cd2f0),
+	TOBN(0x002925ef, 0x681d0a7a), TOBN(0xa38ea0cf, 0xf20b710f),
+	TOBN(0x4d474822, 0xb1648364), TOBN(0xabc587aa, 0x47dd20fb),
+	TOBN(0xb948e582, 0x8138974d), TOBN(0xfad7e5e5, 0x1e6cc0e8),
+	TOBN(0x6eff81fe, 0xe8c97de8), TOBN(0x13b1f19d, 0x89a34fb4),
+	TOBN(0x90b23988, 0xe672ade2), TOBN(0x32e1e30f, 0xf1b77054),
+	TOBN(0x40633073, 0x13157e26), TOBN(0x305b2225, 0x18cd095b),
+	TOBN(0x91590b57, 0x376be2e1), TOBN(0xe57b508b, 0xcc65e078),
+	TOBN(0x395bf2ff, 0xdd51dd09), TOBN(0xbbe11807, 0x0a325a39),
+	TOBN(0xef8c916c, 0x9ac8499a), TOBN(0xac948403, 0x55e0cd53),
+	TOBN(0xa1d4139e, 0xe955e405), TOBN(0x88732dd0, 0x1ab6b363),
+	TOBN(0x3de07e72, 0x3cf7187b), TOBN(0x5b01b5d9, 0xf482f3cd),
+	TOBN(0xe1de1094, 0x44324d5e), TOBN(0x89dc4a54, 0xa35fe463),
+    },
+    {
+	TOBN(0x75e5f602, 0xa2c029da), TOBN(0xd2a71384, 0xa133b001),
+	TOBN(0xd626a039, 0xd3c85820), TOBN(0xa081d107, 0x6bac3fd4),
+	TOBN(0xfa838369, 0x74129774), TOBN(0x446c6252, 0x440f6784),
+	TOBN(0x16725504, 0xd099ef88), TOBN(0xdc4155b7, 0x38697e8b),
+	TOBN(0x2b9f9ab5, 0xdb175dc8), TOBN(0x8f90a550, 0x413da7b9),
+	TOBN(0x4cfa9839, 0x666e5510), TOBN(0x9ca0b2f5, 0x8af2d055),
+	TOBN(0x2540f1dd, 0x5c1091f6), TOBN(0x48173c43, 0x00f13a94),
+	TOBN(0xdd235ef5, 0xc2cb09c5), TOBN(0x3c2c9e56, 0xfdb25c3d),
+	TOBN(0x279b0c53, 0x0a606c8a), TOBN(0x8ef61d37, 0x7cb3a1e7),
+	TOBN(0xc5038e57, 0xaeeef361), TOBN(0x19f3bf23, 0xe22f0f64),
+	TOBN(0xe8cacae1, 0x9313719d), TOBN(0x6664b470, 0x7d67b771),
+	TOBN(0x339fb676, 0x8a1e130b), TOBN(0x9dd0fbdc, 0x471a4fbb),
+	TOBN(0x6e23b292, 0x0059d87f), TOBN(0x2d74e346, 0x416b907e),
+	TOBN(0x1f225381, 0xd195ad8f), TOBN(0xf8262509, 0x7ea02ad7),
+	TOBN(0xdd8b2f46, 0xdef8eee2), TOBN(0x2a1e63d7, 0xfc8916e4),
+	TOBN(0xbc89fc65, 0x340246b8), TOBN(0xbb2afae6, 0xb74bcee9),
+    },
+    {
+	TOBN(0x2036560c, 0x7165a3ad), TOBN(0x98a3105e, 0xe07d2e75),
+	TOBN(0xd20f9e6d, 0x39c7a618), TOBN(0x1b625e31, 0xe91368e1),
+	TOBN(0xbf68a737, 0xdb044eee), TOBN(0x02f1ccca, 0x12b51f7e),
+	TOBN(0x89fa914c, 0xb16227fe), TOBN(0x760f8bed, 0x150100f7),
+	TOBN(0x842cbe8b, 0xc7f8abde), TOBN(0xc685ec71, 0x32d6b78c),
+	TOBN(0xaafdd7b9, 0x05d07b3f), TOBN(0x787aec48, 0xde898e9c),
+	TOBN(0xe6814ed9, 0x85d34118), TOBN(0x6625f946, 0xebe160bd),
+	TOBN(0x895604cf, 0x2bbed830), TOBN(0xc52fcfe2, 0x319f49ee),
+	TOBN(0x4facbae5, 0xec69c201), TOBN(0xbd3f8ae9, 0x3c65159f),
+	TOBN(0xe48b2a2f, 0xf88734eb), TOBN(0xc544551f, 0xc5db47f2),
+	TOBN(0xb0db622a, 0x5f011a54), TOBN(0x558f230a, 0xb51d6aa1),
+	TOBN(0x9ec4abfa, 0xd7448796), TOBN(0xdeb29d3b, 0x86f51440),
+	TOBN(0xe3ae5a51, 0x43775116), TOBN(0x8ccf1b8e, 0x9cfc6b7f),
+	TOBN(0xabc833c3, 0x3eb72816), TOBN(0xb108248a, 0xc556c011),
+	TOBN(0xd417bb4a, 0xb5fc4d03), TOBN(0x1d29a545, 0xbaca21e2),
+	TOBN(0x13f14f07, 0x593b3f95), TOBN(0xa0944e18, 0x1e4b5775),
+    },
+    {
+	TOBN(0x2ae8d7ed, 0x853fbeec), TOBN(0x4d5af82b, 0xe20844dc),
+	TOBN(0xcb969277, 0x9cb6b05d), TOBN(0x3cf20022, 0x7d9c5ed9),
+	TOBN(0xc29a32e2, 0x0457d1f4), TOBN(0x328407e9, 0x79a3d076),
+	TOBN(0x795640b4, 0xf6617697), TOBN(0x1b70735f, 0x2d718744),
+	TOBN(0x9984dd6f, 0xe507c500), TOBN(0x116fceba, 0x748d0811),
+	TOBN(0xdfb80f57, 0x27884951), TOBN(0xf08cd294, 0xff078942),
+	TOBN(0x64a3dc15, 0x5e130c38), TOBN(0xdc5d891d, 0x90eac577),
+	TOBN(0x17cc3167, 0xa7fc4c23), TOBN(0xf3cc061c, 0xa74d64fc),
+	TOBN(0x18d8982e, 0x8dd05f26), TOBN(0xf5bfc435, 0xe80982c4),
+	TOBN(0x5aa17434, 0xa8b33ca0), TOBN(0x34793f7a, 0xab2ff0d2),
+	TOBN(0xf69bc7cc, 0xd0bcbbdd), TOBN(0xbe7f61db, 0xe571e9ea),
+	TOBN(0x689c1a02, 0x370388e9), TOBN(0x5c84ce4e, 0x2eaa9749),
+	TOBN(0x9362d7a7, 0x24bdd464), TOBN(0x999e2a6f, 0xccd2e62a),
+	TOBN(0xf98ede69, 0xda71d41c), TOBN(0x0893cecd, 0x5ff4bcb9),
+	TOBN(0xb267f678, 0xe2268a84), TOBN(0x275080a4, 0xf983ff19),
+	TOBN(0x255e0220, 0x0ace1391), TOBN(0x9524bc88, 0x827c8bde),
+    },
+    {
+	TOBN(0x9b42158f, 0x6e028603), TOBN(0xb9b3531f, 0xbc61fb5c),
+	TOBN(0x0caa84b1, 0x897ff49a), TOBN(0xc426884c, 0xfafb8176),
+	TOBN(0x75e1ee0d, 0x0e887cc8), TOBN(0x7b7a50ad, 0x74288d5f),
+	TOBN(0xb17d3aab, 0x91cd8ee2), TOBN(0xa2976cb3, 0xd401eaf0),
+	TOBN(0x546794ef, 0x439d871a), TOBN(0xf1a9c387, 0x6c9052cd),
+	TOBN(0x6afde19a, 0x25449f34), TOBN(0x24bfda11, 0xbd18309a),
+	TOBN(0x2c5b46f1, 0x93e02154), TOBN(0x23a7d432, 0x928f2edb),
+	TOBN(0xc99b5e0a, 0x30349759), TOBN(0x1d646d22, 0x67d6118c),
+	TOBN(0x98f9e6d9, 0x684c6580), TOBN(0x1216bf33, 0x03df230b),
+	TOBN(0x59aead7c, 0x736b6e92), TOBN(0x1bbbf68d, 0x6df287da),
+	TOBN(0x574a6193, 0xb24ba027), TOBN(0xc8aad921, 0xaae172c1),
+	TOBN(0x7534ed3c, 0x923dbb86), TOBN(0x1a624175, 0x3e1af047),
+	TOBN(0xa2a741a4, 0x57bfdda0), TOBN(0x8006622e, 0x1e93b9b9),
+	TOBN(0x16b87cd3, 0x65de09ac), TOBN(0xd1fbb620, 0x9d68dbe6),
+	TOBN(0xdc62421f, 0x26e0e0c3), TOBN(0xfac5fa3c, 0x3dc9d8a7),
+	TOBN(0x836cefd9, 0x60367118), TOBN(0x5637b97e, 0x8baff076),
+    },
+    {
+	TOBN(0x85f71ecb, 0xa72f5196), TOBN(0xd5f8150d, 0x1186814c),
+	TOBN(0x0be2241f, 0xe8b2037e), TOBN(0x6490aa54, 0xe3dcce15),
+	TOBN(0x311635e2, 0xaa83b796), TOBN(0x3cb7c8f5, 0x1b908813),
+	TOBN(0xdb5ad8a1, 0xe6e2c9a1), TOBN(0x9b69bb96, 0xbd09d689),
+	TOBN(0xe994ef32, 0x2eb1c1e5), TOBN(0x94306c35, 0x7b38c597),
+	TOBN(0xa665bbd5, 0xed35303a), TOBN(0x4e3e8945, 0x1fe89aac),
+	TOBN(0x84d9bb01, 0x444ca38f), TOBN(0xea1d5b06, 0x6cf7fd17),
+	TOBN(0x1dc2ec97, 0x1d49a74d), TOBN(0x1af62665, 0x720ee910),
+	TOBN(0x408e8abf, 0x19ac169f), TOBN(0x9d37bd62, 0x20e92cf3),
+	TOBN(0x71b26b36, 0x9e756d80), TOBN(0xf3e7afd9, 0xb27d7d83),
+	TOBN(0xb7dbb21d, 0x24ec92e5), TOBN(0xb59b17b8, 0x249f6da9),
+	TOBN(0xf9b56720, 0x9ddc1de5), TOBN(0x2210edbb, 0xb488add9),
+	TOBN(0x31daf04c, 0xc32d5545), TOBN(0xa560511e, 0x82a07d0f),
+	TOBN(0xfa1d2de8, 0x29bd14f7), TOBN(0x43a49259, 0x930cad21),
+	TOBN(0x89fc3098, 0x07912011), TOBN(0xe616e5e5, 0x7df615d6),
+	TOBN(0xe3d6d56e, 0x68878470), TOBN(0x7e514774, 0xdb6a9335),
+    },
+    {
+	TOBN(0xee2d880f, 0x997af973), TOBN(0x693b3f74, 0x4204586d),
+	TOBN(0x94796a68, 0xc691f0a9), TOBN(0x5756c7f2, 0x4e6e3146),
+	TOBN(0x0b825507, 0xdebc7483), TOBN(0xed668991, 0xdfc25827),
+	TOBN(0xf45a9b61, 0xf010bf82), TOBN(0xc08a202e, 0x1b475f1a),
+	TOBN(0x832dadd6, 0x84c2d9f8), TOBN(0x2c009b24, 0xd9bdab96),
+	TOBN(0x68176113, 0x4f93f4e7), TOBN(0xefd193c7, 0x84b85eed),
+	TOBN(0x0b84a052, 0x2511c60e), TOBN(0x4e5e03a7, 0x669965d6),
+	TOBN(0x6917716d, 0x5c80d505), TOBN(0x40ee37c7, 0x9be09279),
+	TOBN(0xeac8c8c6, 0xb9ee5957), TOBN(0x2c3db99d, 0x0d6b82b2),
+	TOBN(0x77db1d32, 0xfc8148c9), TOBN(0x42d02839, 0x3cdffced),
+	TOBN(0x5c469078, 0x30d77989), TOBN(0xc6415c8e, 0x951ebcba),
+	TOBN(0x29303c4b, 0xdd57c47c), TOBN(0xc4a813a8, 0xc1bcce9b),
+	TOBN(0x5e81b4d8, 0x75c0ddc4), TOBN(0x025c1e51, 0x51c2f45d),
+	TOBN(0xe1f00a5a, 0x02b6eba8), TOBN(0x6d8ab003, 0x5c56fd2b),
+	TOBN(0x2beb607e, 0x5213bd17), TOBN(0xb6362924, 0x1dfd30cb),
+	TOBN(0xe1f4b013, 0x8d0f793a), TOBN(0x33932ce6, 0x25b995b5),
+    },
+    {
+	TOBN(0x41ba68b3, 0x9319e20a), TOBN(0x535c8d8d, 0xb70370f9),
+	TOBN(0xaf1f00e9, 0x4f0f0ac1), TOBN(0xa5b16ff0, 0x96b0a954),
+	TOBN(0x38289cd3, 0x416f41d9), TOBN(0x8858ba81, 0x8121bb95),
+	TOBN(0x4233171f, 0xa8827fb3), TOBN(0xca0aeac6, 0x2297ce66),
+	TOBN(0x620a0d96, 0x2137af7a), TOBN(0x1b75dfb5, 0x6cceb7c2),
+	TOBN(0xb29b80f2, 0x91b2bd49), TOBN(0x538eee60, 0x20c8940d),
+	TOBN(0xe6fce03e, 0xd2e66a01), TOBN(0x8ee2b82c, 0x91c1ab8a),
+	TOBN(0x51ef2073, 0x21b63440), TOBN(0xadf4ea81, 0xe7c0d43c),
+	TOBN(0x3683ee0c, 0x0ac3cafa), TOBN(0x7b8fdbf6, 0xfa965fbb),
+	TOBN(0x6bd6ea51, 0x4bbd1924), TOBN(0x1d653417, 0x63ca4e8a),
+	TOBN(0xeddc9c39, 0x980fce71), TOBN(0x4c5ba478, 0xe34c1557),
+	TOBN(0x0c5332c7, 0x30104780), TOBN(0xff4cb6b2, 0x0d7cface),
+	TOBN(0x87a69a08, 0x7381861a), TOBN(0x25f54ab4, 0x6e0feac5),
+	TOBN(0x265a0a6a, 0x13bc73a8), TOBN(0x5172cc68, 0x5f3a24fc),
+	TOBN(0xa73df233, 0xae02270f), TOBN(0x4adaeeda, 0x430ef52d),
+	TOBN(0x2dd7c0f3, 0x6c94889f), TOBN(0x564b1659, 0x89d0c8ff),
+    },
+    {
+	TOBN(0x4cedc38e, 0x2254f2a2), TOBN(0x6839a35f, 0xac6464a7),
+	TOBN(0xc65ce9ed, 0x13c8d0dc), TOBN(0xea449138, 0x2bac744d),
+	TOBN(0x514008eb, 0xa707c40a), TOBN(0x6bce1cf2, 0x2b3b0a85),
+	TOBN(0x869d0f45, 0xfa23d08e), TOBN(0x27c93f65, 0x568034f3),
+	TOBN(0x6e45f849, 0xb6195564), TOBN(0xa4ec9f82, 0xd753475d),
+	TOBN(0x4a1da84e, 0xd72b700a), TOBN(0xe968c976, 0x88af9924),
+	TOBN(0x5b8dc2c6, 0xe25fb8f1), TOBN(0x25477ab9, 0xafc643d0),
+	TOBN(0x9aceeee5, 0x52b81c2b), TOBN(0x2166c3da, 0x35085182),
+	TOBN(0xdb0dc3e5, 0x2179f424), TOBN(0xe341f99a, 0x9f5c1ee8),
+	TOBN(0x8f7b057d, 0x43490f4f), TOBN(0x6378386d, 0x2f31da3a),
+	TOBN(0x4ea5e031, 0x0ce5d26f), TOBN(0x4c34cdaa, 0xf0926672),
+	TOBN(0x096e41fa, 0x6fbc9f89), TOBN(0x3404658e, 0x938b978a),
+	TOBN(0xc62202fd, 0x70de741c), TOBN(0xbf678949, 0x4b0734a8),
+	TOBN(0x52a354da, 0x331cc649), TOBN(0x462e1031, 0x27b364ea),
+	TOBN(0x1ce20433, 0x44d59bdb), TOBN(0x405905d4, 0xeb02a645),
+	TOBN(0x978deab6, 0x1250b40a), TOBN(0x6d4b25b1, 0xc3d6791f),
+    },
+    {
+	TOBN(0x509b8f21, 0xc40c93ab), TOBN(0x0aefa43b, 0x8582f557),
+	TOBN(0xf6d82f90, 0xdd2e81a1), TOBN(0x00ba567f, 0xffca6d85),
+	TOBN(0x84eacbf1, 0xa4ba2264), TOBN(0x8143448c, 0x4d66d344),
+	TOBN(0xe92fba9f, 0x6fc021da), TOBN(0x83365253, 0x562e7a81),
+	TOBN(0xd591cfcd, 0xe03740a8), TOBN(0x76921d16, 0x98578681),
+	TOBN(0x6ef6a5bb, 0xddf0c724), TOBN(0x36167452, 0x6c70ac19),
+	TOBN(0x6d32a163, 0xe3663b21), TOBN(0xb02c115b, 0x6abed0ff),
+	TOBN(0x8b344473, 0x54cd9862), TOBN(0x51596bf4, 0xa595786f),
+	TOBN(0x0a6da02b, 0x98a493b5), TOBN(0xba73b1a7, 0x84120d02),
+	TOBN(0xd4a73559, 0xf6780d83), TOBN(0xbd85627e, 0x51fb1aa8),
+	TOBN(0x4a9a6623, 0xa4e6c5f0), TOBN(0xea87af3b, 0xff94e1a7),
+	TOBN(0xfbe8c68b, 0x025f680f), TOBN(0x2e71f5eb, 0x2fb46b98),
+	TOBN(0x0cb6de86, 0x7b84ec6e), TOBN(0x25b5ae0c, 0x98bcff76),
+	TOBN(0x414a8518, 0xa474fbc5), TOBN(0x1b8c9499, 0x331bf2ea),
+	TOBN(0xbfe5c465, 0xa766145c), TOBN(0xf0a9cfd2, 0x493b8296),
+	TOBN(0x60edebd6, 0xa408a404), TOBN(0xf82bc1e0, 0x478a13b2),
+    },
+    {
+	TOBN(0xcf0c17fa, 0xb0d48dd5), TOBN(0xeb32f76a, 0x08ea36b6),
+	TOBN(0x7c72cbe8, 0xfac213eb), TOBN(0x58a41951, 0x1b9e3952),
+	TOBN(0xa64aec32, 0xa10bdbee), TOBN(0x366e5ce1, 0x924af36a),
+	TOBN(0xf720226f, 0x3a1f32b7), TOBN(0x424dc5f3, 0x147d0054),
+	TOBN(0x12f9404b, 0xa877ccc1), TOBN(0x6771997a, 0x38a305e4),
+	TOBN(0xbb6a7fef, 0xfc961f8b), TOBN(0x56879205, 0x2af6400d),
+	TOBN(0x09739ee1, 0x62058787), TOBN(0x07e33598, 0x4eb74424),
+	TOBN(0xb73f581e, 0xc59f4464), TOBN(0x903bf868, 0x40bf40f7),
+	TOBN(0x6f1d9196, 0x976f8c84), TOBN(0x1b932e90, 0x3328e501),
+	TOBN(0x99d52d28, 0x67dff0fd), TOBN(0xad7ce511, 0x9846016c),
+	TOBN(0xec65d76e, 0x6c66f570), TOBN(0x117b31bd, 0x10ff5317),
+	TOBN(0xfd900ea3, 0xcb31212f), TOBN(0xc976e174, 0x0ab0ab8d),
+	TOBN(0x61fff15c, 0xdaa019b3), TOBN(0x39032bea, 0x9c043c18),
+	TOBN(0x335a4928, 0x004b468d), TOBN(0xa81687bb, 0x5fa97530),
+	TOBN(0xaf2bb447, 0xb8875269), TOBN(0x8db733a7, 0x37a1e389),
+	TOBN(0x601f877a, 0xbb0f0ea3), TOBN(0x35078294, 0x8ca58fc8),
+    },
+    {
+	TOBN(0x9bd88565, 0xd65e4223), TOBN(0x51ec73f4, 0x16a8b653),
+	TOBN(0xd11f3331, 0x14e9b4e9), TOBN(0x07aab989, 0x4d3296f4),
+	TOBN(0xaa98d243, 0xe4afff4c), TOBN(0x7fdc9ff8, 0x992e6d9a),
+	TOBN(0x07747acf, 0x9005b758), TOBN(0x52efbf3f, 0xe8af8e68),
+	TOBN(0xdf20812c, 0x237f7ae6), TOBN(0x9a6c1ebd, 0x18a66e38),
+	TOBN(0x3fe17b35, 0x3d884256), TOBN(0x14a4a581, 0xf26d5b70),
+	TOBN(0x2fbe23fb, 0x97d849d9), TOBN(0x212ed48c, 0x0f006507),
+	TOBN(0xf2c5686c, 0xc16e36fe), TOBN(0x063c5bb7, 0x881decf1),
+	TOBN(0x6531f952, 0x689739ea), TOBN(0x9e563b47, 0x8db59ac9),
+	TOBN(0xafe893eb, 0xaef9ca88), TOBN(0xab13cb33, 0xcf0a1da9),
+	TOBN(0xfda99d75, 0xafe592cb), TOBN(0x73019c61, 0x411cebfe),
+	TOBN(0x1f1072ec, 0x7c94e3b1), TOBN(0x61d01537, 0x8147d2c1),
+	TOBN(0x8c7dcb65, 0x647eadd4), TOBN(0xffa5cc6d, 0xa329706b),
+	TOBN(0x574709b7, 0x0ab96c60), TOBN(0x14551816, 0x0c7fd1a2),
+	TOBN(0x5bf72686, 0xec0b4d95), TOBN(0xbd5f738b, 0xacecc8be),
+	TOBN(0x0205204c, 0xa9ff9ac8), TOBN(0x6d74dc1d, 0x6556862d),
+    },
+    {
+	TOBN(0xd7414c64, 0x0a0c9fc1), TOBN(0x1e4fe0d5, 0x0d7a64a2),
+	TOBN(0x22289b8a, 0xf594db23), TOBN(0xa5f0c239, 0xff23478a),
+	TOBN(0xcc5440cf, 0x911fb341), TOBN(0x66ed56ed, 0xfaaa379c),
+	TOBN(0xc5a70bc3, 0x33a07239), TOBN(0xc9c61149, 0x0559bc13),
+	TOBN(0xaaa88ae3, 0x49c06426), TOBN(0x1b54ea3b, 0x1c9e59ab),
+	TOBN(0x8651da41, 0xdf1f2cd3), TOBN(0x58fe6fd5, 0xfad9ada8),
+	TOBN(0x02e3b40f, 0xbd99c724), TOBN(0x766a2fed, 0xbf869373),
+	TOBN(0x03a36352, 0x3318ad83), TOBN(0xec017846, 0x060ecfc2),
+	TOBN(0xec7f156f, 0x5094b264), TOBN(0xe1613de2, 0xc3e8ba3e),
+	TOBN(0xd3107054, 0x7eb3d798), TOBN(0x1cf1297b, 0xf47727ca),
+	TOBN(0x4d4931a5, 0x4dd210e8), TOBN(0xbff978ba, 0xdebec39d),
+	TOBN(0x53c2c8b6, 0xc9a5fe71), TOBN(0xd0c3d765, 0x8494abf5),
+	TOBN(0x7f481f23, 0x803c6349), TOBN(0xd0ec19e3, 0x24cbcb4f),
+	TOBN(0x25e43524, 0x0854d57e), TOBN(0x7ac44d06, 0x76327728),
+	TOBN(0x60226550, 0x90b71a86), TOBN(0x41a7f5b3, 0x8c2760ca),
+	TOBN(0xa278a46e, 0xea68256e), TOBN(0x63780130, 0xe054113f),
+    },
+    {
+	TOBN(0x6b2d5a57, 0x0ea14ed7), TOBN(0x7d207797, 0x89f9a4ab),
+	TOBN(0x0b8b46bc, 0xbdc5ef43), TOBN(0x19a44230, 0x8a8b9e25),
+	TOBN(0x4ece88af, 0x296e9b21), TOBN(0x9f87355b, 0x6ab531a6),
+	TOBN(0x814acd40, 0x9605c5ff), TOBN(0x9deffeca, 0x16b9b012),
+	TOBN(0x6b69e7fa, 0x202189a7), TOBN(0xba14c097, 0x3df27c03),
+	TOBN(0xc12fa192, 0x8f56caad), TOBN(0xe424e8c5, 0xd3f97091),
+	TOBN(0x2170ddb3, 0x9277a20d), TOBN(0x4f838346, 0xe92bce7c),
+	TOBN(0xb836a62b, 0x6e931913), TOBN(0xf41af03d, 0x5bd7057e),
+	TOBN(0xb93e6758, 0x5f2849f3), TOBN(0xb6960c2f, 0xf000c126),
+	TOBN(0x7d2af55e, 0xd11299df), TOBN(0xdfe4e8a8, 0xe74ad141),
+	TOBN(0xe7bb9946, 0x33938ee2), TOBN(0x206097c3, 0x9213dca8),
+	TOBN(0xaf6cf47a, 0x7338e21d), TOBN(0xa3387b0d, 0xd2ff65e1),
+	TOBN(0x50eec04c, 0xfeeea87c), TOBN(0x144fb5d1, 0x7b246993),
+	TOBN(0xd6a3cd66, 0x85d4f506), TOBN(0xc074f632, 0xa0b0c7a1),
+	TOBN(0x4d015ad3, 0xa2bfbdb9), TOBN(0x6e33dbd9, 0x091c01a5),
+	TOBN(0x4d19d0b5, 0xcf742e2a), TOBN(0xc6c58884, 0x28bf6329),
+    },
+    {
+	TOBN(0x030ad8ea, 0x6ebf7da4), TOBN(0xf44bcdf7, 0xf9a3a1a3),
+	TOBN(0xc479e754, 0x197e5f89), TOBN(0x34be7e7f, 0x61f9181c),
+	TOBN(0x27bfd765, 0x5bd6947c), TOBN(0x1a3a493f, 0x85b077e6),
+	TOBN(0xf27f60d7, 0x59949164), TOBN(0x5647a971, 0x9922a7f3),
+	TOBN(0x7b047b8c, 0x23786e81), TOBN(0x4833649a, 0x16cb6424),
+	TOBN(0xc95d3122, 0x97f4ca6c), TOBN(0xfa4554c8, 0x820b4ab1),
+	TOBN(0x2b1b28f6, 0x8529ba37), TOBN(0x980d3550, 0xc701254b),
+	TOBN(0xa9b58c52, 0x30ed4bed), TOBN(0xe120f311, 0x4ad89f28),
+	TOBN(0x911f7b71, 0xfcf72513), TOBN(0x443ba53d, 0xbeb21d3a),
+	TOBN(0xfef04feb, 0xe1983917), TOBN(0xa6cc6be1, 0x35b67ea2),
+	TOBN(0xb3c7ac24, 0x49ecd4a2), TOBN(0x8e72a504, 0xf63398b0),
+	TOBN(0xab4835c0, 0x540b6dca), TOBN(0x23cd08ed, 0xe29fb2a9),
+	TOBN(0x7ead5245, 0xcff30c73), TOBN(0x347968d5, 0xea4908b2),
+	TOBN(0xc0be23c5, 0x2bc78ca1), TOBN(0x93743397, 0xd515c81c),
+	TOBN(0x731f4422, 0x0fda471f), TOBN(0x808882fd, 0xde04df84),
+	TOBN(0x3755480b, 0xd9076074), TOBN(0x758c94c9, 0xaa3979fa),
+    },
+    {
+	TOBN(0x3d189628, 0x19de7977), TOBN(0x1d2273ea, 0x3e868691),
+	TOBN(0xdb5d6c57, 0x01f2e2c4), TOBN(0x43c0a084, 0x28b74869),
+	TOBN(0x620c5b28, 0x3975e87d), TOBN(0xb1824790, 0x43bd5c66),
+	TOBN(0x76e554c5, 0x461e4d85), TOBN(0x4d32066e, 0xeb2b676b),
+	TOBN(0xca91e881, 0xb029ea83), TOBN(0xfe09b570, 0x56c8bea5),
+	TOBN(0xaac914b4, 0x5629b298), TOBN(0x82cff9b8, 0x38559831),
+	TOBN(0x72429ac0, 0x0f981984), TOBN(0xb050a919, 0x47cb542c),
+	TOBN(0xbcaa4cf5, 0x912c8381), TOBN(0x48a6d48c, 0x8b58e109),
+	TOBN(0xa481bd3b, 0x4697f47f), TOBN(0x4bc0892c, 0x046625fa),
+	TOBN(0xb6016142, 0x60969823), TOBN(0x07621648, 0x2ac3eeec),
+	TOBN(0xca251002, 0xdd8b8d2d), TOBN(0x27fe5cff, 0xb2256a3c),
+	TOBN(0x7942313d, 0xd8033348), TOBN(0x780cbd89, 0x9138aee2),
+	TOBN(0x2ebc498b, 0x1d95de05), TOBN(0x7a4d3ba4, 0x89c2ddeb),
+	TOBN(0xee81d56a, 0xcd4ab3bc), TOBN(0x1dda9377, 0x2542cd55),
+	TOBN(0x30316d4a, 0xfda29424), TOBN(0x812f1e1a, 0xc7740e97),
+	TOBN(0xb63b386b, 0x8cf89eb9), TOBN(0xaf45acac, 0x68fcba21),
+    },
+    {
+	TOBN(0x7d77497c, 0xf34bc1d3), TOBN(0xc34bea4c, 0x547b4b7a),
+	TOBN(0x7c3e6ddb, 0xe6b3ca14), TOBN(0x26733dbf, 0x6fed1cb0),
+	TOBN(0x79f907d3, 0xd67c418a), TOBN(0xc4b83ba8, 0xca020a34),
+	TOBN(0x583cd118, 0xae64748d), TOBN(0xa87aefc0, 0x5b11431f),
+	TOBN(0x509c8954, 0xe54c2a6e), TOBN(0x23f73529, 0x7e5d601b),
+	TOBN(0x6874214a, 0x1f796d95), TOBN(0xacf49d62, 0xadc1ddaa),
+	TOBN(0x0c6da3a1, 0xd3659c7e), TOBN(0x429489a3, 0xed3ade05),
+	TOBN(0x748c8794, 0x89e2fa41), TOBN(0x7597c1b4, 0x906219b5),
+	TOBN(0xb2cf4862, 0x69334511), TOBN(0xc9d82ac2, 0x9741966a),
+	TOBN(0x0c3e5fcd, 0x66154f0b), TOBN(0x4774c93b, 0xf3e7c398),
+	TOBN(0xace24318, 0x6f3b749c), TOBN(0xbd3936bb, 0xe6ef9417),
+	TOBN(0x0345ad59, 0x7ea6cd13), TOBN(0xecb3bc20, 0x7301f3da),
+	TOBN(0x48e182ce, 0x1a74f43a), TOBN(0xbe420e9b, 0x8e046610),
+	TOBN(0x4c63bdc2, 0x3ea24a74), TOBN(0x78609e77, 0xe7e5d924),
+	TOBN(0x92026e9c, 0x8ed30115), TOBN(0x93a53026, 0x897889c5),
+	TOBN(0x31d67cda, 0xc4b53a80), TOBN(0xc47b227c, 0x1508829c),
+    },
+    {
+	TOBN(0x17258fd8, 0xcb77706a), TOBN(0xf252a117, 0x98e5d2f7),
+	TOBN(0x2a5d7500, 0x1e5328bc), TOBN(0x578729b2, 0x605a036b),
+	TOBN(0x3e32fa62, 0x97957878), TOBN(0xb1b468e4, 0x34a2d78a),
+	TOBN(0xc0929afc, 0xc03dcfdb), TOBN(0x69bdceaa, 0xab946761),
+	TOBN(0x675ded4d, 0xf6aafe2d), TOBN(0xdd3a19aa, 0xbdf5a3c5),
+	TOBN(0xdba2d803, 0x8ea1ba2a), TOBN(0x2d597a78, 0x40bcca13),
+	TOBN(0x1c5974ee, 0xb022956e), TOBN(0x7cba1690, 0x7d292c3a),
+	TOBN(0x91ad3c3d, 0x1cb7ec26), TOBN(0x5c87325f, 0x378d6e4a),
+	TOBN(0x383c0d91, 0x4d851a7d), TOBN(0x0b5afdf9, 0xb6022f97),
+	TOBN(0xe15054f3, 0x091913a1), TOBN(0xca90a2f3, 0xbfed69e2),
+	TOBN(0x1f76a188, 0x052a1924), TOBN(0x95a0bd31, 0xa80e079a),
+	TOBN(0x2694d994, 0xd566e329), TOBN(0x4f3dfb1f, 0x3eb56bec),
+	TOBN(0x4c692f2e, 0xbda8236d), TOBN(0x4c561154, 0xcef81931),
+	TOBN(0x5e38f755, 0x7221bebd), TOBN(0x2fa2bc1b, 0xa5a03694),
+	TOBN(0x8312e0e7, 0x421c9ed2), TOBN(0x8fc69238, 0x729a23af),
+	TOBN(0xc73ff418, 0x2614ee9c), TOBN(0x7f077875, 0x7f2cb011),
+    },
+    {
+	TOBN(0x5cf6519d, 0x475eaaff), TOBN(0xcb665719, 0x1fd1808f),
+	TOBN(0xed84a962, 0x8efc745f), TOBN(0x923bb2ee, 0xeb229eee),
+	TOBN(0x969cb1e0, 0xefbd0c45), TOBN(0xef715019, 0x2c9081cc),
+	TOBN(0x5e236786, 0xfffdd83c), TOBN(0x1adfcf7b, 0x3ea35372),
+	TOBN(0x37264ad5, 0x08dff222), TOBN(0xd87f7ce3, 0x8cea5e3a),
+	TOBN(0x468d0628, 0xed058471), TOBN(0x7c8e7749, 0xe39fa64d),
+	TOBN(0xca304dc8, 0xebc618af), TOBN(0xee9e2cb2, 0xcbaaf82b),
+	TOBN(0x0e7c03bf, 0xf86275a5), TOBN(0x0cc08c69, 0xaf91464d),
+	TOBN(0xaa3ac6b0, 0xfb63ce59), TOBN(0xf94c9399, 0x7bf8eaf6),
+	TOBN(0x9e5ec72a, 0x0421f3a9), TOBN(0xa3613249, 0x80bcf7ee),
+	TOBN(0xdb858a79, 0xc94c9695), TOBN(0x36e64eba, 0x9166ae6c),
+	TOBN(0xab1d32c8, 0x4e157533), TOBN(0x050ad84a, 0x4fcfbe61),
+	TOBN(0xb0b28f7c, 0x3e5584c5), TOBN(0x76b66ec5, 0x6b956e97),
+	TOBN(0xf9f6a770, 0x5f621d93), TOBN(0x2b846a61, 0xd02864ab),
+	TOBN(0x046b2829, 0x9fdbcc97), TOBN(0x207cf3cf, 0x2b5daba8),
+	TOBN(0x11ae0875, 0xbc78c802), TOBN(0xb123082d, 0x19529305),
+    },
+    {
+	TOBN(0x199ff5a9, 0x7ba1431f), TOBN(0x98112fba, 0xd52857f3),
+	TOBN(0x83cfff24, 0xa7c951a0), TOBN(0xe804d1e5, 0x1eea52eb),
+	TOBN(0x35c7d064, 0xe6fdf43a), TOBN(0x95628cfa, 0xfd3da454),
+	TOBN(0x496bc129, 0x6d4d47b8), TOBN(0xebee0fca, 0x84c27ca6),
+	TOBN(0xc4084a69, 0xae421b4f), TOBN(0xdd214dc5, 0x0fb2561e),
+	TOBN(0xccecdcec, 0xa58fb1f6), TOBN(0x638de5c1, 0x70290a1c),
+	TOBN(0x1364e723, 0x9cabdd21), TOBN(0xad34ec5d, 0xd9783886),
+	TOBN(0x275206e2, 0x817ea28a), TOBN(0xacdc0b3f, 0xb3d1b8f6),
+	TOBN(0x49a6e88a, 0x5f633551), TOBN(0x102b6fea, 0xc7096266),
+	TOBN(0x89695609, 0x63b18563), TOBN(0xc738a837, 0x565c6b4d),
+	TOBN(0x98a6c8c9, 0xada595e4), TOBN(0x84c297bf, 0xcfcb8073),
+	TOBN(0x2ca4e067, 0xa37e7576), TOBN(0x094485d8, 0x9109e336),
+	TOBN(0x8dc43a22, 0xb00e3d90), TOBN(0xe25500c2, 0x686cd669),
+	TOBN(0x236a1bc5, 0x60eca266), TOBN(0xf442ca25, 0x3b0fcb29),
+	TOBN(0xa9d90982, 0xa902f2d6), TOBN(0x5681efeb, 0x9abe769b),
+	TOBN(0x5478a4af, 0xff429829), TOBN(0x40026218, 0xd3c91a8d),
+    },
+    {
+	TOBN(0x11d45212, 0x1dd28729), TOBN(0x222791a4, 0x2ed986de),
+	TOBN(0xaf4132bd, 0x9edbd258), TOBN(0x4ff3d812, 0xb0fe8c26),
+	TOBN(0x6973e2e6, 0x4b7b9272), TOBN(0xb9af5d6f, 0x9407800f),
+	TOBN(0x959e27cf, 0x229348d3), TOBN(0x5a2829f5, 0xe2328f52),
+	TOBN(0x22ce6155, 0xfa14f6f1), TOBN(0x68bae8ad, 0xd9ea0ab8),
+	TOBN(0x8e7c882d, 0x36079dd6), TOBN(0x3828c8a1, 0xe5fba41f),
+	TOBN(0x8fe0d525, 0x48c633e6), TOBN(0x9dc8962b, 0x0d81a299),
+	TOBN(0x38666a40, 0x4641956e), TOBN(0x6767aac7, 0xfda0b4fa),
+	TOBN(0xadaa204f, 0xd9cace8a), TOBN(0x4bc4a718, 0x0bffac9c),
+	TOBN(0x3baccdb6, 0xba39fa9b), TOBN(0x81578a09, 0xd55e6736),
+	TOBN(0x7394559d, 0x22f30b86), TOBN(0x6d5e56a4, 0xfd40da2f),
+	TOBN(0xbdfa1b84, 0x16a48d88), TOBN(0xe32ad0f3, 0xd7bd3751),
+	TOBN(0x76c184c7, 0xdf3331f3), TOBN(0x2eddaa5d, 0x47e37a79),
+	TOBN(0xa62c3492, 0xc0d3c595), TOBN(0xb27ef646, 0x55348866),
+	TOBN(0xee725dc3, 0x798ad998), TOBN(0x02dca4e4, 0xbc79785d),
+	TOBN(0x5bfda2b4, 0x379c85b5), TOBN(0x078609d2, 0x987da4ea),
+    },
+    {
+	TOBN(0x489373ba, 0xfd71d8ef), TOBN(0x2816262f, 0x80882d2c),
+	TOBN(0xe6b11457, 0x2f124128), TOBN(0xa336820f, 0xcc000998),
+	TOBN(0xd05a147b, 0xded8d2ff), TOBN(0xd14dd225, 0xda8e2c00),
+	TOBN(0x1893849d, 0x87371f11), TOBN(0x8e265842, 0xf19d1638),
+	TOBN(0x4580b846, 0x3c6438a9), TOBN(0xaac575e0, 0x2b598fd1),
+	TOBN(0x15baafe2, 0x2d26c19d), TOBN(0x40e0e4a6, 0xe8ff5213),
+	TOBN(0x0c47c2b5, 0x985df516), TOBN(0xa91243b7, 0x04de3d72),
+	TOBN(0xe20863ea, 0x9d1014e3), TOBN(0x05dbcf39, 0x72023d1a),
+	TOBN(0xf6841bff, 0x52ef8f44), TOBN(0xc7835a92, 0x5dae8365),
+	TOBN(0x30fd1024, 0x4a264551), TOBN(0x36c7d5f6, 0xc25f6735),
+	TOBN(0xb0af50da, 0x6ecf520c), TOBN(0xb9b06164, 0x391add74),
+	TOBN(0xa2d23c6a, 0xcc0366d7), TOBN(0xf45d0c83, 0xf1d255c9),
+	TOBN(0x92064bc6, 0x01468bdb), TOBN(0x11bceb66, 0x8bec87b0),
+	TOBN(0x5836fe61, 0x8b6497b4), TOBN(0x2513bf38, 0x0cfcf8ff),
+	TOBN(0x8d907656, 0xea48331c), TOBN(0x2c612176, 0x203bcc16),
+	TOBN(0xb48aa002, 0x91d70e32), TOBN(0xe9e86b35, 0xa7e7fa29),
+    },
+    {
+	TOBN(0x54217829, 0xd431bf5e), TOBN(0x292f2979, 0xb6c66948),
+	TOBN(0x93af2c73, 0xef1febd7), TOBN(0xbe58643f, 0xb1eb6cc2),
+	TOBN(0x2ff59ca8, 0xb18973ac), TOBN(0x885aaa6e, 0x376feed2),
+	TOBN(0x9729c1e0, 0x533c0ef3), TOBN(0xf184aa57, 0xc1c8ccfd),
+	TOBN(0x1fa473d7, 0x4daa6c10), TOBN(0xcdc5cadc, 0x6f5fd73d),
+	TOBN(0x9877c194, 0x9707e351), TOBN(0xbc26cf12, 0xdc745f48),
+	TOBN(0xca9a5e78, 0x786da69d), TOBN(0x6a8c9ce4, 0x86862602),
+	TOBN(0xfd29157c, 0xe02809c3), TOBN(0xabc27415, 0xd3ce0452),
+	TOBN(0x6f3cc167, 0xa1a71bc0), TOBN(0xab58e3fc, 0xaab6dddd),
+	TOBN(0x3e9573dc, 0x342b8462), TOBN(0x5e8c631e, 0xc9cec218),
+	TOBN(0x20c50901, 0x06290146), TOBN(0x2232850b, 0x2ee5a287),
+	TOBN(0xee7cdd08, 0xcd509b49), TOBN(0x690f90a8, 0x43639b25),
+	TOBN(0x65640a69, 0xca0e49ed), TOBN(0x5e2ea293, 0xd86c4cce),
+	TOBN(0xf0b53cde, 0x792cae06), TOBN(0x7b9515d8, 0x2a4c23af),
+	TOBN(0x463c9abb, 0x8a0c30fb), TOBN(0x59f1f2e3, 0x73dd4795),
+	TOBN(0xd0b5cc84, 0xbca7a583), TOBN(0xe6b001bc, 0xb904757a),
+    },
+    {
+	TOBN(0x299015fc, 0x80833cf8), TOBN(0x90b4e824, 0x0ec84250),
+	TOBN(0x33ad1d21, 0x6663d461), TOBN(0x317a16b0, 0x175d2128),
+	TOBN(0x73d188d9, 0x9e8b74ec), TOBN(0xd5806260, 0xe895e0fe),
+	TOBN(0xbf4ac8cd, 0xe6be14d1), TOBN(0x333164ee, 0x072a1dad),
+	TOBN(0x33e7feb1, 0x2284fd1c), TOBN(0xefdd2f82, 0xc57bc161),
+	TOBN(0x14be8366, 0x1920c594), TOBN(0x74dcffaa, 0x42ab054f),
+	TOBN(0xf3934efc, 0x044de106), TOBN(0xca59e232, 0xf501ec17),
+	TOBN(0x8e3ad977, 0xc3ea6c15), TOBN(0x8639723f, 0xb48fb355),
+	TOBN(0x52abfe8c, 0xe5b663cd), TOBN(0x0b947025, 0xd2d2b620),
+	TOBN(0x5f392a9c, 0xdba56899), TOBN(0x8942ae10, 0xf1a507cb),
+	TOBN(0x516157b4, 0xabe77b92), TOBN(0x385358a1, 0x017355fa),
+	TOBN(0x1e5c9a7e, 0xc98107e6), TOBN(0x097bbddb, 0xbedb1a82),
+	TOBN(0x2dc8de0b, 0x1df3b93b), TOBN(0x6ce4d94d, 0xee7c5097),
+	TOBN(0x663aa704, 0x2b0518d9), TOBN(0x5cbb1c5e, 0x10c04a73),
+	TOBN(0xa71b5b3c, 0xfc9a8b99), TOBN(0x83834e3e, 0xee9bb13e),
+	TOBN(0x0bd4fa47, 0xd421510f), TOBN(0xa400f7a4, 0x04a58ddd),
+    },
+    {
+	TOBN(0x8eb056ea, 0xbea77594), TOBN(0x86563d9d, 0x064b933c),
+	TOBN(0xaf5a50a9, 0x73c918ce), TOBN(0xca9a16d1, 0xc6c3cce6),
+	TOBN(0x21aa0db5, 0x6b5d4e3c), TOBN(0xcaa7de40, 0xd5e43463),
+	TOBN(0x0b1e31e5, 0x30598b20), TOBN(0x9ceef3f4, 0x1831c14b),
+	TOBN(0x4ba23d35, 0x91ae507b), TOBN(0x652cd215, 0x09701478),
+	TOBN(0xdf5b8975, 0x7dcc4ba4), TOBN(0x6f2ce2f9, 0xd5ceb06c),
+	TOBN(0x4aeedb3d, 0x23b9658f), TOBN(0x7736ebc9, 0x441d1148),
+	TOBN(0x71be413c, 0xfcef5fa8), TOBN(0x6cd7cbc3, 0xce9d27eb),
+	TOBN(0x392cdf92, 0xd4b43619), TOBN(0x5cc453fa, 0x8d4aa217),
+	TOBN(0xe49e3748, 0x4410d70b), TOBN(0xb02451fd, 0x9ad9694d),
+	TOBN(0x50679681, 0x907b8433), TOBN(0x19ba389c, 0xd5965bbf),
+	TOBN(0xe0546eb4, 0x2b6f13dd), TOBN(0x49172618, 0x0bd8b95e),
+	TOBN(0x6c8e2a01, 0xb45221ad), TOBN(0xcb2f739c, 0x363ce7c1),
+	TOBN(0x6293ebb5, 0xda9bf119), TOBN(0xb973ba13, 0xa2bdc143),
+	TOBN(0xb6a914bf, 0x623a539d), TOBN(0x0d986b6c, 0xea411bab),
+	TOBN(0x9baad77f, 0x716de91b), TOBN(0x11d09dc4, 0x0b2ae0fa),
+    },
+    {
+	TOBN(0x8ec67d1d, 0x082b4206), TOBN(0x9ff6d28d, 0xc154e131),
+	TOBN(0xdb052ee0, 0x15de1d20), TOBN(0x4b619a42, 0x193fb6cc),
+	TOBN(0xd6c37507, 0x7a857f84), TOBN(0x2ddc0303, 0x58f2225c),
+	TOBN(0xe9502912, 0x43035c34), TOBN(0x24a2cc04, 0xb99bf309),
+	TOBN(0x51e2965d, 0x39c22718), TOBN(0xe148fe7a, 0xe401b326),
+	TOBN(0x2a87341f, 0x83c35bea), TOBN(0xcc8d1c4b, 0x39b6a203),
+	TOBN(0xdbda9e7c, 0xf242ab86), TOBN(0xabc02ec5, 0xd1be1e9a),
+	TOBN(0xc32bf368, 0xbededb12), TOBN(0xafc7deb6, 0x982a7b77),
+	TOBN(0x4677b6b8, 0xfd07f0ef), TOBN(0x1a299698, 0x8593c7ca),
+	TOBN(0x579b59e3, 0x37cea1d2), TOBN(0x650dbca6, 0x7ed15037),
+	TOBN(0xc1279489, 0xfeeeba19), TOBN(0xf02f22d5, 0x33c82196),
+	TOBN(0x955a9dfc, 0x70425675), TOBN(0xf1d474d7, 0xc6f41824),
+	TOBN(0xf7b5ba84, 0xb24c92a9), TOBN(0x5b67bd21, 0xb90f8cb3),
+	TOBN(0xbd58f611, 0x9f27fe6a), TOBN(0x8a3cd8f8, 0x6f763489),
+	TOBN(0xaa3cd777, 0x492df44d), TOBN(0x6a018d4a, 0xd52d4bac),
+	TOBN(0x0f2d9b9d, 0x9f434478), TOBN(0x1ef8ba8b, 0xf7b80d2f),
+    },
+    {
+	TOBN(0x9d4a02cf, 0x79d57bbf), TOBN(0xe89addab, 0xd5ac9a09),
+	TOBN(0x0a9e54d7, 0x0cb271dc), TOBN(0x7483f92b, 0xae62d54c),
+	TOBN(0xdc5b5a1e, 0x70c7175d), TOBN(0x9b82560e, 0xd920ee2e),
+	TOBN(0x6bef1c62, 0x03b1f2ae), TOBN(0x961536a1, 0x2e8b86d5),
+	TOBN(0xcfaf6c18, 0x40135430), TOBN(0x45c6982b, 0x4ca68857),
+	TOBN(0x74652891, 0x18142abd), TOBN(0xe271f914, 0xcdf46898),
+	TOBN(0xc5d7fe9a, 0x0b889914), TOBN(0x6eff7fee, 0x38b8fa9d),
+	TOBN(0x2f743916, 0x109c3a62), TOBN(0x23118c9a, 0xdd5fef41),
+	TOBN(0x1f762a0e, 0x66186874), TOBN(0x9fa50981, 0x53db41ce),
+	TOBN(0xf5dd069b, 0xa515fd45), TOBN(0xf930aa05, 0xfb975b63),
+	TOBN(0x467e6a13, 0x1e0d2ca8), TOBN(0x664a76c1, 0xbf7442b8),
+	TOBN(0x2f1d3229, 0xc7b1e9e3), TOBN(0xf950c1a8, 0xee2251f7),
+	TOBN(0x5d7a9da3, 0xa97a2a09), TOBN(0xa675700d, 0x40e44027),
+	TOBN(0x4123801a, 0xa083cc2d), TOBN(0xc63d63cf, 0x9e0a0dc8),
+	TOBN(0x0c75e156, 0xbceee665), TOBN(0x5d03c2ba, 0xd47aaf43),
+	TOBN(0x719edd2e, 0xf62c4906), TOBN(0x6837eef2, 0xec6a34e2),
+    },
+    {
+	TOBN(0x5c6fd334, 0x772ef7bc), TOBN(0xacfffe3a, 0x8469fffe),
+	TOBN(0xc7e56e25, 0x1c4052df), TOBN(0x3588e5f1, 0x3033235d),
+	TOBN(0x97506f57, 0xbf1b6f98), TOBN(0x394ad985, 0x7d71cf04),
+	TOBN(0xea142d22, 0x21666ffb), TOBN(0x63f1a2b3, 0xc1a1fef0),
+	TOBN(0xb3677195, 0xb4c328eb), TOBN(0xe37d0142, 0xe66b381e),
+	TOBN(0xe1ed5db7, 0x3910727b), TOBN(0x8c460854, 0x3016b9ea),
+	TOBN(0xcbb9a984, 0xd414007d), TOBN(0x5bd7c361, 0xb4a710ef),
+	TOBN(0xce8bce6f, 0xe0306040), TOBN(0xc0c6d010, 0x8f72a462),
+	TOBN(0x8692dad9, 0x6347e2b2), TOBN(0xbe9e0ce2, 0xc9ea82a4),
+	TOBN(0x48ab7324, 0x21f575bd), TOBN(0x65e5fd16, 0x309af7ee),
+	TOBN(0x469d4340, 0x3676a564), TOBN(0x2ecfc51d, 0x10f2deb7),
+	TOBN(0x528e49ab, 0x039a8fac), TOBN(0xc959bd65, 0x7ff5c843),
+	TOBN(0x91b2649b, 0x0bb5729d), TOBN(0x79596a9e, 0x79e5df7c),
+	TOBN(0x822691a4, 0xd874c437), TOBN(0xebb6f313, 0x6d26256d),
+	TOBN(0x152d049e, 0xee5438f3), TOBN(0x26009584, 0x9a3936d3),
+	TOBN(0x89678aa5, 0x01fd9f08), TOBN(0xddf5d9c7, 0xd19f64f6),
+    },
+    {
+	TOBN(0xefbb0f0d, 0xdf15d48a), TOBN(0xfb8e489f, 0x1ed7bbaf),
+	TOBN(0x6d70cdfa, 0x83ef20b0), TOBN(0x87591dfa, 0xb86b1898),
+	TOBN(0xed3bccd7, 0xfb3bde69), TOBN(0xf7baab96, 0x78ef7f29),
+	TOBN(0xa4fb8601, 0xef233b02), TOBN(0x2faa2b8a, 0x5f64b05c),
+	TOBN(0xbc5505e2, 0xc01d305d), TOBN(0x47daf577, 0x51d19601),
+	TOBN(0x511c2cd6, 0xf85bee5a), TOBN(0x0bddec6b, 0x80ee5220),
+	TOBN(0x20dab8ee, 0x074a96bc), TOBN(0x41f1cf14, 0xc201a76c),
+	TOBN(0xba145c9a, 0x1ef4dd1b), TOBN(0x9ced1521, 0x0ef8e5e0),
+	TOBN(0xd6a4c658, 0x0c6d7c4a), TOBN(0xcb55b51c, 0xb28050a5),
+	TOBN(0x0fb6b39f, 0x897e5ced), TOBN(0xc31018ff, 0x85c7c981),
+	TOBN(0xcef3e8cf, 0xcc74fd06), TOBN(0x368ee26d, 0x194dec99),
+	TOBN(0x5d5a977c, 0x0cc1fe0e), TOBN(0x78ad48d2, 0x63b9c7dc),
+	TOBN(0x0410f8d3, 0x8c0f3025), TOBN(0xcdccb545, 0x41be9770),
+	TOBN(0x744cb2c0, 0x41c6c252), TOBN(0x847fe30c, 0x3dd8d042),
+	TOBN(0x93bb612c, 0x6692d074), TOBN(0x66377604, 0x90070d3f),
+	TOBN(0x5197ab52, 0xdba0835b), TOBN(0x7d3a5e14, 0x37723dfa),
+    },
+    {
+	TOBN(0xb194d5b2, 0x14677257), TOBN(0x4411df99, 0xa0538160),
+	TOBN(0x42b5fac4, 0x5a223921), TOBN(0x08f4f2e5, 0x5c4cdf25),
+	TOBN(0x235c78cd, 0xc4ad6c0b), TOBN(0xf2554d5c, 0xff4dc3e3),
+	TOBN(0x417f9421, 0x5c8ea6cf), TOBN(0x9542dd84, 0x5f575e28),
+	TOBN(0xfc072621, 0xf1169a1c), TOBN(0x759f4a10, 0xe2191e09),
+	TOBN(0x60eccf52, 0x67bbf98c), TOBN(0x33a075bf, 0xd40aeb7d),
+	TOBN(0x63521e77, 0xc0a70abc), TOBN(0x55e56a53, 0x9610c809),
+	TOBN(0x836a130f, 0x8e0c0afb), TOBN(0xa2782345, 0x84b7c7d0),
+	TOBN(0xae3d84fb, 0xf287fb5a), TOBN(0x84c2126d, 0x1f25d3cc),
+	TOBN(0x7b813ceb, 0x910220ff), TOBN(0x51c05050, 0x1570c371),
+	TOBN(0xf3069e92, 0x891f982f), TOBN(0x71ff64a2, 0xbac22106),
+	TOBN(0x69030a93, 0xa044cc80), TOBN(0x2acfad6a, 0x904baf3f),
+	TOBN(0x6878afbe, 0xcc459397), TOBN(0x49751406, 0x9097e130),
+	TOBN(0xe027a4cf, 0xc6ef0b1e), TOBN(0x860dc716, 0x9477c9d5),
+	TOBN(0x11bb48de, 0x3b89e5a2), TOBN(0x47eb910c, 0xbdbc4d69),
+	TOBN(0xa86f30e1, 0x8cf702f2), TOBN(0x92b00876, 0xa398789a),
+    },
+    {
+	TOBN(0x68b79eb5, 0x014055a6), TOBN(0xcd7f1de6, 0x65b72386),
+	TOBN(0xe1d2a71d, 0xb02bfabf), TOBN(0xe7543fc3, 0x2abff43b),
+	TOBN(0xccf82a0c, 0x32a9e702), TOBN(0xaa78deb0, 0x97e05c19),
+	TOBN(0x799c4fa3, 0x88cb3593), TOBN(0x056de0ea, 0x00c5acaa),
+	TOBN(0x1b2aa6a4, 0xf43cbdc3), TOBN(0xc4c57c64, 0xd870d754),
+	TOBN(0xdbec2810, 0xf1e45120), TOBN(0x5e21c38b, 0x95c58c87),
+	TOBN(0x95673fed, 0x812b9a34), TOBN(0x35069981, 0x85efe662),
+	TOBN(0x68e6fd13, 0xbe3ee3bc), TOBN(0xae951712, 0x63654f1f),
+	TOBN(0xd2eb9c96, 0xa5a0052c), TOBN(0xdf0ff372, 0x95d8397c),
+	TOBN(0x7c9b8f5c, 0x9286e68c), TOBN(0x9d5d53fc, 0xa2683649),
+	TOBN(0x2e3e6dbc, 0x915c83cb), TOBN(0xe917b059, 0x0b34704a),
+	TOBN(0x879aacf8, 0x56803e4b), TOBN(0x30a313d3, 0x2cd65722),
+	TOBN(0x912c8826, 0xae095e83), TOBN(0xc699fa17, 0x6f2462c9),
+	TOBN(0x2c02f8b5, 0x21528c9c), TOBN(0xbe32b30f, 0x64af8874),
+	TOBN(0xe1fd862f, 0xdce79d8d), TOBN(0xdcc3ac98, 0x326ff69e),
+	TOBN(0x653ecc46, 0x94a79e0d), TOBN(0x6296071e, 0xd25802ec),
+    },
+    {
+	TOBN(0xa30b95f2, 0x6d8f598c), TOBN(0x12254ad3, 0xe20b16e4),
+	TOBN(0xe710a8fe, 0x73aeb03e), TOBN(0x39f9f1ea, 0xcc9219c6),
+	TOBN(0x8f5a6a28, 0x2cc127ee), TOBN(0xdca7b043, 0xd8a06fc9),
+	TOBN(0x129ef723, 0xd9ba1ec7), TOBN(0x694a3c13, 0x302dc976),
+	TOBN(0xcf5db440, 0x0fb484a3), TOBN(0xf9a01aee, 0xf44fa8b7),
+	TOBN(0xe70dd55f, 0x73fc9e0b), TOBN(0x07a4f417, 0x203ad38a),
+	TOBN(0x00db3595, 0x6d20e9f2), TOBN(0xb1e013fe, 0x6554e4a4),
+	TOBN(0xb382f1b5, 0xa48b6471), TOBN(0xfa3f22d2, 0x6efc3817),
+	TOBN(0x3dd01d14, 0x17b00449), TOBN(0x11244b05, 0xea39b42a),
+	TOBN(0xeb256d16, 0x7bd58054), TOBN(0x429e544e, 0xbacc326d),
+	TOBN(0xb630497b, 0xa5ab54d7), TOBN(0x4c4da622, 0x03ea8ea5),
+	TOBN(0xea7611d4, 0x38fe76d9), TOBN(0xec339f2e, 0x3d5904d4),
+	TOBN(0x087edc9d, 0x634972ed), TOBN(0xe2e5e5a1, 0xe4627739),
+	TOBN(0x13e35155, 0x3bf215ff), TOBN(0x4f049d2c, 0x8cea68d3),
+	TOBN(0xd9517874, 0x30a511dd), TOBN(0xd2db45fc, 0x607ae251),
+	TOBN(0xa2df2515, 0x19582ba1), TOBN(0x452986b1, 0xd56660c0),
+    },
+    {
+	TOBN(0x448aab08, 0xc4fbee5b), TOBN(0xbb32503d, 0x6e190c16),
+	TOBN(0x1673b4ca, 0x58998eeb), TOBN(0x21725a60, 0x2dfa906c),
+	TOBN(0xd88a5991, 0xa1c59ec0), TOBN(0x0371c524, 0x6e43e229),
+	TOBN(0xbfb4d3fd, 0xac8965d6), TOBN(0x71022077, 0x9a4a4990),
+	TOBN(0xd580898b, 0xa8f7a312), TOBN(0xa86d6b42, 0x49d15189),
+	TOBN(0xf7f2ac1e, 0x1db814c1), TOBN(0x450227da, 0xca84e4ce),
+	TOBN(0x2b5754c0, 0xd5e1be98), TOBN(0x51022dfb, 0xc477295b),
+	TOBN(0xc1bb677a, 0x9f3850d4), TOBN(0x99a9b005, 0xdae05c30),
+	TOBN(0xc9b5cb16, 0x344e588b), TOBN(0xff87b06d, 0xb6d73203),
+	TOBN(0xcae55295, 0x29cf7df0), TOBN(0x1d80d902, 0xedb8b784),
+	TOBN(0x31bda97c, 0xf04b04ac), TOBN(0x248c5655, 0x81196e99),
+	TOBN(0x59fa2642, 0xb65b34a6), TOBN(0x45930b7f, 0x0af22ab1),
+	TOBN(0x821bb7ab, 0xea31cda9), TOBN(0x4e8b676a, 0x1131e96a),
+	TOBN(0x9ae445d1, 0x0e576f20), TOBN(0xb2314093, 0xc3239311),
+	TOBN(0xb9d36d19, 0x91400408), TOBN(0xe4b259fc, 0x7dff525f),
+	TOBN(0x567f3239, 0x2afdd80d), TOBN(0x4a079230, 0x6fff7567),
+    },
+    {
+	TOBN(0x84085c07, 0x6c5e00fe), TOBN(0x0deb1106, 0xc19158f7),
+	TOBN(0xb89d42ee, 0x2ce38847), TOBN(0xdf5ac569, 0xa04bac7c),
+	TOBN(0x683a6916, 0x6513ee9c), TOBN(0x923884ff, 0x9930e03e),
+	TOBN(0x7476e4b6, 0x1cbe4aaa), TOBN(0x3d244e2d, 0xd1caa185),
+	TOBN(0xc160c1cc, 0xe80192f1), TOBN(0x2381c966, 0x983cd79d),
+	TOBN(0x0a08bd75, 0xb27ff976), TOBN(0xa2f0e260, 0x2a18fab5),
+	TOBN(0xb91a2744, 0xe39d7fbb), TOBN(0xccfe5a35, 0x789c7700),
+	TOBN(0x7e1126c0, 0xcd550e75), TOBN(0xea635a33, 0xee95c916),
+	TOBN(0x740123c6, 0x7f4df4ab), TOBN(0x8a580be8, 0x3f12b8ce),
+	TOBN(0x77eaf90d, 0xb84b06bf), TOBN(0x9cc3b7c8, 0xa3557452),
+	TOBN(0x25f04aef, 0x146467be), TOBN(0xef766ff4, 0x98f69ec3),
+	TOBN(0x9b831e39, 0xb1c5d020), TOBN(0x4db5669d, 0x0093babf),
+	TOBN(0xc253f121, 0xed031e84), TOBN(0xafd0eafb, 0xcdd3476c),
+	TOBN(0x256d76f4, 0x8d386b5e), TOBN(0x8fd362a2, 0x413053e3),
+	TOBN(0xc8929e90, 0xf505ffaf), TOBN(0x08bf23b1, 0xa9e71deb),
+	TOBN(0x47a49666, 0x2337feeb), TOBN(0x0cdec773, 0x62592bc8),
+    },
+    {
+	TOBN(0x09122793, 0x2f9639b6), TOBN(0x55ec2cad, 0x7cac6675),
+	TOBN(0xced1a412, 0x4dce62ab), TOBN(0x9fea15de, 0x39561009),
+	TOBN(0x48dd8909, 0xa6d4a837), TOBN(0x6f7a85f4, 0x04d10c87),
+	TOBN(0x85e83fb4, 0x41ab09d0), TOBN(0x3ef57d9d, 0xa74d86cd),
+	TOBN(0xd3c6e0ec, 0x1c36e580), TOBN(0x9892a5bc, 0x6ba3ceed),
+	TOBN(0xd6339c5a, 0x343e1acc), TOBN(0x24743475, 0xfa378fd4),
+	TOBN(0x4d254ff3, 0x1ff6c9a3), TOBN(0x5b3d2821, 0x63e591b0),
+	TOBN(0x200b3432, 0xf6990f57), TOBN(0x35ec08b1, 0x6db88a16),
+	TOBN(0x600099d3, 0x9a14cd99), TOBN(0x00104c91, 0xc56ffb46),
+	TOBN(0x6de96ae1, 0x0dd4b99e), TOBN(0xd9a36183, 0x540a4db4),
+	TOBN(0x0a56df67, 0xaca51d0d), TOBN(0x2690311f, 0x4edf69d5),
+	TOBN(0x59adf903, 0x589402a0), TOBN(0xfac4bf8c, 0xd64d6a49),
+	TOBN(0x45ff6a20, 0xa9220a2f), TOBN(0x57c5439b, 0x5e31d892),
+	TOBN(0xfc343222, 0xc1b715ad), TOBN(0xfffbf658, 0xab3c9e28),
+	TOBN(0x3e778d78, 0xeaa614f3), TOBN(0xcad7a538, 0xf9697e94),
+	TOBN(0xf30162eb, 0x06ef9d97), TOBN(0xdc2f55be, 0xa5a23ca7),
+    },
+    {
+	TOBN(0xcb4b87f6, 0x8d0b91a3), TOBN(0x1c07ec2a, 0x24f36969),
+	TOBN(0x2553aa54, 0xbc40b4f3), TOBN(0x08081f93, 0xbc00623f),
+	TOBN(0x06dbff57, 0x09bb8336), TOBN(0x35c4f242, 0xace61aa9),
+	TOBN(0x259fdbba, 0x8195df27), TOBN(0x1cef6e62, 0x689ea6b3),
+	TOBN(0x5d495421, 0x2207f37d), TOBN(0xfc51c563, 0xe42e2f8e),
+	TOBN(0x5ea53af8, 0xbcf95d38), TOBN(0x616a4006, 0x67f0aa79),
+	TOBN(0x0c1a0d38, 0xeafcd44b), TOBN(0x8b3eaba2, 0x61799fd1),
+	TOBN(0xfd0b9515, 0x13c8e22e), TOBN(0x07d43e91, 0xf2c17bb9),
+	TOBN(0x7ae09974, 0x2c220df0), TOBN(0x8405c504, 0xafe433f8),
+	TOBN(0x450bf643, 0xf5835c07), TOBN(0x8b6cb7d6, 0xdac4f414),
+	TOBN(0x2b955c9d, 0xc13325f1), TOBN(0xaeeb554f, 0xf0a7be5b),
+	TOBN(0x68e4c534, 0x123c7258), TOBN(0x8a244c19, 0x10e6ca0c),
+	TOBN(0xa60eed79, 0xf2f36bf0), TOBN(0xfd5c0242, 0xdb9bbd26),
+	TOBN(0xbd86b139, 0x42351ae0), TOBN(0x9e69119b, 0x19948c1a),
+	TOBN(0xc0838402, 0x5f0facde), TOBN(0x722df3f1, 0x34131332),
+	TOBN(0x757b9b94, 0xe1a17d63), TOBN(0xe7e1ad72, 0xe02a8e8a),
+    },
+    {
+	TOBN(0x9ecf8be1, 0x53250026), TOBN(0xa6a8fbdc, 0x5b1a7964),
+	TOBN(0xd8db3429, 0x8b605019), TOBN(0xe658e1fb, 0x65daccf1),
+	TOBN(0xaef03373, 0xe08658c6), TOBN(0xf73543fe, 0xaef87dbc),
+	TOBN(0x43964ebf, 0x872b1c9e), TOBN(0x7f2fbcd3, 0xa307a283),
+	TOBN(0x8e111f93, 0xf42c582a), TOBN(0x2149746d, 0x57bdfef5),
+	TOBN(0xcff5dc2c, 0xa35fc2f5), TOBN(0xcf09ba57, 0xf62769ad),
+	TOBN(0x020efb74, 0x3f896137), TOBN(0xe7c2e4b8, 0x393ebe49),
+	TOBN(0xbf2c1d45, 0x17fc0742), TOBN(0x0432e3e8, 0x05c0c5a8),
+	TOBN(0x6dfef6e3, 0xa83abaf0), TOBN(0x55d8c45b, 0xba5e665a),
+	TOBN(0x96fc1f28, 0x7bd1d488), TOBN(0x3f2dce9e, 0x3a8fddf5),
+	TOBN(0x0459760e, 0xaa9be529), TOBN(0x8522601c, 0x6e14b63d),
+	TOBN(0x433ba63c, 0xcc7eb8d6), TOBN(0x893ef828, 0xdc78f2a7),
+	TOBN(0xf64f3e92, 0x725ba422), TOBN(0xfcdca42e, 0xb18a4363),
+	TOBN(0x47eed70c, 0x04822b6d), TOBN(0xdd391143, 0x79b6b403),
+	TOBN(0x106c9df6, 0x17acfe73), TOBN(0x1fd84245, 0x0c2523af),
+	TOBN(0x5a143684, 0x4e7c7156), TOBN(0xd25fc275, 0xd7ae7971),
+    },
+    {
+	TOBN(0x9c32ceed, 0x60df5327), TOBN(0x112e3da3, 0x0d2f9701),
+	TOBN(0x195b472e, 0x6295ce99), TOBN(0xb235f05b, 0x27801cd8),
+	TOBN(0x8558b67c, 0xa59cf33b), TOBN(0x6a7fe9ce, 0xa4509eab),
+	TOBN(0xfb908f9d, 0x64f8e4de), TOBN(0x3f3f441d, 0x5af650c2),
+	TOBN(0x1379334d, 0x3d53e8c8), TOBN(0xf403a58d, 0x6b43c5dd),
+	TOBN(0xcb04a8b9, 0x5aebf5bb), TOBN(0x8484cd26, 0x72318b01),
+	TOBN(0x30e9e8a8, 0x3096db68), TOBN(0x5fad233e, 0x7b717ce5),
+	TOBN(0xfee0cf3a, 0x6b97aa1e), TOBN(0x49c16af9, 0x7279f3d0),
+	TOBN(0x26db9d8c, 0x8b8d28ff), TOBN(0x9e64df6c, 0x6a4dbb77),
+	TOBN(0x6c45da68, 0xfbb44495), TOBN(0x419fca05, 0xdba860cb),
+	TOBN(0x7459f452, 0xe711f6a7), TOBN(0xa4458346, 0x899f9bce),
+	TOBN(0x5ce37c2f, 0xed71b70a), TOBN(0x9785ca8f, 0x1c0bea49),
+	TOBN(0xec87fbd1, 0x25c8aa2b), TOBN(0x615a2171, 0x03d691ce),
+	TOBN(0x49d46eb5, 0x791e184f), TOBN(0x5f40959e, 0xef22d0f7),
+	TOBN(0xc6123558, 0x5ec38ab1), TOBN(0xb1f4c76b, 0x14e96627),
+	TOBN(0x7faf6c4b, 0x25e316e3), TOBN(0xf350ae83, 0x90deaaec),
+    },
+    {
+	TOBN(0x373f3fd3, 0x37e8a1f9), TOBN(0x689ad88b, 0x662169e7),
+	TOBN(0x0601954e, 0x831d7340), TOBN(0x934fdb3c, 0x36294c42),
+	TOBN(0x26b9aa57, 0xd7bb5f16), TOBN(0x9e2c4185, 0x0d3ef6d2),
+	TOBN(0x9dc7a3ef, 0xe04cf21f), TOBN(0x3289d0ce, 0x6decad0e),
+	TOBN(0x9377411e, 0xfe076d24), TOBN(0xa3f49cfb, 0x853ad554),
+	TOBN(0x4504e416, 0x1cfc2d1b), TOBN(0xbe82ea38, 0xa54f0da8),
+	TOBN(0x5020ff05, 0x0a1ec92b), TOBN(0xed4e4480, 0x8de2fa3a),
+	TOBN(0xd27cc246, 0x8a35277a), TOBN(0x1a79ac9d, 0x6d1b910d),
+	TOBN(0x1dc54a03, 0x895522c7), TOBN(0xd22f1012, 0x5a375b2a),
+	TOBN(0x225cf32b, 0x4c4f59c9), TOBN(0xb6aaf144, 0x88fd35a1),
+	TOBN(0xb2af5413, 0x127e4b3a), TOBN(0x386d2e8d, 0xf5e17727),
+	TOBN(0x3d8f69b5, 0x8afcc7f9), TOBN(0x350164df, 0xcdf1c553),
+	TOBN(0xa063b11b, 0x2d113798), TOBN(0x1538e8df, 0xf5049157),
+	TOBN(0x06de91db, 0xc8c5b50c), TOBN(0x79944a52, 0x837c7cea),
+	TOBN(0xbe26a63a, 0xa782b967), TOBN(0xfe5fe195, 0x686636da),
+	TOBN(0x581928a9, 0xf8b2e008), TOBN(0x2f756a88, 0xc2ec89f2),
+    },
+    {
+	TOBN(0x4e26e44f, 0x322e45de), TOBN(0xea4b4583, 0x229367ee),
+	TOBN(0x6e26a6b5, 0x8798b47a), TOBN(0x10eaf97b, 0x7a32d1ee),
+	TOBN(0xa85d13fd, 0x5a3e6bc4), TOBN(0x1b6b5320, 0x6422af71),
+	TOBN(0x39d783be, 0x982730db), TOBN(0xe7516fa7, 0x25077770),
+	TOBN(0x962ab0b0, 0xa4efdfc0), TOBN(0x0463ef69, 0xdec24e33),
+	TOBN(0x5f6abf99, 0xb6ff72b3), TOBN(0x00b6e699, 0x56a35636),
+	TOBN(0xa3bc7910, 0x88454877), TOBN(0xb7586a09, 0x5c2b8467),
+	TOBN(0xa8750679, 0x5672ac73), TOBN(0x32fa85c0, 0xf303dfba),
+	TOBN(0x4f745b93, 0x5255a9ba), TOBN(0xf7cd0761, 0x3dbd2388),
+	TOBN(0xbf27aa16, 0xd1a40fe5), TOBN(0xfd9c5e52, 0x400a481c),
+	TOBN(0x73cff464, 0x3814c2d1), TOBN(0x21c57683, 0x364afaba),
+	TOBN(0x7d62b6d4, 0x3d44ab7d), TOBN(0x717641a4, 0x6a7c7fe0),
+	TOBN(0xb64ee2fa, 0x23f8f89b), TOBN(0x89b39d25, 0xacca247b),
+	TOBN(0x222abfe9, 0xfbcc0941), TOBN(0x0d210ea9, 0x6fea30d2),
+	TOBN(0xbf16f40e, 0x8db7afc5), TOBN(0x8e7c0f75, 0x10220cf4),
+	TOBN(0xeda5aafd, 0x761925d2), TOBN(0xbb97eeca, 0x57e62ba6),
+    },
+    {
+	TOBN(0x477103fe, 0x089a9de6), TOBN(0x9fab583e, 0xa0016d16),
+	TOBN(0xdd05e4f1, 0xd7fe2275), TOBN(0x5546547a, 0xee38dc3e),
+	TOBN(0x5624bd82, 0x278fa3f1), TOBN(0x09901cbf, 0x0ad39468),
+	TOBN(0xc5bb8ab5, 0x440f11d5), TOBN(0x36af23b5, 0x8ba5ef6b),
+	TOBN(0x71b4f8b6, 0x020d6a98), TOBN(0x28516cbc, 0x46648993),
+	TOBN(0x444bdc17, 0x50301d80), TOBN(0x9ed3a42b, 0x66dc9d49),
+	TOBN(0xa0dfe18c, 0xec13c088), TOBN(0x93de8575, 0x529b0787),
+	TOBN(0x9c2edd65, 0xb84b0d49), TOBN(0x8d80d460, 0x32ba56c2),
+	TOBN(0xf49ca4ad, 0xd132b2ad), TOBN(0x8d07f92c, 0xd8670a34),
+	TOBN(0xe7d6a455, 0xd7d08f5c), TOBN(0xf9712b24, 0x521e194f),
+	TOBN(0x43a5fb39, 0x501f2d0c), TOBN(0xf898f883, 0x53029ece),
+	TOBN(0xf65e1109, 0x53e98fc5), TOBN(0xd0238115, 0xf6e00cd9),
+	TOBN(0x8d4ef894, 0xfbcc2a6a), TOBN(0x3177b75a, 0x2e34e2c3),
+	TOBN(0x1db03785, 0x69928ce8), TOBN(0x3ca52033, 0x8676dd6e),
+	TOBN(0xe4c15f7a, 0x08e974b0), TOBN(0x0a8bff8d, 0x12c2edfa),
+	TOBN(0xd2e3d533, 0xb07adb14), TOBN(0x55026ef2, 0xce116a03),
+    },
+    {
+	TOBN(0x1396fcd7, 0x08ae6319), TOBN(0x6436d00b, 0x74460c8d),
+	TOBN(0xc21fccf4, 0x165e35d9), TOBN(0xe1a955a4, 0xd6fb657b),
+	TOBN(0xbce58439, 0xa6e40019), TOBN(0x69bb4736, 0x9ae8ae8e),
+	TOBN(0x21daf37a, 0x794cfe53), TOBN(0xfccda82a, 0xe4fcd4e4),
+	TOBN(0x5e676cee, 0xc329403f), TOBN(0xa6f2e961, 0x40aa43b6),
+	TOBN(0x20d6b80d, 0x9c6cc820), TOBN(0xadd7e823, 0x7d119cf8),
+	TOBN(0x5b22d424, 0xb3901197), TOBN(0x16cd023b, 0x519a772a),
+	TOBN(0x56f29dca, 0xe8f73dbe), TOBN(0x8a2d19d9, 0xd6d4b33d),
+	TOBN(0xfadb2cc8, 0x251ff671), TOBN(0x89fc95c0, 0xfabcc8b1),
+	TOBN(0xfab88ea2, 0xa4fd06d3), TOBN(0x70d40880, 0xe60af146),
+	TOBN(0x6d78e609, 0x4867a765), TOBN(0x81456e5f, 0x7530e2de),
+	TOBN(0x567d2554, 0x1973a595), TOBN(0xd6233ebe, 0x83f28b7b),
+	TOBN(0xa1cf3fbc, 0x89e5a97c), TOBN(0xb1f850ec, 0x49227b02),
+	TOBN(0x34107bf5, 0x03ee82b6), TOBN(0xb6e14eed, 0x776c8bf7),
+	TOBN(0x9ad60c3a, 0xeecf4a0f), TOBN(0xba18cb9f, 0x988dcdc5),
+	TOBN(0x5ae5e946, 0x36134a5f), TOBN(0x6aab14c1, 0x7edc6881),
+    },
+    {
+	TOBN(0x0443eb42, 0xd7d7dfd7), TOBN(0x4a5e9f1d, 0x62ec1a20),
+	TOBN(0xc32741b7, 0x6b8f42ba), TOBN(0x2efdab61, 0xd5e3c833),
+	TOBN(0xb6a21ae1, 0xef3a8899), TOBN(0x0a558091, 0xef92a93d),
+	TOBN(0xa99facee, 0x7adc7382), TOBN(0x65625b80, 0x6b6d51f7),
+	TOBN(0x74b69b43, 0x17c41158), TOBN(0x9d6740c1, 0x121bb090),
+	TOBN(0x2a1c269f, 0x3d65722a), TOBN(0xca04a617, 0xe6d19704),
+	TOBN(0xfe01cbe1, 0xdea72bb7), TOBN(0x060e3ecc, 0xd2eeb41d),
+	TOBN(0xde06e0cd, 0x29b92077), TOBN(0xae8eb424, 0x3661b1a4),
+	TOBN(0xcc296c55, 0x8456d382), TOBN(0x2e265227, 0xeda2ae81),
+	TOBN(0xe4568d93, 0x55f08a07), TOBN(0xbe6b2603, 0x52bebcaf),
+	TOBN(0x3fd9bf3e, 0xc399b8f3), TOBN(0x65164873, 0xd175df3f),
+	TOBN(0x3d09cf03, 0x801ef693), TOBN(0x7e208a20, 0x6534348d),
+	TOBN(0x2b7830cc, 0x75c49c43), TOBN(0x8b2c6190, 0x655567e1),
+	TOBN(0x39e33d9d, 0xaa946836), TOBN(0x53acd4ab, 0x3d83d6fd),
+	TOBN(0x6ef4f852, 0x075c29ba), TOBN(0x6a94f16e, 0xb6045c84),
+	TOBN(0x8a9442be, 0x96afb462), TOBN(0x63a0ef7d, 0x6f02c46c),
+    },
+    {
+	TOBN(0x7330624c, 0xdb0db682), TOBN(0x617b35f5, 0xf7025da7),
+	TOBN(0xe4045684, 0x37563714), TOBN(0x0b1dbb1b, 0x995f1a89),
+	TOBN(0x6910c856, 0x507d14eb), TOBN(0x4f4e4a41, 0xa96e8adb),
+	TOBN(0xaaa02152, 0x3b6f826e), TOBN(0xcaa635d0, 0xf1262d30),
+	TOBN(0x013f3fe5, 0x70b73e64), TOBN(0x9641654d, 0x5977d6a8),
+	TOBN(0xfa352a4c, 0x6695e778), TOBN(0x02c509a7, 0x00c7d459),
+	TOBN(0x66a86ba0, 0x76d175b8), TOBN(0x62824c33, 0x522287fd),
+	TOBN(0xa1fa7489, 0x2ba70ec0), TOBN(0xb888fe34, 0x4f29d064),
+	TOBN(0xed70235d, 0xc2d6fa0a), TOBN(0x07ef0b49, 0x08e435db),
+	TOBN(0xe2adf1ad, 0xbddcba8b), TOBN(0x840f36a0, 0xf9754e5f),
+	TOBN(0x74dccf81, 0xb0983177), TOBN(0x100324be, 0x5ad47858),
+	TOBN(0xe42b332b, 0xeb437108), TOBN(0x83c68c49, 0xbdfe7d7c),
+	TOBN(0xbd624336, 0x34329733), TOBN(0x1de29293, 0xa52f1e35),
+	TOBN(0x6412576e, 0x891cfafc), TOBN(0xa9c54db0, 0xdc9da7fb),
+	TOBN(0x9b223275, 0x058759be), TOBN(0xd36aa463, 0x3eb98252),
+	TOBN(0x948079ad, 0x127efb12), TOBN(0xd0c26eda, 0x91d98797),
+    },
+    {
+	TOBN(0xd50dc4e5, 0x8460a381), TOBN(0x7dd50ac4, 0x9ef449bc),
+	TOBN(0x1fb43440, 0xe809eca2), TOBN(0x3bceab5a, 0xdbb75599),
+	TOBN(0x63caea6e, 0x5f726db2), TOBN(0x2cfcfa0b, 0x3933e0d4),
+	TOBN(0x4c8c6271, 0xbb75f59c), TOBN(0xe47147ef, 0x186eeb2b),
+	TOBN(0x856f39fe, 0x338d3cd6), TOBN(0x61fa8d4c, 0x98e75423),
+	TOBN(0xea1ba2ea, 0xcc12e7a9), TOBN(0x68f3b24d, 0x7a9bb7c2),
+	TOBN(0x8c13ad30, 0xd014b716), TOBN(0xc05ce02d, 0x9ad0cc73),
+	TOBN(0xbbd6cb67, 0x00542065), TOBN(0xf6473286, 0xff45ac2d),
+	TOBN(0x68ccf46b, 0x43a02470), TOBN(0x4d69a1e4, 0xced3353a),
+	TOBN(0x4aa4edb1, 0x22e1e35e), TOBN(0xaa830ccc, 0xc48bee56),
+	TOBN(0xeb71a570, 0x695c2ff6), TOBN(0x7a997c8a, 0x8ec719d9),
+	TOBN(0x2bf3b37e, 0xf1f381ab), TOBN(0xb0b500e0, 0xebf2f5b2),
+	TOBN(0x57a6584b, 0x94324c1e), TOBN(0xde8e2e9e, 0x3d7d676d),
+	TOBN(0x8b0570f5, 0xec9448f3), TOBN(0x2262077b, 0xaf14aa69),
+	TOBN(0xd94112fb, 0x66968a36), TOBN(0x25e27e02, 0x3e323de2),
+	TOBN(0x6352d6ba, 0x4c44e97f), TOBN(0x0ecb5a45, 0xbf7c95bd),
+    },
+    {
+	TOBN(0x81a164d0, 0x52889a59), TOBN(0x8a921fd7, 0x0a86edd3),
+	TOBN(0x1c3841ec, 0x7a980296), TOBN(0x5afa2fde, 0xd1d149a9),
+	TOBN(0x6cd35a3d, 0x64940f14), TOBN(0x199967a0, 0x50c96e27),
+	TOBN(0xbad413f7, 0x9e2d3701), TOBN(0x59437cba, 0xb9390737),
+	TOBN(0xf5fbb582, 0xc580fbee), TOBN(0x40cc9d01, 0x7d2dc9ee),
+	TOBN(0x305bdb57, 0x6ffe24f9), TOBN(0xe775d059, 0x19e7df14),
+	TOBN(0x9fcd36e2, 0x7e898f06), TOBN(0xb3a5f9bc, 0xb1cce82a),
+	TOBN(0x83276dfb, 0x9efd0c3e), TOBN(0xb6128ef5, 0x3bd7a23e),
+	TOBN(0xb28101e5, 0x69243c01), TOBN(0x752b87bf, 0x4062af2b),
+	TOBN(0xc60306f7, 0x2b080861), TOBN(0xfa1687c2, 0x9b3c71e4),
+	TOBN(0x7f5aa7a1, 0x06a90226), TOBN(0x392c0280, 0xbb8e009a),
+	TOBN(0x22105cb8, 0x7dcc9d21), TOBN(0x4a0ccb98, 0x31ba3a17),
+	TOBN(0x8863e99b, 0x7e93f179), TOBN(0xb29a27d7, 0x9dbed925),
+	TOBN(0x68ae009b, 0xc5ff03c8), TOBN(0xf1c65f57, 0x8624fad4),
+	TOBN(0xaf66c5cf, 0xa35a8296), TOBN(0xe4f86afa, 0x318e9904),
+	TOBN(0x588884b4, 0x0a2db10b), TOBN(0x68c5d8de, 0xb86a9878),
+    },
+    {
+	TOBN(0x0571841d, 0x1909032a), TOBN(0x5f20fb7a, 0x91b18f60),
+	TOBN(0x123ebb52, 0xd345ff76), TOBN(0x35c1ca1f, 0x13a0f200),
+	TOBN(0x51823326, 0x45d180d2), TOBN(0x3e6ac63d, 0x1b24feea),
+	TOBN(0xb84d647d, 0x8f240378), TOBN(0x9131551b, 0xb0ca74b3),
+	TOBN(0x5ab15c30, 0xc7d9cb04), TOBN(0xf9469e6b, 0x801d33e7),
+	TOBN(0x55d77081, 0x7453b52e), TOBN(0xe74f0c0d, 0x90121b9c),
+	TOBN(0xcfa5de40, 0x08063542), TOBN(0x9ce63014, 0x177638d7),
+	TOBN(0x88faa28b, 0xca6c9362), TOBN(0xca9b1e8f, 0x10131c2d),
+	TOBN(0x6c6105ec, 0x20848468), TOBN(0x6e287f7b, 0xa2c3a86e),
+	TOBN(0xa7d4b3dd, 0xfa092343), TOBN(0x6079e313, 0x8d21f02e),
+	TOBN(0xcdf6eb6c, 0x93f2607e), TOBN(0x989205e9, 0xebde72b8),
+	TOBN(0x6f015ea5, 0xa9e1bb83), TOBN(0x99178879, 0x18b99ab2),
+	TOBN(0x8f8efe4a, 0x34c6de4e), TOBN(0x36d198d6, 0xecbc529e),
+	TOBN(0xd6a546b1, 0xa0c7e44c), TOBN(0x46a0a628, 0x025fdfe4),
+	TOBN(0x8a34d677, 0x06fd9b00), TOBN(0x5ebbbf63, 0xc5d50bec),
+	TOBN(0x1ba8b274, 0x58f40da9), TOBN(0x0b4c5cc7, 0xb46b1a3a),
+    },
+    {
+	TOBN(0x2a41c27f, 0xf6781abb), TOBN(0x920d2bc8, 0x8749fdc2),
+	TOBN(0x8632fc2c, 0x81d17018), TOBN(0x34ac3df5, 0x508cf406),
+	TOBN(0x6397b1f4, 0xeb5fd636), TOBN(0xfe1fe075, 0x99b81f7b),
+	TOBN(0xa5cece5a, 0x93a24055), TOBN(0x969ec712, 0x3cd85a2d),
+	TOBN(0x14248f90, 0x3f552eb0), TOBN(0x9cb3bb1a, 0xd54bf436),
+	TOBN(0xb6c6a7d0, 0xa8cbcbba), TOBN(0xc981784e, 0xaede814d),
+	TOBN(0xbaf55f1e, 0x4f0d9575), TOBN(0xae92cfab, 0xa9d1dd4f),
+	TOBN(0xa968fbb1, 0xdc7ff4ea), TOBN(0x2a5ccd77, 0x048d34b4),
+	TOBN(0x065ee459, 0x84f8e7cf), TOBN(0x28534f9a, 0xe0aa8ec1),
+	TOBN(0xfc58c0cc, 0x216b9763), TOBN(0xc5f414c0, 0x500cdc55),
+	TOBN(0x67686828, 0xe4e37468), TOBN(0x3eaff7eb, 0x6a5b9aa4),
+	TOBN(0x4cec6818, 0xf833cdaa), TOBN(0xe734b887, 0x843ba727),
+	TOBN(0x3250c787, 0x18c3664b), TOBN(0x9b03c465, 0xc42834d4),
+	TOBN(0x61af2a98, 0x52fef23b), TOBN(0x58181bce, 0x0d36fea2),
+	TOBN(0xb132d5e8, 0x02dad13c), TOBN(0x10d7700f, 0xaf333519),
+	TOBN(0x3c809f2d, 0xc4b9a1e2), TOBN(0x7a329815, 0xbc78715d),
+    },
+};
+
+static const BN_ULONG dh_comb_p3072[] = {
+	TOBN(0xffffffff, 0xffffffff), TOBN(0x4b82d120, 0xa93ad2ca),
+	TOBN(0x43db5bfc, 0xe0fd108e), TOBN(0x08e24fa0, 0x74e5ab31),
+	TOBN(0x770988c0, 0xbad946e2), TOBN(0xbbe11757, 0x7a615d6c),
+	TOBN(0x521f2b18, 0x177b200c), TOBN(0xd8760273, 0x3ec86a64),
+	TOBN(0xf12ffa06, 0xd98a0864), TOBN(0xcee3d226, 0x1ad2ee6b),
+	TOBN(0x1e8c94e0, 0x4a25619d), TOBN(0xabf5ae8c, 0xdb0933d7),
+	TOBN(0xb3970f85, 0xa6e1e4c7), TOBN(0x8aea7157, 0x5d060c7d),
+	TOBN(0xecfb8504, 0x58dbef0a), TOBN(0xa85521ab, 0xdf1cba64),
+	TOBN(0xad33170d, 0x04507a33), TOBN(0x15728e5a, 0x8aaac42d),
+	TOBN(0x15d22618, 0x98fa0510), TOBN(0x3995497c, 0xea956ae5),
+	TOBN(0xde2bcbf6, 0x95581718), TOBN(0xb5c55df0, 0x6f4c52c9),
+	TOBN(0x9b2783a2, 0xec07a28f), TOBN(0xe39e772c, 0x180e8603),
+	TOBN(0x32905e46, 0x2e36ce3b), TOBN(0xf1746c08, 0xca18217c),
+	TOBN(0x670c354e, 0x4abc9804), TOBN(0x9ed52907, 0x7096966d),
+	TOBN(0x1c62f356, 0x208552bb), TOBN(0x83655d23, 0xdca3ad96),
+	TOBN(0x69163fa8, 0xfd24cf5f), TOBN(0x98da4836, 0x1c55d39a),
+	TOBN(0xc2007cb8, 0xa163bf05), TOBN(0x49286651, 0xece45b3d),
+	TOBN(0xae9f2411, 0x7c4b1fe6), TOBN(0xee386bfb, 0x5a899fa5),
+	TOBN(0x0bff5cb6, 0xf406b7ed), TOBN(0xf44c42e9, 0xa637ed6b),
+	TOBN(0xe485b576, 0x625e7ec6), TOBN(0x4fe1356d, 0x6d51c245),
+	TOBN(0x302b0a6d, 0xf25f1437), TOBN(0xef9519b3, 0xcd3a431b),
+	TOBN(0x514a0879, 0x8e3404dd), TOBN(0x020bbea6, 0x3b139b22),
+	TOBN(0x29024e08, 0x8a67cc74), TOBN(0xc4c6628b, 0x80dc1cd1),
+	TOBN(0xc90fdaa2, 0x2168c234), TOBN(0xffffffff, 0xffffffff),
+};
+
+static const BN_ULONG
+dh_comb_table3072[DH_COMB_TABLES << DH_COMB_TEETH][3072 / BN_BITS2] = {
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xb47d2edf, 0x56c52d35),
+	TOBN(0xbc24a403, 0x1f02ef71), TOBN(0xf71db05f, 0x8b1a54ce),
+	TOBN(0x88f6773f, 0x4526b91d), TOBN(0x441ee8a8, 0x859ea293),
+	TOBN(0xade0d4e7, 0xe884dff3), TOBN(0x2789fd8c, 0xc137959b),
+	TOBN(0x0ed005f9, 0x2675f79b), TOBN(0x311c2dd9, 0xe52d1194),
+	TOBN(0xe1736b1f, 0xb5da9e62), TOBN(0x540a5173, 0x24f6cc28),
+	TOBN(0x4c68f07a, 0x591e1b38), TOBN(0x75158ea8, 0xa2f9f382),
+	TOBN(0x13047afb, 0xa72410f5), TOBN(0x57aade54, 0x20e3459b),
+	TOBN(0x52cce8f2, 0xfbaf85cc), TOBN(0xea8d71a5, 0x75553bd2),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x00000000, 0x00000002), TOBN(0x68fa5dbe, 0xad8a5a6a),
+	TOBN(0x78494806, 0x3e05dee3), TOBN(0xee3b60bf, 0x1634a99d),
+	TOBN(0x11ecee7e, 0x8a4d723b), TOBN(0x883dd151, 0x0b3d4527),
+	TOBN(0x5bc1a9cf, 0xd109bfe6), TOBN(0x4f13fb19, 0x826f2b37),
+	TOBN(0x1da00bf2, 0x4cebef36), TOBN(0x62385bb3, 0xca5a2328),
+	TOBN(0xc2e6d63f, 0x6bb53cc4), TOBN(0xa814a2e6, 0x49ed9851),
+	TOBN(0x98d1e0f4, 0xb23c3670), TOBN(0xea2b1d51, 0x45f3e704),
+	TOBN(0x2608f5f7, 0x4e4821ea), TOBN(0xaf55bca8, 0x41c68b36),
+	TOBN(0xa599d1e5, 0xf75f0b98), TOBN(0xd51ae34a, 0xeaaa77a4),
+	TOBN(0xd45bb3ce, 0xce0bf5df), TOBN(0x8cd56d06, 0x2ad52a35),
+	TOBN(0x43a86812, 0xd54fd1cf), TOBN(0x9475441f, 0x21675a6c),
+	TOBN(0xc9b0f8ba, 0x27f0bae0), TOBN(0x38c311a7, 0xcfe2f3f8),
+	TOBN(0x9adf4373, 0xa3926388), TOBN(0x1d1727ee, 0x6bcfbd07),
+	TOBN(0x31e79563, 0x6a86cff6), TOBN(0xc255adf1, 0x1ed2d325),
+	TOBN(0xc73a1953, 0xbef55a88), TOBN(0xf93545b8, 0x46b8a4d3),
+	TOBN(0x2dd380ae, 0x05b66140), TOBN(0xce4b6f93, 0xc75458cb),
+	TOBN(0x7bff068e, 0xbd3881f4), TOBN(0x6daf335c, 0x26374984),
+	TOBN(0xa2c1b7dd, 0x0769c033), TOBN(0x238f2809, 0x4aecc0b4),
+	TOBN(0xe8014692, 0x17f29024), TOBN(0x17677a2c, 0xb3902529),
+	TOBN(0x36f49513, 0x3b430272), TOBN(0x603d9525, 0x255c7b74),
+	TOBN(0x9fa9eb24, 0x1b41d791), TOBN(0x20d5cc98, 0x658b79c9),
+	TOBN(0x5d6bef0c, 0xe397f644), TOBN(0xfbe882b3, 0x89d8c9bb),
+	TOBN(0xadfb63ee, 0xeb306717), TOBN(0x76733ae8, 0xfe47c65d),
+	TOBN(0x6de04abb, 0xbd2e7b96), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x9d53f0c5, 0x283f1e05), TOBN(0x6671abde, 0x554976f6),
+	TOBN(0x61846200, 0xe17df316), TOBN(0xffbd8a51, 0x98747e0a),
+	TOBN(0x2c063846, 0x02d92a9d), TOBN(0xce97463d, 0x48242ccc),
+	TOBN(0xa4e9e0fd, 0xb6850085), TOBN(0x080b9fb6, 0xba1fe481),
+	TOBN(0xacb39f95, 0xd887e36e), TOBN(0xae5e05e5, 0x7cba4281),
+	TOBN(0xa1262448, 0x7ff8f7f4), TOBN(0xc0b24987, 0x71c7a397),
+	TOBN(0x27485a69, 0xea3e158a), TOBN(0x17778b01, 0xb05dc0fa),
+	TOBN(0x5d17f52e, 0x7c9fdd5e), TOBN(0x54e9650a, 0x9736e5e2),
+	TOBN(0x636b4882, 0xffecdb76), TOBN(0x1be29fa7, 0xfa8be436),
+	TOBN(0xe062dc4e, 0x1fb167a5), TOBN(0x1ec13044, 0xfff22199),
+	TOBN(0x46843713, 0x055e0f68), TOBN(0x27180a4c, 0x990d1c52),
+	TOBN(0x10e878bc, 0x5861599a), TOBN(0xb9bd30b4, 0xd94e3fe5),
+	TOBN(0xbadada70, 0xb1f67641), TOBN(0x1cd2f32e, 0x1eba0c51),
+	TOBN(0x6404a86e, 0xf64786c5), TOBN(0x59904d0d, 0xa631bdda),
+	TOBN(0xb9093aa7, 0x2cca7b8b), TOBN(0x2fb66a79, 0x5cb50291),
+	TOBN(0x002d89f0, 0xdac23151), TOBN(0xaf25601c, 0x430342fc),
+	TOBN(0x4d4686e9, 0x34b09733), TOBN(0x89801a82, 0xa6452521),
+	TOBN(0xc590f671, 0x613d9150), TOBN(0xc0efb36b, 0x3564c1cd),
+	TOBN(0x9e7b3b68, 0x7bee9b25), TOBN(0x972dfc20, 0xe79a96b3),
+	TOBN(0x41e5bcbb, 0x9cad076d), TOBN(0x0b4a7c01, 0xcae59e4d),
+	TOBN(0x541a9a4b, 0x42f01616), TOBN(0x3f8932d2, 0x4e134ec0),
+	TOBN(0xb4b59065, 0xd9353d1d), TOBN(0x4ef3e0ab, 0x60978896),
+	TOBN(0x5e858752, 0xc363d3fb), TOBN(0x26069f0a, 0x83e09398),
+	TOBN(0xe4def367, 0xab92bb4d), TOBN(0x720215db, 0xe774ef36),
+    },
+    {
+	TOBN(0x3aa7e18a, 0x507e3c0a), TOBN(0xcce357bc, 0xaa92eded),
+	TOBN(0xc308c401, 0xc2fbe62c), TOBN(0xff7b14a3, 0x30e8fc14),
+	TOBN(0x580c708c, 0x05b2553b), TOBN(0x9d2e8c7a, 0x90485998),
+	TOBN(0x49d3c1fb, 0x6d0a010b), TOBN(0x10173f6d, 0x743fc903),
+	TOBN(0x59673f2b, 0xb10fc6dc), TOBN(0x5cbc0bca, 0xf9748503),
+	TOBN(0x424c4890, 0xfff1efe9), TOBN(0x8164930e, 0xe38f472f),
+	TOBN(0x4e90b4d3, 0xd47c2b15), TOBN(0x2eef1603, 0x60bb81f4),
+	TOBN(0xba2fea5c, 0xf93fbabc), TOBN(0xa9d2ca15, 0x2e6dcbc4),
+	TOBN(0xc6d69105, 0xffd9b6ec), TOBN(0x37c53f4f, 0xf517c86c),
+	TOBN(0xc0c5b89c, 0x3f62cf4a), TOBN(0x3d826089, 0xffe44333),
+	TOBN(0x8d086e26, 0x0abc1ed0), TOBN(0x4e301499, 0x321a38a4),
+	TOBN(0x21d0f178, 0xb0c2b334), TOBN(0x737a6169, 0xb29c7fca),
+	TOBN(0x75b5b4e1, 0x63ecec83), TOBN(0x39a5e65c, 0x3d7418a3),
+	TOBN(0xc80950dd, 0xec8f0d8a), TOBN(0xb3209a1b, 0x4c637bb4),
+	TOBN(0x7212754e, 0x5994f716), TOBN(0x5f6cd4f2, 0xb96a0523),
+	TOBN(0x005b13e1, 0xb58462a2), TOBN(0x5e4ac038, 0x860685f8),
+	TOBN(0x9a8d0dd2, 0x69612e67), TOBN(0x13003505, 0x4c8a4a42),
+	TOBN(0x8b21ece2, 0xc27b22a1), TOBN(0x81df66d6, 0x6ac9839b),
+	TOBN(0x3cf676d0, 0xf7dd364b), TOBN(0x2e5bf841, 0xcf352d67),
+	TOBN(0x83cb7977, 0x395a0edb), TOBN(0x1694f803, 0x95cb3c9a),
+	TOBN(0xa8353496, 0x85e02c2c), TOBN(0x7f1265a4, 0x9c269d80),
+	TOBN(0x696b20cb, 0xb26a7a3a), TOBN(0x9de7c156, 0xc12f112d),
+	TOBN(0xbd0b0ea5, 0x86c7a7f6), TOBN(0x4c0d3e15, 0x07c12730),
+	TOBN(0xc9bde6cf, 0x5725769a), TOBN(0xe4042bb7, 0xcee9de6d),
+    },
+    {
+	TOBN(0xe9bd200c, 0x81658137), TOBN(0x7424bbd4, 0x4ca88d99),
+	TOBN(0x6831a22a, 0x2c8b1513), TOBN(0x20e84502, 0xfe8bc4ef),
+	TOBN(0x735e7ffe, 0x4e5a4db0), TOBN(0xf3cbad0d, 0x0687f52e),
+	TOBN(0xa8a80ced, 0x5d741b4d), TOBN(0x48a9cb44, 0xd5c46121),
+	TOBN(0x22c2b77d, 0x9a8f92f9), TOBN(0x109eac7b, 0xbf61236d),
+	TOBN(0x4ce6e643, 0x43e98133), TOBN(0xca0ad598, 0x72cf437a),
+	TOBN(0x0f19bbbb, 0x400757e3), TOBN(0xc5c58cd1, 0x6d3f4adc),
+	TOBN(0x0d6481af, 0xd03e4772), TOBN(0xb59c8ea1, 0x40aa0ba6),
+	TOBN(0xd89730e5, 0xb86058f3), TOBN(0x2a1a78ac, 0x78bb669a),
+	TOBN(0x1a2f8cf5, 0x490ec861), TOBN(0xa81b5804, 0x8bd9c15f),
+	TOBN(0x9a6439b6, 0x2026bae4), TOBN(0x0885b94c, 0xdbfca458),
+	TOBN(0xc1665866, 0xaae09b29), TOBN(0x70a9e6ec, 0xaa6a9c12),
+	TOBN(0x3d87b727, 0xf7a4b843), TOBN(0xb7b6dda0, 0x8e1fed63),
+	TOBN(0xb1d4bbae, 0xa92f94c3), TOBN(0x231f79ff, 0xe79e83b6),
+	TOBN(0xead41392, 0x82f50855), TOBN(0x7e5c526b, 0xeeeb2b1a),
+	TOBN(0x0fbdec66, 0x882f9dd6), TOBN(0x127c702d, 0x75bc9280),
+	TOBN(0xe68e3f43, 0xfb8d2c3b), TOBN(0xef8406b2, 0x8a9d7a84),
+	TOBN(0x3f416de2, 0x5fe0d53d), TOBN(0x8414db1f, 0xa383b8d5),
+	TOBN(0xa5af8219, 0xc4f1bdd7), TOBN(0x49ba8e1c, 0x811493ba),
+	TOBN(0x0f187a61, 0x57c40f4c), TOBN(0xfa754a7f, 0x48f43a34),
+	TOBN(0x8e7edae5, 0x3c8730dd), TOBN(0xf646b6c5, 0x576d0fe1),
+	TOBN(0x92a9394b, 0x4946d0ad), TOBN(0xcad17951, 0x24f53172),
+	TOBN(0xcf6a2fb1, 0x6e80f620), TOBN(0x068f210f, 0x976f2b32),
+	TOBN(0xbcd5f030, 0x9b9f15a1), TOBN(0x4ae9e7b3, 0x6bc97579),
+    },
+    {
+	TOBN(0xd37a4019, 0x02cb026e), TOBN(0xe84977a8, 0x99511b33),
+	TOBN(0xd0634454, 0x59162a26), TOBN(0x41d08a05, 0xfd1789de),
+	TOBN(0xe6bcfffc, 0x9cb49b60), TOBN(0xe7975a1a, 0x0d0fea5c),
+	TOBN(0x515019da, 0xbae8369b), TOBN(0x91539689, 0xab88c243),
+	TOBN(0x45856efb, 0x351f25f2), TOBN(0x213d58f7, 0x7ec246da),
+	TOBN(0x99cdcc86, 0x87d30266), TOBN(0x9415ab30, 0xe59e86f4),
+	TOBN(0x1e337776, 0x800eafc7), TOBN(0x8b8b19a2, 0xda7e95b8),
+	TOBN(0x1ac9035f, 0xa07c8ee5), TOBN(0x6b391d42, 0x8154174c),
+	TOBN(0xb12e61cb, 0x70c0b1e7), TOBN(0x5434f158, 0xf176cd35),
+	TOBN(0x345f19ea, 0x921d90c2), TOBN(0x5036b009, 0x17b382be),
+	TOBN(0x34c8736c, 0x404d75c9), TOBN(0x110b7299, 0xb7f948b1),
+	TOBN(0x82ccb0cd, 0x55c13652), TOBN(0xe153cdd9, 0x54d53825),
+	TOBN(0x7b0f6e4f, 0xef497086), TOBN(0x6f6dbb41, 0x1c3fdac6),
+	TOBN(0x63a9775d, 0x525f2987), TOBN(0x463ef3ff, 0xcf3d076d),
+	TOBN(0xd5a82725, 0x05ea10aa), TOBN(0xfcb8a4d7, 0xddd65635),
+	TOBN(0x1f7bd8cd, 0x105f3bac), TOBN(0x24f8e05a, 0xeb792500),
+	TOBN(0xcd1c7e87, 0xf71a5876), TOBN(0xdf080d65, 0x153af509),
+	TOBN(0x7e82dbc4, 0xbfc1aa7b), TOBN(0x0829b63f, 0x470771aa),
+	TOBN(0x4b5f0433, 0x89e37baf), TOBN(0x93751c39, 0x02292775),
+	TOBN(0x1e30f4c2, 0xaf881e98), TOBN(0xf4ea94fe, 0x91e87468),
+	TOBN(0x1cfdb5ca, 0x790e61bb), TOBN(0xec8d6d8a, 0xaeda1fc3),
+	TOBN(0x25527296, 0x928da15b), TOBN(0x95a2f2a2, 0x49ea62e5),
+	TOBN(0x9ed45f62, 0xdd01ec41), TOBN(0x0d1e421f, 0x2ede5665),
+	TOBN(0x79abe061, 0x373e2b42), TOBN(0x95d3cf66, 0xd792eaf3),
+    },
+    {
+	TOBN(0xd4116992, 0x41ccb8b8), TOBN(0x0694e090, 0xa9dbad8b),
+	TOBN(0x4661adb8, 0x8789838a), TOBN(0x6671b43d, 0x304c2f9e),
+	TOBN(0xfde322a6, 0x392069d3), TOBN(0x31b3ab14, 0x67a61f8b),
+	TOBN(0x2a1c8590, 0xdea270df), TOBN(0x9f49d7d1, 0x224dbc66),
+	TOBN(0xbfeb2e74, 0x9ad6ac2a), TOBN(0x0772c737, 0xe1e5b3dc),
+	TOBN(0xea36df7d, 0x0647f8bb), TOBN(0xacf9b81a, 0x14317f20),
+	TOBN(0x196c9810, 0x24f16732), TOBN(0xaaf0a96d, 0xde2aa46e),
+	TOBN(0x385aa839, 0x7b4706b5), TOBN(0xf1db1c97, 0x364779b4),
+	TOBN(0x86d7aba3, 0x428813a4), TOBN(0x7a64af4f, 0x36dd8dc5),
+	TOBN(0xca3fe88e, 0x88aff720), TOBN(0x24ae5937, 0xf4ffd5ed),
+	TOBN(0xc368304f, 0x3e7211b3), TOBN(0x10a657ff, 0xf7ea4bb2),
+	TOBN(0xcc69f3d7, 0x7ba75b1c), TOBN(0x90d2b041, 0x2812185d),
+	TOBN(0x3759463f, 0x3fe0fa94), TOBN(0xf0f1adcf, 0xa726a655),
+	TOBN(0x3c7b82ef, 0xa7c28c73), TOBN(0x9ccc1109, 0x4351369a),
+	TOBN(0xb07fa6d9, 0xaa5b8dc0), TOBN(0xaa415646, 0xa1420bca),
+	TOBN(0xf33ddc54, 0xfa843cc8), TOBN(0xdb330af9, 0xfcd396d5),
+	TOBN(0x8a8ab15e, 0x9acd10fa), TOBN(0x347f1c5c, 0xc03235c2),
+	TOBN(0xfd43c515, 0xd4d2378d), TOBN(0x15431c74, 0x88807cc2),
+	TOBN(0xc28e18c0, 0xc3b2c3cc), TOBN(0xb91bc435, 0xedbd60c0),
+	TOBN(0x4f95d01a, 0x8375527d), TOBN(0x06e2f916, 0xfc3ce69e),
+	TOBN(0x9046fbc1, 0x6a4000e0), TOBN(0x3f5d6b02, 0x0a19f126),
+	TOBN(0xc06c0151, 0xc2a060b4), TOBN(0xe8b8f3cb, 0x94456735),
+	TOBN(0x0896c8b8, 0x6efe4cdf), TOBN(0x64bf8640, 0x5a792afb),
+	TOBN(0x52cac098, 0xd04e64e6), TOBN(0x70487587, 0x1a5a5f77),
+    },
+    {
+	TOBN(0xa822d324, 0x83997170), TOBN(0x0d29c121, 0x53b75b17),
+	TOBN(0x8cc35b71, 0x0f130714), TOBN(0xcce3687a, 0x60985f3c),
+	TOBN(0xfbc6454c, 0x7240d3a6), TOBN(0x63675628, 0xcf4c3f17),
+	TOBN(0x54390b21, 0xbd44e1be), TOBN(0x3e93afa2, 0x449b78cc),
+	TOBN(0x7fd65ce9, 0x35ad5855), TOBN(0x0ee58e6f, 0xc3cb67b9),
+	TOBN(0xd46dbefa, 0x0c8ff176), TOBN(0x59f37034, 0x2862fe41),
+	TOBN(0x32d93020, 0x49e2ce65), TOBN(0x55e152db, 0xbc5548dc),
+	TOBN(0x70b55072, 0xf68e0d6b), TOBN(0xe3b6392e, 0x6c8ef368),
+	TOBN(0x0daf5746, 0x85102749), TOBN(0xf4c95e9e, 0x6dbb1b8b),
+	TOBN(0x947fd11d, 0x115fee40), TOBN(0x495cb26f, 0xe9ffabdb),
+	TOBN(0x86d0609e, 0x7ce42366), TOBN(0x214cafff, 0xefd49765),
+	TOBN(0x98d3e7ae, 0xf74eb638), TOBN(0x21a56082, 0x502430bb),
+	TOBN(0x6eb28c7e, 0x7fc1f529), TOBN(0xe1e35b9f, 0x4e4d4caa),
+	TOBN(0x78f705df, 0x4f8518e7), TOBN(0x39982212, 0x86a26d34),
+	TOBN(0x60ff4db3, 0x54b71b81), TOBN(0x5482ac8d, 0x42841795),
+	TOBN(0xe67bb8a9, 0xf5087991), TOBN(0xb66615f3, 0xf9a72dab),
+	TOBN(0x151562bd, 0x359a21f5), TOBN(0x68fe38b9, 0x80646b85),
+	TOBN(0xfa878a2b, 0xa9a46f1a), TOBN(0x2a8638e9, 0x1100f985),
+	TOBN(0x851c3181, 0x87658798), TOBN(0x7237886b, 0xdb7ac181),
+	TOBN(0x9f2ba035, 0x06eaa4fb), TOBN(0x0dc5f22d, 0xf879cd3c),
+	TOBN(0x208df782, 0xd48001c0), TOBN(0x7ebad604, 0x1433e24d),
+	TOBN(0x80d802a3, 0x8540c168), TOBN(0xd171e797, 0x288ace6b),
+	TOBN(0x112d9170, 0xddfc99bf), TOBN(0xc97f0c80, 0xb4f255f6),
+	TOBN(0xa5958131, 0xa09cc9cc), TOBN(0xe090eb0e, 0x34b4beee),
+    },
+    {
+	TOBN(0x97330bd9, 0x8b53db8a), TOBN(0x7c1e162d, 0xe581503b),
+	TOBN(0x96fdba94, 0x251a2915), TOBN(0xaba5fb70, 0x3056e459),
+	TOBN(0xdf9a4a4a, 0x67fece66), TOBN(0x610dc16b, 0x59d26004),
+	TOBN(0x20b3a785, 0x2c23d953), TOBN(0x1c371306, 0xfbf4fa06),
+	TOBN(0x97353c06, 0xf589fbe5), TOBN(0x47aa00ee, 0x7abab4f0),
+	TOBN(0xe9a504e4, 0x353ca43b), TOBN(0x1e83b932, 0x002306a0),
+	TOBN(0xdb19a63e, 0x5c0bddd4), TOBN(0x644bd1ce, 0x08d7df08),
+	TOBN(0x2076b246, 0x98612135), TOBN(0x99593059, 0xae2ad423),
+	TOBN(0xd4eea436, 0xf7cb7b49), TOBN(0x35501952, 0x62a8da3f),
+	TOBN(0x9f34c161, 0xa55a751e), TOBN(0xe9efca33, 0x855cc737),
+	TOBN(0x76540dd1, 0xfa2dc3c2), TOBN(0xc5b448cd, 0xf92338eb),
+	TOBN(0xeb6f2e57, 0x5da3a559), TOBN(0xc423fc94, 0x773de826),
+	TOBN(0x5c62d9e0, 0x975adb0b), TOBN(0x430abdab, 0x1ec65eee),
+	TOBN(0x6604b2c7, 0xa0da9e84), TOBN(0xeead0f8f, 0xd0e143e3),
+	TOBN(0xec287b33, 0x967c23cc), TOBN(0xcb38a99f, 0xad4b11a2),
+	TOBN(0xb557efeb, 0xcef56e9a), TOBN(0x07754b5b, 0x5dc2fd4f),
+	TOBN(0x9467a5d0, 0xfec1a21d), TOBN(0xcfe9c856, 0x31b29b8f),
+	TOBN(0x3f5b88fb, 0xaa447cb3), TOBN(0x45f315a4, 0x05adc59c),
+	TOBN(0x21bca848, 0xa6c20eb6), TOBN(0xae2ef5d1, 0x54079219),
+	TOBN(0x480d38a0, 0xba4bd49f), TOBN(0xa88a0f71, 0x1cb49281),
+	TOBN(0x220e23bd, 0xd21435ab), TOBN(0x6f14922c, 0xc902baab),
+	TOBN(0x492e3abd, 0x00660c15), TOBN(0xc7fa0a02, 0xef826ddd),
+	TOBN(0x3f50e44a, 0xd03560ad), TOBN(0x18361727, 0xc4d7cbd4),
+	TOBN(0x0577616a, 0x159c4c3a), TOBN(0x49c6a508, 0x871acfc3),
+    },
+    {
+	TOBN(0x2e6617b3, 0x16a7b714), TOBN(0xf83c2c5b, 0xcb02a077),
+	TOBN(0x2dfb7528, 0x4a34522a), TOBN(0x574bf6e0, 0x60adc8b3),
+	TOBN(0xbf349494, 0xcffd9ccd), TOBN(0xc21b82d6, 0xb3a4c009),
+	TOBN(0x41674f0a, 0x5847b2a6), TOBN(0x386e260d, 0xf7e9f40c),
+	TOBN(0x2e6a780d, 0xeb13f7ca), TOBN(0x8f5401dc, 0xf57569e1),
+	TOBN(0xd34a09c8, 0x6a794876), TOBN(0x3d077264, 0x00460d41),
+	TOBN(0xb6334c7c, 0xb817bba8), TOBN(0xc897a39c, 0x11afbe11),
+	TOBN(0x40ed648d, 0x30c2426a), TOBN(0x32b260b3, 0x5c55a846),
+	TOBN(0xa9dd486d, 0xef96f693), TOBN(0x6aa032a4, 0xc551b47f),
+	TOBN(0x3e6982c3, 0x4ab4ea3c), TOBN(0xd3df9467, 0x0ab98e6f),
+	TOBN(0xeca81ba3, 0xf45b8785), TOBN(0x8b68919b, 0xf24671d6),
+	TOBN(0xd6de5cae, 0xbb474ab3), TOBN(0x8847f928, 0xee7bd04d),
+	TOBN(0xb8c5b3c1, 0x2eb5b617), TOBN(0x86157b56, 0x3d8cbddc),
+	TOBN(0xcc09658f, 0x41b53d08), TOBN(0xdd5a1f1f, 0xa1c287c6),
+	TOBN(0xd850f667, 0x2cf84799), TOBN(0x9671533f, 0x5a962345),
+	TOBN(0x6aafdfd7, 0x9deadd35), TOBN(0x0eea96b6, 0xbb85fa9f),
+	TOBN(0x28cf4ba1, 0xfd83443a), TOBN(0x9fd390ac, 0x6365371f),
+	TOBN(0x7eb711f7, 0x5488f967), TOBN(0x8be62b48, 0x0b5b8b38),
+	TOBN(0x43795091, 0x4d841d6c), TOBN(0x5c5deba2, 0xa80f2432),
+	TOBN(0x901a7141, 0x7497a93f), TOBN(0x51141ee2, 0x39692502),
+	TOBN(0x441c477b, 0xa4286b57), TOBN(0xde292459, 0x92057556),
+	TOBN(0x925c757a, 0x00cc182a), TOBN(0x8ff41405, 0xdf04dbba),
+	TOBN(0x7ea1c895, 0xa06ac15b), TOBN(0x306c2e4f, 0x89af97a8),
+	TOBN(0x0aeec2d4, 0x2b389874), TOBN(0x938d4a11, 0x0e359f86),
+    },
+    {
+	TOBN(0xff1d25fa, 0x3583534a), TOBN(0x8e873b7f, 0xe55ecb2f),
+	TOBN(0x47069964, 0xb76cf65d), TOBN(0x6479bb41, 0xbe4fe84b),
+	TOBN(0xe1a2779e, 0x7fe1d7fd), TOBN(0x7fac3526, 0x778d10cd),
+	TOBN(0xc1c1eefb, 0x40a89f6a), TOBN(0xfb6317bf, 0x0f71b4d1),
+	TOBN(0xd580346f, 0x6a096436), TOBN(0x3fa7fa33, 0xe698324a),
+	TOBN(0xfc4c1454, 0x2415c57b), TOBN(0x101852a4, 0xf4c88021),
+	TOBN(0xb1ca44af, 0x62718800), TOBN(0xd114436e, 0xba550fe4),
+	TOBN(0x0ca8efc7, 0x85fbe501), TOBN(0x04ac1e60, 0xce6d0c3b),
+	TOBN(0xca9c3ac3, 0xf61b6f6b), TOBN(0x69bb980c, 0x85bbb5bc),
+	TOBN(0xbdfdca06, 0xf156a2c8), TOBN(0x34ecb661, 0x5601f866),
+	TOBN(0x918e20d6, 0x70ed7ad5), TOBN(0x808d45b9, 0xb6ab7d78),
+	TOBN(0xe9781ce7, 0x7be1d3e1), TOBN(0x052614db, 0x73352193),
+	TOBN(0xb0b3dcbd, 0xc23868b1), TOBN(0xbcc90c71, 0xa6a7554e),
+	TOBN(0x1314acf4, 0x400056df), TOBN(0xfa21d1b7, 0x5092748e),
+	TOBN(0x041157d1, 0x666fc50b), TOBN(0x8e96d655, 0x1faefcc3),
+	TOBN(0x4f4be447, 0x10d689ac), TOBN(0x65ce71c8, 0x3e8c00a8),
+	TOBN(0xb917fc09, 0xeab064b7), TOBN(0xc698faf8, 0x2d1f5418),
+	TOBN(0xeaabdf19, 0xf3b8af73), TOBN(0xaa3d3646, 0x6c6896e3),
+	TOBN(0x0e90d51a, 0x2e31722b), TOBN(0xbd6b5d1a, 0x769148b7),
+	TOBN(0x41578d80, 0xd49d9482), TOBN(0xefeec87a, 0x37525728),
+	TOBN(0xfe46c8bb, 0x61909ca6), TOBN(0x6641451a, 0xc91dc45c),
+	TOBN(0x4a681ce6, 0xf64e71fd), TOBN(0x2ebd01ad, 0x559a1022),
+	TOBN(0x04b4fea9, 0xbe463302), TOBN(0xfe6cf843, 0x63389f9f),
+	TOBN(0x842b537f, 0xc51202f2), TOBN(0x808ff386, 0x8e2ce7fe),
+    },
+    {
+	TOBN(0xfe3a4bf4, 0x6b06a695), TOBN(0xd18ba5df, 0x2182c394),
+	TOBN(0x4a31d6cc, 0x8ddcdc2c), TOBN(0xc01126e3, 0x07ba2565),
+	TOBN(0x4c3b667c, 0x44ea6918), TOBN(0x437752f5, 0x74b8c42f),
+	TOBN(0x3164b2de, 0x69d61ec8), TOBN(0x1e502d0a, 0xe01aff3f),
+	TOBN(0xb9d06ed7, 0xfa88c009), TOBN(0xb06c2241, 0xb25d7629),
+	TOBN(0xda0b93c7, 0xfe062958), TOBN(0x743af6bd, 0x0e87cc6c),
+	TOBN(0xaffd79d9, 0x1e012b38), TOBN(0x173e1586, 0x17a4134b),
+	TOBN(0x2c565a8a, 0xb31bdaf9), TOBN(0x61031b15, 0xbdbd5e11),
+	TOBN(0xe8055e7a, 0xe7e664a2), TOBN(0xbe04a1be, 0x80cca74b),
+	TOBN(0x66296df5, 0x49b34080), TOBN(0x30442345, 0xc16e85e8),
+	TOBN(0x44f075b6, 0x4c82de92), TOBN(0x4b552d82, 0xfe0aa827),
+	TOBN(0x37c8b62c, 0x0bbc0533), TOBN(0x26adb28a, 0xce5bbd24),
+	TOBN(0x2ed75b35, 0x563a0326), TOBN(0x881dacda, 0x83368921),
+	TOBN(0xbf1d249a, 0x354415ba), TOBN(0x556e7a67, 0x308e52ae),
+	TOBN(0xebbfbc4c, 0xac5a375c), TOBN(0x99c84f86, 0x62ba4bef),
+	TOBN(0x358188e5, 0x248843f9), TOBN(0x32c29b5a, 0x60c22db6),
+	TOBN(0xb02f7b5b, 0x33fd0a69), TOBN(0x44098f9e, 0x6d5a4cf3),
+	TOBN(0x26b89a22, 0x6b263f01), TOBN(0x66420091, 0x7e478e22),
+	TOBN(0x11224d7d, 0x685c2c69), TOBN(0x868a774b, 0x46eaa403),
+	TOBN(0x9e29658b, 0x46dcaa3e), TOBN(0x8ffc5b87, 0x0152ec0a),
+	TOBN(0xcc628708, 0xd0c22516), TOBN(0xdced7081, 0xc501459e),
+	TOBN(0x43863154, 0x5e68df1c), TOBN(0x5b6e44b4, 0x70208522),
+	TOBN(0xe067af4a, 0xf2249990), TOBN(0x38138dfb, 0x4595226c),
+	TOBN(0x3f46cc5d, 0x68bb43b1), TOBN(0x011fe70d, 0x1c59cffd),
+    },
+    {
+	TOBN(0xc2c9aa7a, 0x015a14b1), TOBN(0xfd9f6ec3, 0xf6bf8c86),
+	TOBN(0x4bbe9293, 0xd92105d0), TOBN(0xbbb22b1a, 0x966a1e9a),
+	TOBN(0x69c08bd3, 0x867be18d), TOBN(0x7a52b753, 0xe8a236c4),
+	TOBN(0xc384159a, 0xa521e1f3), TOBN(0x8b7e71a1, 0x08ef5267),
+	TOBN(0x1af2ff78, 0x83149d17), TOBN(0xf23806b2, 0x31024625),
+	TOBN(0x421fa768, 0x59c700bb), TOBN(0x0691d51a, 0x04cbd991),
+	TOBN(0x30bf1dfc, 0xe8e5daf7), TOBN(0x7298de31, 0xe81dd6ff),
+	TOBN(0x64d85130, 0x43fb3a21), TOBN(0xac59e22b, 0x0690af9c),
+	TOBN(0x08c80a0d, 0xc6da5318), TOBN(0xbad1f842, 0x413e7444),
+	TOBN(0x4319c52f, 0xaa9232e3), TOBN(0x55b7e767, 0x648aeaec),
+	TOBN(0xd14235ed, 0x747f0647), TOBN(0x98becdc7, 0x9fac64b8),
+	TOBN(0xe8a68654, 0xfceb6954), TOBN(0x1e8ff6e7, 0x83671fc3),
+	TOBN(0x19a70ce9, 0x1e946d67), TOBN(0x7a97ce06, 0xb1cc67e4),
+	TOBN(0x5cd07dd8, 0x65f2d6a3), TOBN(0x695b9062, 0xea08b9bb),
+	TOBN(0x192852a9, 0x7e330eec), TOBN(0xabfbd652, 0x38e91d9e),
+	TOBN(0xa19db126, 0x46e79f2c), TOBN(0x2bda15b5, 0x35287ab5),
+	TOBN(0x044c039e, 0x8bb26fcf), TOBN(0x59fc6026, 0x95269aa5),
+	TOBN(0xfd3636f4, 0x8fbd359a), TOBN(0x65a7787c, 0x184b275d),
+	TOBN(0x45355d11, 0x5f2a99b1), TOBN(0x80efb3b0, 0x91d320da),
+	TOBN(0xb0e79cd4, 0x1d28d1dc), TOBN(0x640628b3, 0xa9c071e2),
+	TOBN(0x57d8e208, 0xe9cf11ae), TOBN(0x76facad9, 0xd0581c3c),
+	TOBN(0xdf0a6419, 0xe7f5ef39), TOBN(0x63315825, 0x5c2b9f14),
+	TOBN(0x05820d09, 0x978172fb), TOBN(0x3cff1ec0, 0x2f1ded32),
+	TOBN(0x622cf4d7, 0x01fae6c1), TOBN(0xcaa3202a, 0xf151b521),
+    },
+    {
+	TOBN(0x859354f4, 0x02b42963), TOBN(0xafbc0c67, 0x44444642),
+	TOBN(0x53a1c92a, 0xd144fb13), TOBN(0x6e820694, 0xb7ee9203),
+	TOBN(0x5c778ee6, 0x521e7c39), TOBN(0x38c45750, 0x56e3101c),
+	TOBN(0x34e9001d, 0x32c8a3da), TOBN(0x3e86e0ce, 0xd3163a6b),
+	TOBN(0x44b604ea, 0x2c9f31ca), TOBN(0x158c3b3e, 0x47319dde),
+	TOBN(0x65b2b9f0, 0x69689fda), TOBN(0x612dfba7, 0x2e8e7f4b),
+	TOBN(0xade72c74, 0x2ae9d126), TOBN(0x5a474b0c, 0x7335a180),
+	TOBN(0xdcb51d5c, 0x2f1a8538), TOBN(0xb05ea2aa, 0x2e04a4d3),
+	TOBN(0x645cfd0e, 0x89642bfd), TOBN(0x60316229, 0xf7d2245a),
+	TOBN(0x70616446, 0xbc2a60b7), TOBN(0x71da8551, 0xde806af3),
+	TOBN(0xc4589fe4, 0x53a5f576), TOBN(0x7bb83d9e, 0xd00c76a7),
+	TOBN(0x36258907, 0x0dcf3019), TOBN(0x598176a2, 0xeebfb984),
+	TOBN(0x00bdbb8c, 0x0ef20c92), TOBN(0x03bb3004, 0x9980ae4c),
+	TOBN(0x5294c662, 0x81291542), TOBN(0x33e1f7be, 0x637add09),
+	TOBN(0x15edb1fc, 0xdbe0cb1d), TOBN(0xd4924f80, 0x952e8da6),
+	TOBN(0xda2522a3, 0x90aa6ef9), TOBN(0xbed9e334, 0x4dfb21d0),
+	TOBN(0x46978a84, 0x76012098), TOBN(0x6ad059fb, 0x3d68da0c),
+	TOBN(0x4bcd49d7, 0xa32f4b4e), TOBN(0xdd1684fc, 0xd60caf16),
+	TOBN(0x7e6b5d6b, 0xca4e7b74), TOBN(0x0d932477, 0x7d6e5449),
+	TOBN(0x7d498431, 0xd7f324f2), TOBN(0x782b1bf9, 0xe62f217f),
+	TOBN(0x7f86b9a3, 0xe13f0f25), TOBN(0xfe607bff, 0xd375f55d),
+	TOBN(0x6ccabfba, 0x41b7d994), TOBN(0xc456f1a4, 0x7d43a307),
+	TOBN(0xe201cc0a, 0xa49b1982), TOBN(0xb537daf4, 0xdd5fbd92),
+	TOBN(0xfb4a0f0b, 0xe28d0b4d), TOBN(0x95464055, 0xe2a36a42),
+    },
+    {
+	TOBN(0x6334f621, 0x0ff833e7), TOBN(0x13e0e44f, 0x969d4ab7),
+	TOBN(0xde4025de, 0xfdc05ede), TOBN(0x6a45c6c1, 0xb72d94da),
+	TOBN(0xe33dd8bd, 0x0c9fba0a), TOBN(0x219cd8db, 0xee1015a7),
+	TOBN(0x4da8b3e0, 0x8a086850), TOBN(0x41c9bf25, 0xd47773a5),
+	TOBN(0x5b6535c3, 0x0a77cad8), TOBN(0x1523f893, 0x17a120b4),
+	TOBN(0x0acba074, 0xbfe34de1), TOBN(0x342a187e, 0xbc9961c5),
+	TOBN(0xa74df840, 0x0ca21b1b), TOBN(0x85396229, 0xcafd5883),
+	TOBN(0xe520219f, 0x55258b73), TOBN(0xd0feed0b, 0x07e8b3bb),
+	TOBN(0x35f0b7c5, 0x32de6239), TOBN(0x38d785ac, 0xfc05a167),
+	TOBN(0xdea4b9db, 0xc3335661), TOBN(0x3a95c7e8, 0x49faf744),
+	TOBN(0x4bc384e1, 0x5f22d702), TOBN(0xeda13bd8, 0x5f6b4e43),
+	TOBN(0xfe528a96, 0x8b37f5cb), TOBN(0xfbda14ed, 0x5012f2f2),
+	TOBN(0x1e10f682, 0xfa684b16), TOBN(0x635d9cc0, 0x62d449f1),
+	TOBN(0xee59232e, 0xf0819e68), TOBN(0x9bc68b93, 0x893cbd95),
+	TOBN(0xbe23ee92, 0xa3265d03), TOBN(0x33eeb63d, 0x4a0fbd8d),
+	TOBN(0x108d0587, 0xff74eb5b), TOBN(0x158d8220, 0xe6c61ca5),
+	TOBN(0xf97b1a3c, 0x1dd1af14), TOBN(0x953ac189, 0xeffe73e3),
+	TOBN(0xc48558ce, 0x83605382), TOBN(0x3a9313fa, 0x5446997f),
+	TOBN(0x7cb774b6, 0xcb9e65ef), TOBN(0xa4a29a41, 0x91b9a015),
+	TOBN(0xbdd161af, 0xf98058d4), TOBN(0x02fffc57, 0xacb8756d),
+	TOBN(0x4466fe4d, 0xbc699f9b), TOBN(0xdf2f9448, 0x183ffd92),
+	TOBN(0xdc36824b, 0xc99379bd), TOBN(0x6dd32372, 0xbca2068c),
+	TOBN(0x437ca09a, 0x63a86366), TOBN(0xeeb5d3bf, 0xc4c9d624),
+	TOBN(0x244d18d3, 0x1f5b1c98), TOBN(0xe10f9d47, 0xd3cf9e72),
+    },
+    {
+	TOBN(0xc669ec42, 0x1ff067cf), TOBN(0xdc3ef77e, 0x83ffc2a3),
+	TOBN(0x78a4efc1, 0x1a83ad2d), TOBN(0xcba93de2, 0xf9757e84),
+	TOBN(0x4f7228b9, 0x5e662d32), TOBN(0x87589a60, 0x61becde3),
+	TOBN(0x49323ca8, 0xfc95b093), TOBN(0xab1d7bd8, 0x6a267ce6),
+	TOBN(0xc59a717f, 0x3b658d4b), TOBN(0x5b641f00, 0x146f52fc),
+	TOBN(0xf70aac09, 0x35a13a24), TOBN(0xbc5e8270, 0x9e298fb2),
+	TOBN(0x9b04e0fa, 0x7262516e), TOBN(0x7f8852fc, 0x38f4a489),
+	TOBN(0xdd44be3a, 0x516f27dc), TOBN(0xf9a8b86a, 0x30b4ad12),
+	TOBN(0xbeae587d, 0x616c4a3f), TOBN(0x5c3c7cff, 0x6d607ea0),
+	TOBN(0xa7774d9e, 0xed6ca7b2), TOBN(0x3b964653, 0xa96083a4),
+	TOBN(0xb95b3dcc, 0x28ed96ec), TOBN(0x257d19c0, 0x4f8a49bc),
+	TOBN(0x617d918a, 0x2a684908), TOBN(0x1415b2ae, 0x88175fe2),
+	TOBN(0x09918ebf, 0xc699c7f2), TOBN(0xd546cd77, 0xfb907266),
+	TOBN(0x75a6110f, 0x9646a4cb), TOBN(0x98b7ee1f, 0xa1e2e4be),
+	TOBN(0x5fe4e9cf, 0x25c7674b), TOBN(0xe4780f56, 0xb77bcd85),
+	TOBN(0xb803cb67, 0x01c50756), TOBN(0x9240bc0b, 0xb13665af),
+	TOBN(0x30f5b7bf, 0x9a3f9f22), TOBN(0xe14d1cc1, 0xf3188c8a),
+	TOBN(0xda6b8d8b, 0x8a75871e), TOBN(0x86edbbf9, 0x4e039359),
+	TOBN(0xed6f8cb6, 0xa33613f0), TOBN(0x54f8f199, 0x7d3b52bf),
+	TOBN(0x971d0de9, 0x90a232e2), TOBN(0xb61ec341, 0xec1f2895),
+	TOBN(0x58a2f22d, 0x86742afe), TOBN(0xceca0edc, 0x6345b809),
+	TOBN(0x6722fc1e, 0x04f2ee9d), TOBN(0xd99a883f, 0x3e3071f7),
+	TOBN(0x5df6f32c, 0x3ce8fa58), TOBN(0x18a544f4, 0x08b78f77),
+	TOBN(0x7f8a5704, 0x1d4d76fd), TOBN(0xc21f3a8f, 0xa79f3ce4),
+    },
+    {
+	TOBN(0x31704fe9, 0x08645bf1), TOBN(0x061d3bf4, 0x07d4eae0),
+	TOBN(0x58264dd8, 0x1da90418), TOBN(0xb8ad3ec1, 0x31b220d1),
+	TOBN(0xdfe0bfe8, 0x00d2102e), TOBN(0x26aebb9f, 0x85791f6f),
+	TOBN(0x04677c5f, 0xe2c467ce), TOBN(0x476b9ef5, 0xe0afe602),
+	TOBN(0x2657750f, 0x7c04cdba), TOBN(0xdd3e416b, 0xe2979953),
+	TOBN(0x11fba648, 0x23f349d4), TOBN(0x2f5df55e, 0x14c768df),
+	TOBN(0xcb541683, 0xaadbcf00), TOBN(0x533530e2, 0x3e0e8a63),
+	TOBN(0x2bf44bfc, 0xf2e3cabe), TOBN(0x90aaf6a0, 0x4c5940d7),
+	TOBN(0xb5cfff08, 0x2d22f655), TOBN(0xa4154e6b, 0x42ed41b1),
+	TOBN(0x1e119368, 0x30f2c5a4), TOBN(0xc5a7bf01, 0x443aed49),
+	TOBN(0x64c6cb29, 0x92d33711), TOBN(0x0124d5a3, 0x57531517),
+	TOBN(0x82826514, 0xb7d4176d), TOBN(0xfeb427bb, 0x85f896b9),
+	TOBN(0x26a106dd, 0x144aebd5), TOBN(0xe6599d60, 0x61603c76),
+	TOBN(0xdc3eedcc, 0x6f55b1b5), TOBN(0xd23b52bf, 0x73993ce8),
+	TOBN(0x6c1c84e0, 0x3653720e), TOBN(0xd829f770, 0xe14cd320),
+	TOBN(0x8290b017, 0xee2c164c), TOBN(0x5e227694, 0xf6ae0b79),
+	TOBN(0x9a45d334, 0xdb29eed7), TOBN(0x974467b0, 0xc77ad218),
+	TOBN(0x3e692025, 0x9e109a51), TOBN(0x664a61ed, 0xf82bf2bd),
+	TOBN(0xb88a9094, 0xf896bab0), TOBN(0x905cd748, 0xeae78c6b),
+	TOBN(0xefddfe98, 0xff464c0d), TOBN(0x13f48560, 0x784d91cd),
+	TOBN(0xbca58d9e, 0x20b8b6dc), TOBN(0x5525190e, 0x8db3d33c),
+	TOBN(0xe9bb742a, 0xa7e0381c), TOBN(0x029ccb12, 0xd5b67db2),
+	TOBN(0x7bc0d1e4, 0xc9d222cb), TOBN(0x02dc7b2d, 0x682f7545),
+	TOBN(0xd40884c2, 0x0135fb59), TOBN(0x9c234f9c, 0xe86002dd),
+    },
+    {
+	TOBN(0x62e09fd2, 0x10c8b7e3), TOBN(0xc0b7a6c7, 0x666f02f5),
+	TOBN(0x6c713fb3, 0x5a54f7a1), TOBN(0x68782de1, 0xee7e9671),
+	TOBN(0x48b7f70f, 0x46cad97b), TOBN(0x917c5fe7, 0x9090e173),
+	TOBN(0xb6afcda7, 0xae0daf8f), TOBN(0xb6613b78, 0x8297619f),
+	TOBN(0x5b7ef018, 0x1e7f930f), TOBN(0xeb98b0b1, 0xaa5c443a),
+	TOBN(0x056ab7af, 0xfdc1320b), TOBN(0xb2c63c2f, 0x4e859de7),
+	TOBN(0xe3111d81, 0xaed5b938), TOBN(0x1b7ff06d, 0x1f170849),
+	TOBN(0x6aed12f5, 0x8ceba672), TOBN(0x7900cb94, 0xb995c749),
+	TOBN(0xbe6ce703, 0x55f57277), TOBN(0x32b80e7b, 0xfb2fbf35),
+	TOBN(0x265100b7, 0xc8eb8639), TOBN(0x51ba3485, 0x9de06fad),
+	TOBN(0xeb61ca5c, 0x904e570b), TOBN(0x4c844d56, 0x3f59d764),
+	TOBN(0x69dd4686, 0x83a08c4a), TOBN(0x19c9d84a, 0xf3e2a76f),
+	TOBN(0x1ab1af73, 0xfa5f0970), TOBN(0xdb3eceb7, 0xf8a85770),
+	TOBN(0x5171a64a, 0x93eecb66), TOBN(0x05a17c77, 0x769be364),
+	TOBN(0xbbd6166a, 0x4c219162), TOBN(0x2cee91bd, 0xe5f5f8aa),
+	TOBN(0x9c0b2086, 0xdf335d3a), TOBN(0x236aa4f3, 0xd1064358),
+	TOBN(0x728b29b1, 0x14f01ea9), TOBN(0xe560690f, 0xa21148f3),
+	TOBN(0xce331c39, 0xbfd614bc), TOBN(0xde5c57e0, 0x95ce45d4),
+	TOBN(0x6515c472, 0xfd26bd72), TOBN(0x2c6d6ba8, 0x2f972b6c),
+	TOBN(0xfb3647bb, 0x9c2e1954), TOBN(0xd807d553, 0x83496155),
+	TOBN(0x492010ce, 0x4f125980), TOBN(0xbab51869, 0x4e2d635e),
+	TOBN(0x822cdfdb, 0xc18c6b5a), TOBN(0x032dd77f, 0x70596043),
+	TOBN(0xce7f55c1, 0x093c7922), TOBN(0x40f293cf, 0x4f82cdb9),
+	TOBN(0xdf012ee1, 0xe103347d), TOBN(0x38469f39, 0xd0c005bb),
+    },
+    {
+	TOBN(0xda817000, 0x8e1266e4), TOBN(0xa96a18a9, 0x32e85119),
+	TOBN(0x2b68de7e, 0x7eba9a00), TOBN(0x15e35870, 0x7c6a16cf),
+	TOBN(0x2a71f106, 0x76ed3b74), TOBN(0xf2919464, 0x55cd9529),
+	TOBN(0xa36dbbaf, 0x32fe51c0), TOBN(0xcdf8190b, 0xa6c0416d),
+	TOBN(0x275c7143, 0xc0c1e5b5), TOBN(0x7a6064b0, 0x7be8d157),
+	TOBN(0x45f8474d, 0xa14bde86), TOBN(0x4c494bd9, 0x781caa6e),
+	TOBN(0x86327f55, 0xfb22c9f3), TOBN(0x060f84df, 0x18f3ddc2),
+	TOBN(0xfd7261b0, 0x5ed2a3a2), TOBN(0xac9f2ba3, 0x3d8d4b6b),
+	TOBN(0x4ef638ca, 0x228065ae), TOBN(0xa0e13a45, 0x080e004d),
+	TOBN(0x630d9d13, 0xb3e85118), TOBN(0x107d9755, 0xdeab6799),
+	TOBN(0x8a26c066, 0xd04be8f0), TOBN(0xb79a46f1, 0x2c17347c),
+	TOBN(0x0b471b37, 0xea31d8d8), TOBN(0xfb4c0c15, 0xbb0a8260),
+	TOBN(0x285e7893, 0x2b1b62ef), TOBN(0xc56e68bc, 0x4d71fc85),
+	TOBN(0x98f8c425, 0x8fe85475), TOBN(0x64c40299, 0xedccb4d9),
+	TOBN(0x8a849131, 0x73147bec), TOBN(0xc9e898a8, 0xc7c2d402),
+	TOBN(0x031fa8b5, 0x10c2cb60), TOBN(0xa91b355d, 0x061e06db),
+	TOBN(0xc488b37d, 0x06f1318a), TOBN(0xd85d4368, 0x881eca2b),
+	TOBN(0x6945a102, 0x94a7ba1d), TOBN(0x59a4a37b, 0xc8ab2cce),
+	TOBN(0xbbca13a6, 0x82b8a195), TOBN(0xd839ab26, 0x3ecb7ebe),
+	TOBN(0x9d0dcdbc, 0xd8183973), TOBN(0x300c80e6, 0x36dec651),
+	TOBN(0xa78a729f, 0x495c330d), TOBN(0xd81bc88d, 0x65f894f9),
+	TOBN(0x0aaf2480, 0x37265f01), TOBN(0x10a6d27d, 0x7fb6861a),
+	TOBN(0xf07f4e09, 0x9ef3be2c), TOBN(0xa830deab, 0xb6e701f3),
+	TOBN(0xaa8115a3, 0x8902a544), TOBN(0x5cc05eba, 0xc64ced6c),
+    },
+    {
+	TOBN(0xb502e001, 0x1c24cdc8), TOBN(0x52d43152, 0x65d0a233),
+	TOBN(0x56d1bcfc, 0xfd753401), TOBN(0x2bc6b0e0, 0xf8d42d9e),
+	TOBN(0x54e3e20c, 0xedda76e8), TOBN(0xe52328c8, 0xab9b2a52),
+	TOBN(0x46db775e, 0x65fca381), TOBN(0x9bf03217, 0x4d8082db),
+	TOBN(0x4eb8e287, 0x8183cb6b), TOBN(0xf4c0c960, 0xf7d1a2ae),
+	TOBN(0x8bf08e9b, 0x4297bd0c), TOBN(0x989297b2, 0xf03954dc),
+	TOBN(0x0c64feab, 0xf64593e6), TOBN(0x0c1f09be, 0x31e7bb85),
+	TOBN(0xfae4c360, 0xbda54744), TOBN(0x593e5746, 0x7b1a96d7),
+	TOBN(0x9dec7194, 0x4500cb5d), TOBN(0x41c2748a, 0x101c009a),
+	TOBN(0xc61b3a27, 0x67d0a231), TOBN(0x20fb2eab, 0xbd56cf32),
+	TOBN(0x144d80cd, 0xa097d1e0), TOBN(0x6f348de2, 0x582e68f9),
+	TOBN(0x168e366f, 0xd463b1b1), TOBN(0xf698182b, 0x761504c0),
+	TOBN(0x50bcf126, 0x5636c5df), TOBN(0x8adcd178, 0x9ae3f90a),
+	TOBN(0x31f1884b, 0x1fd0a8eb), TOBN(0xc9880533, 0xdb9969b3),
+	TOBN(0x15092262, 0xe628f7d8), TOBN(0x93d13151, 0x8f85a805),
+	TOBN(0x063f516a, 0x218596c1), TOBN(0x52366aba, 0x0c3c0db6),
+	TOBN(0x891166fa, 0x0de26315), TOBN(0xb0ba86d1, 0x103d9457),
+	TOBN(0xd28b4205, 0x294f743b), TOBN(0xb34946f7, 0x9156599c),
+	TOBN(0x7794274d, 0x0571432a), TOBN(0xb073564c, 0x7d96fd7d),
+	TOBN(0x3a1b9b79, 0xb03072e7), TOBN(0x601901cc, 0x6dbd8ca3),
+	TOBN(0x4f14e53e, 0x92b8661a), TOBN(0xb037911a, 0xcbf129f3),
+	TOBN(0x155e4900, 0x6e4cbe03), TOBN(0x214da4fa, 0xff6d0c34),
+	TOBN(0xe0fe9c13, 0x3de77c58), TOBN(0x5061bd57, 0x6dce03e7),
+	TOBN(0x55022b47, 0x12054a89), TOBN(0xb980bd75, 0x8c99dad9),
+    },
+    {
+	TOBN(0x8b956448, 0x1358a705), TOBN(0xd98bb432, 0xd6bf2ae1),
+	TOBN(0xc635da97, 0x9fb2cd66), TOBN(0xd9e6af4c, 0x8c7c7225),
+	TOBN(0x75535e91, 0x59d264fe), TOBN(0xcde17442, 0x39f2deb7),
+	TOBN(0xf1c124b1, 0x68d3a1f5), TOBN(0x318bc7eb, 0x68a563df),
+	TOBN(0xea14b649, 0x509affcc), TOBN(0xdcb26c90, 0x7e1e30aa),
+	TOBN(0xce8686b8, 0xddc2cb92), TOBN(0x70101715, 0xe41d3e20),
+	TOBN(0x47f42937, 0xef500c25), TOBN(0x71652812, 0xaa2197d9),
+	TOBN(0x84ed6bd5, 0x1a78df12), TOBN(0x454c99a9, 0x6f76c65a),
+	TOBN(0x97e1397c, 0xa7174a73), TOBN(0xc01f7f55, 0x2456b985),
+	TOBN(0x3fa5aa0e, 0x95216f3d), TOBN(0xca1be6f3, 0x20663340),
+	TOBN(0x9ce66718, 0xea69d7c1), TOBN(0x4ab2a09f, 0x22d5fba1),
+	TOBN(0x466fa060, 0x326690f9), TOBN(0x02ed82bf, 0xd38b1ed0),
+	TOBN(0x7eda01af, 0xa200a990), TOBN(0xe0a21a8e, 0xf0a7bdd8),
+	TOBN(0x6e170e8a, 0x33c14b9f), TOBN(0x40b46492, 0x304334e5),
+	TOBN(0x94a10562, 0xe77b2584), TOBN(0x9dfbbc8a, 0x4d5b990c),
+	TOBN(0x87ca7b30, 0xdbf4bc65), TOBN(0xe4823e8d, 0x77ddc24b),
+	TOBN(0xce8337cf, 0x914c7ba6), TOBN(0xb0d66038, 0xa214d15b),
+	TOBN(0xb81320d9, 0x90563501), TOBN(0x0aa3fb00, 0xd48559ad),
+	TOBN(0xa4d15a7f, 0xb581aa9e), TOBN(0xb9bb4728, 0xc7702378),
+	TOBN(0x7f7d9e11, 0x892ccb8f), TOBN(0xc2f89c63, 0xa7493184),
+	TOBN(0xb40b0620, 0xdee28cf3), TOBN(0x597affcf, 0x0e511a70),
+	TOBN(0x21bf1a3d, 0xfb306442), TOBN(0xf6aa83d4, 0x5ead37b3),
+	TOBN(0x2dbab1b9, 0xca7927d8), TOBN(0xfedf4379, 0xced3bef0),
+	TOBN(0x55b34217, 0x6598e60f), TOBN(0xc50cba07, 0xab7c72b5),
+    },
+    {
+	TOBN(0x172ac890, 0x26b14e0b), TOBN(0x67949745, 0x044382f8),
+	TOBN(0x48905932, 0x5e688a3f), TOBN(0xaaeb0ef8, 0xa413391a),
+	TOBN(0x739d3461, 0xf8cb831b), TOBN(0xdfe1d12c, 0xf9846002),
+	TOBN(0x91631e4a, 0xba2c23de), TOBN(0x8aa18d63, 0x92825d5b),
+	TOBN(0xe2f9728b, 0xc7abf733), TOBN(0xea8106fa, 0xe16972e9),
+	TOBN(0x7e807891, 0x71603587), TOBN(0x342a7f9e, 0xed31486a),
+	TOBN(0xdc5142ea, 0x37be3383), TOBN(0x57dfdecd, 0xf73d2334),
+	TOBN(0x1cdf52a5, 0xdc15cf1a), TOBN(0xe24411a6, 0xffd0d250),
+	TOBN(0x828f5bec, 0x49de1ab2), TOBN(0x6acc704f, 0xbe02aedd),
+	TOBN(0x69792e04, 0x9148d96b), TOBN(0x5aa28469, 0x5636fb9b),
+	TOBN(0x5ba1023b, 0x3f7b986b), TOBN(0xdf9fe34d, 0xd65fa479),
+	TOBN(0xf1b7bd1d, 0x78c57f62), TOBN(0x223c8e53, 0x8f07b79c),
+	TOBN(0xcb23a519, 0x15ca84e4), TOBN(0xcfcfc915, 0x17375a34),
+	TOBN(0x7521e7c6, 0x1cc5ff3a), TOBN(0xe293a01c, 0xefefd35d),
+	TOBN(0x0cdf176f, 0xae70f84c), TOBN(0xb8921bf0, 0xbe138483),
+	TOBN(0xa67eb6b8, 0xbac4a96b), TOBN(0x302a34e4, 0xd365b0fc),
+	TOBN(0xdb05f2e6, 0x81353848), TOBN(0x18845a1f, 0x57454779),
+	TOBN(0xc1871da1, 0xa4614a1d), TOBN(0x270f8a06, 0x4e8113b5),
+	TOBN(0x3da35848, 0x76fc9d4e), TOBN(0x7f2a4b67, 0xe8a85986),
+	TOBN(0x1a7586ac, 0xaffb1858), TOBN(0x36100359, 0xe140a0c3),
+	TOBN(0x37eb01d3, 0xcb6605b0), TOBN(0xc360e5ea, 0x4f67f1c6),
+	TOBN(0xf2342c02, 0x682cc3a6), TOBN(0xeb494902, 0x8246d443),
+	TOBN(0x3273156b, 0x0a8a833d), TOBN(0x38f82468, 0x1ccb610f),
+	TOBN(0xe256a98c, 0xa9c909eb), TOBN(0x8a19740f, 0x56f8e56a),
+    },
+    {
+	TOBN(0x5af83d9e, 0x5bcdaf2a), TOBN(0xf0998ba4, 0x1353f907),
+	TOBN(0xfe4f94f0, 0xe0e23fe4), TOBN(0x2ff0030b, 0x633bd7f4),
+	TOBN(0xac683dab, 0xeaf9d7a6), TOBN(0xd306b5aa, 0x5635e72d),
+	TOBN(0x8914135b, 0x88d2465f), TOBN(0x215df43d, 0xc1815da5),
+	TOBN(0x75a81ae3, 0x5f30889b), TOBN(0x7628ea65, 0x090c6420),
+	TOBN(0xccf19e23, 0x047ff184), TOBN(0x76c5ee44, 0x1ce9f9b9),
+	TOBN(0xa262023a, 0x13e8d338), TOBN(0x39b78691, 0xc652320c),
+	TOBN(0xd78dbc70, 0xef142d29), TOBN(0xc842242d, 0x3817a3e1),
+	TOBN(0x25b5ee6e, 0xbd46a425), TOBN(0x91a1f975, 0x6addde4f),
+	TOBN(0x2ab0dab7, 0xd5608d38), TOBN(0x01ae2fc3, 0xa7f313a9),
+	TOBN(0xe274e852, 0x2cc15c87), TOBN(0xadb19b60, 0x5e230605),
+	TOBN(0xb6539ec3, 0x883fc0b3), TOBN(0x36b1ce22, 0x2c717614),
+	TOBN(0x2f99fffd, 0xaf16fda0), TOBN(0x10eff540, 0x845ff02f),
+	TOBN(0x97cfb2fe, 0x67cf5e35), TOBN(0xa588da56, 0x230cc46c),
+	TOBN(0x176a2cea, 0xabda6a82), TOBN(0x4d3ed46b, 0x0b971aee),
+	TOBN(0xb768dbc7, 0x7275b59a), TOBN(0x973ee65b, 0x86eb1adb),
+	TOBN(0xaf3896ed, 0x57f7b7d3), TOBN(0x02000013, 0x46761537),
+	TOBN(0x1601c81d, 0x68c74d1a), TOBN(0x63bf93d2, 0xc4b02e4d),
+	TOBN(0xc087bb2d, 0x0328f4ee), TOBN(0xed58da07, 0x415c1cb5),
+	TOBN(0xb143c253, 0xcee0fa9e), TOBN(0x4a814b40, 0xaf58756d),
+	TOBN(0x2d2192c1, 0x4c4d509f), TOBN(0x2ed668bc, 0xc0fd5225),
+	TOBN(0x4f370825, 0x1669130b), TOBN(0x9e65dc85, 0xf0ffeab7),
+	TOBN(0x6da315ca, 0x9c18b0c6), TOBN(0xc0a1a710, 0x4d22b6d9),
+	TOBN(0xec12f8d3, 0x47349c76), TOBN(0xbcc6f579, 0x9799e5d2),
+    },
+    {
+	TOBN(0xb5f07b3c, 0xb79b5e55), TOBN(0x95b04627, 0x7d6d1f43),
+	TOBN(0xb8c3cde4, 0xe0c76f3b), TOBN(0x56fdb676, 0x519204b8),
+	TOBN(0xe1c6f297, 0x1b1a686a), TOBN(0xea2c53fd, 0x320a70ee),
+	TOBN(0xc008fb9e, 0xfa296cb2), TOBN(0x6a45e608, 0x443a50e6),
+	TOBN(0xfa203bbf, 0xe4d708d1), TOBN(0x1d6e02a3, 0xf745d9d4),
+	TOBN(0x7b56a765, 0xbeda816b), TOBN(0x41962dfb, 0x5ecabf9c),
+	TOBN(0x912cf4ee, 0x80efc1a9), TOBN(0xe8849bcc, 0x2f9e579b),
+	TOBN(0xc21ff3dd, 0x854c6b47), TOBN(0xe82f26ae, 0x91128d5e),
+	TOBN(0x9e38c5d0, 0x763cce17), TOBN(0x0dd16490, 0x4b10f870),
+	TOBN(0x3f8f8f57, 0x11c71561), TOBN(0xc9c7160a, 0x6550bc6d),
+	TOBN(0xe6be04ad, 0xc42aa1f5), TOBN(0xa59dd8d0, 0x4cf9b941),
+	TOBN(0xd17fb9e4, 0x2477ded7), TOBN(0x89c52518, 0x40d46625),
+	TOBN(0x2ca3a1b5, 0x2ff72d04), TOBN(0x306b7e78, 0x3ea7bee2),
+	TOBN(0xc89330ae, 0x84e22465), TOBN(0xac3c8ba4, 0xd582f26b),
+	TOBN(0x1271667f, 0x372f8249), TOBN(0x17184bb2, 0x3a8a8846),
+	TOBN(0x05bb77e5, 0xe7c69bd5), TOBN(0x95a38480, 0xf180621d),
+	TOBN(0x9c70b122, 0x0e8bb0a1), TOBN(0xbad799d4, 0xa007cf31),
+	TOBN(0x7d646c29, 0x55437a4d), TOBN(0xd946bbaa, 0x2ed6bcf4),
+	TOBN(0x751019a3, 0x124b31ee), TOBN(0xe6657124, 0xdc804c00),
+	TOBN(0x7e01cf31, 0x3b637676), TOBN(0x45216113, 0xf15f2895),
+	TOBN(0x2a181b14, 0xa63b8d07), TOBN(0x6e17b7c5, 0xb4c0612f),
+	TOBN(0x4d2407d0, 0x9e9e2138), TOBN(0x3abffa65, 0xa6ec3a4c),
+	TOBN(0xb243dd8c, 0xadc99519), TOBN(0xbc7ceb95, 0x196950e1),
+	TOBN(0x0f161704, 0x6d0076b8), TOBN(0x798deaf3, 0x2f33cba6),
+    },
+    {
+	TOBN(0xffb887c0, 0x6f9d595a), TOBN(0x6483049d, 0x8da44bb2),
+	TOBN(0xc6052cec, 0xfa295c43), TOBN(0x0a841b4b, 0x9b550e8c),
+	TOBN(0x821a80cd, 0xee0db4ea), TOBN(0xe6f5758a, 0x045ab49a),
+	TOBN(0x76cb4b95, 0xd624744b), TOBN(0xf76d4a47, 0x5451b17b),
+	TOBN(0xf8c493a1, 0x488f9d85), TOBN(0x057daea6, 0xdfaac65f),
+	TOBN(0xc193c3fc, 0xb42495c1), TOBN(0x292c0cc3, 0xb6c339f1),
+	TOBN(0xb8b5f0da, 0xe86e3afe), TOBN(0x3c6fbe01, 0xbaa1102b),
+	TOBN(0xe2638b36, 0x89ca31ab), TOBN(0x36a78d1c, 0xbb55095e),
+	TOBN(0x38810c9a, 0x1f098f3b), TOBN(0xc78242bf, 0xeaa7af98),
+	TOBN(0x06f8566c, 0x9c149eab), TOBN(0x7c1a4152, 0x83296ab4),
+	TOBN(0xe385a18f, 0xf6b506a9), TOBN(0x9b766c23, 0xabedad39),
+	TOBN(0x1a542597, 0x66f16f97), TOBN(0x55bf30d5, 0xf9cab7c5),
+	TOBN(0x2583e5f3, 0x028e9c94), TOBN(0x6ac5b50e, 0x8712703e),
+	TOBN(0x2235dbc4, 0x283c15c9), TOBN(0xfd07269e, 0x13da39d6),
+	TOBN(0x1b41d38e, 0x806be63b), TOBN(0x5fcbecd6, 0x8d7b8c34),
+	TOBN(0x184c1fd2, 0xa2da7681), TOBN(0xc7de14d3, 0xb3d8958d),
+	TOBN(0x211db337, 0xc1ac346a), TOBN(0xf9ad96a8, 0x35e99d23),
+	TOBN(0xb1c85834, 0x2f49446b), TOBN(0xf8fa3273, 0x81b1bf26),
+	TOBN(0x68899675, 0x1fddd33c), TOBN(0xaf313804, 0x97106447),
+	TOBN(0xa7b7637a, 0xf9581425), TOBN(0xf6ff44f2, 0x60e305f1),
+	TOBN(0x841c511f, 0x405ebb97), TOBN(0xaa9314a9, 0x65dc2d1e),
+	TOBN(0x85a5dacf, 0x0e7b4bb1), TOBN(0x9d6ff4a7, 0x59a270c9),
+	TOBN(0x0bf80bd2, 0x52556a36), TOBN(0x71bc6867, 0x73c1c942),
+	TOBN(0x78000e3c, 0x17b296de), TOBN(0xfe0d4717, 0x5a4dbd57),
+    },
+    {
+	TOBN(0xff710f80, 0xdf3ab2b5), TOBN(0x7d83381a, 0x720dc49a),
+	TOBN(0x482efddd, 0x1355a7f8), TOBN(0x0c25e6f6, 0xc1c471e8),
+	TOBN(0x8d2b78db, 0x214222f2), TOBN(0x1209d3bc, 0x8e540bc8),
+	TOBN(0x9b776c13, 0x94cdc88b), TOBN(0x1664921b, 0x69daf892),
+	TOBN(0x00592d3b, 0xb79532a7), TOBN(0x3c178b27, 0xa4829e54),
+	TOBN(0x649af319, 0x1e23c9e4), TOBN(0xa6626afa, 0x927d400c),
+	TOBN(0xbdd4d230, 0x29fa9134), TOBN(0xedf50aac, 0x183c13d9),
+	TOBN(0xd7cb9168, 0xbab8744b), TOBN(0xc4f9f88d, 0x978d5858),
+	TOBN(0xc3cf0227, 0x39c2a442), TOBN(0x7991f725, 0x4aa49b02),
+	TOBN(0xf81e86c0, 0x9f2f3847), TOBN(0xbe9f3928, 0x1bbd6a82),
+	TOBN(0xe8df7729, 0x5811f63a), TOBN(0x81277a56, 0xe88f07a9),
+	TOBN(0x9980c78b, 0xe1db3c9f), TOBN(0xc7dfea7f, 0xdb86e986),
+	TOBN(0x18776d9f, 0xd6e66aec), TOBN(0xe416fe14, 0x440cbf00),
+	TOBN(0xdd5f823a, 0x05bb938d), TOBN(0x5b392434, 0xb71ddd3e),
+	TOBN(0x1a20b3c6, 0xe05279bc), TOBN(0x3c327c89, 0x3e536ad2),
+	TOBN(0xc781fffc, 0x48901da3), TOBN(0xf6e1e171, 0x4b5b577f),
+	TOBN(0x803ae9b6, 0xe1f4a9cf), TOBN(0xaa32c6fe, 0x7eeedf08),
+	TOBN(0xb4f18c56, 0xe24768f1), TOBN(0x03bbf8eb, 0xa8d9dea7),
+	TOBN(0xc513d033, 0x4bb4ee8c), TOBN(0x6a162d1f, 0x87e8db23),
+	TOBN(0x6ae9117f, 0x9051a984), TOBN(0x9e1d5477, 0x5474499d),
+	TOBN(0xd80d97d0, 0x8e5e62f8), TOBN(0x65910f9e, 0xfe7e1721),
+	TOBN(0xba01ad24, 0x8ec29285), TOBN(0x38d42aa8, 0x78314670),
+	TOBN(0xeeedc99c, 0x1a4307f9), TOBN(0x1eb26e43, 0x66a775b2),
+	TOBN(0x26f041d6, 0x0dfc6b88), TOBN(0xfc1a8e2e, 0xb49b7aaf),
+    },
+    {
+	TOBN(0x3e23f893, 0x5079f58b), TOBN(0xc5be4588, 0x7a9d8110),
+	TOBN(0xe807c523, 0xe7e94e81), TOBN(0x362b7664, 0xcdbd4ab0),
+	TOBN(0xff3d8934, 0xb948d399), TOBN(0xbb22fb67, 0x54a2a665),
+	TOBN(0x1e759cef, 0x4d1ea5a3), TOBN(0xcc2b11c1, 0x8eb76de8),
+	TOBN(0x1da6c906, 0xed3153b8), TOBN(0xad91c9db, 0xa1990160),
+	TOBN(0x92170c84, 0xa62d15ed), TOBN(0x2b38b4c7, 0x358bf98e),
+	TOBN(0x82c700b1, 0x470c6c23), TOBN(0xd105eb67, 0x714b3ebb),
+	TOBN(0xb885f527, 0x14d0577a), TOBN(0xe77c0568, 0x35da4c97),
+	TOBN(0xa5db086f, 0x0bf84e6f), TOBN(0xbaa87b83, 0xa433a4dd),
+	TOBN(0xdfb44da9, 0xacd74f91), TOBN(0x02f07b0d, 0xa819dacf),
+	TOBN(0xefb61e73, 0x709b7ed6), TOBN(0x55463345, 0x4bee81b5),
+	TOBN(0x67219b3d, 0x1182f566), TOBN(0x17521d31, 0x7b2d32c3),
+	TOBN(0xc26857f4, 0x033167f0), TOBN(0xd8119270, 0x072a9415),
+	TOBN(0x0066952e, 0xbae84e5f), TOBN(0x56a724f5, 0xd99e2f60),
+	TOBN(0x9769b709, 0xa762dd24), TOBN(0x19dd2920, 0x9c621a1c),
+	TOBN(0xd3e977a7, 0xcacee98a), TOBN(0xffd9f747, 0xe2665009),
+	TOBN(0x8d8fa1ac, 0x1d16576c), TOBN(0x078f665c, 0xf9d77ca2),
+	TOBN(0x1a152a80, 0xf5c9dd02), TOBN(0x09a40710, 0xc093c80b),
+	TOBN(0x1ad1b8eb, 0xbaaae26a), TOBN(0x6e339f56, 0x9fc97d6d),
+	TOBN(0xe2103f14, 0x66c6ebbd), TOBN(0xa21f15aa, 0x8e4a66c5),
+	TOBN(0x0464dc27, 0x572d426f), TOBN(0x08d146c0, 0x7140e333),
+	TOBN(0x63b31ca0, 0x33a154fa), TOBN(0xcde52043, 0x723225b3),
+	TOBN(0x0aadc50b, 0xb9acd2d1), TOBN(0x43de9d46, 0xf27f2c43),
+	TOBN(0x81bbe163, 0x1872beda), TOBN(0x516130cc, 0x289bc6d5),
+    },
+    {
+	TOBN(0x7c47f126, 0xa0f3eb16), TOBN(0x8b7c8b10, 0xf53b0220),
+	TOBN(0xd00f8a47, 0xcfd29d03), TOBN(0x6c56ecc9, 0x9b7a9561),
+	TOBN(0xfe7b1269, 0x7291a732), TOBN(0x7645f6ce, 0xa9454ccb),
+	TOBN(0x3ceb39de, 0x9a3d4b47), TOBN(0x98562383, 0x1d6edbd0),
+	TOBN(0x3b4d920d, 0xda62a771), TOBN(0x5b2393b7, 0x433202c0),
+	TOBN(0x242e1909, 0x4c5a2bdb), TOBN(0x5671698e, 0x6b17f31d),
+	TOBN(0x058e0162, 0x8e18d846), TOBN(0xa20bd6ce, 0xe2967d77),
+	TOBN(0x710bea4e, 0x29a0aef5), TOBN(0xcef80ad0, 0x6bb4992f),
+	TOBN(0x4bb610de, 0x17f09cdf), TOBN(0x7550f707, 0x486749bb),
+	TOBN(0xbf689b53, 0x59ae9f23), TOBN(0x05e0f61b, 0x5033b59f),
+	TOBN(0xdf6c3ce6, 0xe136fdac), TOBN(0xaa8c668a, 0x97dd036b),
+	TOBN(0xce43367a, 0x2305eacc), TOBN(0x2ea43a62, 0xf65a6586),
+	TOBN(0x84d0afe8, 0x0662cfe0), TOBN(0xb02324e0, 0x0e55282b),
+	TOBN(0x00cd2a5d, 0x75d09cbf), TOBN(0xad4e49eb, 0xb33c5ec0),
+	TOBN(0x2ed36e13, 0x4ec5ba48), TOBN(0x33ba5241, 0x38c43439),
+	TOBN(0xa7d2ef4f, 0x959dd314), TOBN(0xffb3ee8f, 0xc4cca013),
+	TOBN(0x1b1f4358, 0x3a2caed9), TOBN(0x0f1eccb9, 0xf3aef945),
+	TOBN(0x342a5501, 0xeb93ba04), TOBN(0x13480e21, 0x81279016),
+	TOBN(0x35a371d7, 0x7555c4d4), TOBN(0xdc673ead, 0x3f92fada),
+	TOBN(0xc4207e28, 0xcd8dd77a), TOBN(0x443e2b55, 0x1c94cd8b),
+	TOBN(0x08c9b84e, 0xae5a84df), TOBN(0x11a28d80, 0xe281c666),
+	TOBN(0xc7663940, 0x6742a9f4), TOBN(0x9bca4086, 0xe4644b66),
+	TOBN(0x155b8a17, 0x7359a5a3), TOBN(0x87bd3a8d, 0xe4fe5886),
+	TOBN(0x0377c2c6, 0x30e57db4), TOBN(0xa2c26198, 0x51378dab),
+    },
+    {
+	TOBN(0x27c61fce, 0xa71fdfb4), TOBN(0xaf8c3834, 0x8a59813e),
+	TOBN(0xc410404e, 0xc02e5070), TOBN(0xf0e539a9, 0x57b47160),
+	TOBN(0xba5f7dbc, 0x3ff45a8c), TOBN(0xbd5c0544, 0x207d1adc),
+	TOBN(0x27e59c58, 0x621b0a10), TOBN(0xc09a0837, 0xee502c77),
+	TOBN(0x1a8f274c, 0x5b9f2246), TOBN(0x10e93745, 0x93b721a6),
+	TOBN(0x4403e17d, 0x06baf92c), TOBN(0xf79a81f6, 0xda0d97a4),
+	TOBN(0x8d978179, 0x51e9abdb), TOBN(0xec3ade5f, 0xdb4790fd),
+	TOBN(0x8bcb76c5, 0xaaee77ce), TOBN(0xf7a90dae, 0x0964925e),
+	TOBN(0x83d55b2e, 0xc4d28c02), TOBN(0x6d872884, 0x738327cb),
+	TOBN(0xab278b09, 0x405e2e33), TOBN(0xf08f53a6, 0x3f837ef6),
+	TOBN(0x704d1c9d, 0x4d3409ec), TOBN(0xe6c15e97, 0x208a107b),
+	TOBN(0xe762c1ec, 0x678776de), TOBN(0x4d46fd01, 0x84b2f2a6),
+	TOBN(0x761f45c5, 0xa78c8984), TOBN(0x209e0be0, 0xbd5b87a4),
+	TOBN(0xa0c68691, 0x96ac5351), TOBN(0xac76f3c3, 0x620c5c30),
+	TOBN(0xbae43811, 0x9efa922f), TOBN(0x40ad754b, 0x2cb049bb),
+	TOBN(0x6689f421, 0xedff99a4), TOBN(0x773fba5c, 0x394c465c),
+	TOBN(0x1440766d, 0xe9529090), TOBN(0xec2b32b2, 0xfcc09ba8),
+	TOBN(0xf5fbcefd, 0x6478126e), TOBN(0x23ce4f6b, 0xfcd1b587),
+	TOBN(0x64cd8ea2, 0x89ca9e12), TOBN(0x1f0b94ef, 0x702af464),
+	TOBN(0x0e03ca64, 0xb496c813), TOBN(0x8859bcaa, 0x59a416d6),
+	TOBN(0x5e70ee20, 0x45872f30), TOBN(0x93fec6e3, 0xe4af5399),
+	TOBN(0x165f73cb, 0xac2d8727), TOBN(0x28cefdb6, 0xc5fcb006),
+	TOBN(0x10302e02, 0xc65ec491), TOBN(0xdad120b8, 0xadf2f122),
+	TOBN(0xe2050709, 0x6005cc47), TOBN(0xaab6c8be, 0x64a727c8),
+    },
+    {
+	TOBN(0x4f8c3f9d, 0x4e3fbf69), TOBN(0x13959f48, 0x6b782fb1),
+	TOBN(0x444524a0, 0x9f5f9053), TOBN(0xd8e823b2, 0x3a833790),
+	TOBN(0xfdb572b7, 0xc50f6e37), TOBN(0xbed6f330, 0xc698d84c),
+	TOBN(0xfdac0d98, 0xacbaf414), TOBN(0xa8be0dfc, 0x9dd7ee89),
+	TOBN(0x43ee5491, 0xddb43c28), TOBN(0x52ee9c65, 0x0c9b54e0),
+	TOBN(0x697b2e19, 0xc35090ba), TOBN(0x433f5560, 0xd911fb71),
+	TOBN(0x6797f36c, 0xfcf172f0), TOBN(0x4d8b4b68, 0x5989157d),
+	TOBN(0x2a9b6886, 0xfd010093), TOBN(0x46fcf9b0, 0x33ac6a58),
+	TOBN(0x5a779f50, 0x85549dd2), TOBN(0xc59bc2ae, 0x5c5b8b69),
+	TOBN(0x407ceff9, 0xe7c25756), TOBN(0xa7895dcf, 0x94719308),
+	TOBN(0x026e6d44, 0x050ffcc1), TOBN(0x17bd5f3d, 0xd1c7ce2d),
+	TOBN(0x339e0035, 0xe3074b2e), TOBN(0xb6ef82d6, 0xf1575f4a),
+	TOBN(0xb9ae2d45, 0x20e244cc), TOBN(0x4fc7abb8, 0xb09eedcc),
+	TOBN(0xda80d7d4, 0xe29c0e9d), TOBN(0xba18be7f, 0x538221f3),
+	TOBN(0x59657ccd, 0x1d6fd1a3), TOBN(0xfdf58d72, 0x7cbce5e1),
+	TOBN(0x63fda89a, 0xdeda63e8), TOBN(0x55a52c82, 0x5642b91e),
+	TOBN(0x66807023, 0x3141621b), TOBN(0x8f2dff14, 0x0c9cdc12),
+	TOBN(0x3d5879e9, 0x4ca504f7), TOBN(0x596432dc, 0x9f19cb6a),
+	TOBN(0xbd9bc08e, 0x1f8e8436), TOBN(0x49cae6f5, 0x3a1dfb5d),
+	TOBN(0x3781df53, 0x06cf115f), TOBN(0xc0d243e7, 0x45f66b66),
+	TOBN(0x8cb6d1d2, 0x98af4a29), TOBN(0x38687413, 0xfc246417),
+	TOBN(0xdb74df1d, 0xca270971), TOBN(0x4f923cc7, 0x50e5c4e9),
+	TOBN(0xf75e0dfd, 0x0255bcae), TOBN(0xf0dbdee5, 0xdb09c572),
+	TOBN(0xfafa3370, 0x9ea2d65a), TOBN(0x556d917c, 0xc94e4f91),
+    },
+    {
+	TOBN(0x75b78711, 0x64d0acbd), TOBN(0xfd478bfc, 0xf7f25210),
+	TOBN(0x20279ebd, 0xe25e47eb), TOBN(0x2b5153c0, 0xf5932030),
+	TOBN(0x7e040246, 0x31ac69de), TOBN(0x98693ea9, 0x3fe184ef),
+	TOBN(0x1e3e220c, 0x489e1e5d), TOBN(0xdfd29903, 0x88d26955),
+	TOBN(0x0257c15c, 0x2e3278ee), TOBN(0x17895121, 0x1f7abbf9),
+	TOBN(0x597ab43e, 0x07a7bd91), TOBN(0xfd043622, 0x04441b3f),
+	TOBN(0xcd11f87b, 0x8d69b4e1), TOBN(0x67af1c69, 0xb2452dfa),
+	TOBN(0x9f80ae4d, 0x265f89fd), TOBN(0x301310df, 0x46b49e55),
+	TOBN(0x83b149b6, 0xa704a12b), TOBN(0x3075e0cb, 0xb7aba0a1),
+	TOBN(0x9b95cd69, 0xa3d5401b), TOBN(0x90eb7d7a, 0xcf921181),
+	TOBN(0xd3ca6e5c, 0x90ae2942), TOBN(0x1ce03b5e, 0xc90668f8),
+	TOBN(0x030eeff4, 0x97ac56c4), TOBN(0x7ee230ca, 0xef038bde),
+	TOBN(0x85a84154, 0x6499ee22), TOBN(0x939e0288, 0x1b6542f4),
+	TOBN(0x567d798b, 0x35eed371), TOBN(0xb1b64892, 0xa410fd0d),
+	TOBN(0x4fceecd3, 0xf1819f31), TOBN(0x2c745a2d, 0x8689e4dc),
+	TOBN(0x0fd1ea63, 0x56973948), TOBN(0x55caaaba, 0x867abfc5),
+	TOBN(0xf1bf1a83, 0xbb8a6ea7), TOBN(0xd9de4ffc, 0x5471dd8d),
+	TOBN(0x05613a5a, 0x55cab66e), TOBN(0xa8f1b814, 0x73e5faba),
+	TOBN(0x399fdfb7, 0x520de491), TOBN(0x60bdfe14, 0x8af344cb),
+	TOBN(0xafec92ef, 0x2ef53e8e), TOBN(0xa0281fee, 0x22b1b50f),
+	TOBN(0xad4ae6e9, 0xf4d5dfeb), TOBN(0x36ac4647, 0x6917c060),
+	TOBN(0x6799b29d, 0xc722aeb5), TOBN(0x4e72d306, 0x03fbb1ef),
+	TOBN(0x18757f17, 0x02f9d550), TOBN(0x6c24f938, 0xb0df44ef),
+	TOBN(0x3942f1a4, 0xf60db3d4), TOBN(0x2bce5570, 0xc29a493b),
+    },
+    {
+	TOBN(0xeb6f0e22, 0xc9a1597a), TOBN(0xfa8f17f9, 0xefe4a420),
+	TOBN(0x404f3d7b, 0xc4bc8fd7), TOBN(0x56a2a781, 0xeb264060),
+	TOBN(0xfc08048c, 0x6358d3bc), TOBN(0x30d27d52, 0x7fc309de),
+	TOBN(0x3c7c4418, 0x913c3cbb), TOBN(0xbfa53207, 0x11a4d2aa),
+	TOBN(0x04af82b8, 0x5c64f1dd), TOBN(0x2f12a242, 0x3ef577f2),
+	TOBN(0xb2f5687c, 0x0f4f7b22), TOBN(0xfa086c44, 0x0888367e),
+	TOBN(0x9a23f0f7, 0x1ad369c3), TOBN(0xcf5e38d3, 0x648a5bf5),
+	TOBN(0x3f015c9a, 0x4cbf13fa), TOBN(0x602621be, 0x8d693cab),
+	TOBN(0x0762936d, 0x4e094256), TOBN(0x60ebc197, 0x6f574143),
+	TOBN(0x372b9ad3, 0x47aa8036), TOBN(0x21d6faf5, 0x9f242303),
+	TOBN(0xa794dcb9, 0x215c5285), TOBN(0x39c076bd, 0x920cd1f1),
+	TOBN(0x061ddfe9, 0x2f58ad88), TOBN(0xfdc46195, 0xde0717bc),
+	TOBN(0x0b5082a8, 0xc933dc44), TOBN(0x273c0510, 0x36ca85e9),
+	TOBN(0xacfaf316, 0x6bdda6e3), TOBN(0x636c9125, 0x4821fa1a),
+	TOBN(0x9f9dd9a7, 0xe3033e63), TOBN(0x58e8b45b, 0x0d13c9b8),
+	TOBN(0x1fa3d4c6, 0xad2e7290), TOBN(0xab955575, 0x0cf57f8a),
+	TOBN(0xe37e3507, 0x7714dd4e), TOBN(0xb3bc9ff8, 0xa8e3bb1b),
+	TOBN(0x0ac274b4, 0xab956cdd), TOBN(0x51e37028, 0xe7cbf574),
+	TOBN(0x733fbf6e, 0xa41bc923), TOBN(0xc17bfc29, 0x15e68996),
+	TOBN(0x5fd925de, 0x5dea7d1c), TOBN(0x40503fdc, 0x45636a1f),
+	TOBN(0x5a95cdd3, 0xe9abbfd7), TOBN(0x6d588c8e, 0xd22f80c1),
+	TOBN(0xcf33653b, 0x8e455d6a), TOBN(0x9ce5a60c, 0x07f763de),
+	TOBN(0x30eafe2e, 0x05f3aaa0), TOBN(0xd849f271, 0x61be89de),
+	TOBN(0x7285e349, 0xec1b67a8), TOBN(0x579caae1, 0x85349276),
+    },
+    {
+	TOBN(0xd01325d1, 0xf6717398), TOBN(0x36c0623c, 0x4fc1ca09),
+	TOBN(0x856906ba, 0x2ce57a84), TOBN(0x5e004d67, 0x276a3bec),
+	TOBN(0x894a708f, 0x0d95c551), TOBN(0x271925b3, 0xba867951),
+	TOBN(0x85cc3349, 0x81d9beeb), TOBN(0x4ff725a4, 0x9ec10faf),
+	TOBN(0x2fa1563b, 0x79faebd2), TOBN(0xf3ef3a6c, 0x6899a58b),
+	TOBN(0x82408b82, 0x6c5c60e7), TOBN(0x503d83ac, 0x798c8df0),
+	TOBN(0xc7eca90a, 0x1ea95551), TOBN(0x97dae601, 0xde2b240e),
+	TOBN(0x2b3ec0df, 0x5a1af4b0), TOBN(0xd650f187, 0x065eb25d),
+	TOBN(0x8a146251, 0xc5476bcd), TOBN(0xb20a10d8, 0x7bc48004),
+	TOBN(0x0444e88a, 0x27ca4261), TOBN(0x6a13ed31, 0x96a3e7f5),
+	TOBN(0xcf45c596, 0x0f340745), TOBN(0x97b852d4, 0x32d1f494),
+	TOBN(0x50b3ed5f, 0x337d0b13), TOBN(0xa8463a50, 0x135c3a67),
+	TOBN(0x1db5da05, 0x4eaf35b4), TOBN(0xd15f129d, 0x0eb9b705),
+	TOBN(0x589baf77, 0xc2ccd6b2), TOBN(0xf7cd1772, 0x64e20b68),
+	TOBN(0xc16bfe51, 0x40e79eb1), TOBN(0xd0136f52, 0x04e218ea),
+	TOBN(0xe86a45fd, 0xebcd8687), TOBN(0xfb918af1, 0xcb51f0bc),
+	TOBN(0xe74911ac, 0xd931e4b4), TOBN(0x0d74b8eb, 0x41d24639),
+	TOBN(0x388c7926, 0x6f9364f8), TOBN(0xc275af6f, 0xc4b6c357),
+	TOBN(0x6fd038b5, 0x29ec6811), TOBN(0xdfdb0d7a, 0xe711f41c),
+	TOBN(0x51e89089, 0x897c97fd), TOBN(0xc6a9de1d, 0x9c0e6c77),
+	TOBN(0x30fcf4f9, 0x59e8e8cf), TOBN(0x5f94e330, 0x4bd0fbdd),
+	TOBN(0x51371533, 0xdc140a26), TOBN(0xcf463628, 0x26e34437),
+	TOBN(0x0d87619c, 0x7656cd90), TOBN(0x2d572f39, 0x144ccc53),
+	TOBN(0xc9fbbbc4, 0xdb89b2aa), TOBN(0x82e08955, 0x3969b49a),
+    },
+    {
+	TOBN(0xa0264ba3, 0xece2e731), TOBN(0x21fdf357, 0xf648c148),
+	TOBN(0xc6f6b177, 0x78cde47a), TOBN(0xb31e4b2d, 0xd9eecca7),
+	TOBN(0x9b8b585d, 0x605243c0), TOBN(0x9251340f, 0xfaab9536),
+	TOBN(0xb9793b7a, 0xec385dc9), TOBN(0xc77848d5, 0xfeb9b4fa),
+	TOBN(0x6e12b270, 0x1a6bcf3f), TOBN(0x18faa2b2, 0xb6605caa),
+	TOBN(0xe5f48224, 0x8e936032), TOBN(0xf48558cc, 0x180fe809),
+	TOBN(0xdc42428e, 0x9670c5da), TOBN(0xa4cb5aac, 0x5f503b9f),
+	TOBN(0x6981fcba, 0x5b59fa56), TOBN(0x044cc162, 0x2da0aa55),
+	TOBN(0x66f5ad96, 0x863e5d68), TOBN(0x4ea19356, 0x6cde3bdb),
+	TOBN(0xf2b7aafb, 0xb69a7fb3), TOBN(0x9a9290e6, 0x42b26504),
+	TOBN(0xc05fbf35, 0x890ff772), TOBN(0x79ab47b7, 0xf657965f),
+	TOBN(0x0640571b, 0x7af27397), TOBN(0x6cedfd74, 0x0ea9eecb),
+	TOBN(0x08db55c4, 0x6f279d2d), TOBN(0xb149b931, 0x535b4c8e),
+	TOBN(0x4a2b29a1, 0x3add1560), TOBN(0x50c505dd, 0x592d8063),
+	TOBN(0x6675094c, 0x6149eaa8), TOBN(0x1cc18180, 0x2d20843f),
+	TOBN(0x67be4c52, 0xda763db0), TOBN(0x5e48cdad, 0x7a4e0ddf),
+	TOBN(0x0c91a6a1, 0x11000a64), TOBN(0xd1c10b84, 0x96c03136),
+	TOBN(0xc279ce3b, 0x62dbaa09), TOBN(0x96b2f2e4, 0x2ee3e708),
+	TOBN(0xd3a114b3, 0x5fd21835), TOBN(0xcb69d80c, 0x27ebfacd),
+	TOBN(0xbf4b6b9c, 0xb09ab134), TOBN(0x3d7286cd, 0xcacb16a8),
+	TOBN(0x31cedf84, 0xc172bd68), TOBN(0xcf94acac, 0xca67b49f),
+	TOBN(0x512421ee, 0x29f40f6e), TOBN(0x9c80adaa, 0x12b2ed4c),
+	TOBN(0xf20c7530, 0x6245cead), TOBN(0x95e7fbe6, 0xa7bd7bd4),
+	TOBN(0xcae79ce7, 0x95aaa31f), TOBN(0x05c112aa, 0x72d36935),
+    },
+    {
+	TOBN(0x5af5596f, 0xc421ab18), TOBN(0x6dba69de, 0xe750d5ac),
+	TOBN(0x23713cc1, 0xff9ab751), TOBN(0xab0304da, 0xf8e8b53b),
+	TOBN(0x773e5f57, 0x069df8dd), TOBN(0xa66951ab, 0x447c2338),
+	TOBN(0x7676f88f, 0x8f9da0f6), TOBN(0x34e13b8e, 0xe5500aab),
+	TOBN(0xddd04d31, 0xa7a99c81), TOBN(0xc573a214, 0x56f470da),
+	TOBN(0xf8d2642f, 0x9e49bddd), TOBN(0x4f222d96, 0x26f4d193),
+	TOBN(0x0a064911, 0xa77642b7), TOBN(0xca3ce797, 0xb8d39463),
+	TOBN(0xd14763cf, 0x5e542ecf), TOBN(0x9394a485, 0x0acc576d),
+	TOBN(0xb2d1ec4a, 0x217c09c3), TOBN(0xaf65ae9b, 0xa27a2e37),
+	TOBN(0x4bae8c9e, 0x67a72e33), TOBN(0x3b708713, 0x16ba9252),
+	TOBN(0x57f440e3, 0x03fe950a), TOBN(0x1e53aff8, 0x30ab7ee7),
+	TOBN(0x1682592d, 0x81812675), TOBN(0xb4405a08, 0x27b902ec),
+	TOBN(0xdc2d7e9a, 0x86f2f0dc), TOBN(0x52c19b77, 0x5bc4cc8b),
+	TOBN(0x5e4ea9c6, 0x3a9caa4f), TOBN(0xba60eb68, 0xf8565c60),
+	TOBN(0x4290e57a, 0x449d89cb), TOBN(0x89615549, 0x107e24aa),
+	TOBN(0x542d78c1, 0x1bbe035a), TOBN(0xcf52da1c, 0x9584c68c),
+	TOBN(0x6da8072a, 0xe5d727e1), TOBN(0x8a98ae1c, 0x652be544),
+	TOBN(0x9c18329e, 0xefb3a94c), TOBN(0xb07eb147, 0xa308722e),
+	TOBN(0x369cad86, 0x7d37d6fe), TOBN(0x26eb9b52, 0x99ff3b87),
+	TOBN(0xdc06f43a, 0xdd146e34), TOBN(0x6c63c26b, 0x6bee4a74),
+	TOBN(0x06813ec4, 0xefb7c666), TOBN(0xb8486500, 0xa95b8767),
+	TOBN(0xc5926e31, 0xbda6641c), TOBN(0xbfe8e12e, 0xc698df1e),
+	TOBN(0xdbbec775, 0x9b3efc3b), TOBN(0xfe433efb, 0xe058c664),
+	TOBN(0x687ff729, 0x970bdaa4), TOBN(0xce82dacd, 0x6aeaf539),
+    },
+    {
+	TOBN(0xb5eab2df, 0x88435631), TOBN(0x8ff2029d, 0x2566d88d),
+	TOBN(0x03071d87, 0x1e385e14), TOBN(0x4d23ba15, 0x7cebbf45),
+	TOBN(0x777335ed, 0x5262aad9), TOBN(0x90f18bff, 0x0e96e904),
+	TOBN(0x9acec607, 0x07c021e0), TOBN(0x914c74aa, 0x8bd7aaf2),
+	TOBN(0xca70a05c, 0x75c9309d), TOBN(0xbc037202, 0x9315f349),
+	TOBN(0xd318337e, 0xf26e1a1d), TOBN(0xf24eac9f, 0x72e06f50),
+	TOBN(0x6075829d, 0xa80aa0a6), TOBN(0x098f5dd8, 0x14a11c48),
+	TOBN(0xb593429a, 0x63cc6e95), TOBN(0x7ed4275e, 0x367bf476),
+	TOBN(0xb870c187, 0x3ea79953), TOBN(0x4958cedc, 0xba499841),
+	TOBN(0x818af324, 0x36545757), TOBN(0x3d4bc4a9, 0x42dfb9bf),
+	TOBN(0xd1bcb5cf, 0x72a512fc), TOBN(0x86e201ff, 0xf20aab04),
+	TOBN(0x91dd2eb8, 0x16faaa5a), TOBN(0x84e23ce4, 0x37637fd4),
+	TOBN(0x85ca9eee, 0xdfaf137d), TOBN(0xb40ecae5, 0xed71779b),
+	TOBN(0x55911e3e, 0x2a7cbc99), TOBN(0xd5ecadca, 0x80162253),
+	TOBN(0x68bed79e, 0x68b5c0db), TOBN(0x8f5d4d6e, 0x44589bbe),
+	TOBN(0x3f44b1d9, 0x3a573755), TOBN(0x05cb6c03, 0x0eb3b97e),
+	TOBN(0x194f919d, 0x2a4a90be), TOBN(0xcc08f5e6, 0xdd736f4b),
+	TOBN(0x8991412c, 0x631c32b2), TOBN(0x72c4f693, 0xeb8744b7),
+	TOBN(0x6139fe56, 0x0668f60f), TOBN(0x598af3bb, 0x8dc689a3),
+	TOBN(0xd38832ff, 0x57ca5da1), TOBN(0x88e64f69, 0x6a8ad2a3),
+	TOBN(0xdcd7731b, 0xed107895), TOBN(0x80fbb04d, 0x857ccbb2),
+	TOBN(0x39dad3e9, 0xed18c35b), TOBN(0x7dc603b7, 0x521e231b),
+	TOBN(0x8e7b40e2, 0xac162c03), TOBN(0x37c01b6c, 0x3fd56ff8),
+	TOBN(0x07f013b1, 0x0caef315), TOBN(0x9d05b59a, 0xd5d5ea73),
+    },
+    {
+	TOBN(0x6f3c316c, 0xfb01f24a), TOBN(0xd085f876, 0x412ff968),
+	TOBN(0x741d9f9f, 0x7e0b702e), TOBN(0xaee16c5a, 0xfe5e3eda),
+	TOBN(0xdd6cbd3f, 0xb1ffca1d), TOBN(0x8e3015b3, 0xd5cc0ef3),
+	TOBN(0x265c4033, 0x2b2819db), TOBN(0xc7b6bb43, 0xe2239cdd),
+	TOBN(0x6b751211, 0x7c8115d2), TOBN(0x194f455e, 0x73452603),
+	TOBN(0xc1d359fb, 0x37769d55), TOBN(0xaa0bdfb5, 0x071f3e52),
+	TOBN(0x0a49dd1c, 0x7c97f659), TOBN(0xe72b44f5, 0x28551706),
+	TOBN(0xc844bde0, 0xce9d5599), TOBN(0x9c7b2b07, 0xe066929a),
+	TOBN(0x9f476d12, 0x3e840f6e), TOBN(0x8fbe8a2a, 0x32054e09),
+	TOBN(0xf55f9b98, 0xb5f98c26), TOBN(0x358d148f, 0x29b8f6da),
+	TOBN(0x7fb51ca9, 0x8bdb1628), TOBN(0x9d65ce7d, 0xa6e15986),
+	TOBN(0xf9394ecd, 0x6f909b80), TOBN(0x484d6eac, 0xd61dbcc2),
+	TOBN(0xce102dae, 0x61543595), TOBN(0x3cb6ea87, 0xe9101c7e),
+	TOBN(0xfea16ce6, 0x8840475a), TOBN(0x726bd736, 0xe27482e7),
+	TOBN(0x9f38616d, 0xcc7ed8a5), TOBN(0x112fc1f8, 0xa06cd2ec),
+	TOBN(0x31448111, 0x9ef906cf), TOBN(0x0d454cf5, 0xf02dff6f),
+	TOBN(0x87e0e606, 0xf41e7183), TOBN(0x5dd41cf0, 0xcb177303),
+	TOBN(0xcaabfca4, 0xc868e9ef), TOBN(0x56f8ac9a, 0xa727395d),
+	TOBN(0x2a07392e, 0x89d59c8d), TOBN(0x337f4138, 0x0cfd2e73),
+	TOBN(0xc66e84de, 0x7c0d2027), TOBN(0x91d364cb, 0x5c72911c),
+	TOBN(0x7924345d, 0xd9d976d4), TOBN(0x818c434c, 0xd3b03599),
+	TOBN(0x4ddd1271, 0xabc57d1b), TOBN(0x74af0953, 0x37e1280e),
+	TOBN(0x28b4267e, 0xdffdee7a), TOBN(0x1297c883, 0x8a527a64),
+	TOBN(0xd59dc187, 0x1e8d5d66), TOBN(0x99961591, 0x00394181),
+    },
+    {
+	TOBN(0xde7862d9, 0xf603e495), TOBN(0x55891fcb, 0xd9252005),
+	TOBN(0xa45fe342, 0x1b19cfcf), TOBN(0x54e08915, 0x87d6d283),
+	TOBN(0x43cff1be, 0xa9264d59), TOBN(0x607f1410, 0x3136c07b),
+	TOBN(0xfa99554e, 0x3ed513aa), TOBN(0xb6f77414, 0x857ecf55),
+	TOBN(0xe5ba2a1c, 0x1f782340), TOBN(0x63bab896, 0xcbb75d9a),
+	TOBN(0x651a1f16, 0x24c7d90c), TOBN(0xa82210dd, 0x333548ce),
+	TOBN(0x60fcaab3, 0x524e07eb), TOBN(0x436c1892, 0xf3a4218e),
+	TOBN(0xa38df6bd, 0x445ebc29), TOBN(0x90a13463, 0xe1b06ad0),
+	TOBN(0x915bc317, 0x78b7a4a9), TOBN(0x0a0a85f9, 0xd95fd7e5),
+	TOBN(0xd4ed1118, 0xd2f9133d), TOBN(0x3184dfa1, 0x68dc82d0),
+	TOBN(0x213e6d5c, 0x825e1538), TOBN(0x85063f0a, 0xde766043),
+	TOBN(0x574b19f7, 0xf3199471), TOBN(0xacfc662d, 0x942cf382),
+	TOBN(0x698ffd16, 0x94719cee), TOBN(0x87f96907, 0x08081781),
+	TOBN(0x9636a47e, 0xc5c3f6af), TOBN(0x46028566, 0x54526f62),
+	TOBN(0x220dcf85, 0x78785e8f), TOBN(0x9efa26cd, 0x6435f843),
+	TOBN(0xf972c27a, 0x40cd3e3e), TOBN(0x81b051b5, 0xc4062b43),
+	TOBN(0x4dc14f55, 0x46d92400), TOBN(0x727fd38f, 0xa94a8ac9),
+	TOBN(0xe6b8d538, 0x1486b3f8), TOBN(0xbfb8ed39, 0xf3c4d315),
+	TOBN(0x480f15a6, 0x1fa4812c), TOBN(0x72b23f86, 0x73c26f7b),
+	TOBN(0xa8575446, 0x95bbc187), TOBN(0xd3c59429, 0x4b935ff3),
+	TOBN(0xc21d5e4d, 0xc153d971), TOBN(0x13836ce5, 0xda262817),
+	TOBN(0x4a701c69, 0xc956f559), TOBN(0xe7525400, 0x34aeb4fa),
+	TOBN(0x2865fef5, 0x35941080), TOBN(0x60692e7b, 0x93c8d7f7),
+	TOBN(0xe22ba86c, 0x1bb1f897), TOBN(0x332c2b22, 0x00728303),
+    },
+    {
+	TOBN(0x8aa3587f, 0x866c718f), TOBN(0x7c86a3f0, 0x4cfa88b1),
+	TOBN(0x66189dbd, 0xc980bb0d), TOBN(0xd2370a6c, 0x468903a0),
+	TOBN(0x7aac6a15, 0xa636d515), TOBN(0xcd6ff94c, 0x18e5352e),
+	TOBN(0x9497adc5, 0x62d99ca4), TOBN(0x88d9b911, 0x4cce8b77),
+	TOBN(0x099cde89, 0xb0624520), TOBN(0xff0bdca3, 0x1afbe38a),
+	TOBN(0xf2725feb, 0x884090e6), TOBN(0xb3214ff3, 0xac32d7ca),
+	TOBN(0xb35c16bb, 0xfa0634df), TOBN(0x2174f05c, 0x6fde6056),
+	TOBN(0x34c39d9f, 0xf85c4d45), TOBN(0x3d5a85ef, 0xec26191c),
+	TOBN(0xd6393177, 0x33eea84b), TOBN(0x44d43b27, 0x3aa2ec8f),
+	TOBN(0x61a39fe1, 0x5251aef2), TOBN(0xa3de3b0a, 0x22c622a1),
+	TOBN(0xd018983e, 0xe6783250), TOBN(0x11e8622a, 0xc6e9202e),
+	TOBN(0x76bcb805, 0xbec8c427), TOBN(0x12d20ae5, 0xe3f0deb2),
+	TOBN(0x38dc841f, 0x04c679e4), TOBN(0xbf2d78bf, 0x4d5cc8ce),
+	TOBN(0x231f15c4, 0x80122938), TOBN(0x48fa6a40, 0x7229f23f),
+	TOBN(0x96e0f697, 0xb20f946e), TOBN(0x0642dda9, 0x9aa2f63f),
+	TOBN(0xc58a1d05, 0xc1a37595), TOBN(0xbc396a8f, 0x3a8e840f),
+	TOBN(0x907f5fe8, 0x5d3efd3c), TOBN(0x7f97ead2, 0x874c8eae),
+	TOBN(0x1eac3158, 0x9ee27a9f), TOBN(0xd65f6f9e, 0xc4cf28fe),
+	TOBN(0x6b927a33, 0x4dfc36c9), TOBN(0x3e0f8b99, 0x907061b8),
+	TOBN(0xd2fe2744, 0xc6b0173b), TOBN(0x3b19fb83, 0xd6e78439),
+	TOBN(0x307ce138, 0xe5166ec5), TOBN(0x244c940a, 0x18935ac3),
+	TOBN(0xfb659dd4, 0xc31bed53), TOBN(0x72d7ca9a, 0x71e2bdad),
+	TOBN(0x70d3c073, 0xeb5f3f1b), TOBN(0xb2d1b828, 0x4d5e79b0),
+	TOBN(0x9ddb3650, 0x01b2e97d), TOBN(0xf59862cf, 0x8d1d12c8),
+    },
+    {
+	TOBN(0x1546b0ff, 0x0cd8e31f), TOBN(0xad8a76bf, 0xf0ba3e98),
+	TOBN(0x8855df7e, 0xb204658c), TOBN(0x9b8bc538, 0x182c5c0f),
+	TOBN(0x7e4f4b6a, 0x91946349), TOBN(0xdefedb40, 0xb7690cf0),
+	TOBN(0xd7103072, 0xae38193c), TOBN(0x393d6faf, 0x5ad4ac8a),
+	TOBN(0x2209c30c, 0x873a81dc), TOBN(0x2f33e720, 0x1b24d8a8),
+	TOBN(0xc6582af6, 0xc65bc030), TOBN(0xba4cf15a, 0x7d5c7bbe),
+	TOBN(0xb3211df2, 0x4d2a84f7), TOBN(0xb7ff6f61, 0x82b6b42f),
+	TOBN(0x7c8bb63b, 0x97dcab7f), TOBN(0xd25fea33, 0xf92f77d3),
+	TOBN(0xff3f4be1, 0x638cd662), TOBN(0x7435e7f3, 0xea9b14f1),
+	TOBN(0xad7519aa, 0x0ba958d4), TOBN(0x0e272c97, 0x5af6da5d),
+	TOBN(0xc2056487, 0x37984d89), TOBN(0x6e0b6665, 0x1e85ed93),
+	TOBN(0x5251ec68, 0x9189e5be), TOBN(0x42059e9f, 0xafd33761),
+	TOBN(0x3f28a9f7, 0xdb56258c), TOBN(0x8ce68575, 0xd0a17020),
+	TOBN(0xdf31f63a, 0xb567ba6c), TOBN(0xf31fab79, 0x73bd4e10),
+	TOBN(0x115ef9d9, 0x4399d620), TOBN(0x89205e2f, 0x58a23ee9),
+	TOBN(0x21fdfa62, 0x86221bca), TOBN(0xdf988ce8, 0x58c73485),
+	TOBN(0x5efe4318, 0x191a3b73), TOBN(0xb6076f53, 0x21b4c21f),
+	TOBN(0x8eb93e9f, 0xc179d558), TOBN(0xbe867342, 0x2f14b256),
+	TOBN(0xcb2597af, 0xa7f1b5a5), TOBN(0x87d2d449, 0x7aa8d605),
+	TOBN(0xc1769913, 0x2b01afaf), TOBN(0x2652c19a, 0x407d462d),
+	TOBN(0x30ceb803, 0xd7cdc953), TOBN(0x59040e60, 0x63ec726b),
+	TOBN(0xa581332f, 0xf803d5c8), TOBN(0xe3a3d68e, 0xa8b1e039),
+	TOBN(0xb8a532df, 0x4c56b1c2), TOBN(0xa0dd0dc5, 0x19e0d68f),
+	TOBN(0x72a691fd, 0xe1fd10c6), TOBN(0xeb30c59f, 0x1a3a2591),
+    },
+    {
+	TOBN(0x336c228b, 0x30ab4915), TOBN(0xd35ff55a, 0xe2b8649d),
+	TOBN(0x9b0ac053, 0x71156b8d), TOBN(0x16d22da8, 0xac5173f8),
+	TOBN(0x12a53394, 0xc196433c), TOBN(0x47f5f313, 0x0c0b7ef7),
+	TOBN(0x3576e899, 0x8807dec5), TOBN(0xe808bf7c, 0x07f14b86),
+	TOBN(0xb2485a9d, 0x7c3c2a67), TOBN(0x79af6ae7, 0xc291973b),
+	TOBN(0xe487d3a2, 0xacad0feb), TOBN(0xbc7fe838, 0x955b7ef1),
+	TOBN(0xa67f27c5, 0xc2052f1d), TOBN(0x880e61b0, 0x1319da62),
+	TOBN(0x1013260e, 0x9544180c), TOBN(0xe172d4dd, 0x4be02fb2),
+	TOBN(0xeabd3797, 0xee85ea09), TOBN(0x2265deae, 0x695bc892),
+	TOBN(0x39f72ace, 0xd5f4f9bd), TOBN(0xc64af77c, 0x92ae4918),
+	TOBN(0x55997046, 0xd455380e), TOBN(0x2aa261ee, 0x0649ec02),
+	TOBN(0xa3daf783, 0x02c2526a), TOBN(0xa38200e2, 0x56e752f3),
+	TOBN(0xcef75f28, 0xd36e0095), TOBN(0xf796f676, 0xc56cfb59),
+	TOBN(0x56d7b584, 0x503304e9), TOBN(0x423da72f, 0x1e9e67fc),
+	TOBN(0xfa64df82, 0xc3774ad0), TOBN(0x08892615, 0x2d2ef3a4),
+	TOBN(0x1630f463, 0x0d55e2d2), TOBN(0x5b4d59b1, 0x1742b8e7),
+	TOBN(0x586cbc7d, 0x45961f2a), TOBN(0xfe9227a9, 0x7748a1dc),
+	TOBN(0xc89a7620, 0xd74f212d), TOBN(0x05c1ca6d, 0xef414c91),
+	TOBN(0xfde5670e, 0x7392b1ad), TOBN(0x20b94680, 0x88375363),
+	TOBN(0xd243ba48, 0x7dd1fe79), TOBN(0x5484776b, 0xd34e192c),
+	TOBN(0xd71a952b, 0x715848f6), TOBN(0xb145d37c, 0x4cd04db8),
+	TOBN(0x2fd0ee15, 0xbf608715), TOBN(0x1a5cba47, 0xbf46bed6),
+	TOBN(0x7172fe33, 0x9c54070e), TOBN(0xe996623a, 0x7e7d50a9),
+	TOBN(0x818b151f, 0xe4be0d05), TOBN(0xc83dd839, 0x3b59b6b1),
+    },
+    {
+	TOBN(0x66d84516, 0x6156922b), TOBN(0x5b3d1995, 0x1c35f66f),
+	TOBN(0xf23a24aa, 0x012dc68d), TOBN(0x24c20bb0, 0xe3bd3cbf),
+	TOBN(0xae40de68, 0xc8533f96), TOBN(0xd40acece, 0x9db5a081),
+	TOBN(0x18cea61a, 0xf8949d7d), TOBN(0xf79b7c84, 0xd11a2ca8),
+	TOBN(0x7360bb34, 0x1eee4c6a), TOBN(0x247b03a9, 0x6a50400b),
+	TOBN(0xaa831265, 0x0f34be39), TOBN(0xcd0a21e4, 0x4fadca0c),
+	TOBN(0x99674005, 0xdd287973), TOBN(0x85325208, 0xc92da847),
+	TOBN(0x332ac718, 0xd1ac410e), TOBN(0x1a90880e, 0xb8a3a4ff),
+	TOBN(0x28475822, 0xd8bb59e0), TOBN(0x2f592f02, 0x480cccf8),
+	TOBN(0x5e1c2f85, 0x12efee6a), TOBN(0x5300a57c, 0x3ac7274b),
+	TOBN(0xcd071497, 0x13525905), TOBN(0x9f7f65eb, 0x9d47853a),
+	TOBN(0xac8e6b63, 0x197d0244), TOBN(0x63658a98, 0x95c01fe3),
+	TOBN(0x6b5e600b, 0x78a532ef), TOBN(0xfdb980e4, 0xc0c1d537),
+	TOBN(0x46a335ba, 0x55a971ce), TOBN(0xe5a62556, 0xcca6398b),
+	TOBN(0xd866cbaf, 0x666942e4), TOBN(0x8dacef06, 0x7dba39b3),
+	TOBN(0xc34ba91d, 0x1d86f644), TOBN(0x1dc06b2c, 0x122f9e33),
+	TOBN(0xeed8fc41, 0xe9c87f4f), TOBN(0xb3fbe901, 0x01ace87a),
+	TOBN(0xe295c830, 0x32532275), TOBN(0x1d4b28e0, 0x83f8f97d),
+	TOBN(0xefcb7165, 0xf31eab6c), TOBN(0x4d264a17, 0x6a36b95c),
+	TOBN(0xc001bf1a, 0x99457e2b), TOBN(0x5927b96a, 0x394a7013),
+	TOBN(0x7e0a1fe8, 0xf0517db5), TOBN(0x72f68d44, 0xcc665856),
+	TOBN(0x0e57d3b1, 0xf08d094d), TOBN(0x32adb5e9, 0x4379e28a),
+	TOBN(0xb9e3ae5e, 0xae4041a8), TOBN(0x0e6661e9, 0x7c1e8481),
+	TOBN(0x3a064f9d, 0xa81357d7), TOBN(0x907bb072, 0x76b36d63),
+    },
+    {
+	TOBN(0x6aad2fd8, 0x0a0ad7c1), TOBN(0x4abe7bec, 0xe12d5aa6),
+	TOBN(0x8e71755e, 0x6079f6c4), TOBN(0xac2f04ef, 0x5ccbdcee),
+	TOBN(0xafb13012, 0x6ec0ade3), TOBN(0xadb14d52, 0x4525f753),
+	TOBN(0x98b2bc45, 0xcbc21355), TOBN(0x732fc7ce, 0x5880e848),
+	TOBN(0xb140aaa2, 0x7acdcd09), TOBN(0x4e943826, 0x3dd7a223),
+	TOBN(0xe082efce, 0x01919b5b), TOBN(0xc2ae533a, 0xa4f6f833),
+	TOBN(0x5b077d32, 0xafe44382), TOBN(0x17325bbb, 0xd645bbc0),
+	TOBN(0x9933e039, 0x49754e8b), TOBN(0x1cc00d39, 0x07a1f83d),
+	TOBN(0x3cd489d3, 0x24e07916), TOBN(0x384c697c, 0x5fc00854),
+	TOBN(0x8bb306ca, 0x681c1153), TOBN(0x3a691d9a, 0x8a81cf44),
+	TOBN(0xd4c94aba, 0x5f68d529), TOBN(0x036d2be5, 0x85e80e9c),
+	TOBN(0x80f6ee3f, 0x1bbec412), TOBN(0x314d6bfe, 0xbebe2f97),
+	TOBN(0x60213aca, 0xf1cceeef), TOBN(0x27d1cef5, 0xba933117),
+	TOBN(0xe53453ba, 0x11a78984), TOBN(0xa2edf323, 0x683d01e6),
+	TOBN(0xbdf7d240, 0x56df44c6), TOBN(0x1f90e520, 0xd82cb7bc),
+	TOBN(0x18251fbb, 0xdb0336d1), TOBN(0x8f43a798, 0x349a53e9),
+	TOBN(0xf5f10edb, 0xb58ef7c1), TOBN(0x2c1f754e, 0x5f99761e),
+	TOBN(0x78000a41, 0x8df11e9b), TOBN(0x39c3ce36, 0x49436605),
+	TOBN(0x8953f5be, 0x09f89038), TOBN(0x78371c6b, 0xe72f6497),
+	TOBN(0x41f0fc92, 0x4840520e), TOBN(0x2f212246, 0xbe946e2d),
+	TOBN(0x6e3c8254, 0xc7bfcd80), TOBN(0x72a36511, 0x7c9e483e),
+	TOBN(0x9063508d, 0xbc924da2), TOBN(0x8ce600c0, 0x716fa82d),
+	TOBN(0xfe288366, 0x6da12e2e), TOBN(0xb38c6ee1, 0x3f58369b),
+	TOBN(0x6d2f0c4a, 0x6c9af8b8), TOBN(0xf65fc8a2, 0x091b2994),
+    },
+    {
+	TOBN(0xd55a5fb0, 0x1415af83), TOBN(0x49fa26b9, 0x191fe281),
+	TOBN(0xd9078ebf, 0xdff6dcfa), TOBN(0x4f7bba3e, 0x44b20eab),
+	TOBN(0xe858d764, 0x22a814e5), TOBN(0x9f81834d, 0x0fea913a),
+	TOBN(0xdf464d73, 0x8009069e), TOBN(0x0de98d29, 0x7239662c),
+	TOBN(0x71515b3e, 0x1c1191ae), TOBN(0xce449e26, 0x60dc55db),
+	TOBN(0xa2794abb, 0xb8fdd518), TOBN(0xd966f7e8, 0x6ee4bc90),
+	TOBN(0x0277eadf, 0xb8e6a23d), TOBN(0xa37a4620, 0x4f856b03),
+	TOBN(0x456c3b6e, 0x3a0eae0b), TOBN(0x912af8c6, 0x30273616),
+	TOBN(0xcc75fc99, 0x457077f8), TOBN(0x5b26449e, 0x34d54c7a),
+	TOBN(0x0193e77c, 0x373e1d96), TOBN(0x3b3cf1b8, 0x2a6e33a4),
+	TOBN(0xcb66c97e, 0x2979933a), TOBN(0x5114f9da, 0x9c83ca6f),
+	TOBN(0x66c658db, 0x4b75e594), TOBN(0x7efc60d1, 0x656dd92b),
+	TOBN(0x8db2174f, 0xb5630fa2), TOBN(0x5e2f31e2, 0xab0e40b2),
+	TOBN(0x635c7225, 0xd8927b03), TOBN(0xa706bd3f, 0x5fe36d60),
+	TOBN(0x5f8cb12a, 0x8d3936d1), TOBN(0xbbbc6d1d, 0xd3b5c1e3),
+	TOBN(0xc733ffce, 0xb8e19e42), TOBN(0x85ad06fa, 0x4cded437),
+	TOBN(0x29e1a0fe, 0xc9ba307d), TOBN(0x0f16844a, 0xd24e9100),
+	TOBN(0x4160f071, 0x9f971d50), TOBN(0x854f3071, 0x37fd2c65),
+	TOBN(0x06a88ec5, 0x1fea6882), TOBN(0xfc21f5ee, 0x2826dbc4),
+	TOBN(0x9f5c43ae, 0x2e222555), TOBN(0x0e610f20, 0x0fd71a14),
+	TOBN(0xac4dfa3b, 0x9d2086c9), TOBN(0xf5b1b06f, 0x2c024d61),
+	TOBN(0xcf7c98a1, 0xeaf09666), TOBN(0x17c042da, 0xa7cbb538),
+	TOBN(0xd34eb8c4, 0x50da8fe9), TOBN(0xa2527b36, 0xfdd45066),
+	TOBN(0x114e3df2, 0xb7cd2f3c), TOBN(0xecbf9144, 0x12365329),
+    },
+    {
+	TOBN(0x4fec552a, 0xf9d3f948), TOBN(0x3578ecf9, 0xff8b3e7a),
+	TOBN(0xd7eeaeb3, 0x899dc9e9), TOBN(0x3a881512, 0x31f64286),
+	TOBN(0xfca9f42d, 0xfaa5b022), TOBN(0x0b517d6a, 0x66fa4d5e),
+	TOBN(0x5eb1757c, 0xc3ee2b5f), TOBN(0xbebbb501, 0x48490bb4),
+	TOBN(0x0f2a3b4d, 0xbe45f959), TOBN(0x92b9f9c5, 0x6a8eae66),
+	TOBN(0x62f75c78, 0x9a28c20f), TOBN(0x3da4ebba, 0x089a6c16),
+	TOBN(0x55f0104e, 0x0aafdb14), TOBN(0x8e2493a2, 0x7149991c),
+	TOBN(0x06a0a734, 0x42a22c45), TOBN(0x89bac4c0, 0xe4796687),
+	TOBN(0x2c3bd484, 0x2b8948da), TOBN(0x0057ab3b, 0x8759cd6d),
+	TOBN(0x610f5b32, 0xccd1448a), TOBN(0x9ca2ae09, 0x56494ff3),
+	TOBN(0x788a04b5, 0xa933fe6f), TOBN(0x64e96f06, 0xde3c3ae9),
+	TOBN(0xcda2c6da, 0xcfb142df), TOBN(0xbd0bba23, 0xe0252b3e),
+	TOBN(0xf4003e55, 0xa733552a), TOBN(0x44c083f1, 0x95c38fe4),
+	TOBN(0xd2b87b95, 0x0e4403bb), TOBN(0xfd857a25, 0xa6731799),
+	TOBN(0x017d153a, 0xe56cbefc), TOBN(0x91020dbc, 0xbf26457b),
+	TOBN(0xc4914f3d, 0x89ae168b), TOBN(0x2c321f05, 0x0a78fb11),
+	TOBN(0xbd8a271f, 0xc05790eb), TOBN(0x45c2274b, 0x008f00a6),
+	TOBN(0xb1ecd05e, 0xbabceb55), TOBN(0x00468508, 0x512a04ed),
+	TOBN(0x1b4a03d7, 0x96b5e0d2), TOBN(0x46eb591c, 0x976c3e38),
+	TOBN(0x737d0767, 0x246e06d6), TOBN(0x11c98683, 0x4ff7226c),
+	TOBN(0x62ec2531, 0xf0362816), TOBN(0x4d4af355, 0xc29dd916),
+	TOBN(0x549d6279, 0xd6d174d4), TOBN(0xbccf3851, 0x7867b71a),
+	TOBN(0x140f5e5e, 0xe642bf1f), TOBN(0xc756ca3a, 0x8c945c43),
+	TOBN(0x49bdf209, 0x220f7183), TOBN(0x951f6483, 0x4f39efd8),
+    },
+    {
+	TOBN(0x9fd8aa55, 0xf3a7f291), TOBN(0x1f6f08d3, 0x55dbaa29),
+	TOBN(0x6c02016a, 0x323e8344), TOBN(0x6c2dda83, 0xef06d9dc),
+	TOBN(0x824a5f9b, 0x3a721962), TOBN(0x5ac1e37d, 0x53933d51),
+	TOBN(0x6b43bfe1, 0x706136b1), TOBN(0xa501678f, 0x51c9ad04),
+	TOBN(0x2d247c94, 0xa301ea4e), TOBN(0x56902164, 0xba4a6e60),
+	TOBN(0xa7622410, 0xea2c2281), TOBN(0xcf5428e7, 0x362ba455),
+	TOBN(0xf8491116, 0x6e7dd160), TOBN(0x915eb5ed, 0x858d25ba),
+	TOBN(0x2045c964, 0x2c686980), TOBN(0x6b2067d5, 0xe9d612a9),
+	TOBN(0xab4491fb, 0x52c21781), TOBN(0xeb3cc81c, 0x8408d6ac),
+	TOBN(0xac4c904d, 0x00a88403), TOBN(0xffb01295, 0xc1fd3501),
+	TOBN(0x12e83d74, 0xbd0fe5c6), TOBN(0x140d801d, 0x4d2c2309),
+	TOBN(0x001e0a12, 0xb35ae32f), TOBN(0x9678fd1b, 0xa83bd07a),
+	TOBN(0xb5701e65, 0x202fdc19), TOBN(0x980c9bda, 0x616efe4d),
+	TOBN(0x3e64c1db, 0xd1cb6f71), TOBN(0x5c35cb43, 0xdc4f98c6),
+	TOBN(0xe697371f, 0xaa542b3e), TOBN(0x9e9ebe55, 0xa1a8dd5f),
+	TOBN(0x200c5ed2, 0x16375db7), TOBN(0xbf89f5d3, 0xf89c2289),
+	TOBN(0xb913d186, 0xdf4b62d0), TOBN(0x425be844, 0x1439a60f),
+	TOBN(0xb53a7cab, 0xf92eb6c4), TOBN(0x12549e15, 0x47ca6a35),
+	TOBN(0x2a94aaf8, 0x396509b6), TOBN(0x998a6f4f, 0x88a08f05),
+	TOBN(0x02745957, 0xe67d8ee5), TOBN(0xd3b1d799, 0x329c8293),
+	TOBN(0x95ad3ff5, 0xee0d3bf4), TOBN(0xab00ccf7, 0xb8016f11),
+	TOBN(0x57f0bc7a, 0x1f6ee4ca), TOBN(0x7792b1fc, 0xb5bbd312),
+	TOBN(0xff1c6eb5, 0x421db1cb), TOBN(0xc9e731e9, 0x984c9bb4),
+	TOBN(0xca6c0970, 0x22b620d2), TOBN(0x2a3ec906, 0x9e73dfb0),
+    },
+    {
+	TOBN(0x7b9fff2f, 0x2564d4da), TOBN(0xdab33c3e, 0xd680f7a8),
+	TOBN(0x86e1271c, 0x42aee023), TOBN(0x8720a299, 0xe9c2a880),
+	TOBN(0x12d45893, 0xe27e30e3), TOBN(0x745812b0, 0x9b2d8023),
+	TOBN(0x27683dc5, 0xd6e95af8), TOBN(0xc2546061, 0x811d3c1a),
+	TOBN(0x5fc2bdea, 0x88aa2733), TOBN(0x97e6f423, 0xded9f702),
+	TOBN(0x20e6adcc, 0x68b79409), TOBN(0xdf8adc48, 0x207f1052),
+	TOBN(0x183a336e, 0x2ce191e5), TOBN(0x4d88386d, 0xf29d67cf),
+	TOBN(0xa94e1656, 0x3c48406a), TOBN(0x40c6f701, 0x28d7b060),
+	TOBN(0x732823cc, 0xa4a6e669), TOBN(0xf0f946fa, 0x28d75b01),
+	TOBN(0x8dedc3e8, 0xbd72f81f), TOBN(0xef46d82b, 0x25b08d50),
+	TOBN(0x6dd84e9e, 0x9b8a682d), TOBN(0xe31b52af, 0x40f9da77),
+	TOBN(0x84c0b3d5, 0x2a8b749c), TOBN(0x798efc54, 0x924e658a),
+	TOBN(0xb3800326, 0x8724c825), TOBN(0xb9e40a45, 0xd5457136),
+	TOBN(0x73fc4f6d, 0xde8572ab), TOBN(0xbf7e6cfa, 0xd19236b3),
+	TOBN(0x956a6abe, 0xad04d189), TOBN(0x77748f22, 0xe8a4986f),
+	TOBN(0xa41c8791, 0x9b3440f3), TOBN(0x94411839, 0xf6e00b31),
+	TOBN(0x38fd2b3d, 0x2b73f186), TOBN(0x3410eae8, 0xf5572fe3),
+	TOBN(0x0d095fae, 0xc8d03b20), TOBN(0xd1162aa8, 0x88e4bb0e),
+	TOBN(0xd7a0f6f3, 0x082ed8e3), TOBN(0x7fa2ab56, 0xd2d4df59),
+	TOBN(0xecce725b, 0x121eac46), TOBN(0x943229ed, 0xa48841ce),
+	TOBN(0x49ec5f48, 0xa9ae6ca1), TOBN(0xe98e86d3, 0xa7a51a19),
+	TOBN(0x6bb73ca3, 0x05360c33), TOBN(0x5eb51b5c, 0x9cb38819),
+	TOBN(0x878d397f, 0x6dd3f9e1), TOBN(0xda3ce3d4, 0xb64cd8e3),
+	TOBN(0x6da364bd, 0x54aa81d1), TOBN(0x5e9b0c11, 0x5380e424),
+    },
+    {
+	TOBN(0xf73ffe5e, 0x4ac9a9b4), TOBN(0xb566787d, 0xad01ef50),
+	TOBN(0x0dc24e38, 0x855dc047), TOBN(0x0e414533, 0xd3855101),
+	TOBN(0x25a8b127, 0xc4fc61c7), TOBN(0xe8b02561, 0x365b0046),
+	TOBN(0x4ed07b8b, 0xadd2b5f0), TOBN(0x84a8c0c3, 0x023a7834),
+	TOBN(0xbf857bd5, 0x11544e67), TOBN(0x2fcde847, 0xbdb3ee04),
+	TOBN(0x41cd5b98, 0xd16f2813), TOBN(0xbf15b890, 0x40fe20a4),
+	TOBN(0x307466dc, 0x59c323cb), TOBN(0x9b1070db, 0xe53acf9e),
+	TOBN(0x529c2cac, 0x789080d4), TOBN(0x818dee02, 0x51af60c1),
+	TOBN(0xe6504799, 0x494dccd2), TOBN(0xe1f28df4, 0x51aeb602),
+	TOBN(0x1bdb87d1, 0x7ae5f03f), TOBN(0xde8db056, 0x4b611aa1),
+	TOBN(0xdbb09d3d, 0x3714d05b), TOBN(0xc636a55e, 0x81f3b4ee),
+	TOBN(0x098167aa, 0x5516e939), TOBN(0xf31df8a9, 0x249ccb15),
+	TOBN(0x6700064d, 0x0e49904a), TOBN(0x73c8148b, 0xaa8ae26d),
+	TOBN(0xe7f89edb, 0xbd0ae557), TOBN(0x7efcd9f5, 0xa3246d66),
+	TOBN(0x2ad4d57d, 0x5a09a313), TOBN(0xeee91e45, 0xd14930df),
+	TOBN(0x48390f23, 0x366881e6), TOBN(0x28823073, 0xedc01663),
+	TOBN(0x71fa567a, 0x56e7e30d), TOBN(0x6821d5d1, 0xeaae5fc6),
+	TOBN(0x1a12bf5d, 0x91a07640), TOBN(0xa22c5551, 0x11c9761c),
+	TOBN(0xaf41ede6, 0x105db1c7), TOBN(0xff4556ad, 0xa5a9beb3),
+	TOBN(0xd99ce4b6, 0x243d588c), TOBN(0x286453db, 0x4910839d),
+	TOBN(0x93d8be91, 0x535cd943), TOBN(0xd31d0da7, 0x4f4a3432),
+	TOBN(0xd76e7946, 0x0a6c1867), TOBN(0xbd6a36b9, 0x39671032),
+	TOBN(0x0f1a72fe, 0xdba7f3c2), TOBN(0xb479c7a9, 0x6c99b1c7),
+	TOBN(0xdb46c97a, 0xa95503a3), TOBN(0xbd361822, 0xa701c848),
+    },
+    {
+	TOBN(0x7c6d7b67, 0x4fd7a544), TOBN(0x9d25a8e7, 0x9452a21d),
+	TOBN(0x46e675b3, 0xe3c71701), TOBN(0xeff13a8a, 0x944c34e1),
+	TOBN(0xddd5dc15, 0xb3d66209), TOBN(0x2b3516c8, 0x9d4ed36e),
+	TOBN(0xb3469948, 0xc7fcbbc5), TOBN(0x8d3bb99d, 0x5610c6f5),
+	TOBN(0xcfb9fdf7, 0xb0a1a4eb), TOBN(0x9e897979, 0xeb420b5e),
+	TOBN(0x522327ce, 0x6eb81f82), TOBN(0x5c75b77e, 0x196d9491),
+	TOBN(0xcccf6971, 0xb752148f), TOBN(0xf0bc986c, 0x279084be),
+	TOBN(0x5f263a5c, 0x25dfe410), TOBN(0xaa7b42a5, 0x022a1d0b),
+	TOBN(0x2ccac7cb, 0x1b9bfa9c), TOBN(0x01241b2e, 0xf29c5d6a),
+	TOBN(0xc5680b2c, 0x16bd917b), TOBN(0xe16e0b91, 0xe7a9d997),
+	TOBN(0x689d3e27, 0xbfa3a89e), TOBN(0x155037b7, 0xc7340247),
+	TOBN(0xa975ced7, 0x39ec53e2), TOBN(0xbf33be2c, 0xada6a11c),
+	TOBN(0x23dccf68, 0x8fba3b55), TOBN(0xd2fa6f61, 0xc4182c44),
+	TOBN(0x290aefd0, 0x18d80219), TOBN(0x142dc675, 0xa227e634),
+	TOBN(0x11805979, 0xd9c99dc0), TOBN(0x65931748, 0x6d2f2206),
+	TOBN(0x6eaf0273, 0x16fe943f), TOBN(0x5de3fcda, 0x0385f457),
+	TOBN(0xb0565263, 0x6db7531c), TOBN(0x32577d8c, 0xbef914e0),
+	TOBN(0xe007c052, 0x14c6b7a3), TOBN(0x3d8614bb, 0xe08e451d),
+	TOBN(0x0a8ce50d, 0x66407a41), TOBN(0xcb576422, 0xe000315e),
+	TOBN(0x2dc39e21, 0xe645ae17), TOBN(0xda52013b, 0x55453ecd),
+	TOBN(0x81a45f73, 0xd849c4da), TOBN(0xca109b60, 0x8fe39f02),
+	TOBN(0x1e681682, 0x0711496f), TOBN(0x638b1da2, 0x7453516a),
+	TOBN(0x83c480d5, 0x45bc4729), TOBN(0x61241ba2, 0x4f582ed8),
+	TOBN(0x733a055d, 0x757da156), TOBN(0xcfca64d1, 0x252dec7f),
+    },
+    {
+	TOBN(0xf8daf6ce, 0x9faf4a89), TOBN(0xeec880ae, 0x7f6a716f),
+	TOBN(0x49f18f6a, 0xe6911d74), TOBN(0xd7002574, 0xb3b2be91),
+	TOBN(0x44a22f6a, 0xacd37d31), TOBN(0x9a891639, 0xc03c4971),
+	TOBN(0x146e0779, 0x787e577d), TOBN(0x420170c7, 0x6d592387),
+	TOBN(0xae4401e8, 0x87b94172), TOBN(0x6e2f20cd, 0xbbb12851),
+	TOBN(0x85b9babc, 0x934add67), TOBN(0x0cf5c06f, 0x57d1f54b),
+	TOBN(0xe607c35d, 0xc7c24457), TOBN(0x568ebf80, 0xf21afcff),
+	TOBN(0xd150efb3, 0xf2e3d917), TOBN(0xaca1639e, 0x25377fb1),
+	TOBN(0xac627889, 0x32e77b05), TOBN(0xecd5a803, 0x5a8df6a6),
+	TOBN(0x74fdf03f, 0x94811de5), TOBN(0x8946cda6, 0xe4be484a),
+	TOBN(0xf30eb058, 0xe9ef3a25), TOBN(0x74db117f, 0x1f1bb1c4),
+	TOBN(0xb7c41a0b, 0x87d10534), TOBN(0x9ac9052d, 0x433ebc35),
+	TOBN(0x1529408a, 0xf13da86f), TOBN(0xb48072ba, 0xbe18370c),
+	TOBN(0xeb09aa51, 0xe6f36c2e), TOBN(0x898663e3, 0xd3b935fa),
+	TOBN(0x069dbf9d, 0x930de8c4), TOBN(0x47c0d16c, 0xfdba9676),
+	TOBN(0x7447c53d, 0x30d8591f), TOBN(0x22edb17d, 0xeab61514),
+	TOBN(0x9eac280e, 0x3a0ae733), TOBN(0x1b8694c7, 0x910dce83),
+	TOBN(0x11705c92, 0xad424f60), TOBN(0x8cd3bd7c, 0x6692ea96),
+	TOBN(0x091a6d63, 0xd87a3c94), TOBN(0xa262855c, 0x19c87551),
+	TOBN(0x770186cd, 0x6a2cdd68), TOBN(0x64c2cd09, 0x3d38bb54),
+	TOBN(0xd31db479, 0xbe34757e), TOBN(0xa48c1d0d, 0x528cfae9),
+	TOBN(0xeb86248a, 0x7fee8e01), TOBN(0xc50a7c9e, 0xad9307b1),
+	TOBN(0xde86b3a2, 0x0110c1de), TOBN(0xfd81d4b9, 0x1dd440df),
+	TOBN(0x1d643018, 0xc9928077), TOBN(0x9f94c9a2, 0x4a5bd8ff),
+    },
+    {
+	TOBN(0x9b2d540d, 0x3b0f3539), TOBN(0xdcfd33fe, 0x280d90a2),
+	TOBN(0xd1cc2f86, 0xd8c9a1ec), TOBN(0xda46952e, 0x9e9136ae),
+	TOBN(0x521432a9, 0x0b5ef791), TOBN(0xad5479af, 0x62ade045),
+	TOBN(0xf78973b5, 0xa4f36944), TOBN(0xf6407d5f, 0x098f9daf),
+	TOBN(0xe6664fd6, 0xa8796f90), TOBN(0x8dc91829, 0x848bb048),
+	TOBN(0xb3ba02c0, 0x862fff8b), TOBN(0x6ab1875a, 0x46c5bd74),
+	TOBN(0x1c1308fb, 0x741bee44), TOBN(0x8db5d808, 0xf4070628),
+	TOBN(0x825de7c8, 0x69463949), TOBN(0x3a19802b, 0xb21a84f5),
+	TOBN(0xf34e061a, 0xa7d0ee6a), TOBN(0xf364528a, 0xd9aa8905),
+	TOBN(0x5c343a5a, 0xbf956260), TOBN(0x2a06bac3, 0x99f8c3e0),
+	TOBN(0x7cbd5a3b, 0xa5ee7b36), TOBN(0x121c8f5f, 0xe7e94404),
+	TOBN(0x62a71d04, 0xfae6244c), TOBN(0x2ebab4f8, 0x241934c2),
+	TOBN(0xeeb5eb60, 0x1fa1b89a), TOBN(0xce88e6b0, 0x9481a6b9),
+	TOBN(0x90605765, 0x043b4470), TOBN(0x1f84be94, 0x9c30bc6d),
+	TOBN(0xdd9b61ec, 0xcd4ffdbb), TOBN(0x1a9949e7, 0xc22349fb),
+	TOBN(0x38b9339c, 0x4362bee3), TOBN(0xd5cd8729, 0x85888072),
+	TOBN(0x8fbaee62, 0x8c7708cd), TOBN(0x8c1f1971, 0xb6181a45),
+	TOBN(0x82c4eead, 0xbcefc03d), TOBN(0x29d2e7fd, 0xcf5a1e73),
+	TOBN(0xb83fc3ea, 0x851e0a14), TOBN(0xe0b8f1e7, 0x5927ef21),
+	TOBN(0xbefdf71a, 0xafb3f11b), TOBN(0x1a6abcbf, 0xaccbe25f),
+	TOBN(0x04da432d, 0x5ff48853), TOBN(0xa3e50fd5, 0x2eb87077),
+	TOBN(0xdb443ee6, 0x37bb574d), TOBN(0xafc8ab2b, 0x01431adf),
+	TOBN(0x9608bd42, 0xcae115a7), TOBN(0x1f6cf3ba, 0x7ac8a2db),
+	TOBN(0x0ee19074, 0x823b3ec5), TOBN(0x271b130f, 0x9c96d8b4),
+    },
+    {
+	TOBN(0x365aa81a, 0x761e6a72), TOBN(0xb9fa67fc, 0x501b2145),
+	TOBN(0xa3985f0d, 0xb19343d9), TOBN(0xb48d2a5d, 0x3d226d5d),
+	TOBN(0xa4286552, 0x16bdef23), TOBN(0x5aa8f35e, 0xc55bc08a),
+	TOBN(0xef12e76b, 0x49e6d289), TOBN(0xec80fabe, 0x131f3b5f),
+	TOBN(0xcccc9fad, 0x50f2df21), TOBN(0x1b923053, 0x09176091),
+	TOBN(0x67740581, 0x0c5fff17), TOBN(0xd5630eb4, 0x8d8b7ae9),
+	TOBN(0x382611f6, 0xe837dc88), TOBN(0x1b6bb011, 0xe80e0c50),
+	TOBN(0x04bbcf90, 0xd28c7293), TOBN(0x74330057, 0x643509eb),
+	TOBN(0xe69c0c35, 0x4fa1dcd4), TOBN(0xe6c8a515, 0xb355120b),
+	TOBN(0xb86874b5, 0x7f2ac4c1), TOBN(0x540d7587, 0x33f187c0),
+	TOBN(0xf97ab477, 0x4bdcf66c), TOBN(0x24391ebf, 0xcfd28808),
+	TOBN(0xc54e3a09, 0xf5cc4898), TOBN(0x5d7569f0, 0x48326984),
+	TOBN(0xdd6bd6c0, 0x3f437134), TOBN(0x9d11cd61, 0x29034d73),
+	TOBN(0x20c0aeca, 0x087688e1), TOBN(0x3f097d29, 0x386178db),
+	TOBN(0xbb36c3d9, 0x9a9ffb76), TOBN(0x353293cf, 0x844693f7),
+	TOBN(0x71726738, 0x86c57dc6), TOBN(0xab9b0e53, 0x0b1100e4),
+	TOBN(0x1f75dcc5, 0x18ee119b), TOBN(0x183e32e3, 0x6c30348b),
+	TOBN(0x0589dd5b, 0x79df807b), TOBN(0x53a5cffb, 0x9eb43ce7),
+	TOBN(0x707f87d5, 0x0a3c1428), TOBN(0xc171e3ce, 0xb24fde43),
+	TOBN(0x7dfbee35, 0x5f67e237), TOBN(0x34d5797f, 0x5997c4bf),
+	TOBN(0x09b4865a, 0xbfe910a6), TOBN(0x47ca1faa, 0x5d70e0ee),
+	TOBN(0xb6887dcc, 0x6f76ae9b), TOBN(0x5f915656, 0x028635bf),
+	TOBN(0x2c117a85, 0x95c22b4f), TOBN(0x3ed9e774, 0xf59145b7),
+	TOBN(0x1dc320e9, 0x04767d8a), TOBN(0x4e36261f, 0x392db168),
+    },
+    {
+	TOBN(0x6e1ac291, 0x2b07e916), TOBN(0xe848a038, 0x57226d5f),
+	TOBN(0xb3fe7828, 0x4b10368c), TOBN(0x9852e6b9, 0xc8297606),
+	TOBN(0x6134eb4f, 0x9cfd6820), TOBN(0xb1dc1b4e, 0xcd5c031b),
+	TOBN(0x0ea10748, 0x18ecdd89), TOBN(0x7578cc5f, 0xb40a7dd0),
+	TOBN(0x9a91e703, 0x00abaf5a), TOBN(0xbac63daa, 0xfcdec0a4),
+	TOBN(0xbb0ed687, 0x73ce1cea), TOBN(0x60ec152b, 0x440d2fba),
+	TOBN(0x1ab53e37, 0x51a3aa61), TOBN(0xa24a1454, 0x55e8afb9),
+	TOBN(0xd18573df, 0x91caee7f), TOBN(0x5597c67b, 0xbacf4216),
+	TOBN(0x23d09715, 0x9eb5a29f), TOBN(0xc62d7a24, 0xedfc1cde),
+	TOBN(0x5ca8d382, 0x42a722e1), TOBN(0x4a983f68, 0xf91256c3),
+	TOBN(0x49bf31d6, 0x5920229f), TOBN(0x23603b86, 0xe1ed5517),
+	TOBN(0xc9380825, 0x3dbc296d), TOBN(0xff8c5ad7, 0xe34989a2),
+	TOBN(0x92be4061, 0x078e3c3f), TOBN(0x27927631, 0xfa59601d),
+	TOBN(0xa67411a4, 0xb6dfa89f), TOBN(0x3fbd0b6d, 0xb3803854),
+	TOBN(0x5c267baa, 0x8c8a491e), TOBN(0x70c7f33e, 0xdd415686),
+	TOBN(0x3a1c092f, 0x3e43fb9d), TOBN(0xf0f8b87f, 0x18255012),
+	TOBN(0xd4a6fad6, 0x0c4a2a9a), TOBN(0xa30cfcae, 0x672082ec),
+	TOBN(0x688502cc, 0xcec3e080), TOBN(0x09f59fe8, 0xf9730009),
+	TOBN(0x4d2ba209, 0x51cccedd), TOBN(0xff4e8101, 0xf3aba661),
+	TOBN(0xec3231c9, 0x9d500c82), TOBN(0x5b7796ae, 0x7af652bf),
+	TOBN(0x5ebcd916, 0xe04a3af2), TOBN(0xf2148ec7, 0xacd7ec6c),
+	TOBN(0x0c2a6f7a, 0x915686b2), TOBN(0xae124ebc, 0xe56d6c68),
+	TOBN(0x5f9b85c9, 0x7f80cd48), TOBN(0x50a04818, 0x9fea8b69),
+	TOBN(0xb965d8fd, 0xa94a3905), TOBN(0xa35e7910, 0x9e1e3b7f),
+    },
+    {
+	TOBN(0xdc358522, 0x560fd22d), TOBN(0x850e6f50, 0x050a07f3),
+	TOBN(0x24219453, 0xb5235c8b), TOBN(0x27c37dd3, 0x1b6d40dc),
+	TOBN(0x4b604dde, 0x7f21895f), TOBN(0xa7d71f46, 0x2056a8ca),
+	TOBN(0xcb22e378, 0x1a5e9b06), TOBN(0x127b964c, 0x294c913b),
+	TOBN(0x43f3d3ff, 0x27cd5650), TOBN(0xa6a8a92f, 0xdeea92dd),
+	TOBN(0x5791182e, 0x9d76d837), TOBN(0x15e27bc9, 0xad112b9e),
+	TOBN(0x81d36ce8, 0xfc656ffb), TOBN(0xb9a9b751, 0x4ecb52f4),
+	TOBN(0xb60f62ba, 0xcab9edf4), TOBN(0x02da6b4b, 0x9681c9c8),
+	TOBN(0x9a6e171e, 0x391acb0b), TOBN(0x76e865ef, 0x514d758e),
+	TOBN(0xa37f80eb, 0xec5440b3), TOBN(0x5b9b3555, 0x078f42a1),
+	TOBN(0xb55297b6, 0x1ce82e26), TOBN(0x90fb191d, 0x548e5764),
+	TOBN(0xf7488ca7, 0x8f70b04a), TOBN(0x1b7a3e83, 0xae848d41),
+	TOBN(0xf2ec227b, 0xe0e5aa44), TOBN(0x5db0805b, 0x2a9a9ebe),
+	TOBN(0xe5dbedfb, 0x2302b939), TOBN(0xe0a4edd3, 0xf669da3b),
+	TOBN(0x9bea03fe, 0xf88f3f80), TOBN(0x5e2a8959, 0xdddeff76),
+	TOBN(0x0b21d2b5, 0x7f6327db), TOBN(0x491728c8, 0x13f4cc8a),
+	TOBN(0xe74d78f3, 0x77309630), TOBN(0xfcf1930a, 0xe15caa9b),
+	TOBN(0x226ae188, 0x213ca11a), TOBN(0x25b2d3d6, 0x985c606d),
+	TOBN(0x8e57e75b, 0xaf92e5cc), TOBN(0x0a50bf1a, 0x411f5f57),
+	TOBN(0xf3deae1c, 0xd8419a3f), TOBN(0x670df7ef, 0x889ae339),
+	TOBN(0x8d4ea7bf, 0xce3561ad), TOBN(0xf49403db, 0x8c7595bd),
+	TOBN(0xc70ad67b, 0x94790887), TOBN(0x5a18ded3, 0x8fc73dad),
+	TOBN(0x9634bd8a, 0x7499ce1d), TOBN(0xdc7a2da5, 0xbef8fa01),
+	TOBN(0xa9bbd759, 0x312bafd5), TOBN(0x46bcf221, 0x3c3c76ff),
+    },
+    {
+	TOBN(0x5d26316b, 0xe515743f), TOBN(0xe87f0385, 0x8cb4357d),
+	TOBN(0x3234cfd7, 0xedc3505d), TOBN(0x44cafca5, 0x97c12d33),
+	TOBN(0xd7d9c239, 0xfb406f3d), TOBN(0x5e7a5abf, 0x6afacbb0),
+	TOBN(0xe26ab778, 0x0bee8326), TOBN(0x886e8cee, 0x411d0f13),
+	TOBN(0xa2eb2be5, 0xef04d9e1), TOBN(0xce512fae, 0x9ef99f25),
+	TOBN(0x1d77f841, 0x5df6121a), TOBN(0xafb021fe, 0xac2bc884),
+	TOBN(0x518ecaaf, 0x10ab6873), TOBN(0x01718899, 0x2ac7ed61),
+	TOBN(0x7c6334f0, 0xaf33baf8), TOBN(0xe2d8d83b, 0xb688d13a),
+	TOBN(0xcf8a745a, 0x83619222), TOBN(0x8f35d09b, 0xaf9ef999),
+	TOBN(0x0a336f7c, 0xbe872dda), TOBN(0x5c2372fb, 0xc37f4461),
+	TOBN(0xc3ab7398, 0x4918c805), TOBN(0x74dc00f7, 0x6071d115),
+	TOBN(0x0507a03e, 0xd1d65f2f), TOBN(0x7522ecb8, 0xb73b4ecf),
+	TOBN(0x9507a6a5, 0xdf64cd61), TOBN(0x657761e0, 0x1c5bc929),
+	TOBN(0xdbc6e271, 0x24db0f91), TOBN(0x753f879f, 0x3c73693a),
+	TOBN(0x847ce0c1, 0x96e39e85), TOBN(0x5dbe068e, 0x44d66b81),
+	TOBN(0x9eacca2c, 0x29a193fd), TOBN(0x8e3845ff, 0x3bbdad5d),
+	TOBN(0x19073cf9, 0x3a19e2c5), TOBN(0x8461add7, 0xd4b1fc11),
+	TOBN(0xc4dab6b9, 0x7d449c84), TOBN(0x501ea98e, 0x5fe9c461),
+	TOBN(0x731c1d35, 0xcd36aee8), TOBN(0x523b42d0, 0x1cb04a8e),
+	TOBN(0xb9f5cb0b, 0x0db18ed5), TOBN(0x48a9b2c5, 0x69c52dd5),
+	TOBN(0xa7e08e63, 0x9c8fa51d), TOBN(0xa95b01c8, 0xa9c4494d),
+	TOBN(0x57f69ee3, 0xa2b711e3), TOBN(0x442edf44, 0x67324f08),
+	TOBN(0xa348e06d, 0x382cc004), TOBN(0x0911acab, 0xdb3b8a78),
+	TOBN(0x05e032f3, 0x6dd902f2), TOBN(0x71db4177, 0x34f3237f),
+    },
+    {
+	TOBN(0xba4c62d7, 0xca2ae87e), TOBN(0xd0fe070b, 0x19686afa),
+	TOBN(0x64699faf, 0xdb86a0bb), TOBN(0x8995f94b, 0x2f825a66),
+	TOBN(0xafb38473, 0xf680de7a), TOBN(0xbcf4b57e, 0xd5f59761),
+	TOBN(0xc4d56ef0, 0x17dd064c), TOBN(0x10dd19dc, 0x823a1e27),
+	TOBN(0x45d657cb, 0xde09b3c3), TOBN(0x9ca25f5d, 0x3df33e4b),
+	TOBN(0x3aeff082, 0xbbec2435), TOBN(0x5f6043fd, 0x58579108),
+	TOBN(0xa31d955e, 0x2156d0e7), TOBN(0x02e31132, 0x558fdac2),
+	TOBN(0xf8c669e1, 0x5e6775f0), TOBN(0xc5b1b077, 0x6d11a274),
+	TOBN(0x9f14e8b5, 0x06c32445), TOBN(0x1e6ba137, 0x5f3df333),
+	TOBN(0x1466def9, 0x7d0e5bb5), TOBN(0xb846e5f7, 0x86fe88c2),
+	TOBN(0x8756e730, 0x9231900a), TOBN(0xe9b801ee, 0xc0e3a22b),
+	TOBN(0x0a0f407d, 0xa3acbe5e), TOBN(0xea45d971, 0x6e769d9e),
+	TOBN(0x2a0f4d4b, 0xbec99ac2), TOBN(0xcaeec3c0, 0x38b79253),
+	TOBN(0xb78dc4e2, 0x49b61f22), TOBN(0xea7f0f3e, 0x78e6d275),
+	TOBN(0x08f9c183, 0x2dc73d0a), TOBN(0xbb7c0d1c, 0x89acd703),
+	TOBN(0x3d599458, 0x534327fa), TOBN(0x1c708bfe, 0x777b5abb),
+	TOBN(0x320e79f2, 0x7433c58b), TOBN(0x08c35baf, 0xa963f822),
+	TOBN(0x89b56d72, 0xfa893909), TOBN(0xa03d531c, 0xbfd388c3),
+	TOBN(0xe6383a6b, 0x9a6d5dd0), TOBN(0xa47685a0, 0x3960951c),
+	TOBN(0x73eb9616, 0x1b631daa), TOBN(0x9153658a, 0xd38a5bab),
+	TOBN(0x4fc11cc7, 0x391f4a3a), TOBN(0x52b60391, 0x5388929b),
+	TOBN(0xafed3dc7, 0x456e23c7), TOBN(0x885dbe88, 0xce649e10),
+	TOBN(0x4691c0da, 0x70598008), TOBN(0x12235957, 0xb67714f1),
+	TOBN(0x0bc065e6, 0xdbb205e4), TOBN(0xe3b682ee, 0x69e646fe),
+    },
+    {
+	TOBN(0x9163e376, 0x17815154), TOBN(0x8200f921, 0x1806d44c),
+	TOBN(0x8db6ad07, 0xbc693b0c), TOBN(0x7cf80892, 0xf8f46f80),
+	TOBN(0xe92dce75, 0x81a9266c), TOBN(0x89336a06, 0x56d70090),
+	TOBN(0x9afeb99c, 0xde00bc60), TOBN(0x3e3f05c7, 0x9b48b878),
+	TOBN(0x416eda6d, 0x6edac715), TOBN(0xcbf64270, 0xe02a6032),
+	TOBN(0xf9ef2e04, 0x593c7059), TOBN(0x9e1f6bb3, 0x4c715c10),
+	TOBN(0x3837628c, 0x4942aa83), TOBN(0x17a4fcc9, 0x422ee1cf),
+	TOBN(0x95238a87, 0x10994e87), TOBN(0xbe8933cd, 0x8191fe62),
+	TOBN(0x0d6fc03a, 0x3a0cda16), TOBN(0x8da9e78b, 0x7557f6d7),
+	TOBN(0xc2ba12a2, 0x0fb50f69), TOBN(0xd72143d5, 0x4d0ce4df),
+	TOBN(0xe38cf576, 0xf9589922), TOBN(0xeb6e3ea9, 0x3e0dc1f6),
+	TOBN(0xb9e06baa, 0x7dc5134a), TOBN(0x76dd765c, 0x49fec716),
+	TOBN(0xb4dabfe4, 0xae71db87), TOBN(0x3ebb783a, 0x639188df),
+	TOBN(0x0765d676, 0xc1957090), TOBN(0x1fc0d7c0, 0x04cf54f7),
+	TOBN(0xd672caf3, 0xb2939591), TOBN(0x61f187ab, 0xc0658bc0),
+	TOBN(0x4e15667d, 0x7295fbca), TOBN(0x7fa07ec1, 0x215d2bf1),
+	TOBN(0x8c1f5d26, 0x925e2f65), TOBN(0x763610e9, 0x9bc15408),
+	TOBN(0x7ebad8c2, 0xaff24446), TOBN(0x69e9d768, 0x9597d917),
+	TOBN(0x5ec3e27e, 0xe0f531e6), TOBN(0xba5e28db, 0x1c9071a3),
+	TOBN(0xe54d0382, 0x9744523f), TOBN(0x210eccef, 0xf1e02df1),
+	TOBN(0xb5ff0819, 0x28934e3b), TOBN(0x439fac6e, 0x936a1baa),
+	TOBN(0x63d8d622, 0x08aa963d), TOBN(0x2c4ec56b, 0xa4e28c6e),
+	TOBN(0x214009bb, 0xbbd05640), TOBN(0x6d5149aa, 0x41d64ca7),
+	TOBN(0x912a4ace, 0x10a1a8c2), TOBN(0x00848cf6, 0x990eb68a),
+    },
+    {
+	TOBN(0x22c7c6ec, 0x2f02a2a8), TOBN(0x0401f242, 0x300da899),
+	TOBN(0x1b6d5a0f, 0x78d27619), TOBN(0xf9f01125, 0xf1e8df01),
+	TOBN(0xd25b9ceb, 0x03524cd8), TOBN(0x1266d40c, 0xadae0121),
+	TOBN(0x35fd7339, 0xbc0178c1), TOBN(0x7c7e0b8f, 0x369170f1),
+	TOBN(0x82ddb4da, 0xddb58e2a), TOBN(0x97ec84e1, 0xc054c064),
+	TOBN(0xf3de5c08, 0xb278e0b3), TOBN(0x3c3ed766, 0x98e2b821),
+	TOBN(0x706ec518, 0x92855507), TOBN(0x2f49f992, 0x845dc39e),
+	TOBN(0x2a47150e, 0x21329d0e), TOBN(0x7d12679b, 0x0323fcc5),
+	TOBN(0x1adf8074, 0x7419b42d), TOBN(0x1b53cf16, 0xeaafedae),
+	TOBN(0x85742544, 0x1f6a1ed3), TOBN(0xae4287aa, 0x9a19c9bf),
+	TOBN(0xc719eaed, 0xf2b13245), TOBN(0xd6dc7d52, 0x7c1b83ed),
+	TOBN(0x73c0d754, 0xfb8a2695), TOBN(0xedbaecb8, 0x93fd8e2d),
+	TOBN(0x69b57fc9, 0x5ce3b70e), TOBN(0x7d76f074, 0xc72311bf),
+	TOBN(0x0ecbaced, 0x832ae120), TOBN(0x3f81af80, 0x099ea9ee),
+	TOBN(0xace595e7, 0x65272b22), TOBN(0xc3e30f57, 0x80cb1781),
+	TOBN(0x9c2accfa, 0xe52bf794), TOBN(0xff40fd82, 0x42ba57e2),
+	TOBN(0x183eba4d, 0x24bc5eca), TOBN(0xec6c21d3, 0x3782a811),
+	TOBN(0xfd75b185, 0x5fe4888c), TOBN(0xd3d3aed1, 0x2b2fb22e),
+	TOBN(0xbd87c4fd, 0xc1ea63cc), TOBN(0x74bc51b6, 0x3920e346),
+	TOBN(0xca9a0705, 0x2e88a47f), TOBN(0x421d99df, 0xe3c05be3),
+	TOBN(0x6bfe1032, 0x51269c76), TOBN(0x873f58dd, 0x26d43755),
+	TOBN(0xc7b1ac44, 0x11552c7a), TOBN(0x589d8ad7, 0x49c518dc),
+	TOBN(0x42801377, 0x77a0ac80), TOBN(0xdaa29354, 0x83ac994e),
+	TOBN(0x2254959c, 0x21435184), TOBN(0x010919ed, 0x321d6d15),
+    },
+    {
+	TOBN(0xe0f47321, 0xa7b241cc), TOBN(0x93a14093, 0x599c96c3),
+	TOBN(0xcad52e51, 0x5f1665c5), TOBN(0x4269961d, 0x475cdeae),
+	TOBN(0xb9102186, 0xc71ae02f), TOBN(0x60614b66, 0xb5312e1e),
+	TOBN(0x53229994, 0x2f1ffe9b), TOBN(0xeb64737c, 0xe6e3ac53),
+	TOBN(0x8fe35517, 0x9019a000), TOBN(0x42741c47, 0x9a6ff7b6),
+	TOBN(0xd983bc25, 0x73612945), TOBN(0x2915f778, 0x9112566f),
+	TOBN(0xcadb41c1, 0x7393a0d6), TOBN(0x0e9fda93, 0x9641aa92),
+	TOBN(0xce2087cd, 0x5019282c), TOBN(0xc1184156, 0xc4367c47),
+	TOBN(0x7afc63e2, 0xb10baf36), TOBN(0xdf94dd19, 0xeeaaa285),
+	TOBN(0x5c9fa93c, 0x7fe1fabb), TOBN(0x9efed948, 0xd4e50bf7),
+	TOBN(0xa5d94238, 0x4cf6e12b), TOBN(0x9a4bbd7d, 0x0beb9c8e),
+	TOBN(0xfa462f7a, 0xa8dd96d7), TOBN(0x34b4f278, 0xf61ae403),
+	TOBN(0x0813f7cc, 0xff8f26ff), TOBN(0xbf88320e, 0x1a60963e),
+	TOBN(0x37ced55d, 0x5fa402a5), TOBN(0x0e78d688, 0x8b28199d),
+	TOBN(0x8a43a2a3, 0xa7232542), TOBN(0x783568bf, 0x25974f28),
+	TOBN(0xbc366449, 0x941c83be), TOBN(0xaa3d3b17, 0x68d72cc8),
+	TOBN(0x26d87e88, 0x81bbe9de), TOBN(0xfeaa1620, 0x1ac6b5d6),
+	TOBN(0x7b89f48b, 0x2da70812), TOBN(0x6563a19c, 0x0baee1ec),
+	TOBN(0x9c0b013a, 0xc5673fb7), TOBN(0x959003f4, 0x8c336d8d),
+	TOBN(0x32c91bdd, 0x9427ee82), TOBN(0x97a49a22, 0xea54ca5e),
+	TOBN(0x1d15ae6e, 0xb8cb18b1), TOBN(0x9220c0d6, 0x334bb6b0),
+	TOBN(0x9ad29350, 0x324d133c), TOBN(0xb5f14529, 0xfb3e821d),
+	TOBN(0x27020bd1, 0xc1293bed), TOBN(0x2d04e51d, 0x5fa7c07b),
+	TOBN(0x2edac916, 0x1dd56a6a), TOBN(0x4c76aa22, 0xa59191e9),
+    },
+    {
+	TOBN(0xc1e8e643, 0x4f648398), TOBN(0x27428126, 0xb3392d87),
+	TOBN(0x95aa5ca2, 0xbe2ccb8b), TOBN(0x84d32c3a, 0x8eb9bd5d),
+	TOBN(0x7220430d, 0x8e35c05e), TOBN(0xc0c296cd, 0x6a625c3d),
+	TOBN(0xa6453328, 0x5e3ffd36), TOBN(0xd6c8e6f9, 0xcdc758a6),
+	TOBN(0x1fc6aa2f, 0x20334001), TOBN(0x84e8388f, 0x34dfef6d),
+	TOBN(0xb307784a, 0xe6c2528a), TOBN(0x522beef1, 0x2224acdf),
+	TOBN(0x95b68382, 0xe72741ac), TOBN(0x1d3fb527, 0x2c835525),
+	TOBN(0x9c410f9a, 0xa0325058), TOBN(0x823082ad, 0x886cf88f),
+	TOBN(0xf5f8c7c5, 0x62175e6d), TOBN(0xbf29ba33, 0xdd55450a),
+	TOBN(0xb93f5278, 0xffc3f577), TOBN(0x3dfdb291, 0xa9ca17ee),
+	TOBN(0x4bb28470, 0x99edc257), TOBN(0x34977afa, 0x17d7391d),
+	TOBN(0xf48c5ef5, 0x51bb2daf), TOBN(0x6969e4f1, 0xec35c807),
+	TOBN(0x1027ef99, 0xff1e4dfe), TOBN(0x7f10641c, 0x34c12c7c),
+	TOBN(0x6f9daaba, 0xbf48054b), TOBN(0x1cf1ad11, 0x1650333a),
+	TOBN(0x14874547, 0x4e464a84), TOBN(0xf06ad17e, 0x4b2e9e51),
+	TOBN(0x786cc893, 0x2839077c), TOBN(0x547a762e, 0xd1ae5991),
+	TOBN(0x4db0fd11, 0x0377d3bd), TOBN(0xfd542c40, 0x358d6bac),
+	TOBN(0xf713e916, 0x5b4e1025), TOBN(0xcac74338, 0x175dc3d8),
+	TOBN(0x38160275, 0x8ace7f6e), TOBN(0x2b2007e9, 0x1866db1b),
+	TOBN(0x659237bb, 0x284fdd05), TOBN(0x2f493445, 0xd4a994bc),
+	TOBN(0x3a2b5cdd, 0x71963163), TOBN(0x244181ac, 0x66976d60),
+	TOBN(0x35a526a0, 0x649a2679), TOBN(0x6be28a53, 0xf67d043b),
+	TOBN(0x4e0417a3, 0x825277db), TOBN(0x5a09ca3a, 0xbf4f80f6),
+	TOBN(0x5db5922c, 0x3baad4d4), TOBN(0x98ed5445, 0x4b2323d2),
+    },
+    {
+	TOBN(0x62be58c5, 0xcb65112a), TOBN(0x318d4fa6, 0x32d2898b),
+	TOBN(0xd174f03d, 0x2628b949), TOBN(0x0983e837, 0xde5b007e),
+	TOBN(0xf02a8c70, 0xb76b5832), TOBN(0x409d0b13, 0x655f3695),
+	TOBN(0x01891808, 0x506d5635), TOBN(0x8b5e80cd, 0x9f8bb6d5),
+	TOBN(0x105dcf7b, 0x8fffee0e), TOBN(0x6c8c14b1, 0xbc021d6f),
+	TOBN(0x75d87474, 0x9a3be4f6), TOBN(0x0b73839e, 0x2abfde50),
+	TOBN(0x4579e606, 0x456478fe), TOBN(0x9588b0c7, 0x406b1baf),
+	TOBN(0xf85fb0df, 0x168adbda), TOBN(0xa87a107e, 0x78ce2630),
+	TOBN(0x75010726, 0xb53db787), TOBN(0xca302b0a, 0x021709dd),
+	TOBN(0x2633b73b, 0x4f05f234), TOBN(0x8844937e, 0xe57f7597),
+	TOBN(0xb3fe5618, 0x735c6e79), TOBN(0xc1d9a72a, 0x0b81c706),
+	TOBN(0x3c674c8c, 0xdc7e5d1a), TOBN(0xea579a10, 0x3fdffdfb),
+	TOBN(0xd6fb8bc1, 0xd15d08ec), TOBN(0x5f57cbb8, 0x846f5643),
+	TOBN(0x3eb799f4, 0xc6669f03), TOBN(0xb09bcff0, 0x7bae7b58),
+	TOBN(0x8699ace0, 0x8ce55db5), TOBN(0x8e20dcb4, 0xea34e093),
+	TOBN(0x9882a9cb, 0x18123cac), TOBN(0x260bc28e, 0xa34a6506),
+	TOBN(0x03573f80, 0xeda61e22), TOBN(0x5d68b086, 0xf3fcfccc),
+	TOBN(0x5721a2c6, 0x3a818dd6), TOBN(0xa4e85d4f, 0x64a8bab7),
+	TOBN(0xfa7d947b, 0xfa394b93), TOBN(0xb34a00f6, 0x8239f5b4),
+	TOBN(0x259181ec, 0x32fe4d0b), TOBN(0xb83bb403, 0xc40b8b64),
+	TOBN(0x06becfe7, 0x71af1f15), TOBN(0xea4a7678, 0x03f4ed3e),
+	TOBN(0x6d769942, 0x3a688008), TOBN(0xdc39f57a, 0x95080efb),
+	TOBN(0xe5cd0c96, 0xeea596c6), TOBN(0x652040f4, 0xe5062f34),
+	TOBN(0x2bf0a829, 0xc16a98a1), TOBN(0x7f1f4f6d, 0x823eaf43),
+    },
+    {
+	TOBN(0xc57cb18b, 0x96ca2254), TOBN(0x631a9f4c, 0x65a51316),
+	TOBN(0xa2e9e07a, 0x4c517292), TOBN(0x1307d06f, 0xbcb600fd),
+	TOBN(0xe05518e1, 0x6ed6b064), TOBN(0x813a1626, 0xcabe6d2b),
+	TOBN(0x03123010, 0xa0daac6a), TOBN(0x16bd019b, 0x3f176daa),
+	TOBN(0x20bb9ef7, 0x1fffdc1d), TOBN(0xd9182963, 0x78043ade),
+	TOBN(0xebb0e8e9, 0x3477c9ec), TOBN(0x16e7073c, 0x557fbca0),
+	TOBN(0x8af3cc0c, 0x8ac8f1fc), TOBN(0x2b11618e, 0x80d6375e),
+	TOBN(0xf0bf61be, 0x2d15b7b5), TOBN(0x50f420fc, 0xf19c4c61),
+	TOBN(0xea020e4d, 0x6a7b6f0f), TOBN(0x94605614, 0x042e13ba),
+	TOBN(0x4c676e76, 0x9e0be469), TOBN(0x108926fd, 0xcafeeb2e),
+	TOBN(0x67fcac30, 0xe6b8dcf3), TOBN(0x83b34e54, 0x17038e0d),
+	TOBN(0x78ce9919, 0xb8fcba35), TOBN(0xd4af3420, 0x7fbffbf6),
+	TOBN(0xadf71783, 0xa2ba11d9), TOBN(0xbeaf9771, 0x08deac87),
+	TOBN(0x7d6f33e9, 0x8ccd3e06), TOBN(0x61379fe0, 0xf75cf6b0),
+	TOBN(0x0d3359c1, 0x19cabb6b), TOBN(0x1c41b969, 0xd469c127),
+	TOBN(0x31055396, 0x30247959), TOBN(0x4c17851d, 0x4694ca0d),
+	TOBN(0x06ae7f01, 0xdb4c3c44), TOBN(0xbad1610d, 0xe7f9f998),
+	TOBN(0xae43458c, 0x75031bac), TOBN(0x49d0ba9e, 0xc951756e),
+	TOBN(0xf4fb28f7, 0xf4729727), TOBN(0x669401ed, 0x0473eb69),
+	TOBN(0x4b2303d8, 0x65fc9a17), TOBN(0x70776807, 0x881716c8),
+	TOBN(0x0d7d9fce, 0xe35e3e2b), TOBN(0xd494ecf0, 0x07e9da7c),
+	TOBN(0xdaed3284, 0x74d10011), TOBN(0xb873eaf5, 0x2a101df6),
+	TOBN(0xcb9a192d, 0xdd4b2d8d), TOBN(0xca4081e9, 0xca0c5e69),
+	TOBN(0x57e15053, 0x82d53142), TOBN(0xfe3e9edb, 0x047d5e86),
+    },
+    {
+	TOBN(0x34c8cdf0, 0xd520230e), TOBN(0x95f258ef, 0xcf9ca076),
+	TOBN(0x1d511e60, 0xaf23a793), TOBN(0xb5b562dd, 0xc7bd4000),
+	TOBN(0xbf0fa8ac, 0x8e294973), TOBN(0x8e7b9450, 0x5e44f11e),
+	TOBN(0xd2e3b220, 0x2d46c159), TOBN(0x693354e8, 0xc4808532),
+	TOBN(0x2ec2559e, 0xf51547fd), TOBN(0xb581ebed, 0x35f255c2),
+	TOBN(0x1a529876, 0xd94d7a7a), TOBN(0xd189157f, 0xbc48a77c),
+	TOBN(0xe8a30887, 0x11f974dd), TOBN(0x9fe7db36, 0x819fcf5f),
+	TOBN(0x7382ac02, 0x52c49ab0), TOBN(0xa8b3ea04, 0xe1bf3698),
+	TOBN(0xf6c95024, 0xf8211fbf), TOBN(0x7bbaa743, 0x175316ec),
+	TOBN(0x87efc53f, 0xc2b6dda2), TOBN(0x64f2891f, 0xe8d89cd6),
+	TOBN(0xe1433618, 0xdf33e8ed), TOBN(0xaa711db6, 0x4a8faedd),
+	TOBN(0x316cf065, 0xf7b717df), TOBN(0x0785fab1, 0xec93ddb3),
+	TOBN(0xdc314928, 0x9f5110fa), TOBN(0x61f0dedb, 0xf93f9426),
+	TOBN(0x87323ee1, 0x2d1ba91c), TOBN(0xf843cf52, 0x5316ce33),
+	TOBN(0x81e9f3dc, 0x645d2623), TOBN(0xa21de6b3, 0xb47c090b),
+	TOBN(0xdc091335, 0xd06b44a1), TOBN(0x4fae6a27, 0x6c006e50),
+	TOBN(0xc31ed54b, 0x7b2c1d42), TOBN(0xe8477655, 0xf8c77954),
+	TOBN(0x944db188, 0xf397ec1e), TOBN(0xc555cafd, 0x63fb59b8),
+	TOBN(0x4fcc19e1, 0xcc55d7a1), TOBN(0xf9778c89, 0x6f6eb834),
+	TOBN(0x6f761b05, 0x9e57c02c), TOBN(0x471cd6b2, 0x89cf1fe7),
+	TOBN(0xdbdec241, 0x859e2822), TOBN(0xc2aae151, 0xaaa5bc22),
+	TOBN(0xd9c2536f, 0x82857140), TOBN(0x9413a1a5, 0x46a3e3ab),
+	TOBN(0xd2b58078, 0xdd1d7eee), TOBN(0x55f308c3, 0xa05905db),
+	TOBN(0x57722a35, 0x11ab0edc), TOBN(0xd9171f23, 0x9b2f8bdc),
+    },
+    {
+	TOBN(0x69919be1, 0xaa40461d), TOBN(0xe061e0be, 0xf5fe6e21),
+	TOBN(0xf6c6e0c4, 0x7d4a3e98), TOBN(0x6288761b, 0x1a94d4ce),
+	TOBN(0x0715c898, 0x61794c05), TOBN(0x61161149, 0x422884d1),
+	TOBN(0x53a83928, 0x431262a6), TOBN(0xf9f0a75e, 0x4a38a001),
+	TOBN(0x6c54b137, 0x10a08795), TOBN(0x9c2005b4, 0x5111bd18),
+	TOBN(0x16189c0d, 0x68759357), TOBN(0xf71c7c72, 0x9d881b21),
+	TOBN(0x1daf0188, 0x7d1104f3), TOBN(0xb4e54515, 0xa6399242),
+	TOBN(0xfa09d300, 0x4cad4656), TOBN(0xa912b25d, 0xe461b2cb),
+	TOBN(0x405f893c, 0xebf1c54b), TOBN(0xe202c02b, 0xa3fb69ac),
+	TOBN(0xfa0d6466, 0xec73b634), TOBN(0x904fc8c2, 0xe71bcec7),
+	TOBN(0xe45aa03b, 0x290fbac2), TOBN(0x9f1cdd7c, 0x25d30af1),
+	TOBN(0xc7b25d29, 0x03668d2f), TOBN(0x2b6d7e37, 0xc1193562),
+	TOBN(0x85d2340b, 0x106b53b8), TOBN(0xd26d51af, 0x286706d1),
+	TOBN(0xa7584874, 0x0f7aba33), TOBN(0x51b2759d, 0x359705f9),
+	TOBN(0xe770f462, 0xa834f98c), TOBN(0xc0d67043, 0x8c546480),
+	TOBN(0x4efbe6c2, 0xa3b1b9e3), TOBN(0x06828c18, 0xbbab0907),
+	TOBN(0xc43d2dde, 0x54f47b7f), TOBN(0x8766865a, 0x04aa976b),
+	TOBN(0x79fc3f00, 0x6ae4b857), TOBN(0x9c7329ff, 0x6d6d13cb),
+	TOBN(0x9398d70c, 0xa4a4f755), TOBN(0xfea2d629, 0x38a582fd),
+	TOBN(0xfa668094, 0xda510192), TOBN(0x3e5877f7, 0xa64c7d88),
+	TOBN(0x87927a15, 0x18dd3c0d), TOBN(0x95c0a8ef, 0x8811352a),
+	TOBN(0x623a9e65, 0x76d6dda3), TOBN(0x261b84a4, 0x52342c35),
+	TOBN(0x7c68b2e9, 0x2fd33169), TOBN(0xe71faefb, 0xbfd5eee6),
+	TOBN(0xe5d479c8, 0x01ed5b83), TOBN(0xb22e3e47, 0x365f17b8),
+    },
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xb47d2edf, 0x56c52d35),
+	TOBN(0xbc24a403, 0x1f02ef71), TOBN(0xf71db05f, 0x8b1a54ce),
+	TOBN(0x88f6773f, 0x4526b91d), TOBN(0x441ee8a8, 0x859ea293),
+	TOBN(0xade0d4e7, 0xe884dff3), TOBN(0x2789fd8c, 0xc137959b),
+	TOBN(0x0ed005f9, 0x2675f79b), TOBN(0x311c2dd9, 0xe52d1194),
+	TOBN(0xe1736b1f, 0xb5da9e62), TOBN(0x540a5173, 0x24f6cc28),
+	TOBN(0x4c68f07a, 0x591e1b38), TOBN(0x75158ea8, 0xa2f9f382),
+	TOBN(0x13047afb, 0xa72410f5), TOBN(0x57aade54, 0x20e3459b),
+	TOBN(0x52cce8f2, 0xfbaf85cc), TOBN(0xea8d71a5, 0x75553bd2),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x5f14ddf9, 0x9e29b149), TOBN(0x6e49b7d3, 0x24f46ea6),
+	TOBN(0xab0c09eb, 0x086f71b5), TOBN(0x05a33626, 0xdb7884d4),
+	TOBN(0x7b22dfa5, 0x76530a5b), TOBN(0xfb03fb45, 0xbd284fa9),
+	TOBN(0xa9acc82f, 0xbca4922b), TOBN(0x4c5185cf, 0x64ca4466),
+	TOBN(0x83f0dcd8, 0x7c3b82d7), TOBN(0x3ca57999, 0xf350c60e),
+	TOBN(0x29076d06, 0x3669cf59), TOBN(0x80df6180, 0x6d71b5e8),
+	TOBN(0x82b7f8b7, 0x4912b1af), TOBN(0x78550df0, 0x5ebf3137),
+	TOBN(0x5f66538f, 0xaabf6fbd), TOBN(0x7ac3c88f, 0xd6200948),
+	TOBN(0x3a1a3cdd, 0x0a552e1f), TOBN(0x54a0265d, 0x5435e7ab),
+	TOBN(0x9914a43b, 0x9607b774), TOBN(0x6dfe8d08, 0x0b904eb2),
+	TOBN(0x85b1639c, 0x008fe41c), TOBN(0x90ee5ccb, 0x5ed7c0bb),
+	TOBN(0x80886d98, 0x50987db6), TOBN(0x0ca9e9c0, 0x8d4c0d48),
+	TOBN(0xf177278b, 0x8f7dc97f), TOBN(0xfc3d5fc7, 0xa9d414d9),
+	TOBN(0x0178ff14, 0xf8505c88), TOBN(0x46f3f89f, 0xddd4ba71),
+	TOBN(0xdd05157c, 0xa31b8b9e), TOBN(0x911b7dbc, 0x1634179e),
+	TOBN(0x155bd957, 0x449cede8), TOBN(0xbc26acd3, 0xfcc4dbf0),
+	TOBN(0x6d28ef97, 0xa5e66f7d), TOBN(0x58b9cad9, 0x2fe79462),
+	TOBN(0xfd83ee39, 0x91f071d8), TOBN(0xadd4bc02, 0x98ae723d),
+	TOBN(0xd8a0eace, 0xd49c87f6), TOBN(0xb7ab98ea, 0x4af5a49f),
+	TOBN(0x337c486e, 0x5360b210), TOBN(0x9b72858a, 0x8f3f8c0c),
+	TOBN(0xf23dd1ca, 0x129db8af), TOBN(0x888577ed, 0xe27d076f),
+	TOBN(0x8c9e0dc4, 0x51fdd33c), TOBN(0xe95270d5, 0xc1fee8f6),
+	TOBN(0x4ec434a7, 0x2a61b90a), TOBN(0xef1638d7, 0x4d1770f9),
+	TOBN(0xf1741d4f, 0xbed1e6bc), TOBN(0xfde888e4, 0x592c1658),
+    },
+    {
+	TOBN(0xb09eb39f, 0x75f2a63a), TOBN(0x576a13d0, 0x12c4b64e),
+	TOBN(0x59a366f2, 0xbcf3fabc), TOBN(0x03ea8f9d, 0xb52baca9),
+	TOBN(0xe473cc0d, 0x458d1b31), TOBN(0xcdd28d5d, 0x42332897),
+	TOBN(0xf29bcf04, 0xfdf07fef), TOBN(0x6f2de55c, 0x0ce7f0ad),
+	TOBN(0x4ded0af5, 0xd238c902), TOBN(0x4beead7a, 0x13bc44dd),
+	TOBN(0x023461ca, 0x31a909c8), TOBN(0xbb0efde1, 0x8e8361ab),
+	TOBN(0x9c374bef, 0x5e0c36ba), TOBN(0xbdc56b36, 0xda4b0b9c),
+	TOBN(0x91e70a1a, 0xc5af05e8), TOBN(0x44f1aadc, 0xce47377c),
+	TOBN(0x3e29cd2c, 0xf895e1d0), TOBN(0x0d2a5914, 0x6ea213e7),
+	TOBN(0xe7865e9b, 0x86742a7d), TOBN(0x69b3a126, 0xa5d22cbe),
+	TOBN(0x171ca3ac, 0x014216a5), TOBN(0x6eca398b, 0x928aa2dd),
+	TOBN(0x607b00ee, 0xbb071b0b), TOBN(0xcc514958, 0x9328e670),
+	TOBN(0xa409fe2b, 0xa2423bc8), TOBN(0xc4d12e04, 0x825fadb0),
+	TOBN(0x449e4f03, 0x2ccc8aee), TOBN(0x035df3fd, 0xeccc9087),
+	TOBN(0x8b455695, 0x459c8c92), TOBN(0x5a7012e8, 0xd1c64b6b),
+	TOBN(0x95b596e0, 0x94445f55), TOBN(0x1dceb1af, 0xbbae1da4),
+	TOBN(0xee074933, 0x09fc7811), TOBN(0x60afb39e, 0x9b4b2863),
+	TOBN(0xd47c2725, 0x572d141f), TOBN(0xc3bef87e, 0x43769636),
+	TOBN(0x22f8e8fe, 0x0619e643), TOBN(0x5ce5a5b3, 0x95f31051),
+	TOBN(0x03e49636, 0x8ea77c54), TOBN(0x7eb6d822, 0xfe08a833),
+	TOBN(0xc0aed0c9, 0x564a8b92), TOBN(0xc647c27d, 0xe4655a6a),
+	TOBN(0x86e8bd3a, 0xe65d7e2b), TOBN(0xf6ede139, 0x06ef958d),
+	TOBN(0x09385298, 0x87307cd8), TOBN(0xf86b44e2, 0x7d7d743d),
+	TOBN(0xd0dbbfe1, 0xe05bf89b), TOBN(0xea7b7f41, 0xcc4ef7af),
+    },
+    {
+	TOBN(0xfc384f0c, 0xbbefad10), TOBN(0x59c758e9, 0x24bf3f6c),
+	TOBN(0x79637810, 0x19ee711a), TOBN(0x3b1cccd8, 0xe8127707),
+	TOBN(0x3caff1f5, 0xa7e4275e), TOBN(0xab8d1cb1, 0x651d2eab),
+	TOBN(0xc269f6f2, 0x75fb181b), TOBN(0x372a39d2, 0xe1fe2743),
+	TOBN(0x71854453, 0xcd593ede), TOBN(0x1b3d7d59, 0x65cfc021),
+	TOBN(0x247651ae, 0xd920ba46), TOBN(0x965f1dd8, 0xbd109e39),
+	TOBN(0xea6159d7, 0xf210aeb5), TOBN(0x1196f53b, 0x5180ce88),
+	TOBN(0x6451e393, 0x089ee309), TOBN(0x260b64e9, 0xa3ce12c4),
+	TOBN(0x3f8b603b, 0x7264c2a8), TOBN(0x6a18cb7f, 0xe6d5add8),
+	TOBN(0x647ace06, 0x7844e452), TOBN(0x91c3ddea, 0x40bac26e),
+	TOBN(0x2448fe09, 0x35007694), TOBN(0x14b91709, 0x0d39fb78),
+	TOBN(0x144fcd73, 0x1eb6202e), TOBN(0xc7fc993b, 0xe08db501),
+	TOBN(0xaa187558, 0x4cfd56a5), TOBN(0x3c28a02c, 0x3ed4afc3),
+	TOBN(0x2058c116, 0x94abe0dc), TOBN(0xc4bc27de, 0x6be8ed3d),
+	TOBN(0xae0f3b23, 0xa8130412), TOBN(0x260af3a2, 0xcb35f531),
+	TOBN(0xa2724c07, 0x7e0c9e03), TOBN(0xfba986e4, 0xfa54c089),
+	TOBN(0x85b426c6, 0x93825463), TOBN(0xcab9667f, 0x631328b8),
+	TOBN(0x6d94b690, 0x7c1adb61), TOBN(0x22c4d400, 0x15eea4f9),
+	TOBN(0xb397802b, 0x9ebd8a1c), TOBN(0x7bc5b8c3, 0x6f05e376),
+	TOBN(0xc4d33803, 0x4e49b366), TOBN(0x03158a79, 0x2c49d3d6),
+	TOBN(0x5487a34f, 0x2c932f27), TOBN(0x41227232, 0xea7be095),
+	TOBN(0x989b67cd, 0x406d3acb), TOBN(0xec8d0f6e, 0x8402b0d8),
+	TOBN(0xe2668a7f, 0x23f9d1f2), TOBN(0xcb0c59be, 0x659e28e2),
+	TOBN(0x6e70394b, 0xd0bd60f3), TOBN(0x27b49644, 0xb981f96a),
+    },
+    {
+	TOBN(0x6e9b68c7, 0xe3e0d1d1), TOBN(0xda03cc8a, 0x4d5662bf),
+	TOBN(0xfb75ccac, 0x06b16198), TOBN(0xf1de0ac6, 0x4dd49347),
+	TOBN(0xa58bd9f0, 0x798d349b), TOBN(0x0f3c2aa2, 0x8d526f71),
+	TOBN(0xcdc03fa6, 0x9fd5676b), TOBN(0x2442eaa8, 0x30266213),
+	TOBN(0x4a27c364, 0x8d29fb97), TOBN(0x7e677461, 0x2541534d),
+	TOBN(0x7ef9dd10, 0x47710ced), TOBN(0x040f204a, 0xb8f8d4ed),
+	TOBN(0x43871cd8, 0xf02799f7), TOBN(0xdc17221d, 0x568fcab1),
+	TOBN(0xc5b0a600, 0x5d3e0884), TOBN(0x08721073, 0x55fcc85d),
+	TOBN(0x1ac9ce72, 0x65a123ef), TOBN(0xa0d99458, 0x7be68d31),
+	TOBN(0x7276c797, 0x3daee24b), TOBN(0x3b27a845, 0x9aeb0523),
+	TOBN(0x16dd5d49, 0x92ae3d86), TOBN(0x696294b8, 0x95e58d5f),
+	TOBN(0x8b004402, 0xc259e62d), TOBN(0x877e47ba, 0xc5fcd579),
+	TOBN(0x53645b4c, 0xca892c90), TOBN(0xdce82da9, 0x2ea57bf9),
+	TOBN(0x6c3aa85e, 0xd36ae8fd), TOBN(0x97803494, 0xeef2b0e4),
+	TOBN(0x3a658877, 0x2274b345), TOBN(0xe7973859, 0x4b0a39a0),
+	TOBN(0x4f15ed70, 0x97e349ab), TOBN(0xf0fb68c7, 0x3d4f003e),
+	TOBN(0x273ebd41, 0xde26f337), TOBN(0xa4fc9ca1, 0x2714796a),
+	TOBN(0xc59aea34, 0x26215260), TOBN(0x31ad0a97, 0xc443dcbc),
+	TOBN(0xc5c1d717, 0xfc470b57), TOBN(0xa2312bd6, 0x8f9ba291),
+	TOBN(0x269d589c, 0xeeae8182), TOBN(0x3a830a8f, 0x29b0665e),
+	TOBN(0xf6b91b41, 0x63437b42), TOBN(0x9f6e499c, 0x6cd7150d),
+	TOBN(0xbf0faecc, 0x3db136b9), TOBN(0xcf8728db, 0x34ebd54e),
+	TOBN(0x11a7239b, 0xab6fdcc2), TOBN(0x398de850, 0x23c9012b),
+	TOBN(0x0b81f80f, 0xb2dcb5b3), TOBN(0x7c2e91c8, 0x1befd54d),
+    },
+    {
+	TOBN(0xcc16a372, 0x5357b5f8), TOBN(0x1be85df1, 0xd5227e3f),
+	TOBN(0x3d3de3e3, 0xabe35b1e), TOBN(0x6925fc64, 0x3e756108),
+	TOBN(0x5a376946, 0x7da9acf8), TOBN(0x33c68301, 0x810d6f96),
+	TOBN(0x00b62e8a, 0xf667cda5), TOBN(0x093e82f2, 0x999d1fec),
+	TOBN(0x6db9c2cb, 0xecb6258e), TOBN(0xad55cc80, 0x21604100),
+	TOBN(0x6205ea12, 0xdb05cf76), TOBN(0x6e61950b, 0x86fe7ae0),
+	TOBN(0x3a56ccea, 0x8fdbca23), TOBN(0x7f7616b8, 0xba88819d),
+	TOBN(0x83737006, 0x53740c21), TOBN(0x4cd6a321, 0xaad9a63d),
+	TOBN(0xe2fc853b, 0x20b20760), TOBN(0xdb71c6ef, 0xe9a5c0bb),
+	TOBN(0x82a2dbd1, 0xc7e22485), TOBN(0x1e52be9c, 0xd8d3fdf6),
+	TOBN(0xddfc124f, 0x99e2934a), TOBN(0x61d11a93, 0xed35b546),
+	TOBN(0x57f153be, 0xbe3fdf5d), TOBN(0x723c03ff, 0x185792f1),
+	TOBN(0x62cbdf83, 0xdc7a0b9e), TOBN(0x56f09c02, 0xf5e3c932),
+	TOBN(0x739770c7, 0xc5d1c8c5), TOBN(0x61904887, 0xd709d3d5),
+	TOBN(0xd9efdfab, 0xb71c331e), TOBN(0xefde6cd0, 0x3ec6375c),
+	TOBN(0x6919b7da, 0x7fd5e271), TOBN(0x9a6e4eea, 0x8d701206),
+	TOBN(0xb06f982c, 0x4ec5971b), TOBN(0x9b56cd16, 0x9f460337),
+	TOBN(0x37f49b8d, 0x17e8e6c8), TOBN(0x612cdf4f, 0x2cbee805),
+	TOBN(0xaaa26e8e, 0xa4a8f78e), TOBN(0xc26885ac, 0x5828c7b8),
+	TOBN(0x27c4a2e9, 0x5f48e839), TOBN(0x080ffbeb, 0xade19e22),
+	TOBN(0x9e80b542, 0x1dbe0c4e), TOBN(0x5ddb980e, 0x465799f4),
+	TOBN(0x503ee96f, 0xef05601d), TOBN(0x228714a8, 0x4028ab87),
+	TOBN(0xf47db087, 0x663259c0), TOBN(0x28164394, 0x9b94be04),
+	TOBN(0x5c597e62, 0x3d99a97b), TOBN(0x642717cb, 0x31aefb88),
+    },
+    {
+	TOBN(0x9456a36d, 0xfad29108), TOBN(0x054e20ac, 0x1683e695),
+	TOBN(0x4009d26e, 0xd9de172d), TOBN(0x41e8583f, 0x750e6887),
+	TOBN(0x1790afbc, 0xeb609866), TOBN(0xb98fd724, 0x52cbe1aa),
+	TOBN(0xce20d835, 0x2514201a), TOBN(0x9f8ecc61, 0xecf6182a),
+	TOBN(0xb7f7622c, 0xc03b23ec), TOBN(0xa4525e4f, 0x1c8fb3a1),
+	TOBN(0xd0046759, 0x19bfd852), TOBN(0xb7565dd8, 0xf1081357),
+	TOBN(0xbac58c5e, 0xfc29356e), TOBN(0x969d3dcd, 0x17e7db6c),
+	TOBN(0x4cf9bc6b, 0x990aaf02), TOBN(0x6ca6994a, 0xcffb3c37),
+	TOBN(0x573b9a7f, 0x48702be4), TOBN(0x0246a3fb, 0x685f5561),
+	TOBN(0x5ecd9c13, 0x370b68dd), TOBN(0x0e29ea53, 0x28e70962),
+	TOBN(0xaedf6a7f, 0x85f121bb), TOBN(0x44ebfe96, 0x7db8ceb4),
+	TOBN(0x2afc658b, 0xb275a221), TOBN(0x961ca266, 0xc6c47182),
+	TOBN(0xd1a32171, 0x405f1d70), TOBN(0x2b36752a, 0xb6ee4ebf),
+	TOBN(0x67c0f703, 0x3034482c), TOBN(0xf2c5136b, 0xc26a6efe),
+	TOBN(0x837b0a21, 0xb8b7b9b6), TOBN(0xa4937df4, 0x69dbd16c),
+	TOBN(0xe748127e, 0xef9ad3e7), TOBN(0x0c86c021, 0xc34b7667),
+	TOBN(0x2a6e100a, 0x0621ec94), TOBN(0x39e27fb2, 0xbfd7bd74),
+	TOBN(0x10f75b48, 0xd36a92ba), TOBN(0x560cd9e4, 0x2629ff98),
+	TOBN(0x7ccd5c3e, 0xd7141df6), TOBN(0xc743cfc2, 0x40bcf559),
+	TOBN(0x407743cf, 0xba01760b), TOBN(0xa2df55e4, 0xee7de3f7),
+	TOBN(0x254f642d, 0xefde164f), TOBN(0x2cf43cee, 0xd12dbae2),
+	TOBN(0xb77985b7, 0x87c4f636), TOBN(0x57c98fee, 0xb34eb45a),
+	TOBN(0xab211cd0, 0xcf0f2d72), TOBN(0x5547c015, 0xc3559cdd),
+	TOBN(0xa7b077c1, 0x78d8bd47), TOBN(0x2675f837, 0x183d22d2),
+    },
+    {
+	TOBN(0x7a547bc3, 0x7f5f8b33), TOBN(0x7e87478b, 0x66df64ed),
+	TOBN(0xa835fe60, 0x123af1ed), TOBN(0x432440e9, 0x7a6ffcdf),
+	TOBN(0x6a11202a, 0xacbd0a72), TOBN(0xdf7ee19d, 0x0462f942),
+	TOBN(0x4e5bb050, 0x1a9bc9d4), TOBN(0xd682ac1a, 0x2f5c618e),
+	TOBN(0x36dd58b9, 0xe6fa03f7), TOBN(0xee99cc3f, 0x8444d93f),
+	TOBN(0xc8001a43, 0xda074e27), TOBN(0x30eb4946, 0xb0044a02),
+	TOBN(0x52bdf308, 0x064a3084), TOBN(0x997643e6, 0x8eb7be0f),
+	TOBN(0xd10cec5d, 0x711673ce), TOBN(0x7c46badd, 0xb67d3e8a),
+	TOBN(0xa89c02ad, 0x7f617424), TOBN(0xae0878f6, 0xb17b9ce9),
+	TOBN(0x19744557, 0x73f47dfc), TOBN(0xf942324a, 0xbea25401),
+	TOBN(0xa9f7e9db, 0xe492b18d), TOBN(0x5f5915de, 0xd524a852),
+	TOBN(0x2cac1681, 0xe61057ea), TOBN(0x1f2568f2, 0x8834eb28),
+	TOBN(0xf319697d, 0x58dd1fd7), TOBN(0x8d3850c7, 0x4d252a2c),
+	TOBN(0x8461230a, 0xc1eb74e2), TOBN(0x263c296c, 0xbc337bf9),
+	TOBN(0x463bddb8, 0xc2dadff3), TOBN(0x4c814a66, 0x42ed0894),
+	TOBN(0x29c9c995, 0x7a60962f), TOBN(0x2ae8b820, 0x5a1336dd),
+	TOBN(0xdd4cc63c, 0xd62be629), TOBN(0x28468b0a, 0x6c46746f),
+	TOBN(0x0bdcbcdb, 0xf99d781f), TOBN(0x0d5b13f9, 0xb07f9ba8),
+	TOBN(0x4330990a, 0x3f339cfc), TOBN(0x722967b6, 0xa9d01e2d),
+	TOBN(0xa7f6b2a0, 0x2f4a4d2a), TOBN(0x7d772bac, 0xe9a8cf97),
+	TOBN(0x8a431ba7, 0xb8959a97), TOBN(0x417ca21c, 0x6c0ea17c),
+	TOBN(0x7ab6dab4, 0x854a2f8f), TOBN(0xd50cae59, 0x4fe7e818),
+	TOBN(0x51484c17, 0xc051ee46), TOBN(0x07891ee2, 0xc45c6d66),
+	TOBN(0xb155d001, 0xcb8f08ce), TOBN(0x329983a9, 0x098138dd),
+    },
+    {
+	TOBN(0xc159eb26, 0xf868e1d8), TOBN(0x49a60355, 0x4aee88fb),
+	TOBN(0xc6b9aec9, 0xbfb84072), TOBN(0x3fa42373, 0x262b3077),
+	TOBN(0xc2e70398, 0x92be3871), TOBN(0xce086865, 0x6403c157),
+	TOBN(0xb520b333, 0x1e8a0ce8), TOBN(0x669683d3, 0x954cce67),
+	TOBN(0x741434e9, 0x1bdd5469), TOBN(0x1bcd4ee9, 0x5ead5567),
+	TOBN(0x08eab945, 0x26538d01), TOBN(0x734242ba, 0x991017b4),
+	TOBN(0xd6c5e774, 0x75dd3595), TOBN(0x7ec66c46, 0x278dc2d2),
+	TOBN(0x4755851e, 0x82a71661), TOBN(0xe69866f0, 0xc3098dcd),
+	TOBN(0xe5810b14, 0x8eb9165f), TOBN(0x94a6da09, 0x2732187f),
+	TOBN(0xf4ac901c, 0x8c9e3b12), TOBN(0xe204543f, 0x0505dc73),
+	TOBN(0xd104b45c, 0xc92f83fa), TOBN(0x27fbf636, 0x0dedc6e9),
+	TOBN(0x08df683e, 0x7d04a821), TOBN(0x6ac6de53, 0x07b46767),
+	TOBN(0xaeada12c, 0xbbb99f8c), TOBN(0x1f172d93, 0xfedfd40a),
+	TOBN(0xf088e92a, 0xea6c0618), TOBN(0x2e185621, 0x4d805a4c),
+	TOBN(0xb8afc784, 0xc7f9577a), TOBN(0x0bbb2491, 0xc6cdc6aa),
+	TOBN(0x3f9be0c4, 0xc94b33e7), TOBN(0xa3dd73ba, 0x64e41c7b),
+	TOBN(0xf533ffab, 0x5453a932), TOBN(0x14e1b5d1, 0x527fede2),
+	TOBN(0x3ecf57ca, 0xbf9c7ce4), TOBN(0x48f6ee22, 0x69b927ba),
+	TOBN(0xf20d70ce, 0xce0317ca), TOBN(0x5c85e0e4, 0xc0a09c06),
+	TOBN(0xdaa61671, 0x9f4631a4), TOBN(0x510a07f7, 0xeb1c8674),
+	TOBN(0x7b890e00, 0x00abfc87), TOBN(0x6d7d9bfc, 0x4dc4cdd2),
+	TOBN(0x63bec1bc, 0x9b82e8d2), TOBN(0xb02e36cc, 0x0e30b625),
+	TOBN(0x71a8a0c5, 0x56b58b1d), TOBN(0x23887383, 0x693b0625),
+	TOBN(0xdb4a297d, 0x38b983b9), TOBN(0xa72cf9a5, 0x54b859e8),
+    },
+    {
+	TOBN(0x67f86c72, 0xda78bcd9), TOBN(0xa987e506, 0x2f89a556),
+	TOBN(0x6c9befbf, 0xd8f5238f), TOBN(0x62aaf064, 0x15c341e3),
+	TOBN(0x2af1196c, 0x83bc4620), TOBN(0x6da032e9, 0x80da9080),
+	TOBN(0xbcb1d863, 0x6ced43c7), TOBN(0xc0aed254, 0xf060d11c),
+	TOBN(0x996d1c48, 0x247d5dfb), TOBN(0x460823ff, 0x70dfc9a3),
+	TOBN(0xe6fcf890, 0x16a624ce), TOBN(0x804b6bd5, 0x29e4842d),
+	TOBN(0x11238c44, 0x8f279610), TOBN(0x9dabebe2, 0x2a0d14ea),
+	TOBN(0x2533b3bd, 0x56884f8d), TOBN(0xecae7f1e, 0x1095d670),
+	TOBN(0x3cf18440, 0xab9542b3), TOBN(0x9c101e4a, 0x2f2f2078),
+	TOBN(0x904778f2, 0xb96fc987), TOBN(0x1875f783, 0xdb614f43),
+	TOBN(0x34b85986, 0x79d87550), TOBN(0x7d84c0e6, 0x0ad40535),
+	TOBN(0x47b5d63e, 0x60124954), TOBN(0xb9b5b92f, 0xff2dd767),
+	TOBN(0xe7935ced, 0x6b1aaea7), TOBN(0xabd33ada, 0x4058acc5),
+	TOBN(0x200fa77a, 0xfc2c0735), TOBN(0x28cec2bc, 0xc3008a9c),
+	TOBN(0x97d26ba8, 0xb36e5da4), TOBN(0x4d734189, 0xf8bddb82),
+	TOBN(0x431d16e9, 0xd5be514c), TOBN(0x3efee593, 0x0f366a4c),
+	TOBN(0x4b53b9c0, 0x3b6174a8), TOBN(0xa7d8e751, 0x0e37da9f),
+	TOBN(0x1519e817, 0xd5ebe38c), TOBN(0x17b7ff67, 0xfe0421f6),
+	TOBN(0x7961502f, 0xc4592e68), TOBN(0xb488d0ae, 0x30356b22),
+	TOBN(0x419eb0e1, 0xa0c803df), TOBN(0x4588a6f9, 0x85b727dc),
+	TOBN(0x957e9be2, 0x03d1a415), TOBN(0x539f081f, 0x964b4357),
+	TOBN(0xa68668f2, 0x821bfb34), TOBN(0x4d9ac744, 0x1221b92c),
+	TOBN(0x00ba2a2f, 0xc872fe2b), TOBN(0xc507202f, 0x0055b5ef),
+	TOBN(0x6103a138, 0xb0f82670), TOBN(0x1be4c4c7, 0x61b53a98),
+    },
+    {
+	TOBN(0x7dfef9bf, 0xd12c3a44), TOBN(0x520d6ad8, 0xf969aa45),
+	TOBN(0xfcb2de32, 0x8bf9f387), TOBN(0x01543084, 0xd430e6da),
+	TOBN(0xbc7e5da6, 0xb0cd9432), TOBN(0x244e3bc5, 0x3d885f69),
+	TOBN(0x4a155293, 0x1ffe8968), TOBN(0x86ecaceb, 0x090a7560),
+	TOBN(0x52f898b2, 0x73093785), TOBN(0xa3d71782, 0x18117fae),
+	TOBN(0x6f8a3ca2, 0xc44f48be), TOBN(0x2b93b323, 0xe1072469),
+	TOBN(0x207991bf, 0x03c126cc), TOBN(0x1c0a99d9, 0x1debcde0),
+	TOBN(0xf0417f30, 0x55397ee0), TOBN(0xbd3696a4, 0x0cb6cd81),
+	TOBN(0x64fc31bf, 0xcbb17983), TOBN(0x174573db, 0xed4f441b),
+	TOBN(0x9897c423, 0x67c31e51), TOBN(0x220724b5, 0x4528bb6e),
+	TOBN(0xbbd2a0f5, 0xca76260a), TOBN(0x0ad3610b, 0x7b16b8b3),
+	TOBN(0x88446a5b, 0x4f3da61b), TOBN(0x9e4a06ab, 0xc5ae9892),
+	TOBN(0x489a990f, 0x3f131cee), TOBN(0x98f6421d, 0xe69c45e8),
+	TOBN(0x863445df, 0xb559cf86), TOBN(0x543f3306, 0x6d944609),
+	TOBN(0x03141259, 0xa27cb8c9), TOBN(0x7519ee85, 0xb651fac9),
+	TOBN(0x5f66426b, 0x405dee9e), TOBN(0x6f990800, 0x4e9bb0fb),
+	TOBN(0xdf3141f2, 0x5315d761), TOBN(0xbf46e636, 0xa1b2fd79),
+	TOBN(0x5d45fef1, 0xce6ba330), TOBN(0xd38b9dd8, 0x3eaadb3c),
+	TOBN(0x08320544, 0xa0f21546), TOBN(0x8bde5d57, 0x549cf56f),
+	TOBN(0x03c10105, 0xbb32b0be), TOBN(0x419f3a02, 0x85002860),
+	TOBN(0xa6fc92c2, 0x18f522d0), TOBN(0xf488896d, 0x2b902d81),
+	TOBN(0x029a53ff, 0xba68efdd), TOBN(0x3e47af61, 0x04842bae),
+	TOBN(0x636c230a, 0x28964994), TOBN(0x2ff4df8d, 0xcf6de04b),
+	TOBN(0x6c39fafe, 0x26066d3f), TOBN(0xcc28a1e1, 0x7d22cebb),
+    },
+    {
+	TOBN(0x6d9eb703, 0xc1bec539), TOBN(0x88cc5887, 0x2b6ef6c8),
+	TOBN(0x209ffcbb, 0x68639c78), TOBN(0xec5f7c5f, 0x68838334),
+	TOBN(0x2bd439ee, 0xe0c69c0b), TOBN(0xbc3c440b, 0xd189c27c),
+	TOBN(0x7322ae9f, 0x63919397), TOBN(0xf8c42c89, 0x4eab84dc),
+	TOBN(0x4ca869c2, 0x58bafe99), TOBN(0x1deff406, 0x64d51e1c),
+	TOBN(0x7ac33c69, 0xabb7f4ad), TOBN(0xff3d774d, 0xb3eee416),
+	TOBN(0xa2c02ef7, 0x5a215fab), TOBN(0x2a9750ae, 0x53ed3b3d),
+	TOBN(0x9e5b3f55, 0x341ab544), TOBN(0x568dcfb7, 0x6fb4d5d5),
+	TOBN(0xfb99911f, 0xfb148b8d), TOBN(0x18bbaed0, 0x904bcb8b),
+	TOBN(0xd3cb2713, 0xbe92fdcd), TOBN(0xbe5a0ce5, 0xd42e1aea),
+	TOBN(0x51fff053, 0x1dfa3ead), TOBN(0x4537fc3d, 0x55a617d3),
+	TOBN(0x871b51a3, 0xecdf5175), TOBN(0x4f4c12b9, 0xef7d0fa1),
+	TOBN(0xa7d57f7b, 0x98bf83b6), TOBN(0x993506d9, 0x1cfbbe00),
+	TOBN(0x7607172c, 0x4ba63219), TOBN(0x5713d5b7, 0xdccb263a),
+	TOBN(0xb047b8a4, 0x1723b8c7), TOBN(0xb74238ef, 0x90a50785),
+	TOBN(0x0f9b3336, 0x85a0b2c4), TOBN(0x6f06658a, 0xafd62518),
+	TOBN(0x9c6c1a06, 0xb491a0dd), TOBN(0xc7ccdfbf, 0x8410a513),
+	TOBN(0x87eb7040, 0xb9b85ab0), TOBN(0x92ff42e7, 0xb4c4ea30),
+	TOBN(0x61810e58, 0xac1b1801), TOBN(0x0d930cf6, 0x3c3e8428),
+	TOBN(0x43842b93, 0xda299b50), TOBN(0xb65b482a, 0xe767fb10),
+	TOBN(0xd60a3322, 0xe8352e95), TOBN(0x99936b4a, 0xcf4af270),
+	TOBN(0x6698cdd8, 0xb66c6606), TOBN(0x1e9850ee, 0x57de6d0a),
+	TOBN(0xa4c819c8, 0xb23f58ed), TOBN(0x25d11c7f, 0xc3d70e14),
+	TOBN(0x5d15bf88, 0xaf0f0223), TOBN(0x4192cfb8, 0xddf14f48),
+    },
+    {
+	TOBN(0x40b7ea8c, 0xc8c223b8), TOBN(0x7fcc88f8, 0x671ff41f),
+	TOBN(0xbe04bdd8, 0x27fe231d), TOBN(0xfc32978a, 0x792361fa),
+	TOBN(0x50b3a00d, 0xdde6b498), TOBN(0x78356a68, 0xcb461fc8),
+	TOBN(0x9721c329, 0xa4f631e9), TOBN(0xddd4978f, 0xeeabb707),
+	TOBN(0xe38dd661, 0x33002550), TOBN(0x61c94697, 0xc10b859d),
+	TOBN(0x09da3ae9, 0x5aab0caa), TOBN(0x9a8ff2f6, 0x230a5597),
+	TOBN(0xa59a4bb1, 0x9e2f2753), TOBN(0x00de2444, 0x96bd00d5),
+	TOBN(0xdcfe3bb8, 0x34bebc20), TOBN(0x99954c3f, 0x4819b2f0),
+	TOBN(0x42964f24, 0x40e57b20), TOBN(0x76fcd991, 0x49fc2c66),
+	TOBN(0x2e79f9a5, 0xa7250c20), TOBN(0x1d22405f, 0x84d857bd),
+	TOBN(0x510152e6, 0x44a92ac2), TOBN(0x22c37c6e, 0x5a5f3144),
+	TOBN(0x379d0629, 0x1f22cfc3), TOBN(0xe410165d, 0x031f6760),
+	TOBN(0xbd53507e, 0xb1bb9942), TOBN(0xa91dfde3, 0xdfb5d178),
+	TOBN(0x230be3b6, 0x81abc5c7), TOBN(0xfb817042, 0xef2a8860),
+	TOBN(0xf6073c5d, 0x424e28a3), TOBN(0xcbd1d08e, 0xb7f8d7df),
+	TOBN(0xc7e7090f, 0x36646b79), TOBN(0x185c582a, 0x942140e4),
+	TOBN(0x720472a0, 0xbda83ea3), TOBN(0xb9428f3e, 0x599103fd),
+	TOBN(0xbf80928f, 0xdbac9cad), TOBN(0x01f30741, 0x3d3a06d5),
+	TOBN(0x2ece1818, 0xc0a72a31), TOBN(0x46f59d12, 0xb0fac98e),
+	TOBN(0x548f653b, 0xb468f5ad), TOBN(0x3212d695, 0xe91549a3),
+	TOBN(0x84868558, 0x8f592859), TOBN(0x9da90068, 0x75e5cc48),
+	TOBN(0x54ee0e56, 0x0ce71998), TOBN(0xf85da3c1, 0x3110fa28),
+	TOBN(0x4f4e3457, 0xdeaaa08b), TOBN(0xece16459, 0xdb88355b),
+	TOBN(0x9a275c24, 0x301306fb), TOBN(0xb318dbb8, 0x5390f734),
+    },
+    {
+	TOBN(0x6c23cd28, 0xab3a8302), TOBN(0x7ede603e, 0x33db7458),
+	TOBN(0x3b3b3a60, 0x6b5e3903), TOBN(0x0a5f14f1, 0x2a81dee0),
+	TOBN(0x39ff44c6, 0xdf1f1576), TOBN(0x7e224b0b, 0x5509219e),
+	TOBN(0x9aedfe73, 0xb770b3cd), TOBN(0xf1fb0e9a, 0x0346c3f7),
+	TOBN(0xb1b51d4f, 0xca489fa6), TOBN(0x4343b1d1, 0xe3431cf4),
+	TOBN(0x9d419f35, 0x3ba28105), TOBN(0x4667bb66, 0x28d697cb),
+	TOBN(0x7e8f3f67, 0xf9ab3d8c), TOBN(0x7a70139d, 0xded5bdf6),
+	TOBN(0x99a24605, 0xb7dbd670), TOBN(0x17d3a881, 0x7bdf9af2),
+	TOBN(0x093739ad, 0xd5af07cf), TOBN(0x095e2c6d, 0x41642b72),
+	TOBN(0xdecdab97, 0x097b8408), TOBN(0xa98f1143, 0xe5ca2d74),
+	TOBN(0x8c4653a8, 0x39181d65), TOBN(0x728bd95d, 0x37531ef1),
+	TOBN(0xe3b89551, 0xec005c15), TOBN(0xdb10121e, 0x87526d41),
+	TOBN(0x305028f4, 0x76aee9e6), TOBN(0x45290b90, 0x7828e729),
+	TOBN(0x85ec4a88, 0x01738dea), TOBN(0x74b4c28f, 0x8bc8ca1a),
+	TOBN(0x57ee664a, 0x6d656d9b), TOBN(0x6b9eac17, 0x66f67f2e),
+	TOBN(0xa13452e5, 0x188a53c3), TOBN(0x176cb387, 0xe1bcad97),
+	TOBN(0xb6f0bbc1, 0xaeca6d3a), TOBN(0x04957c33, 0x2c2c5af3),
+	TOBN(0x396af5bc, 0x01a120fa), TOBN(0x455bd7a5, 0xab017c02),
+	TOBN(0x07ee6306, 0xf23f2584), TOBN(0xe0635496, 0x736cc5d2),
+	TOBN(0x64da6861, 0xdc064376), TOBN(0x46b9d199, 0x738a69c8),
+	TOBN(0x2b2aa2f9, 0x9cf84238), TOBN(0x58c8fc7b, 0x4da74cd4),
+	TOBN(0xc75a38e5, 0x8bb69bdd), TOBN(0xa89c8c24, 0xdad98ce2),
+	TOBN(0x8743e978, 0xe7003dd1), TOBN(0x94cc3d30, 0x45dfc42f),
+	TOBN(0x469f98c9, 0x706e1176), TOBN(0x9059c2c8, 0x9850df0a),
+    },
+    {
+	TOBN(0xf8b8e8e8, 0xaf2ea01c), TOBN(0x7ece28ed, 0x6faf69bc),
+	TOBN(0x3701939e, 0x7fa92433), TOBN(0x4e23568e, 0xea694dcd),
+	TOBN(0xdb562063, 0x6acb27ce), TOBN(0x1f554c22, 0x70babc52),
+	TOBN(0xe5b8cd0d, 0xabadc6be), TOBN(0xe05bdc0a, 0x2d694549),
+	TOBN(0x1ff4eeec, 0x5aa45059), TOBN(0x4c955fa0, 0xe5caf66f),
+	TOBN(0x69a496bf, 0x17a5e88b), TOBN(0x7a595fff, 0xd6415179),
+	TOBN(0x1a9ece06, 0xbecef716), TOBN(0x60382322, 0x649362e2),
+	TOBN(0x6ae6cdef, 0xef5b17df), TOBN(0x31459a9d, 0xa5e4e5ee),
+	TOBN(0xb48f35d3, 0x58e28a2f), TOBN(0xe603c2bf, 0xa24df3fd),
+	TOBN(0x6780603d, 0x25e6ffee), TOBN(0x4f80e736, 0xb08c0433),
+	TOBN(0x9147d256, 0xb5b61284), TOBN(0x1ca6f8cf, 0xd103afcf),
+	TOBN(0x572e3c21, 0x2f5db0de), TOBN(0x143e2cb8, 0xbf6ec454),
+	TOBN(0xc4beea95, 0x7f099347), TOBN(0xfcd2a198, 0x6cb49a3b),
+	TOBN(0x7f67c77e, 0x32b11839), TOBN(0xd95bb3fd, 0xb392cf14),
+	TOBN(0xf4eb097a, 0x9544bc4b), TOBN(0x65aec805, 0x3362937e),
+	TOBN(0xb89006fe, 0x3d69a032), TOBN(0x2f6da67e, 0x687204df),
+	TOBN(0x47062dca, 0xddd42a96), TOBN(0x94a5af90, 0x6408b769),
+	TOBN(0xd270f599, 0xb7ac8a8c), TOBN(0xe2854d72, 0x16d0e3d2),
+	TOBN(0xdcf28d22, 0x2a71c0b0), TOBN(0x022477c3, 0x056baf92),
+	TOBN(0x0b702e18, 0x293ecf61), TOBN(0x3d82ff40, 0x24f3aca1),
+	TOBN(0xfc02335d, 0xad57aa1e), TOBN(0xda308327, 0xece5c5b1),
+	TOBN(0x184f58f5, 0xbc378d07), TOBN(0x5526e299, 0xf10e6048),
+	TOBN(0x21b6b5d9, 0x2cefedba), TOBN(0x4d1fbd05, 0x4962abcb),
+	TOBN(0xd309e264, 0x669bb7cb), TOBN(0x7373d7a1, 0x38792e35),
+    },
+    {
+	TOBN(0xa5a9c693, 0x6ac05f87), TOBN(0xe5d37bbd, 0x5fc33666),
+	TOBN(0xb310f201, 0x1282821f), TOBN(0xfbd4facc, 0x980fd910),
+	TOBN(0x693ac903, 0xe0a86171), TOBN(0x9d46724d, 0x436f8cdb),
+	TOBN(0x3fb0e498, 0x3095a6f7), TOBN(0x432dc59a, 0xc050a3bb),
+	TOBN(0xa061bc73, 0x4633c653), TOBN(0x394fa3ba, 0x314fd0f9),
+	TOBN(0x621e5d73, 0x5a06edd7), TOBN(0x236a6808, 0xb4507bd1),
+	TOBN(0x4802016f, 0xceb671fa), TOBN(0x8dbbac4f, 0x04cdffd6),
+	TOBN(0xd844cdef, 0x914fa161), TOBN(0x9e108e33, 0xfc3e929a),
+	TOBN(0x6256fc0a, 0x4954a0b8), TOBN(0xb46e902f, 0x2fd275d0),
+	TOBN(0xa3a576bf, 0x4b25b075), TOBN(0xddb429af, 0x23d075ad),
+	TOBN(0x2cdd022e, 0x7972b740), TOBN(0xd3de8efa, 0xf172e161),
+	TOBN(0xf4c515a7, 0x910bc161), TOBN(0x2e48817e, 0x4ab1eca0),
+	TOBN(0xa9da85a6, 0xd9e8373c), TOBN(0xbeb09c9a, 0x9379d9c7),
+	TOBN(0x20f13458, 0xe7beb16e), TOBN(0x8a6b88a9, 0x6271234d),
+	TOBN(0x289a8711, 0x34906c63), TOBN(0x1190057b, 0x114a8ca7),
+	TOBN(0xd7afaf60, 0xdc21e855), TOBN(0xb8397018, 0xcf7d41c4),
+	TOBN(0xdc7c4aee, 0x6d538717), TOBN(0x91f89454, 0x5170c5dd),
+	TOBN(0xafc68589, 0x7393edda), TOBN(0x7009065a, 0x969113df),
+	TOBN(0x90b54b52, 0xac48f9c6), TOBN(0x9eae6fbe, 0x55164db4),
+	TOBN(0x73f4aede, 0x3fc6dce4), TOBN(0x45b9f96e, 0x60206406),
+	TOBN(0xe2b5b95b, 0x1a62e4ff), TOBN(0x91db30d1, 0xe837b345),
+	TOBN(0x5448551f, 0x5c45d57d), TOBN(0x04142e07, 0x9a58ea53),
+	TOBN(0x4444cc9d, 0x5c7925d9), TOBN(0xb51cf8a6, 0x4f19c55b),
+	TOBN(0x116dec5b, 0x31ae3f8d), TOBN(0xa6f4ca4d, 0x8a2e030f),
+    },
+    {
+	TOBN(0x9db651b1, 0x938a28f7), TOBN(0x60fe7e74, 0xf16d9bec),
+	TOBN(0xc963a3e7, 0xa5f6cc28), TOBN(0x7a907567, 0x28a88b45),
+	TOBN(0x821a84c5, 0x659e5cf9), TOBN(0xea53a8eb, 0x10f53ada),
+	TOBN(0x1cdb0d54, 0x58aec0d8), TOBN(0x97ecaa9b, 0x606bb822),
+	TOBN(0x4c7cb4d9, 0x78ef6069), TOBN(0x25876d2b, 0x5a204caa),
+	TOBN(0x5320ec6d, 0xcbc263de), TOBN(0xbff121c1, 0xfac686ff),
+	TOBN(0x201b5035, 0x9ca1fc55), TOBN(0xd201f54d, 0xfd3d2fc7),
+	TOBN(0xc5457b22, 0xb65aca99), TOBN(0xc6c2ada3, 0x5577bac5),
+	TOBN(0xb7e90d65, 0x5531d5f9), TOBN(0x233fffb4, 0xd2f72212),
+	TOBN(0xf529c885, 0x0481ae19), TOBN(0x1c53c755, 0x3426fd40),
+	TOBN(0x6e48ee7e, 0x8ea18e4a), TOBN(0x4d01d489, 0xfb90b9c4),
+	TOBN(0x1b6bd859, 0xe93b975e), TOBN(0xb084bb4b, 0xbfba6753),
+	TOBN(0x26c9f15d, 0x4e0e1092), TOBN(0xab1c3c7f, 0xda0e6a9a),
+	TOBN(0xd0dcfa84, 0x498c17ca), TOBN(0x46f33e9d, 0xa96fb265),
+	TOBN(0x39898c5b, 0xa3c5c699), TOBN(0x6d3fe3ab, 0x6f85ab18),
+	TOBN(0x891c7b16, 0x2101086b), TOBN(0x24c292c5, 0x521cc350),
+	TOBN(0xb1601555, 0xedbb0bd0), TOBN(0xaffa958c, 0x0f6b8082),
+	TOBN(0x33cff45b, 0x2b84a9ae), TOBN(0x5212e4ca, 0x146a5fb6),
+	TOBN(0xf6235dfa, 0x52627b82), TOBN(0xcd32e57f, 0x52a3f9ba),
+	TOBN(0x474ccbee, 0x1ff4acc6), TOBN(0x9d9e9583, 0x15e5c1f6),
+	TOBN(0xc5862814, 0x61aee242), TOBN(0x5b641777, 0x294c86cf),
+	TOBN(0x07b1a2f0, 0x29913d5c), TOBN(0xf2de3904, 0xcfab8662),
+	TOBN(0x557344c7, 0x5f20e710), TOBN(0x4d6c4c77, 0x02acfb45),
+	TOBN(0xcef2104c, 0xe6b5ebb0), TOBN(0xdea460d8, 0x64f7d04c),
+    },
+    {
+	TOBN(0x2a38d351, 0x7db73eab), TOBN(0xfa01c336, 0x726e7a1e),
+	TOBN(0x1be2bf7c, 0xdd42ba4a), TOBN(0x8bfa3f7d, 0xc7fca1de),
+	TOBN(0x46d6b633, 0x5afb73ba), TOBN(0x304d3451, 0x6fbfcc26),
+	TOBN(0x3983b185, 0x870020c5), TOBN(0x0692d9f3, 0x23a08869),
+	TOBN(0x962d462c, 0x863bd457), TOBN(0x37dfe02a, 0xd66c2c40),
+	TOBN(0x703adaf1, 0xd3515eaf), TOBN(0x385a02f8, 0xb0dfdb22),
+	TOBN(0x08105ab9, 0x7db05978), TOBN(0x7ed3a9ba, 0xba750093),
+	TOBN(0x4a7f7fea, 0x9b7155f4), TOBN(0xfe73f05a, 0x1b42b13b),
+	TOBN(0xf0ad742c, 0xa95491c4), TOBN(0xbe4d4694, 0xe2181abe),
+	TOBN(0xda1c9623, 0x82cf79dd), TOBN(0x2041c1a1, 0x96e89aab),
+	TOBN(0xa09a53a8, 0x2057929d), TOBN(0x8a5b3b89, 0x34adcd5f),
+	TOBN(0x835c2339, 0x03382ee9), TOBN(0xa1904227, 0x69e0bea1),
+	TOBN(0x1d08ab0d, 0xd4094881), TOBN(0xe329201c, 0x19cc9c9d),
+	TOBN(0xaa23ebdc, 0x7993cd12), TOBN(0xbe1b09a2, 0xd9e7c8d5),
+	TOBN(0xa94cde8e, 0x0cb79e90), TOBN(0x16e52e92, 0x5ce9313f),
+	TOBN(0x3e38f680, 0x50710a32), TOBN(0x261399bb, 0x10f9a01f),
+	TOBN(0xb31b9e2e, 0xed88880a), TOBN(0xa143603c, 0xcb278d55),
+	TOBN(0x6ad47a8b, 0x63f5fae6), TOBN(0x084c036c, 0x3c179680),
+	TOBN(0x0ebd23ae, 0x85d4c55b), TOBN(0xcafdf7fd, 0x89845d8e),
+	TOBN(0xce51d688, 0x0d583f0a), TOBN(0x4fc0b722, 0x86a5eef7),
+	TOBN(0x1888e9c2, 0xec613de2), TOBN(0x4a8ae764, 0x904ad8af),
+	TOBN(0x14691418, 0xbb41f42a), TOBN(0x2812def4, 0xde38215c),
+	TOBN(0xbc9e2853, 0x06bee12c), TOBN(0xe1ab51eb, 0xac25b98e),
+	TOBN(0x22e537a3, 0x6626a5e1), TOBN(0x78292b40, 0x8e30a69b),
+    },
+    {
+	TOBN(0xe82980dd, 0xd6ac06a9), TOBN(0xf22df5fa, 0x818cbaef),
+	TOBN(0x3e8d3fba, 0x2ce73b19), TOBN(0x8f4298ac, 0xa67a127a),
+	TOBN(0xc8bcb7ce, 0x4e5f80ad), TOBN(0x0703fc0a, 0xf4852a16),
+	TOBN(0x9d56ced2, 0xef78d249), TOBN(0x2f1ed5df, 0xc75fc168),
+	TOBN(0x231ee95a, 0xc806b85a), TOBN(0x11bed6fb, 0x0db1c158),
+	TOBN(0x8be30348, 0x722d14a9), TOBN(0xfde225e1, 0xb60ddc72),
+	TOBN(0xec15d463, 0x147cd5fc), TOBN(0x41be68c3, 0xbac8e38f),
+	TOBN(0x1d1acd8d, 0x4dfb5214), TOBN(0x6f1b29c5, 0xa73fc7c5),
+	TOBN(0xa0bd400c, 0xf235768d), TOBN(0x0fbf7e4f, 0x2f78d007),
+	TOBN(0xe6735ff1, 0xd0a85c9d), TOBN(0x3871c7e3, 0x963e2c07),
+	TOBN(0x62226305, 0xd7f598ba), TOBN(0x07a0482c, 0x2b3e9135),
+	TOBN(0x91ead2f3, 0x318d827f), TOBN(0x81981566, 0x68129dcb),
+	TOBN(0xbdce60f8, 0x198dfe8e), TOBN(0xb520a57c, 0xa1469477),
+	TOBN(0xfe11f668, 0x6e0f7ea0), TOBN(0x084b2027, 0x05a1d3c4),
+	TOBN(0x7100d84f, 0xc81d4621), TOBN(0xcf67f765, 0x5ba88d87),
+	TOBN(0x98e0d30e, 0xeaae2866), TOBN(0xe94d4081, 0xcd2fdf7f),
+	TOBN(0xe815a0d5, 0xc7002c1d), TOBN(0x33bd1d86, 0x4540bbbd),
+	TOBN(0x69e170e0, 0x268f705e), TOBN(0xcece0456, 0xd0e28c5e),
+	TOBN(0x6981de35, 0x97cc8fa8), TOBN(0xbdeaa396, 0xf0ad1c65),
+	TOBN(0xd46c1509, 0x3d0deac0), TOBN(0xb0002f7d, 0xdb6f1fe6),
+	TOBN(0xadfea465, 0xf29aaeaf), TOBN(0xbe31ca8a, 0x52744f9a),
+	TOBN(0x48c34e56, 0x162df793), TOBN(0x9b225a9f, 0xbdc94ead),
+	TOBN(0x8a86c065, 0x998e40d3), TOBN(0xe0b74ee7, 0x0d686ffe),
+	TOBN(0xa3542db2, 0x8727a849), TOBN(0xe123efb0, 0x02e7dcc6),
+    },
+    {
+	TOBN(0x627f262b, 0x5baad8d4), TOBN(0x093da943, 0xe183bd48),
+	TOBN(0x2f18e1f0, 0xbfef8d52), TOBN(0x784ad676, 0x345abfb3),
+	TOBN(0x955e1dc8, 0xcf41b2b7), TOBN(0x7d2dfdce, 0xdaa4ce21),
+	TOBN(0x0981e6fe, 0xfe169489), TOBN(0x6b07ac50, 0x61ef0512),
+	TOBN(0x2f376b05, 0xd21f7b32), TOBN(0xeb6dcd0c, 0x25336f2e),
+	TOBN(0xdc8ebe85, 0x4b3f8750), TOBN(0x4add6894, 0x91388cc2),
+	TOBN(0xb1ad9bd4, 0x8b1c36d4), TOBN(0x846fc742, 0x092fac40),
+	TOBN(0x2461e8d2, 0xa8b6fc99), TOBN(0x43174b75, 0xe2d40e7d),
+	TOBN(0x45f8c6bb, 0xacdfd8d1), TOBN(0x10060fdc, 0x2352bbfb),
+	TOBN(0x22ec52a3, 0x9cc78f3e), TOBN(0xd3623331, 0x6a320da1),
+	TOBN(0x30740ac8, 0xac2ec0cf), TOBN(0xa7c77e4e, 0x37338ced),
+	TOBN(0xbc06ef65, 0x669aa64e), TOBN(0xf24660fd, 0xf8f9c0ad),
+	TOBN(0x7042560f, 0x7d5b2c3f), TOBN(0x952fe410, 0x2211297c),
+	TOBN(0x3af3c01b, 0xe8d3e64d), TOBN(0x7cbc8c62, 0xf857255e),
+	TOBN(0x4c7c700b, 0xb9351c69), TOBN(0xe10a901b, 0xde621cac),
+	TOBN(0x6e2ed900, 0x0ca91e92), TOBN(0x992a1bca, 0xb7193c4a),
+	TOBN(0xf353c7c5, 0x8679179f), TOBN(0xee5a00ea, 0x4691d386),
+	TOBN(0xfec5ee9c, 0x0c8075a0), TOBN(0xeaff82db, 0xcb9ca47d),
+	TOBN(0x518e9cd6, 0xd9ff8ef8), TOBN(0x1699719e, 0x0b34efa1),
+	TOBN(0x9ad791ad, 0x3e3a4a54), TOBN(0x797ceb01, 0xccdc1fe7),
+	TOBN(0x92711513, 0x1cf63342), TOBN(0x7c818466, 0x22d4b091),
+	TOBN(0x6f6898cf, 0x8b9da5eb), TOBN(0x9d42656c, 0x9d2a0685),
+	TOBN(0x9389b488, 0xea7e947a), TOBN(0xf7a569e9, 0xc3b3c7d5),
+	TOBN(0x9308f855, 0xb78e5da8), TOBN(0xfe725e72, 0xb521bfca),
+    },
+    {
+	TOBN(0xaced8ba9, 0x915f2079), TOBN(0xf1dd8c8b, 0x2835cb36),
+	TOBN(0x62b7415d, 0x24ec34c3), TOBN(0x01e20a7b, 0xdf4352e9),
+	TOBN(0x959c2aab, 0x058bde6f), TOBN(0x90cdd7ed, 0xfdafc870),
+	TOBN(0xc9876ab8, 0xc088e601), TOBN(0xadf3131e, 0x2437a63d),
+	TOBN(0x5f16ca7c, 0x697a0cd8), TOBN(0x5145a27b, 0x6d517743),
+	TOBN(0xab38287a, 0xb913d3a1), TOBN(0x2d34e9af, 0x6b7a53e0),
+	TOBN(0xd0c8fef8, 0x2095dd88), TOBN(0x91f9cb4a, 0x44f3474b),
+	TOBN(0xfa8cc254, 0xe06fb200), TOBN(0x59914505, 0xd35121a6),
+	TOBN(0xdce1c7c6, 0xf4ce2a02), TOBN(0x3fcbc1e2, 0x6fa08f6b),
+	TOBN(0x1a5e1179, 0xe457057c), TOBN(0x3a68a359, 0xbd314c99),
+	TOBN(0xd03555e6, 0x3eb7cccf), TOBN(0x2d170b21, 0xecef11f3),
+	TOBN(0xd51e6d49, 0x0ff49a24), TOBN(0x8ae17819, 0x85d0c09e),
+	TOBN(0xd5199da2, 0x3eac3c22), TOBN(0x4a119c51, 0x3e3849c8),
+	TOBN(0xdf14c819, 0xb0be696d), TOBN(0x6d04fe5b, 0x4796a788),
+	TOBN(0xb7b4dbfd, 0x60f8130a), TOBN(0xe8137790, 0xd97c4f07),
+	TOBN(0xd73dc0db, 0xf6d76639), TOBN(0x6c5ff945, 0x6ec280fb),
+	TOBN(0x6b0f52c4, 0xd896c5ca), TOBN(0x1474b1e6, 0xbb6ee4d0),
+	TOBN(0xa48ea19e, 0x270788a7), TOBN(0x08c03999, 0x35a4f8c6),
+	TOBN(0x28e61cb9, 0xf53ee50f), TOBN(0x4aa286ae, 0x95d1abdf),
+	TOBN(0xe1fc704c, 0x1cd7adb2), TOBN(0xbdcef9b8, 0x1752b0f9),
+	TOBN(0xc2843cba, 0xbdfa0061), TOBN(0xf6374aa3, 0x3feab4d6),
+	TOBN(0xb6976e0b, 0xbcb0a23c), TOBN(0x7a6bfdad, 0xaa692ce6),
+	TOBN(0xc226c73f, 0x7775dd9b), TOBN(0x647135ae, 0x2d145105),
+	TOBN(0xf351dca5, 0x9b58812d), TOBN(0xc90bbd90, 0x9f562529),
+    },
+    {
+	TOBN(0x54a21cd2, 0xe00c898a), TOBN(0x34f8cf72, 0x17d6259b),
+	TOBN(0x1fcee1a9, 0xb1751d88), TOBN(0xe6aa9425, 0x3e846f64),
+	TOBN(0x3fd435ea, 0xab4f9cd0), TOBN(0xefeb5ed3, 0x6a8be1ca),
+	TOBN(0xb0c54dd7, 0x817cf994), TOBN(0x0d3d1d89, 0x916867e8),
+	TOBN(0x379eb10b, 0x80b75460), TOBN(0xba0d07a4, 0x8bace29b),
+	TOBN(0xad5dd30f, 0x41b4412f), TOBN(0x9b036744, 0x895a0b0e),
+	TOBN(0xe796ccf0, 0x89def172), TOBN(0x4371168f, 0xc24bd410),
+	TOBN(0xb374a19c, 0xbc24d339), TOBN(0xbe1a6e14, 0x0a1cbe47),
+	TOBN(0xf2aecb18, 0x7cc4fec9), TOBN(0xc3d4bd54, 0xc0b65f63),
+	TOBN(0xde268a35, 0x6384363a), TOBN(0x9db5c43f, 0x2d27131b),
+	TOBN(0xf0aeb6b1, 0x69c79936), TOBN(0x7e40be27, 0x776726fb),
+	TOBN(0xffa2614c, 0xf2f3d795), TOBN(0xdee2bfc7, 0xf5ecf4ed),
+	TOBN(0xc26a7f68, 0xf073b0e7), TOBN(0xfee617f5, 0x1d3e7486),
+	TOBN(0x834e4608, 0xa845fd9e), TOBN(0x2f79b550, 0x737e1058),
+	TOBN(0xaf853c9b, 0xbf0e4f50), TOBN(0x74891f23, 0x3e56afd7),
+	TOBN(0xf8c12184, 0xff28b644), TOBN(0x5edd2804, 0x07fe3cc7),
+	TOBN(0x031a988d, 0x33dc005f), TOBN(0x5b7d3be5, 0xa1b6c1ae),
+	TOBN(0xb7987239, 0x4c22b99d), TOBN(0xeb156a0e, 0x53cd2223),
+	TOBN(0xf3c6bff2, 0xda584b25), TOBN(0x8a854a86, 0x6d29966e),
+	TOBN(0xc295165b, 0xfa77c64f), TOBN(0xd8b56435, 0x613866c6),
+	TOBN(0x154fcfaa, 0x193c3595), TOBN(0xe0722444, 0xe1b7062a),
+	TOBN(0xd439b42e, 0x01a42ac2), TOBN(0x62dfd195, 0xe910c96e),
+	TOBN(0xdc540ae9, 0x4b760405), TOBN(0xa12aa929, 0x216ef27d),
+	TOBN(0xe3b7def3, 0x6a5e376d), TOBN(0x1064cb25, 0x379bd429),
+    },
+    {
+	TOBN(0x8c60d226, 0xf7a40822), TOBN(0xc4cd27f5, 0x8fd21302),
+	TOBN(0x4e18ad84, 0xc58afad7), TOBN(0x668f2cd2, 0x8d26ac41),
+	TOBN(0xa6a05fd8, 0x1ed49b04), TOBN(0xfdf2af36, 0x1acaa332),
+	TOBN(0x8e8ef869, 0xfb6967a5), TOBN(0xe05f0c08, 0x3e405ab8),
+	TOBN(0x07a6f77c, 0xd7d7828e), TOBN(0xa20f03e8, 0x7a324d41),
+	TOBN(0x08c3c816, 0xc04bb965), TOBN(0x81a56103, 0xe44d2c3a),
+	TOBN(0x90178011, 0xc334500b), TOBN(0x859167d3, 0x61ad581f),
+	TOBN(0x1005fb9a, 0x8be189d5), TOBN(0x02eb128a, 0x7d22a686),
+	TOBN(0xdf700dc8, 0x282d3bbe), TOBN(0x24d90220, 0x90bdf75b),
+	TOBN(0x048123b4, 0x0a5c6330), TOBN(0x1c2756fd, 0xd52f28a6),
+	TOBN(0x7aa4f419, 0xdd847a04), TOBN(0xa65d24ad, 0xdf12e6d2),
+	TOBN(0x554db797, 0x4f8e132f), TOBN(0x6c452384, 0x613ba18c),
+	TOBN(0xa2eaa3f5, 0xf77cf230), TOBN(0x165a1d2d, 0xdd50ccf3),
+	TOBN(0xa147d614, 0x39fa59cf), TOBN(0x016191eb, 0xab0f251f),
+	TOBN(0x919dd4ff, 0x206eb36a), TOBN(0xc87c8e3f, 0x1b125a52),
+	TOBN(0x8fe29b22, 0x04f9cf4d), TOBN(0x0f854d1a, 0xc5857a38),
+	TOBN(0x3ae58adf, 0x165d4b81), TOBN(0x3e40c3b1, 0xd63f7835),
+	TOBN(0xb7c6d1b7, 0x1d959a52), TOBN(0x23bfa3da, 0x0e6d03f0),
+	TOBN(0xf05ffff9, 0x9837cc25), TOBN(0x50cf1d01, 0x33dd7f1a),
+	TOBN(0x5821650c, 0x6a68de2c), TOBN(0x8b1156da, 0x54cab714),
+	TOBN(0x81e9ab6c, 0xa46deb2a), TOBN(0x561829e8, 0x6885c329),
+	TOBN(0x7e0f2bff, 0xa5a15553), TOBN(0x6e792820, 0x708765f0),
+	TOBN(0x211ad427, 0x5b721e1b), TOBN(0x1a3726ac, 0x0f26540f),
+	TOBN(0x1bf30e2d, 0x2fe67fbc), TOBN(0xeba9bfcc, 0x781860de),
+    },
+    {
+	TOBN(0x7d87ff42, 0x65904b5e), TOBN(0x121916b1, 0xde2bdd2f),
+	TOBN(0xc195bac7, 0x14787f2c), TOBN(0x8b34e884, 0x6b986210),
+	TOBN(0x08c5bc7d, 0x618bb50f), TOBN(0x79eaf82d, 0x1e4597bf),
+	TOBN(0xaff2fef1, 0x45a55dc8), TOBN(0xf5655189, 0xdcea1ebd),
+	TOBN(0xb670aa1d, 0xc1047834), TOBN(0xd5048951, 0x8cd0a0eb),
+	TOBN(0x1f17f993, 0xb5299760), TOBN(0x7269afd3, 0xc54a8d33),
+	TOBN(0xd94c5eb8, 0xa62f0527), TOBN(0x0b025a12, 0x65247da3),
+	TOBN(0x44702bed, 0x61f27f3e), TOBN(0xaf792a3e, 0x7d7c9ab0),
+	TOBN(0xde6c5832, 0x533867f4), TOBN(0x3f4f7fa5, 0xb6681814),
+	TOBN(0x55c757a4, 0x9b7c5332), TOBN(0xd49d6176, 0xb05aff4d),
+	TOBN(0x646b519e, 0x913af8ce), TOBN(0x8de2492c, 0x6f6881b0),
+	TOBN(0xfdda63ff, 0x7fafede8), TOBN(0x9c429562, 0xaaae3204),
+	TOBN(0x7a597cb6, 0xfa1cd7b7), TOBN(0xb75ce277, 0x5caf5610),
+	TOBN(0x4e7e03aa, 0x1f613a8a), TOBN(0xebb5b7fe, 0xb88ab864),
+	TOBN(0x15e5c1fb, 0x9939df8a), TOBN(0xe16d31e3, 0xd043266f),
+	TOBN(0xf8de63af, 0x44bd8254), TOBN(0x7f8b94da, 0xda4f8bab),
+	TOBN(0x1eb2e38e, 0xaf838cfd), TOBN(0xa369d231, 0xb4542cfd),
+	TOBN(0x8c0c6d5a, 0x0cacc301), TOBN(0xc2905e6b, 0x630744e5),
+	TOBN(0xaefa7ce8, 0xced0db5a), TOBN(0xcb15c978, 0xf4fd0c19),
+	TOBN(0xf4d606c1, 0x5be9f341), TOBN(0x087210be, 0x3f868f67),
+	TOBN(0xa30e3b2c, 0x9253e79a), TOBN(0xc144730a, 0x0b40edf5),
+	TOBN(0x4da45bd3, 0xc6c81afe), TOBN(0x8d847333, 0x77b8190a),
+	TOBN(0xf9972ba0, 0x186acfc2), TOBN(0xe44241d9, 0x023aa88f),
+	TOBN(0x7ed05a09, 0xf31c3663), TOBN(0xa0bb6ecf, 0x20fa619f),
+    },
+    {
+	TOBN(0xc6b24115, 0xcff3e04d), TOBN(0xa376aac3, 0xfbdcf9ad),
+	TOBN(0x9a57534a, 0xc4478892), TOBN(0xeed1433c, 0xbd89f467),
+	TOBN(0xad7a4aea, 0x87c4000d), TOBN(0x457eaa04, 0x286140eb),
+	TOBN(0x2d6918cd, 0x5efc9ab8), TOBN(0xc0f6d423, 0xc363375e),
+	TOBN(0x88570b8e, 0x79237ec1), TOBN(0xb204dd04, 0xa926559b),
+	TOBN(0xaabffd47, 0x954e66e7), TOBN(0xe6b0a82f, 0xce6ce0ad),
+	TOBN(0x67d48f65, 0x31bdc7db), TOBN(0xd0980e0b, 0xf1e53c61),
+	TOBN(0xd078253b, 0x17f24c3d), TOBN(0x692803e0, 0xc45498da),
+	TOBN(0xeba324a0, 0x6559184d), TOBN(0x589279aa, 0xdd81a0fb),
+	TOBN(0x29e03288, 0x36e5df0f), TOBN(0x0cd474b2, 0xcd96d0c3),
+	TOBN(0x25da8d41, 0xbd299681), TOBN(0xdd50d8bd, 0x3309e6c6),
+	TOBN(0xa1e45037, 0xf0b23344), TOBN(0xd533a4b3, 0xa7b35a53),
+	TOBN(0x32d5d761, 0x1f9abbb1), TOBN(0x64e17995, 0x4c8d42f6),
+	TOBN(0xd98f6666, 0x30e7bada), TOBN(0x72c13cb4, 0x5abb54e1),
+	TOBN(0xf87a68ef, 0x9a923aee), TOBN(0x58999ed1, 0x0c0ccaab),
+	TOBN(0x52347edb, 0xb59c9c69), TOBN(0x8074358c, 0x56fc5787),
+	TOBN(0x1366d076, 0xd6c0175c), TOBN(0x8084bf68, 0x64565756),
+	TOBN(0x9f34bf74, 0xd6ef9b30), TOBN(0x01f760eb, 0x0d80f001),
+	TOBN(0x07cf7c6d, 0x032690b0), TOBN(0x5221472c, 0xb7d2d050),
+	TOBN(0xe5d57cb7, 0x3906aac2), TOBN(0x92f3d3bf, 0x396a8caa),
+	TOBN(0xae45f1da, 0x9efc0baa), TOBN(0x6a2ba6dd, 0xfa5d1a5f),
+	TOBN(0x5c8c0dbc, 0xfd2bd6bd), TOBN(0x0fdeddf2, 0x83ea00df),
+	TOBN(0xf2a29afd, 0x0fe128c3), TOBN(0x567d0add, 0xfb8571a3),
+	TOBN(0xb590d5fc, 0x45fd73eb), TOBN(0xdb99e36b, 0x5c7f02b9),
+    },
+    {
+	TOBN(0xadc56277, 0x406fc8e2), TOBN(0x2fbe5554, 0x59ea83e1),
+	TOBN(0x26781be5, 0x6cc9b5ce), TOBN(0x8adc2cce, 0x024328e5),
+	TOBN(0x303a9e04, 0x3060e314), TOBN(0x36716d17, 0x2f00f42e),
+	TOBN(0x0b7282b9, 0xd5e5e86a), TOBN(0xe097c84a, 0x85e82705),
+	TOBN(0xb49a37a9, 0xcf483f6e), TOBN(0x7eb9e50e, 0x8bfe258b),
+	TOBN(0x70317a68, 0x2a8942db), TOBN(0x4a530c4f, 0x851f1cf6),
+	TOBN(0x5ef75f23, 0x9169662a), TOBN(0x61875ba9, 0xf7d79fdc),
+	TOBN(0xeefaf313, 0x71e2db4f), TOBN(0x7f7918e3, 0xa0a2d76f),
+	TOBN(0x8ed9b061, 0xe8cbf339), TOBN(0x5032b14b, 0x48e18772),
+	TOBN(0xfaedf5da, 0x348557e7), TOBN(0xfcab43cf, 0xfea90b19),
+	TOBN(0x2a23950a, 0x61cd97a5), TOBN(0x691f975c, 0x17082697),
+	TOBN(0x379e6557, 0x15c04f84), TOBN(0x5baf409b, 0xf94cb80a),
+	TOBN(0x9c2774cf, 0xc47adb8d), TOBN(0x09b778f1, 0x3c430fce),
+	TOBN(0x3625c265, 0x0d0e83fe), TOBN(0x3f4fe264, 0x632acbcd),
+	TOBN(0x06586fd2, 0xed6a4d8d), TOBN(0xec8f9fd0, 0x105e3f0d),
+	TOBN(0xab55ecb4, 0xa5c449c7), TOBN(0x976cbced, 0x6625df7a),
+	TOBN(0xff06e479, 0xd508604c), TOBN(0x8c3e9cad, 0x9afa5a20),
+	TOBN(0x93db1e71, 0x1d8705a8), TOBN(0x0c1f09eb, 0x8925a37b),
+	TOBN(0xe6427f52, 0xa90c959e), TOBN(0xde0c55f6, 0xc4ddd228),
+	TOBN(0x701ce9e5, 0xc64f1b55), TOBN(0xc143bd01, 0xa52826cb),
+	TOBN(0xa06e7db8, 0x0d5e8c79), TOBN(0x58ce58e3, 0x62931191),
+	TOBN(0x8fdb39dc, 0xacf5d4ec), TOBN(0x534eb30f, 0x965a06d6),
+	TOBN(0xf723579e, 0x81e97512), TOBN(0xb850ed11, 0x0eda0e7b),
+	TOBN(0x2073f452, 0xc9dfa72c), TOBN(0x9a29632b, 0x4805c5df),
+    },
+    {
+	TOBN(0xed6c2968, 0xabcc9ce9), TOBN(0xca71f77a, 0xb290d6a8),
+	TOBN(0x2f5350ca, 0xa7a27059), TOBN(0x4cf574ad, 0x8ed3b7a8),
+	TOBN(0x6e434be3, 0x801de86e), TOBN(0x7204db33, 0xc4884e96),
+	TOBN(0x47a6216f, 0x975473d2), TOBN(0xa80d4a61, 0x8edabaca),
+	TOBN(0xb97052fd, 0xf27f75fc), TOBN(0x5ea67c2d, 0x8aa65406),
+	TOBN(0x77baac4f, 0xf497c161), TOBN(0xbf670839, 0x291577ae),
+	TOBN(0xd7920e2f, 0x4b4aed0d), TOBN(0x1f45886b, 0xcd835b03),
+	TOBN(0xe7b98465, 0x69c71a96), TOBN(0x615fbb79, 0xf602d311),
+	TOBN(0x05b10087, 0x567fb915), TOBN(0xf6c9948f, 0xfca08716),
+	TOBN(0x176b44fa, 0x7974751d), TOBN(0x28145524, 0x65521422),
+	TOBN(0xaccfbbc2, 0x8a4c7a13), TOBN(0xf12d13fd, 0x1b23518e),
+	TOBN(0x51cc9a51, 0xc35436e6), TOBN(0xaabece56, 0x91f465c5),
+	TOBN(0x1bcc9436, 0x0c45d929), TOBN(0xd811ac44, 0x0ae91801),
+	TOBN(0xae3f48d7, 0x5420f019), TOBN(0xd730599a, 0xc65e7251),
+	TOBN(0x4b162fb4, 0xf12c913b), TOBN(0xe14c8a1e, 0xc22ed19a),
+	TOBN(0x7ad33fed, 0x34a1fe6e), TOBN(0x378234dd, 0x73791ce9),
+	TOBN(0x53b8929d, 0xd9569c1a), TOBN(0x40cc7001, 0x6421b718),
+	TOBN(0xbba525a4, 0xad4bd94a), TOBN(0xaca317ef, 0x5323afc4),
+	TOBN(0x380404a6, 0x51dba6e4), TOBN(0x28c7f910, 0xb0a0511b),
+	TOBN(0x48986572, 0x2cea50f5), TOBN(0xac12f3bc, 0x9c399df4),
+	TOBN(0x833f2adc, 0x36d94c84), TOBN(0xef4a5e19, 0x667df68f),
+	TOBN(0x3a405cc6, 0xd30ecc3f), TOBN(0x1c82dc93, 0xd52a5e1b),
+	TOBN(0xc4916aec, 0xadb1054b), TOBN(0x20b325cc, 0xbd9ad121),
+	TOBN(0xae59f15c, 0xd1d30f99), TOBN(0x7d993ab6, 0x80bb1898),
+    },
+    {
+	TOBN(0x80900567, 0x8ded0eb3), TOBN(0xa2396fa4, 0x2413ef57),
+	TOBN(0x99e285c1, 0x7230716a), TOBN(0x0a474882, 0x789dd984),
+	TOBN(0x38081567, 0x4bb75e65), TOBN(0xb1d3df32, 0x6e703966),
+	TOBN(0x2114e86f, 0xe66e681e), TOBN(0xcbd1e2ee, 0x90f090f8),
+	TOBN(0xde642a88, 0xc94f9998), TOBN(0x4c198b25, 0x53c55c1f),
+	TOBN(0x15037595, 0x10bd8aac), TOBN(0xe795cd66, 0xbbde9d64),
+	TOBN(0x22371292, 0x54cbcb64), TOBN(0xc588e1a7, 0x14048088),
+	TOBN(0xe8b22ec7, 0xcf4e30cc), TOBN(0xb748b055, 0x7860b671),
+	TOBN(0xb8ecd583, 0x5e9a342f), TOBN(0xff7a8d7b, 0x235d4c2b),
+	TOBN(0x44e2fe62, 0x230de5b4), TOBN(0xd9da8851, 0x7e944499),
+	TOBN(0x4f87b66d, 0x76855afb), TOBN(0x85d1333b, 0x54f5ddc4),
+	TOBN(0xb515cbd3, 0xc4d1a915), TOBN(0xf4285bad, 0x988a83af),
+	TOBN(0xc046f789, 0xbc3a4948), TOBN(0x429d1e05, 0xf046547f),
+	TOBN(0xb5b28838, 0xdfc4110e), TOBN(0x9f5edd9a, 0xffdf4c50),
+	TOBN(0xd8e7d91b, 0xeaafbb2e), TOBN(0x363f6583, 0xfbc3a250),
+	TOBN(0x83ad94ee, 0x034fa33d), TOBN(0x623942a6, 0x7dcb6ee3),
+	TOBN(0xa8bf3d3c, 0x175aa7e4), TOBN(0x445864e0, 0xeb0727f5),
+	TOBN(0x59448545, 0x9da1b2b6), TOBN(0x41537b79, 0x4ae62c24),
+	TOBN(0xbbb1799b, 0x8c05874e), TOBN(0xc2add381, 0xf95baf92),
+	TOBN(0xbf867957, 0xaba57de5), TOBN(0x877ecf0f, 0xb9295a70),
+	TOBN(0x1ba458f5, 0x0af84406), TOBN(0xdd87a516, 0x9b72eef3),
+	TOBN(0xca5c9716, 0xda162698), TOBN(0x00f1d055, 0xaec52885),
+	TOBN(0xf0d43ffc, 0x8b0a0e42), TOBN(0xee913d34, 0x3370771e),
+	TOBN(0xfa49bfbd, 0x6afa9a44), TOBN(0xc7208270, 0xfc5fdbb4),
+    },
+    {
+	TOBN(0xf8b31fe1, 0x9d5e2d85), TOBN(0x3f7021d3, 0x278d87ce),
+	TOBN(0x1f5bd412, 0x9cd91f05), TOBN(0xe27d9562, 0xb5fab9fe),
+	TOBN(0x2c102dad, 0xc16bd618), TOBN(0x3d200dec, 0xc3f21615),
+	TOBN(0xee3f3a70, 0x4b008c10), TOBN(0x32ec9abd, 0xefe40d46),
+	TOBN(0x1063400a, 0x40ff315e), TOBN(0xe7c85d58, 0xe1e1a784),
+	TOBN(0xb1ea71ac, 0x7ebc55f3), TOBN(0xb4821d77, 0x740f5ca4),
+	TOBN(0x81ab78ec, 0xe08824f4), TOBN(0x949539ae, 0x71112df6),
+	TOBN(0x3445d450, 0xa482ba09), TOBN(0x0b71c30d, 0x71ca6f20),
+	TOBN(0xff787279, 0xf189e80a), TOBN(0xc8c3930e, 0x815fb11c),
+	TOBN(0x0df2cd58, 0x0397b754), TOBN(0x22b4ef36, 0x283e7136),
+	TOBN(0x8bf0a722, 0x57819ca6), TOBN(0x6afbfb75, 0x37615eaa),
+	TOBN(0x69753b48, 0x0be4d44c), TOBN(0x6f65e278, 0x60161e95),
+	TOBN(0x95e0320e, 0xed5a19d9), TOBN(0xcd75088e, 0xcb9fd680),
+	TOBN(0x5096026a, 0xf837e491), TOBN(0x01fe8b52, 0x50f0fd73),
+	TOBN(0x651e969f, 0xbe3660ae), TOBN(0x15a6b330, 0x495bc023),
+	TOBN(0x072e9e0d, 0x0f66d244), TOBN(0x45270556, 0xfc1084b2),
+	TOBN(0xf74f52bf, 0xe3338c60), TOBN(0x4833229e, 0x415717fd),
+	TOBN(0x0496bc36, 0x02afde94), TOBN(0x08e0acff, 0x8ab00e22),
+	TOBN(0xa266d75f, 0x850e74e8), TOBN(0xb882dc0f, 0x4586d2ef),
+	TOBN(0x062a56cf, 0x12fe3153), TOBN(0x2d5f73f3, 0x70197314),
+	TOBN(0x2330c266, 0x8330d318), TOBN(0xb6ac8121, 0x02fb82c9),
+	TOBN(0x304080ae, 0xd4ddf579), TOBN(0x1dc5545a, 0x916203ee),
+	TOBN(0x12c1bfc1, 0x80460702), TOBN(0xa9037eed, 0x8003026e),
+	TOBN(0xb02a388a, 0x2c553133), TOBN(0x5730b1c2, 0x29cb3378),
+    },
+    {
+	TOBN(0xf6ff46f1, 0x62c1c289), TOBN(0xa8b19b4d, 0xa7409d38),
+	TOBN(0x4aa0e94d, 0x38b0fcf5), TOBN(0x8f449017, 0x008cb0d7),
+	TOBN(0xf975b4c5, 0x57240b3b), TOBN(0x1bf0fcd0, 0xfff3071c),
+	TOBN(0x667f8fb6, 0xa0f0149e), TOBN(0x2cd0f0ea, 0x3001ebf7),
+	TOBN(0x21d9f253, 0x785b1e89), TOBN(0x18f5be9c, 0xaa0e9d0a),
+	TOBN(0x0ae0814f, 0xa888f444), TOBN(0xc5052629, 0x67961d31),
+	TOBN(0xeeae88d0, 0x07e381b1), TOBN(0x398e3f5d, 0x6a397350),
+	TOBN(0x22798f8a, 0xbc5e48ee), TOBN(0xdb7ec6bd, 0xd73e1c47),
+	TOBN(0xd544539e, 0x66f377e4), TOBN(0xd0323133, 0x0ba3e57d),
+	TOBN(0xdbc0279b, 0xc08a07b8), TOBN(0x7f4b9de7, 0x57837245),
+	TOBN(0x20dc739c, 0x702dd94b), TOBN(0x32056104, 0x42174f9c),
+	TOBN(0x97a603a6, 0x06115cbf), TOBN(0xdfb5436f, 0x2729c80d),
+	TOBN(0x2c3d87a1, 0x77c8d176), TOBN(0xec901878, 0x60865195),
+	TOBN(0xfefec67c, 0x3355b621), TOBN(0x9c0abfff, 0x5aa63941),
+	TOBN(0x2815d14e, 0x8b07b4e6), TOBN(0x03fe0f75, 0x94b4f46c),
+	TOBN(0x06fe20b4, 0x51a72908), TOBN(0x12e10194, 0x3f44b901),
+	TOBN(0x7a3e4ace, 0x98598be1), TOBN(0x20df5932, 0xcb6c2309),
+	TOBN(0x9fe1894a, 0x8ba92c3e), TOBN(0x21d6b044, 0x070517d4),
+	TOBN(0x8fddcd6a, 0x6d896744), TOBN(0x01595715, 0xb4323e23),
+	TOBN(0xcb0357fe, 0x603124e6), TOBN(0xfe128d8b, 0xf9fc47f2),
+	TOBN(0xc18c6ac7, 0x6d1c9c97), TOBN(0x2d83d0d5, 0x4a93808b),
+	TOBN(0x1e8798a3, 0x59ab7b0d), TOBN(0x70abc9b5, 0x6ff6aefd),
+	TOBN(0x23412710, 0x743807a5), TOBN(0xfb097aab, 0x9c393137),
+	TOBN(0x46801fdb, 0x5f8bb64a), TOBN(0x45903240, 0x3c1c6cab),
+    },
+    {
+	TOBN(0xcd2ab810, 0xe5f87bbf), TOBN(0x4bd13b0b, 0x236cb5ab),
+	TOBN(0xc5c23acb, 0x66c52681), TOBN(0x8b0ab0c3, 0xca56e211),
+	TOBN(0xdc9d20a0, 0x231df5d8), TOBN(0x922263de, 0xa0fd15b6),
+	TOBN(0xb7f6c636, 0x0589594a), TOBN(0x4e47b7f1, 0x242da3ab),
+	TOBN(0x1ed09e9c, 0x4ac19847), TOBN(0x7405a328, 0xb20b22ac),
+	TOBN(0x5a3aadf6, 0x89f6eaf2), TOBN(0x6bd7a9e1, 0x2e019199),
+	TOBN(0xef60c8ec, 0x0c7f695c), TOBN(0x3fb9b515, 0x98576bad),
+	TOBN(0x24059025, 0x017f39e5), TOBN(0x16b0fd15, 0x4e4d9669),
+	TOBN(0xee9d0408, 0x35bcdd49), TOBN(0x4ae06f92, 0x6c343e56),
+	TOBN(0xa2915d9e, 0x26bfcecb), TOBN(0x99e3960f, 0xfdc8b065),
+	TOBN(0xcce8f6b8, 0x509d1f77), TOBN(0xdc30c6dd, 0xf6826fec),
+	TOBN(0x142a0271, 0xdbbd24f3), TOBN(0xee051eca, 0xf8446225),
+	TOBN(0xdef4c7e4, 0x236f2e31), TOBN(0xee118309, 0x45520488),
+	TOBN(0xce6945a2, 0xdaba0d38), TOBN(0xb3ce550d, 0x4e2b253d),
+	TOBN(0xcc8df90d, 0x1356b87f), TOBN(0xce2491da, 0xf09cd595),
+	TOBN(0x67931e7f, 0x5316a133), TOBN(0x45292258, 0x5a70673b),
+	TOBN(0x343fb391, 0x95e21a3a), TOBN(0x3d11a380, 0x4fcc957a),
+	TOBN(0x17e7a2b4, 0x064f7484), TOBN(0xeba63a62, 0x5787ea81),
+	TOBN(0x1ca99c6d, 0x7d906418), TOBN(0x29fcd114, 0xb8fa79a9),
+	TOBN(0x97c16e93, 0x6f2f0fef), TOBN(0xb9c495d8, 0x4b238f73),
+	TOBN(0x16ed1ec0, 0x203a45b8), TOBN(0x0d272b5d, 0xc350c687),
+	TOBN(0xe7277a45, 0x33d2af36), TOBN(0x58c99178, 0xdced6714),
+	TOBN(0x9f19b963, 0xb40c14bb), TOBN(0x99f1ed8c, 0xbeae344e),
+	TOBN(0x0c9f7238, 0x8fadb646), TOBN(0x1892b871, 0xfd9d449c),
+    },
+    {
+	TOBN(0xf57b02a5, 0x0da6e873), TOBN(0x613911c2, 0x9948fe67),
+	TOBN(0x9568607e, 0x3b90495d), TOBN(0x53e50b43, 0x703549b1),
+	TOBN(0x0b33f819, 0x4d2757d3), TOBN(0x06b4d77a, 0x0ac707d1),
+	TOBN(0x64068850, 0xe0d9df7b), TOBN(0xd0e770dd, 0xba5b75d4),
+	TOBN(0x2b9799fa, 0x532f3fe8), TOBN(0x9dd7e7e5, 0x74df56e5),
+	TOBN(0xbcc1af03, 0x2c551751), TOBN(0x8e0269e6, 0x51a7bc29),
+	TOBN(0x6f72cee4, 0x7b9566b5), TOBN(0xdc9bf3b0, 0x843382cd),
+	TOBN(0xa6b086b4, 0xf379952b), TOBN(0x7883368b, 0x45c76f19),
+	TOBN(0x93683ac8, 0xde2e6914), TOBN(0x346e7eac, 0x40a4ce6d),
+	TOBN(0xd06075d5, 0x8bb94d38), TOBN(0x224e53d3, 0x7eec4a63),
+	TOBN(0x60b63f63, 0xb8946bc6), TOBN(0xf2ab27fe, 0x6abb6e62),
+	TOBN(0x6fcaa0bd, 0x96c2945d), TOBN(0xf034b0d0, 0xabc52fa5),
+	TOBN(0x360b1588, 0x684543ee), TOBN(0x1cfed9ae, 0x3ad3bd8c),
+	TOBN(0x3bbfab47, 0x6f8e0e8f), TOBN(0x0f75e960, 0xa56854f1),
+	TOBN(0x4d1234d2, 0xe1a684fd), TOBN(0xcadaa84d, 0xedbdac0e),
+	TOBN(0x7d0292e2, 0x5f84d2d6), TOBN(0x77577d2a, 0x3a723f30),
+	TOBN(0x27d60633, 0x632a3d1a), TOBN(0x2f21d729, 0x48d7f51f),
+	TOBN(0x3d570f32, 0x4b0c72b3), TOBN(0xf294a53d, 0x4c33dba8),
+	TOBN(0x96b896c1, 0x8e30cdef), TOBN(0x3a791989, 0x57f4fefb),
+	TOBN(0x80131da0, 0x764f9fc5), TOBN(0x5a08374f, 0x012007da),
+	TOBN(0x10363699, 0xc62a855e), TOBN(0x5f0b3c76, 0x85e2348a),
+	TOBN(0x40d557f7, 0x59bae6cb), TOBN(0xe8b68972, 0x39eff3a5),
+	TOBN(0xd897e582, 0xd8aa3d3c), TOBN(0x17efdf3a, 0x9600d3a2),
+	TOBN(0x1ff78965, 0x0c46e1f2), TOBN(0x2be14b3e, 0x21454d69),
+    },
+    {
+	TOBN(0x7cb4490d, 0x1c219c8e), TOBN(0x3dd30daf, 0x7ef6c9cd),
+	TOBN(0x25b79ff5, 0xfe6ae69b), TOBN(0xabe1cedd, 0x8e351966),
+	TOBN(0xfc665a18, 0xd082d870), TOBN(0x82f87be1, 0x8f42494e),
+	TOBN(0x3fdd716f, 0xd44795b1), TOBN(0x751b403f, 0x4643fcde),
+	TOBN(0xf2fbb295, 0xb1fbc341), TOBN(0xae3b7e34, 0x9c8c1941),
+	TOBN(0x06761d38, 0x60480231), TOBN(0x050fb274, 0x0d9b3e9d),
+	TOBN(0x09b201d2, 0xb284e003), TOBN(0x9dc6a842, 0x5b3ca493),
+	TOBN(0x4ccab5cd, 0xaa5070a9), TOBN(0x05601978, 0x6eadbd75),
+	TOBN(0x79d93a4c, 0x01eaed55), TOBN(0xbb2429ad, 0xee443500),
+	TOBN(0xd0621343, 0x996f5f95), TOBN(0xae707754, 0xa692e5ac),
+	TOBN(0x8c8e5002, 0x8518e86d), TOBN(0x0a74eabd, 0x29233c08),
+	TOBN(0x360bf206, 0xa85e2630), TOBN(0x21a9531b, 0x0c354e7f),
+	TOBN(0xb3bc87a1, 0xd3038727), TOBN(0xa642357b, 0x5a86737f),
+	TOBN(0xba3d42bd, 0xf71a4792), TOBN(0x3d42634b, 0x0f59ebf3),
+	TOBN(0xa1a6b232, 0x8f5d4606), TOBN(0xe6dab2f6, 0x69a27bc3),
+	TOBN(0xd632ed5b, 0x3fab60c5), TOBN(0xb1c0ed40, 0x5d712953),
+	TOBN(0xb47c4a5d, 0x1affc865), TOBN(0x6d3c0990, 0xc3527f4d),
+	TOBN(0x329eff08, 0x06395a31), TOBN(0xc77ed03f, 0xf863ccd6),
+	TOBN(0x60f12705, 0xafdf232e), TOBN(0xefa9eaba, 0x5d96d8eb),
+	TOBN(0x1334262d, 0x58a683b5), TOBN(0xaf58bb55, 0x88a1f1dd),
+	TOBN(0x2797fa3c, 0x9cc02fe0), TOBN(0xb7664b09, 0x972ed66f),
+	TOBN(0xff6c2fe8, 0x456103b5), TOBN(0x6f2052da, 0x24d20d29),
+	TOBN(0xc920b67c, 0xde45d4ee), TOBN(0xdf642f12, 0xcb0ec796),
+	TOBN(0x74f5142b, 0xbf2fe3a4), TOBN(0x592d86b4, 0xf41b4b79),
+    },
+    {
+	TOBN(0xb8a529e7, 0x2f56554a), TOBN(0xeeabf6da, 0x5386d406),
+	TOBN(0xc63c75b9, 0x822998c6), TOBN(0xce38106d, 0x942b4c4b),
+	TOBN(0x538c8a58, 0x3d0edbd9), TOBN(0x13406956, 0x022225bd),
+	TOBN(0x333a585a, 0x7166e77f), TOBN(0x12cac283, 0x2b11f967),
+	TOBN(0xdb899ad7, 0xd7802d5d), TOBN(0xc2855d27, 0xffb6f008),
+	TOBN(0x103070dd, 0x41147731), TOBN(0xf5f9ddf5, 0x50503a6f),
+	TOBN(0x8a251b61, 0x13c20ead), TOBN(0x482a82d4, 0x25e88fd7),
+	TOBN(0x5c561fb6, 0x48d2ae24), TOBN(0xd07b0687, 0xd1492218),
+	TOBN(0x58d37ce7, 0xac434d93), TOBN(0x489df15a, 0x02df2c36),
+	TOBN(0xdd8e75e5, 0x74a5af20), TOBN(0xa5aabb58, 0xf101749c),
+	TOBN(0x677b4f93, 0xc9befcd5), TOBN(0xc4359f50, 0x5a15fdcc),
+	TOBN(0xad1decd5, 0x64d4cca0), TOBN(0xa0d52e0b, 0xd7e0e651),
+	TOBN(0x763e0094, 0x36af91ed), TOBN(0xedbc9f82, 0x8e0afc68),
+	TOBN(0x49ea12ac, 0xc46bdea4), TOBN(0xeb8ec5c7, 0x45f1a414),
+	TOBN(0xfe9e09ca, 0x20553159), TOBN(0x3c6fafd0, 0x2b72c8f5),
+	TOBN(0x56c6a539, 0x19da5cb3), TOBN(0x0f536854, 0x098f19fa),
+	TOBN(0x47ed77ad, 0x477c4748), TOBN(0x3450f60b, 0xebe1e964),
+	TOBN(0xef1328bf, 0x1b82f30b), TOBN(0x5389d719, 0x58f6ee36),
+	TOBN(0xb3a1ed65, 0xbd5a3e2a), TOBN(0x4c80fc04, 0x42e6fbfa),
+	TOBN(0xfd3152cc, 0x4a4a51ef), TOBN(0xd368a8b4, 0x515db7da),
+	TOBN(0x5e5522bd, 0x74dfedcc), TOBN(0x973808b2, 0xf908db19),
+	TOBN(0x47f99eb3, 0xefb73a02), TOBN(0x5ff7d4d0, 0x3fe34ca0),
+	TOBN(0xf419c66c, 0xa49c9100), TOBN(0x8d28359a, 0x0cd8aed4),
+	TOBN(0x99c05066, 0x5c30e532), TOBN(0x02f9a767, 0xa7566b42),
+    },
+    {
+	TOBN(0x5ebb7a00, 0xa17bf3f6), TOBN(0xaecb0317, 0x59428ec3),
+	TOBN(0x2449af95, 0x48c8a71b), TOBN(0x72afbf52, 0x2f3c89dc),
+	TOBN(0xb2a4d777, 0xdfa9d18f), TOBN(0x3b5856e1, 0xfdda6fd6),
+	TOBN(0x5097d2a9, 0xcd421b4d), TOBN(0xc8bb6949, 0x329b8bc4),
+	TOBN(0xa127ab4c, 0x93c0ebbf), TOBN(0xf2472be5, 0x6f687aaa),
+	TOBN(0xc1bf21dc, 0xd1eb3398), TOBN(0x93a0d8a9, 0x92f90c3f),
+	TOBN(0x9d04bdaf, 0xc21ca180), TOBN(0x026c8594, 0x6fc6394a),
+	TOBN(0x77b4db56, 0xdffa5fd9), TOBN(0x278fbd49, 0xd13ae84b),
+	TOBN(0xca9bd7cf, 0xf0268fe0), TOBN(0x8e1ea58f, 0x427e1a99),
+	TOBN(0x6a82a9dc, 0x13d5e0e2), TOBN(0xdbb2b9cb, 0x82c3a881),
+	TOBN(0xcd4628ea, 0xc1228188), TOBN(0x3f068ac0, 0x00e597ec),
+	TOBN(0xb394efd6, 0xc408151e), TOBN(0x75d0e2e0, 0x9da6d5c4),
+	TOBN(0x8a2fcb21, 0xa28938e0), TOBN(0x7671d7e2, 0x7640e825),
+	TOBN(0x99b27b97, 0x66a348f9), TOBN(0xa7b6da3f, 0xde6881e6),
+	TOBN(0x90dd34e3, 0xaa99c2b9), TOBN(0x8c518ed1, 0x7004d48d),
+	TOBN(0xc8ce5d42, 0x6a28c2cb), TOBN(0x4f7a56fb, 0xe3ab6683),
+	TOBN(0xe5e7cc2c, 0x5c805836), TOBN(0x7850a86b, 0xf418e9ce),
+	TOBN(0x10345258, 0x9a8c11af), TOBN(0x81a3c98e, 0x6c5c0fc8),
+	TOBN(0xcf726bbc, 0x4f0fc543), TOBN(0xc159672e, 0x23155ee2),
+	TOBN(0x499e4091, 0x3f721045), TOBN(0x56f7bbf2, 0xad9a5db4),
+	TOBN(0x70ec3513, 0x41a0fb64), TOBN(0x2f99a770, 0x70da01a2),
+	TOBN(0x2c4322d7, 0x563efd86), TOBN(0x508840cd, 0xe8ccc060),
+	TOBN(0xb5c3d7f6, 0x15aa0e9e), TOBN(0xb2016114, 0xe58f9c86),
+	TOBN(0x36de5edd, 0xbf0823a7), TOBN(0x34dd0cf1, 0x1f5fb15d),
+    },
+    {
+	TOBN(0xb622c351, 0xafad52cf), TOBN(0x8ed88ef6, 0x09ee1947),
+	TOBN(0xbb5a1348, 0x24078dd3), TOBN(0x541237c5, 0xb58fa47f),
+	TOBN(0x424ab8de, 0xed62f0dc), TOBN(0x68092de8, 0xfc11c7f0),
+	TOBN(0xf02e69b0, 0xbeb35c91), TOBN(0x90c413b4, 0x0c2d4cae),
+	TOBN(0xbe3d6273, 0x70c5ebe0), TOBN(0xf2180d94, 0x013d8236),
+	TOBN(0x9de3d52d, 0x47849f85), TOBN(0x3e0de771, 0x8ed265db),
+	TOBN(0xc3262993, 0xc22644ba), TOBN(0x8a3139df, 0xfac64a90),
+	TOBN(0x75e0937e, 0x0be00d56), TOBN(0x949fad19, 0xdf8c686e),
+	TOBN(0xe8760653, 0xd27c8ad4), TOBN(0x990bd9f8, 0xe0a216fa),
+	TOBN(0x2ed03504, 0x3cc47ea2), TOBN(0xf46a7f35, 0xc5eeb781),
+	TOBN(0x17f9f8bb, 0xa216df97), TOBN(0x0e08d135, 0x8e415753),
+	TOBN(0x23818ea6, 0x35589b6a), TOBN(0x1e8301b7, 0x4d568b74),
+	TOBN(0x96a41dcd, 0xdc889054), TOBN(0x357d2d65, 0x06f09b75),
+	TOBN(0xbe9acf24, 0x3885e622), TOBN(0x79e4e8b2, 0xb1ccdabe),
+	TOBN(0xf6b1d0a0, 0x73ff5e27), TOBN(0x5feeea8f, 0x0039e7e1),
+	TOBN(0x18324541, 0xc6bd7243), TOBN(0x5dde9c9f, 0x5508ae6f),
+	TOBN(0x8d056149, 0xe142d072), TOBN(0x15e80031, 0x9a88479d),
+	TOBN(0x181eddb3, 0x51d5d720), TOBN(0xf9d7d56e, 0xb740e1bc),
+	TOBN(0x981bd943, 0x6931820b), TOBN(0xd9418330, 0xd6a1a89e),
+	TOBN(0x273aaf05, 0x6bf374e6), TOBN(0x1d9f4d76, 0xc1608109),
+	TOBN(0x44ce9810, 0x21a4e683), TOBN(0xc1195557, 0x901e8129),
+	TOBN(0x6134fcb8, 0x3c0d758d), TOBN(0x698442e1, 0x0876ac3c),
+	TOBN(0x66b14ab5, 0xcfc97821), TOBN(0xd69cd5ee, 0xe1cfb2dc),
+	TOBN(0xb01678a3, 0xfed82817), TOBN(0xa8266109, 0x24cba63e),
+    },
+    {
+	TOBN(0xc3ddb547, 0x6db52a91), TOBN(0xfd654bc9, 0xf4f34eaf),
+	TOBN(0x1705048c, 0xe285d655), TOBN(0xda4403c7, 0x24ca9ff9),
+	TOBN(0xd2ba1e50, 0x67bd42fb), TOBN(0xcd77d121, 0x8b719bec),
+	TOBN(0x7e38d3e9, 0x804ec68e), TOBN(0x34add786, 0x5c3a475b),
+	TOBN(0x4388652d, 0xd7bc6656), TOBN(0x3bd05c89, 0x70f2b984),
+	TOBN(0x2400e516, 0x10a75ed2), TOBN(0x723b239a, 0xaf1b1e19),
+	TOBN(0x359f4bba, 0xd53f2546), TOBN(0xc20ff040, 0x9bf439b0),
+	TOBN(0xb0cb2cbe, 0xff97ce42), TOBN(0xeec0f474, 0xe7992cdd),
+	TOBN(0x7648eca1, 0x9b3b7d63), TOBN(0xeaa2c5e4, 0x7f4a0a68),
+	TOBN(0x8d3536f9, 0xc271a9ae), TOBN(0x6331879d, 0xaf506c65),
+	TOBN(0x1a76aec1, 0xed5ad8ba), TOBN(0x00eb6e53, 0x54fc7996),
+	TOBN(0xe5b5b481, 0xc4adf19d), TOBN(0x3753e9c0, 0xb5cf1b70),
+	TOBN(0x388e7860, 0xaaf37a4e), TOBN(0x699ad1ab, 0xc2a53263),
+	TOBN(0xdc942981, 0xed9bf31a), TOBN(0x20ab6329, 0x5aebeae1),
+	TOBN(0x5726c031, 0x58d2feea), TOBN(0x8d3d66e2, 0xabee6aab),
+	TOBN(0x9c08ed1f, 0x6e3f239c), TOBN(0x4ad24954, 0x936244da),
+	TOBN(0xa304e8b7, 0x8100a3d8), TOBN(0x974801f6, 0x0116bde6),
+	TOBN(0x52ab36f3, 0x03c83b02), TOBN(0xccde6ea8, 0x2f7528bc),
+	TOBN(0xe6bcb2e1, 0x44c24565), TOBN(0x48758fde, 0x92b095af),
+	TOBN(0x0b830096, 0xbc39c3d7), TOBN(0x617754b1, 0xa1475dae),
+	TOBN(0x65297fc3, 0xba5a7652), TOBN(0x907d8988, 0x6d749d96),
+	TOBN(0x5d2e0772, 0x1bac6a29), TOBN(0xbda90862, 0xa224e712),
+	TOBN(0x6a32e71f, 0x3409ae77), TOBN(0x508ade3a, 0x1f42ff61),
+	TOBN(0x0d7664d4, 0x2e508ce4), TOBN(0xe55c349a, 0x5253df3d),
+    },
+    {
+	TOBN(0x5b041c4d, 0x793f77e5), TOBN(0x5d60ee1b, 0x52849ecb),
+	TOBN(0x52b87e03, 0xb21f8ae9), TOBN(0x8a45d07c, 0x537b3186),
+	TOBN(0x4c23ce9e, 0xe5c4f675), TOBN(0x936e8fea, 0x762badb8),
+	TOBN(0xc1c14011, 0x2d817eff), TOBN(0x11b0fcd1, 0x95bb8281),
+	TOBN(0x1a12849c, 0x4de07c17), TOBN(0xe380082f, 0x014c310d),
+	TOBN(0xd2f080de, 0xd849873a), TOBN(0x79a25850, 0xa61367f7),
+	TOBN(0xf7ca8cf0, 0xba8a8c71), TOBN(0x9e23727e, 0x8efe5ee7),
+	TOBN(0x2844ecf6, 0xf9cf603b), TOBN(0xca1a548b, 0x9ba3f832),
+	TOBN(0xac2a8508, 0xe461f137), TOBN(0xbb20056f, 0x1ff8c0cd),
+	TOBN(0xe074b9ba, 0x0f0ba553), TOBN(0xfbda1754, 0xdb3836a8),
+	TOBN(0xecb6d8e7, 0x12401c8c), TOBN(0xe706d009, 0x54a45c28),
+	TOBN(0x86efa157, 0x9b2f9624), TOBN(0xa4510cc5, 0xbad5a26c),
+	TOBN(0x83870f2e, 0x151cd27d), TOBN(0x8093622c, 0x70184e95),
+	TOBN(0x1aa32e89, 0x3abe31e5), TOBN(0x0f7524ad, 0x9257308b),
+	TOBN(0xf9899481, 0x551ddf02), TOBN(0x1beacb2a, 0xf21e6390),
+	TOBN(0xba45e7cf, 0x9416561e), TOBN(0x72799cd2, 0x0adf671f),
+	TOBN(0xde3dba4f, 0x3c0c71e6), TOBN(0x039f5404, 0xc231276a),
+	TOBN(0x3c7b6823, 0xdf5f6d35), TOBN(0xc59c3b0d, 0xe1645136),
+	TOBN(0x00046ebd, 0x0a2af25c), TOBN(0xb340a1f1, 0xbf295417),
+	TOBN(0x86f82139, 0xa47952c5), TOBN(0x8a90e9d9, 0x683bab04),
+	TOBN(0xb110fdf4, 0x935cce1b), TOBN(0x2b6861f1, 0xe226ced8),
+	TOBN(0xcb0d9924, 0x3868e542), TOBN(0x8ad78b27, 0x8aca3be1),
+	TOBN(0x38ed738f, 0x2a6c3253), TOBN(0xeb3c7499, 0x07172a9e),
+	TOBN(0xd321200f, 0x2255101a), TOBN(0x0f30efd1, 0xa858ebb7),
+    },
+    {
+	TOBN(0x2dca6d40, 0x63b567e4), TOBN(0x5a73f1dc, 0x06633979),
+	TOBN(0x7ab1ddb1, 0xc2f6a252), TOBN(0x38a7984f, 0xfb74a121),
+	TOBN(0xc08bcda6, 0xaa2c93c6), TOBN(0xceec70d9, 0xcb0aa3e1),
+	TOBN(0x494bd8b7, 0xd450ded2), TOBN(0x0f468613, 0xb637ce2d),
+	TOBN(0xe868d7f2, 0xd7438a03), TOBN(0x5e56c1b3, 0xaaa5e526),
+	TOBN(0x54ecff71, 0x84b1c26f), TOBN(0x62a974db, 0x89759ad9),
+	TOBN(0x046667d9, 0xb6c989e9), TOBN(0x0390469c, 0x6f9de619),
+	TOBN(0xdaa80251, 0xe77573a7), TOBN(0xd36f7935, 0xb7c9f2cd),
+	TOBN(0x94d8190e, 0x168c7e96), TOBN(0x65e48dde, 0x424de39b),
+	TOBN(0x423420b5, 0x64dbf53c), TOBN(0xdd65890e, 0x929a94de),
+	TOBN(0x63d78844, 0x6336c84e), TOBN(0x40268f93, 0xf4cbd336),
+	TOBN(0x8c6d5b73, 0xe5b49586), TOBN(0x89159947, 0x72e88a2b),
+	TOBN(0x63dd391f, 0xea66798e), TOBN(0x9c33c7b1, 0xc174778a),
+	TOBN(0x19f4fcaa, 0xb9e2cf0a), TOBN(0x07fe1768, 0x93c0c72d),
+	TOBN(0xc4b66167, 0x2ac01df2), TOBN(0x52cc05e2, 0x53f7b96d),
+	TOBN(0x5b38d212, 0xa4c6f82a), TOBN(0xedce7b9a, 0x9ee8910a),
+	TOBN(0x4ade8ef6, 0xd021181a), TOBN(0x396266bb, 0x5eeea3c3),
+	TOBN(0xc6f75f20, 0xa7d31781), TOBN(0x09fb09cf, 0xddf70d6d),
+	TOBN(0x5496a94f, 0x386f9ef9), TOBN(0x0c4a2a55, 0x91dde002),
+	TOBN(0xeb20cd8e, 0x4294977d), TOBN(0x345edead, 0x38de6c6a),
+	TOBN(0x3775afa7, 0xe0c6b38b), TOBN(0xf1e6eaf2, 0x5a462a8f),
+	TOBN(0x47629dec, 0x0ccb3125), TOBN(0x16400d3b, 0xbd72e30d),
+	TOBN(0x83816167, 0x2a53d0dc), TOBN(0x1002e72b, 0x42546fb1),
+	TOBN(0xf94807a8, 0x6e6e6d67), TOBN(0x622bf8cf, 0xa97d0206),
+    },
+    {
+	TOBN(0x76491993, 0xc327cbc1), TOBN(0xf467550b, 0xbd3f48b2),
+	TOBN(0xcab698a0, 0x6f471b75), TOBN(0x291d810a, 0xa9c5165a),
+	TOBN(0x1390a3fb, 0x5e6ee264), TOBN(0x14fafd46, 0x0cfe79ce),
+	TOBN(0xce6034f3, 0x51b18182), TOBN(0x7b49ad32, 0xa419e0e4),
+	TOBN(0xedf7a23d, 0x3dcb7b67), TOBN(0xbd4998f9, 0xaf97d320),
+	TOBN(0x466efb7c, 0x6c4393f6), TOBN(0x7056d311, 0xb33633ee),
+	TOBN(0xd2645f4d, 0xa1dc7e20), TOBN(0xefee8a2d, 0x57a85f40),
+	TOBN(0xb30be27b, 0x2b44b5dd), TOBN(0x5eb5afb9, 0x61f76752),
+	TOBN(0x94ae8dbc, 0x599ec35d), TOBN(0x8764f67d, 0xedd7276d),
+	TOBN(0xa1c9d3d5, 0x9ad4a275), TOBN(0x0109ef38, 0x4cf7aeaf),
+	TOBN(0xf9e2c8d7, 0x8c14f190), TOBN(0xdf34ca67, 0xdace1286),
+	TOBN(0x1cc56fbe, 0xa7435e6c), TOBN(0x350af1b6, 0xd325a6fd),
+	TOBN(0xebd5bea6, 0xc16a9d21), TOBN(0x37266ec3, 0xc27e252e),
+	TOBN(0xfb61fa36, 0x0eaa8bff), TOBN(0x76d43856, 0xd905f41b),
+	TOBN(0x5850c4b3, 0x34f6d608), TOBN(0x8297d316, 0x728bd858),
+	TOBN(0xaf93c96f, 0x73cdaff1), TOBN(0xd76157e3, 0x1a993343),
+	TOBN(0x27f17b22, 0x540710e8), TOBN(0xf5529118, 0x0e9d96e0),
+	TOBN(0x78c37a65, 0x1a4d1d97), TOBN(0x7a07b9e2, 0x73b7fcaa),
+	TOBN(0x90282fa3, 0xaf03e1a6), TOBN(0x2a84498b, 0xbace1765),
+	TOBN(0x954837fd, 0xe9db6163), TOBN(0x10c4355a, 0x059c1a8a),
+	TOBN(0xf4969d2e, 0x233ca02d), TOBN(0xc94e06fd, 0x96b70e8a),
+	TOBN(0xeab9a72a, 0x7070d29e), TOBN(0x85f320cf, 0xe66d097c),
+	TOBN(0x39ddbc18, 0x7e061d4c), TOBN(0x6ef5f4f7, 0xdf0737bf),
+	TOBN(0x8e3d34a7, 0x571c64cf), TOBN(0x1cc562e5, 0x1843036c),
+    },
+    {
+	TOBN(0x957dd323, 0x4d90ada2), TOBN(0xec20fef6, 0x933b7cef),
+	TOBN(0xe076da2a, 0xb2b38356), TOBN(0x10de4b22, 0xa30f39e8),
+	TOBN(0xb159b763, 0x068de4c4), TOBN(0xb1111ee1, 0x7bb8b583),
+	TOBN(0xed721a40, 0x504e7860), TOBN(0xc0eb7f5c, 0xd6748a25),
+	TOBN(0xaf82cccb, 0x514bb8db), TOBN(0x25f57288, 0x29cff09e),
+	TOBN(0x56df2d9a, 0xb7294914), TOBN(0x1c702878, 0x4ef1ae32),
+	TOBN(0x72b6f61b, 0xe3025ea6), TOBN(0x625d37e9, 0xc635e1b3),
+	TOBN(0x99b7db58, 0x5b9e1bf8), TOBN(0x0027d242, 0x29610437),
+	TOBN(0x18b45217, 0xeb6344b9), TOBN(0x6ec16570, 0x715e99c1),
+	TOBN(0xa7584576, 0xf8c7a997), TOBN(0xa943509d, 0xa6c290f7),
+	TOBN(0xede44bfa, 0x2314013b), TOBN(0x423f01e7, 0xc4e8208c),
+	TOBN(0x54114974, 0x6cf0db11), TOBN(0xfff15dee, 0x096400ce),
+	TOBN(0x4f01fb0f, 0xe5f8c072), TOBN(0x3326ef11, 0x654f30ff),
+	TOBN(0x5cc152cb, 0x01668696), TOBN(0x89748a6e, 0xb9cea78a),
+	TOBN(0xefaf63cc, 0xb7aedaf5), TOBN(0xfb9020bb, 0xa1155153),
+	TOBN(0x11f41cc2, 0x1f70d3cb), TOBN(0x4760ee94, 0x1c053062),
+	TOBN(0xbd869440, 0xcfbc226b), TOBN(0x5d7d947f, 0x557f7868),
+	TOBN(0xc7573fcc, 0xa117c28d), TOBN(0xa15718d0, 0x574c9837),
+	TOBN(0x813c2c93, 0xce9a69c3), TOBN(0x5545d355, 0xf1a69f42),
+	TOBN(0x871f82fd, 0xdd084fcb), TOBN(0xd803fa89, 0xe9ca6478),
+	TOBN(0xdfa826fd, 0xb570ae96), TOBN(0x1034adea, 0x4fa5de89),
+	TOBN(0xeea13247, 0x135752dc), TOBN(0x17caa779, 0x616c1612),
+	TOBN(0x435f170a, 0x33dd548e), TOBN(0x7488432f, 0xfcbf14c5),
+	TOBN(0xc7d56883, 0x524ee94f), TOBN(0xa47ec45c, 0xcf828d87),
+    },
+    {
+	TOBN(0xdaef5fb5, 0x6b58e395), TOBN(0xece13088, 0x18751a18),
+	TOBN(0xcdbf06a8, 0x595f24e2), TOBN(0xf9c28143, 0x6be105d6),
+	TOBN(0x40b87156, 0x21a57d58), TOBN(0x00084c47, 0x49921e25),
+	TOBN(0xd10f5860, 0x4acc8f51), TOBN(0x7e7ebaf6, 0x094d8abf),
+	TOBN(0x50deb9d3, 0x0d034c11), TOBN(0x2ac6b6e4, 0x88312c35),
+	TOBN(0x002382fc, 0xc222ef9b), TOBN(0xb77df956, 0x78071bb6),
+	TOBN(0x2a89ada5, 0x0ae9c62c), TOBN(0x07466db4, 0x39b5d0fb),
+	TOBN(0xa060a47a, 0x01746694), TOBN(0x482bc60b, 0x02ac0073),
+	TOBN(0xb161656a, 0xe79847d2), TOBN(0xb6772ae7, 0xdb076e6d),
+	TOBN(0x52cd47f8, 0x8619ca78), TOBN(0x6514b5ee, 0xf4fd8f96),
+	TOBN(0xfa620ab4, 0xae1218e6), TOBN(0xb1f85b54, 0xacc21d2c),
+	TOBN(0x20dde899, 0xbe842381), TOBN(0xe91ab4b1, 0x19b0140e),
+	TOBN(0xe319e604, 0xa960024c), TOBN(0xf51c9df3, 0xd1df292e),
+	TOBN(0x87d5352b, 0x01ce23d3), TOBN(0xc392b990, 0xc598b166),
+	TOBN(0x5f47ca0b, 0xa3e1b14a), TOBN(0x3427e7e9, 0x5ddc5c14),
+	TOBN(0x489e3cb2, 0x43db1b3e), TOBN(0xc0f5e3b8, 0x0fd2d96e),
+	TOBN(0x933cb93a, 0x6427e49f), TOBN(0xfa7ecf30, 0x47562ccd),
+	TOBN(0xe15d6227, 0xeb877a32), TOBN(0x8ff0a8fb, 0xc33a4a18),
+	TOBN(0x836955ba, 0x28f130d8), TOBN(0x3b8a2000, 0x94f4c95e),
+	TOBN(0xc4950e8a, 0x86651333), TOBN(0x3aa35a92, 0xeda1ff84),
+	TOBN(0xeff554c7, 0xd1e5b3ba), TOBN(0x97aeab3f, 0x882301bc),
+	TOBN(0x80d1a52e, 0xf5ebb59a), TOBN(0xd80ebb6f, 0xbab9e954),
+	TOBN(0xdb53408d, 0x012499bf), TOBN(0x4b42d9d8, 0xc3231c56),
+	TOBN(0x3182c3c8, 0x6b49429d), TOBN(0xd75c968b, 0xb4e8c0dc),
+    },
+    {
+	TOBN(0xa40a8f91, 0xc66db496), TOBN(0xb4d723ef, 0xc9a79c83),
+	TOBN(0x4c918799, 0x39a6d711), TOBN(0x8fdaa3dc, 0xd448336e),
+	TOBN(0xd571cd77, 0x31916e8e), TOBN(0x53d9e3b7, 0xad7ef2dc),
+	TOBN(0x1df7884a, 0x5bf555eb), TOBN(0x857a4910, 0x51804ecd),
+	TOBN(0xfbc0dcdd, 0xe2aa4d4a), TOBN(0xe64cbf34, 0x2b4ece27),
+	TOBN(0x3cd6d533, 0x17623b1a), TOBN(0xae9834db, 0xe69b57c0),
+	TOBN(0xc4d69b0b, 0x1f52c5bc), TOBN(0x6f1f2f37, 0x79060e83),
+	TOBN(0x05ccc332, 0x41cbfcea), TOBN(0xae3f990c, 0x796749dd),
+	TOBN(0x0a37c38f, 0x78e1c4e1), TOBN(0x324c0c56, 0xdcf6aca7),
+	TOBN(0xa4d33562, 0x3365f4db), TOBN(0xb0266be7, 0x6c1042f4),
+	TOBN(0x4c38d3a8, 0xf74d8db8), TOBN(0xc9821bd0, 0x9c18b510),
+	TOBN(0x5608fb9a, 0xcf1cffe2), TOBN(0x9d1cc5a3, 0x6ea85fd7),
+	TOBN(0xb41a6fc3, 0x6399cb82), TOBN(0x10b4bdcd, 0x0603c4b5),
+	TOBN(0x8c0367f3, 0xb212c404), TOBN(0x214b2e3c, 0x5f4a1845),
+	TOBN(0xc51d47bc, 0xe0561514), TOBN(0x1c9e27d1, 0xcdc6f9fe),
+	TOBN(0x2f1caf75, 0x963f7e75), TOBN(0x960fa866, 0x748118f9),
+	TOBN(0x62a6e865, 0xfdc53272), TOBN(0xf257e0a3, 0x3c63dc0b),
+	TOBN(0x37a144ef, 0x1b4d8254), TOBN(0x091eb888, 0x98ae21d7),
+	TOBN(0x6032b683, 0xe889571c), TOBN(0xc2f0db81, 0x7a3615f3),
+	TOBN(0xb934ed83, 0x34aeb73e), TOBN(0x5beccb27, 0x0caf7f07),
+	TOBN(0x4f6ab89f, 0x05b80f1c), TOBN(0xd420e868, 0x6ba07362),
+	TOBN(0x51827118, 0x67dc28c8), TOBN(0x380df5ca, 0x789ce9b5),
+	TOBN(0x8819776b, 0xd0e23127), TOBN(0x1eae0e95, 0x5c66dfe8),
+	TOBN(0x89225a4f, 0x1fa9f51d), TOBN(0x2d995946, 0xa4087d6a),
+    },
+    {
+	TOBN(0x194ddb2b, 0xb567e8e4), TOBN(0xb8608b06, 0xf45dc681),
+	TOBN(0x64014fdb, 0x0db33b57), TOBN(0x3818a2ce, 0x26e7c64c),
+	TOBN(0xf63eac1b, 0x5e1d7531), TOBN(0x0bace09a, 0x4710b5bc),
+	TOBN(0xe7ce4cc0, 0x18c96feb), TOBN(0xe5687390, 0x179cc0fe),
+	TOBN(0x06a2763f, 0x5077bf60), TOBN(0x77a3b899, 0xa1482482),
+	TOBN(0xdd643b0d, 0xf77aa4a0), TOBN(0x2be9bcdb, 0x93bc362a),
+	TOBN(0x7c40d8c6, 0x549fa610), TOBN(0x5b5e9a61, 0x98c4b11c),
+	TOBN(0x373ababb, 0x3197df0d), TOBN(0xe2ff8eb6, 0x840db9f4),
+	TOBN(0x013611dd, 0xae789ac1), TOBN(0x4ebea9ea, 0x2783c6df),
+	TOBN(0x16d88f7a, 0x47feb1cc), TOBN(0x54d0327e, 0x7b40ff5f),
+	TOBN(0x570148fd, 0xcaa5a7c5), TOBN(0x1d8f0f9f, 0xdb4b4ca8),
+	TOBN(0x4345ee30, 0x90e9451f), TOBN(0xa813ba71, 0x882f61e4),
+	TOBN(0xbb52d327, 0xa6a29b20), TOBN(0x005fe2fa, 0x5f7dcc61),
+	TOBN(0x1e5f569e, 0xe9f8d82a), TOBN(0x0de08cfd, 0xacef6fd5),
+	TOBN(0x7c3396ab, 0x37269e89), TOBN(0xf9ebb8f8, 0xd25ea6d1),
+	TOBN(0xb3c7d6db, 0x8e02fb07), TOBN(0xb46795ba, 0x6827c08a),
+	TOBN(0x32f7b5f8, 0xb09f610c), TOBN(0x426273e7, 0x15a411dd),
+	TOBN(0x0261f30f, 0x14ed4f7f), TOBN(0x4de38280, 0x65f33a46),
+	TOBN(0x57c173e0, 0x1bcf4efa), TOBN(0x69cd38b0, 0x957aa896),
+	TOBN(0x1fc1f61c, 0xfe2d3057), TOBN(0xbe6709e8, 0x5872d642),
+	TOBN(0xca0bfa58, 0xaa49f385), TOBN(0x620c1338, 0x43c458e6),
+	TOBN(0x86b9ec08, 0x881b8b42), TOBN(0x5b835ffd, 0x7993d7db),
+	TOBN(0x75c8c484, 0xfd629b24), TOBN(0xac21574a, 0x381d313a),
+	TOBN(0xd09192c5, 0x708ad21c), TOBN(0xb87caad1, 0x61b3f068),
+    },
+    {
+	TOBN(0xcfcd3af1, 0xd2796e86), TOBN(0xe8a15e34, 0x4e3cdcd8),
+	TOBN(0x2906ca48, 0xd88ed810), TOBN(0xa06a3d86, 0xcc1cdf91),
+	TOBN(0xdb12d964, 0xa7f97888), TOBN(0xea46a66a, 0x733dc492),
+	TOBN(0x45307b0b, 0xf3a4c278), TOBN(0xdb62879a, 0x96f7ad45),
+	TOBN(0x483fa80a, 0xf7ffcdd8), TOBN(0x14f4ac0b, 0x2d7d55cd),
+	TOBN(0xc9f9f68f, 0x7311ebd3), TOBN(0xd128634d, 0x28927644),
+	TOBN(0xc9c0a85a, 0x4b5cb6c0), TOBN(0xec4edcd6, 0x172951f0),
+	TOBN(0x4f8796e9, 0xf614b588), TOBN(0x077f8e83, 0x867dfd56),
+	TOBN(0xa02d74d3, 0xe73510a0), TOBN(0x312e9e3c, 0x37462608),
+	TOBN(0x0a3b9e27, 0x3a41b3e8), TOBN(0x1ed11c67, 0xf1d19141),
+	TOBN(0x97801b42, 0x42643af3), TOBN(0x92192557, 0xd76fb91b),
+	TOBN(0x36ce6cd3, 0x02772d0e), TOBN(0x53caf633, 0xb58debfd),
+	TOBN(0x6ae23b57, 0x3f333e43), TOBN(0xebf38f5a, 0x5958c716),
+	TOBN(0x42ffddc1, 0x9d626ace), TOBN(0x146f32a3, 0xccb9a82f),
+	TOBN(0x93cc781c, 0x1a09320e), TOBN(0x37bb03b3, 0x702b7a6c),
+	TOBN(0x84640bdc, 0xa37957fd), TOBN(0x3ae6e160, 0xefb4df6b),
+	TOBN(0x93eec3d9, 0x1bbbc3ec), TOBN(0xc31fadd4, 0xe1cee20e),
+	TOBN(0xb6f6fad5, 0x9fb8d9ca), TOBN(0x5e41d962, 0xcfea9bc8),
+	TOBN(0x98386fde, 0x9d788a96), TOBN(0x79134e48, 0x70298560),
+	TOBN(0x11baa2ad, 0xe6f8a15e), TOBN(0x76f1e6e2, 0xde66c376),
+	TOBN(0x632c1e1c, 0x7b3abd6b), TOBN(0x1c01457d, 0x82a64658),
+	TOBN(0x54c5e1cc, 0xa820515d), TOBN(0xa1265ea9, 0xaed4684c),
+	TOBN(0x2af19e69, 0xaa6ea2b5), TOBN(0xfae6ab83, 0xfeb78b0b),
+	TOBN(0x388443a7, 0x845fa4fd), TOBN(0x1984db23, 0xee999d45),
+    },
+    {
+	TOBN(0x46a5c199, 0x34787a93), TOBN(0x26d44401, 0x46a3f886),
+	TOBN(0x4b5365a0, 0xdd205c21), TOBN(0x2c145693, 0xe9ca47b5),
+	TOBN(0x0a909360, 0xa3de2a78), TOBN(0x632c9139, 0x24f5bd7b),
+	TOBN(0x56abe675, 0x1b6c9527), TOBN(0xd8ff4d6a, 0x2c21c09e),
+	TOBN(0xaeef3c61, 0x03cc1eb3), TOBN(0xc0b08085, 0x0455d984),
+	TOBN(0x221a278e, 0xfe3a264a), TOBN(0x54447bf4, 0xf79c5749),
+	TOBN(0x1c1d58ee, 0xa469ad2e), TOBN(0x5a78f7b8, 0x66752e71),
+	TOBN(0x68a00084, 0x5e9cbd09), TOBN(0xe547ccec, 0x357c53c3),
+	TOBN(0x23ac9586, 0xb6b0957d), TOBN(0x72a3e7b0, 0x1f82dc2e),
+	TOBN(0x0bc9cc79, 0x42eb9d4e), TOBN(0xd24c75ff, 0x7b0db0f7),
+	TOBN(0xfe793cb5, 0x0404f8e0), TOBN(0x8553b3ee, 0x786c14c3),
+	TOBN(0xa131cca2, 0x473513c7), TOBN(0x26d18ac9, 0xc76ab305),
+	TOBN(0xb1013ec5, 0x179d5d26), TOBN(0xda2cd5bf, 0xd41a14e7),
+	TOBN(0x2aa498db, 0xde8074ac), TOBN(0x2b8676b9, 0x94bcd298),
+	TOBN(0x19525cb5, 0x009e4449), TOBN(0x9aad319c, 0x5f8f884c),
+	TOBN(0x05126420, 0x48559961), TOBN(0x80e08c37, 0xe0bf2887),
+	TOBN(0xc5098b06, 0x7977c8ba), TOBN(0x10c1d841, 0x4f36076e),
+	TOBN(0x84a16ece, 0xdf59fa69), TOBN(0xbc69b443, 0xed26f779),
+	TOBN(0xbac85ab5, 0xc4dd576c), TOBN(0xbc46177a, 0x609e32f7),
+	TOBN(0xb147026b, 0x776544b4), TOBN(0xd2eeba33, 0xf97d39ed),
+	TOBN(0x4c821e31, 0x167843fe), TOBN(0xb9721791, 0xf5e2f8f1),
+	TOBN(0x84dad3dd, 0xa6121b61), TOBN(0x7b6760db, 0x9139d5e3),
+	TOBN(0x3c4eba9e, 0x507f195c), TOBN(0xdac27d09, 0x0dc2802a),
+	TOBN(0x6219fa16, 0x05f67607), TOBN(0x0efd1c8d, 0x5416484d),
+    },
+    {
+	TOBN(0x7efa2700, 0x23395070), TOBN(0x06e37b44, 0x4610841e),
+	TOBN(0xe8836934, 0x17346d1e), TOBN(0x41ffdd89, 0xcc2d0d19),
+	TOBN(0xb7d6d947, 0x721cac59), TOBN(0x98ab91e4, 0x80bcc76a),
+	TOBN(0xe017c7e9, 0x6deeae0f), TOBN(0x2aa297cc, 0x2cc7f47d),
+	TOBN(0x61afb2f3, 0xa2429d92), TOBN(0xb7a8869c, 0xd94c49cb),
+	TOBN(0x5e1bc326, 0x7b805dbb), TOBN(0x89480710, 0x012ef967),
+	TOBN(0x300b3c46, 0xc55b8db5), TOBN(0xa0074df1, 0x98e26e49),
+	TOBN(0xf790a392, 0x58061a89), TOBN(0x6142dd7d, 0xeb7274dc),
+	TOBN(0x02138a94, 0x49d45b32), TOBN(0x8254e1ce, 0xdd9ea5ba),
+	TOBN(0x6ad2fe1c, 0x997cd766), TOBN(0x571262cc, 0x4b9db523),
+	TOBN(0xc36faf51, 0x710fefbf), TOBN(0xad020d33, 0xc9738016),
+	TOBN(0x1effab0f, 0x8048c442), TOBN(0x1d14606c, 0xa93d234b),
+	TOBN(0xb0b82621, 0xbed5c99a), TOBN(0xcadad8bd, 0xdfd9ee75),
+	TOBN(0xa334de9d, 0xb882368f), TOBN(0x77e4bb51, 0x63775836),
+	TOBN(0xec7b6024, 0x157ec8f1), TOBN(0x5b907161, 0x435e459c),
+	TOBN(0xd1d8c661, 0xfc031717), TOBN(0x8f4cd528, 0x50f08ef5),
+	TOBN(0xf29c600b, 0xf8f2feec), TOBN(0x3413d250, 0x500453a6),
+	TOBN(0x60799d27, 0x6ccbb491), TOBN(0x3f81afc2, 0xe9fa5fac),
+	TOBN(0xf4ee7233, 0xac4bea5d), TOBN(0x44c2658e, 0xd8fcb107),
+	TOBN(0x473b6cdb, 0xbc8f0910), TOBN(0x05e8a661, 0xc4f8f21b),
+	TOBN(0x2a976901, 0x647dd07c), TOBN(0x70a50c9c, 0x8a409955),
+	TOBN(0x2a82118c, 0x5c050359), TOBN(0x6f2f4a89, 0x39a42f8a),
+	TOBN(0x2275c376, 0x76e1222e), TOBN(0xc74b283b, 0x7b7f2add),
+	TOBN(0xb1ca1dbe, 0x89365f80), TOBN(0xee491b80, 0x341da943),
+    },
+    {
+	TOBN(0x22cac6b2, 0x5c4e130e), TOBN(0xb1ef0a7c, 0x349c6ada),
+	TOBN(0x3a4ee73f, 0xc896d929), TOBN(0x817ff6c9, 0x526d970e),
+	TOBN(0x9e8c4b2e, 0x8e896c9a), TOBN(0x9fe3c946, 0x7280ff6a),
+	TOBN(0xaec49338, 0xd318875b), TOBN(0x98db88bb, 0x64281d97),
+	TOBN(0xdc6f0758, 0x15d07c7c), TOBN(0xa6ca14dc, 0x0c5037b9),
+	TOBN(0x12a83058, 0x7b6c7b67), TOBN(0x9bf17803, 0xd0aeca05),
+	TOBN(0x5f90cd5d, 0x78d5c429), TOBN(0xd888f47a, 0xe12301a9),
+	TOBN(0x13d790e7, 0x5b7a8882), TOBN(0x96a0e3bf, 0xec81d7f7),
+	TOBN(0x4f154954, 0xcc80c50a), TOBN(0xd1cc41c4, 0xd6ab08b5),
+	TOBN(0x2618c08e, 0x470b6c77), TOBN(0x0a45ab8f, 0xd27321b2),
+	TOBN(0xa1894840, 0xff10cabe), TOBN(0xcf8e4b2f, 0x57686f05),
+	TOBN(0xe837c539, 0x127f6c04), TOBN(0xdf608ecd, 0xbf29ccbe),
+	TOBN(0x6355ed8b, 0x85c59375), TOBN(0xdab790c8, 0xee62f47e),
+	TOBN(0x9e2f9991, 0x43c786e4), TOBN(0xad6f688d, 0xc2ace0e0),
+	TOBN(0x674e1a8f, 0x534e5cf0), TOBN(0xc5b597a7, 0x5803316b),
+	TOBN(0xab9317b6, 0x880e3d94), TOBN(0x4ffda991, 0x5c422758),
+	TOBN(0x13a41eda, 0x28450eaf), TOBN(0xd0cf9d7a, 0x2d2b0fd0),
+	TOBN(0x5a3af2c5, 0xb0376750), TOBN(0x182162d9, 0x04de5c5a),
+	TOBN(0x4ee564a6, 0x989b118d), TOBN(0xa96e7330, 0x12578af8),
+	TOBN(0xca589cd1, 0x1512c014), TOBN(0xc322d329, 0xb8a53a7f),
+	TOBN(0x1e3bb230, 0x569d4396), TOBN(0x69b5350f, 0x2040092f),
+	TOBN(0xa37e0616, 0x41277a67), TOBN(0x752bf7c4, 0x6accaf66),
+	TOBN(0xf70d6b8a, 0xb6ee5bfb), TOBN(0x5bb6bfc0, 0xa72b5c64),
+	TOBN(0x3484a40a, 0x774b3b04), TOBN(0x7716a675, 0x0195b646),
+    },
+    {
+	TOBN(0x12441b29, 0x906f2a35), TOBN(0xfcb3d68c, 0xccd1f61e),
+	TOBN(0x99d6f7ab, 0xafa8b61a), TOBN(0x3ccfbc47, 0xfaee100b),
+	TOBN(0xa1730ac1, 0x82785333), TOBN(0x07a69808, 0xe82a0c7b),
+	TOBN(0x1389a35c, 0xfe135cce), TOBN(0x83506fbe, 0xf28d25d9),
+	TOBN(0xe57cecdb, 0x11a67029), TOBN(0x9869aac4, 0x16b687db),
+	TOBN(0xb8d8e88e, 0x81ab78d5), TOBN(0x50ec5661, 0xdf21e0ee),
+	TOBN(0x7453753f, 0x59599871), TOBN(0xb30db9d4, 0x39ce5f9c),
+	TOBN(0x8c91b6e1, 0x45a5d5d9), TOBN(0x276a26d0, 0xaac66307),
+	TOBN(0x93f74d10, 0x0a7515b9), TOBN(0xe68b545b, 0xdb8026eb),
+	TOBN(0xd826578d, 0xc7dfc15c), TOBN(0x545d0aad, 0x340ebc9a),
+	TOBN(0xde072793, 0x5885911d), TOBN(0xbb89c4bf, 0xf8a9bfb1),
+	TOBN(0x3dbe0358, 0x13f7667e), TOBN(0x6204ee94, 0xf1e01093),
+	TOBN(0x918e5871, 0x4b88fa5a), TOBN(0xc239c449, 0x173f6e71),
+	TOBN(0xf6298b9b, 0x4317083e), TOBN(0x8f085bf7, 0x50a0839d),
+	TOBN(0x11536e23, 0xaf47d09b), TOBN(0xeb238ef4, 0x180d748f),
+	TOBN(0x09a27ea0, 0x1d2ea1c4), TOBN(0xc46fc539, 0x59916c59),
+	TOBN(0xa96dab3d, 0xdd48718f), TOBN(0x1906fc4e, 0xce3cfcfb),
+	TOBN(0xb0ae1079, 0x69422847), TOBN(0xf64b4903, 0x695423b9),
+	TOBN(0xd22452b3, 0xcf25710a), TOBN(0x17d46c4b, 0x1fbec482),
+	TOBN(0x668e116b, 0x3723a58b), TOBN(0x08d3bfbf, 0xd7d5b1b1),
+	TOBN(0x0e525496, 0x299f6c48), TOBN(0x8d76e851, 0x072b73e6),
+	TOBN(0xbfa91db8, 0x2e5f4992), TOBN(0x23621cd2, 0x2454ce33),
+	TOBN(0xe54658bf, 0xacec8faa), TOBN(0xcea4c0e5, 0x2d518ca4),
+	TOBN(0xe8aca9af, 0xd666af59), TOBN(0xf7c0ee58, 0xd23bd966),
+    },
+    {
+	TOBN(0xe3bfccce, 0x30e27985), TOBN(0xb835abf1, 0xe238b3bb),
+	TOBN(0x7dcfe357, 0xbe979956), TOBN(0x80ed8e54, 0xd43d385d),
+	TOBN(0x3aaa7115, 0x5870b051), TOBN(0xec375891, 0x8161292f),
+	TOBN(0xb577c4b2, 0x68d0ea39), TOBN(0xf953f2f3, 0xee58ce82),
+	TOBN(0x1ef29bce, 0x969e8053), TOBN(0x83ca930e, 0x27f912e8),
+	TOBN(0x2b8c2233, 0x10d506b5), TOBN(0xda97e26e, 0xbde8461f),
+	TOBN(0x1342d45a, 0xed5abc26), TOBN(0x64cb2bb3, 0xe09f5cd8),
+	TOBN(0x041cd438, 0xbfa93d60), TOBN(0x374f2c9d, 0xf139a449),
+	TOBN(0x8c085ab2, 0xfcce1eea), TOBN(0xeb9f8d7e, 0x1e737353),
+	TOBN(0x9f781710, 0xbd97f44c), TOBN(0x21a31433, 0xa73c08d1),
+	TOBN(0x42d28cc9, 0x030a1094), TOBN(0xdccb0150, 0x20d73e0a),
+	TOBN(0x4b4be63b, 0xcfc23aa6), TOBN(0x9cd05a91, 0x31c96fa9),
+	TOBN(0x5a2ff76b, 0x0a5bbd4c), TOBN(0x534eacfa, 0xc4125f91),
+	TOBN(0x37074b8e, 0x603ad243), TOBN(0x18f5207e, 0x0bf7edee),
+	TOBN(0xad8c48ed, 0x8ab311fe), TOBN(0x3d70bd3d, 0x899b7017),
+	TOBN(0x245c0c41, 0x89a310fd), TOBN(0x4bc2352c, 0xfff75044),
+	TOBN(0xb1f6b4d9, 0x1ea5c5d3), TOBN(0x2303d0a3, 0xd58330ca),
+	TOBN(0xb5636d3a, 0xb410d9bb), TOBN(0xb169bca9, 0x2fff95ce),
+	TOBN(0x8a64f957, 0x622dcf31), TOBN(0x09cf275a, 0x696d378a),
+	TOBN(0x8e35b178, 0xa47515bc), TOBN(0x65235899, 0x874bef84),
+	TOBN(0x4675cf60, 0xe32c521b), TOBN(0x55d49e96, 0xb158dfc0),
+	TOBN(0xfe8c40d4, 0xbdd385a1), TOBN(0x156469b2, 0xdda6c9b1),
+	TOBN(0xb8074a84, 0xfda82033), TOBN(0x5c69f67c, 0x75ad8d9e),
+	TOBN(0x0d877c87, 0x442b4124), TOBN(0x9d5fc877, 0x11826681),
+    },
+    {
+	TOBN(0xd49f208a, 0x161c37f4), TOBN(0xb6c40af6, 0xb7217930),
+	TOBN(0x83689c79, 0x1db4f080), TOBN(0x04700b4a, 0xef46dd51),
+	TOBN(0xb2a50bfa, 0x64d8fe0d), TOBN(0x5b554d81, 0xdf769864),
+	TOBN(0xc82a0d94, 0x254e03f3), TOBN(0x220b9a99, 0x572cd0ff),
+	TOBN(0xfe1d99f9, 0xc9dce6ed), TOBN(0x46612587, 0x5e4bfb6b),
+	TOBN(0x7b6e1985, 0x804206d7), TOBN(0x72fdaf55, 0x1f122aab),
+	TOBN(0xf6752d49, 0xb184a487), TOBN(0x453b2dab, 0xbb61e663),
+	TOBN(0x8f422cbd, 0x5565a565), TOBN(0x2dc6c244, 0x3a6c15b3),
+	TOBN(0xfc2d3e68, 0x50834ed0), TOBN(0x32709399, 0x0629b3af),
+	TOBN(0x87a2054b, 0x96917bde), TOBN(0x2d075746, 0x8d816707),
+	TOBN(0x2ff606c8, 0x0217815a), TOBN(0xa046cb9d, 0x545618da),
+	TOBN(0xa91b080d, 0xa7212ebf), TOBN(0xf616759d, 0x1ec332eb),
+	TOBN(0xfbf0f4c5, 0xb9b6ead9), TOBN(0x62cfb47a, 0xdf4f8535),
+	TOBN(0x685fde95, 0x380e9409), TOBN(0x75b3f82e, 0xe63c696f),
+	TOBN(0x28e86456, 0x245cb372), TOBN(0x48b63bf0, 0x38e27272),
+	TOBN(0xc38eb8e9, 0x0a53a472), TOBN(0x470f8462, 0x0d9751d6),
+	TOBN(0x5ce4f73a, 0x77d6dcb4), TOBN(0x8d6e7be2, 0x3f1c820e),
+	TOBN(0x2381eccb, 0xcca94a67), TOBN(0x3c45db76, 0xf58eda38),
+	TOBN(0x775b851d, 0xf48324cb), TOBN(0x12d09389, 0x32e0312d),
+	TOBN(0x8f8e4bc9, 0x23b246ef), TOBN(0x700356b2, 0xf69843a3),
+	TOBN(0x2b3d4de3, 0x08b7c400), TOBN(0x39d0fd72, 0x16e2987a),
+	TOBN(0x5ee944b9, 0x522b38da), TOBN(0xeccd3d5b, 0x672feb40),
+	TOBN(0xd60e6f6b, 0x85bb570b), TOBN(0x84d4abbe, 0x62f4c0e8),
+	TOBN(0x86426169, 0xe826e98b), TOBN(0x45cbdbde, 0x6456f2d4),
+    },
+    {
+	TOBN(0x9d0fcd39, 0xac9df6ff), TOBN(0xf6473b1f, 0xd86d26cd),
+	TOBN(0xdd186b22, 0xc64ff57c), TOBN(0xa6a6cec0, 0xb55762e5),
+	TOBN(0x8b30a71a, 0xcb3a3201), TOBN(0x6352f008, 0xf24d7449),
+	TOBN(0x31c04b10, 0x12cf5fbe), TOBN(0xe7c77b3b, 0xa110fde8),
+	TOBN(0x2ae7ed5f, 0xc24592fb), TOBN(0x3ff31a08, 0xe08cbe09),
+	TOBN(0x58fedfad, 0x74507dc1), TOBN(0x7bd4308f, 0x1884bea1),
+	TOBN(0xd741741e, 0xa028ef3e), TOBN(0x2d1a184e, 0x87e7d661),
+	TOBN(0x06606e6c, 0x62acfaca), TOBN(0x0a7a07e1, 0xe183909f),
+	TOBN(0x6f66d1cc, 0xcd1ba031), TOBN(0xc5a026bc, 0x6b9b574b),
+	TOBN(0x916a78d5, 0xf37e0588), TOBN(0xce4ad733, 0xd97347a8),
+	TOBN(0x05621c18, 0x2650e4ac), TOBN(0x571fe1a7, 0x90b92337),
+	TOBN(0x7b0a7441, 0x29e05aae), TOBN(0x94d82ee6, 0x54912d6b),
+	TOBN(0xfd295c9b, 0xa103fa8d), TOBN(0xece205ba, 0x71d3ccd2),
+	TOBN(0x22224022, 0x07417344), TOBN(0xd3d0bdcf, 0x803876ff),
+	TOBN(0x3283a322, 0x27ff1de5), TOBN(0xf705f5c5, 0xe9e9cf68),
+	TOBN(0x714326af, 0xf117ac92), TOBN(0xff5d2b21, 0x47167542),
+	TOBN(0xf116e694, 0x1b3e563a), TOBN(0x48408df3, 0x606a0adf),
+	TOBN(0xa6ce2888, 0x871d5ce0), TOBN(0x9de8b71e, 0x90a52840),
+	TOBN(0xe7aba9de, 0x4ac449e7), TOBN(0x8c1d7409, 0xe0f3f0fc),
+	TOBN(0x2dc780af, 0xc14e22e3), TOBN(0xcf6f5072, 0xe8fbb2e3),
+	TOBN(0xdf43b632, 0x3b122eea), TOBN(0xedec9e61, 0x3a1e6515),
+	TOBN(0x35762537, 0x16849b91), TOBN(0x3650caec, 0x5b7006a7),
+	TOBN(0xd0c3ae69, 0xd521d6af), TOBN(0xe218af36, 0xc1713e70),
+	TOBN(0x5c465449, 0xa44b1611), TOBN(0xde8c836c, 0x6fad82da),
+    },
+    {
+	TOBN(0x0bf1d260, 0xf31b4d36), TOBN(0x9a760998, 0x5a8a64e7),
+	TOBN(0xc295b425, 0xf721bd80), TOBN(0xcb1103bf, 0xdf6b9591),
+	TOBN(0x0750bfa9, 0x2377a591), TOBN(0x840f4af7, 0x41ce0bb9),
+	TOBN(0x40d0a2ee, 0x3ef4f64f), TOBN(0xce868a9d, 0xde4e779a),
+	TOBN(0x6f579a69, 0xa499d440), TOBN(0x7c852452, 0xa45ee6e6),
+	TOBN(0x2c829625, 0xc53330d9), TOBN(0x38b5dedb, 0x88f806d6),
+	TOBN(0xf1890b0c, 0x67f5c9bf), TOBN(0xd4bdbe95, 0x82e6c4f8),
+	TOBN(0xda6ddb0f, 0xd02d0f86), TOBN(0xf5204c90, 0x4fa4cee3),
+	TOBN(0x820fe625, 0xa4a1ae0d), TOBN(0xe960bc4c, 0x995cbc3e),
+	TOBN(0xe719a9c3, 0xfef1fa16), TOBN(0x5d84d6af, 0xeeba79f5),
+	TOBN(0xce8b2ef9, 0x0e919117), TOBN(0x1bd1120e, 0xe486047a),
+	TOBN(0x37aa656d, 0xf30737d0), TOBN(0xf0dc7334, 0x793a66f5),
+	TOBN(0x21108b80, 0xb1acb3cf), TOBN(0x136dfcf3, 0x5fb1eba2),
+	TOBN(0xe8dbb483, 0xf7bebafe), TOBN(0xc0c1fc57, 0x7e69a217),
+	TOBN(0xc15d1c6b, 0x2006c2c7), TOBN(0x341abd31, 0x6c65eaa9),
+	TOBN(0xf4940bbe, 0x634dab84), TOBN(0x09081406, 0x7f95cdde),
+	TOBN(0xf04df31c, 0x409e9a94), TOBN(0x2db776c0, 0xca25758c),
+	TOBN(0x60cb9aa7, 0x5cd842ef), TOBN(0x66ae02af, 0x776e9d70),
+	TOBN(0x13f309de, 0x42abf93a), TOBN(0xc93c057a, 0xc16bacf5),
+	TOBN(0x7aa53044, 0x6e6e26bc), TOBN(0xefb55b6d, 0x52b072ee),
+	TOBN(0x9b1639f5, 0xa7f1dd14), TOBN(0xae01f511, 0x42e2b4c8),
+	TOBN(0xa7513dda, 0xc9259735), TOBN(0xa1ab2275, 0x00d72839),
+	TOBN(0xc5d99785, 0xcfeac639), TOBN(0xc80a0cb9, 0x71cbe049),
+	TOBN(0x1ce7d4db, 0x4de09f61), TOBN(0x629bf5d6, 0xf7146edc),
+    },
+    {
+	TOBN(0x5f9c4713, 0x70a9908f), TOBN(0x3aec63c0, 0x6a79f3fa),
+	TOBN(0x9fa87d87, 0xa8a2d692), TOBN(0x825fb439, 0x9c3d2a10),
+	TOBN(0x3bf5f064, 0x84ce399b), TOBN(0x1479f751, 0xa364dc39),
+	TOBN(0xf6faad93, 0xe9eaae42), TOBN(0xff956abf, 0x04d791b6),
+	TOBN(0x9ff6cf4e, 0xd8b39965), TOBN(0x84095853, 0x79c38d5c),
+	TOBN(0x08450bfa, 0x63761c9f), TOBN(0x8123f68d, 0xf4ebc179),
+	TOBN(0x0939f496, 0xedcfc3c2), TOBN(0xca1c6203, 0x6960db33),
+	TOBN(0x32345ddd, 0x6d12a7f4), TOBN(0x9f238dbd, 0x65ab25b8),
+	TOBN(0x6de89225, 0xa5225c3a), TOBN(0x2dca98d8, 0xc771756e),
+	TOBN(0x0754cbed, 0x3ea53a1b), TOBN(0xca4eb9c4, 0x4e7395c4),
+	TOBN(0x2d0dc348, 0xc4729434), TOBN(0xc8671cb4, 0x9590e42c),
+	TOBN(0x9e45a7b5, 0x88b441d0), TOBN(0xe2459b7b, 0xed31da78),
+	TOBN(0xa2ce54ff, 0xa4e58f40), TOBN(0x3298f7a0, 0x764a8245),
+	TOBN(0x5dfe2b7c, 0xb2e31735), TOBN(0xf8661630, 0x9c7176ca),
+	TOBN(0xa0d90949, 0x2deac6b8), TOBN(0xb9ea1543, 0x204ee535),
+	TOBN(0x25213e7a, 0x83a799c9), TOBN(0x99b01aab, 0xf12624d2),
+	TOBN(0x89ecb69b, 0xe0a994a2), TOBN(0x61aa9d4f, 0xf34140ea),
+	TOBN(0x4183f907, 0x2e895e06), TOBN(0xe073d59e, 0x24bd4182),
+	TOBN(0x7b36ea42, 0x9282c3b5), TOBN(0x7d0120ad, 0x76c74640),
+	TOBN(0x5cec0f12, 0xa14d3174), TOBN(0x00edfd2b, 0xed34377c),
+	TOBN(0x51530767, 0xf602de6f), TOBN(0xc0660660, 0x09d18869),
+	TOBN(0x2047b5dc, 0xda2f5e9e), TOBN(0xe9eff861, 0xe4d29e0c),
+	TOBN(0x6e14bd87, 0x2f11af4a), TOBN(0x392c029b, 0xb3ed0229),
+	TOBN(0xf3f79166, 0xb0838e50), TOBN(0x7b5c7374, 0xb02f71d2),
+    },
+    {
+	TOBN(0x5c359a98, 0x25ac9770), TOBN(0x62e63d89, 0x357ef3ae),
+	TOBN(0x7550a063, 0xe40aa905), TOBN(0x6f57d905, 0xddbd4edc),
+	TOBN(0x3e8547a4, 0xee8f5af4), TOBN(0x6bae9270, 0xfbc822c5),
+	TOBN(0xed5347a8, 0x01da4c6f), TOBN(0x83ba6271, 0x261c481c),
+	TOBN(0x6dc3d2f4, 0x932540c8), TOBN(0xa96240b1, 0xb1b430c3),
+	TOBN(0x0cfa36d7, 0xfc711eab), TOBN(0xd15b0fe3, 0x00ef727c),
+	TOBN(0x84ae6a76, 0x3f169908), TOBN(0x0e336e17, 0x1d4ae9b3),
+	TOBN(0xa93e52da, 0x169ffd37), TOBN(0xd3e278ee, 0x5b90ce29),
+	TOBN(0x42f1d6a3, 0x325e4402), TOBN(0x861e512d, 0xf0e2811e),
+	TOBN(0x5571092c, 0x56d686ee), TOBN(0xd1d2400f, 0xbbb25d69),
+	TOBN(0x086c3149, 0x432b31c5), TOBN(0x46829727, 0x36140aa9),
+	TOBN(0xf3b4f724, 0xeaf83241), TOBN(0x0c633f10, 0x629bb878),
+	TOBN(0x964b014e, 0x6818db80), TOBN(0xc3da5d92, 0xcc534e69),
+	TOBN(0x258d532c, 0xb2da3019), TOBN(0xc86397de, 0x53793b97),
+	TOBN(0x04d12e23, 0x757ca8bb), TOBN(0xa3b66345, 0xc60f045d),
+	TOBN(0xc2ce9bba, 0xf07415f0), TOBN(0x092a4939, 0xe3501b8f),
+	TOBN(0xcfdb87c2, 0xc382e314), TOBN(0xfc5fd427, 0xfa065583),
+	TOBN(0x924cf158, 0xd6a4b150), TOBN(0x4180e5ef, 0x10417d57),
+	TOBN(0x6ef837e1, 0xe34275e4), TOBN(0xcfd20ec6, 0x9352323f),
+	TOBN(0x25398074, 0x21196b4b), TOBN(0xf51f2a2a, 0xc5b97113),
+	TOBN(0xf1fd4057, 0x080910d5), TOBN(0x298e62f5, 0x882fea88),
+	TOBN(0xd1c30fc7, 0xb7e7b14c), TOBN(0x8bf6b4f3, 0x906de4c2),
+	TOBN(0xd12c95c5, 0x0cd8f32b), TOBN(0x94f42dcc, 0x05054e1f),
+	TOBN(0xea96f167, 0xb0b185fd), TOBN(0x333199aa, 0x01f5c90f),
+    },
+    {
+	TOBN(0x24ab5bc4, 0x591bd6b1), TOBN(0x3190bf34, 0x487d8176),
+	TOBN(0x99296a7f, 0x179a2d7f), TOBN(0x615eec00, 0x2af80ebe),
+	TOBN(0xe5178fd9, 0xf10f58eb), TOBN(0xa1427901, 0x121f5807),
+	TOBN(0x49d4b08b, 0x7cd09644), TOBN(0x68cc5dcd, 0x8b392e50),
+	TOBN(0x69c9e204, 0xee3b659c), TOBN(0xf9c47e38, 0x16f99604),
+	TOBN(0xa8259d98, 0x9a11d07a), TOBN(0x81764573, 0xde589985),
+	TOBN(0xd672bac9, 0xd18e20e5), TOBN(0xa1f014d1, 0xf1cdb2c8),
+	TOBN(0x21eb1a4b, 0x97e9cba1), TOBN(0xbb34a834, 0x0aa96ce0),
+	TOBN(0xf23b05f2, 0x5d66d564), TOBN(0xa822648b, 0x51a38bbd),
+	TOBN(0x1081a57b, 0x7957540e), TOBN(0xadbc03e5, 0x36ac56e4),
+	TOBN(0xd19c6fe6, 0x358412cf), TOBN(0x5f9bd0f4, 0x5d9d0926),
+	TOBN(0xcb3b2e36, 0xf3986f02), TOBN(0x1a80ae40, 0xcdd3bc8d),
+	TOBN(0xbb4ddbed, 0x834a10c4), TOBN(0x1940b6ff, 0x4f20305f),
+	TOBN(0xa3a521ae, 0x63787c92), TOBN(0x56d63188, 0xc5200934),
+	TOBN(0xd68ba7f8, 0xb524e681), TOBN(0xb35b055b, 0x4fc403b1),
+	TOBN(0x289f2c67, 0x63566b1e), TOBN(0x971e07b3, 0x98eb18e5),
+	TOBN(0x58f91be1, 0x6b11975e), TOBN(0x17c6324a, 0x17d99160),
+	TOBN(0x8dbeb1e0, 0xc242246e), TOBN(0x4f4e381f, 0x64201f2c),
+	TOBN(0x00ebb871, 0x5d7ded7f), TOBN(0xd29c767e, 0xadef5cb2),
+	TOBN(0x84049c99, 0xfd8ca816), TOBN(0x38a6fc64, 0x35a2b4fb),
+	TOBN(0xe376898e, 0xc5969d42), TOBN(0xb12d1df2, 0xca946c1f),
+	TOBN(0x394b579e, 0x5c7091b8), TOBN(0x81af408b, 0x78d491f3),
+	TOBN(0x1c258af0, 0x2cf092b5), TOBN(0x043f2a7e, 0x16f4d3d4),
+	TOBN(0xd52668ce, 0x1491ec13), TOBN(0x85d6af20, 0x735be098),
+    },
+    {
+	TOBN(0x2e50e2a1, 0x93ec39bc), TOBN(0x47060055, 0x7065ed32),
+	TOBN(0xc0407421, 0x0920f547), TOBN(0x4d76e173, 0xd39ff973),
+	TOBN(0xa490f486, 0x5443c893), TOBN(0xcfd452a4, 0xc1c16206),
+	TOBN(0xaa1c8956, 0xfc3c186b), TOBN(0x996f637a, 0xd706ea9d),
+	TOBN(0xc735155e, 0xa7bc0691), TOBN(0x9cf0d791, 0xdb0a98a0),
+	TOBN(0x5e92c54c, 0xa9b67c18), TOBN(0xa4721ecb, 0x4e396a33),
+	TOBN(0x9b6cbaca, 0x74c4cd3f), TOBN(0x50489a9a, 0xb7a21076),
+	TOBN(0x08db9553, 0xa5a74997), TOBN(0x766bd9dd, 0x0bcf8fd1),
+	TOBN(0x2a680bfd, 0x694cb3d5), TOBN(0xe21caae7, 0x3078507f),
+	TOBN(0x262160c4, 0x8d88e50a), TOBN(0x7af565f7, 0x54a29a56),
+	TOBN(0x6a934755, 0xbf4187d3), TOBN(0xab2a55f4, 0x931f4d43),
+	TOBN(0x064f9022, 0xf486b4c3), TOBN(0x6be219ed, 0x4dbda016),
+	TOBN(0x31a2bf7b, 0x470fde8d), TOBN(0x2a11692f, 0xa994f805),
+	TOBN(0x89c73022, 0x7c63e9ff), TOBN(0x3257b4c5, 0x1405894b),
+	TOBN(0x418f71b3, 0x9f1e0d56), TOBN(0xe0dff213, 0x896d250a),
+	TOBN(0xdc216775, 0xb98e5e5e), TOBN(0x03706e64, 0xc67fc3ff),
+	TOBN(0xd5ee8b6e, 0xcc283713), TOBN(0x89e69723, 0x01585f75),
+	TOBN(0x217cfc1a, 0xbb7005b8), TOBN(0x63ed1e97, 0x65a041b7),
+	TOBN(0x06802a11, 0x847019cb), TOBN(0xeed4347e, 0x08b5e251),
+	TOBN(0x0b8e25c5, 0xb5368408), TOBN(0x334b4f4e, 0x3c4ad8ca),
+	TOBN(0xe6342ab6, 0x42b1f4f4), TOBN(0x3dc12628, 0xb23c8f43),
+	TOBN(0x09c7d874, 0x843fd4ac), TOBN(0x2aa5c339, 0x6468f85d),
+	TOBN(0x263977ad, 0x8c40fc41), TOBN(0x6bcdefed, 0xe17d577e),
+	TOBN(0x03f988bf, 0x2b66e05b), TOBN(0x6a00f35d, 0xa8f9c175),
+    },
+    {
+	TOBN(0x9bda0bf0, 0xede70199), TOBN(0x77b46a2a, 0x3f49fc8f),
+	TOBN(0x0c09626f, 0x927de23f), TOBN(0x55a95800, 0xf82399db),
+	TOBN(0x12f6ede5, 0xdfba3ac3), TOBN(0xf5d7f316, 0xacd6a1a0),
+	TOBN(0x9d225456, 0x3c81928c), TOBN(0x7f89ed7b, 0x771e025e),
+	TOBN(0x5ab3762c, 0xd08c6b89), TOBN(0x750a4cf6, 0x5cf4821c),
+	TOBN(0x85804875, 0x7cbac722), TOBN(0xab4c583b, 0x1b00e130),
+	TOBN(0x0d5c4f77, 0x27b3b5e0), TOBN(0x4ec575cb, 0xf87626de),
+	TOBN(0x0b2a63ae, 0x05db90f9), TOBN(0x317ffc24, 0x710a7542),
+	TOBN(0x767d8c9b, 0xf13c3246), TOBN(0xfedb3c1a, 0xee5dc151),
+	TOBN(0xe496ca87, 0x91c5bcbe), TOBN(0x51d99785, 0xa1fd635a),
+	TOBN(0x1e14e953, 0xb02f28db), TOBN(0xb3ece87d, 0x6072bbec),
+	TOBN(0x59003e57, 0xc7b8c61f), TOBN(0xdf8d7d12, 0x35ce4c69),
+	TOBN(0x854ff21c, 0x776f2274), TOBN(0x028aac50, 0xf80eb906),
+	TOBN(0xd00e4fd2, 0xe0399461), TOBN(0x2f8f9602, 0x1bf4e852),
+	TOBN(0x633b508e, 0xe385b1fa), TOBN(0x20555f91, 0xbe9fa535),
+	TOBN(0x6508b115, 0x56e42447), TOBN(0x6328685f, 0x7234a35f),
+	TOBN(0xf1379b6b, 0x6b8a4252), TOBN(0x570c40b1, 0x6e1ea3f7),
+	TOBN(0xe2e1c5ab, 0x60d74fbe), TOBN(0xb9b76b5f, 0x0a3dd60e),
+	TOBN(0xb6e77cfd, 0xe856e3d4), TOBN(0x813e1134, 0xa975c858),
+	TOBN(0x8398c689, 0x590a47c6), TOBN(0x2f9d8bc1, 0x69fd503a),
+	TOBN(0x6ce62420, 0x6cd532da), TOBN(0xd1417783, 0xc2ace919),
+	TOBN(0x854bad3d, 0x5ac89834), TOBN(0x31cb26c9, 0x52493d28),
+	TOBN(0x1ee29d53, 0x41e581c5), TOBN(0x7bdfe272, 0xbee50390),
+	TOBN(0x3040b4a7, 0x69fd1a72), TOBN(0xafb1735a, 0x5b59e711),
+    },
+    {
+	TOBN(0x25ea6882, 0x2b6df988), TOBN(0xdb51f997, 0xf1e005b9),
+	TOBN(0x31b34329, 0x716a769a), TOBN(0x4f98f8e5, 0xc215a031),
+	TOBN(0xcb4fbe16, 0x5daed9fc), TOBN(0xb0e1fb63, 0x83d8dae5),
+	TOBN(0x65b2274c, 0x3c37dd8f), TOBN(0x6147b167, 0x62d48fa4),
+	TOBN(0xadcde34e, 0xa12f82bc), TOBN(0x0b835515, 0x91f93357),
+	TOBN(0xd1b70c7d, 0xfd8dabfe), TOBN(0xb11aafbf, 0xfede0350),
+	TOBN(0xc9907185, 0x35e79263), TOBN(0xe6072d92, 0x40e5700c),
+	TOBN(0x2d8496c1, 0x4523b6ae), TOBN(0x7927a69e, 0xc434568c),
+	TOBN(0x342e0ca6, 0x9f8bcb65), TOBN(0xb9e023fb, 0xa1a24d8d),
+	TOBN(0x9efab9b5, 0x726ddd7d), TOBN(0x52d50f6b, 0x68739df1),
+	TOBN(0x9d694261, 0x6f54bf35), TOBN(0x2b25e1b9, 0xda3a7af7),
+	TOBN(0x6ad5be47, 0xa1f26e09), TOBN(0xb39c3827, 0x293e3ed7),
+	TOBN(0xef4ee625, 0x9df25980), TOBN(0xb394941e, 0xd4da63b6),
+	TOBN(0x2bacd92e, 0xd7b5f398), TOBN(0xc8a11c83, 0x95fa2f25),
+	TOBN(0x82069f05, 0xef193778), TOBN(0x56f57625, 0x989c2ff6),
+	TOBN(0xa0c5cdd6, 0x0c462ca9), TOBN(0xf99b4726, 0x547a16a8),
+	TOBN(0x7409ff6a, 0x762cf0f0), TOBN(0xa3437486, 0x064d35f4),
+	TOBN(0xbb9c5f06, 0xaa5993f5), TOBN(0xbddcd6dd, 0x77b79e41),
+	TOBN(0x1982bfc0, 0x5c625b2c), TOBN(0xbdaf2181, 0xfe84edb3),
+	TOBN(0xd21c353c, 0x679f38ec), TOBN(0x04dbaa2a, 0xd5d848e3),
+	TOBN(0xa3f829d7, 0x59643549), TOBN(0xbed7e081, 0x2f138bfe),
+	TOBN(0x41fe4f69, 0x708d6c08), TOBN(0xf834371e, 0xda41e263),
+	TOBN(0x0ffb0f9b, 0x3752db99), TOBN(0x27e8c8f7, 0x8fbc004b),
+	TOBN(0x09e7eac3, 0xbebee5a8), TOBN(0xd5c88c00, 0x8117dd43),
+    },
+    {
+	TOBN(0xcdde7306, 0xfdd80d7f), TOBN(0x502c40fd, 0xd5ee5e0d),
+	TOBN(0x341635e6, 0xd75ab355), TOBN(0x00e15542, 0x6b8e8e84),
+	TOBN(0x73f27a61, 0x5be8eeb5), TOBN(0x7ae2dfb7, 0xeec3373b),
+	TOBN(0x8b443f45, 0xe4a4bd0d), TOBN(0xdb26f0e9, 0x404481e2),
+	TOBN(0x52a0b58c, 0xf7d7e6ed), TOBN(0xa6e9cc0e, 0x6ee216ff),
+	TOBN(0xe75b3abf, 0xd6be6de7), TOBN(0xec72580a, 0xd428d9ac),
+	TOBN(0xbd16e2ce, 0x2011f060), TOBN(0xae55c16a, 0xc6d65cc9),
+	TOBN(0xec35fadc, 0x04f00092), TOBN(0x6b0ca5d8, 0xfc8cb1d7),
+	TOBN(0x21e18fbb, 0x74d01d08), TOBN(0x1491f868, 0xafe927ac),
+	TOBN(0xab6a118f, 0xfc5d0b8c), TOBN(0x25bf352e, 0x7623902f),
+	TOBN(0x249af2c8, 0x9fa2bc1d), TOBN(0xe47ab0f2, 0x323a0b11),
+	TOBN(0xbb9c3c69, 0xc72e9768), TOBN(0x2809ef54, 0xa8195322),
+	TOBN(0x7d363d6b, 0xb65afb6d), TOBN(0xb9e4f422, 0x7e17b7df),
+	TOBN(0x33630b87, 0x563be95f), TOBN(0x69d62f77, 0x5225c6f2),
+	TOBN(0xafc28dec, 0x24868e59), TOBN(0x9b45688c, 0xf49cbc92),
+	TOBN(0xa64fd3b2, 0xd81f4cbb), TOBN(0xc1ee5ad1, 0x26a3c4fd),
+	TOBN(0x4218beea, 0xccea4c7a), TOBN(0x9c39ee18, 0xa78732ed),
+	TOBN(0x2c889d59, 0xcbced551), TOBN(0xcbe04875, 0x1c3485c0),
+	TOBN(0xcea1b226, 0xf70ce7dc), TOBN(0xeae06963, 0x070dbf3a),
+	TOBN(0x3ef53b33, 0xd7d1cb12), TOBN(0x2502369d, 0xcb4d7aff),
+	TOBN(0x773a311f, 0x514bb49d), TOBN(0x4dccec04, 0xb6c58a3c),
+	TOBN(0xacefd130, 0x4ad4a1c2), TOBN(0xe0e6abb3, 0x5c226843),
+	TOBN(0xb140bd5b, 0xc044d286), TOBN(0x82bb880c, 0x43024f63),
+	TOBN(0x895a19b3, 0x37bbe96d), TOBN(0x9f9e4990, 0x68e3ed6a),
+    },
+    {
+	TOBN(0xa28e3975, 0x0f88f32e), TOBN(0x73e9348b, 0x65b3bf01),
+	TOBN(0x64884501, 0xfb3782ea), TOBN(0x1f3c62ab, 0xa4b1be79),
+	TOBN(0x6a973c10, 0xacbfdb61), TOBN(0x2a6a1afb, 0xb605283f),
+	TOBN(0x30e41843, 0x747b11b9), TOBN(0x898835c7, 0xc47d738a),
+	TOBN(0x0c9ab7af, 0xeae668df), TOBN(0x52714030, 0xba64d148),
+	TOBN(0x78a9ceb9, 0x95d6c19c), TOBN(0xcbfebd1c, 0x2d8320ce),
+	TOBN(0x3c258e6e, 0xd8eca2ed), TOBN(0xd46f9332, 0x21fc007d),
+	TOBN(0xbcad01d3, 0xfb6d65d6), TOBN(0x691c093b, 0xb07c5da8),
+	TOBN(0xe929b060, 0x3f98ffee), TOBN(0x0b25ba7f, 0x24a9d2ae),
+	TOBN(0x87b915bb, 0x5a9179f3), TOBN(0xb7ec0f8e, 0xad1d9ef6),
+	TOBN(0x8193470d, 0xecaecfb1), TOBN(0x277e3598, 0xe05438d2),
+	TOBN(0xe080421c, 0xa151a260), TOBN(0x325a6e20, 0x8aa7c247),
+	TOBN(0xe309f6d5, 0x8d579ad6), TOBN(0xef66dbc8, 0x329eb8c6),
+	TOBN(0xe9f0584b, 0x8e9a3069), TOBN(0x67c2c024, 0xbadbb14a),
+	TOBN(0x0f46f27e, 0x92253ff4), TOBN(0xd7741de6, 0x2ae8d789),
+	TOBN(0xde57e7c9, 0x0dc42af2), TOBN(0xabcbcc88, 0xb40e2922),
+	TOBN(0xb1bae96b, 0x0c5e9714), TOBN(0xfc0fc6fa, 0x79a5ad2f),
+	TOBN(0x7fd233b9, 0x36cd428a), TOBN(0x2b9780e0, 0xa804d839),
+	TOBN(0xc6e49fc2, 0x3ec46128), TOBN(0x814a0fac, 0x4cf9f532),
+	TOBN(0x5be69295, 0xb2cc4b43), TOBN(0xff3d4b84, 0x7d84ac63),
+	TOBN(0xb7b3c367, 0xc382ec3a), TOBN(0x938844f3, 0x4be5519a),
+	TOBN(0x44b83469, 0x346987c7), TOBN(0xe176e731, 0x41c33e1c),
+	TOBN(0x3ee933d2, 0x3ebe7207), TOBN(0xea246fc4, 0xef3007d1),
+	TOBN(0x0977f51d, 0xc4f9a924), TOBN(0x6b9961c0, 0x646a909d),
+    },
+    {
+	TOBN(0x783cf3be, 0x45831074), TOBN(0x6622814a, 0x878fc6fc),
+	TOBN(0x375bfd0a, 0x9eee1f8a), TOBN(0x5cd7e4e3, 0x817196ad),
+	TOBN(0xf78d1582, 0xcda3f36d), TOBN(0x6b4c5a2e, 0xfaa309ee),
+	TOBN(0xa05cf94e, 0x66a0070c), TOBN(0x973792e8, 0xf9510170),
+	TOBN(0xdcec41d5, 0x647539ac), TOBN(0xb5e8ce05, 0xa5adcb06),
+	TOBN(0x8f97488b, 0xb72efcc2), TOBN(0x7ec5fb97, 0xdd9b0339),
+	TOBN(0x235e252f, 0xd334f09e), TOBN(0x1d078174, 0x0b676e73),
+	TOBN(0x871e6d0b, 0x33eb4bd7), TOBN(0x6d6f2637, 0x62b07cc5),
+	TOBN(0x0c2960eb, 0x227dbe7d), TOBN(0x6f60f6d6, 0x2e3cfdd0),
+	TOBN(0xfc7d6249, 0x282f25ad), TOBN(0x2e5b2e9a, 0x7e458191),
+	TOBN(0x5c0612c5, 0x343fc578), TOBN(0xe555e783, 0x4e4a17c6),
+	TOBN(0x084f9436, 0x124daf2d), TOBN(0xe25b6806, 0xd2f35970),
+	TOBN(0xf51f4166, 0x208f5232), TOBN(0x299299cb, 0xeec47b35),
+	TOBN(0x9116125f, 0x89d69d8b), TOBN(0x8af8c38d, 0x6536265f),
+	TOBN(0x9a06770a, 0x7d5f1a51), TOBN(0x313ddf53, 0xf8ca0118),
+	TOBN(0x0fc4a2bd, 0xec00a82e), TOBN(0xdb2801c6, 0x68f14a0d),
+	TOBN(0x34e63051, 0x66950f45), TOBN(0xd95bdd6d, 0x616da534),
+	TOBN(0x9093c487, 0x7060b129), TOBN(0x41b91f6b, 0x8c6b77a3),
+	TOBN(0xcf39b4c3, 0x1bbbf041), TOBN(0x66715181, 0xb1dfbbeb),
+	TOBN(0x008ef475, 0x46293517), TOBN(0x8a1cffcf, 0x10df1b7a),
+	TOBN(0xc4bcfdcd, 0xb538d565), TOBN(0xd9e75508, 0xc7009aa4),
+	TOBN(0xd378b62a, 0x80594361), TOBN(0xca9cabf2, 0xd72d3d29),
+	TOBN(0x54831194, 0x0c6f9c0a), TOBN(0xf0106040, 0x15c323f2),
+	TOBN(0x1cdc7ebf, 0x6bbd559d), TOBN(0x21db203c, 0xbb43618a),
+    },
+    {
+	TOBN(0xcf6423f2, 0xec18ff6b), TOBN(0x72d22941, 0x3071117b),
+	TOBN(0x5ed9b7fb, 0xecd5be8f), TOBN(0x648b4550, 0x0f3ef5cf),
+	TOBN(0xc5298edd, 0x84fe23f1), TOBN(0x250a80bf, 0x038865da),
+	TOBN(0xe58e9526, 0xa69d4635), TOBN(0x5acf96b0, 0xdb346fdf),
+	TOBN(0x6004582a, 0x4622a2a2), TOBN(0x9ab89245, 0x83dc4a04),
+	TOBN(0xe755b6d3, 0x06504984), TOBN(0xb9c23685, 0x4cf09091),
+	TOBN(0xf1b2dd43, 0x83847399), TOBN(0xe792de37, 0x178ba803),
+	TOBN(0xf6d509e2, 0x596bb9a8), TOBN(0x51b26ad2, 0x5bd24b6a),
+	TOBN(0x233e1091, 0xb1004084), TOBN(0x30ba3276, 0xd502d5e3),
+	TOBN(0x47a5699c, 0xd8e2246e), TOBN(0x7d32f537, 0xe81220e4),
+	TOBN(0x4a980e5a, 0x3484376c), TOBN(0x829d0462, 0x3dd2aa5f),
+	TOBN(0xc8756df0, 0xaef8fb37), TOBN(0x5454bef7, 0xb0171b49),
+	TOBN(0xbf61a3f9, 0x4718ed5c), TOBN(0x5e95b389, 0x8b920de0),
+	TOBN(0x785263a7, 0x065843ae), TOBN(0xd9bfe2f6, 0x4db24a42),
+	TOBN(0x6421430c, 0x4c22c870), TOBN(0x7696eb2f, 0x3da7e065),
+	TOBN(0xee7e99f0, 0x4ae3d346), TOBN(0xf36abb97, 0x45d33c4a),
+	TOBN(0xae9ffc7a, 0xf13b6984), TOBN(0x41ae523e, 0x53d3ec14),
+	TOBN(0x30e5329b, 0xdf82d44e), TOBN(0xdc72d592, 0xfd315767),
+	TOBN(0xb932020e, 0x46230801), TOBN(0x9a2581e1, 0x66aa670f),
+	TOBN(0x2501de74, 0x0848f278), TOBN(0xc9e9f1b7, 0x22de40d3),
+	TOBN(0x5a14e488, 0x4fc7a149), TOBN(0x8cd9d81c, 0xf08c2889),
+	TOBN(0xa3cd25b3, 0x4927f572), TOBN(0x230d3ef0, 0x781ccb1b),
+	TOBN(0x0b326bf2, 0x52313400), TOBN(0x1660202b, 0xf384f5ea),
+	TOBN(0x31cbe6f1, 0x9fcd89e1), TOBN(0x0f065d25, 0xb66bf4f5),
+    },
+    {
+	TOBN(0x11d7bd16, 0xdccfa7f9), TOBN(0x34962b63, 0x5f7e1db4),
+	TOBN(0xa34673dc, 0x74bf099e), TOBN(0x26ac80bf, 0xf9f01b93),
+	TOBN(0x6190ce23, 0xb8b66dd0), TOBN(0x70a638af, 0x0d011399),
+	TOBN(0x0094ddc0, 0xc1b48d3d), TOBN(0x914d3187, 0x26579cdf),
+	TOBN(0x7adc3c47, 0xb7b0f9d7), TOBN(0x3a050d00, 0x93eaa5b1),
+	TOBN(0x718f5339, 0xf7787958), TOBN(0x025ae140, 0xb48647b6),
+	TOBN(0xd9ce22eb, 0x90cfea28), TOBN(0xf60796ab, 0x6074e74a),
+	TOBN(0xdf6a64cc, 0x9b795e00), TOBN(0xc7431bda, 0xf979e9b5),
+	TOBN(0x518c653b, 0x684cc5db), TOBN(0x6467de6f, 0x0db0a86d),
+	TOBN(0x10fce36e, 0x83e96a72), TOBN(0xa9386cf3, 0xd616cddd),
+	TOBN(0x4ca4a1de, 0x28f79588), TOBN(0x9930b050, 0x50709c3a),
+	TOBN(0xa9c3bceb, 0x6860aab9), TOBN(0xc95a8620, 0x8411e474),
+	TOBN(0x3eeb77b5, 0x14e85612), TOBN(0x514c233a, 0xd0daeb93),
+	TOBN(0x71e23de5, 0xd0b73060), TOBN(0xdb6cd51c, 0xe7adcf47),
+	TOBN(0x8e99444e, 0xf3f3293c), TOBN(0xf3f2d832, 0x3304a498),
+	TOBN(0x27be79c4, 0x097ed020), TOBN(0x0920f951, 0xd9777e83),
+	TOBN(0x80b2d2f0, 0xdb180555), TOBN(0x2e4df8f8, 0xaac7bf15),
+	TOBN(0xd53caa01, 0x228557ee), TOBN(0xe6a610d4, 0xccc17635),
+	TOBN(0xc04c0de6, 0x16404c1d), TOBN(0x15f69bdd, 0x3fe64906),
+	TOBN(0xfbb19df0, 0xbc5e1c2b), TOBN(0x3b6ee595, 0x73280a03),
+	TOBN(0x88b85ef8, 0xf232d376), TOBN(0xd1c803fe, 0x3a5bf047),
+	TOBN(0x9968d1f0, 0x3e382fbe), TOBN(0xca00de8f, 0x8fe4853c),
+	TOBN(0xe9eab1af, 0x2db799cd), TOBN(0x025ef686, 0x07870b34),
+	TOBN(0x3e24bd21, 0x8da42945), TOBN(0x95bbb094, 0xb6072b13),
+    },
+};
+
+static const BN_ULONG dh_comb_p4096[] = {
+	TOBN(0xffffffff, 0xffffffff), TOBN(0x4df435c9, 0x34063199),
+	TOBN(0x86ffb7dc, 0x90a6c08f), TOBN(0x93b4ea98, 0x8d8fddc1),
+	TOBN(0xd0069127, 0xd5b05aa9), TOBN(0xb81bdd76, 0x2170481c),
+	TOBN(0x1f612970, 0xcee2d7af), TOBN(0x233ba186, 0x515be7ed),
+	TOBN(0x99b2964f, 0xa090c3a2), TOBN(0x287c5947, 0x4e6bc05d),
+	TOBN(0x2e8efc14, 0x1fbecaa6), TOBN(0xdbbbc2db, 0x04de8ef9),
+	TOBN(0x2583e9ca, 0x2ad44ce8), TOBN(0x1a946834, 0xb6150bda),
+	TOBN(0x99c32718, 0x6af4e23c), TOBN(0x88719a10, 0xbdba5b26),
+	TOBN(0x1a723c12, 0xa787e6d7), TOBN(0x4b82d120, 0xa9210801),
+	TOBN(0x43db5bfc, 0xe0fd108e), TOBN(0x08e24fa0, 0x74e5ab31),
+	TOBN(0x770988c0, 0xbad946e2), TOBN(0xbbe11757, 0x7a615d6c),
+	TOBN(0x521f2b18, 0x177b200c), TOBN(0xd8760273, 0x3ec86a64),
+	TOBN(0xf12ffa06, 0xd98a0864), TOBN(0xcee3d226, 0x1ad2ee6b),
+	TOBN(0x1e8c94e0, 0x4a25619d), TOBN(0xabf5ae8c, 0xdb0933d7),
+	TOBN(0xb3970f85, 0xa6e1e4c7), TOBN(0x8aea7157, 0x5d060c7d),
+	TOBN(0xecfb8504, 0x58dbef0a), TOBN(0xa85521ab, 0xdf1cba64),
+	TOBN(0xad33170d, 0x04507a33), TOBN(0x15728e5a, 0x8aaac42d),
+	TOBN(0x15d22618, 0x98fa0510), TOBN(0x3995497c, 0xea956ae5),
+	TOBN(0xde2bcbf6, 0x95581718), TOBN(0xb5c55df0, 0x6f4c52c9),
+	TOBN(0x9b2783a2, 0xec07a28f), TOBN(0xe39e772c, 0x180e8603),
+	TOBN(0x32905e46, 0x2e36ce3b), TOBN(0xf1746c08, 0xca18217c),
+	TOBN(0x670c354e, 0x4abc9804), TOBN(0x9ed52907, 0x7096966d),
+	TOBN(0x1c62f356, 0x208552bb), TOBN(0x83655d23, 0xdca3ad96),
+	TOBN(0x69163fa8, 0xfd24cf5f), TOBN(0x98da4836, 0x1c55d39a),
+	TOBN(0xc2007cb8, 0xa163bf05), TOBN(0x49286651, 0xece45b3d),
+	TOBN(0xae9f2411, 0x7c4b1fe6), TOBN(0xee386bfb, 0x5a899fa5),
+	TOBN(0x0bff5cb6, 0xf406b7ed), TOBN(0xf44c42e9, 0xa637ed6b),
+	TOBN(0xe485b576, 0x625e7ec6), TOBN(0x4fe1356d, 0x6d51c245),
+	TOBN(0x302b0a6d, 0xf25f1437), TOBN(0xef9519b3, 0xcd3a431b),
+	TOBN(0x514a0879, 0x8e3404dd), TOBN(0x020bbea6, 0x3b139b22),
+	TOBN(0x29024e08, 0x8a67cc74), TOBN(0xc4c6628b, 0x80dc1cd1),
+	TOBN(0xc90fdaa2, 0x2168c234), TOBN(0xffffffff, 0xffffffff),
+};
+
+static const BN_ULONG
+dh_comb_table4096[DH_COMB_TABLES << DH_COMB_TEETH][4096 / BN_BITS2] = {
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xb20bca36, 0xcbf9ce66),
+	TOBN(0x79004823, 0x6f593f70), TOBN(0x6c4b1567, 0x7270223e),
+	TOBN(0x2ff96ed8, 0x2a4fa556), TOBN(0x47e42289, 0xde8fb7e3),
+	TOBN(0xe09ed68f, 0x311d2850), TOBN(0xdcc45e79, 0xaea41812),
+	TOBN(0x664d69b0, 0x5f6f3c5d), TOBN(0xd783a6b8, 0xb1943fa2),
+	TOBN(0xd17103eb, 0xe0413559), TOBN(0x24443d24, 0xfb217106),
+	TOBN(0xda7c1635, 0xd52bb317), TOBN(0xe56b97cb, 0x49eaf425),
+	TOBN(0x663cd8e7, 0x950b1dc3), TOBN(0x778e65ef, 0x4245a4d9),
+	TOBN(0xe58dc3ed, 0x58781928), TOBN(0xb47d2edf, 0x56def7fe),
+	TOBN(0xbc24a403, 0x1f02ef71), TOBN(0xf71db05f, 0x8b1a54ce),
+	TOBN(0x88f6773f, 0x4526b91d), TOBN(0x441ee8a8, 0x859ea293),
+	TOBN(0xade0d4e7, 0xe884dff3), TOBN(0x2789fd8c, 0xc137959b),
+	TOBN(0x0ed005f9, 0x2675f79b), TOBN(0x311c2dd9, 0xe52d1194),
+	TOBN(0xe1736b1f, 0xb5da9e62), TOBN(0x540a5173, 0x24f6cc28),
+	TOBN(0x4c68f07a, 0x591e1b38), TOBN(0x75158ea8, 0xa2f9f382),
+	TOBN(0x13047afb, 0xa72410f5), TOBN(0x57aade54, 0x20e3459b),
+	TOBN(0x52cce8f2, 0xfbaf85cc), TOBN(0xea8d71a5, 0x75553bd2),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x00000000, 0x00000002), TOBN(0x6417946d, 0x97f39ccc),
+	TOBN(0xf2009046, 0xdeb27ee1), TOBN(0xd8962ace, 0xe4e0447c),
+	TOBN(0x5ff2ddb0, 0x549f4aac), TOBN(0x8fc84513, 0xbd1f6fc6),
+	TOBN(0xc13dad1e, 0x623a50a0), TOBN(0xb988bcf3, 0x5d483025),
+	TOBN(0xcc9ad360, 0xbede78bb), TOBN(0xaf074d71, 0x63287f44),
+	TOBN(0xa2e207d7, 0xc0826ab3), TOBN(0x48887a49, 0xf642e20d),
+	TOBN(0xb4f82c6b, 0xaa57662e), TOBN(0xcad72f96, 0x93d5e84b),
+	TOBN(0xcc79b1cf, 0x2a163b87), TOBN(0xef1ccbde, 0x848b49b2),
+	TOBN(0xcb1b87da, 0xb0f03250), TOBN(0x68fa5dbe, 0xadbdeffd),
+	TOBN(0x78494806, 0x3e05dee3), TOBN(0xee3b60bf, 0x1634a99d),
+	TOBN(0x11ecee7e, 0x8a4d723b), TOBN(0x883dd151, 0x0b3d4527),
+	TOBN(0x5bc1a9cf, 0xd109bfe6), TOBN(0x4f13fb19, 0x826f2b37),
+	TOBN(0x1da00bf2, 0x4cebef36), TOBN(0x62385bb3, 0xca5a2328),
+	TOBN(0xc2e6d63f, 0x6bb53cc4), TOBN(0xa814a2e6, 0x49ed9851),
+	TOBN(0x98d1e0f4, 0xb23c3670), TOBN(0xea2b1d51, 0x45f3e704),
+	TOBN(0x2608f5f7, 0x4e4821ea), TOBN(0xaf55bca8, 0x41c68b36),
+	TOBN(0xa599d1e5, 0xf75f0b98), TOBN(0xd51ae34a, 0xeaaa77a4),
+	TOBN(0xd45bb3ce, 0xce0bf5df), TOBN(0x8cd56d06, 0x2ad52a35),
+	TOBN(0x43a86812, 0xd54fd1cf), TOBN(0x9475441f, 0x21675a6c),
+	TOBN(0xc9b0f8ba, 0x27f0bae0), TOBN(0x38c311a7, 0xcfe2f3f8),
+	TOBN(0x9adf4373, 0xa3926388), TOBN(0x1d1727ee, 0x6bcfbd07),
+	TOBN(0x31e79563, 0x6a86cff6), TOBN(0xc255adf1, 0x1ed2d325),
+	TOBN(0xc73a1953, 0xbef55a88), TOBN(0xf93545b8, 0x46b8a4d3),
+	TOBN(0x2dd380ae, 0x05b66140), TOBN(0xce4b6f93, 0xc75458cb),
+	TOBN(0x7bff068e, 0xbd3881f4), TOBN(0x6daf335c, 0x26374984),
+	TOBN(0xa2c1b7dd, 0x0769c033), TOBN(0x238f2809, 0x4aecc0b4),
+	TOBN(0xe8014692, 0x17f29024), TOBN(0x17677a2c, 0xb3902529),
+	TOBN(0x36f49513, 0x3b430272), TOBN(0x603d9525, 0x255c7b74),
+	TOBN(0x9fa9eb24, 0x1b41d791), TOBN(0x20d5cc98, 0x658b79c9),
+	TOBN(0x5d6bef0c, 0xe397f644), TOBN(0xfbe882b3, 0x89d8c9bb),
+	TOBN(0xadfb63ee, 0xeb306717), TOBN(0x76733ae8, 0xfe47c65d),
+	TOBN(0x6de04abb, 0xbd2e7b96), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x15a4f424, 0x40d9cad6), TOBN(0xe0206207, 0x9a61764c),
+	TOBN(0xf39f3794, 0xd774dcf0), TOBN(0x698d2401, 0x5d133ff1),
+	TOBN(0xea923708, 0xfb12112d), TOBN(0x1d7369c8, 0x597cf32c),
+	TOBN(0x128e2fd1, 0x548c8bfd), TOBN(0xd033e0fc, 0xead63191),
+	TOBN(0xbd498842, 0x7a4eae83), TOBN(0x89b83b57, 0x1e3ea2c3),
+	TOBN(0x8131f063, 0x1abc352f), TOBN(0x2e46ecbf, 0x0e6b9cf1),
+	TOBN(0x1f166544, 0x8811e156), TOBN(0x317aea31, 0xe60e4c20),
+	TOBN(0x25cbccfd, 0x1c2ae5a8), TOBN(0x7c247854, 0x069e1e4b),
+	TOBN(0x1f50e6c3, 0x3e4c7e1e), TOBN(0x175f5c10, 0x47e0d92c),
+	TOBN(0xb1f25009, 0x28ce01ad), TOBN(0xc0cb653e, 0x058c08b9),
+	TOBN(0x33e5724b, 0x6078b7c8), TOBN(0xee898027, 0x80087100),
+	TOBN(0xacddce69, 0xe68aee31), TOBN(0xea6e627d, 0x2e49700a),
+	TOBN(0x542b2e14, 0xc9605a70), TOBN(0x05751946, 0x05b02d5c),
+	TOBN(0x4904faa8, 0x7bdaaf54), TOBN(0xaf73c104, 0xe27daccb),
+	TOBN(0xed129d53, 0xd55692c7), TOBN(0x6099222f, 0x314e5080),
+	TOBN(0xf27d9998, 0x2e54c646), TOBN(0x4b968511, 0xb6bd04b7),
+	TOBN(0x9534b2c4, 0xb0e67ffd), TOBN(0x9b7d3bf7, 0x96647281),
+	TOBN(0xeff6ca22, 0x26b03b11), TOBN(0x34d008d5, 0x2f1ae2a3),
+	TOBN(0x5a5a0202, 0xcc50eaaa), TOBN(0xbdb565df, 0x7deaeeb3),
+	TOBN(0xc376c5c7, 0x64364f96), TOBN(0x3f250988, 0xb1019c87),
+	TOBN(0xa8fefb58, 0xfdb43105), TOBN(0xf2526ce9, 0x1a5abcc5),
+	TOBN(0xa7a94e0a, 0xc016258a), TOBN(0xa471c7d1, 0x58845fa7),
+	TOBN(0x3e2ac90f, 0xd4536b8d), TOBN(0xb612cd66, 0xa419ec75),
+	TOBN(0xabca30f8, 0x7bf8f2c5), TOBN(0xef164658, 0x917c4b76),
+	TOBN(0x98faf4b0, 0xffdced95), TOBN(0x6747b709, 0x2ffc9870),
+	TOBN(0x8eaa235f, 0xd9a7f13c), TOBN(0xa3c8da4f, 0x5e327578),
+	TOBN(0x834fb3c1, 0x92d5ab07), TOBN(0xcd6ba725, 0xc9a5441d),
+	TOBN(0x36400673, 0xfccf127d), TOBN(0xe7607257, 0xc148a5a1),
+	TOBN(0x4f8844aa, 0xc6fa7029), TOBN(0x1243f01f, 0xeb41b782),
+	TOBN(0x795356de, 0xb19b9e09), TOBN(0xad01f132, 0xff45bcee),
+	TOBN(0x6ac7645a, 0x53c8b7ae), TOBN(0xb50b14eb, 0x8101e838),
+	TOBN(0x2872a45c, 0xcdc7b9ee), TOBN(0x8f5ca265, 0xea9cf285),
+    },
+    {
+	TOBN(0x2b49e848, 0x81b395ad), TOBN(0x724c8e46, 0x00bcbafe),
+	TOBN(0x603eb74d, 0x1e42f952), TOBN(0x3f655d6a, 0x2c96a222),
+	TOBN(0x051ddcea, 0x2073c7b1), TOBN(0x82caf61a, 0x91899e3d),
+	TOBN(0x05bb3631, 0xda36404a), TOBN(0x7d2c2073, 0x84507b35),
+	TOBN(0xe0e07a35, 0x540c9965), TOBN(0xeaf41d66, 0xee118529),
+	TOBN(0xd3d4e4b2, 0x15b99fb8), TOBN(0x80d216a3, 0x17f8aae9),
+	TOBN(0x18a8e0be, 0xe54f75c3), TOBN(0x48616c2f, 0x16078c66),
+	TOBN(0xb1d472e1, 0xcd60e914), TOBN(0x6fd75697, 0x4f81e16f),
+	TOBN(0x242f9173, 0xd5111565), TOBN(0xe33be6ff, 0xe6a0aa57),
+	TOBN(0x20094415, 0x709ef2cb), TOBN(0x78b47adb, 0x96326642),
+	TOBN(0xf0c15bd6, 0x061828af), TOBN(0x2131e8f7, 0x85af8493),
+	TOBN(0x079c71bb, 0xb59abc57), TOBN(0xfc66c287, 0x1dca75b1),
+	TOBN(0xb7266222, 0xb936ac7c), TOBN(0x3c066065, 0xf08d6c4c),
+	TOBN(0x737d6070, 0xad8ffd0a), TOBN(0xb2f1d37c, 0xe9f225bf),
+	TOBN(0x268e2b22, 0x03cb40c7), TOBN(0x3647d307, 0x05969484),
+	TOBN(0xf7ffae2c, 0x03cd9d82), TOBN(0xeed7e877, 0x8e5d4f0a),
+	TOBN(0x7d364e7c, 0x5d7c85c6), TOBN(0x2187e994, 0xa21e20d5),
+	TOBN(0xca1b6e2b, 0xb4667113), TOBN(0x300ac82d, 0x73a05a62),
+	TOBN(0xd688380f, 0x0349be3c), TOBN(0xc5a56dce, 0x8c898a9c),
+	TOBN(0xebc607eb, 0xdc64fc9d), TOBN(0x9aab9be5, 0x49f4b30b),
+	TOBN(0x1f6d986b, 0xcd3193ce), TOBN(0xf3306dc9, 0x6a9d580f),
+	TOBN(0xe84666c7, 0x356fb310), TOBN(0xaa0e669b, 0x407228e1),
+	TOBN(0x5ff29ec9, 0x8821845f), TOBN(0xe8c03da9, 0x6b902b54),
+	TOBN(0xee7e2247, 0xfacd162b), TOBN(0x4552447b, 0x06a2c352),
+	TOBN(0x6ff56ca9, 0x5e561c26), TOBN(0x856707c0, 0x7314d5a3),
+	TOBN(0x6eb522ae, 0x3704c292), TOBN(0x595948a3, 0x61db4b4b),
+	TOBN(0xfaa00acc, 0x31a49e21), TOBN(0xa68b0b61, 0xed129acf),
+	TOBN(0x87fa5771, 0x973fa634), TOBN(0x7edfaf42, 0x153f88fc),
+	TOBN(0x6ee57ee7, 0x9b95cc1c), TOBN(0x34f2c68c, 0x09492be9),
+	TOBN(0xa15ca543, 0xd5033734), TOBN(0x57f823bf, 0xc377deba),
+	TOBN(0xac8c7aac, 0x1d29a2e9), TOBN(0xa54fc74b, 0x8127b39f),
+	TOBN(0x87d56e17, 0x7a26b1a8), TOBN(0x1eb944cb, 0xd539e50a),
+    },
+    {
+	TOBN(0xab0eb7d3, 0x40cd500a), TOBN(0x4202dfe3, 0x219f966c),
+	TOBN(0xff091c67, 0xc57d4357), TOBN(0x49caeb63, 0xf13c5734),
+	TOBN(0xf47d6807, 0xeefc20e8), TOBN(0xb0619279, 0x7c6c93c7),
+	TOBN(0x0c59b182, 0x5350649a), TOBN(0x4b2a224f, 0x96492923),
+	TOBN(0x91fdd385, 0x14a904ad), TOBN(0x697cf5b1, 0x49b2e239),
+	TOBN(0xb783086e, 0xc8260565), TOBN(0x23e529ab, 0x9476604d),
+	TOBN(0x09d45393, 0x117f5505), TOBN(0x49b246a2, 0xb1a8e795),
+	TOBN(0xc5271ba9, 0xca951c9c), TOBN(0x2453ac5a, 0x003e2587),
+	TOBN(0xad158ddf, 0x07962e42), TOBN(0xebbe7b3f, 0x38984a32),
+	TOBN(0x13c1f55d, 0xabe46aae), TOBN(0xcd5a42c0, 0xe26b1731),
+	TOBN(0xbdc068aa, 0xb3959051), TOBN(0x43819022, 0xf34a0699),
+	TOBN(0x1c889dea, 0xb61701c2), TOBN(0x1864c5bf, 0xd605d9ce),
+	TOBN(0xe26349cd, 0xa8ee7f20), TOBN(0x23d6b5f8, 0xfab9bc16),
+	TOBN(0xc79712a4, 0x498c120f), TOBN(0xd6b8be84, 0x01e92aec),
+	TOBN(0x1b62b307, 0x1e9156e2), TOBN(0x50a6a030, 0xc88a6e2e),
+	TOBN(0xbd124945, 0x668be683), TOBN(0x0003f13d, 0x4f89e480),
+	TOBN(0xf522db47, 0x6ab3c657), TOBN(0x57221bd0, 0x7a59eca5),
+	TOBN(0x2549f8d3, 0x5068282f), TOBN(0x581fcf8b, 0x9bf4019d),
+	TOBN(0x24b0f0c8, 0x738bfd82), TOBN(0xb5ff1f88, 0x36e9b769),
+	TOBN(0xc2fff22e, 0x302f32b5), TOBN(0x04de4a3e, 0x3c283f56),
+	TOBN(0x6d80e30a, 0xddb3ce08), TOBN(0xfe4ab2e6, 0x63b98fb4),
+	TOBN(0xa636e5c5, 0xb84c0695), TOBN(0x77c60f25, 0x9fd09843),
+	TOBN(0xf415f28d, 0xdffd6c7f), TOBN(0xc9325078, 0xd53566c1),
+	TOBN(0x315f6dcc, 0x52983ff6), TOBN(0xab0d580c, 0x52ec3920),
+	TOBN(0xf47cb45a, 0x5902e875), TOBN(0xf35eadb1, 0x84c33271),
+	TOBN(0xb890650a, 0xd44de82a), TOBN(0x30c152d3, 0xd04307a9),
+	TOBN(0x62c41ce3, 0x428443e6), TOBN(0x3c3a5233, 0x2ded0248),
+	TOBN(0x6efc0b0f, 0x39da169b), TOBN(0x163457c9, 0xe0805a52),
+	TOBN(0xc02c2ade, 0xc459ab03), TOBN(0x7d91d3b6, 0x0ad465ba),
+	TOBN(0x22a282ff, 0x773a473d), TOBN(0xda92ef51, 0xa6be117f),
+	TOBN(0xeb9d6173, 0x91c62e1f), TOBN(0x5ca7d828, 0x9bc50e52),
+	TOBN(0x98e71685, 0x984d9148), TOBN(0x3ff994ef, 0xb8e729d4),
+    },
+    {
+	TOBN(0x561d6fa6, 0x819aa014), TOBN(0x8405bfc6, 0x433f2cd9),
+	TOBN(0xfe1238cf, 0x8afa86ae), TOBN(0x9395d6c7, 0xe278ae69),
+	TOBN(0xe8fad00f, 0xddf841d0), TOBN(0x60c324f2, 0xf8d9278f),
+	TOBN(0x18b36304, 0xa6a0c935), TOBN(0x9654449f, 0x2c925246),
+	TOBN(0x23fba70a, 0x2952095a), TOBN(0xd2f9eb62, 0x9365c473),
+	TOBN(0x6f0610dd, 0x904c0aca), TOBN(0x47ca5357, 0x28ecc09b),
+	TOBN(0x13a8a726, 0x22feaa0a), TOBN(0x93648d45, 0x6351cf2a),
+	TOBN(0x8a4e3753, 0x952a3938), TOBN(0x48a758b4, 0x007c4b0f),
+	TOBN(0x5a2b1bbe, 0x0f2c5c84), TOBN(0xd77cf67e, 0x71309465),
+	TOBN(0x2783eabb, 0x57c8d55d), TOBN(0x9ab48581, 0xc4d62e62),
+	TOBN(0x7b80d155, 0x672b20a3), TOBN(0x87032045, 0xe6940d33),
+	TOBN(0x39113bd5, 0x6c2e0384), TOBN(0x30c98b7f, 0xac0bb39c),
+	TOBN(0xc4c6939b, 0x51dcfe40), TOBN(0x47ad6bf1, 0xf573782d),
+	TOBN(0x8f2e2548, 0x9318241e), TOBN(0xad717d08, 0x03d255d9),
+	TOBN(0x36c5660e, 0x3d22adc5), TOBN(0xa14d4061, 0x9114dc5c),
+	TOBN(0x7a24928a, 0xcd17cd06), TOBN(0x0007e27a, 0x9f13c901),
+	TOBN(0xea45b68e, 0xd5678cae), TOBN(0xae4437a0, 0xf4b3d94b),
+	TOBN(0x4a93f1a6, 0xa0d0505e), TOBN(0xb03f9f17, 0x37e8033a),
+	TOBN(0x4961e190, 0xe717fb04), TOBN(0x6bfe3f10, 0x6dd36ed2),
+	TOBN(0x85ffe45c, 0x605e656b), TOBN(0x09bc947c, 0x78507ead),
+	TOBN(0xdb01c615, 0xbb679c10), TOBN(0xfc9565cc, 0xc7731f68),
+	TOBN(0x4c6dcb8b, 0x70980d2b), TOBN(0xef8c1e4b, 0x3fa13087),
+	TOBN(0xe82be51b, 0xbffad8fe), TOBN(0x9264a0f1, 0xaa6acd83),
+	TOBN(0x62bedb98, 0xa5307fed), TOBN(0x561ab018, 0xa5d87240),
+	TOBN(0xe8f968b4, 0xb205d0eb), TOBN(0xe6bd5b63, 0x098664e3),
+	TOBN(0x7120ca15, 0xa89bd055), TOBN(0x6182a5a7, 0xa0860f53),
+	TOBN(0xc58839c6, 0x850887cc), TOBN(0x7874a466, 0x5bda0490),
+	TOBN(0xddf8161e, 0x73b42d36), TOBN(0x2c68af93, 0xc100b4a4),
+	TOBN(0x805855bd, 0x88b35606), TOBN(0xfb23a76c, 0x15a8cb75),
+	TOBN(0x454505fe, 0xee748e7a), TOBN(0xb525dea3, 0x4d7c22fe),
+	TOBN(0xd73ac2e7, 0x238c5c3f), TOBN(0xb94fb051, 0x378a1ca5),
+	TOBN(0x31ce2d0b, 0x309b2290), TOBN(0x7ff329df, 0x71ce53a9),
+    },
+    {
+	TOBN(0x3cddfed7, 0xdf68d9af), TOBN(0xbf8e728f, 0x34cad3d8),
+	TOBN(0x3dea793c, 0x414e0e1f), TOBN(0x1094f039, 0xb67546bd),
+	TOBN(0x57dec686, 0x1f686640), TOBN(0x41793235, 0x97f90473),
+	TOBN(0xdcc5cd61, 0x8927c978), TOBN(0x70ee6b88, 0x674e0711),
+	TOBN(0x0ea21afa, 0x3c862aec), TOBN(0x467ffce0, 0x11bb50b8),
+	TOBN(0x72740c2d, 0x7db3324f), TOBN(0xa4316c85, 0x52b2b7db),
+	TOBN(0x5e987cec, 0x09d60450), TOBN(0x87c7ea7d, 0x46e3a9d4),
+	TOBN(0x53cded81, 0xd878227f), TOBN(0xaaedaacc, 0x7676bfa2),
+	TOBN(0xf056cff8, 0x52bc27e2), TOBN(0xec54eae2, 0x4048b865),
+	TOBN(0x19ece478, 0x4f4b3d7b), TOBN(0x96485351, 0xfb505c09),
+	TOBN(0xcf0f5c53, 0x08c4d9a8), TOBN(0xacf1ce0e, 0x370506df),
+	TOBN(0x45bc6b7a, 0xd9812af7), TOBN(0x8e9ffab6, 0xb7e848f2),
+	TOBN(0x83784e6d, 0x80212be3), TOBN(0x3e7feeb3, 0xe7f6cc10),
+	TOBN(0x278cf718, 0x2c02ef50), TOBN(0x0e4f6114, 0xf55581a4),
+	TOBN(0xf6c47b1f, 0x4989c61f), TOBN(0xe89d92ad, 0x9c7b9975),
+	TOBN(0x18ca0955, 0x610f3f05), TOBN(0x020c8427, 0xa5186dbf),
+	TOBN(0x313cf409, 0x65500bfa), TOBN(0x1b9005a5, 0x30eec923),
+	TOBN(0xe75429c6, 0x88b28a21), TOBN(0x78251f0f, 0xa1e6ec87),
+	TOBN(0x7313decd, 0xbaf53028), TOBN(0x344093b3, 0x68965df4),
+	TOBN(0x6221828a, 0xad17b58c), TOBN(0x109da3d2, 0xa0175e95),
+	TOBN(0x46c4729b, 0xe4426e02), TOBN(0x414e789e, 0x8d59bcdb),
+	TOBN(0x26f3f256, 0xa63f6391), TOBN(0x3492ea95, 0x390b2ef7),
+	TOBN(0x34640625, 0x63cb2e12), TOBN(0xa25f6746, 0x326d5081),
+	TOBN(0xc255d61c, 0x02e09863), TOBN(0x02a1c759, 0x885fd9da),
+	TOBN(0xf4200299, 0xd524ee32), TOBN(0x9279c83f, 0x959677ad),
+	TOBN(0xf58bea59, 0x4cef691a), TOBN(0xf9360a01, 0xd90c4359),
+	TOBN(0x9a40b73f, 0x809730fd), TOBN(0x9cb85716, 0x691f53f7),
+	TOBN(0x2b8e8327, 0xd86f0aa6), TOBN(0xb3bcc171, 0x6cafa00d),
+	TOBN(0x275afb07, 0xf9bdc3f6), TOBN(0x0db59d79, 0x4a14baa6),
+	TOBN(0xb0a4e8b0, 0xd7c966f8), TOBN(0x0aab333b, 0x29b2d7cb),
+	TOBN(0x03f7e970, 0xdd04d784), TOBN(0x644e25f7, 0x1efcbdd1),
+	TOBN(0xcd18acf2, 0x1071cac6), TOBN(0x2d44eae0, 0xf79d8ce9),
+    },
+    {
+	TOBN(0x79bbfdaf, 0xbed1b35e), TOBN(0x7f1ce51e, 0x6995a7b0),
+	TOBN(0x7bd4f278, 0x829c1c3f), TOBN(0x2129e073, 0x6cea8d7a),
+	TOBN(0xafbd8d0c, 0x3ed0cc80), TOBN(0x82f2646b, 0x2ff208e6),
+	TOBN(0xb98b9ac3, 0x124f92f0), TOBN(0xe1dcd710, 0xce9c0e23),
+	TOBN(0x1d4435f4, 0x790c55d8), TOBN(0x8cfff9c0, 0x2376a170),
+	TOBN(0xe4e8185a, 0xfb66649e), TOBN(0x4862d90a, 0xa5656fb6),
+	TOBN(0xbd30f9d8, 0x13ac08a1), TOBN(0x0f8fd4fa, 0x8dc753a8),
+	TOBN(0xa79bdb03, 0xb0f044ff), TOBN(0x55db5598, 0xeced7f44),
+	TOBN(0xe0ad9ff0, 0xa5784fc5), TOBN(0xd8a9d5c4, 0x809170cb),
+	TOBN(0x33d9c8f0, 0x9e967af7), TOBN(0x2c90a6a3, 0xf6a0b812),
+	TOBN(0x9e1eb8a6, 0x1189b351), TOBN(0x59e39c1c, 0x6e0a0dbf),
+	TOBN(0x8b78d6f5, 0xb30255ef), TOBN(0x1d3ff56d, 0x6fd091e4),
+	TOBN(0x06f09cdb, 0x004257c7), TOBN(0x7cffdd67, 0xcfed9821),
+	TOBN(0x4f19ee30, 0x5805dea0), TOBN(0x1c9ec229, 0xeaab0348),
+	TOBN(0xed88f63e, 0x93138c3e), TOBN(0xd13b255b, 0x38f732eb),
+	TOBN(0x319412aa, 0xc21e7e0b), TOBN(0x0419084f, 0x4a30db7e),
+	TOBN(0x6279e812, 0xcaa017f4), TOBN(0x37200b4a, 0x61dd9246),
+	TOBN(0xcea8538d, 0x11651442), TOBN(0xf04a3e1f, 0x43cdd90f),
+	TOBN(0xe627bd9b, 0x75ea6050), TOBN(0x68812766, 0xd12cbbe8),
+	TOBN(0xc4430515, 0x5a2f6b18), TOBN(0x213b47a5, 0x402ebd2a),
+	TOBN(0x8d88e537, 0xc884dc04), TOBN(0x829cf13d, 0x1ab379b6),
+	TOBN(0x4de7e4ad, 0x4c7ec722), TOBN(0x6925d52a, 0x72165dee),
+	TOBN(0x68c80c4a, 0xc7965c24), TOBN(0x44bece8c, 0x64daa102),
+	TOBN(0x84abac38, 0x05c130c7), TOBN(0x05438eb3, 0x10bfb3b5),
+	TOBN(0xe8400533, 0xaa49dc64), TOBN(0x24f3907f, 0x2b2cef5b),
+	TOBN(0xeb17d4b2, 0x99ded235), TOBN(0xf26c1403, 0xb21886b3),
+	TOBN(0x34816e7f, 0x012e61fb), TOBN(0x3970ae2c, 0xd23ea7ef),
+	TOBN(0x571d064f, 0xb0de154d), TOBN(0x677982e2, 0xd95f401a),
+	TOBN(0x4eb5f60f, 0xf37b87ed), TOBN(0x1b6b3af2, 0x9429754c),
+	TOBN(0x6149d161, 0xaf92cdf0), TOBN(0x15566676, 0x5365af97),
+	TOBN(0x07efd2e1, 0xba09af08), TOBN(0xc89c4bee, 0x3df97ba2),
+	TOBN(0x9a3159e4, 0x20e3958c), TOBN(0x5a89d5c1, 0xef3b19d3),
+    },
+    {
+	TOBN(0x6a82dc56, 0x4251b125), TOBN(0xf22c04fb, 0xd1e2334a),
+	TOBN(0x4d77c4f6, 0x56d817ea), TOBN(0x905ffa3f, 0xd4ab9735),
+	TOBN(0x06e7777f, 0x40f93ae1), TOBN(0x7119d534, 0x19c781b1),
+	TOBN(0xd300c79d, 0x2eae7e06), TOBN(0x80992e93, 0x70ee30e4),
+	TOBN(0xed51597d, 0xf775c8d9), TOBN(0x58eedb07, 0x8c2d1d22),
+	TOBN(0xe99bc4bb, 0x2456ae3a), TOBN(0xb56023ea, 0x4ebfa74d),
+	TOBN(0xc39d6ed6, 0x0a286b35), TOBN(0xaf44877a, 0x5a952be0),
+	TOBN(0xc289707f, 0x3ad1ce72), TOBN(0x0739ee21, 0xc17e4942),
+	TOBN(0x81afc676, 0x3b938309), TOBN(0xb249bb6e, 0x0b246c47),
+	TOBN(0x6a457a92, 0x57f43d3b), TOBN(0x395d992c, 0xd5bce2ce),
+	TOBN(0xd6d0e642, 0x8210d6e8), TOBN(0x761cd28c, 0xda49166c),
+	TOBN(0x3af502a5, 0x0ec448b1), TOBN(0x40bb7edb, 0xc33e679c),
+	TOBN(0x4b98544d, 0xbf9bb93c), TOBN(0xa5032f61, 0xeed8e6fc),
+	TOBN(0x57d4f597, 0xf1234b67), TOBN(0xbd574461, 0x288f8795),
+	TOBN(0xdfc9ed49, 0x5564f0da), TOBN(0xd62ff891, 0x6ef1e069),
+	TOBN(0x60d37ba4, 0x1b4793ad), TOBN(0x343e7c18, 0x77631cfd),
+	TOBN(0xf80d83f0, 0x22dae134), TOBN(0x9e332e29, 0x21eee659),
+	TOBN(0xd7c07e23, 0x4b459add), TOBN(0x6c5a547f, 0x993064e8),
+	TOBN(0xf2a6a075, 0x8a555f87), TOBN(0x182b34de, 0xda366436),
+	TOBN(0xe133c366, 0x37768f3e), TOBN(0x67b4447b, 0xb18c2d18),
+	TOBN(0x72888da5, 0x023f6995), TOBN(0xce2467fb, 0x1d2c7f11),
+	TOBN(0x130f0f3a, 0x68abb2c5), TOBN(0xe3b60c6b, 0xdf86f9c1),
+	TOBN(0xa2876e3d, 0x40ea0c0b), TOBN(0x63b32e5b, 0x4bb9a15e),
+	TOBN(0x21c6b373, 0x034ead84), TOBN(0xb8b85f41, 0x0b7230fe),
+	TOBN(0xb25c4ac1, 0xfda38eda), TOBN(0x0b7c09b3, 0xe652c398),
+	TOBN(0x0327b794, 0x42293bc1), TOBN(0x2bf01135, 0x6c0938bc),
+	TOBN(0x36b0fb4c, 0x3ff27f99), TOBN(0xac24f816, 0xaa4dac59),
+	TOBN(0x850728c3, 0xb37576a8), TOBN(0x86b16527, 0xdb5d16da),
+	TOBN(0xc35f2229, 0xf27d1572), TOBN(0x55515901, 0xb9ac771b),
+	TOBN(0xa5eabeb2, 0x7010f4c3), TOBN(0xc873efea, 0xaad1ec21),
+	TOBN(0x62985de7, 0x76f4363f), TOBN(0xccf60277, 0x08a6352c),
+	TOBN(0xa7f54206, 0x86a339b3), TOBN(0x0051935b, 0x841d678f),
+    },
+    {
+	TOBN(0xd505b8ac, 0x84a3624a), TOBN(0xe45809f7, 0xa3c46694),
+	TOBN(0x9aef89ec, 0xadb02fd5), TOBN(0x20bff47f, 0xa9572e6a),
+	TOBN(0x0dceeefe, 0x81f275c3), TOBN(0xe233aa68, 0x338f0362),
+	TOBN(0xa6018f3a, 0x5d5cfc0c), TOBN(0x01325d26, 0xe1dc61c9),
+	TOBN(0xdaa2b2fb, 0xeeeb91b3), TOBN(0xb1ddb60f, 0x185a3a45),
+	TOBN(0xd3378976, 0x48ad5c74), TOBN(0x6ac047d4, 0x9d7f4e9b),
+	TOBN(0x873addac, 0x1450d66b), TOBN(0x5e890ef4, 0xb52a57c1),
+	TOBN(0x8512e0fe, 0x75a39ce5), TOBN(0x0e73dc43, 0x82fc9285),
+	TOBN(0x035f8cec, 0x77270612), TOBN(0x649376dc, 0x1648d88f),
+	TOBN(0xd48af524, 0xafe87a77), TOBN(0x72bb3259, 0xab79c59c),
+	TOBN(0xada1cc85, 0x0421add0), TOBN(0xec39a519, 0xb4922cd9),
+	TOBN(0x75ea054a, 0x1d889162), TOBN(0x8176fdb7, 0x867ccf38),
+	TOBN(0x9730a89b, 0x7f377278), TOBN(0x4a065ec3, 0xddb1cdf8),
+	TOBN(0xafa9eb2f, 0xe24696cf), TOBN(0x7aae88c2, 0x511f0f2a),
+	TOBN(0xbf93da92, 0xaac9e1b5), TOBN(0xac5ff122, 0xdde3c0d3),
+	TOBN(0xc1a6f748, 0x368f275b), TOBN(0x687cf830, 0xeec639fa),
+	TOBN(0xf01b07e0, 0x45b5c268), TOBN(0x3c665c52, 0x43ddccb3),
+	TOBN(0xaf80fc46, 0x968b35bb), TOBN(0xd8b4a8ff, 0x3260c9d1),
+	TOBN(0xe54d40eb, 0x14aabf0e), TOBN(0x305669bd, 0xb46cc86d),
+	TOBN(0xc26786cc, 0x6eed1e7c), TOBN(0xcf6888f7, 0x63185a31),
+	TOBN(0xe5111b4a, 0x047ed32a), TOBN(0x9c48cff6, 0x3a58fe22),
+	TOBN(0x261e1e74, 0xd157658b), TOBN(0xc76c18d7, 0xbf0df382),
+	TOBN(0x450edc7a, 0x81d41817), TOBN(0xc7665cb6, 0x977342bd),
+	TOBN(0x438d66e6, 0x069d5b08), TOBN(0x7170be82, 0x16e461fc),
+	TOBN(0x64b89583, 0xfb471db5), TOBN(0x16f81367, 0xcca58731),
+	TOBN(0x064f6f28, 0x84527782), TOBN(0x57e0226a, 0xd8127178),
+	TOBN(0x6d61f698, 0x7fe4ff32), TOBN(0x5849f02d, 0x549b58b2),
+	TOBN(0x0a0e5187, 0x66eaed51), TOBN(0x0d62ca4f, 0xb6ba2db5),
+	TOBN(0x86be4453, 0xe4fa2ae5), TOBN(0xaaa2b203, 0x7358ee37),
+	TOBN(0x4bd57d64, 0xe021e986), TOBN(0x90e7dfd5, 0x55a3d843),
+	TOBN(0xc530bbce, 0xede86c7f), TOBN(0x99ec04ee, 0x114c6a58),
+	TOBN(0x4fea840d, 0x0d467367), TOBN(0x00a326b7, 0x083acf1f),
+    },
+    {
+	TOBN(0x13d09d58, 0xd78161c1), TOBN(0x8c5d8a8e, 0xdf622d96),
+	TOBN(0xf7cd7cde, 0xd12e34bc), TOBN(0x35c733d2, 0x57f528bb),
+	TOBN(0x5fa850e9, 0x669afecf), TOBN(0x9cdc4864, 0xabbbb1e7),
+	TOBN(0xe5d78ff5, 0x42d0b3ba), TOBN(0x0aff3b21, 0x945ff521),
+	TOBN(0xcec6704a, 0xebe0985c), TOBN(0x405e41e0, 0xd8128d49),
+	TOBN(0x6456ed42, 0x5936ed26), TOBN(0xe7a1d9a4, 0xc47d3f40),
+	TOBN(0x3e133ca5, 0x38a1da34), TOBN(0x07571820, 0x3111959e),
+	TOBN(0x7f09a217, 0x4c7c6c5b), TOBN(0x4d6a1d8f, 0xe6359f99),
+	TOBN(0x3a82e5ca, 0x4e9d0623), TOBN(0x603481d7, 0x6de1a90e),
+	TOBN(0xb5202025, 0x76f70c0b), TOBN(0xc8806692, 0x84b65aea),
+	TOBN(0x4f223db3, 0x13916636), TOBN(0xc7fb94cb, 0xd4c14803),
+	TOBN(0xeb93fe16, 0x3e1a95c4), TOBN(0x470bde1f, 0xe93e16be),
+	TOBN(0xebfada85, 0x9191811b), TOBN(0x0c7272f3, 0xd9c57178),
+	TOBN(0x12792478, 0x887e1913), TOBN(0xc02740e7, 0xf71321ee),
+	TOBN(0xd6e2dba6, 0x6b375bb3), TOBN(0xd449843b, 0xc7720abd),
+	TOBN(0xc44224ff, 0x2aebbd59), TOBN(0x61b367a3, 0x85728e98),
+	TOBN(0xf26ed3d9, 0x42380fcc), TOBN(0x42732c90, 0x0bfbc6bc),
+	TOBN(0xb5b38ad2, 0xe0c32946), TOBN(0xd524a1bc, 0xd621d6d3),
+	TOBN(0xce363f92, 0xcdd3ebff), TOBN(0x63065a87, 0x6c5a7dec),
+	TOBN(0x1fa479aa, 0x352ccfd2), TOBN(0x082f0398, 0x57785226),
+	TOBN(0xc6978cee, 0x84d07d1a), TOBN(0xb9464c1c, 0xae69c9be),
+	TOBN(0xb11ff364, 0x6112e181), TOBN(0x8b2fc392, 0xf77075c3),
+	TOBN(0x3a2eb5ba, 0xacf35f54), TOBN(0x930a6a5a, 0xd2511c04),
+	TOBN(0xac739eaf, 0xf34a7e57), TOBN(0xbf7fd39a, 0x28655f51),
+	TOBN(0x7f298eac, 0x1640d4b1), TOBN(0xe27a4c80, 0x4b57b515),
+	TOBN(0xf997f206, 0x405a9735), TOBN(0x0571e98e, 0xf4dbeec3),
+	TOBN(0x5beae05f, 0x265a8c77), TOBN(0xbd22a373, 0xe0e3019d),
+	TOBN(0xdb5dec86, 0xbc3397b9), TOBN(0xcaaa1e66, 0x9d94414c),
+	TOBN(0x457f5567, 0x4101ed1c), TOBN(0x662b6089, 0xa7d547b9),
+	TOBN(0x412f1dee, 0x3142a99a), TOBN(0x00f15dc1, 0x255a79a8),
+	TOBN(0x8ee2f1d9, 0xc041378e), TOBN(0x337a833c, 0xc7810959),
+	TOBN(0x24afd87f, 0x7c67c66d), TOBN(0xa3c65b8a, 0x82b2cdd4),
+    },
+    {
+	TOBN(0x27a13ab1, 0xaf02c383), TOBN(0xcac6df54, 0x8abe2992),
+	TOBN(0x689b41e1, 0x11b5a8e9), TOBN(0xd7d97d0c, 0x225a73b6),
+	TOBN(0xef4a10aa, 0xf785a2f4), TOBN(0x819cb353, 0x36071bb1),
+	TOBN(0xac4df679, 0xb6be8fc5), TOBN(0xf2c2d4bc, 0xd7640256),
+	TOBN(0x03da4a46, 0x37306d15), TOBN(0x58402a7a, 0x61b95a36),
+	TOBN(0x9a1ede70, 0x92af0fa6), TOBN(0xf387f06e, 0x841bef87),
+	TOBN(0x56a28f80, 0x466f6780), TOBN(0xf419c80b, 0xac0e1f62),
+	TOBN(0x64501d16, 0x2e03f679), TOBN(0x1262a10f, 0x0eb0e40c),
+	TOBN(0x5a938f81, 0xf5b2256f), TOBN(0x74e6328e, 0x32a24a1b),
+	TOBN(0x2664e44e, 0x0cf10788), TOBN(0x881e7d84, 0x94870aa4),
+	TOBN(0x273af2a5, 0x6c49858b), TOBN(0xd4161240, 0x2f21329a),
+	TOBN(0x8508d114, 0x64ba0b7c), TOBN(0xb5a1b9cc, 0x93b3c319),
+	TOBN(0xe6c5bb04, 0x4998f9d1), TOBN(0x4a0113c1, 0x98b7f485),
+	TOBN(0x0665b410, 0xc6d6d088), TOBN(0xd458d343, 0x131d1005),
+	TOBN(0xfa2ea7c7, 0x2f8cd29f), TOBN(0x1da89720, 0x31de08fd),
+	TOBN(0x9b88c4f9, 0xfcfb8ba9), TOBN(0x1b11ad9b, 0x2bc862cc),
+	TOBN(0x37aa90a5, 0x801fa565), TOBN(0x6f73cac5, 0x8d4cc94c),
+	TOBN(0x5594ef8d, 0x288c4d7c), TOBN(0x70b3f9fc, 0xc1ae42c2),
+	TOBN(0xbe40b32f, 0x064fc0e7), TOBN(0x1047571e, 0x6968a90f),
+	TOBN(0xa4216fb1, 0x7e51fd15), TOBN(0x2cbf9004, 0x96e21e48),
+	TOBN(0x5a9ebb96, 0xdb6a2bf8), TOBN(0x81182c30, 0x92bb7201),
+	TOBN(0xfb33b17a, 0x77692afe), TOBN(0x778a5e1e, 0x7e4a5519),
+	TOBN(0x57fa781f, 0x39616bed), TOBN(0xa2af7791, 0xc7fe8a72),
+	TOBN(0xefd0fdb6, 0xe9702d4f), TOBN(0xe6255efe, 0x3474eb08),
+	TOBN(0x3c52a09f, 0x8b1dea5d), TOBN(0x7bcc32ae, 0xa9cb0eed),
+	TOBN(0x4490bffb, 0x046a0e85), TOBN(0x1cab6722, 0x8f2e3de2),
+	TOBN(0xabd66407, 0x58ae6100), TOBN(0x85f903fe, 0x1b8e15cf),
+	TOBN(0xd2362397, 0x1608b0ac), TOBN(0x4573075f, 0xcdd6c053),
+	TOBN(0x5ad3a060, 0x8fa4c602), TOBN(0xdcc1a75f, 0x82704c57),
+	TOBN(0x31143362, 0xd4514e56), TOBN(0xffd6fcdc, 0x0fa1582e),
+	TOBN(0xf4c395aa, 0xf61aa2a7), TOBN(0xa22ea3ee, 0x0e25f5e1),
+	TOBN(0x804fd65c, 0xd766caa5), TOBN(0x478cb715, 0x05659ba8),
+    },
+    {
+	TOBN(0xc2d0c7e5, 0x2a90f57b), TOBN(0x02e0f069, 0xb734a0cf),
+	TOBN(0xdf0a7774, 0x5c196114), TOBN(0x17edc877, 0x85738272),
+	TOBN(0x3b510456, 0x93759a17), TOBN(0x4c97f516, 0x54bb76f1),
+	TOBN(0xe42416dc, 0x721fe431), TOBN(0x8358300f, 0xe66d6edb),
+	TOBN(0xb11e2e8f, 0x054bfb6a), TOBN(0x14c46a08, 0xa472dc4c),
+	TOBN(0x61460d40, 0x3010bcc7), TOBN(0x8c8523e3, 0x40975f4d),
+	TOBN(0x991d2e9c, 0x1560f6c0), TOBN(0x7f9d07b3, 0xdb6a6162),
+	TOBN(0x81269f64, 0x892502a5), TOBN(0x871c7963, 0xdf6a285c),
+	TOBN(0x4c133450, 0x27ed4ed4), TOBN(0xa735415c, 0x8aff07e2),
+	TOBN(0x15c076d8, 0xd90fe6d9), TOBN(0xb41e5249, 0x1a5286a5),
+	TOBN(0xeabc9396, 0x7ff4240b), TOBN(0x375ccee8, 0xcd855b1f),
+	TOBN(0xf5949010, 0xae7bf8b5), TOBN(0x16f6ef59, 0xb108b779),
+	TOBN(0xd40929a7, 0x44dd8861), TOBN(0xfb84df55, 0xb1741e17),
+	TOBN(0xd2e601d9, 0x51cc9112), TOBN(0xdecc16de, 0x18009c28),
+	TOBN(0x54116b86, 0x47b8f377), TOBN(0x06485e99, 0x87cf4fad),
+	TOBN(0xf27ca305, 0x26fd9ff7), TOBN(0x9dd8616f, 0xdeb3cee3),
+	TOBN(0x97b44e52, 0x2bce2a89), TOBN(0xa4f30d6a, 0xf9aa9ea3),
+	TOBN(0x9d67cc31, 0xb4d518aa), TOBN(0xf2155fa8, 0x8b560c1f),
+	TOBN(0x61404368, 0x5aeb9741), TOBN(0x792734ef, 0x3792a53b),
+	TOBN(0x11ae5266, 0x48ed8636), TOBN(0x1ac31851, 0xc3236c57),
+	TOBN(0x299f28c2, 0xd60a4820), TOBN(0xad0ec13f, 0x34a98295),
+	TOBN(0xe0288fad, 0x98161a31), TOBN(0x166007b2, 0x81677934),
+	TOBN(0x20216e62, 0x7391badb), TOBN(0xe3079201, 0x2e777af7),
+	TOBN(0x6a6f4139, 0x994557a2), TOBN(0xe365e299, 0xf090bfe7),
+	TOBN(0x4c784cdf, 0xeb49a4d6), TOBN(0x1fe05451, 0x0c2023fd),
+	TOBN(0xd05f4abc, 0x1ba27daa), TOBN(0xc8b70326, 0xa7eb0a08),
+	TOBN(0x92c9f861, 0x4f237f02), TOBN(0x9245bfc5, 0xb61f8aa0),
+	TOBN(0x73e7cd42, 0xc1f2afec), TOBN(0x8696263f, 0x5d2a0a92),
+	TOBN(0x40f33c73, 0xb1f9247f), TOBN(0x9963fd39, 0x51cca6c5),
+	TOBN(0x7203d97b, 0x39245bc1), TOBN(0x65df175a, 0x083a4c6b),
+	TOBN(0x931b1c3c, 0x3f68289d), TOBN(0xa216b685, 0x5c9ddde1),
+	TOBN(0x29715103, 0xc3da82b4), TOBN(0x157f92f5, 0x2bf00ef5),
+    },
+    {
+	TOBN(0x85a18fca, 0x5521eaf6), TOBN(0x05c1e0d3, 0x6e69419f),
+	TOBN(0xbe14eee8, 0xb832c228), TOBN(0x2fdb90ef, 0x0ae704e5),
+	TOBN(0x76a208ad, 0x26eb342e), TOBN(0x992fea2c, 0xa976ede2),
+	TOBN(0xc8482db8, 0xe43fc862), TOBN(0x06b0601f, 0xccdaddb7),
+	TOBN(0x623c5d1e, 0x0a97f6d5), TOBN(0x2988d411, 0x48e5b899),
+	TOBN(0xc28c1a80, 0x6021798e), TOBN(0x190a47c6, 0x812ebe9a),
+	TOBN(0x323a5d38, 0x2ac1ed81), TOBN(0xff3a0f67, 0xb6d4c2c5),
+	TOBN(0x024d3ec9, 0x124a054a), TOBN(0x0e38f2c7, 0xbed450b9),
+	TOBN(0x982668a0, 0x4fda9da9), TOBN(0x4e6a82b9, 0x15fe0fc4),
+	TOBN(0x2b80edb1, 0xb21fcdb3), TOBN(0x683ca492, 0x34a50d4a),
+	TOBN(0xd579272c, 0xffe84817), TOBN(0x6eb99dd1, 0x9b0ab63f),
+	TOBN(0xeb292021, 0x5cf7f16a), TOBN(0x2deddeb3, 0x62116ef3),
+	TOBN(0xa812534e, 0x89bb10c2), TOBN(0xf709beab, 0x62e83c2f),
+	TOBN(0xa5cc03b2, 0xa3992225), TOBN(0xbd982dbc, 0x30013851),
+	TOBN(0xa822d70c, 0x8f71e6ef), TOBN(0x0c90bd33, 0x0f9e9f5a),
+	TOBN(0xe4f9460a, 0x4dfb3fee), TOBN(0x3bb0c2df, 0xbd679dc7),
+	TOBN(0x2f689ca4, 0x579c5513), TOBN(0x49e61ad5, 0xf3553d47),
+	TOBN(0x3acf9863, 0x69aa3155), TOBN(0xe42abf51, 0x16ac183f),
+	TOBN(0xc28086d0, 0xb5d72e83), TOBN(0xf24e69de, 0x6f254a76),
+	TOBN(0x235ca4cc, 0x91db0c6c), TOBN(0x358630a3, 0x8646d8ae),
+	TOBN(0x533e5185, 0xac149040), TOBN(0x5a1d827e, 0x6953052a),
+	TOBN(0xc0511f5b, 0x302c3463), TOBN(0x2cc00f65, 0x02cef269),
+	TOBN(0x4042dcc4, 0xe72375b6), TOBN(0xc60f2402, 0x5ceef5ee),
+	TOBN(0xd4de8273, 0x328aaf45), TOBN(0xc6cbc533, 0xe1217fce),
+	TOBN(0x98f099bf, 0xd69349ad), TOBN(0x3fc0a8a2, 0x184047fa),
+	TOBN(0xa0be9578, 0x3744fb54), TOBN(0x916e064d, 0x4fd61411),
+	TOBN(0x2593f0c2, 0x9e46fe05), TOBN(0x248b7f8b, 0x6c3f1541),
+	TOBN(0xe7cf9a85, 0x83e55fd9), TOBN(0x0d2c4c7e, 0xba541524),
+	TOBN(0x81e678e7, 0x63f248ff), TOBN(0x32c7fa72, 0xa3994d8a),
+	TOBN(0xe407b2f6, 0x7248b783), TOBN(0xcbbe2eb4, 0x107498d6),
+	TOBN(0x26363878, 0x7ed0513a), TOBN(0x442d6d0a, 0xb93bbbc3),
+	TOBN(0x52e2a207, 0x87b50569), TOBN(0x2aff25ea, 0x57e01dea),
+    },
+    {
+	TOBN(0x3c4a3279, 0x3a78631c), TOBN(0xcc089a5b, 0x192bf34c),
+	TOBN(0xf9b0087a, 0x37575fde), TOBN(0xc2fa4586, 0x5ed543d4),
+	TOBN(0xad802a03, 0x34962d95), TOBN(0x2f441ad6, 0x814202ef),
+	TOBN(0x14ace32f, 0x26a3c805), TOBN(0x576c2f09, 0xd7be46ae),
+	TOBN(0xd11c7233, 0x35082425), TOBN(0x1ddd41c0, 0xb3dc2f5b),
+	TOBN(0x084ead5a, 0xf42b4caf), TOBN(0x16d5562a, 0x26ec95e6),
+	TOBN(0x7bff9f9b, 0x4a7c74dc), TOBN(0x911cfd5a, 0x63937c96),
+	TOBN(0xaaa93eb3, 0x5085c3ae), TOBN(0x2b21ecc0, 0xb554f601),
+	TOBN(0x74020bef, 0xea4e928c), TOBN(0x32cea7c3, 0xb2162a04),
+	TOBN(0x9af94ff7, 0x9c48dd70), TOBN(0xee51f060, 0x22ff1ded),
+	TOBN(0x71ae6188, 0xbcdffc2c), TOBN(0xe17fd237, 0xcde23407),
+	TOBN(0x4b34fbd0, 0x8098e90d), TOBN(0xa6d3764c, 0x9e00297b),
+	TOBN(0x2aa1f338, 0x5cd16283), TOBN(0x183459fc, 0x2186e487),
+	TOBN(0x2a386281, 0x765f58a2), TOBN(0xb7446c8c, 0xfad1038b),
+	TOBN(0xdf04c629, 0x36316a3d), TOBN(0x69428b31, 0xcd4dbe8f),
+	TOBN(0xb7d97f29, 0x26f52f9f), TOBN(0x6be0f925, 0x13663f38),
+	TOBN(0x843303c0, 0x6e446ffd), TOBN(0x99145d99, 0x61087908),
+	TOBN(0x684ed6a1, 0xa0d329f0), TOBN(0xc5b8eb65, 0x13bec936),
+	TOBN(0xcfc3ba83, 0xfa87f1bf), TOBN(0x6cfb848e, 0xb1c96fdc),
+	TOBN(0x9360f25c, 0xccf916b8), TOBN(0xd7264bf9, 0xeec503a4),
+	TOBN(0x7b753928, 0x8bd188f8), TOBN(0xe7c36da8, 0x68f8f93f),
+	TOBN(0x6575f9d7, 0xe4058f29), TOBN(0xceeb2eb6, 0x0618a808),
+	TOBN(0x0d57777e, 0x1d6d77c2), TOBN(0x161afde6, 0x3063af2e),
+	TOBN(0xd5835d1a, 0xd631d593), TOBN(0x0005b604, 0xa6f77989),
+	TOBN(0x79d89599, 0xb0696d0c), TOBN(0x3122813a, 0x847e2ed5),
+	TOBN(0x97e04057, 0x987b24a6), TOBN(0xf5abbd2b, 0xad0c306a),
+	TOBN(0x7d04ce28, 0x8d93727a), TOBN(0x1a32e52e, 0x3c6a8266),
+	TOBN(0x9922df90, 0x616b5835), TOBN(0xe3e53e89, 0x01047d76),
+	TOBN(0xf0453cd1, 0x58c6c3ab), TOBN(0x99e957e8, 0x280f96cc),
+	TOBN(0x23e19740, 0xec9b28ad), TOBN(0x3d0100b4, 0xb5ab1bf7),
+	TOBN(0x52a9389c, 0x1b8523f9), TOBN(0x91444a48, 0x068b364c),
+	TOBN(0xbdf10a9e, 0x121f2bae), TOBN(0xb17d6e9d, 0x10551f9a),
+    },
+    {
+	TOBN(0x789464f2, 0x74f0c639), TOBN(0x4a1cfeec, 0xfe51b4fe),
+	TOBN(0x6c605917, 0xde07ff2e), TOBN(0xf23fa074, 0x301aa9e8),
+	TOBN(0x8af9c2de, 0x937c0081), TOBN(0xa66c5836, 0xe113bdc2),
+	TOBN(0x09f89ced, 0x7e64b85a), TOBN(0x8b9cbc8d, 0x5e20a56f),
+	TOBN(0x08864e16, 0xc97f84a8), TOBN(0x133e2a3a, 0x194c9e5a),
+	TOBN(0xe20e5ea1, 0xc897ceb8), TOBN(0x51eee979, 0x48fa9cd2),
+	TOBN(0xd27b556c, 0x6a249ccf), TOBN(0x07a59280, 0x1111ed52),
+	TOBN(0xbb8f564e, 0x3616a521), TOBN(0xcdd23f70, 0xacef90dc),
+	TOBN(0xcd91dbcd, 0x2d153e40), TOBN(0x1a1a7e66, 0xbb0b4c07),
+	TOBN(0xf21743f2, 0x5794aa52), TOBN(0xd3c1911f, 0xd11890a9),
+	TOBN(0x6c533a50, 0xbee6b177), TOBN(0x071e8d18, 0x21630aa2),
+	TOBN(0x444acc88, 0xe9b6b20f), TOBN(0x7530ea25, 0xfd37e892),
+	TOBN(0x6413ec69, 0xe018bca2), TOBN(0x6184e1d2, 0x283adaa2),
+	TOBN(0x35e43022, 0xa2994fa6), TOBN(0xc2932a8d, 0x1a98d33f),
+	TOBN(0x0a727ccc, 0xc580efb3), TOBN(0x479aa50c, 0x3d9570a2),
+	TOBN(0x82b7794d, 0xf50e7034), TOBN(0x2f6cd09e, 0x47afc40c),
+	TOBN(0x5b32f073, 0xd83865c7), TOBN(0x1cb62cd8, 0x37662de3),
+	TOBN(0xbacb872a, 0xa8ac4ed1), TOBN(0x51dc8d4d, 0x3ce82787),
+	TOBN(0xc15ba911, 0x5fb7cc67), TOBN(0x2431ab2c, 0xf4468cef),
+	TOBN(0x8b9a6116, 0xadea8ae1), TOBN(0xcaae20c7, 0xc57b8145),
+	TOBN(0xc45a140a, 0xe96c43b5), TOBN(0xde126f48, 0x07d9d102),
+	TOBN(0x63dfbe61, 0x7d4e864e), TOBN(0xff013464, 0x9b9ab9a3),
+	TOBN(0xfe4bfba6, 0x1a559cc9), TOBN(0xa8d09ea8, 0x8423b0c5),
+	TOBN(0x41f07a8c, 0xaf3edbc6), TOBN(0x673123d3, 0x31991f79),
+	TOBN(0x31b0ae7a, 0xbf6f1b12), TOBN(0x191c9c23, 0x1c18026d),
+	TOBN(0x81215c9d, 0xb4ab2966), TOBN(0xfd1f0e5b, 0xff8ec12f),
+	TOBN(0xee0a3f9a, 0x27202d07), TOBN(0x40198772, 0xd29d1761),
+	TOBN(0x4dc009aa, 0x607831a3), TOBN(0x77e947a4, 0x94b738a7),
+	TOBN(0xb05f6f34, 0xbf2e7320), TOBN(0x443d961c, 0x82e4ea7e),
+	TOBN(0xf6792608, 0x4b024c7d), TOBN(0x77f642c3, 0x30429ccb),
+	TOBN(0x7c50232f, 0xaca27b7e), TOBN(0x5dc23204, 0x8c3a4fc7),
+	TOBN(0xb2d23a9a, 0x02d59528), TOBN(0x62fadd3a, 0x20aa3f35),
+    },
+    {
+	TOBN(0xfd272e18, 0x45bc18ad), TOBN(0xc3446ea8, 0x5c217851),
+	TOBN(0x3f65ee99, 0x56230f97), TOBN(0xfe96429b, 0xdf02e269),
+	TOBN(0xc4ad1e74, 0xc6c8fb3a), TOBN(0xeb7f412d, 0x9e8d2355),
+	TOBN(0x6be0c187, 0x6bb570b5), TOBN(0xd24c8e12, 0x65bc0f6b),
+	TOBN(0x9617d3ae, 0x046fc3fa), TOBN(0xe486de0f, 0xb2928d3c),
+	TOBN(0x0458bb0a, 0xc695e28b), TOBN(0x74752997, 0xfcdc53f7),
+	TOBN(0x0f61e5fd, 0x1f1b9c74), TOBN(0x889e0dda, 0x240d8b25),
+	TOBN(0xb87c0d76, 0x268c25f7), TOBN(0x1c5d44f9, 0xcfac5a34),
+	TOBN(0x453bdbb9, 0xb50caddf), TOBN(0x32b1be09, 0x48f1e6af),
+	TOBN(0x9e6a3fd1, 0x7b8671f6), TOBN(0x7068b3d7, 0x249ea847),
+	TOBN(0x7e647c27, 0xa60989ae), TOBN(0x716db531, 0x1a41c621),
+	TOBN(0xc9816578, 0x9e80caf1), TOBN(0x6aa74125, 0xc3f57f23),
+	TOBN(0x393fe907, 0xaaf71961), TOBN(0xdb947ec1, 0x792be853),
+	TOBN(0x126ce591, 0x5416680c), TOBN(0xa656b93d, 0xd81f7852),
+	TOBN(0x666c6fdd, 0xe70cd6eb), TOBN(0x1e66e7bb, 0xcc9981d6),
+	TOBN(0x33e4e364, 0x3cc33a5e), TOBN(0x1074bc93, 0xe8a1fc68),
+	TOBN(0x0b987e8b, 0xe907421f), TOBN(0xf5d31f69, 0xefb4c0b0),
+	TOBN(0x20893b13, 0x1907a645), TOBN(0xff374406, 0x43e5a490),
+	TOBN(0x5183ff5d, 0x17886e1c), TOBN(0x8f9aee98, 0xc7b2a9ef),
+	TOBN(0x6cea4087, 0x144a16ee), TOBN(0xc189f2d9, 0x1ed5f3b7),
+	TOBN(0x06ad83d8, 0x58c80b05), TOBN(0xb234b3f1, 0x3af601b3),
+	TOBN(0x1891b68b, 0x70af067a), TOBN(0x05dbb158, 0xadd46c95),
+	TOBN(0x1729ddd2, 0xb85fb337), TOBN(0xc64722b1, 0xc9e06416),
+	TOBN(0x1d0b8ce8, 0xafbf67db), TOBN(0xcf75ecbc, 0x2f054403),
+	TOBN(0x718742a2, 0x06161ea2), TOBN(0xfc4653ec, 0xd1796132),
+	TOBN(0x6c8971d5, 0xd3141716), TOBN(0x476830a6, 0x404c0e18),
+	TOBN(0x44d21e51, 0xf9a6259c), TOBN(0xaa2814ca, 0x49af4a2e),
+	TOBN(0x5df7aa19, 0xc45184b0), TOBN(0xcb183491, 0x9a533ee0),
+	TOBN(0x3fb5c116, 0x708cd3b0), TOBN(0x3c3ab3aa, 0xb70c20e4),
+	TOBN(0x66337783, 0xe2d7b990), TOBN(0x47d04a29, 0x1cf84930),
+	TOBN(0x3b9db72f, 0xc308e1f6), TOBN(0x8721ef4c, 0xdedc05fc),
+	TOBN(0x004ea7f2, 0xcec86cb9), TOBN(0xcfb0d93e, 0x555359fd),
+    },
+    {
+	TOBN(0xfa4e5c30, 0x8b78315b), TOBN(0x3894a787, 0x843cbf09),
+	TOBN(0xf7cc2556, 0x1b9f5ea0), TOBN(0x69779a9f, 0x3075e710),
+	TOBN(0xb953abc1, 0xb7e19bcc), TOBN(0x1ee2a4e5, 0x1ba9fe8e),
+	TOBN(0xb860599e, 0x088809bc), TOBN(0x815d7a9e, 0x7a1c36e9),
+	TOBN(0x927d110c, 0x684ec453), TOBN(0xa09162d8, 0x16b95a1b),
+	TOBN(0xda227a01, 0x6d6cfa71), TOBN(0x0d2e9054, 0xf4da18f4),
+	TOBN(0xf93fe230, 0x1362ec00), TOBN(0xf6a7b37f, 0x92060a6f),
+	TOBN(0xd734f3d3, 0xe22369b2), TOBN(0xb048efe2, 0xe19e5942),
+	TOBN(0x70057b60, 0xc29174e6), TOBN(0x19e0aaf1, 0xe8c2c55d),
+	TOBN(0xf8f923a6, 0x160fd35e), TOBN(0xd7ef180d, 0xd457a55d),
+	TOBN(0x85bf6f8e, 0x9139cc7a), TOBN(0x26fa530a, 0xba222ed6),
+	TOBN(0x40e39fd9, 0x258675d6), TOBN(0xfcd87fd8, 0x492293e3),
+	TOBN(0x814fd808, 0x7c642a5d), TOBN(0xe8452b5c, 0xd784e23a),
+	TOBN(0x064d3642, 0x5e076e7b), TOBN(0xa0b7c3ee, 0xd535bccd),
+	TOBN(0x1941d036, 0x2737c90f), TOBN(0xb1e35e20, 0x3c2cf72f),
+	TOBN(0x7ace41c4, 0x20aa85b1), TOBN(0x7894577b, 0xf2273e6b),
+	TOBN(0x69fde60a, 0xcdbe0a0a), TOBN(0xd633b079, 0x54bebd32),
+	TOBN(0x2b40500d, 0x9915477b), TOBN(0xc4d93e8f, 0x9d35de3b),
+	TOBN(0xc4dc32c3, 0x99b8c521), TOBN(0x69707f41, 0x20190114),
+	TOBN(0x3eacfd6b, 0x3c8c8b4d), TOBN(0x9f756e86, 0x259d616b),
+	TOBN(0xdacaa96a, 0x835947cf), TOBN(0x72f4fbd9, 0xabd3e1e9),
+	TOBN(0xca1737c8, 0x96a174f0), TOBN(0x6ce239a9, 0xeb1242bc),
+	TOBN(0x11f0c84f, 0x503a13b2), TOBN(0x0928e83f, 0xb71d1a96),
+	TOBN(0xd100da28, 0x625a0058), TOBN(0x06119142, 0x41b4b46b),
+	TOBN(0x210e088b, 0x6ac87e40), TOBN(0xaf644187, 0xb60e6727),
+	TOBN(0x2a73bf9a, 0x29dd0e47), TOBN(0xa097f551, 0x260e7c8b),
+	TOBN(0x7da4dfec, 0xff45934a), TOBN(0x6003e6aa, 0xed26a6f1),
+	TOBN(0xd7699ebd, 0x26448a9a), TOBN(0x464f33b5, 0xc754bb7a),
+	TOBN(0x4f4077be, 0xeeba932a), TOBN(0x88e04da1, 0xa0ddfead),
+	TOBN(0x7b1ce68e, 0x377b6e42), TOBN(0x8d94d5ab, 0xfedcf73e),
+	TOBN(0x4e392056, 0xfba9f778), TOBN(0x497d7c0e, 0x3cdbef27),
+	TOBN(0x378d7543, 0x7c28173e), TOBN(0x9f61b27c, 0xaaa6b3fa),
+    },
+    {
+	TOBN(0x8adc39f5, 0xcf0ae2c0), TOBN(0x6b6a1d9a, 0x9a4f4b18),
+	TOBN(0x1f75e0a3, 0x1733f0db), TOBN(0xb1137658, 0x53da6852),
+	TOBN(0x31076a8b, 0x7824261b), TOBN(0xee67241b, 0x1d61b0d7),
+	TOBN(0xfdf2037c, 0xf2441780), TOBN(0x796950ca, 0x961dc0f0),
+	TOBN(0x5d9ee0e6, 0x6120d8b1), TOBN(0x50b07ac6, 0x9fc23398),
+	TOBN(0x8d86692d, 0xe5188a85), TOBN(0x51d966de, 0xd6281263),
+	TOBN(0xae712cf3, 0x0896f646), TOBN(0x09b1276c, 0x0e0f33e7),
+	TOBN(0xe802894c, 0x91cc6844), TOBN(0x3eb63031, 0x834e598d),
+	TOBN(0x7b6652e3, 0x1d8b3837), TOBN(0x5199e042, 0x5198f420),
+	TOBN(0x96bd8931, 0x732f210f), TOBN(0x32f22f46, 0x5ed4fa30),
+	TOBN(0xaebba57d, 0xe1333ecf), TOBN(0x4bdb1b84, 0xc5dfa839),
+	TOBN(0xc95935a8, 0x21c56072), TOBN(0xf8bcc6ca, 0xfa4a50bb),
+	TOBN(0x60a94dbc, 0x072ca782), TOBN(0x4036fbdc, 0x1c78d48e),
+	TOBN(0x1cd7169e, 0x073659b2), TOBN(0x3fe05e88, 0xa73a1f8e),
+	TOBN(0xba4216bd, 0xd05234fd), TOBN(0x62b861e8, 0xaf4db4a0),
+	TOBN(0xf6713fbb, 0x39d047a2), TOBN(0x9ae24c5f, 0x8f3b1da7),
+	TOBN(0x63f3ade7, 0xe2007ce8), TOBN(0xa6176c3d, 0xf16e4780),
+	TOBN(0xc38b49fa, 0x993c8984), TOBN(0xc7da8eb6, 0xcc9629c2),
+	TOBN(0x80191eba, 0x8d40df8d), TOBN(0x7725e836, 0xe551d651),
+	TOBN(0xc4107743, 0xf728d8df), TOBN(0xeaa51ce7, 0x004f5056),
+	TOBN(0x7102c0f2, 0x3e738909), TOBN(0xa685b6c6, 0x62a48590),
+	TOBN(0x6a864263, 0x7510b6c0), TOBN(0x627194bf, 0xba660c21),
+	TOBN(0x465ecec5, 0xeec701a0), TOBN(0x1e8c4da8, 0x77450358),
+	TOBN(0x0fba7d48, 0x2ab392f5), TOBN(0xfd02044d, 0x467d239a),
+	TOBN(0xd56617a8, 0x587ad173), TOBN(0x1ea92263, 0xef06155f),
+	TOBN(0x9b90d4a4, 0x1a0f436c), TOBN(0x9d341503, 0x967b5288),
+	TOBN(0xe7e44de3, 0x47c85455), TOBN(0xf94d9c7d, 0xd4a265f5),
+	TOBN(0x03399e2d, 0x60270b93), TOBN(0xab20ad8a, 0xcc8a0b01),
+	TOBN(0x565b6780, 0xa562258e), TOBN(0xd965a156, 0xf03b7f2a),
+	TOBN(0x73eccdb5, 0xcef6ca41), TOBN(0x7ed289aa, 0x073e3246),
+	TOBN(0xd248a9e3, 0x823b95cf), TOBN(0x5f77d440, 0x666711d5),
+	TOBN(0xb4754269, 0x92fbe9e4), TOBN(0xe39eeed4, 0x7f55f586),
+    },
+    {
+	TOBN(0x15b873eb, 0x9e15c581), TOBN(0x88e0056c, 0x00986497),
+	TOBN(0xb7ec0969, 0x9dc12127), TOBN(0xce720218, 0x1a24f2e2),
+	TOBN(0x920843ef, 0x1a97f18d), TOBN(0x24b26ac0, 0x19531991),
+	TOBN(0xdc82dd89, 0x15a55752), TOBN(0xcf97000e, 0xdadf99f4),
+	TOBN(0x218b2b7d, 0x21b0edc0), TOBN(0x78e49c45, 0xf118a6d3),
+	TOBN(0xec7dd647, 0xaa724a64), TOBN(0xc7f70ae2, 0xa77195cd),
+	TOBN(0x375e701b, 0xe6599fa3), TOBN(0xf8cde6a3, 0x66095bf5),
+	TOBN(0x3641eb80, 0xb8a3ee4b), TOBN(0xf4fac652, 0x48e257f5),
+	TOBN(0xdc5a69b3, 0x938e8996), TOBN(0x57b0ef63, 0xfa10e03f),
+	TOBN(0xe99fb666, 0x05613190), TOBN(0x5d020eec, 0x48c4492f),
+	TOBN(0xe66dc23b, 0x078d36bc), TOBN(0xdbd51fb2, 0x115df306),
+	TOBN(0x40934038, 0x2c0fa0d7), TOBN(0x19038b22, 0xb5cc3713),
+	TOBN(0xd022a171, 0x34cf46a1), TOBN(0xb18a2592, 0x1e1ebab0),
+	TOBN(0x1b21985b, 0xc44751c6), TOBN(0xd3cb0e84, 0x736b0b45),
+	TOBN(0xc0ed1df5, 0xf9c28532), TOBN(0x3a86527a, 0x01955cc3),
+	TOBN(0xffe6fa72, 0x1ac4a03a), TOBN(0x8d6f7713, 0x3f5980ea),
+	TOBN(0x1ab444c2, 0xbfb07f9d), TOBN(0x36bc4a21, 0x5831cad3),
+	TOBN(0x71446ddc, 0x997f0df9), TOBN(0x561fd3f0, 0xae96e8a0),
+	TOBN(0x2206717e, 0x8529a803), TOBN(0x3886727d, 0x5b5759d9),
+	TOBN(0xecf96ae5, 0x024a0f2f), TOBN(0xf1abc2a1, 0xe8901aa9),
+	TOBN(0xaf75239e, 0x4eb043d7), TOBN(0x5b970183, 0xfb30e9a4),
+	TOBN(0x6e004f78, 0x9f64d57c), TOBN(0x260e0078, 0x043581d5),
+	TOBN(0x705aaa35, 0xbd08b085), TOBN(0xb9b33e2d, 0x11e6591a),
+	TOBN(0xb65ebae7, 0x5842568a), TOBN(0x6129c064, 0x70a47399),
+	TOBN(0xe8cbb298, 0x0f91e3e2), TOBN(0xf429de75, 0xf127cf81),
+	TOBN(0x88828536, 0xb7d366f1), TOBN(0x4c2fbe0b, 0xd26d056b),
+	TOBN(0xc3c93f0f, 0x9b89f0bd), TOBN(0xfe4ef612, 0x030cde80),
+	TOBN(0x21ed86e4, 0x5def9860), TOBN(0x066025a8, 0x2bc253bc),
+	TOBN(0x7c8bc493, 0x586536e6), TOBN(0xc33628fa, 0x133cbb39),
+	TOBN(0x968f92f2, 0x0fb98fa5), TOBN(0xfb9954ad, 0xd368c96a),
+	TOBN(0x7b8f05be, 0x7a0f5f2a), TOBN(0xfa2945f5, 0x4bf206da),
+	TOBN(0x9fdaaa31, 0x048f1193), TOBN(0xc73ddda8, 0xfeabeb0d),
+    },
+    {
+	TOBN(0x4593af08, 0x715f9811), TOBN(0x51c673cc, 0xbd5f301c),
+	TOBN(0xd683fa29, 0x71425c3b), TOBN(0x07665544, 0x54802dd0),
+	TOBN(0xd0204703, 0x81897c94), TOBN(0x1f063a11, 0x2e26edb4),
+	TOBN(0x59a47cd7, 0xaa9fef01), TOBN(0x7a6cd9a6, 0x0aed5770),
+	TOBN(0x30b9e5e2, 0x815d7c3d), TOBN(0x1aaa832b, 0x41c2ab25),
+	TOBN(0x08802b26, 0xd6e3c273), TOBN(0xac40d23c, 0x88cbc11f),
+	TOBN(0x02e85fb8, 0x9d52b1d6), TOBN(0xcc26077b, 0x7868ae94),
+	TOBN(0x3e042b6c, 0xda278a55), TOBN(0x5ef25ff6, 0xa317a016),
+	TOBN(0xc8da9d6c, 0xb19db88c), TOBN(0xb7e0db1e, 0xe426493f),
+	TOBN(0x26679847, 0xa90cc78b), TOBN(0x03f518a2, 0xb985db8b),
+	TOBN(0x90b8d3d3, 0x8138e142), TOBN(0xd17a40f2, 0x0c7e28df),
+	TOBN(0xbcd81389, 0xeb5b8abd), TOBN(0x42a51ea4, 0xc214abc3),
+	TOBN(0xde038aee, 0x694dd958), TOBN(0x5fe15bbe, 0x04f8f763),
+	TOBN(0x50ff5ad8, 0xf23a4298), TOBN(0xfe2d1240, 0x75e4412d),
+	TOBN(0xfc9715dc, 0xb6674885), TOBN(0x28acc60a, 0xaa6fc71a),
+	TOBN(0xfca85853, 0x1c732ccb), TOBN(0xe24c3bf3, 0x014c8f39),
+	TOBN(0x9deae2fb, 0x97aba147), TOBN(0x0d373fa9, 0x6296265e),
+	TOBN(0xc32b7997, 0x012c0b47), TOBN(0x7a0e905c, 0xf557696d),
+	TOBN(0x98a1fe56, 0x09edb5a6), TOBN(0xc00a6e1c, 0xf3364f5c),
+	TOBN(0x7395d23e, 0x51bafa27), TOBN(0x484ef4ef, 0xcdf7efc5),
+	TOBN(0x5c327a47, 0x26002239), TOBN(0x5779fc30, 0xb89f7aaf),
+	TOBN(0x397908f7, 0xf9ea863f), TOBN(0xcde61549, 0xc9cbe655),
+	TOBN(0xfc1f2a46, 0xe80a0c0f), TOBN(0x88afdddb, 0x17774187),
+	TOBN(0x8b2a3c69, 0x33da5994), TOBN(0xd1befe4f, 0x968ebaf8),
+	TOBN(0x762470d9, 0x78669390), TOBN(0x4d6a1a71, 0xcd377ff2),
+	TOBN(0x84937043, 0xcd075c2d), TOBN(0xa37932e1, 0xdb98b4bc),
+	TOBN(0x02afb4b3, 0x0c2a5f1a), TOBN(0xc4d28eb2, 0x06596b6b),
+	TOBN(0x128c6520, 0x57a0c30a), TOBN(0x60465289, 0x105ac9cb),
+	TOBN(0xf7dc15a3, 0x3b33e06d), TOBN(0x63409187, 0x50bd72f6),
+	TOBN(0x6ead4a7b, 0x5f5188ed), TOBN(0x3b3ae81f, 0x6a2b9b35),
+	TOBN(0x5f89bb56, 0xfc5f9be8), TOBN(0x3923ff66, 0xf7220eb4),
+	TOBN(0x30c106df, 0xb1cc801f), TOBN(0x2121b4de, 0x4c8e4d3c),
+    },
+    {
+	TOBN(0x8b275e10, 0xe2bf3022), TOBN(0xa38ce799, 0x7abe6038),
+	TOBN(0xad07f452, 0xe284b876), TOBN(0x0eccaa88, 0xa9005ba1),
+	TOBN(0xa0408e07, 0x0312f928), TOBN(0x3e0c7422, 0x5c4ddb69),
+	TOBN(0xb348f9af, 0x553fde02), TOBN(0xf4d9b34c, 0x15daaee0),
+	TOBN(0x6173cbc5, 0x02baf87a), TOBN(0x35550656, 0x8385564a),
+	TOBN(0x1100564d, 0xadc784e6), TOBN(0x5881a479, 0x1197823e),
+	TOBN(0x05d0bf71, 0x3aa563ad), TOBN(0x984c0ef6, 0xf0d15d28),
+	TOBN(0x7c0856d9, 0xb44f14ab), TOBN(0xbde4bfed, 0x462f402c),
+	TOBN(0x91b53ad9, 0x633b7118), TOBN(0x6fc1b63d, 0xc84c927f),
+	TOBN(0x4ccf308f, 0x52198f17), TOBN(0x07ea3145, 0x730bb716),
+	TOBN(0x2171a7a7, 0x0271c284), TOBN(0xa2f481e4, 0x18fc51bf),
+	TOBN(0x79b02713, 0xd6b7157b), TOBN(0x854a3d49, 0x84295787),
+	TOBN(0xbc0715dc, 0xd29bb2b0), TOBN(0xbfc2b77c, 0x09f1eec7),
+	TOBN(0xa1feb5b1, 0xe4748530), TOBN(0xfc5a2480, 0xebc8825a),
+	TOBN(0xf92e2bb9, 0x6cce910b), TOBN(0x51598c15, 0x54df8e35),
+	TOBN(0xf950b0a6, 0x38e65996), TOBN(0xc49877e6, 0x02991e73),
+	TOBN(0x3bd5c5f7, 0x2f57428f), TOBN(0x1a6e7f52, 0xc52c4cbd),
+	TOBN(0x8656f32e, 0x0258168e), TOBN(0xf41d20b9, 0xeaaed2db),
+	TOBN(0x3143fcac, 0x13db6b4c), TOBN(0x8014dc39, 0xe66c9eb9),
+	TOBN(0xe72ba47c, 0xa375f44f), TOBN(0x909de9df, 0x9befdf8a),
+	TOBN(0xb864f48e, 0x4c004472), TOBN(0xaef3f861, 0x713ef55e),
+	TOBN(0x72f211ef, 0xf3d50c7e), TOBN(0x9bcc2a93, 0x9397ccaa),
+	TOBN(0xf83e548d, 0xd014181f), TOBN(0x115fbbb6, 0x2eee830f),
+	TOBN(0x165478d2, 0x67b4b329), TOBN(0xa37dfc9f, 0x2d1d75f1),
+	TOBN(0xec48e1b2, 0xf0cd2721), TOBN(0x9ad434e3, 0x9a6effe4),
+	TOBN(0x0926e087, 0x9a0eb85a), TOBN(0x46f265c3, 0xb7316979),
+	TOBN(0x055f6966, 0x1854be35), TOBN(0x89a51d64, 0x0cb2d6d6),
+	TOBN(0x2518ca40, 0xaf418615), TOBN(0xc08ca512, 0x20b59396),
+	TOBN(0xefb82b46, 0x7667c0da), TOBN(0xc681230e, 0xa17ae5ed),
+	TOBN(0xdd5a94f6, 0xbea311da), TOBN(0x7675d03e, 0xd457366a),
+	TOBN(0xbf1376ad, 0xf8bf37d0), TOBN(0x7247fecd, 0xee441d68),
+	TOBN(0x61820dbf, 0x6399003e), TOBN(0x424369bc, 0x991c9a78),
+    },
+    {
+	TOBN(0xc62dcf5e, 0x11a558f2), TOBN(0xbe4db67a, 0x8b338099),
+	TOBN(0x86f33986, 0x9527dc7a), TOBN(0xaa493c5f, 0xae14e58c),
+	TOBN(0xebc12213, 0x4d719477), TOBN(0xb37ef496, 0x53ec4dbc),
+	TOBN(0xfb5e47cc, 0x7959f6d1), TOBN(0x97d2ce50, 0xad9a7a81),
+	TOBN(0x1b79b8b7, 0xbaa1001d), TOBN(0xc4dc1e41, 0x8d2d85b4),
+	TOBN(0x314839e1, 0x1de02a97), TOBN(0x12ac4fc5, 0xf493f9fb),
+	TOBN(0x4bb6e200, 0x6b5d8ddf), TOBN(0x6bfe6d7e, 0x72d77fc6),
+	TOBN(0xbdac050c, 0xe15fa666), TOBN(0xb585b596, 0x7e10731f),
+	TOBN(0x14e2c995, 0x7d7a7379), TOBN(0x1305ee15, 0x0f69f229),
+	TOBN(0xce9705c0, 0x2cad8fa6), TOBN(0x67bc2255, 0xcd0343ba),
+	TOBN(0x4f8366b7, 0x228bacce), TOBN(0xbe4b0718, 0x357cd069),
+	TOBN(0x8b99a0ca, 0x5cc44750), TOBN(0x22f25393, 0x5373941a),
+	TOBN(0xe7d02353, 0x92f9ccef), TOBN(0xd43c8d54, 0x6079af84),
+	TOBN(0x987efded, 0x2737334f), TOBN(0x63ad7aea, 0xa9d33379),
+	TOBN(0x14ad9a15, 0x347f068c), TOBN(0x31c4beb7, 0x7f670ca4),
+	TOBN(0x2053ecbc, 0x89f7ed61), TOBN(0x839dbc85, 0xec694227),
+	TOBN(0xbcecae48, 0xf9375a36), TOBN(0x9a1490c0, 0xf7b93f4c),
+	TOBN(0xe665825b, 0x0c91f74e), TOBN(0x92630fa4, 0x3a1fd58b),
+	TOBN(0x20c8a512, 0x4a3debe2), TOBN(0x3c07d082, 0x9d9af98a),
+	TOBN(0x04e0a816, 0xfa5e67f8), TOBN(0x1b467507, 0xb6817cfe),
+	TOBN(0x0bd439a7, 0xae8b687a), TOBN(0x7190c60c, 0x85e38d93),
+	TOBN(0xe4dc2327, 0x9e48dba4), TOBN(0xd0a08a7f, 0x2d653b71),
+	TOBN(0xeb7322f7, 0x567b06ec), TOBN(0xd3142ea2, 0xf604083f),
+	TOBN(0x67432821, 0x3f26dcf1), TOBN(0x61a7649d, 0x30aa1493),
+	TOBN(0x7cb95653, 0x358e99da), TOBN(0x5cb9cdd8, 0x58ae9f75),
+	TOBN(0x40f5c88e, 0x432f1652), TOBN(0xe4c62d0e, 0x6da8fafd),
+	TOBN(0x5b94dab3, 0xd46bc4e5), TOBN(0xe07a8956, 0x49197302),
+	TOBN(0x7e96002c, 0x841d907a), TOBN(0xf7eca709, 0x5bd58205),
+	TOBN(0x930c2030, 0x3d0266d2), TOBN(0xeae42999, 0xde41d124),
+	TOBN(0x10f1df1b, 0xf394e4b2), TOBN(0x9ee1b297, 0x945fdff4),
+	TOBN(0x96dbcef5, 0x226b6403), TOBN(0x926e2168, 0xdc90f918),
+	TOBN(0x6a071ef0, 0x578eb141), TOBN(0xac99374f, 0x24148da5),
+    },
+    {
+	TOBN(0x8c5b9ebc, 0x234ab1e5), TOBN(0x2ea7372b, 0xe260cf99),
+	TOBN(0x86e6bb30, 0x99a8f866), TOBN(0xc0dd8e26, 0xce99ed57),
+	TOBN(0x077bb2fe, 0xc532ce45), TOBN(0xaee20bb6, 0x8668535d),
+	TOBN(0xd75b6628, 0x23d115f3), TOBN(0x0c69fb1b, 0x09d90d16),
+	TOBN(0x9d40db1f, 0xd4b13c99), TOBN(0x613be33b, 0xcbef4b0a),
+	TOBN(0x340177ae, 0x1c018a89), TOBN(0x499cdcb0, 0xe44964fd),
+	TOBN(0x71e9da36, 0xabe6ced5), TOBN(0xbd6872c8, 0x2f99f3b2),
+	TOBN(0xe194e301, 0x57ca6a90), TOBN(0xe299d11c, 0x3e668b18),
+	TOBN(0x0f535718, 0x536d001b), TOBN(0xda890b09, 0x75b2dc51),
+	TOBN(0x5952af83, 0x785e0ebd), TOBN(0xc695f50b, 0x2520dc44),
+	TOBN(0x27fd44ad, 0x8a3e12ba), TOBN(0xc0b4f6d8, 0xf0984366),
+	TOBN(0xc514167c, 0xa20d6e94), TOBN(0x6d6ea4b3, 0x681ebdd0),
+	TOBN(0xde704ca0, 0x4c699179), TOBN(0xd9954882, 0xa620709d),
+	TOBN(0x127166fa, 0x04490501), TOBN(0x1b654748, 0x789d331c),
+	TOBN(0x75c424a4, 0xc21c2851), TOBN(0xd89f0c17, 0xa1c80cca),
+	TOBN(0x53ac5474, 0xbb13ebb7), TOBN(0x5ee6575f, 0xf9b5c9e9),
+	TOBN(0xcca64584, 0xee1e3a39), TOBN(0x1eb69327, 0x64c7ba6b),
+	TOBN(0xb6f8de9d, 0x8029e98d), TOBN(0xeb30d5cb, 0x89aa4032),
+	TOBN(0x63657e2d, 0xff23c0ac), TOBN(0xc24a4314, 0xcbe9a04a),
+	TOBN(0x6e99cc8b, 0x08b52d60), TOBN(0x52ee72e3, 0x54f473f8),
+	TOBN(0xe5181509, 0x2ee002b8), TOBN(0xf1ad2010, 0x41aef9a9),
+	TOBN(0x62ac1100, 0xf1d51f43), TOBN(0x026bebf6, 0xea33e076),
+	TOBN(0xba835298, 0x8c70bb1e), TOBN(0x22c30022, 0x0f6462e9),
+	TOBN(0x65701099, 0x8128ea84), TOBN(0x2a748104, 0x44fe558c),
+	TOBN(0x37722fed, 0xc9b974af), TOBN(0x704b355e, 0xc478e3ad),
+	TOBN(0xd34c6d0b, 0x0a130cbe), TOBN(0xdb53ee21, 0x80c85654),
+	TOBN(0xab2a58b0, 0xb4d0d1dd), TOBN(0xcca8cfc2, 0xebfaf899),
+	TOBN(0x18a64ae2, 0xa5dca22e), TOBN(0x9ff818a5, 0x4a5941c5),
+	TOBN(0xf5ed35f2, 0x87a5b96e), TOBN(0xe633397f, 0xef495f2d),
+	TOBN(0xd099b5be, 0x58f5c487), TOBN(0x3bb7a688, 0xedac24c5),
+	TOBN(0x04b54fe1, 0xba6efb93), TOBN(0x6015e046, 0x3845d560),
+	TOBN(0x0afe633e, 0x8db4a04e), TOBN(0x59326e9e, 0x48291b4b),
+    },
+    {
+	TOBN(0xc2d651d3, 0x58a9c69f), TOBN(0xc35aa4e3, 0x213bd157),
+	TOBN(0x6ba7cf4e, 0x0318d732), TOBN(0xfed1b62f, 0x67bb359b),
+	TOBN(0xb3020673, 0xffacf2ef), TOBN(0x1aef4cd3, 0x09b79df0),
+	TOBN(0x54c8385f, 0xd1937a1f), TOBN(0xa4c2faa7, 0x9f5dd9f7),
+	TOBN(0xc8f31928, 0x94811eb4), TOBN(0xb88f1b00, 0xdce589aa),
+	TOBN(0x5b4f8b01, 0x96c63274), TOBN(0x11b3e3d1, 0x1fefee3e),
+	TOBN(0xb656e5a8, 0xf2242921), TOBN(0xdd684215, 0x8e4e4054),
+	TOBN(0x8d88ef12, 0x7b484eff), TOBN(0xe8e3c61c, 0x1a97dcfc),
+	TOBN(0x34637f93, 0xe9980780), TOBN(0xa83cdf38, 0xa9b160e4),
+	TOBN(0xfe9e3004, 0xba761a8b), TOBN(0xa6717c35, 0x07f7387c),
+	TOBN(0x8ac3b906, 0xf04ef980), TOBN(0x83d0c020, 0xd587080d),
+	TOBN(0xaa341914, 0xe2167d16), TOBN(0x3957daac, 0x39769467),
+	TOBN(0x33c94a03, 0xcba72760), TOBN(0x75bdf537, 0xbbb6c10d),
+	TOBN(0x5edee62d, 0x93220c99), TOBN(0xa9d115bf, 0x70027bac),
+	TOBN(0xc65ea8e5, 0xbb911135), TOBN(0xcbad1e03, 0x16755d66),
+	TOBN(0x53451cc9, 0x41f632b0), TOBN(0xac88cc24, 0xdf5c69d1),
+	TOBN(0xfacf7e0f, 0x6d9ab1b4), TOBN(0x91f93c5b, 0xdc889a81),
+	TOBN(0xd03e3fc4, 0xb772f800), TOBN(0xdeee9cf6, 0x92d70435),
+	TOBN(0xd90a5dea, 0x3d17f2b0), TOBN(0x893e0c41, 0xa65a26f9),
+	TOBN(0x0b755d91, 0xefa7a3a6), TOBN(0xbad296f0, 0x1274c3a1),
+	TOBN(0xab97ca52, 0xae14e3d2), TOBN(0x0c3f03f6, 0xf8c7674d),
+	TOBN(0x26f2e29b, 0x0f1860de), TOBN(0xa1c924cc, 0x53866851),
+	TOBN(0x37df1dd8, 0xb784bc3b), TOBN(0xbd3fa286, 0xe3635ed2),
+	TOBN(0x9f76d370, 0x2e824681), TOBN(0x32918cba, 0x404c69f2),
+	TOBN(0x72049f2a, 0x3016f8bc), TOBN(0x08c1e65f, 0xf06ceed1),
+	TOBN(0xcc9f5256, 0xc32ed84d), TOBN(0x73384bfd, 0x65e7d368),
+	TOBN(0x68148272, 0x54eb8129), TOBN(0x8d91966f, 0xf3b232f7),
+	TOBN(0x7c2bd348, 0xc68eea1b), TOBN(0xe188ddfa, 0x3ff71ae8),
+	TOBN(0x6e73f0ed, 0xec6c39d8), TOBN(0x6a5fe300, 0xfc7f084e),
+	TOBN(0x29761af3, 0xe8c6f918), TOBN(0xbaa2506f, 0xd487ae6d),
+	TOBN(0xd4f4c94e, 0x30fa9f58), TOBN(0xa40ba7aa, 0x5775cc83),
+	TOBN(0x0d0ee281, 0x61f3f4d1), TOBN(0x8f9f7360, 0xcca875ab),
+    },
+    {
+	TOBN(0x85aca3a6, 0xb1538d3f), TOBN(0x38c113fd, 0x0e717115),
+	TOBN(0x504fe6bf, 0x758aedd6), TOBN(0x69ee81c6, 0x41e68d75),
+	TOBN(0x95fd7bc0, 0x29a98b36), TOBN(0x7dc2bc2f, 0xf1fef3c4),
+	TOBN(0x8a2f474e, 0xd4441c8e), TOBN(0x264a53c8, 0xed5fcc01),
+	TOBN(0xf8339c01, 0x887179c7), TOBN(0x48a1dcba, 0x6b5f52f7),
+	TOBN(0x881019ef, 0x0dcd9a43), TOBN(0x47ac04c7, 0x3b014d83),
+	TOBN(0x4729e187, 0xb9740559), TOBN(0xa03c1bf6, 0x668774cf),
+	TOBN(0x814eb70c, 0x8b9bbbc3), TOBN(0x4955f227, 0x77755ed2),
+	TOBN(0x4e54c315, 0x2ba8282a), TOBN(0x04f6ed50, 0xaa41b9c7),
+	TOBN(0xb961040c, 0x93ef2489), TOBN(0x4400a8c9, 0x9b08c5c8),
+	TOBN(0x9e7de94d, 0x25c4ac1f), TOBN(0x4bc068ea, 0x30acb2ae),
+	TOBN(0x02490711, 0xacb1da20), TOBN(0x9a39b2e5, 0x3424be6b),
+	TOBN(0x76629a00, 0xbdc4465b), TOBN(0x1c981849, 0x5c9a93ae),
+	TOBN(0x9f31377a, 0xdc1eb795), TOBN(0xa7ac7cf2, 0x04fbc381),
+	TOBN(0xd9264245, 0xd0403da3), TOBN(0x0c6fcaae, 0xcfe4ae4f),
+	TOBN(0xb98eb48e, 0x2b107657), TOBN(0xb0bc769d, 0xdf9c193d),
+	TOBN(0x486be511, 0xd6e4e935), TOBN(0x0e7fea5d, 0x2e6670d6),
+	TOBN(0x8aaa5970, 0xd5ebeaf1), TOBN(0x8447f070, 0x3b189d86),
+	TOBN(0xd3e8efdd, 0xe4d7ce49), TOBN(0x5cb6ba92, 0xdd67fb29),
+	TOBN(0x7bc33780, 0xf347a4bd), TOBN(0x9206b6b4, 0x0cdb013e),
+	TOBN(0x249f365f, 0x2df2f969), TOBN(0x27099be5, 0x2776ad1f),
+	TOBN(0xe6d98fe7, 0xd37429b7), TOBN(0xa4bd2091, 0x36763a34),
+	TOBN(0x535b485b, 0x4e8425bb), TOBN(0xf719e7e9, 0xea23100e),
+	TOBN(0xd5d76737, 0x5fdfbda3), TOBN(0xcc48d13e, 0x6443004a),
+	TOBN(0x2208c19b, 0xbeca3272), TOBN(0xc85b666d, 0xf3f58265),
+	TOBN(0xea9f809c, 0x0a1290b3), TOBN(0xf8382bff, 0x7146072b),
+	TOBN(0xc429a82d, 0xb5d04a64), TOBN(0x26d6e9f6, 0x412c7883),
+	TOBN(0x13d1f11b, 0x2abf5570), TOBN(0x73308687, 0x129c738b),
+	TOBN(0xacbcd76d, 0xe6795f7a), TOBN(0xe52aac4e, 0x2bc3cd81),
+	TOBN(0x01a22d6e, 0x4359ed52), TOBN(0x7338e239, 0x6dfbc1b8),
+	TOBN(0x80e74493, 0xd78d723d), TOBN(0x8350ecc9, 0x2e0f7c36),
+	TOBN(0x510dea60, 0xa27f276e), TOBN(0x1f3ee6c1, 0x9950eb56),
+    },
+    {
+	TOBN(0xff5d4f21, 0xa0ffd787), TOBN(0x72e98179, 0xed8cbe76),
+	TOBN(0xdf42fe6a, 0x21b0a3db), TOBN(0xe2eceb7b, 0x337ce682),
+	TOBN(0x711a742e, 0xd71ac9ee), TOBN(0x53bd4eed, 0x6d93be8b),
+	TOBN(0xad52d2ba, 0x3fe11ded), TOBN(0xb6a7aaae, 0x4b97f8c7),
+	TOBN(0x3933196c, 0xd40fe042), TOBN(0x675d3cbf, 0xce4c2524),
+	TOBN(0x0f1f6773, 0xc5147b40), TOBN(0xebb6467e, 0xdb8cc1d1),
+	TOBN(0xe540e135, 0x5afa47d6), TOBN(0x78fedbde, 0x1a4aee9a),
+	TOBN(0x46423cac, 0xadc00197), TOBN(0x8abc2045, 0x4d789f62),
+	TOBN(0x44b7a0cc, 0xa2cb4ce1), TOBN(0x3fa31120, 0x874fa290),
+	TOBN(0x6a700e0f, 0x0663c40d), TOBN(0x7e5e6187, 0x2b7d7050),
+	TOBN(0xda0611e8, 0xf47126df), TOBN(0x15e0c75f, 0x4bdc6edf),
+	TOBN(0xe7af7a8e, 0x2e265675), TOBN(0x26b703a6, 0x22c15434),
+	TOBN(0xf49ed85a, 0x60b3022c), TOBN(0xb03bbc00, 0x1a53d24f),
+	TOBN(0x1a72d8c3, 0x270608f0), TOBN(0xac594d5c, 0x8026dc82),
+	TOBN(0xc9676176, 0x64cb621c), TOBN(0xdb8337ed, 0xc376ba61),
+	TOBN(0xee57eda1, 0xd356b373), TOBN(0x2b3a3d1d, 0x8320caca),
+	TOBN(0xfdeca736, 0x54a3ff11), TOBN(0x3542c443, 0x7afd156d),
+	TOBN(0xdb3e6506, 0xa844aee8), TOBN(0x240d620f, 0x215fa572),
+	TOBN(0xadfdf612, 0x92c98ca3), TOBN(0x3d3c3510, 0x236e24af),
+	TOBN(0xc4109aa9, 0xe34a12f5), TOBN(0x3e6b5480, 0xb09912d6),
+	TOBN(0x5f2869b9, 0x015f92b9), TOBN(0xe7b5f1bf, 0xbb6580cf),
+	TOBN(0x408cacbd, 0xd14dbfe8), TOBN(0x79676226, 0x5ef25199),
+	TOBN(0xf2a228d3, 0x81e31e72), TOBN(0xa95d1106, 0x9703730c),
+	TOBN(0x8d9c6a3f, 0x4e586307), TOBN(0x23f6c0c4, 0x634eb536),
+	TOBN(0xebcfd833, 0x7243896b), TOBN(0x920ead7a, 0x77e3d8a5),
+	TOBN(0x0e6969b3, 0x6d1336cb), TOBN(0xc9bde979, 0xc0aa3275),
+	TOBN(0x22a8e629, 0x49fa0f53), TOBN(0x121529f1, 0x1add768b),
+	TOBN(0xab8311bc, 0x7d122e19), TOBN(0x8faa7380, 0x5cfbce53),
+	TOBN(0xbaa1446f, 0x072920a6), TOBN(0x63e0ae27, 0x1e621227),
+	TOBN(0x3e0c5cdd, 0x90d53558), TOBN(0x8414e0f0, 0xe29c8fe2),
+	TOBN(0x472006b6, 0x57397ee8), TOBN(0x16ebfca6, 0xc6539c84),
+	TOBN(0x86e68af3, 0xb8e60582), TOBN(0x570e12d4, 0x0abe1524),
+    },
+    {
+	TOBN(0xfeba9e43, 0x41ffaf0e), TOBN(0xe5d302f3, 0xdb197ced),
+	TOBN(0xbe85fcd4, 0x436147b6), TOBN(0xc5d9d6f6, 0x66f9cd05),
+	TOBN(0xe234e85d, 0xae3593dd), TOBN(0xa77a9dda, 0xdb277d16),
+	TOBN(0x5aa5a574, 0x7fc23bda), TOBN(0x6d4f555c, 0x972ff18f),
+	TOBN(0x726632d9, 0xa81fc085), TOBN(0xceba797f, 0x9c984a48),
+	TOBN(0x1e3ecee7, 0x8a28f680), TOBN(0xd76c8cfd, 0xb71983a2),
+	TOBN(0xca81c26a, 0xb5f48fad), TOBN(0xf1fdb7bc, 0x3495dd35),
+	TOBN(0x8c847959, 0x5b80032e), TOBN(0x1578408a, 0x9af13ec4),
+	TOBN(0x896f4199, 0x459699c3), TOBN(0x7f462241, 0x0e9f4520),
+	TOBN(0xd4e01c1e, 0x0cc7881a), TOBN(0xfcbcc30e, 0x56fae0a0),
+	TOBN(0xb40c23d1, 0xe8e24dbe), TOBN(0x2bc18ebe, 0x97b8ddbf),
+	TOBN(0xcf5ef51c, 0x5c4cacea), TOBN(0x4d6e074c, 0x4582a869),
+	TOBN(0xe93db0b4, 0xc1660458), TOBN(0x60777800, 0x34a7a49f),
+	TOBN(0x34e5b186, 0x4e0c11e1), TOBN(0x58b29ab9, 0x004db904),
+	TOBN(0x92cec2ec, 0xc996c439), TOBN(0xb7066fdb, 0x86ed74c3),
+	TOBN(0xdcafdb43, 0xa6ad66e7), TOBN(0x56747a3b, 0x06419595),
+	TOBN(0xfbd94e6c, 0xa947fe22), TOBN(0x6a858886, 0xf5fa2adb),
+	TOBN(0xb67cca0d, 0x50895dd0), TOBN(0x481ac41e, 0x42bf4ae5),
+	TOBN(0x5bfbec25, 0x25931946), TOBN(0x7a786a20, 0x46dc495f),
+	TOBN(0x88213553, 0xc69425ea), TOBN(0x7cd6a901, 0x613225ad),
+	TOBN(0xbe50d372, 0x02bf2572), TOBN(0xcf6be37f, 0x76cb019e),
+	TOBN(0x8119597b, 0xa29b7fd1), TOBN(0xf2cec44c, 0xbde4a332),
+	TOBN(0xe54451a7, 0x03c63ce4), TOBN(0x52ba220d, 0x2e06e619),
+	TOBN(0x1b38d47e, 0x9cb0c60f), TOBN(0x47ed8188, 0xc69d6a6d),
+	TOBN(0xd79fb066, 0xe48712d6), TOBN(0x241d5af4, 0xefc7b14b),
+	TOBN(0x1cd2d366, 0xda266d97), TOBN(0x937bd2f3, 0x815464ea),
+	TOBN(0x4551cc52, 0x93f41ea7), TOBN(0x242a53e2, 0x35baed16),
+	TOBN(0x57062378, 0xfa245c32), TOBN(0x1f54e700, 0xb9f79ca7),
+	TOBN(0x754288de, 0x0e52414d), TOBN(0xc7c15c4e, 0x3cc4244f),
+	TOBN(0x7c18b9bb, 0x21aa6ab0), TOBN(0x0829c1e1, 0xc5391fc4),
+	TOBN(0x8e400d6c, 0xae72fdd1), TOBN(0x2dd7f94d, 0x8ca73908),
+	TOBN(0x0dcd15e7, 0x71cc0b04), TOBN(0xae1c25a8, 0x157c2a49),
+    },
+    {
+	TOBN(0x7c2d4f20, 0x51f8f7e4), TOBN(0xa2daa395, 0x2e04b4e0),
+	TOBN(0x17df274f, 0x1442b136), TOBN(0x11a9b93f, 0xafe20a64),
+	TOBN(0xff7c7627, 0x3c69118c), TOBN(0x69323ab0, 0xb6d17433),
+	TOBN(0x1af80cf0, 0x0e54b677), TOBN(0xc9b57e45, 0xa81a04d8),
+	TOBN(0xd76f346f, 0x27a1cc8d), TOBN(0x93e9d17d, 0x9a97e957),
+	TOBN(0xbf060b4f, 0x6bd49e6b), TOBN(0x052796de, 0xb9f229c8),
+	TOBN(0xf6eab4ed, 0x031afc80), TOBN(0xf2895078, 0x79cc867f),
+	TOBN(0xcc79b130, 0x9972cd68), TOBN(0xf1ff3408, 0xeb381930),
+	TOBN(0xe6056aa7, 0x2c36f47b), TOBN(0xef990cca, 0xecfe6055),
+	TOBN(0x090c567a, 0xa3f53783), TOBN(0x5f14c9f2, 0xa1d68eb1),
+	TOBN(0x746d4bdc, 0x39942e77), TOBN(0x7ed49c7f, 0x539c95fd),
+	TOBN(0xa1f947c4, 0x9e2ab67e), TOBN(0xc29cd756, 0x4b083fb0),
+	TOBN(0x5615cb26, 0x6a1e573b), TOBN(0x7b19e47b, 0x8417b492),
+	TOBN(0x77894fdd, 0x22351596), TOBN(0x7a4cce42, 0xf6dab6fa),
+	TOBN(0xaf1d90b6, 0x1a1c7fd6), TOBN(0xb79eb355, 0x7cd04ea1),
+	TOBN(0x7d85615c, 0x25719073), TOBN(0xb4ea3573, 0x5a4dd5ba),
+	TOBN(0xe8f5156b, 0xe4578d8d), TOBN(0x2c4b5dc4, 0x5bfaeff9),
+	TOBN(0xea8902c6, 0x8084499f), TOBN(0x4a42516e, 0x0defbb89),
+	TOBN(0x9b909895, 0x518ce855), TOBN(0x54b9b65a, 0x21de55a6),
+	TOBN(0x652dbc36, 0x76907894), TOBN(0x417e1271, 0xe1395ce5),
+	TOBN(0xda83a717, 0x61b4181f), TOBN(0x1a220feb, 0x6bc812bd),
+	TOBN(0x2e6a3978, 0xabb855e3), TOBN(0xea573a65, 0xa2271a6d),
+	TOBN(0xece1e214, 0xad9b45e7), TOBN(0xbff20402, 0x37f5fca9),
+	TOBN(0x51726e30, 0x9f1089b8), TOBN(0x865706cc, 0xfe71ad9e),
+	TOBN(0x73a31a3d, 0x8334627a), TOBN(0x0624f08a, 0x9c5860ee),
+	TOBN(0x1a0c1192, 0xee920e9e), TOBN(0xe1fe5130, 0xf02c3924),
+	TOBN(0x506c2b70, 0x61d2b62c), TOBN(0x9fe8b793, 0x7abb075e),
+	TOBN(0x2c25bf38, 0x7b14f18e), TOBN(0x20feb1aa, 0x8dad6cb1),
+	TOBN(0x3a3608c1, 0xf92f6528), TOBN(0x6935b540, 0x0c9b2549),
+	TOBN(0xa3173f48, 0xa9cea3e9), TOBN(0x03af78ea, 0x56548660),
+	TOBN(0xe7f3affd, 0xe0c0a6aa), TOBN(0xb7115a23, 0x4be9612d),
+	TOBN(0x401bd620, 0x98bb192c), TOBN(0xd775cadf, 0xe16cf12b),
+    },
+    {
+	TOBN(0xf85a9e40, 0xa3f1efc9), TOBN(0xf7c11161, 0x28033826),
+	TOBN(0xa8be96c1, 0x97dea1dd), TOBN(0x8f9e87e6, 0xd2343706),
+	TOBN(0x2ef25b26, 0xa321c86e), TOBN(0x1a4897eb, 0x4c32a04b),
+	TOBN(0x168ef06f, 0x4dc6953f), TOBN(0x702f5b04, 0xfed821c3),
+	TOBN(0x152bd28e, 0xaeb2d579), TOBN(0xff5749b3, 0xe6c41252),
+	TOBN(0x4f7d1a8a, 0xb7ea7230), TOBN(0x2e936ae2, 0x6f05c498),
+	TOBN(0xc851800f, 0xdb61ac17), TOBN(0xca7e38bc, 0x3d840125),
+	TOBN(0xff303b48, 0xc7f0b895), TOBN(0x5b8cce01, 0x18b5d73a),
+	TOBN(0xb198993b, 0xb0e60220), TOBN(0x93af4875, 0x30dbb8aa),
+	TOBN(0xce3d50f8, 0x66ed5e79), TOBN(0xb5474444, 0xcec77230),
+	TOBN(0x71d10ef7, 0xb84f160c), TOBN(0x41c821a7, 0x2cd7ce8e),
+	TOBN(0xf1d36471, 0x24da4cf0), TOBN(0xacc3ac39, 0x574814fc),
+	TOBN(0xbafb9c45, 0xfab2a612), TOBN(0x274ff6d0, 0xed5c7ab8),
+	TOBN(0xd0860ad9, 0xfa44c98f), TOBN(0x48a3edf9, 0x12ac3a1d),
+	TOBN(0xaaa411e6, 0x8d571ae5), TOBN(0xe452f553, 0x9c9a90c5),
+	TOBN(0x0e0f3db3, 0xf20731dc), TOBN(0xc17f493a, 0xd57ef110),
+	TOBN(0x24b713ca, 0xc45ea0e7), TOBN(0x43242d2e, 0x2d4b1bc6),
+	TOBN(0xbf3fdf74, 0x680e8e2e), TOBN(0x5aef595f, 0x314a0c2e),
+	TOBN(0x58f56534, 0x0dc1b992), TOBN(0xf3ae0ec3, 0xd4705883),
+	TOBN(0x2f33f4ca, 0x01194e98), TOBN(0x9f5dadb7, 0xaa6433c7),
+	TOBN(0x8276efe8, 0x95316202), TOBN(0x42cfb3ce, 0x0d7803ff),
+	TOBN(0xf5c83da3, 0x0cb413c1), TOBN(0x35d94bc3, 0xd3b79e6c),
+	TOBN(0xbd60d0d3, 0x3ab13914), TOBN(0xfc7eaae0, 0x93484bbd),
+	TOBN(0x39ce9cb8, 0x40fc4411), TOBN(0x73d3c563, 0xe08d87a2),
+	TOBN(0x2545b7c2, 0x650505ef), TOBN(0xc3217ac3, 0x4bcc669f),
+	TOBN(0x8578ff14, 0x60d8fd55), TOBN(0xd5c43666, 0x85ced2a2),
+	TOBN(0x94d8fa29, 0xcf9eb46b), TOBN(0x4b852c3d, 0x4f3e2151),
+	TOBN(0x73c5c8fa, 0x93cb6456), TOBN(0xf21c2de7, 0xae09171c),
+	TOBN(0x44410715, 0xffffb618), TOBN(0xe2d650cc, 0x4bfc0777),
+	TOBN(0xf4e47617, 0xc56942f4), TOBN(0x0553332e, 0x7195719e),
+	TOBN(0xa6e511f3, 0x371980e0), TOBN(0xa95c51bb, 0x16f6a58a),
+	TOBN(0xb727d19f, 0x100d7024), TOBN(0xaeeb95bf, 0xc2d9e256),
+    },
+    {
+	TOBN(0xa7890da2, 0xde671c4b), TOBN(0x26a96152, 0x1ee54f9a),
+	TOBN(0x2c124208, 0x7fcac0d9), TOBN(0x11713030, 0x1e9d29a2),
+	TOBN(0x127c9360, 0x46da0592), TOBN(0x6c128f3d, 0xfdb598db),
+	TOBN(0x774fcf9c, 0xc3f83662), TOBN(0x5acf7b39, 0x319c2997),
+	TOBN(0xcc369d7f, 0x26ba8dbb), TOBN(0x63bb7c44, 0x2daee9d1),
+	TOBN(0x01a49e75, 0xa8c8c336), TOBN(0x00d15036, 0xd734f4b5),
+	TOBN(0x3ea10b7a, 0xf9d5b04f), TOBN(0xd8001e97, 0xc09d8195),
+	TOBN(0xdfbb2434, 0x35f3e959), TOBN(0xc74bd981, 0x62bcab6d),
+	TOBN(0x910b3ff7, 0xfd173074), TOBN(0xf6cc2ab3, 0x76551f41),
+	TOBN(0x572f0729, 0x71efe99a), TOBN(0x83b97b00, 0x675dfb03),
+	TOBN(0x74854166, 0xb6421997), TOBN(0x5b587aa2, 0xad89e45b),
+	TOBN(0xaacf2609, 0x25b0ccf8), TOBN(0x06611049, 0x37a6d82d),
+	TOBN(0xb24583e6, 0xc696ee99), TOBN(0x2dba65ba, 0x60d21765),
+	TOBN(0x2bb32326, 0x83556f2d), TOBN(0x63310ffd, 0x93e3f40b),
+	TOBN(0x37a149dd, 0x96caa64a), TOBN(0xf352de77, 0xb11ae3c4),
+	TOBN(0xc0113e9d, 0x0da78506), TOBN(0x9637a99c, 0xc4188fba),
+	TOBN(0x772dcc48, 0xc904d067), TOBN(0xbda9c111, 0x97b6fcdc),
+	TOBN(0x7ec1a5b6, 0xd8d1077d), TOBN(0x185e5429, 0xf029aea2),
+	TOBN(0x817b61be, 0x66cebe21), TOBN(0xd9e18563, 0x0e5cb3de),
+	TOBN(0x8930f0e1, 0x06bcebb7), TOBN(0xabfefd02, 0x392dad82),
+	TOBN(0xa3881cc1, 0x2abf6552), TOBN(0x9993f2be, 0x36ad8c38),
+	TOBN(0x0d31f279, 0x02cae168), TOBN(0x3a79b28b, 0x1ce17a4a),
+	TOBN(0x80acf63c, 0x53a8d2b5), TOBN(0xa260cbfa, 0x6eaaf8c3),
+	TOBN(0xf25e1f7a, 0x7f8c958b), TOBN(0xb20afd48, 0x62f5ed10),
+	TOBN(0xd8060835, 0x43c1ea58), TOBN(0xc4ebebcf, 0xd9313d22),
+	TOBN(0xb65781af, 0x3805362a), TOBN(0xf6bacca8, 0x05134feb),
+	TOBN(0x74c6f3d6, 0x9ff33100), TOBN(0x3be75953, 0x6417fdce),
+	TOBN(0x637b77d0, 0xf1eeae11), TOBN(0xd164de22, 0x6f437c05),
+	TOBN(0x914408b1, 0x53a43c27), TOBN(0x6fb5f837, 0x09142c05),
+	TOBN(0x9528ed5f, 0xbdfec470), TOBN(0x5fc6ca67, 0x497282a2),
+	TOBN(0x976f4173, 0x62053946), TOBN(0x329c19d0, 0x9110c192),
+	TOBN(0xe14393a6, 0xca693bad), TOBN(0x9e9fbdea, 0x51bd732e),
+    },
+    {
+	TOBN(0x4f121b45, 0xbcce3897), TOBN(0xff5e8cdb, 0x09c46d9b),
+	TOBN(0xd124cc34, 0x6eeec122), TOBN(0x8f2d75c7, 0xafaa7582),
+	TOBN(0x54f29598, 0xb803b07a), TOBN(0x20094105, 0xd9fae999),
+	TOBN(0xcf3e75c8, 0xb90d9515), TOBN(0x926354ec, 0x11dc6b41),
+	TOBN(0xfebaa4ae, 0xace457d4), TOBN(0x9efa9f41, 0x0cf21345),
+	TOBN(0xd4ba40d7, 0x31d2bbc6), TOBN(0x25e6dd92, 0xa98b5a70),
+	TOBN(0x57be2d2b, 0xc8d713b5), TOBN(0x956bd4fa, 0xcb25f750),
+	TOBN(0x25b32150, 0x00f2f077), TOBN(0x062618f2, 0x07befbb5),
+	TOBN(0x07a443dd, 0x52a67a12), TOBN(0xa2158446, 0x43893682),
+	TOBN(0x6a82b256, 0x02e2c2a7), TOBN(0xfe90a660, 0x59d64ad5),
+	TOBN(0x7200fa0c, 0xb1aaec4c), TOBN(0xfacfdded, 0xe0b26b4a),
+	TOBN(0x037f20fa, 0x33e679e3), TOBN(0x344c1e1f, 0x308545f7),
+	TOBN(0x735b0dc6, 0xb3a3d4cd), TOBN(0x8c90f94e, 0xa6d1405f),
+	TOBN(0x38d9b16c, 0xbc857cbc), TOBN(0x1a6c716e, 0x4cbeb43f),
+	TOBN(0xbbab8435, 0x86b367cd), TOBN(0x5bbb4b98, 0x052fbb0a),
+	TOBN(0x9326f835, 0xc2731b03), TOBN(0x841a318d, 0xa9146510),
+	TOBN(0x41288184, 0x8db9269b), TOBN(0x65e0f3c8, 0xa4c3358b),
+	TOBN(0xe7b12555, 0x18a809eb), TOBN(0xf7275ed6, 0xf5bdf25f),
+	TOBN(0x24caf786, 0x38456529), TOBN(0xfdfdacd5, 0xad6d14f3),
+	TOBN(0x773a5e1f, 0x217234df), TOBN(0x745f82d8, 0x5a4cd501),
+	TOBN(0x147fdb3c, 0x2747fc69), TOBN(0x41b37973, 0xa342f6f5),
+	TOBN(0xb357afa3, 0xbad92acc), TOBN(0xd61e3c0e, 0xc92c5e26),
+	TOBN(0xe4f6f922, 0x86cc52ae), TOBN(0xc15c3ad1, 0x00b243f0),
+	TOBN(0x7ba5ff4c, 0x01f45bb7), TOBN(0xcb3bb25a, 0xa9960687),
+	TOBN(0xee0b93b1, 0xe62015ab), TOBN(0x40af714d, 0xc57e1f07),
+	TOBN(0xbe0fdf4c, 0xf3bf4c6f), TOBN(0xff3d2d54, 0xaf9d0031),
+	TOBN(0xdd8e8af6, 0x4bdfaa13), TOBN(0x83826fbd, 0x21f80e31),
+	TOBN(0xe2713a2b, 0x817edd5b), TOBN(0x52e886d7, 0x713535c4),
+	TOBN(0xf25d06f4, 0xb4e96418), TOBN(0xefd6d6ba, 0x44ee14ef),
+	TOBN(0xd907d245, 0xedc98402), TOBN(0xbd81d628, 0x57d16a22),
+	TOBN(0x05dc34de, 0x39a2a618), TOBN(0xa071d115, 0xa1456654),
+	TOBN(0xf9774cab, 0x7369b525), TOBN(0x3d3f7bd4, 0xa37ae65d),
+    },
+    {
+	TOBN(0x4cc99f5b, 0xcdcca161), TOBN(0xabe91787, 0x155cc544),
+	TOBN(0x49427791, 0xd823730a), TOBN(0x1631ff71, 0x7c3b3df9),
+	TOBN(0x209462c2, 0x4bec4dea), TOBN(0x1743c2da, 0x801d949d),
+	TOBN(0xa138132a, 0xffdb788c), TOBN(0x6b0d8963, 0x6f17ba63),
+	TOBN(0x4e726e87, 0xb2378306), TOBN(0x1c02525b, 0x3801ae05),
+	TOBN(0x7643aeb9, 0x21a04881), TOBN(0x34cd899e, 0x8dde45d6),
+	TOBN(0xb1b92a43, 0xf949af4c), TOBN(0xd3a4ed88, 0x33766486),
+	TOBN(0x14028f5d, 0x86da39f3), TOBN(0x31036272, 0x3beb3921),
+	TOBN(0x40691db7, 0xd9835e8e), TOBN(0x1071e51d, 0xb29a26d1),
+	TOBN(0xf281ff72, 0x2a543695), TOBN(0xfb8e43d0, 0xb2b6947c),
+	TOBN(0x452b2b5e, 0x2e10adf0), TOBN(0x77714931, 0x76214526),
+	TOBN(0x44f88372, 0xa05a94aa), TOBN(0xd5ec20b5, 0xc8d430d2),
+	TOBN(0x94229fc3, 0xee408b92), TOBN(0x7a02d048, 0x7dbb9a67),
+	TOBN(0xe151a30a, 0xfaea6dae), TOBN(0x3ed51c4c, 0x7725267c),
+	TOBN(0x587bf337, 0xb625751d), TOBN(0xb65ebf0d, 0x843e716b),
+	TOBN(0x22fb2738, 0x8c654774), TOBN(0x7e4553aa, 0x0371dfe6),
+	TOBN(0x7c92a241, 0x6599b6d7), TOBN(0x1259e327, 0x8b6ff1fc),
+	TOBN(0xda64b7da, 0x23e98de6), TOBN(0xdbeae5a6, 0x88c4b41c),
+	TOBN(0x3573950b, 0xd2a953b2), TOBN(0xc5d81f8f, 0x353b61e2),
+	TOBN(0xa4500a5a, 0xf599e4d2), TOBN(0x8c1f78a4, 0x88e8d8e4),
+	TOBN(0x7803d970, 0x9960f04a), TOBN(0xf48768d5, 0x61df4a8a),
+	TOBN(0xbfc1a42a, 0x27fdb3eb), TOBN(0x5ada1d24, 0x14ba7d25),
+	TOBN(0x8d473ab4, 0xe575c1d7), TOBN(0x7b56a84d, 0x37341b6e),
+	TOBN(0x53a26828, 0x031151c9), TOBN(0x352ce7f5, 0x8854ce4e),
+	TOBN(0xbdfe36dd, 0xd4169627), TOBN(0x7a4a786d, 0x109d49cd),
+	TOBN(0xabea17e4, 0x67a2e929), TOBN(0x730cc801, 0x01a78255),
+	TOBN(0xd52cd296, 0x29ea73e3), TOBN(0x92673021, 0x3bcf1b3f),
+	TOBN(0x46635d0a, 0xafd2d304), TOBN(0xe4b2bf50, 0xda79ddaf),
+	TOBN(0xb6c1f630, 0x9ff595d9), TOBN(0x9cc9e11a, 0x94aa13ad),
+	TOBN(0x73bbade2, 0xf22268ec), TOBN(0xa1ec9230, 0x25454dff),
+	TOBN(0xb11128b9, 0xd0398776), TOBN(0xdfe5727c, 0xeb2e815d),
+	TOBN(0x59a56c5e, 0x67265ffa), TOBN(0x68f718b5, 0xe23ad725),
+    },
+    {
+	TOBN(0x99933eb7, 0x9b9942c2), TOBN(0x57d22f0e, 0x2ab98a88),
+	TOBN(0x9284ef23, 0xb046e615), TOBN(0x2c63fee2, 0xf8767bf2),
+	TOBN(0x4128c584, 0x97d89bd4), TOBN(0x2e8785b5, 0x003b293a),
+	TOBN(0x42702655, 0xffb6f118), TOBN(0xd61b12c6, 0xde2f74c7),
+	TOBN(0x9ce4dd0f, 0x646f060c), TOBN(0x3804a4b6, 0x70035c0a),
+	TOBN(0xec875d72, 0x43409102), TOBN(0x699b133d, 0x1bbc8bac),
+	TOBN(0x63725487, 0xf2935e98), TOBN(0xa749db10, 0x66ecc90d),
+	TOBN(0x28051ebb, 0x0db473e7), TOBN(0x6206c4e4, 0x77d67242),
+	TOBN(0x80d23b6f, 0xb306bd1c), TOBN(0x20e3ca3b, 0x65344da2),
+	TOBN(0xe503fee4, 0x54a86d2a), TOBN(0xf71c87a1, 0x656d28f9),
+	TOBN(0x8a5656bc, 0x5c215be1), TOBN(0xeee29262, 0xec428a4c),
+	TOBN(0x89f106e5, 0x40b52954), TOBN(0xabd8416b, 0x91a861a4),
+	TOBN(0x28453f87, 0xdc811725), TOBN(0xf405a090, 0xfb7734cf),
+	TOBN(0xc2a34615, 0xf5d4db5c), TOBN(0x7daa3898, 0xee4a4cf9),
+	TOBN(0xb0f7e66f, 0x6c4aea3a), TOBN(0x6cbd7e1b, 0x087ce2d6),
+	TOBN(0x45f64e71, 0x18ca8ee9), TOBN(0xfc8aa754, 0x06e3bfcc),
+	TOBN(0xf9254482, 0xcb336dae), TOBN(0x24b3c64f, 0x16dfe3f8),
+	TOBN(0xb4c96fb4, 0x47d31bcc), TOBN(0xb7d5cb4d, 0x11896839),
+	TOBN(0x6ae72a17, 0xa552a765), TOBN(0x8bb03f1e, 0x6a76c3c4),
+	TOBN(0x48a014b5, 0xeb33c9a5), TOBN(0x183ef149, 0x11d1b1c9),
+	TOBN(0xf007b2e1, 0x32c1e095), TOBN(0xe90ed1aa, 0xc3be9514),
+	TOBN(0x7f834854, 0x4ffb67d7), TOBN(0xb5b43a48, 0x2974fa4b),
+	TOBN(0x1a8e7569, 0xcaeb83ae), TOBN(0xf6ad509a, 0x6e6836dd),
+	TOBN(0xa744d050, 0x0622a392), TOBN(0x6a59cfeb, 0x10a99c9c),
+	TOBN(0x7bfc6dbb, 0xa82d2c4e), TOBN(0xf494f0da, 0x213a939b),
+	TOBN(0x57d42fc8, 0xcf45d252), TOBN(0xe6199002, 0x034f04ab),
+	TOBN(0xaa59a52c, 0x53d4e7c6), TOBN(0x24ce6042, 0x779e367f),
+	TOBN(0x8cc6ba15, 0x5fa5a609), TOBN(0xc9657ea1, 0xb4f3bb5e),
+	TOBN(0x6d83ec61, 0x3feb2bb3), TOBN(0x3993c235, 0x2954275b),
+	TOBN(0xe7775bc5, 0xe444d1d9), TOBN(0x43d92460, 0x4a8a9bfe),
+	TOBN(0x62225173, 0xa0730eed), TOBN(0xbfcae4f9, 0xd65d02bb),
+	TOBN(0xb34ad8bc, 0xce4cbff5), TOBN(0xd1ee316b, 0xc475ae4a),
+    },
+    {
+	TOBN(0xfe221a36, 0x2e16dc53), TOBN(0x05f32e37, 0x30f7c631),
+	TOBN(0x2745a238, 0x9cd0bcbe), TOBN(0x68a98d6c, 0x7a5f806f),
+	TOBN(0x1299fbfa, 0x98c57304), TOBN(0xdc1ecc1b, 0x236f8014),
+	TOBN(0x3953deff, 0xc91c440c), TOBN(0x89636dd2, 0xd0d9dfe3),
+	TOBN(0x39a66328, 0x465756bc), TOBN(0x0c0cce1a, 0xc729dce3),
+	TOBN(0x27ab9049, 0x47956cf4), TOBN(0x4519828b, 0x7c555195),
+	TOBN(0x0401cdef, 0xbe4587dd), TOBN(0x7e7f9840, 0x5a5a2841),
+	TOBN(0x048b478a, 0xeef65990), TOBN(0x0f94384a, 0xeceb5d09),
+	TOBN(0xd8536887, 0xca67011e), TOBN(0x8217ee6f, 0xf60bd507),
+	TOBN(0xc663eb1c, 0x969554ab), TOBN(0x9ce96173, 0x5253f4bf),
+	TOBN(0x06f7dd7e, 0x9339e7ca), TOBN(0x748ce946, 0x7f3a4ccd),
+	TOBN(0xa2f5a4a7, 0x7dcead34), TOBN(0x6be9fefd, 0x011cb019),
+	TOBN(0x0709b1bc, 0x93897ad5), TOBN(0x7fda8e91, 0x5a92b145),
+	TOBN(0x37638f1d, 0xfbf1a121), TOBN(0xfb573ce3, 0x73c22478),
+	TOBN(0xc9ae22a0, 0x1af90ed9), TOBN(0xb2fa56a8, 0x477cd7ee),
+	TOBN(0x8174c993, 0x5c92e914), TOBN(0x5a75cbe4, 0x22541ca3),
+	TOBN(0xab563723, 0x09811cfb), TOBN(0xe32762b5, 0x36b16868),
+	TOBN(0x67781633, 0xc3a19da5), TOBN(0x3c48dd57, 0xd737bb24),
+	TOBN(0xb85ace72, 0xa43033be), TOBN(0x71bc1459, 0x6392e0ce),
+	TOBN(0xaba916ec, 0xa09810e1), TOBN(0x23454dbd, 0x8ef71a02),
+	TOBN(0x626f5b47, 0x52a72d76), TOBN(0x778dbe91, 0x84b53163),
+	TOBN(0xa0b4ba4e, 0xed86f0f4), TOBN(0x6dfb4aef, 0x312eac72),
+	TOBN(0xc1a798c7, 0x0e163a87), TOBN(0xa2985293, 0x6a4075f5),
+	TOBN(0x29a39b70, 0x779c074d), TOBN(0x0aac65a3, 0x12c85a45),
+	TOBN(0xc99821e5, 0x3d6b9077), TOBN(0xf759be74, 0xefc5f176),
+	TOBN(0x10ca00c5, 0x2f4879d0), TOBN(0x1c49af65, 0x1d8c8cff),
+	TOBN(0x73cc04fc, 0x989efea5), TOBN(0x82c53eae, 0x9e72f5b4),
+	TOBN(0x071b71db, 0x7abf0040), TOBN(0xd875cba6, 0xbb3602ec),
+	TOBN(0x6f60d25b, 0xdaca1280), TOBN(0x80eb3ea1, 0x72116148),
+	TOBN(0x4a9f2243, 0x25c0d1e2), TOBN(0x041be782, 0x78160bad),
+	TOBN(0xdef9d82f, 0xd92d7809), TOBN(0xf9123499, 0x43f10afa),
+	TOBN(0x6e96dcfa, 0x712cdb28), TOBN(0x4578b05d, 0x946eaf45),
+    },
+    {
+	TOBN(0xfc44346c, 0x5c2db8a6), TOBN(0x0be65c6e, 0x61ef8c63),
+	TOBN(0x4e8b4471, 0x39a1797c), TOBN(0xd1531ad8, 0xf4bf00de),
+	TOBN(0x2533f7f5, 0x318ae608), TOBN(0xb83d9836, 0x46df0028),
+	TOBN(0x72a7bdff, 0x92388819), TOBN(0x12c6dba5, 0xa1b3bfc6),
+	TOBN(0x734cc650, 0x8caead79), TOBN(0x18199c35, 0x8e53b9c6),
+	TOBN(0x4f572092, 0x8f2ad9e8), TOBN(0x8a330516, 0xf8aaa32a),
+	TOBN(0x08039bdf, 0x7c8b0fba), TOBN(0xfcff3080, 0xb4b45082),
+	TOBN(0x09168f15, 0xddecb320), TOBN(0x1f287095, 0xd9d6ba12),
+	TOBN(0xb0a6d10f, 0x94ce023c), TOBN(0x042fdcdf, 0xec17aa0f),
+	TOBN(0x8cc7d639, 0x2d2aa957), TOBN(0x39d2c2e6, 0xa4a7e97f),
+	TOBN(0x0defbafd, 0x2673cf95), TOBN(0xe919d28c, 0xfe74999a),
+	TOBN(0x45eb494e, 0xfb9d5a68), TOBN(0xd7d3fdfa, 0x02396033),
+	TOBN(0x0e136379, 0x2712f5aa), TOBN(0xffb51d22, 0xb525628a),
+	TOBN(0x6ec71e3b, 0xf7e34242), TOBN(0xf6ae79c6, 0xe78448f0),
+	TOBN(0x935c4540, 0x35f21db3), TOBN(0x65f4ad50, 0x8ef9afdd),
+	TOBN(0x02e99326, 0xb925d229), TOBN(0xb4eb97c8, 0x44a83947),
+	TOBN(0x56ac6e46, 0x130239f6), TOBN(0xc64ec56a, 0x6d62d0d1),
+	TOBN(0xcef02c67, 0x87433b4b), TOBN(0x7891baaf, 0xae6f7648),
+	TOBN(0x70b59ce5, 0x4860677c), TOBN(0xe37828b2, 0xc725c19d),
+	TOBN(0x57522dd9, 0x413021c2), TOBN(0x468a9b7b, 0x1dee3405),
+	TOBN(0xc4deb68e, 0xa54e5aec), TOBN(0xef1b7d23, 0x096a62c6),
+	TOBN(0x4169749d, 0xdb0de1e8), TOBN(0xdbf695de, 0x625d58e5),
+	TOBN(0x834f318e, 0x1c2c750e), TOBN(0x4530a526, 0xd480ebeb),
+	TOBN(0x534736e0, 0xef380e9b), TOBN(0x1558cb46, 0x2590b48a),
+	TOBN(0x933043ca, 0x7ad720ee), TOBN(0xeeb37ce9, 0xdf8be2ed),
+	TOBN(0x2194018a, 0x5e90f3a1), TOBN(0x38935eca, 0x3b1919fe),
+	TOBN(0xe79809f9, 0x313dfd4a), TOBN(0x058a7d5d, 0x3ce5eb68),
+	TOBN(0x0e36e3b6, 0xf57e0081), TOBN(0xb0eb974d, 0x766c05d8),
+	TOBN(0xdec1a4b7, 0xb5942501), TOBN(0x01d67d42, 0xe422c290),
+	TOBN(0x953e4486, 0x4b81a3c5), TOBN(0x0837cf04, 0xf02c175a),
+	TOBN(0xbdf3b05f, 0xb25af012), TOBN(0xf2246932, 0x87e215f5),
+	TOBN(0xdd2db9f4, 0xe259b651), TOBN(0x8af160bb, 0x28dd5e8a),
+    },
+    {
+	TOBN(0x20ea2c55, 0xf8b8fb1a), TOBN(0x90fee979, 0x8c0dc389),
+	TOBN(0xa8b658cb, 0x49d87b44), TOBN(0x4291065a, 0xf5be974e),
+	TOBN(0x49de6a78, 0x4cb4ca51), TOBN(0xc628962e, 0x726d8575),
+	TOBN(0xe50cf6e6, 0xca70c6ea), TOBN(0xe0ec52c3, 0x8323e9a8),
+	TOBN(0xf96e0712, 0x8a373343), TOBN(0xb3905ca4, 0xb9b2414e),
+	TOBN(0x96452a49, 0x25eb8675), TOBN(0xa3da8f8c, 0x96625d75),
+	TOBN(0x6479558b, 0x9f59b2a4), TOBN(0xbad1f432, 0x4d85d288),
+	TOBN(0x2521c88a, 0xd490cdad), TOBN(0x6b58845a, 0x48acbc5a),
+	TOBN(0x64d9d6e1, 0x92fbf1ee), TOBN(0x7c6b61d6, 0x39620ac0),
+	TOBN(0x3da33d64, 0x0d038d3a), TOBN(0xbcda09cb, 0x384d1d3a),
+	TOBN(0xaf5d05bf, 0x3b165451), TOBN(0xd386279e, 0xb467ba63),
+	TOBN(0x8a058ab7, 0xc35a6f9f), TOBN(0xe45f3c46, 0xe0e742ee),
+	TOBN(0xce7acea5, 0xdd64da70), TOBN(0xec24639f, 0x1db6961a),
+	TOBN(0x13f281e1, 0x1746d2a6), TOBN(0x945ce430, 0x0760f482),
+	TOBN(0x67b19ee6, 0x69199d74), TOBN(0xcce8428c, 0x15c1601a),
+	TOBN(0x0346995f, 0x5de05a2b), TOBN(0x8d09a796, 0xf7091f70),
+	TOBN(0xd89a7756, 0x1366e903), TOBN(0x7940bc90, 0x84c25399),
+	TOBN(0x544143b1, 0x08a1f4bf), TOBN(0x12295341, 0x3e400fee),
+	TOBN(0x0afe9b9c, 0x02a3ef7d), TOBN(0x419cb25b, 0xcde9abe1),
+	TOBN(0x253f1fd5, 0xe1145f45), TOBN(0xa6b95696, 0x31970a4b),
+	TOBN(0x4078c070, 0xc818ea2b), TOBN(0xff2b96be, 0x4e4c0474),
+	TOBN(0x66932d82, 0xbdbbb4bd), TOBN(0x6ad5c625, 0xa4c56dff),
+	TOBN(0x6ec268da, 0x254bbe9f), TOBN(0x3cece986, 0xc624ee0e),
+	TOBN(0x5b273f04, 0xad3f0ddd), TOBN(0x4a3eb151, 0x806a9690),
+	TOBN(0x92c9b9c1, 0x98db029c), TOBN(0xa403cd90, 0x1e2346d7),
+	TOBN(0x73b50799, 0x0b2a5a54), TOBN(0x87c0051b, 0x19cf0f18),
+	TOBN(0xe85aa1f0, 0x4552ce34), TOBN(0x4c5f9d26, 0xfe0a09f7),
+	TOBN(0x88637ace, 0xdd6f4aad), TOBN(0xd81dfb2c, 0x4813fbd5),
+	TOBN(0x2a755001, 0xc26b320d), TOBN(0x99ffa4a5, 0x147cb06d),
+	TOBN(0x79e27b1d, 0x07e6fd08), TOBN(0x1be05a39, 0xd3cb3407),
+	TOBN(0x63cc3e5d, 0xf85f8bc4), TOBN(0x66a8ed80, 0x9a70e1e6),
+	TOBN(0xd90c3002, 0x87778451), TOBN(0x6e7df089, 0x05a31df5),
+    },
+    {
+	TOBN(0x41d458ab, 0xf171f634), TOBN(0x21fdd2f3, 0x181b8712),
+	TOBN(0x516cb196, 0x93b0f689), TOBN(0x85220cb5, 0xeb7d2e9d),
+	TOBN(0x93bcd4f0, 0x996994a2), TOBN(0x8c512c5c, 0xe4db0aea),
+	TOBN(0xca19edcd, 0x94e18dd5), TOBN(0xc1d8a587, 0x0647d351),
+	TOBN(0xf2dc0e25, 0x146e6687), TOBN(0x6720b949, 0x7364829d),
+	TOBN(0x2c8a5492, 0x4bd70ceb), TOBN(0x47b51f19, 0x2cc4baeb),
+	TOBN(0xc8f2ab17, 0x3eb36549), TOBN(0x75a3e864, 0x9b0ba510),
+	TOBN(0x4a439115, 0xa9219b5b), TOBN(0xd6b108b4, 0x915978b4),
+	TOBN(0xc9b3adc3, 0x25f7e3dc), TOBN(0xf8d6c3ac, 0x72c41580),
+	TOBN(0x7b467ac8, 0x1a071a74), TOBN(0x79b41396, 0x709a3a74),
+	TOBN(0x5eba0b7e, 0x762ca8a3), TOBN(0xa70c4f3d, 0x68cf74c7),
+	TOBN(0x140b156f, 0x86b4df3f), TOBN(0xc8be788d, 0xc1ce85dd),
+	TOBN(0x9cf59d4b, 0xbac9b4e1), TOBN(0xd848c73e, 0x3b6d2c35),
+	TOBN(0x27e503c2, 0x2e8da54d), TOBN(0x28b9c860, 0x0ec1e904),
+	TOBN(0xcf633dcc, 0xd2333ae9), TOBN(0x99d08518, 0x2b82c034),
+	TOBN(0x068d32be, 0xbbc0b457), TOBN(0x1a134f2d, 0xee123ee0),
+	TOBN(0xb134eeac, 0x26cdd207), TOBN(0xf2817921, 0x0984a733),
+	TOBN(0xa8828762, 0x1143e97e), TOBN(0x2452a682, 0x7c801fdc),
+	TOBN(0x15fd3738, 0x0547defa), TOBN(0x833964b7, 0x9bd357c2),
+	TOBN(0x4a7e3fab, 0xc228be8a), TOBN(0x4d72ad2c, 0x632e1496),
+	TOBN(0x80f180e1, 0x9031d457), TOBN(0xfe572d7c, 0x9c9808e8),
+	TOBN(0xcd265b05, 0x7b77697b), TOBN(0xd5ab8c4b, 0x498adbfe),
+	TOBN(0xdd84d1b4, 0x4a977d3e), TOBN(0x79d9d30d, 0x8c49dc1c),
+	TOBN(0xb64e7e09, 0x5a7e1bba), TOBN(0x947d62a3, 0x00d52d20),
+	TOBN(0x25937383, 0x31b60538), TOBN(0x48079b20, 0x3c468daf),
+	TOBN(0xe76a0f32, 0x1654b4a9), TOBN(0x0f800a36, 0x339e1e30),
+	TOBN(0xd0b543e0, 0x8aa59c69), TOBN(0x98bf3a4d, 0xfc1413ef),
+	TOBN(0x10c6f59d, 0xbade955a), TOBN(0xb03bf658, 0x9027f7ab),
+	TOBN(0x54eaa003, 0x84d6641b), TOBN(0x33ff494a, 0x28f960da),
+	TOBN(0xf3c4f63a, 0x0fcdfa11), TOBN(0x37c0b473, 0xa796680e),
+	TOBN(0xc7987cbb, 0xf0bf1788), TOBN(0xcd51db01, 0x34e1c3cc),
+	TOBN(0xb2186005, 0x0eef08a2), TOBN(0xdcfbe112, 0x0b463beb),
+    },
+    {
+	TOBN(0x0768ee7f, 0xe729abb4), TOBN(0x2599dbff, 0x2e8fa57f),
+	TOBN(0xa1f67fbd, 0x7c692ed3), TOBN(0x7b573295, 0xe4d1842c),
+	TOBN(0x2fe05469, 0x39ae2d4b), TOBN(0x1b03505f, 0x9b3e15bc),
+	TOBN(0x8e8d6ac2, 0xc8052764), TOBN(0x35690a99, 0xff61ac95),
+	TOBN(0x0b8a830b, 0x5d503c81), TOBN(0xee7db732, 0x9ee47567),
+	TOBN(0x6b50a6e9, 0xe05ceb36), TOBN(0x252be456, 0x1c97e791),
+	TOBN(0xb33af73e, 0x43146932), TOBN(0x4517f2a8, 0x27dab7b5),
+	TOBN(0xed449c74, 0x8a169854), TOBN(0x4034682e, 0x12ab22ef),
+	TOBN(0x3e752ab4, 0x05e2c4db), TOBN(0x2a71efdf, 0x161e3dbf),
+	TOBN(0xe399e0dd, 0x9bf59ac6), TOBN(0x8a2b4c12, 0x406a6cf2),
+	TOBN(0x5d93105e, 0xc58d9ec6), TOBN(0xe6e8c945, 0x87f2da4a),
+	TOBN(0x883b7d7b, 0xa8e4592a), TOBN(0x2ac7ebc4, 0x6613aef5),
+	TOBN(0x838e65fd, 0xaedd382d), TOBN(0xc5c9248f, 0x671021c6),
+	TOBN(0x85599646, 0x4f64028c), TOBN(0x6dff53ae, 0x624d8044),
+	TOBN(0x20f1f04f, 0xdab64008), TOBN(0x34c2023f, 0x2f49e9ab),
+	TOBN(0x4c2d39d0, 0x73cfec77), TOBN(0x3e3dcb0d, 0x88966cb3),
+	TOBN(0x4a9ccd80, 0x9e8fee99), TOBN(0x3597654f, 0x91a448d9),
+	TOBN(0xfa963c57, 0x772d74b2), TOBN(0xa790e0a6, 0xe80ae8e4),
+	TOBN(0x77d830d4, 0xa4d78922), TOBN(0x0c98b9d8, 0x232e81c2),
+	TOBN(0xc177a9f5, 0xf016899b), TOBN(0x3cbbcb68, 0xf01216e1),
+	TOBN(0x03cfb382, 0x9912d8eb), TOBN(0x4668db2c, 0xfef31dff),
+	TOBN(0x9637a654, 0x625a4472), TOBN(0xf9884a8f, 0x2e353a36),
+	TOBN(0x61f68058, 0x78c7e1de), TOBN(0x068db905, 0x18b14a08),
+	TOBN(0x1f46bcb0, 0x9ad05359), TOBN(0x7ec33874, 0x552dc7ba),
+	TOBN(0xf4be6209, 0x7d40f0c1), TOBN(0x4b452890, 0x52354ee7),
+	TOBN(0xe570c7a0, 0xaaac6627), TOBN(0x60f1d123, 0x4e9727b8),
+	TOBN(0xb165e20c, 0x8f436ca6), TOBN(0xdd6d7059, 0x1d9c0bc6),
+	TOBN(0x92564202, 0xe425f297), TOBN(0x28b701cf, 0x98f588a4),
+	TOBN(0xbc17127f, 0x31fb1a03), TOBN(0x579ff15c, 0xa7dc58c5),
+	TOBN(0xcbb16373, 0x1a99ad28), TOBN(0xf001423e, 0xa18d243f),
+	TOBN(0xb2fd8cac, 0x13e0fa0c), TOBN(0x479e81d7, 0xf8ec3599),
+	TOBN(0x10934de7, 0x8c2b59c6), TOBN(0x4541bac2, 0x5ba4f3c5),
+    },
+    {
+	TOBN(0x0ed1dcff, 0xce535768), TOBN(0x4b33b7fe, 0x5d1f4afe),
+	TOBN(0x43ecff7a, 0xf8d25da6), TOBN(0xf6ae652b, 0xc9a30859),
+	TOBN(0x5fc0a8d2, 0x735c5a96), TOBN(0x3606a0bf, 0x367c2b78),
+	TOBN(0x1d1ad585, 0x900a4ec8), TOBN(0x6ad21533, 0xfec3592b),
+	TOBN(0x17150616, 0xbaa07902), TOBN(0xdcfb6e65, 0x3dc8eace),
+	TOBN(0xd6a14dd3, 0xc0b9d66d), TOBN(0x4a57c8ac, 0x392fcf22),
+	TOBN(0x6675ee7c, 0x8628d264), TOBN(0x8a2fe550, 0x4fb56f6b),
+	TOBN(0xda8938e9, 0x142d30a8), TOBN(0x8068d05c, 0x255645df),
+	TOBN(0x7cea5568, 0x0bc589b6), TOBN(0x54e3dfbe, 0x2c3c7b7e),
+	TOBN(0xc733c1bb, 0x37eb358c), TOBN(0x14569824, 0x80d4d9e5),
+	TOBN(0xbb2620bd, 0x8b1b3d8d), TOBN(0xcdd1928b, 0x0fe5b494),
+	TOBN(0x1076faf7, 0x51c8b255), TOBN(0x558fd788, 0xcc275deb),
+	TOBN(0x071ccbfb, 0x5dba705a), TOBN(0x8b92491e, 0xce20438d),
+	TOBN(0x0ab32c8c, 0x9ec80519), TOBN(0xdbfea75c, 0xc49b0089),
+	TOBN(0x41e3e09f, 0xb56c8010), TOBN(0x6984047e, 0x5e93d356),
+	TOBN(0x985a73a0, 0xe79fd8ee), TOBN(0x7c7b961b, 0x112cd966),
+	TOBN(0x95399b01, 0x3d1fdd32), TOBN(0x6b2eca9f, 0x234891b2),
+	TOBN(0xf52c78ae, 0xee5ae964), TOBN(0x4f21c14d, 0xd015d1c9),
+	TOBN(0xefb061a9, 0x49af1245), TOBN(0x193173b0, 0x465d0384),
+	TOBN(0x82ef53eb, 0xe02d1336), TOBN(0x797796d1, 0xe0242dc3),
+	TOBN(0x079f6705, 0x3225b1d6), TOBN(0x8cd1b659, 0xfde63bfe),
+	TOBN(0x2c6f4ca8, 0xc4b488e4), TOBN(0xf310951e, 0x5c6a746d),
+	TOBN(0xc3ed00b0, 0xf18fc3bd), TOBN(0x0d1b720a, 0x31629410),
+	TOBN(0x3e8d7961, 0x35a0a6b2), TOBN(0xfd8670e8, 0xaa5b8f74),
+	TOBN(0xe97cc412, 0xfa81e182), TOBN(0x968a5120, 0xa46a9dcf),
+	TOBN(0xcae18f41, 0x5558cc4e), TOBN(0xc1e3a246, 0x9d2e4f71),
+	TOBN(0x62cbc419, 0x1e86d94c), TOBN(0xbadae0b2, 0x3b38178d),
+	TOBN(0x24ac8405, 0xc84be52f), TOBN(0x516e039f, 0x31eb1149),
+	TOBN(0x782e24fe, 0x63f63406), TOBN(0xaf3fe2b9, 0x4fb8b18b),
+	TOBN(0x9762c6e6, 0x35335a50), TOBN(0xe002847d, 0x431a487f),
+	TOBN(0x65fb1958, 0x27c1f419), TOBN(0x8f3d03af, 0xf1d86b33),
+	TOBN(0x21269bcf, 0x1856b38c), TOBN(0x8a837584, 0xb749e78a),
+    },
+    {
+	TOBN(0x27c8c5ad, 0x3c01ece4), TOBN(0x695cfa97, 0xaa6b42e7),
+	TOBN(0x08edb119, 0x0f142a3e), TOBN(0x55529920, 0x06daa367),
+	TOBN(0x0dfd418c, 0x12df6d77), TOBN(0x293d24e7, 0x681fb695),
+	TOBN(0x6e2ef599, 0x0e2d0be8), TOBN(0xe23f2310, 0xa53d4771),
+	TOBN(0x77dae94f, 0x474ce39a), TOBN(0x874e4d5c, 0x06c624d5),
+	TOBN(0x2820aa6c, 0xd9c507c3), TOBN(0xca6f1776, 0x37899a24),
+	TOBN(0xabedde18, 0x01b5bd11), TOBN(0x20925046, 0xf5aad356),
+	TOBN(0x9f2a97d8, 0x76a87ca5), TOBN(0x4d3853c0, 0x5619e322),
+	TOBN(0xbff906d3, 0x7677b9d1), TOBN(0xc50a5092, 0xf8d26d43),
+	TOBN(0x1dd6ba83, 0x5ffb2bb3), TOBN(0x05e7ca49, 0xde1aa173),
+	TOBN(0x93c6442b, 0x3f21e1bd), TOBN(0x09ad4fec, 0xe89d86b0),
+	TOBN(0x834d3c8e, 0x71bc447b), TOBN(0x8e1f6d7d, 0xa7534406),
+	TOBN(0x3d4633b9, 0x712c4464), TOBN(0x10a43690, 0x41ca845e),
+	TOBN(0x27097a5a, 0x63034604), TOBN(0xc9c2c75b, 0x4955b1b7),
+	TOBN(0xe0688a37, 0x5caec460), TOBN(0x4a7b00c3, 0x44e92dd0),
+	TOBN(0x2f9d7256, 0x4e824c74), TOBN(0x9385885b, 0x8ce1b55c),
+	TOBN(0x2b32ec6b, 0x1e3832f6), TOBN(0xd2be74f1, 0xafa923c9),
+	TOBN(0x1ca819a1, 0x07c2fb13), TOBN(0x7d6db083, 0x240d4374),
+	TOBN(0x36470f95, 0x6d6f8880), TOBN(0x244722c0, 0xe19384db),
+	TOBN(0x976e9121, 0xfb99eec2), TOBN(0xd4360c98, 0xc8a5c0f0),
+	TOBN(0xba14d737, 0x7eace4c8), TOBN(0x6df7e606, 0x067074fa),
+	TOBN(0x6d18c509, 0x7cfb3f5b), TOBN(0xbb88d597, 0xfbde5be4),
+	TOBN(0x0eedbc41, 0x2179c2e4), TOBN(0xbf4048f7, 0xe7586ad7),
+	TOBN(0xac4436fe, 0x62b473f6), TOBN(0xc7474cd0, 0xbf0f3194),
+	TOBN(0x59060abc, 0xe33ee129), TOBN(0xa4fb504c, 0x0003e6b7),
+	TOBN(0x5741ff6b, 0x70957560), TOBN(0x565cc857, 0x14a11eae),
+	TOBN(0x2db0c081, 0x373c6bae), TOBN(0x2b1bc794, 0x19530650),
+	TOBN(0x624ae57d, 0x624b350c), TOBN(0xff896e64, 0xf4f77746),
+	TOBN(0xa8fbb2c7, 0xa970def1), TOBN(0xb98c2f9a, 0x81223295),
+	TOBN(0xfb02a296, 0xb1064def), TOBN(0x88337588, 0x0bb10c70),
+	TOBN(0xd32403dd, 0x42493a6e), TOBN(0x85c1d2b3, 0x7e861fb2),
+	TOBN(0xe5d90cdf, 0xef26f6ea), TOBN(0x0ccb3e6b, 0xb5ddf5e4),
+    },
+    {
+	TOBN(0x4f918b5a, 0x7803d9c8), TOBN(0xd2b9f52f, 0x54d685ce),
+	TOBN(0x11db6232, 0x1e28547c), TOBN(0xaaa53240, 0x0db546ce),
+	TOBN(0x1bfa8318, 0x25bedaee), TOBN(0x527a49ce, 0xd03f6d2a),
+	TOBN(0xdc5deb32, 0x1c5a17d0), TOBN(0xc47e4621, 0x4a7a8ee2),
+	TOBN(0xefb5d29e, 0x8e99c735), TOBN(0x0e9c9ab8, 0x0d8c49aa),
+	TOBN(0x504154d9, 0xb38a0f87), TOBN(0x94de2eec, 0x6f133448),
+	TOBN(0x57dbbc30, 0x036b7a23), TOBN(0x4124a08d, 0xeb55a6ad),
+	TOBN(0x3e552fb0, 0xed50f94a), TOBN(0x9a70a780, 0xac33c645),
+	TOBN(0x7ff20da6, 0xecef73a2), TOBN(0x8a14a125, 0xf1a4da87),
+	TOBN(0x3bad7506, 0xbff65767), TOBN(0x0bcf9493, 0xbc3542e6),
+	TOBN(0x278c8856, 0x7e43c37a), TOBN(0x135a9fd9, 0xd13b0d61),
+	TOBN(0x069a791c, 0xe37888f6), TOBN(0x1c3edafb, 0x4ea6880d),
+	TOBN(0x7a8c6772, 0xe25888c9), TOBN(0x21486d20, 0x839508bc),
+	TOBN(0x4e12f4b4, 0xc6068c08), TOBN(0x93858eb6, 0x92ab636e),
+	TOBN(0xc0d1146e, 0xb95d88c1), TOBN(0x94f60186, 0x89d25ba1),
+	TOBN(0x5f3ae4ac, 0x9d0498e8), TOBN(0x270b10b7, 0x19c36ab8),
+	TOBN(0x5665d8d6, 0x3c7065ed), TOBN(0xa57ce9e3, 0x5f524792),
+	TOBN(0x39503342, 0x0f85f627), TOBN(0xfadb6106, 0x481a86e8),
+	TOBN(0x6c8e1f2a, 0xdadf1100), TOBN(0x488e4581, 0xc32709b6),
+	TOBN(0x2edd2243, 0xf733dd84), TOBN(0xa86c1931, 0x914b81e1),
+	TOBN(0x7429ae6e, 0xfd59c991), TOBN(0xdbefcc0c, 0x0ce0e9f5),
+	TOBN(0xda318a12, 0xf9f67eb6), TOBN(0x7711ab2f, 0xf7bcb7c8),
+	TOBN(0x1ddb7882, 0x42f385c9), TOBN(0x7e8091ef, 0xceb0d5ae),
+	TOBN(0x58886dfc, 0xc568e7ed), TOBN(0x8e8e99a1, 0x7e1e6329),
+	TOBN(0xb20c1579, 0xc67dc253), TOBN(0x49f6a098, 0x0007cd6e),
+	TOBN(0xae83fed6, 0xe12aeac1), TOBN(0xacb990ae, 0x29423d5c),
+	TOBN(0x5b618102, 0x6e78d75c), TOBN(0x56378f28, 0x32a60ca0),
+	TOBN(0xc495cafa, 0xc4966a18), TOBN(0xff12dcc9, 0xe9eeee8c),
+	TOBN(0x51f7658f, 0x52e1bde3), TOBN(0x73185f35, 0x0244652b),
+	TOBN(0xf605452d, 0x620c9bdf), TOBN(0x1066eb10, 0x176218e1),
+	TOBN(0xa64807ba, 0x849274dd), TOBN(0x0b83a566, 0xfd0c3f65),
+	TOBN(0xcbb219bf, 0xde4dedd5), TOBN(0x19967cd7, 0x6bbbebc9),
+    },
+    {
+	TOBN(0x1d53ee96, 0x0d74472e), TOBN(0xfb7a620a, 0x0f8a950e),
+	TOBN(0x8f71c9e6, 0xf7532f1a), TOBN(0xeb9a3088, 0xe7242fc2),
+	TOBN(0x3c8a55ee, 0x4694da6e), TOBN(0x3da597b9, 0x87e293d4),
+	TOBN(0x5cdc4b86, 0xf626102c), TOBN(0x66f3071b, 0xb75ff122),
+	TOBN(0xa6499c62, 0x2af3c2bf), TOBN(0x2759a6be, 0xe592b6b3),
+	TOBN(0xd5c8d30c, 0xcb19f27b), TOBN(0xde3e192e, 0x96d5df62),
+	TOBN(0x3a36430b, 0x8b4bcdf0), TOBN(0x10a9a665, 0x4ef8c82c),
+	TOBN(0x002b3c34, 0xd20e054d), TOBN(0xd58b69d9, 0x6fa9e4a4),
+	TOBN(0x148ca97f, 0x7f4082e7), TOBN(0x3d66c69a, 0xbab63c2a),
+	TOBN(0x241730b9, 0x6b4a117f), TOBN(0x49446cd9, 0x8e251693),
+	TOBN(0x51aba16a, 0xa10cbbea), TOBN(0x48111767, 0x05a18a84),
+	TOBN(0x0a6b316a, 0xd27feed7), TOBN(0xf42b98d2, 0x8c9e648d),
+	TOBN(0x7f965b4c, 0xbe07353f), TOBN(0x78f9076c, 0x6d425137),
+	TOBN(0x2570a103, 0x5dbbfd72), TOBN(0x2279188f, 0x7e69e362),
+	TOBN(0x47c9174f, 0xd5aa65ed), TOBN(0xd541f372, 0x92d28b60),
+	TOBN(0xd1b7a73f, 0xd8b43f1c), TOBN(0x0b5ec47c, 0xa03bd87c),
+	TOBN(0x768abdb9, 0xe2a4f865), TOBN(0xcdb60299, 0x3ce04331),
+	TOBN(0xe50eb88d, 0xc223663d), TOBN(0x1a288ac0, 0x209b459f),
+	TOBN(0x7e1af17d, 0x8803e292), TOBN(0x30218ac6, 0xd0a309da),
+	TOBN(0x5fec2754, 0xd206b762), TOBN(0xa73cbbd7, 0x83cb4d02),
+	TOBN(0x72f4cff5, 0xcb7981b0), TOBN(0xfc1c43f9, 0xe6826b88),
+	TOBN(0x6fda9712, 0xc89843c9), TOBN(0x28f45bc9, 0xfefd5741),
+	TOBN(0x0563c88c, 0x0ae42bfb), TOBN(0x90ac7595, 0xe5c5870c),
+	TOBN(0xd2fe62cb, 0xe4cceee0), TOBN(0x40a48ae6, 0x2a635a06),
+	TOBN(0xe02b78b5, 0x3ac78da1), TOBN(0x316569b0, 0xe4da23ec),
+	TOBN(0xede4a082, 0x8d76427d), TOBN(0x45753476, 0x5fd62913),
+	TOBN(0x2c8333ee, 0x257d61a0), TOBN(0xb1200d63, 0x31076b6e),
+	TOBN(0x8b3f3c81, 0x9e4328e9), TOBN(0x299e841f, 0x0cf167ea),
+	TOBN(0x1ae923b9, 0xb18e5000), TOBN(0x036a6cee, 0xb5ad8ea5),
+	TOBN(0xc1406549, 0x543e4363), TOBN(0x99b03687, 0x1e8d0424),
+	TOBN(0x34376e17, 0x6916ba76), TOBN(0x27ba8eac, 0x474d9eb2),
+	TOBN(0x661689ef, 0x5f9d3e12), TOBN(0x21930352, 0x0d3d8f13),
+    },
+    {
+	TOBN(0x3aa7dd2c, 0x1ae88e5c), TOBN(0xf6f4c414, 0x1f152a1c),
+	TOBN(0x1ee393cd, 0xeea65e35), TOBN(0xd7346111, 0xce485f85),
+	TOBN(0x7914abdc, 0x8d29b4dd), TOBN(0x7b4b2f73, 0x0fc527a8),
+	TOBN(0xb9b8970d, 0xec4c2058), TOBN(0xcde60e37, 0x6ebfe244),
+	TOBN(0x4c9338c4, 0x55e7857e), TOBN(0x4eb34d7d, 0xcb256d67),
+	TOBN(0xab91a619, 0x9633e4f6), TOBN(0xbc7c325d, 0x2dabbec5),
+	TOBN(0x746c8617, 0x16979be1), TOBN(0x21534cca, 0x9df19058),
+	TOBN(0x00567869, 0xa41c0a9a), TOBN(0xab16d3b2, 0xdf53c948),
+	TOBN(0x291952fe, 0xfe8105cf), TOBN(0x7acd8d35, 0x756c7854),
+	TOBN(0x482e6172, 0xd69422fe), TOBN(0x9288d9b3, 0x1c4a2d26),
+	TOBN(0xa35742d5, 0x421977d4), TOBN(0x90222ece, 0x0b431508),
+	TOBN(0x14d662d5, 0xa4ffddae), TOBN(0xe85731a5, 0x193cc91a),
+	TOBN(0xff2cb699, 0x7c0e6a7f), TOBN(0xf1f20ed8, 0xda84a26e),
+	TOBN(0x4ae14206, 0xbb77fae4), TOBN(0x44f2311e, 0xfcd3c6c4),
+	TOBN(0x8f922e9f, 0xab54cbda), TOBN(0xaa83e6e5, 0x25a516c0),
+	TOBN(0xa36f4e7f, 0xb1687e39), TOBN(0x16bd88f9, 0x4077b0f9),
+	TOBN(0xed157b73, 0xc549f0ca), TOBN(0x9b6c0532, 0x79c08662),
+	TOBN(0xca1d711b, 0x8446cc7b), TOBN(0x34511580, 0x41368b3f),
+	TOBN(0xfc35e2fb, 0x1007c524), TOBN(0x6043158d, 0xa14613b4),
+	TOBN(0xbfd84ea9, 0xa40d6ec4), TOBN(0x4e7977af, 0x07969a04),
+	TOBN(0xe5e99feb, 0x96f30361), TOBN(0xf83887f3, 0xcd04d710),
+	TOBN(0xdfb52e25, 0x91308793), TOBN(0x51e8b793, 0xfdfaae82),
+	TOBN(0x0ac79118, 0x15c857f6), TOBN(0x2158eb2b, 0xcb8b0e18),
+	TOBN(0xa5fcc597, 0xc999ddc1), TOBN(0x814915cc, 0x54c6b40d),
+	TOBN(0xc056f16a, 0x758f1b42), TOBN(0x62cad361, 0xc9b447d9),
+	TOBN(0xdbc94105, 0x1aec84fa), TOBN(0x8aea68ec, 0xbfac5227),
+	TOBN(0x590667dc, 0x4afac340), TOBN(0x62401ac6, 0x620ed6dc),
+	TOBN(0x167e7903, 0x3c8651d3), TOBN(0x533d083e, 0x19e2cfd5),
+	TOBN(0x35d24773, 0x631ca000), TOBN(0x06d4d9dd, 0x6b5b1d4a),
+	TOBN(0x8280ca92, 0xa87c86c6), TOBN(0x33606d0e, 0x3d1a0849),
+	TOBN(0x686edc2e, 0xd22d74ed), TOBN(0x4f751d58, 0x8e9b3d64),
+	TOBN(0xcc2d13de, 0xbf3a7c24), TOBN(0x432606a4, 0x1a7b1e26),
+    },
+    {
+	TOBN(0xa2ab4658, 0xd834e0b6), TOBN(0xe0be518f, 0xc7a3e87d),
+	TOBN(0x89374011, 0xb4466690), TOBN(0x2aba540a, 0x7f0c54a4),
+	TOBN(0xf7cb84a2, 0x2f20332a), TOBN(0x0f921352, 0x9a5a4b27),
+	TOBN(0x31a2e7cd, 0x5f74e538), TOBN(0x068486fa, 0xbdd4ef1d),
+	TOBN(0x1df1781b, 0x027c9844), TOBN(0xc6b89b2a, 0xd607d4ea),
+	TOBN(0xe5611346, 0xd56a8539), TOBN(0xdfa400ef, 0x0bd54419),
+	TOBN(0x8e9ef5d5, 0x48a45a8a), TOBN(0x655dc2d2, 0x4bec5506),
+	TOBN(0xbf2862cd, 0x6efdb700), TOBN(0x2aab79c0, 0x6b254734),
+	TOBN(0x98377b16, 0x58c7f130), TOBN(0x397ca6cc, 0xd97200d8),
+	TOBN(0x05949b34, 0x3377f9b1), TOBN(0x60fb2180, 0x1123335d),
+	TOBN(0xc457ae2f, 0x3b38fb12), TOBN(0x012a752e, 0xe6b41a62),
+	TOBN(0xedeb72fa, 0x5bb49ad1), TOBN(0x1b17a360, 0x769b30de),
+	TOBN(0x5310dba9, 0xe0477138), TOBN(0x709b3d73, 0x0c25ca78),
+	TOBN(0xe6dc844b, 0xa53ad7a9), TOBN(0xb6a465a1, 0x355d289d),
+	TOBN(0x74a17825, 0x68a4c902), TOBN(0x11fb86a0, 0x73248c9f),
+	TOBN(0xe90d4980, 0xa870aa7c), TOBN(0x7fcaf084, 0x265091a7),
+	TOBN(0xa972e3cb, 0xb6596f1b), TOBN(0xf2e5f541, 0x9768c03e),
+	TOBN(0xaac4e741, 0xc1553911), TOBN(0xcec13843, 0x0c06c3d8),
+	TOBN(0x61c460dc, 0xccaa2645), TOBN(0xf7385893, 0xdc9eb347),
+	TOBN(0x22b88cf9, 0x4f05d169), TOBN(0x4faa77a0, 0xdc50e86b),
+	TOBN(0xbbc15e7f, 0xa4a00a4d), TOBN(0xbc808cbe, 0xf7482b9f),
+	TOBN(0xab44c679, 0x101739f4), TOBN(0x5a8a4b08, 0x7b3f1a49),
+	TOBN(0x339c8998, 0x2839933b), TOBN(0x1917486a, 0x64d3bb92),
+	TOBN(0xae0a3199, 0xcc82c075), TOBN(0x86d92682, 0x1963b8a8),
+	TOBN(0xb4f66224, 0x046da14e), TOBN(0x260c3737, 0x1fb08cd5),
+	TOBN(0x4f14e101, 0x0a8ac4e8), TOBN(0x2e9f35a2, 0x61ab49df),
+	TOBN(0xef3cf988, 0x70f6d57a), TOBN(0x3c6f4f1d, 0x0abd30c9),
+	TOBN(0x57041601, 0xa95c1dbd), TOBN(0x48d80fd4, 0xaff55b1f),
+	TOBN(0x8c6d991a, 0x3715ad69), TOBN(0xffca7635, 0x6f5f7d7d),
+	TOBN(0xcd699df3, 0x09b90e38), TOBN(0xbd43902a, 0xf3c2a0f5),
+	TOBN(0x5f7d51ce, 0x53654097), TOBN(0xe5f64b4c, 0x254ba632),
+	TOBN(0xebc5ed4c, 0x81748387), TOBN(0xea7a8d9a, 0x2e25905b),
+    },
+    {
+	TOBN(0x45568cb1, 0xb069c16d), TOBN(0x73886d56, 0x5b419f61),
+	TOBN(0x8b6ec846, 0xd7e60c92), TOBN(0xc1bfbd7c, 0x7088cb87),
+	TOBN(0x1f90781c, 0x88900baa), TOBN(0x6708492f, 0x13444e33),
+	TOBN(0x43e4a629, 0xf006f2c0), TOBN(0xe9cd6c6f, 0x2a4df64d),
+	TOBN(0xa23059e6, 0x64686ce5), TOBN(0x64f4dd0e, 0x5da3e976),
+	TOBN(0x9c332a79, 0x8b163fcd), TOBN(0xe38c3f03, 0x12cbf93a),
+	TOBN(0xf7ba01e0, 0x6674682c), TOBN(0xb0271d6f, 0xe1c39e32),
+	TOBN(0xe48d9e82, 0x73068bc4), TOBN(0xcce55970, 0x18903342),
+	TOBN(0x15fcba1a, 0x0a07fb88), TOBN(0x27767c79, 0x09c2f9b0),
+	TOBN(0xc74dda6b, 0x85f2e2d4), TOBN(0xb913f35f, 0xad60bb88),
+	TOBN(0x11a5d39d, 0xbb98af42), TOBN(0x4673d306, 0x5306d759),
+	TOBN(0x89b7badc, 0x9fee1595), TOBN(0x5db9444d, 0xae6df759),
+	TOBN(0xb4f1bd4c, 0xe704da0b), TOBN(0x1252a8bf, 0xfd78a684),
+	TOBN(0xaf2c73b7, 0x00504db5), TOBN(0xc1531cb5, 0x8fb11d64),
+	TOBN(0x35abe0c5, 0x2a67ad3d), TOBN(0x990c9be9, 0x89430cc1),
+	TOBN(0xe51f0dfc, 0xf80565ed), TOBN(0x5740bf5c, 0x6d8468ea),
+	TOBN(0xa5b2b08a, 0x68626403), TOBN(0xd0595c28, 0xa426bc4f),
+	TOBN(0x3fb7a86a, 0xe9b06d13), TOBN(0x63ed2709, 0x2d781ccc),
+	TOBN(0xe55cf5c3, 0x03fc3573), TOBN(0x38ab5337, 0x49f113c4),
+	TOBN(0xaa49964f, 0xb2040044), TOBN(0xbbb67815, 0xa0934ad2),
+	TOBN(0x44f25eb9, 0x1b09465e), TOBN(0x878cad75, 0x247835c3),
+	TOBN(0xef7d57a3, 0xd571dbe4), TOBN(0x163f6d09, 0x85e79e25),
+	TOBN(0x4ad61fda, 0x2fedd3bb), TOBN(0xaec933b0, 0xed03c98e),
+	TOBN(0xf2fe238a, 0x9be0b18a), TOBN(0x74d804ce, 0x16719db6),
+	TOBN(0xa7ec478f, 0x67778397), TOBN(0x02f0081c, 0x527cbe6d),
+	TOBN(0xef8a9df0, 0x98ca69ea), TOBN(0x6f05ff49, 0x68ccf418),
+	TOBN(0xd27a9659, 0xede6f306), TOBN(0x84925b50, 0x6f427428),
+	TOBN(0xc982768c, 0xf059bcb3), TOBN(0x41ceea3b, 0xf298f3f8),
+	TOBN(0xe8b027c6, 0x7bcc469b), TOBN(0x0fffd2b7, 0x1184b7df),
+	TOBN(0x4989336c, 0x853e1794), TOBN(0x787b61af, 0xac71a6c9),
+	TOBN(0x95f85594, 0x1c62b4bb), TOBN(0x0726340c, 0xc9bb2f93),
+	TOBN(0x0e7bfff6, 0xe18044db), TOBN(0xd4f51b34, 0x5c4b20b8),
+    },
+    {
+	TOBN(0xd3cb6382, 0xbf43f47d), TOBN(0xb2a65949, 0xd19497f1),
+	TOBN(0x9ae21225, 0x1d148145), TOBN(0x47ae8ebe, 0x1064f212),
+	TOBN(0xb9b8b339, 0x992fcb57), TOBN(0x8a31cf02, 0x1e46e60e),
+	TOBN(0x0d96e92e, 0x3010d9d4), TOBN(0x6d760124, 0x41ef7b00),
+	TOBN(0xc5c0eaa0, 0xaee8034f), TOBN(0xcdc034af, 0xec646cc5),
+	TOBN(0x990241d4, 0x3068d357), TOBN(0x60e6023b, 0xe85d4b4a),
+	TOBN(0x3ce64c79, 0x07d0fdd1), TOBN(0x35d7b38d, 0x3917021c),
+	TOBN(0xa5af732c, 0x74c09699), TOBN(0x31430a24, 0xcdb48eeb),
+	TOBN(0x76442aa5, 0xfca0d69b), TOBN(0x74f45860, 0xd186ddc9),
+	TOBN(0xa38c3705, 0x6e5f76f5), TOBN(0x34a66af1, 0xd96fa0e2),
+	TOBN(0xf4c7d3eb, 0x1f80bce0), TOBN(0x51162c66, 0xa1536e3c),
+	TOBN(0x945d34a8, 0xa5d48d26), TOBN(0x3f58e3b6, 0x5d8b01c5),
+	TOBN(0x9d280096, 0xecc461a5), TOBN(0x4c489cca, 0x0a84099a),
+	TOBN(0x2ba2791c, 0x38a31eb9), TOBN(0xc7b80bf3, 0x81145e7c),
+	TOBN(0xe142ee61, 0xff1e9dc6), TOBN(0x07ddc5fa, 0x58638615),
+	TOBN(0xca103705, 0xb742063a), TOBN(0x60d108ba, 0x884aceae),
+	TOBN(0x00b87e97, 0x4f335822), TOBN(0x4c6eb72a, 0x92f8675e),
+	TOBN(0x0ad73a61, 0x46cce525), TOBN(0x2f52f44f, 0x04f17f2a),
+	TOBN(0xdd7ea7df, 0x3e9afce0), TOBN(0x9a518291, 0x12ee6d08),
+	TOBN(0x71363df1, 0x46ec1eac), TOBN(0xdeb31aed, 0x96f7de21),
+	TOBN(0x68c17b96, 0xa8fd215c), TOBN(0x26d630c9, 0x9a8c9620),
+	TOBN(0x60082941, 0xbd78174b), TOBN(0x3338c422, 0xc4063a89),
+	TOBN(0xb99b1bf7, 0x9111c86f), TOBN(0xa65a1630, 0x98c4f7b6),
+	TOBN(0x7bf1f57d, 0xbb2f1a17), TOBN(0x47a4663a, 0xf7f75dd1),
+	TOBN(0xc118f0a5, 0x65eae5e8), TOBN(0x684a3a76, 0xe8d0c756),
+	TOBN(0x11b6a7bb, 0xf1f55b28), TOBN(0xa340112b, 0xcd6ab022),
+	TOBN(0xd247c5f3, 0x17e06151), TOBN(0x10b47b53, 0x9e25552c),
+	TOBN(0x2b9f6a88, 0xffcdcd40), TOBN(0x3ee42515, 0x52a01732),
+	TOBN(0xd8c71b8b, 0xb727b097), TOBN(0x23052672, 0x30730cc0),
+	TOBN(0xa9c8d9d7, 0x92891ad1), TOBN(0x0706cb47, 0x03ff5788),
+	TOBN(0xa4f91eab, 0x2249e456), TOBN(0xe943929d, 0x8e8dfe5d),
+	TOBN(0x684eb812, 0x289ecd92), TOBN(0x80837a11, 0x81239be0),
+    },
+    {
+	TOBN(0xa796c705, 0x7e87e8fb), TOBN(0x17587cca, 0x6f22fe49),
+	TOBN(0xaec46c6d, 0xa98241fc), TOBN(0xfba832e3, 0x933a0663),
+	TOBN(0xa36ad54b, 0x5caf3c04), TOBN(0x5c47c08e, 0x1b1d8400),
+	TOBN(0xfbcca8eb, 0x913edbf9), TOBN(0xb7b060c2, 0x32830e12),
+	TOBN(0xf1cf3ef1, 0xbd3f42fc), TOBN(0x73041018, 0x8a5d192d),
+	TOBN(0x03758794, 0x4112dc09), TOBN(0xe610419c, 0xcbdc079c),
+	TOBN(0x5448af27, 0xe4cdaeb9), TOBN(0x511afee5, 0xbc18f85e),
+	TOBN(0xb19bbf40, 0x7e8c4af6), TOBN(0xda147a38, 0xddaec2b0),
+	TOBN(0xd2161939, 0x51b9c65e), TOBN(0x9e65dfa0, 0xf9ecb391),
+	TOBN(0x033d120d, 0xfbc1dd5c), TOBN(0x606a8643, 0x3df99694),
+	TOBN(0x72861f15, 0x842832de), TOBN(0xe64b4175, 0xc8457f0d),
+	TOBN(0xd69b3e39, 0x342dfa3f), TOBN(0xa63bc4f9, 0x7c4d9926),
+	TOBN(0x49200726, 0xfffebae5), TOBN(0xc9ad676d, 0xfa3524c9),
+	TOBN(0x38b85d58, 0x2720dbd4), TOBN(0xe37a695a, 0x271f8921),
+	TOBN(0x0eeecd3e, 0x575b56c5), TOBN(0x84d11a9d, 0x53c0ffae),
+	TOBN(0xa724e907, 0x15a81d69), TOBN(0x194cefc9, 0x3178e2f8),
+	TOBN(0x543de621, 0x9a163611), TOBN(0x836adffa, 0x9b460a8e),
+	TOBN(0xffdc4ea9, 0xf49fc53a), TOBN(0x25109f21, 0x1f4d936e),
+	TOBN(0xdcd183c7, 0xe7dde2a8), TOBN(0x7edda731, 0xb6908747),
+	TOBN(0x4744f83f, 0xa1d09ac9), TOBN(0xd9c7beaf, 0x15e1363f),
+	TOBN(0x9ef298e7, 0x23c3747d), TOBN(0x5c37f58a, 0x6b010ac4),
+	TOBN(0x59041d35, 0x30339691), TOBN(0xc79c5f3e, 0x1775dea5),
+	TOBN(0x56d34499, 0x019e3e22), TOBN(0xc94ecf3d, 0x54e641d7),
+	TOBN(0x8ecdab52, 0x793964cf), TOBN(0xf66e843f, 0xd398e808),
+	TOBN(0xc0316492, 0x2a720cca), TOBN(0x876c0e9b, 0xe4bd336f),
+	TOBN(0x74ce2b66, 0x679f966a), TOBN(0x5847b65c, 0x404bc09e),
+	TOBN(0x98902f2f, 0x3bba0ab5), TOBN(0x2d1cb3bd, 0x9612bcee),
+	TOBN(0x72b91f9b, 0x9d3d1bb9), TOBN(0x2de714bd, 0x37ee6c1e),
+	TOBN(0x81632ca9, 0x7bf04cf7), TOBN(0x56753330, 0x93abd666),
+	TOBN(0x0247ab35, 0x96de30c4), TOBN(0x0c01d7e7, 0xcceb13ef),
+	TOBN(0x20efef4d, 0xba2bfc38), TOBN(0x0dc0c2af, 0x9c3fdfea),
+	TOBN(0x078d9582, 0x2fd4d8f1), TOBN(0x0106f423, 0x024737c1),
+    },
+    {
+	TOBN(0xdcf72c51, 0xd07d666b), TOBN(0x7be94e37, 0x3b017d97),
+	TOBN(0x223bf6c2, 0xfac3bc99), TOBN(0x74d2a809, 0xd04893a8),
+	TOBN(0x8002e64b, 0xf8a42f90), TOBN(0x5279dede, 0xd12524e8),
+	TOBN(0x3bcc147b, 0x8b083086), TOBN(0x5e20f1dd, 0xaecd797e),
+	TOBN(0x83c9f7dd, 0x0100ff01), TOBN(0xdca15d49, 0x307ea715),
+	TOBN(0xc36358f5, 0x74d135e8), TOBN(0x4f861b62, 0x72f82054),
+	TOBN(0xd5197d83, 0x94a353ea), TOBN(0xf864a08c, 0xebf39640),
+	TOBN(0x33e2175f, 0xaf1d8d0d), TOBN(0xf0be95b8, 0x8fcd8ce1),
+	TOBN(0xfe61ba8f, 0x3bd27728), TOBN(0xc35b43e3, 0xa7b9ab38),
+	TOBN(0xe12260ed, 0x77472408), TOBN(0xc5f01927, 0x8bb6a3e5),
+	TOBN(0x54d26204, 0xb105e536), TOBN(0x2c4223f3, 0xe936d661),
+	TOBN(0xfa04967d, 0x8f26b942), TOBN(0x68a1f5f0, 0x882f15d8),
+	TOBN(0x84b19633, 0x4b01ef1d), TOBN(0xfd8edf80, 0x73b55fd4),
+	TOBN(0x50c84fa1, 0xf6360b7a), TOBN(0xa0e17a01, 0xa46840d9),
+	TOBN(0xea331951, 0x88de7c14), TOBN(0xd1df95a0, 0x5a9bb459),
+	TOBN(0xde8069fe, 0xd049c6a9), TOBN(0x87cc06f8, 0x5d904025),
+	TOBN(0x77fa3cd5, 0xe8247176), TOBN(0x14fabef5, 0xe92ed4c5),
+	TOBN(0xa407f371, 0xde0c34d9), TOBN(0x54273f5f, 0x02fa8c18),
+	TOBN(0x54742d1b, 0x23eb69a3), TOBN(0x2ab1e73c, 0x71a0b251),
+	TOBN(0x3730520b, 0x6183402c), TOBN(0xfc2e22a5, 0x2fffab1c),
+	TOBN(0x85768f36, 0x59e86228), TOBN(0x58e06b67, 0x5198abd9),
+	TOBN(0x440fd9f0, 0x0360aea2), TOBN(0xd61cd56a, 0x5d03dc32),
+	TOBN(0x5f16ebb1, 0x2cd31416), TOBN(0xe91e3237, 0x507140af),
+	TOBN(0x23d45cc2, 0xf5baf3b4), TOBN(0x9b54e665, 0xd53b3745),
+	TOBN(0xda869a85, 0x5a8ea319), TOBN(0x8d1c271b, 0xe8cd8cf2),
+	TOBN(0xebde1d7c, 0x4329ef4f), TOBN(0x5cae1dd9, 0x25db4a11),
+	TOBN(0x03c47c13, 0x8c69d26d), TOBN(0x8da33928, 0x712b9a12),
+	TOBN(0x7f48cf2c, 0xfc33ab17), TOBN(0x6fd4398a, 0x8328c558),
+	TOBN(0xaa1a15ee, 0x2b44a371), TOBN(0x31444c60, 0xeb31ca5e),
+	TOBN(0xde110deb, 0xee6a0340), TOBN(0x64069dcb, 0x70580ea5),
+	TOBN(0x9d9f659e, 0x8884976e), TOBN(0x2165a158, 0x3b455727),
+	TOBN(0x7a5513eb, 0xd2372879), TOBN(0x29ac89a2, 0x422347d9),
+    },
+    {
+	TOBN(0xb9ee58a3, 0xa0faccd6), TOBN(0xf7d29c6e, 0x7602fb2f),
+	TOBN(0x4477ed85, 0xf5877932), TOBN(0xe9a55013, 0xa0912750),
+	TOBN(0x0005cc97, 0xf1485f20), TOBN(0xa4f3bdbd, 0xa24a49d1),
+	TOBN(0x779828f7, 0x1610610c), TOBN(0xbc41e3bb, 0x5d9af2fc),
+	TOBN(0x0793efba, 0x0201fe02), TOBN(0xb942ba92, 0x60fd4e2b),
+	TOBN(0x86c6b1ea, 0xe9a26bd1), TOBN(0x9f0c36c4, 0xe5f040a9),
+	TOBN(0xaa32fb07, 0x2946a7d4), TOBN(0xf0c94119, 0xd7e72c81),
+	TOBN(0x67c42ebf, 0x5e3b1a1b), TOBN(0xe17d2b71, 0x1f9b19c2),
+	TOBN(0xfcc3751e, 0x77a4ee51), TOBN(0x86b687c7, 0x4f735671),
+	TOBN(0xc244c1da, 0xee8e4811), TOBN(0x8be0324f, 0x176d47cb),
+	TOBN(0xa9a4c409, 0x620bca6d), TOBN(0x588447e7, 0xd26dacc2),
+	TOBN(0xf4092cfb, 0x1e4d7284), TOBN(0xd143ebe1, 0x105e2bb1),
+	TOBN(0x09632c66, 0x9603de3a), TOBN(0xfb1dbf00, 0xe76abfa9),
+	TOBN(0xa1909f43, 0xec6c16f5), TOBN(0x41c2f403, 0x48d081b2),
+	TOBN(0xd46632a3, 0x11bcf829), TOBN(0xa3bf2b40, 0xb53768b3),
+	TOBN(0xbd00d3fd, 0xa0938d53), TOBN(0x0f980df0, 0xbb20804b),
+	TOBN(0xeff479ab, 0xd048e2ed), TOBN(0x29f57deb, 0xd25da98a),
+	TOBN(0x480fe6e3, 0xbc1869b2), TOBN(0xa84e7ebe, 0x05f51831),
+	TOBN(0xa8e85a36, 0x47d6d346), TOBN(0x5563ce78, 0xe34164a2),
+	TOBN(0x6e60a416, 0xc3068058), TOBN(0xf85c454a, 0x5fff5638),
+	TOBN(0x0aed1e6c, 0xb3d0c451), TOBN(0xb1c0d6ce, 0xa33157b3),
+	TOBN(0x881fb3e0, 0x06c15d44), TOBN(0xac39aad4, 0xba07b864),
+	TOBN(0xbe2dd762, 0x59a6282d), TOBN(0xd23c646e, 0xa0e2815e),
+	TOBN(0x47a8b985, 0xeb75e769), TOBN(0x36a9cccb, 0xaa766e8a),
+	TOBN(0xb50d350a, 0xb51d4633), TOBN(0x1a384e37, 0xd19b19e5),
+	TOBN(0xd7bc3af8, 0x8653de9f), TOBN(0xb95c3bb2, 0x4bb69423),
+	TOBN(0x0788f827, 0x18d3a4da), TOBN(0x1b467250, 0xe2573424),
+	TOBN(0xfe919e59, 0xf867562f), TOBN(0xdfa87315, 0x06518ab0),
+	TOBN(0x54342bdc, 0x568946e2), TOBN(0x628898c1, 0xd66394bd),
+	TOBN(0xbc221bd7, 0xdcd40680), TOBN(0xc80d3b96, 0xe0b01d4b),
+	TOBN(0x3b3ecb3d, 0x11092edc), TOBN(0x42cb42b0, 0x768aae4f),
+	TOBN(0xf4aa27d7, 0xa46e50f2), TOBN(0x53591344, 0x84468fb2),
+    },
+    {
+	TOBN(0x0e326cb6, 0x895cb07a), TOBN(0xc17b53d2, 0x4503f398),
+	TOBN(0x0f26e91c, 0x613f4470), TOBN(0x14d5bd58, 0xba8ee654),
+	TOBN(0x05b275d6, 0x7fc16468), TOBN(0xb0734890, 0x20efda4f),
+	TOBN(0x8903c6d5, 0x6ff1d08c), TOBN(0x39c192b9, 0xbde5ff4b),
+	TOBN(0x6fe426af, 0xc36e3063), TOBN(0x916b89e6, 0x03788665),
+	TOBN(0x3bd37100, 0xb53e7a2e), TOBN(0x640e3811, 0x2db27c20),
+	TOBN(0x8660aee8, 0x275b8f31), TOBN(0x5fc228f2, 0xd1db84c5),
+	TOBN(0x5c97c52e, 0x7777776c), TOBN(0x66b98066, 0x7eec0ebe),
+	TOBN(0x12fa45ea, 0x939f9b34), TOBN(0x9d5c9dea, 0x63a2e472),
+	TOBN(0x210804c2, 0x28dd31a3), TOBN(0xbdb312c9, 0x3e2bce0d),
+	TOBN(0xc04ae2e9, 0x9e568a2f), TOBN(0x9b69be84, 0x65fbe530),
+	TOBN(0x529c201d, 0xf31b21e2), TOBN(0x55d38cea, 0xe982e03d),
+	TOBN(0x7b060607, 0x098acbbc), TOBN(0x302c1d32, 0x3eeb0f11),
+	TOBN(0xb81e8672, 0xad86351c), TOBN(0x3ebe1c22, 0xf3add80c),
+	TOBN(0xbb48c2f9, 0xc5002fe5), TOBN(0xc2593ed5, 0x7c17200b),
+	TOBN(0x25d9e218, 0x723631e6), TOBN(0x77b3701c, 0x03723b71),
+	TOBN(0xe3b9dea5, 0x007550f6), TOBN(0x767fe012, 0x08f44d0a),
+	TOBN(0xfdf46213, 0x29903be6), TOBN(0x1a7f8cd3, 0xe4308527),
+	TOBN(0xe184e989, 0x0ee91d04), TOBN(0x822bcde8, 0x17d39459),
+	TOBN(0xbc4124a6, 0x14092422), TOBN(0x070b1656, 0xca58638d),
+	TOBN(0x9c5e8f47, 0xc26a6d58), TOBN(0x814e7ba0, 0x6955bf94),
+	TOBN(0x0cfacb2a, 0x0a4911d8), TOBN(0x7b8096ad, 0x553edfec),
+	TOBN(0x0ac4fd63, 0x7181681d), TOBN(0x82d8d213, 0x94899945),
+	TOBN(0x997a4583, 0x1484794f), TOBN(0x64ef86e3, 0x9f314b11),
+	TOBN(0x9ed875c0, 0xee6f54fb), TOBN(0x90145c3d, 0xf9a6cbd2),
+	TOBN(0x53387782, 0xdd341b4c), TOBN(0x32b3035d, 0xa232b93b),
+	TOBN(0xdf283549, 0x47ec5118), TOBN(0xd6f49075, 0xd87c4b9b),
+	TOBN(0x21f8721b, 0xc3962daf), TOBN(0xebd47c3e, 0x7d00f437),
+	TOBN(0xde770b46, 0x293a3f16), TOBN(0xa1eb5424, 0x03e63c38),
+	TOBN(0x162d8a08, 0xb74b1fa1), TOBN(0xa534ca61, 0xbe3a1526),
+	TOBN(0x6e879abf, 0x1d717dcf), TOBN(0x4fecbe10, 0xd134496d),
+	TOBN(0x8a31c62a, 0x8dd6bdd6), TOBN(0x0bdda334, 0xf709db4c),
+    },
+    {
+	TOBN(0x1c64d96d, 0x12b960f4), TOBN(0x82f6a7a4, 0x8a07e730),
+	TOBN(0x1e4dd238, 0xc27e88e1), TOBN(0x29ab7ab1, 0x751dcca8),
+	TOBN(0x0b64ebac, 0xff82c8d0), TOBN(0x60e69120, 0x41dfb49e),
+	TOBN(0x12078daa, 0xdfe3a119), TOBN(0x73832573, 0x7bcbfe97),
+	TOBN(0xdfc84d5f, 0x86dc60c6), TOBN(0x22d713cc, 0x06f10cca),
+	TOBN(0x77a6e201, 0x6a7cf45d), TOBN(0xc81c7022, 0x5b64f840),
+	TOBN(0x0cc15dd0, 0x4eb71e62), TOBN(0xbf8451e5, 0xa3b7098b),
+	TOBN(0xb92f8a5c, 0xeeeeeed8), TOBN(0xcd7300cc, 0xfdd81d7c),
+	TOBN(0x25f48bd5, 0x273f3668), TOBN(0x3ab93bd4, 0xc745c8e4),
+	TOBN(0x42100984, 0x51ba6347), TOBN(0x7b662592, 0x7c579c1a),
+	TOBN(0x8095c5d3, 0x3cad145f), TOBN(0x36d37d08, 0xcbf7ca61),
+	TOBN(0xa538403b, 0xe63643c5), TOBN(0xaba719d5, 0xd305c07a),
+	TOBN(0xf60c0c0e, 0x13159778), TOBN(0x60583a64, 0x7dd61e22),
+	TOBN(0x703d0ce5, 0x5b0c6a38), TOBN(0x7d7c3845, 0xe75bb019),
+	TOBN(0x769185f3, 0x8a005fca), TOBN(0x84b27daa, 0xf82e4017),
+	TOBN(0x4bb3c430, 0xe46c63cd), TOBN(0xef66e038, 0x06e476e2),
+	TOBN(0xc773bd4a, 0x00eaa1ec), TOBN(0xecffc024, 0x11e89a15),
+	TOBN(0xfbe8c426, 0x532077cc), TOBN(0x34ff19a7, 0xc8610a4f),
+	TOBN(0xc309d312, 0x1dd23a08), TOBN(0x04579bd0, 0x2fa728b3),
+	TOBN(0x7882494c, 0x28124845), TOBN(0x0e162cad, 0x94b0c71b),
+	TOBN(0x38bd1e8f, 0x84d4dab0), TOBN(0x029cf740, 0xd2ab7f29),
+	TOBN(0x19f59654, 0x149223b1), TOBN(0xf7012d5a, 0xaa7dbfd8),
+	TOBN(0x1589fac6, 0xe302d03a), TOBN(0x05b1a427, 0x2913328a),
+	TOBN(0x32f48b06, 0x2908f29f), TOBN(0xc9df0dc7, 0x3e629623),
+	TOBN(0x3db0eb81, 0xdcdea9f6), TOBN(0x2028b87b, 0xf34d97a5),
+	TOBN(0xa670ef05, 0xba683699), TOBN(0x656606bb, 0x44657276),
+	TOBN(0xbe506a92, 0x8fd8a230), TOBN(0xade920eb, 0xb0f89737),
+	TOBN(0x43f0e437, 0x872c5b5f), TOBN(0xd7a8f87c, 0xfa01e86e),
+	TOBN(0xbcee168c, 0x52747e2d), TOBN(0x43d6a848, 0x07cc7871),
+	TOBN(0x2c5b1411, 0x6e963f43), TOBN(0x4a6994c3, 0x7c742a4c),
+	TOBN(0xdd0f357e, 0x3ae2fb9f), TOBN(0x9fd97c21, 0xa26892da),
+	TOBN(0x14638c55, 0x1bad7bac), TOBN(0x17bb4669, 0xee13b699),
+    },
+    {
+	TOBN(0x0baea591, 0x25c6b139), TOBN(0xe4115ab8, 0x2f5468f6),
+	TOBN(0x9c8e768c, 0x9ff62a4f), TOBN(0x40679f43, 0x7278e37a),
+	TOBN(0xb33c3c2c, 0xf8b5c39f), TOBN(0xf810f20f, 0x51276220),
+	TOBN(0x8467f1c5, 0x1efdede1), TOBN(0x7ed4de6d, 0xa811ee02),
+	TOBN(0x4c9f69f6, 0xb3d6c587), TOBN(0x3da7ed25, 0x839d1ebf),
+	TOBN(0x5db80e29, 0xf80d1dc9), TOBN(0x677369ee, 0x028c0c2f),
+	TOBN(0x2432d5c7, 0xffeabab3), TOBN(0xe151ed13, 0x24a7eef1),
+	TOBN(0xcd505b14, 0xcf852c24), TOBN(0xfca42767, 0xbd20ba15),
+	TOBN(0x036aff3c, 0x88b30c43), TOBN(0xacbbd35d, 0x050bbad1),
+	TOBN(0x00fec86b, 0x79a97960), TOBN(0x9f0663e5, 0x03e819da),
+	TOBN(0xf26f686b, 0xe6d828ad), TOBN(0xbbe4eb92, 0x8fb9ed97),
+	TOBN(0x3fa5143a, 0xcf7e535b), TOBN(0x8dacc005, 0x087ab9bd),
+	TOBN(0x7e471935, 0xaf853fc6), TOBN(0x859f9f24, 0xa911dafc),
+	TOBN(0xd73bca2a, 0xb53767ca), TOBN(0x5d01fe2e, 0x5a5041f8),
+	TOBN(0x53a2f1e7, 0xf93b63aa), TOBN(0x0815c00c, 0x1de5ae7c),
+	TOBN(0x00166c1f, 0x4c0128ab), TOBN(0x77f9056d, 0x9f15a369),
+	TOBN(0xd50e4493, 0xad63c1b8), TOBN(0x5ad4776b, 0xf33cdfda),
+	TOBN(0x99d8d386, 0x22860c8e), TOBN(0x7686dbeb, 0xa5781bf6),
+	TOBN(0x53af3b58, 0xcde7e29d), TOBN(0x845b5267, 0x81745eb5),
+	TOBN(0x73c777a4, 0x54b6e858), TOBN(0x1a45315e, 0x5fd98304),
+	TOBN(0xeda5139f, 0xcad3189c), TOBN(0xa6d2a554, 0x19d3d0d2),
+	TOBN(0xd9689845, 0xae0e68ab), TOBN(0x76a6531e, 0x34ea2740),
+	TOBN(0xb9d85fd0, 0xd8ed1df4), TOBN(0xe7596664, 0x444df5e8),
+	TOBN(0xc401027c, 0x8c247885), TOBN(0xa954c1da, 0x28b7308b),
+	TOBN(0x66255dcf, 0xa450fbbe), TOBN(0x06333264, 0xef41343e),
+	TOBN(0x27e2d800, 0xab8c4b16), TOBN(0xe5ed054a, 0x18ea4dd5),
+	TOBN(0xa2b8a00a, 0x9d107f32), TOBN(0x1fefe0d1, 0xf814c43b),
+	TOBN(0x69c2620d, 0x87cd4a8e), TOBN(0x5e1ea76f, 0xf3944222),
+	TOBN(0x8d5a75ff, 0x054e9d91), TOBN(0x99f87af9, 0x9a192adc),
+	TOBN(0xd1aa12d2, 0x3e049ddb), TOBN(0x66425e7b, 0x25ed3199),
+	TOBN(0x188cc339, 0x17b2b090), TOBN(0x6777f446, 0x79377a1c),
+	TOBN(0x2df139e2, 0xcda2ea2a), TOBN(0x95fe5916, 0x8acf889b),
+    },
+    {
+	TOBN(0x175d4b22, 0x4b8d6273), TOBN(0x7a2e7fa7, 0x2aa2a052),
+	TOBN(0xb21d353c, 0xaf459410), TOBN(0xed1a53ee, 0x5761e933),
+	TOBN(0x9671e732, 0x1bbb2c94), TOBN(0x380606a8, 0x80de7c24),
+	TOBN(0xe96eba19, 0x6f190414), TOBN(0xda6e1b54, 0xfec7f417),
+	TOBN(0xff8c3d9d, 0xc71cc76c), TOBN(0x52d38103, 0xb8ce7d20),
+	TOBN(0x8ce1203f, 0xd05b70ec), TOBN(0xf32b1101, 0x00398965),
+	TOBN(0x22e1c1c5, 0xd501287d), TOBN(0xa80f71f1, 0x933ad208),
+	TOBN(0x00dd8f11, 0x3415760d), TOBN(0x70d6b4be, 0xbc871905),
+	TOBN(0xec63c266, 0x69de31b0), TOBN(0x0df4d599, 0x60f66da0),
+	TOBN(0xbe2234da, 0x1255e233), TOBN(0x352a7829, 0x92ea8882),
+	TOBN(0x6dd54817, 0x12d70a79), TOBN(0xbbe8bfcd, 0xa5127dc3),
+	TOBN(0x2d2afd5d, 0x878186aa), TOBN(0x42e37d96, 0xd22d0916),
+	TOBN(0x0b5e3864, 0x85807728), TOBN(0x3c5b6c23, 0x3750c78d),
+	TOBN(0x8feaff75, 0x20496df7), TOBN(0x0e0e4dcf, 0xd997501a),
+	TOBN(0xf3aed44a, 0x4b94e28d), TOBN(0x85410ec0, 0xdec5507a),
+	TOBN(0x1331533a, 0x3f26624b), TOBN(0x479ce92f, 0x5f0e8c6d),
+	TOBN(0xfce9721a, 0x5677093d), TOBN(0xa036607d, 0x5bcefb87),
+	TOBN(0x1ddf80f3, 0xac12140c), TOBN(0xb3786e5a, 0x605acd08),
+	TOBN(0xc932aabb, 0x0677ae22), TOBN(0x52f146de, 0x939c6aa0),
+	TOBN(0x4c676ba5, 0xbd662e21), TOBN(0x50ebeb90, 0xa7a48005),
+	TOBN(0xa8b9c8f9, 0x676f62fc), TOBN(0x5c30de9f, 0x698f8029),
+	TOBN(0x4bc4fb3d, 0x11603952), TOBN(0x4e777d34, 0xf93db814),
+	TOBN(0x574dcc4b, 0x9154e92d), TOBN(0x4b4d6fa4, 0xabf83e3b),
+	TOBN(0x1eebc550, 0x1b2421ac), TOBN(0xb9cf3b7e, 0x35188d7d),
+	TOBN(0x0a4a3ee6, 0xa73e3877), TOBN(0xc33dfe77, 0xf19e0d3f),
+	TOBN(0xa1268bef, 0xdacd7645), TOBN(0xdda19e98, 0xd74afc04),
+	TOBN(0x3971e35e, 0x461a4677), TOBN(0x4b937eba, 0x49f19b0c),
+	TOBN(0xeeff0ea4, 0xad3c1655), TOBN(0x6c5c1972, 0x79d6c1fe),
+	TOBN(0xea89e190, 0x183e26eb), TOBN(0x445bdc3f, 0x66f8129d),
+	TOBN(0x520a1d2a, 0xedd536d9), TOBN(0xca78fe50, 0x10c6c811),
+	TOBN(0x08173869, 0xa4fd94ac), TOBN(0x0a298601, 0x7192d767),
+	TOBN(0x92d29923, 0x79dd1220), TOBN(0x2bfcb22d, 0x159f1136),
+    },
+    {
+	TOBN(0xed433f86, 0x7312f19e), TOBN(0x00719b23, 0xec5bd643),
+	TOBN(0x9f21a895, 0x26c9f195), TOBN(0x7de60dd7, 0xade98692),
+	TOBN(0x373e113f, 0x730e8989), TOBN(0x82aa5f21, 0xb3bcaae8),
+	TOBN(0x1b795f88, 0x0d17d756), TOBN(0xdf7416ba, 0xdfaeaa78),
+	TOBN(0x256b25d8, 0x874c27c2), TOBN(0x789bf73d, 0x050780f6),
+	TOBN(0x06283603, 0x765bb126), TOBN(0x6f281bca, 0x740ef084),
+	TOBN(0x751be296, 0x70f27a46), TOBN(0x1a889323, 0xb4564883),
+	TOBN(0x0309dece, 0xcf7c09dd), TOBN(0x7ee7c8ef, 0xe22ce839),
+	TOBN(0x7a2fc019, 0x7b8e95e8), TOBN(0x90a28818, 0xee436086),
+	TOBN(0x8eff64ef, 0x4dbb4f2d), TOBN(0xad284a21, 0xf0f26738),
+	TOBN(0x246490bb, 0x5d2b8de1), TOBN(0x6c62e2ae, 0xd1ae6b65),
+	TOBN(0x15abeacc, 0x99e284db), TOBN(0x69be3a38, 0xf4c3164a),
+	TOBN(0xe8c94477, 0x960c9292), TOBN(0xd008b678, 0x9e816045),
+	TOBN(0x56b540dc, 0x9611d91a), TOBN(0xc581b897, 0x45bd3cb5),
+	TOBN(0x271800c8, 0x5e584a06), TOBN(0xf0a8bcd4, 0xe63d22c8),
+	TOBN(0x4e8fe862, 0xd04d4ac0), TOBN(0x4340ae69, 0x519d5eca),
+	TOBN(0x53192f36, 0x0a3780e3), TOBN(0x0e9505f9, 0x2ad6c2a9),
+	TOBN(0x06e6bc52, 0xf73b1189), TOBN(0x46185328, 0x9673933c),
+	TOBN(0x90769e65, 0x22adcf04), TOBN(0x70510d7c, 0xeabbc1cb),
+	TOBN(0xd637d356, 0xd742e435), TOBN(0xb8dc8432, 0xa5061f2d),
+	TOBN(0xeaf642dc, 0x91f7baf7), TOBN(0x915e034f, 0x21ae1326),
+	TOBN(0xb2fa986a, 0x1e730d78), TOBN(0xb0d6c03d, 0x7ac45bcd),
+	TOBN(0xe563067c, 0x59ccc1ab), TOBN(0xa90cded2, 0x6995bab7),
+	TOBN(0x01b35b3a, 0xa8a0254c), TOBN(0xa29b16d5, 0xd83486d9),
+	TOBN(0x86019967, 0x2af897a2), TOBN(0x2d349e63, 0xd1e21451),
+	TOBN(0xebe83cff, 0x8599e45f), TOBN(0xc87cd6df, 0xb7bc200f),
+	TOBN(0xd390f273, 0x9492c7ec), TOBN(0x945ab71b, 0x2b583511),
+	TOBN(0xd76c9a37, 0x7e1bf513), TOBN(0x2761dda3, 0x6657e836),
+	TOBN(0x680187cd, 0x15cd0125), TOBN(0x76724022, 0xe6975159),
+	TOBN(0x265b431a, 0x4c9c0ce8), TOBN(0xaa7364ae, 0x8fc64088),
+	TOBN(0x3eef3cec, 0xecba8613), TOBN(0x895283ac, 0xe25165fc),
+	TOBN(0x8c734f53, 0x9cfbba32), TOBN(0x2b3796f5, 0xaf3cf96e),
+    },
+    {
+	TOBN(0xda867f0c, 0xe625e33c), TOBN(0x00e33647, 0xd8b7ac87),
+	TOBN(0x3e43512a, 0x4d93e32a), TOBN(0xfbcc1baf, 0x5bd30d25),
+	TOBN(0x6e7c227e, 0xe61d1312), TOBN(0x0554be43, 0x677955d0),
+	TOBN(0x36f2bf10, 0x1a2faead), TOBN(0xbee82d75, 0xbf5d54f0),
+	TOBN(0x4ad64bb1, 0x0e984f85), TOBN(0xf137ee7a, 0x0a0f01ec),
+	TOBN(0x0c506c06, 0xecb7624c), TOBN(0xde503794, 0xe81de108),
+	TOBN(0xea37c52c, 0xe1e4f48c), TOBN(0x35112647, 0x68ac9106),
+	TOBN(0x0613bd9d, 0x9ef813ba), TOBN(0xfdcf91df, 0xc459d072),
+	TOBN(0xf45f8032, 0xf71d2bd0), TOBN(0x21451031, 0xdc86c10c),
+	TOBN(0x1dfec9de, 0x9b769e5b), TOBN(0x5a509443, 0xe1e4ce71),
+	TOBN(0x48c92176, 0xba571bc3), TOBN(0xd8c5c55d, 0xa35cd6ca),
+	TOBN(0x2b57d599, 0x33c509b6), TOBN(0xd37c7471, 0xe9862c94),
+	TOBN(0xd19288ef, 0x2c192524), TOBN(0xa0116cf1, 0x3d02c08b),
+	TOBN(0xad6a81b9, 0x2c23b235), TOBN(0x8b03712e, 0x8b7a796a),
+	TOBN(0x4e300190, 0xbcb0940d), TOBN(0xe15179a9, 0xcc7a4590),
+	TOBN(0x9d1fd0c5, 0xa09a9581), TOBN(0x86815cd2, 0xa33abd94),
+	TOBN(0xa6325e6c, 0x146f01c6), TOBN(0x1d2a0bf2, 0x55ad8552),
+	TOBN(0x0dcd78a5, 0xee762312), TOBN(0x8c30a651, 0x2ce72678),
+	TOBN(0x20ed3cca, 0x455b9e08), TOBN(0xe0a21af9, 0xd5778397),
+	TOBN(0xac6fa6ad, 0xae85c86a), TOBN(0x71b90865, 0x4a0c3e5b),
+	TOBN(0xd5ec85b9, 0x23ef75ef), TOBN(0x22bc069e, 0x435c264d),
+	TOBN(0x65f530d4, 0x3ce61af1), TOBN(0x61ad807a, 0xf588b79b),
+	TOBN(0xcac60cf8, 0xb3998357), TOBN(0x5219bda4, 0xd32b756f),
+	TOBN(0x0366b675, 0x51404a99), TOBN(0x45362dab, 0xb0690db2),
+	TOBN(0x0c0332ce, 0x55f12f45), TOBN(0x5a693cc7, 0xa3c428a3),
+	TOBN(0xd7d079ff, 0x0b33c8be), TOBN(0x90f9adbf, 0x6f78401f),
+	TOBN(0xa721e4e7, 0x29258fd9), TOBN(0x28b56e36, 0x56b06a23),
+	TOBN(0xaed9346e, 0xfc37ea27), TOBN(0x4ec3bb46, 0xccafd06d),
+	TOBN(0xd0030f9a, 0x2b9a024a), TOBN(0xece48045, 0xcd2ea2b2),
+	TOBN(0x4cb68634, 0x993819d0), TOBN(0x54e6c95d, 0x1f8c8110),
+	TOBN(0x7dde79d9, 0xd9750c27), TOBN(0x12a50759, 0xc4a2cbf8),
+	TOBN(0x18e69ea7, 0x39f77465), TOBN(0x566f2deb, 0x5e79f2dd),
+    },
+    {
+	TOBN(0xf3c4bd8a, 0x76ec99a7), TOBN(0xd9d71f03, 0xd2131a01),
+	TOBN(0x04d8b205, 0x16a61eea), TOBN(0x113b8fb4, 0x1e0bd34e),
+	TOBN(0x9e6bbfcb, 0xf1a11907), TOBN(0xe466c077, 0x5a0eccff),
+	TOBN(0x79a26dfc, 0x8adbead7), TOBN(0x1ef49bff, 0x6c99f115),
+	TOBN(0x666ccd55, 0xd8e6fe3e), TOBN(0x8b9b21e9, 0x2e6ef70f),
+	TOBN(0xac6a7356, 0x1dd836d4), TOBN(0xda321385, 0xb5c5a79b),
+	TOBN(0x1d14aaa3, 0x9341165a), TOBN(0x1d3ac7fa, 0x72310009),
+	TOBN(0x313a26d4, 0x9f94d7d5), TOBN(0xedd6b59b, 0x31ad85db),
+	TOBN(0x0618f889, 0x921a09cd), TOBN(0xeec3545d, 0x378bbe8d),
+	TOBN(0x47a30335, 0xf1910022), TOBN(0x39e21b43, 0x561dca3f),
+	TOBN(0x86262161, 0x874fccab), TOBN(0x610be20b, 0x22230bc9),
+	TOBN(0xa5b45cad, 0x0f66b505), TOBN(0x9dbb86d4, 0xccda3863),
+	TOBN(0xd691e92f, 0xeae77695), TOBN(0x485d6b21, 0x58589ddc),
+	TOBN(0x2ecf3c12, 0xc956b274), TOBN(0x22aced6e, 0xeee5a1ab),
+	TOBN(0x89c39755, 0x61e9351c), TOBN(0x5c0324ac, 0x13c6943e),
+	TOBN(0x7d847892, 0xa9b0c7fc), TOBN(0xf4b13481, 0xf3ec0d7e),
+	TOBN(0xa071a93a, 0xec902f63), TOBN(0x34c84f45, 0x6f094efc),
+	TOBN(0xec88a119, 0x84b779d7), TOBN(0xa9da7e1a, 0x1fd5ed0d),
+	TOBN(0xc27d581c, 0x0dad538a), TOBN(0xf5f113ee, 0x7c4e63c5),
+	TOBN(0x84989a09, 0x4fe18aa6), TOBN(0xd6b90009, 0x91e8f470),
+	TOBN(0x5d9d6dc4, 0x6d3f0a57), TOBN(0xe2cbc2ec, 0xd6e13d76),
+	TOBN(0x514b2043, 0xda9c620c), TOBN(0x14e6de55, 0xd6fd7e9c),
+	TOBN(0x2b215e39, 0x91f21e2c), TOBN(0xe912ba3e, 0x954f5852),
+	TOBN(0xfc29ea30, 0x0d9c18e3), TOBN(0x86ff4d11, 0x24075f4b),
+	TOBN(0x5b3a411a, 0x3654c62d), TOBN(0xa3f0b93e, 0xef53461a),
+	TOBN(0xfd0cfe43, 0x4d6ac6fc), TOBN(0xf8c9f00f, 0xbf75ad75),
+	TOBN(0xe34de394, 0x77ee1478), TOBN(0xd77014e6, 0x6bd6abb7),
+	TOBN(0x6bbbaa0b, 0x98fa3a82), TOBN(0xec17afb6, 0x90fe31a6),
+	TOBN(0x7994f06a, 0xd3ed76bb), TOBN(0x83d73710, 0x6bbf1523),
+	TOBN(0x27f5bc68, 0xa9a8f05f), TOBN(0xd9adcbbb, 0x21ffc824),
+	TOBN(0xa7fb027a, 0x7132e0a2), TOBN(0x3d125e1e, 0xcf93d0fb),
+	TOBN(0x86b54fc7, 0xa31b5bd7), TOBN(0x9c24b8da, 0xd0dad199),
+    },
+    {
+	TOBN(0xe7897b14, 0xedd9334f), TOBN(0x65ba083e, 0x70200269),
+	TOBN(0x82b1ac2d, 0x9ca57d46), TOBN(0x8ec234cf, 0xae87c8da),
+	TOBN(0x6cd0ee70, 0x0d91d764), TOBN(0x10b1a378, 0x92ad51e2),
+	TOBN(0xd3e3b288, 0x46d4fe00), TOBN(0x1aad9678, 0x87d7fa3d),
+	TOBN(0x3327045c, 0x113d38da), TOBN(0xeeb9ea8b, 0x0e722dc1),
+	TOBN(0x2a45ea98, 0x1bf1a302), TOBN(0xd8a86430, 0x66acc03e),
+	TOBN(0x14a56b7c, 0xfbaddfcc), TOBN(0x1fe127c0, 0x2e4cf438),
+	TOBN(0xc8b12690, 0xd434cd6e), TOBN(0x533bd125, 0xa5a0b08f),
+	TOBN(0xf1bfb500, 0x7cac2cc4), TOBN(0x9203d799, 0xc5f67518),
+	TOBN(0x4b6aaa6f, 0x0224efb7), TOBN(0x6ae1e6e6, 0x3755e94d),
+	TOBN(0x9542ba02, 0x53c65274), TOBN(0x0636acbe, 0xc9e4ba26),
+	TOBN(0xf9498e42, 0x075249fe), TOBN(0x63010b36, 0x5aec0662),
+	TOBN(0xbbf3d858, 0xfc44e4c6), TOBN(0xc1d7041c, 0x95de4d4d),
+	TOBN(0x3f11e345, 0x4888034a), TOBN(0x99642c51, 0x02c20f7f),
+	TOBN(0x5ff01f25, 0x1cf08570), TOBN(0x2d1bd800, 0xca871bff),
+	TOBN(0x0e0d6c20, 0xfa85a0ee), TOBN(0x410d4758, 0x08bb6098),
+	TOBN(0x93b03b68, 0xd4cfe494), TOBN(0x541e1030, 0x5367d9cb),
+	TOBN(0xc33f1c1a, 0x7074ee9e), TOBN(0x1a1fb2b7, 0x55166f36),
+	TOBN(0xa6cee441, 0x86028ffd), TOBN(0x361cc9ec, 0x895074c1),
+	TOBN(0x6e09b06f, 0xb3bb72be), TOBN(0xc9d388e7, 0x0bc362dd),
+	TOBN(0x88aa7d42, 0xac474673), TOBN(0xd42319d0, 0xe3aa5970),
+	TOBN(0x3b8a0b39, 0x6a7c2c14), TOBN(0x8af893a4, 0x3d6466cb),
+	TOBN(0x39dfc91d, 0x035ee99c), TOBN(0x4ec01759, 0x4dfb030e),
+	TOBN(0x8f3d94b7, 0x1e136268), TOBN(0x752451ec, 0x2bb8eafd),
+	TOBN(0xf474057b, 0xcb45cd55), TOBN(0xfeb90c2b, 0xf1c230f6),
+	TOBN(0x4b7ad875, 0x1e8a6e12), TOBN(0x035b7424, 0x2461bb46),
+	TOBN(0xba9c6a71, 0xfbd57104), TOBN(0xba93e6e3, 0x31756a04),
+	TOBN(0xf2f19ea0, 0xcf95f63e), TOBN(0x884e29ff, 0xb4aaa106),
+	TOBN(0xc2fed667, 0xb57bd940), TOBN(0x1819546d, 0x0a43e72b),
+	TOBN(0xfea17057, 0xc51ddbe1), TOBN(0xb14fd8d0, 0x08ebf525),
+	TOBN(0x26f3b6ec, 0x57fdf4d1), TOBN(0xb55e59b2, 0x1e4b8526),
+	TOBN(0x445ac4ed, 0x24cdf579), TOBN(0x384971b5, 0xa1b5a333),
+    },
+    {
+	TOBN(0x2c78c39f, 0x79943657), TOBN(0x9af2cf34, 0x7214e0ef),
+	TOBN(0x95b3afd6, 0xbe5f6781), TOBN(0xea240dd1, 0x9a8ce1f3),
+	TOBN(0xb44e0e15, 0xd2704ad0), TOBN(0x6ab17c44, 0x7681bc67),
+	TOBN(0x38951b77, 0xbed4e193), TOBN(0xb46df9dd, 0x08a10991),
+	TOBN(0xaf949f41, 0xb40b24b2), TOBN(0xc4c8d4e7, 0x35c40010),
+	TOBN(0xaf7eef82, 0xe9943977), TOBN(0xb0782067, 0x2a089def),
+	TOBN(0xb37cc6d5, 0x1ba35feb), TOBN(0x89227635, 0xc77a70bd),
+	TOBN(0x927b58f7, 0x90f586c2), TOBN(0x3fc2269d, 0xc01576cd),
+	TOBN(0x2f63ea39, 0x61d26705), TOBN(0xca26e34f, 0x0ad3652f),
+	TOBN(0x4a1f27e1, 0x028ff9fe), TOBN(0x614ce77b, 0x49723085),
+	TOBN(0x63a759e4, 0x85597497), TOBN(0xad03a114, 0x549bfb8d),
+	TOBN(0x589a8162, 0xb683b162), TOBN(0x27cb3490, 0x8ccf9daa),
+	TOBN(0x86a97de7, 0x966b3102), TOBN(0x90c9ffe0, 0x69a9d589),
+	TOBN(0x896c64f0, 0x0d40ffb5), TOBN(0x6832dd74, 0x833446fa),
+	TOBN(0x93eb5498, 0x793c41d1), TOBN(0xbfb1e47e, 0xc690c592),
+	TOBN(0x7f0b6188, 0x05e13f9d), TOBN(0x12f2c8b3, 0x6235be17),
+	TOBN(0xacd30bcc, 0x4eaafb89), TOBN(0xc204a37c, 0x2601b3f0),
+	TOBN(0x944d7dbd, 0x6779eb1d), TOBN(0x1cf71b68, 0xca604bcd),
+	TOBN(0x563d1769, 0x67582bc7), TOBN(0x33731f5b, 0x72a7459e),
+	TOBN(0x369f127e, 0xe53cc09b), TOBN(0x61d56b61, 0xeddb9660),
+	TOBN(0x9ed4e55c, 0x96d3a0b4), TOBN(0x8480a63e, 0xcb9834f8),
+	TOBN(0x2a0a5068, 0x52cc83a1), TOBN(0x2958c34d, 0x2a5480e6),
+	TOBN(0xb9e485ce, 0x267b0c47), TOBN(0x61c31923, 0xa12a398e),
+	TOBN(0x286bb945, 0x84dc5907), TOBN(0x9d7847f9, 0x8f578cca),
+	TOBN(0x79e324ad, 0x079d9d3e), TOBN(0xa665a922, 0x06980b5a),
+	TOBN(0xadb962d2, 0x6781e686), TOBN(0x4ec3d1f0, 0xfb257524),
+	TOBN(0xa6441223, 0x05a169d0), TOBN(0x4f7c0fb6, 0x2b6d6c72),
+	TOBN(0x8b3b4084, 0xcd730ca1), TOBN(0xd9c0d72d, 0x845027fa),
+	TOBN(0xc7bf9afc, 0xdbf1d8be), TOBN(0xb40d0391, 0xbfc6c36e),
+	TOBN(0xc9cff217, 0x7feb54bc), TOBN(0x2895377a, 0x8e1f4dd2),
+	TOBN(0x51ded8b7, 0xbbaf6a42), TOBN(0x04a02b5d, 0x5e044a92),
+	TOBN(0x2a092213, 0x918f48ed), TOBN(0xf2de5e8e, 0xa497a36c),
+    },
+    {
+	TOBN(0x58f1873e, 0xf3286caf), TOBN(0xe7f1689f, 0xb0239044),
+	TOBN(0xa467a7d0, 0xec180e73), TOBN(0x4093310a, 0xa789e625),
+	TOBN(0x98958b03, 0xcf303af8), TOBN(0x1d471b12, 0xcb9330b2),
+	TOBN(0x51c90d7e, 0xaec6eb77), TOBN(0x45a05233, 0xbfe62b35),
+	TOBN(0xc576a833, 0xc78585c3), TOBN(0x61155087, 0x1d1c3fc3),
+	TOBN(0x306ee2f1, 0xb369a849), TOBN(0x85347df3, 0x4f32ace6),
+	TOBN(0x4175a3e0, 0x0c7272ee), TOBN(0xf7b08436, 0xd8dfd5a1),
+	TOBN(0x8b338ad6, 0xb6f62b48), TOBN(0xf712b32a, 0xc2709274),
+	TOBN(0x44559860, 0x1c1ce732), TOBN(0x48caf57d, 0x6c85c25d),
+	TOBN(0x5062f3c5, 0x2422e36f), TOBN(0xb9b77f56, 0x1dfeb5d9),
+	TOBN(0x50452b08, 0x4fd9a24c), TOBN(0x9e262ad1, 0x2ed699ae),
+	TOBN(0x5f15d7ad, 0x558c42b8), TOBN(0x772066ad, 0xdad6d0f0),
+	TOBN(0x1c2301c8, 0x534c599f), TOBN(0x52b02d9a, 0xb880bca7),
+	TOBN(0xf44c34ff, 0xd05c9dcd), TOBN(0x24700c5c, 0x2b5f5a1d),
+	TOBN(0x743f99ab, 0x4b969edb), TOBN(0xf47957a6, 0x301b7ea7),
+	TOBN(0x111b3e0b, 0xb2e69030), TOBN(0x7d906fba, 0xe54ec1ca),
+	TOBN(0xac73008b, 0x99057cde), TOBN(0x6e96b89d, 0xc158a3b3),
+	TOBN(0x12c8d562, 0x35f9d12b), TOBN(0x0058ed54, 0xaa2b2cb6),
+	TOBN(0xce4e62dc, 0x39584076), TOBN(0xb120e0c6, 0x76023872),
+	TOBN(0xd216a15a, 0xde71dea6), TOBN(0xe00c5f97, 0xc3a8a6bc),
+	TOBN(0x0b196c72, 0xff70732c), TOBN(0x178ce074, 0xcd184875),
+	TOBN(0xed086b82, 0x5adc6f3e), TOBN(0xb3dc5d92, 0xe4126b5e),
+	TOBN(0x57661846, 0x2c70c5d2), TOBN(0x4020d523, 0x65b0c587),
+	TOBN(0xe7c132e2, 0x0c93e2af), TOBN(0xa21647bd, 0x025945f9),
+	TOBN(0x31c5cca1, 0x6dd77b77), TOBN(0x03a2ebf2, 0x204bbb77),
+	TOBN(0xacd3a193, 0x52b8ad27), TOBN(0xaf4f37e6, 0x9bc14aa3),
+	TOBN(0x4088c78f, 0x173c1bb2), TOBN(0xaaabdc82, 0xb0a2eb7a),
+	TOBN(0x31f0cb93, 0x38879a7b), TOBN(0x63a078ed, 0x9b4e8daf),
+	TOBN(0x5f542b8b, 0xc5849d46), TOBN(0x7884ed6f, 0xb25343c2),
+	TOBN(0x4255dbb5, 0x71a2a49b), TOBN(0x4f1eb04e, 0xe12b0083),
+	TOBN(0x7abb6366, 0xecf70810), TOBN(0x4479f42f, 0x3b2c7853),
+	TOBN(0x8b026985, 0x01b5cfa5), TOBN(0xe5bcbd1d, 0x492f46d8),
+    },
+    {
+	TOBN(0xa60c4914, 0x9b253e29), TOBN(0x6a20c1c9, 0x91fa55d8),
+	TOBN(0xd3ad256c, 0x76578c4d), TOBN(0x08b361b1, 0xb9c7b59f),
+	TOBN(0x2315447f, 0xd2bc32e6), TOBN(0xb0c1077d, 0x8603edb4),
+	TOBN(0x09e3b1ef, 0xe38619c6), TOBN(0x4bcb15fe, 0xfd10aaa2),
+	TOBN(0xf8f146f1, 0x63b6602f), TOBN(0x227d694c, 0xe0a98bfa),
+	TOBN(0x49dc593e, 0x9ceecb98), TOBN(0xb11e9742, 0x21841c14),
+	TOBN(0x5c8b87b3, 0x4d27a651), TOBN(0x24540516, 0x98835160),
+	TOBN(0xbf1941cb, 0x52274e81), TOBN(0x6767ca8a, 0x38a348df),
+	TOBN(0x11973960, 0xc9be3032), TOBN(0x141e2e76, 0x106e42e6),
+	TOBN(0x3a88af78, 0x6fe82f89), TOBN(0x795f6016, 0x69d3c6b8),
+	TOBN(0x6f902e81, 0xc2a7adb6), TOBN(0xdf247009, 0x4f50ca8a),
+	TOBN(0x5e417e9e, 0x841504d6), TOBN(0xcdaa8fdd, 0xe59f7b50),
+	TOBN(0x03dd6bf3, 0x2493d79d), TOBN(0x05874753, 0x7a7e76b8),
+	TOBN(0xfe5f9cd1, 0xd58d77ae), TOBN(0x4e5d0d16, 0x128ee5b2),
+	TOBN(0x5ef80306, 0xce44e52d), TOBN(0xfb15a218, 0x0a8cfb57),
+	TOBN(0x8470885d, 0x80425103), TOBN(0x85640461, 0x77074190),
+	TOBN(0xbe09a243, 0x3dd0bd91), TOBN(0x636ddd9d, 0xe860d100),
+	TOBN(0x581fd1a0, 0xa5519394), TOBN(0x9ffffffe, 0xedc31157),
+	TOBN(0x3377beef, 0x3c2614c6), TOBN(0xe040d43b, 0x58962907),
+	TOBN(0xad325193, 0x8388474a), TOBN(0x06cdd70f, 0x8f10a29b),
+	TOBN(0x62c60fc8, 0x612429ff), TOBN(0x933d1846, 0x9b291d01),
+	TOBN(0xd583c699, 0x3d501d02), TOBN(0x4d229513, 0x094eda13),
+	TOBN(0xc0fa37d1, 0xb9b81d2a), TOBN(0xd0ecaaee, 0x34e94ea0),
+	TOBN(0x3c7e2cc2, 0x517f7dbd), TOBN(0xafdfe0e9, 0xce5eb099),
+	TOBN(0xb23d44e1, 0x7782ecb4), TOBN(0x88803cfd, 0x6bdc6383),
+	TOBN(0xa55f83d1, 0x18d7c6f9), TOBN(0x81f9f8c9, 0x385a162a),
+	TOBN(0x3d71d183, 0xc02b43ef), TOBN(0x4301a62e, 0xddf48129),
+	TOBN(0x52c0929d, 0x01439f25), TOBN(0xc2ea0847, 0x2f9275b2),
+	TOBN(0x6fc4b999, 0x8f2a1ad6), TOBN(0xe9117f89, 0x918623fd),
+	TOBN(0x285e7b71, 0x4c521683), TOBN(0x6c9a246d, 0x55b01d96),
+	TOBN(0x1db5ce49, 0x2a7aa469), TOBN(0x73c3ad5e, 0x91afa5cb),
+	TOBN(0x596ceec7, 0xa17ad715), TOBN(0x34bf2347, 0x1e6e46a7),
+    },
+    {
+	TOBN(0x4c189229, 0x364a7c52), TOBN(0xd4418393, 0x23f4abb1),
+	TOBN(0xa75a4ad8, 0xecaf189a), TOBN(0x1166c363, 0x738f6b3f),
+	TOBN(0x462a88ff, 0xa57865cc), TOBN(0x61820efb, 0x0c07db68),
+	TOBN(0x13c763df, 0xc70c338d), TOBN(0x97962bfd, 0xfa215544),
+	TOBN(0xf1e28de2, 0xc76cc05e), TOBN(0x44fad299, 0xc15317f5),
+	TOBN(0x93b8b27d, 0x39dd9730), TOBN(0x623d2e84, 0x43083828),
+	TOBN(0xb9170f66, 0x9a4f4ca3), TOBN(0x48a80a2d, 0x3106a2c0),
+	TOBN(0x7e328396, 0xa44e9d02), TOBN(0xcecf9514, 0x714691bf),
+	TOBN(0x232e72c1, 0x937c6064), TOBN(0x283c5cec, 0x20dc85cc),
+	TOBN(0x75115ef0, 0xdfd05f12), TOBN(0xf2bec02c, 0xd3a78d70),
+	TOBN(0xdf205d03, 0x854f5b6c), TOBN(0xbe48e012, 0x9ea19514),
+	TOBN(0xbc82fd3d, 0x082a09ad), TOBN(0x9b551fbb, 0xcb3ef6a0),
+	TOBN(0x07bad7e6, 0x4927af3b), TOBN(0x0b0e8ea6, 0xf4fced70),
+	TOBN(0xfcbf39a3, 0xab1aef5c), TOBN(0x9cba1a2c, 0x251dcb65),
+	TOBN(0xbdf0060d, 0x9c89ca5a), TOBN(0xf62b4430, 0x1519f6ae),
+	TOBN(0x08e110bb, 0x0084a207), TOBN(0x0ac808c2, 0xee0e8321),
+	TOBN(0x7c134486, 0x7ba17b23), TOBN(0xc6dbbb3b, 0xd0c1a201),
+	TOBN(0xb03fa341, 0x4aa32728), TOBN(0x3ffffffd, 0xdb8622ae),
+	TOBN(0x66ef7dde, 0x784c298d), TOBN(0xc081a876, 0xb12c520e),
+	TOBN(0x5a64a327, 0x07108e95), TOBN(0x0d9bae1f, 0x1e214537),
+	TOBN(0xc58c1f90, 0xc24853fe), TOBN(0x267a308d, 0x36523a02),
+	TOBN(0xab078d32, 0x7aa03a05), TOBN(0x9a452a26, 0x129db427),
+	TOBN(0x81f46fa3, 0x73703a54), TOBN(0xa1d955dc, 0x69d29d41),
+	TOBN(0x78fc5984, 0xa2fefb7b), TOBN(0x5fbfc1d3, 0x9cbd6132),
+	TOBN(0x647a89c2, 0xef05d969), TOBN(0x110079fa, 0xd7b8c707),
+	TOBN(0x4abf07a2, 0x31af8df3), TOBN(0x03f3f192, 0x70b42c55),
+	TOBN(0x7ae3a307, 0x805687df), TOBN(0x86034c5d, 0xbbe90252),
+	TOBN(0xa581253a, 0x02873e4a), TOBN(0x85d4108e, 0x5f24eb64),
+	TOBN(0xdf897333, 0x1e5435ad), TOBN(0xd222ff13, 0x230c47fa),
+	TOBN(0x50bcf6e2, 0x98a42d07), TOBN(0xd93448da, 0xab603b2c),
+	TOBN(0x3b6b9c92, 0x54f548d2), TOBN(0xe7875abd, 0x235f4b96),
+	TOBN(0xb2d9dd8f, 0x42f5ae2a), TOBN(0x697e468e, 0x3cdc8d4e),
+    },
+    {
+	TOBN(0x17ef8ddc, 0x0c16a39e), TOBN(0xb6d1f55b, 0x677139b3),
+	TOBN(0xb48ac9d0, 0x9182142f), TOBN(0x8b3668ec, 0xafacf9c8),
+	TOBN(0xea04ed8d, 0xf767ea4f), TOBN(0xe0de58f6, 0xbab6e227),
+	TOBN(0x42ad4b8a, 0xe9722c23), TOBN(0xacce3769, 0x42d68465),
+	TOBN(0x0ae6b9bb, 0xe6e407e0), TOBN(0xe9e17d54, 0x31ccad34),
+	TOBN(0x346f4d5e, 0x1bfac3d7), TOBN(0x84ca8887, 0xf7b8b24a),
+	TOBN(0xf20eb846, 0x72ad1618), TOBN(0x5f709094, 0xf90696b6),
+	TOBN(0x7dd65ec9, 0x93bdece0), TOBN(0x9a486614, 0x38733bdd),
+	TOBN(0x080ada98, 0x60b08b60), TOBN(0xa8a2469a, 0x4fb3540d),
+	TOBN(0xb45ef8a3, 0x849ae7ad), TOBN(0x90a89ef7, 0xe5d1f801),
+	TOBN(0xd6adc5de, 0x7628e62d), TOBN(0x2bb584eb, 0x632fc845),
+	TOBN(0x0eb016d7, 0x6e2b17f7), TOBN(0x3cf8154e, 0x4e5e23e5),
+	TOBN(0x5c7a3ebb, 0xaa7ca88e), TOBN(0xf2087d62, 0xf8e04835),
+	TOBN(0xd8400020, 0xc6663efc), TOBN(0x347e82fd, 0xb02f2a0f),
+	TOBN(0x5de02394, 0x36ae8676), TOBN(0xe1ed2db9, 0x266e4f8e),
+	TOBN(0xfbec5563, 0x6154709b), TOBN(0xe4544573, 0x33dce74f),
+	TOBN(0x61bf3b58, 0x83109507), TOBN(0xd537ca47, 0x5ef1e840),
+	TOBN(0xe53a461e, 0xddc60468), TOBN(0x09ca3c5c, 0x804ef529),
+	TOBN(0x101e77c7, 0xc33b72cf), TOBN(0xb50d8622, 0x6426891b),
+	TOBN(0x4ab4ae28, 0x25d31061), TOBN(0x6ae12bad, 0x78162144),
+	TOBN(0x4320c37a, 0xad918d2b), TOBN(0x518ac8ff, 0x9a67d6d2),
+	TOBN(0x16256537, 0x18c4c4b7), TOBN(0xa757d523, 0x45cfa695),
+	TOBN(0x409130b7, 0x8f5f4e86), TOBN(0x2e658874, 0x9b5e23ab),
+	TOBN(0x76b0c355, 0xb8365acc), TOBN(0x69c1af59, 0x2a1e379f),
+	TOBN(0x89693a75, 0x19c3cff0), TOBN(0x0d227c00, 0xd0587c0e),
+	TOBN(0x8461c643, 0xf8740e4e), TOBN(0x999c1148, 0xff225daf),
+	TOBN(0x430f8b94, 0x15bcf494), TOBN(0x2e6c774c, 0x4991fb63),
+	TOBN(0x8b820bb6, 0xe5ea1a5b), TOBN(0x269f6129, 0xea8d1069),
+	TOBN(0x97dd3af3, 0x0e76de8b), TOBN(0xe5e27d29, 0x44e947e5),
+	TOBN(0x1c9d3f58, 0xd2e1fcf1), TOBN(0x9001efa2, 0xd01176c1),
+	TOBN(0xacd727d4, 0x48706f69), TOBN(0x2d147f2f, 0x12239968),
+	TOBN(0x714bf08c, 0xe94c5a57), TOBN(0x9ca68bb1, 0xcc6ab4e9),
+    },
+    {
+	TOBN(0x2fdf1bb8, 0x182d473d), TOBN(0x1fafb4ed, 0x9adc41cc),
+	TOBN(0xe215dbc4, 0x925d67d0), TOBN(0x82b7e740, 0xd1ca15cf),
+	TOBN(0x040349f4, 0x191f79f5), TOBN(0x09a0d477, 0x53fd7c33),
+	TOBN(0x65f96da5, 0x04018098), TOBN(0x3660cd4c, 0x345120dd),
+	TOBN(0x7c1add28, 0x2d374c1f), TOBN(0xab46a161, 0x152d9a0a),
+	TOBN(0x3a4f9ea8, 0x1836bd09), TOBN(0x2dd94e34, 0xea92d59b),
+	TOBN(0xbe9986c2, 0xba85df48), TOBN(0xa44cb8f5, 0x3bf82193),
+	TOBN(0x61e9967a, 0xbc86f784), TOBN(0xac1f3217, 0xb32c1c94),
+	TOBN(0xf5a3791e, 0x19d92fe9), TOBN(0x05c1bc13, 0xf645a018),
+	TOBN(0x24e2954a, 0x2838becd), TOBN(0x186eee4f, 0x56be44d2),
+	TOBN(0x365202fc, 0x31788579), TOBN(0x9b89f27f, 0x4bfe331f),
+	TOBN(0xcb410296, 0xc4db0fe1), TOBN(0xa17a2829, 0x5df3dd65),
+	TOBN(0xc7c48370, 0x7b6f48b7), TOBN(0x152d289f, 0xd6eda1fe),
+	TOBN(0x91f36b61, 0x42a71c5c), TOBN(0xbd07576e, 0x85552048),
+	TOBN(0x082937a2, 0xc67b2824), TOBN(0x38efea1a, 0xefd6929f),
+	TOBN(0x0add25c2, 0x69ccf22d), TOBN(0x2053693a, 0x889d143b),
+	TOBN(0x164b5fa4, 0x01d0afdc), TOBN(0x94fd0634, 0x33390c53),
+	TOBN(0xb4a26625, 0x229203c1), TOBN(0xd9ff2f3c, 0x16087f6e),
+	TOBN(0x42112398, 0xf11ece85), TOBN(0xb455ae54, 0x5900bf6c),
+	TOBN(0xfa41d8ad, 0x5f9e7e33), TOBN(0xf223e02e, 0xd81dbc84),
+	TOBN(0x53b128af, 0x2cec4c1a), TOBN(0xb1a125f6, 0x6ab78c28),
+	TOBN(0xc53e951f, 0xe6ccf169), TOBN(0xafda813f, 0x1b08b6bc),
+	TOBN(0x64bf6e18, 0xfe394a51), TOBN(0xd965b3c5, 0x5a1899c0),
+	TOBN(0x844b4702, 0x7347e638), TOBN(0x3aa9167c, 0x37e69ba4),
+	TOBN(0x50d1f831, 0x9223e0db), TOBN(0xd11c91af, 0xb3cc9cdf),
+	TOBN(0x5a246876, 0x749cfcb5), TOBN(0x44ffb696, 0xa3bb1bb9),
+	TOBN(0x7a1fba71, 0x3773313b), TOBN(0x688cabae, 0xecec095b),
+	TOBN(0x327e61f7, 0x6975b5ef), TOBN(0xfd5d8ce6, 0x67c85e8d),
+	TOBN(0xff8f6b78, 0x2a8ea8de), TOBN(0xdc2fe09e, 0xbc984caf),
+	TOBN(0xe7f07638, 0x178ff505), TOBN(0x1df8209f, 0x650f525f),
+	TOBN(0x30ac01a0, 0x0679125f), TOBN(0x95629bd2, 0xa36b1600),
+	TOBN(0x19880677, 0xb12ff279), TOBN(0x394d1763, 0x98d569d3),
+    },
+    {
+	TOBN(0x00000000, 0x00000001), TOBN(0xb20bca36, 0xcbf9ce66),
+	TOBN(0x79004823, 0x6f593f70), TOBN(0x6c4b1567, 0x7270223e),
+	TOBN(0x2ff96ed8, 0x2a4fa556), TOBN(0x47e42289, 0xde8fb7e3),
+	TOBN(0xe09ed68f, 0x311d2850), TOBN(0xdcc45e79, 0xaea41812),
+	TOBN(0x664d69b0, 0x5f6f3c5d), TOBN(0xd783a6b8, 0xb1943fa2),
+	TOBN(0xd17103eb, 0xe0413559), TOBN(0x24443d24, 0xfb217106),
+	TOBN(0xda7c1635, 0xd52bb317), TOBN(0xe56b97cb, 0x49eaf425),
+	TOBN(0x663cd8e7, 0x950b1dc3), TOBN(0x778e65ef, 0x4245a4d9),
+	TOBN(0xe58dc3ed, 0x58781928), TOBN(0xb47d2edf, 0x56def7fe),
+	TOBN(0xbc24a403, 0x1f02ef71), TOBN(0xf71db05f, 0x8b1a54ce),
+	TOBN(0x88f6773f, 0x4526b91d), TOBN(0x441ee8a8, 0x859ea293),
+	TOBN(0xade0d4e7, 0xe884dff3), TOBN(0x2789fd8c, 0xc137959b),
+	TOBN(0x0ed005f9, 0x2675f79b), TOBN(0x311c2dd9, 0xe52d1194),
+	TOBN(0xe1736b1f, 0xb5da9e62), TOBN(0x540a5173, 0x24f6cc28),
+	TOBN(0x4c68f07a, 0x591e1b38), TOBN(0x75158ea8, 0xa2f9f382),
+	TOBN(0x13047afb, 0xa72410f5), TOBN(0x57aade54, 0x20e3459b),
+	TOBN(0x52cce8f2, 0xfbaf85cc), TOBN(0xea8d71a5, 0x75553bd2),
+	TOBN(0xea2dd9e7, 0x6705faef), TOBN(0xc66ab683, 0x156a951a),
+	TOBN(0x21d43409, 0x6aa7e8e7), TOBN(0x4a3aa20f, 0x90b3ad36),
+	TOBN(0x64d87c5d, 0x13f85d70), TOBN(0x1c6188d3, 0xe7f179fc),
+	TOBN(0xcd6fa1b9, 0xd1c931c4), TOBN(0x0e8b93f7, 0x35e7de83),
+	TOBN(0x98f3cab1, 0xb54367fb), TOBN(0x612ad6f8, 0x8f696992),
+	TOBN(0xe39d0ca9, 0xdf7aad44), TOBN(0x7c9aa2dc, 0x235c5269),
+	TOBN(0x96e9c057, 0x02db30a0), TOBN(0x6725b7c9, 0xe3aa2c65),
+	TOBN(0x3dff8347, 0x5e9c40fa), TOBN(0xb6d799ae, 0x131ba4c2),
+	TOBN(0x5160dbee, 0x83b4e019), TOBN(0x11c79404, 0xa576605a),
+	TOBN(0xf400a349, 0x0bf94812), TOBN(0x0bb3bd16, 0x59c81294),
+	TOBN(0x1b7a4a89, 0x9da18139), TOBN(0xb01eca92, 0x92ae3dba),
+	TOBN(0xcfd4f592, 0x0da0ebc8), TOBN(0x106ae64c, 0x32c5bce4),
+	TOBN(0xaeb5f786, 0x71cbfb22), TOBN(0xfdf44159, 0xc4ec64dd),
+	TOBN(0xd6fdb1f7, 0x7598338b), TOBN(0x3b399d74, 0x7f23e32e),
+	TOBN(0x36f0255d, 0xde973dcb), TOBN(0x00000000, 0x00000000),
+    },
+    {
+	TOBN(0x21f30e8d, 0x664fcd1c), TOBN(0x564ce3d9, 0x56ad1d17),
+	TOBN(0xe7b56bb3, 0xef648f64), TOBN(0x28ff93ee, 0x8b99cb80),
+	TOBN(0xfba975dc, 0x53161804), TOBN(0x95ff6902, 0x83dfaa9c),
+	TOBN(0x5e00e78d, 0x0defb4a9), TOBN(0xb855fe16, 0x510a28dd),
+	TOBN(0x608be147, 0xcf3afaab), TOBN(0x06a102df, 0x57b9546e),
+	TOBN(0x62fd2f7a, 0x288bdc29), TOBN(0x77513ded, 0xe934ff04),
+	TOBN(0xa1873aa7, 0x09aa27a8), TOBN(0x76801db6, 0xbcfc2158),
+	TOBN(0x7b779336, 0x9333a6ce), TOBN(0x7272b92a, 0xa48c3f24),
+	TOBN(0x094acd5b, 0xd8627c92), TOBN(0xedb9e4dd, 0x0c5fda79),
+	TOBN(0x656fb9e0, 0xf0574ff5), TOBN(0x19254738, 0x15435d1d),
+	TOBN(0x976455fe, 0xa6298520), TOBN(0xeaa09cd7, 0xaa5deb74),
+	TOBN(0xc08d86a6, 0xfd9a9509), TOBN(0xb702bc97, 0xa8c9ca8b),
+	TOBN(0x2a819c6d, 0xa81ee330), TOBN(0x9b149992, 0x0baa26eb),
+	TOBN(0x1b3c2ab9, 0xb7185737), TOBN(0xda3b54a3, 0x5d8b4c5e),
+	TOBN(0x16d81461, 0x0043e9ea), TOBN(0x7a56e4ae, 0xd557f309),
+	TOBN(0x12850b9b, 0x88fb94c2), TOBN(0x49a9eedc, 0xcf8ac132),
+	TOBN(0x640e40f8, 0xa5e475b6), TOBN(0x0c4f4db3, 0xe6eab0d7),
+	TOBN(0xc95af385, 0xfd71f7af), TOBN(0x36bd6f54, 0xdefa22b7),
+	TOBN(0x83cbc624, 0x0db58484), TOBN(0xac05f74a, 0x3fee4168),
+	TOBN(0xae9bea6e, 0x1a030038), TOBN(0x834f9b35, 0x4841ee0e),
+	TOBN(0xdfcceb6c, 0x7d83817d), TOBN(0xfd5e397c, 0xc690f952),
+	TOBN(0x77625833, 0x9d67b257), TOBN(0xd4e0a42d, 0x5281387a),
+	TOBN(0x94ff0fa6, 0x868ee155), TOBN(0xabd260e3, 0x738c1e41),
+	TOBN(0xe12dc8ac, 0x5523024d), TOBN(0x46b0375c, 0x8f76956b),
+	TOBN(0xb19d4c15, 0xfef12e68), TOBN(0x524c7f90, 0xd7adde89),
+	TOBN(0x5ca79f42, 0xd4ea4e20), TOBN(0x04d442e1, 0xdd303c2b),
+	TOBN(0xf3a99867, 0x7241cec9), TOBN(0x873eb18b, 0x16ccd131),
+	TOBN(0xc97f5724, 0x007b9c77), TOBN(0x8becf09e, 0x341c53cf),
+	TOBN(0x557c5a45, 0xd3d95279), TOBN(0x75bb9d71, 0x833caa66),
+	TOBN(0x58a1b9ef, 0x1d9ef4a8), TOBN(0x2e41cb06, 0x2b390e4f),
+	TOBN(0xdbd93430, 0x02e66275), TOBN(0x0c4c8271, 0x3d861e14),
+	TOBN(0x3a74a367, 0xab805765), TOBN(0x1eded138, 0x02541e57),
+    },
+    {
+	TOBN(0x191b2f59, 0x8fcf566e), TOBN(0x22d28fa4, 0x84e54273),
+	TOBN(0x0d5fcc7a, 0x8563a6ce), TOBN(0x5561e791, 0x3771da20),
+	TOBN(0xb37d4e59, 0x753fcc53), TOBN(0xa7ff9a95, 0x23df5cac),
+	TOBN(0x35277b0c, 0x82806e65), TOBN(0x65e85193, 0x0004bf64),
+	TOBN(0xd58667ed, 0x3a1e9ff5), TOBN(0x379142d5, 0x9ab8e8a2),
+	TOBN(0x353a549b, 0x440f5fb5), TOBN(0x7844af25, 0x854e5b0b),
+	TOBN(0x7782f12c, 0xd88cb56e), TOBN(0x6cbb6c4d, 0x17a77c4e),
+	TOBN(0x7e973824, 0x56d3a710), TOBN(0xa8196b78, 0xc0ddc8e9),
+	TOBN(0x310969c5, 0x3ad03423), TOBN(0x4673f98b, 0xe40e68ba),
+	TOBN(0x62e52dbc, 0xf800fda6), TOBN(0x6b9c8508, 0xdb18ede6),
+	TOBN(0x9bdae308, 0xddfb543c), TOBN(0xb76eba51, 0x0413482e),
+	TOBN(0x3b683a84, 0xac3bf024), TOBN(0x5491dcf5, 0x958e8dc5),
+	TOBN(0x0270e784, 0x7f1bc9f3), TOBN(0x6cf35d38, 0x638999a9),
+	TOBN(0xfb668450, 0x74d88dcf), TOBN(0x7880ad6d, 0x2c341499),
+	TOBN(0x669dd416, 0x16517c9d), TOBN(0xa49098b5, 0x97ebe5e5),
+	TOBN(0x36a146b8, 0xb7f313ab), TOBN(0x438cde8f, 0x6fa87957),
+	TOBN(0x7958c66e, 0x104613d4), TOBN(0xddeb08e0, 0xefdb2506),
+	TOBN(0x40b81241, 0x0c00f1fb), TOBN(0xec535785, 0xe2efa2d6),
+	TOBN(0xd545ee3c, 0xc111b5a3), TOBN(0x435cb3d3, 0x04c4c045),
+	TOBN(0x5a66abe1, 0x5d9b402c), TOBN(0x74be7b86, 0xfd141a3f),
+	TOBN(0xa843781b, 0x295cc6d5), TOBN(0xc4ff8aec, 0x72146236),
+	TOBN(0x5e725a7b, 0x8576a98a), TOBN(0xcc743e18, 0x612eba29),
+	TOBN(0x4fc6ce76, 0x2fd933b5), TOBN(0xf0ed0d66, 0xfe99212e),
+	TOBN(0x3757d2c4, 0xf94da96e), TOBN(0xb6dbc80c, 0xa6902106),
+	TOBN(0xae59357f, 0xd32b5266), TOBN(0xa8dae72a, 0x47be8b9a),
+	TOBN(0x8805e4e5, 0x9c75a86e), TOBN(0x002c18ea, 0x227ae94d),
+	TOBN(0xd8cf5ba9, 0x35ff9d26), TOBN(0x1d0fd385, 0x4e5ce43e),
+	TOBN(0x2f8db09a, 0x7212153d), TOBN(0x2e3ddacb, 0x41d6507f),
+	TOBN(0xe349d61b, 0x08d74904), TOBN(0x639181d9, 0x4b26de53),
+	TOBN(0xf48b0e54, 0xdccd29f3), TOBN(0xf6a738fe, 0x7486c649),
+	TOBN(0xba1849fe, 0x6c6c71ca), TOBN(0xebc78825, 0xed9a8770),
+	TOBN(0xe6e4c785, 0xc03ad7ad), TOBN(0x3f647b4f, 0x7d2692a7),
+    },
+    {
+	TOBN(0x45387bb0, 0x9b7526a2), TOBN(0xc5a1e8cb, 0xe15d212b),
+	TOBN(0xcc6fba70, 0xab6af04a), TOBN(0x7c514894, 0x1de2d1cd),
+	TOBN(0x81dee94a, 0xd2343915), TOBN(0xb476ae61, 0x26408c60),
+	TOBN(0xf699b9fd, 0x4caedf97), TOBN(0x312f8131, 0x9dd25ed5),
+	TOBN(0x7e9c148d, 0xb2e2ab7f), TOBN(0xef4f83b8, 0x5597686a),
+	TOBN(0x3b4b5921, 0x734b447a), TOBN(0xe8604db8, 0xce8600f3),
+	TOBN(0x845c7ae7, 0x2a5a731b), TOBN(0x65e89f13, 0x3b393910),
+	TOBN(0x47291d35, 0xe8b4dfef), TOBN(0x58f29b4c, 0xb6662e0f),
+	TOBN(0xf741705e, 0x00b6842e), TOBN(0x63dfb0c4, 0x5a6b9698),
+	TOBN(0x5be633ed, 0xeadeecea), TOBN(0x369b2844, 0x0e3a52ab),
+	TOBN(0x0c5e5ff6, 0x47a6468b), TOBN(0xc9d93da5, 0x5f82511a),
+	TOBN(0x2e5c9ab2, 0xfb600679), TOBN(0x53b06fd8, 0x8bd242d3),
+	TOBN(0xb70fc961, 0x76fc338d), TOBN(0xd03a3c80, 0x70bee023),
+	TOBN(0xd3f66c32, 0x52ce74d5), TOBN(0x95e15907, 0xe6fd9786),
+	TOBN(0xa30618fa, 0x376ec4e6), TOBN(0xa60ad7e2, 0x3ec08e6d),
+	TOBN(0xd9439380, 0xe10c0a18), TOBN(0xf3344bc8, 0xcdd6715b),
+	TOBN(0xab2ede7e, 0x315f4041), TOBN(0x2484924e, 0x373ed188),
+	TOBN(0xc067f961, 0xc334bb5a), TOBN(0xb4362ea3, 0x9c418da3),
+	TOBN(0x5000cbaa, 0xfc563e39), TOBN(0x029869b6, 0x76ea03bf),
+	TOBN(0xbdb15cbc, 0xb4ee99c7), TOBN(0xa2570030, 0xb4c713c5),
+	TOBN(0xc26dd2e1, 0xf505b992), TOBN(0x671619b4, 0x458f343c),
+	TOBN(0x7a1fd680, 0xb7c86ad4), TOBN(0x5eb4ab3c, 0xed05f349),
+	TOBN(0x6419c41e, 0xd8067c6e), TOBN(0xb0fb744a, 0x7ab6b50e),
+	TOBN(0x80e6709f, 0x57ed4f4c), TOBN(0x87439db3, 0xe9ed9ca7),
+	TOBN(0x9d367061, 0x4fc45e3e), TOBN(0xe2894678, 0x25d3ed4f),
+	TOBN(0xcf318f59, 0xaab2ab8e), TOBN(0xe04ee020, 0x66d82cf0),
+	TOBN(0xd4d43419, 0x9117f7c4), TOBN(0xeda09c14, 0xe9cb4da1),
+	TOBN(0x1ddbc8a1, 0x8f5a2c14), TOBN(0x6f81a407, 0x7db67e74),
+	TOBN(0x327563c1, 0xa2fe52dd), TOBN(0x1701597a, 0xf49b6879),
+	TOBN(0x104c49aa, 0x4bb69f92), TOBN(0x1ca6b0ad, 0xcd15df37),
+	TOBN(0xc4cfbacc, 0x8d0d3973), TOBN(0x30b68e5d, 0x3d943aa9),
+	TOBN(0xbcc67c64, 0x1ab52a6f), TOBN(0xf29d82dd, 0x61fec47c),
+    },
+    {
+	TOBN(0x66127334, 0x36674105), TOBN(0x5509798d, 0x1453da90),
+	TOBN(0xdd3de0b4, 0x6ef47933), TOBN(0x8a6977da, 0xd6b1dec3),
+	TOBN(0x402bd832, 0xbc4c6f80), TOBN(0x9932b5d5, 0x2f341680),
+	TOBN(0x96037c7c, 0x7a036177), TOBN(0x2d604c5e, 0x3795ea3f),
+	TOBN(0x66124e1c, 0xc03be458), TOBN(0xdf8bf2d0, 0x762a5da8),
+	TOBN(0x70dc29bf, 0x565f8f35), TOBN(0x1139a2fa, 0x49eceb6d),
+	TOBN(0x0ac83c09, 0x501e999a), TOBN(0x35541666, 0xb35effcb),
+	TOBN(0x1b5fc02b, 0x78edfac7), TOBN(0x3b76595f, 0xb695a4d6),
+	TOBN(0x0e9e97a5, 0x90c6dfae), TOBN(0xbe15e9d3, 0xd983129a),
+	TOBN(0xc1dd5ad7, 0x901359b8), TOBN(0x920269b0, 0x35523ef3),
+	TOBN(0xa3a80941, 0x7a579500), TOBN(0xe8be815d, 0x822c3228),
+	TOBN(0x4bbc98a6, 0xd0ab62fd), TOBN(0x6cfee41c, 0xb3a22ef1),
+	TOBN(0x9d8ceb5c, 0xb225f2c9), TOBN(0x161ceb06, 0x5e3e027c),
+	TOBN(0x23eeb3d8, 0x7845e790), TOBN(0x90cb3662, 0xb709470d),
+	TOBN(0x065de2eb, 0x3e86cc29), TOBN(0xbd4343c2, 0xdc2e2f5d),
+	TOBN(0x23e7a93a, 0x943b51f3), TOBN(0xcc447c63, 0xa7c01273),
+	TOBN(0x16ca4240, 0xf172eff7), TOBN(0x799908c3, 0x2fe506e4),
+	TOBN(0xd74b3e89, 0x83fe9032), TOBN(0xf1d3a878, 0x906fa5b4),
+	TOBN(0x01f92f68, 0xacc7d640), TOBN(0x28e29d42, 0x396f2944),
+	TOBN(0xd44ee793, 0xd6c97d6d), TOBN(0xcafdfef1, 0x2b2ae2bc),
+	TOBN(0xa3fb2f23, 0x40a3e390), TOBN(0x55dce682, 0x3fa626b4),
+	TOBN(0x881ee071, 0x88f85146), TOBN(0x691660cc, 0xa9804271),
+	TOBN(0x0a536f4e, 0x09dce009), TOBN(0x0b8da33f, 0x8e8275fc),
+	TOBN(0xc93405c0, 0xd537e477), TOBN(0x3d70993a, 0xfa08ba97),
+	TOBN(0x0f1db504, 0x2be4e67a), TOBN(0xb0a5a5f9, 0x1eebbed3),
+	TOBN(0x1966a428, 0xa9187953), TOBN(0xdeeddf53, 0xc890427c),
+	TOBN(0x854ae3b4, 0x7057de29), TOBN(0xfada0a8b, 0xfc7eeded),
+	TOBN(0x408e96c7, 0x8970ef39), TOBN(0xe8df3c57, 0xc10f7393),
+	TOBN(0xdf646067, 0x6dbf2abb), TOBN(0xb21c7a81, 0xcbbd4209),
+	TOBN(0xcfaad9d7, 0x98e246c0), TOBN(0x637400e3, 0x13c575b7),
+	TOBN(0x8f798aa1, 0xb9ced1b1), TOBN(0xbad72ade, 0xe00d1a14),
+	TOBN(0x27cfb922, 0xc7f14286), TOBN(0x71202510, 0xdf13c533),
+    },
+    {
+	TOBN(0x525be6f8, 0x4efe8c5c), TOBN(0xb94be08b, 0x11e0e020),
+	TOBN(0xad2ced66, 0x13213472), TOBN(0x4c00ba38, 0x916acdb1),
+	TOBN(0x223bb8a9, 0x3e09785b), TOBN(0x28bfb614, 0x7b606472),
+	TOBN(0x91e7c71e, 0x5bf1fb0d), TOBN(0x3305aef4, 0x49febff8),
+	TOBN(0x0e9813b6, 0xbe75aab4), TOBN(0xc99f9c3f, 0xbae6bf23),
+	TOBN(0x698a51d5, 0x04a191b9), TOBN(0x5c043481, 0x8a9bce80),
+	TOBN(0x1efd1f2d, 0x0c453099), TOBN(0x29bd6b1d, 0xc0f86007),
+	TOBN(0x4c30d779, 0x9f1b9119), TOBN(0x4e1e7d1b, 0x4d2efaf6),
+	TOBN(0x708d69e4, 0x8ebcdea6), TOBN(0x6edb19cc, 0x8caeefa2),
+	TOBN(0x1bf4b1e4, 0xd93a7416), TOBN(0x1ed4b0b6, 0x7b5a0eda),
+	TOBN(0x37e6651a, 0x3e54f146), TOBN(0xbbd8c4a8, 0x00f5c58b),
+	TOBN(0xcdd0ae01, 0x5ac9a4d8), TOBN(0x78475b89, 0x0312f68e),
+	TOBN(0xfe167e6f, 0xb439f09d), TOBN(0x89f7bdc8, 0xbaa750b8),
+	TOBN(0xd9c2bd53, 0xdb764efa), TOBN(0x2451367e, 0x51e9b9c8),
+	TOBN(0x470aad9e, 0x37cef60c), TOBN(0x0103e3c1, 0x3bec2a93),
+	TOBN(0x362430a7, 0x2c9a6c3b), TOBN(0xcd040d0c, 0x0be3eba4),
+	TOBN(0xcb4428fd, 0xaf0a057a), TOBN(0x50e9ae08, 0xca1e7033),
+	TOBN(0x5db510cc, 0xe991dcc3), TOBN(0x08dda78b, 0xf012e9e3),
+	TOBN(0xfc6aa60b, 0x8900c0cc), TOBN(0x0aa38526, 0xd0f92eaf),
+	TOBN(0x60a45fd0, 0x6f3821aa), TOBN(0x05f52cb6, 0xe3f528da),
+	TOBN(0x6a6063f9, 0xb3f5b1bf), TOBN(0x3e2cea3c, 0x0a5db40b),
+	TOBN(0xc52a547c, 0xb2ebf329), TOBN(0x7ea3313d, 0xec751c06),
+	TOBN(0x5422051b, 0x8a93a3ec), TOBN(0xad4d893f, 0x5e424942),
+	TOBN(0x2cbbf24c, 0x52272c2b), TOBN(0x2e3a2072, 0x9838765a),
+	TOBN(0x1f9d9bd2, 0xdc396c03), TOBN(0xa7bd4280, 0x02eb37ae),
+	TOBN(0xb862c9a3, 0x78e63812), TOBN(0xe100c554, 0x0f2b59da),
+	TOBN(0xccdd5900, 0x82e8847e), TOBN(0xa5e8c970, 0xd2d83054),
+	TOBN(0x36734fa9, 0xf0ccd182), TOBN(0x0146ab08, 0x058e9377),
+	TOBN(0x5b5864ad, 0x4f7ad435), TOBN(0xff72dc16, 0x5b02d0dd),
+	TOBN(0x7cc2c3c5, 0x3ddb0e27), TOBN(0x195c2f28, 0x8bf2394b),
+	TOBN(0x3179c8b6, 0xa2ea83c6), TOBN(0x43ebb3ce, 0x4ed2c9c7),
+	TOBN(0x39ee2bad, 0x127ed908), TOBN(0xeeff20dc, 0x04832595),
+    },
+    {
+	TOBN(0x217b9599, 0x6a61582c), TOBN(0x634fb3a4, 0x06616ea6),
+	TOBN(0x1f2cb9c6, 0x396d388f), TOBN(0x3850832a, 0xf654d703),
+	TOBN(0x28cc3cc2, 0xa5367f61), TOBN(0x25937ce3, 0x6ea18813),
+	TOBN(0x179364c1, 0xc1f3ba09), TOBN(0xc0ce1121, 0x2b80b0f7),
+	TOBN(0x301644c5, 0xd14ae3fe), TOBN(0x600eb1e2, 0xfb619e6f),
+	TOBN(0x2bcb160c, 0x347460b4), TOBN(0xc385e188, 0xec73d1e5),
+	TOBN(0x5da024a0, 0x2cedfa1c), TOBN(0x14bd8756, 0x200d925f),
+	TOBN(0xe311de15, 0x3888316b), TOBN(0xd3ed0d0a, 0xf7487262),
+	TOBN(0x85a029e0, 0x2eb6f5aa), TOBN(0x74165546, 0xe8a7d292),
+	TOBN(0x05c14377, 0x794157ac), TOBN(0x374a14f6, 0xc1635bef),
+	TOBN(0xd49edca1, 0x371bf48c), TOBN(0x5d42b220, 0x12f2a927),
+	TOBN(0xc0e4a6bf, 0xc8bf6dc7), TOBN(0x709191d2, 0xcdddc7df),
+	TOBN(0xc3ef508b, 0x398b36b4), TOBN(0xcd1ad13e, 0x43c4a158),
+	TOBN(0x22b235c7, 0x68a7b3d8), TOBN(0x401893b6, 0x99b831ad),
+	TOBN(0x3f0ba0a5, 0xfb41e92a), TOBN(0x3f48510c, 0x34bf8ee5),
+	TOBN(0x1575bd2f, 0x9c4113cc), TOBN(0xa686c23f, 0x4c778e02),
+	TOBN(0xd1795843, 0x3129ce4d), TOBN(0x35ffd340, 0x03a93ac5),
+	TOBN(0x3bc2a5d5, 0xee5826ab), TOBN(0x2d778692, 0x1c40e189),
+	TOBN(0xea314c08, 0xafe7ba8d), TOBN(0x86c0baf6, 0x9d20a6c6),
+	TOBN(0x6ebd964b, 0xb9a19200), TOBN(0x1d2ff2e9, 0xd08d81d1),
+	TOBN(0x5bddeaf5, 0xc102ee96), TOBN(0xd9002cad, 0x705f6f5f),
+	TOBN(0x9c9abe83, 0x189bbe19), TOBN(0xe84d9064, 0xca029757),
+	TOBN(0x4a8f1f56, 0xd9cfa801), TOBN(0x4de241af, 0xe2375177),
+	TOBN(0xda1694fe, 0xe365fac4), TOBN(0xa1174fcd, 0x56f46b6e),
+	TOBN(0x62ccc6e0, 0xb2d02801), TOBN(0xa65c3ac4, 0x678927c2),
+	TOBN(0xb8f0298b, 0x3a8b3a62), TOBN(0xda34ae88, 0x2a0c6fc0),
+	TOBN(0x8af82e5b, 0x04f496f3), TOBN(0x3d405c37, 0x48b503fa),
+	TOBN(0xbf5a9148, 0x37f314f3), TOBN(0xad1672ce, 0xb58d592e),
+	TOBN(0xb1aa9e1b, 0x5b023c1f), TOBN(0x37574562, 0x449299de),
+	TOBN(0xd73489ab, 0x67c48d27), TOBN(0x2bd180c8, 0x1429572c),
+	TOBN(0xe63b861f, 0x81e5d3f9), TOBN(0xb0facffd, 0xf8f93cad),
+	TOBN(0x5204f237, 0xc6cd127f), TOBN(0xba91fccb, 0x75ee395c),
+    },
+    {
+	TOBN(0x269db5f2, 0x8572b164), TOBN(0xe56a804b, 0x6e4754f9),
+	TOBN(0xc0fae67d, 0x7183d571), TOBN(0x02bcff11, 0x121232af),
+	TOBN(0xe9d4dda2, 0x825512ea), TOBN(0xeb0a6721, 0x18505e55),
+	TOBN(0xfc22b4d3, 0x639edb52), TOBN(0x8dd3bd99, 0xe7bdd7e0),
+	TOBN(0x9404efe5, 0x75edcdd4), TOBN(0x9d00e3fa, 0x17d81504),
+	TOBN(0x54607463, 0x70e7e27a), TOBN(0xb185befc, 0x93e17886),
+	TOBN(0x582f66a1, 0x60988168), TOBN(0x71831733, 0x4b86b05b),
+	TOBN(0x290e6f6c, 0x838c38a9), TOBN(0xc6aa54bb, 0xc176eda4),
+	TOBN(0x9311b4d9, 0x955b87c2), TOBN(0xfbfbca28, 0x46ee4236),
+	TOBN(0xffa42a85, 0x3c760473), TOBN(0x2b2cff6f, 0x17a459d8),
+	TOBN(0x69e7b8f6, 0xa0ad43f9), TOBN(0x61c56ebb, 0xdddaa2d6),
+	TOBN(0x072a31ce, 0x8c24ce19), TOBN(0xf048f8be, 0x6db0d336),
+	TOBN(0x7ad5f6e4, 0xae0820c9), TOBN(0x7ccd640b, 0xa82c4d61),
+	TOBN(0x47cd88cf, 0xa0f63562), TOBN(0x03b6defe, 0x9d844fdd),
+	TOBN(0xafec28fe, 0x3d133a41), TOBN(0x388e93a9, 0x3cb5bc0a),
+	TOBN(0x99faf2b9, 0xec9da82b), TOBN(0xf5f998ba, 0x58fa3c50),
+	TOBN(0x5d1f8e40, 0x03db2844), TOBN(0x8aae6976, 0xc1082b28),
+	TOBN(0x44c0bf77, 0x9bf39301), TOBN(0x04e4e774, 0xec60c6a4),
+	TOBN(0x5739ee1a, 0x2e56afeb), TOBN(0xbbb36a2a, 0x894c358d),
+	TOBN(0x5983abcc, 0xc150e430), TOBN(0x3876a897, 0x0d8a7f3c),
+	TOBN(0xab756f63, 0xf5641ecc), TOBN(0x0670057c, 0x2d104548),
+	TOBN(0x354d23d7, 0x00953a3c), TOBN(0xa28499f6, 0xb77e4d97),
+	TOBN(0xfc53d9b0, 0x362bf7b5), TOBN(0xee195d56, 0x3c37469a),
+	TOBN(0xd922d9a8, 0x35a2bbad), TOBN(0x0c503192, 0x1df1d9ed),
+	TOBN(0xabbc7ae5, 0x261aa2c6), TOBN(0xef3fefca, 0x5b398234),
+	TOBN(0x6b799f96, 0x066c5ca8), TOBN(0x0be39c2c, 0x87be8eb4),
+	TOBN(0x0a1df355, 0xe1359eb4), TOBN(0x54cbfc65, 0xdbc94235),
+	TOBN(0x6e854147, 0x94107da0), TOBN(0x1eef55ad, 0x55f0eb28),
+	TOBN(0x44dc43f3, 0x58fd4f8c), TOBN(0x9bf3a677, 0x19ca42d7),
+	TOBN(0xd3ba2d1c, 0xeb202fcd), TOBN(0xdd315cc6, 0xfb43cb31),
+	TOBN(0xdf80d533, 0x40982d42), TOBN(0x519ffd80, 0x1b1ca7c3),
+	TOBN(0x62935632, 0xea4444c1), TOBN(0x22e33628, 0xfac2ad24),
+    },
+    {
+	TOBN(0x3c0cd30d, 0xe77f424d), TOBN(0xe4d51531, 0x2f4de746),
+	TOBN(0xf79c6801, 0x01515a07), TOBN(0x91b7407c, 0xaf6c0d7f),
+	TOBN(0xb32eee5e, 0xc7f248f9), TOBN(0xf143e79f, 0xebc5fd8f),
+	TOBN(0x4298f93c, 0x709515c4), TOBN(0xaaafca34, 0xf93667c1),
+	TOBN(0x8ce5bf37, 0xe3e6e19f), TOBN(0xa0dd67f9, 0x2764ad2a),
+	TOBN(0xb79fef02, 0x9f311e1b), TOBN(0xebd144c3, 0xe3e4d83c),
+	TOBN(0x7a3569ce, 0x72ffb47a), TOBN(0xbd3316f0, 0xfcafe857),
+	TOBN(0x5232cb89, 0xdb9d5eb6), TOBN(0x799c21c0, 0x8073d940),
+	TOBN(0x34f5fa99, 0x0ac871bb), TOBN(0x9e5e151d, 0x17088db1),
+	TOBN(0xfda4c0a6, 0x3cccf42b), TOBN(0xaa8ab769, 0x46c99711),
+	TOBN(0x687772da, 0x5f3a138b), TOBN(0xbe4157f5, 0x12415f71),
+	TOBN(0x33fdad72, 0x9330f7d9), TOBN(0xc2263188, 0x278a337a),
+	TOBN(0x6201ab8c, 0x604f289a), TOBN(0x406c9f42, 0xd095b640),
+	TOBN(0x06961253, 0x565ad481), TOBN(0x4e648e88, 0xe8fbd71d),
+	TOBN(0x8f7b93fc, 0x1fc1faec), TOBN(0x13b8fd1a, 0xe0d6c2e4),
+	TOBN(0xc64ef0dd, 0xef42c62b), TOBN(0x08a3762b, 0x3f0ca3ef),
+	TOBN(0x637b0259, 0x66405ffb), TOBN(0x2fcdcf16, 0xea7e0324),
+	TOBN(0xe071e7cc, 0xe6803178), TOBN(0xd1440e40, 0x806ea767),
+	TOBN(0x724b299b, 0x4307ad3b), TOBN(0x2bb71a60, 0xd4e75bab),
+	TOBN(0x5e6b2698, 0xb80b6e51), TOBN(0x0fe94735, 0x6eb00f4e),
+	TOBN(0x57e6c5e3, 0x91dc53c7), TOBN(0x9c6d7982, 0xc5a18d8d),
+	TOBN(0x21e816ce, 0x6903557a), TOBN(0x7a01900b, 0xc8ed81ee),
+	TOBN(0xb8b7d57c, 0x3d1bb120), TOBN(0x761233a2, 0xa93664a5),
+	TOBN(0xb2a93d6f, 0x158846dc), TOBN(0x7845d3e5, 0x6ba3456f),
+	TOBN(0xd95e4a0a, 0xf6f61c38), TOBN(0x81b66880, 0xec4d93a1),
+	TOBN(0x3b243a50, 0x1bed064d), TOBN(0xb31df10c, 0x4b712b12),
+	TOBN(0x47715215, 0x1a079a58), TOBN(0xfd8f082a, 0x416191ae),
+	TOBN(0x2535bc64, 0x57437d04), TOBN(0x964077f0, 0x3572e7c0),
+	TOBN(0xf0c326df, 0x8add2ad1), TOBN(0x7f69e28e, 0xb35391c5),
+	TOBN(0x165d9fe4, 0xd0070262), TOBN(0x24cd99ba, 0x6c22b682),
+	TOBN(0xcc350d06, 0x2eda40b4), TOBN(0x5881525d, 0x956c3bbf),
+	TOBN(0x9810a704, 0xdae2c27f), TOBN(0x1e1f8ff7, 0x84edd1e6),
+    },
+    {
+	TOBN(0xae6a0930, 0x1f36163b), TOBN(0x5bc69c29, 0xca534a9c),
+	TOBN(0x63c908eb, 0x619aaaa4), TOBN(0xad02d726, 0xffdbee16),
+	TOBN(0xc5530bf3, 0x85739509), TOBN(0x80ff214c, 0x75e1796f),
+	TOBN(0x542c4072, 0x40878c18), TOBN(0x837c049d, 0x78bb36cd),
+	TOBN(0x364c6cee, 0x376428fe), TOBN(0xf5707aa3, 0x514eeb50),
+	TOBN(0xab4fdb65, 0xbfc31316), TOBN(0xead129a3, 0x7a3b10cb),
+	TOBN(0x800a792e, 0x52eb2712), TOBN(0x6f94bda9, 0x59317381),
+	TOBN(0xf5039504, 0x66cc33a2), TOBN(0x1e0aa5eb, 0x79ce18a1),
+	TOBN(0xfd567b49, 0x1f1b4b9c), TOBN(0x76bcb401, 0xd1773cc9),
+	TOBN(0x98562125, 0xf5eb52e7), TOBN(0xb46d0f80, 0x5fe8d2d1),
+	TOBN(0xe24f80a0, 0x02ed6fca), TOBN(0x90cc6390, 0x6f5b2708),
+	TOBN(0xdc9a2f79, 0xce1a15fa), TOBN(0x01032644, 0x202ceffe),
+	TOBN(0xd5c61542, 0xfe974b05), TOBN(0xa0769958, 0x3c74d055),
+	TOBN(0x55f96c41, 0x19e4a712), TOBN(0x9d00cc2d, 0x5e3653dc),
+	TOBN(0x4c29daeb, 0xc86d4e43), TOBN(0xa3d32511, 0xe519c657),
+	TOBN(0x2e151ce5, 0xbffcecf2), TOBN(0x113848c5, 0xbf85c964),
+	TOBN(0x70369e5e, 0x83bf02ff), TOBN(0x299f6a5f, 0xa3a476e5),
+	TOBN(0x93f15228, 0xa74ac805), TOBN(0xcacbdcfa, 0x44d92591),
+	TOBN(0x53a76a0f, 0xe9a44a32), TOBN(0x4da311df, 0x122bfadf),
+	TOBN(0xfff54ec0, 0x4575875f), TOBN(0xdfb9e6e3, 0xb78b3858),
+	TOBN(0x178c693d, 0x2fff7a5b), TOBN(0x35ff8b22, 0x45967a5a),
+	TOBN(0x5af929e8, 0x98d09d4f), TOBN(0x2ab5ee69, 0xf4ba7ec8),
+	TOBN(0x75b8f88e, 0x294162f7), TOBN(0x4eacb761, 0xcfc8d948),
+	TOBN(0x10c46375, 0x71145cbe), TOBN(0x26b31241, 0x8c0e64bc),
+	TOBN(0x5d8d82ff, 0x7370906d), TOBN(0x3b4014c0, 0x0a823a23),
+	TOBN(0xd97aa806, 0xcdd4a901), TOBN(0x1e92ec85, 0x9fa88028),
+	TOBN(0x049a3b97, 0x4ddd2294), TOBN(0x05405602, 0xd4dad7fb),
+	TOBN(0xd0f7a765, 0xfdc426d7), TOBN(0x0ebdcb0f, 0xfbdbee78),
+	TOBN(0xa01651e8, 0xed5dfd2c), TOBN(0x78ae2839, 0x99238aa4),
+	TOBN(0x403fb3ca, 0xa48ebe74), TOBN(0xd2523763, 0x2c739080),
+	TOBN(0x17bb875e, 0x9bbf98ed), TOBN(0x7d850e0e, 0x05a2c127),
+	TOBN(0x77be8c76, 0x2254b26f), TOBN(0x54749510, 0x2527d23e),
+    },
+    {
+	TOBN(0x0485ee64, 0x475d79d3), TOBN(0x5b2158fd, 0x59165ab5),
+	TOBN(0x08cc4d1b, 0xb43ee54c), TOBN(0x8bc98106, 0x54c07da1),
+	TOBN(0xedbb968e, 0xc18e7de4), TOBN(0xa5ae0941, 0x8785f97d),
+	TOBN(0xed426eea, 0x0989d959), TOBN(0x57f539d5, 0x25b7783a),
+	TOBN(0x0398ca45, 0xa1725c1d), TOBN(0x1837ea11, 0x80a3effd),
+	TOBN(0xebcec723, 0x52090e9a), TOBN(0xc060d51b, 0x3438e6ae),
+	TOBN(0x6a4d1ef7, 0xf1173acb), TOBN(0xb285bc83, 0x76138704),
+	TOBN(0xdb23fe23, 0x77c54bfd), TOBN(0xb617a9a6, 0x1e94bd3b),
+	TOBN(0xb2bc0cfd, 0x9aa920ce), TOBN(0xc23456eb, 0xf3483d82),
+	TOBN(0xb3105314, 0xccdd01bc), TOBN(0x802cfda6, 0x0d3adc10),
+	TOBN(0xf0bba9eb, 0x59c8716d), TOBN(0xb6ced3f8, 0xf71d82d2),
+	TOBN(0x91d6323a, 0xde61a201), TOBN(0xc263d739, 0x0dcd75e1),
+	TOBN(0xbcf77f62, 0x4d1cbf90), TOBN(0xe679bc85, 0xf4fbf430),
+	TOBN(0xd0459596, 0xe375f5c2), TOBN(0x31a454e0, 0xd5c81d15),
+	TOBN(0xad4fb047, 0xfcd7e048), TOBN(0xd7d7b3a0, 0xba886bd3),
+	TOBN(0xf24d4e7c, 0xbda8dc78), TOBN(0x63b4db20, 0xfcbd53e5),
+	TOBN(0x4efc54f7, 0x22e1b6e8), TOBN(0x73c8778a, 0x33aa7169),
+	TOBN(0x96b8644a, 0xe8249265), TOBN(0xb96f487d, 0xbc43028f),
+	TOBN(0xbd666fe5, 0xaeafe823), TOBN(0x146129db, 0x45ffff88),
+	TOBN(0xdf084da3, 0x3955e846), TOBN(0x06ee939d, 0x098f73dc),
+	TOBN(0xc4297ac1, 0xbada9f96), TOBN(0x8532ba7f, 0xef726563),
+	TOBN(0x4eb219c6, 0xd211b53f), TOBN(0x7071716a, 0x0be5adff),
+	TOBN(0xb445c6ff, 0xf74d1cee), TOBN(0x9cf4121c, 0x3195e584),
+	TOBN(0xa82d4d7f, 0x7319c449), TOBN(0xf6dde30a, 0xa9220411),
+	TOBN(0x3f10db6a, 0x7ee83185), TOBN(0x3b6b8645, 0x9d3f153a),
+	TOBN(0x736ceeac, 0x8d0b6fe5), TOBN(0xc5887acf, 0xcc7886aa),
+	TOBN(0x25ed81bd, 0x3ea06e9b), TOBN(0x2a25b54f, 0x7d572392),
+	TOBN(0x9f057b0d, 0x757f0251), TOBN(0x3a89c044, 0x4c3d56a7),
+	TOBN(0xf37e087a, 0x5f826b80), TOBN(0x25b40ebb, 0x53665814),
+	TOBN(0x0b76e8a9, 0x2d685381), TOBN(0xa3f81fb0, 0x5ca0f45a),
+	TOBN(0xf332d69e, 0xd707bb9f), TOBN(0x42510138, 0xef5804d0),
+	TOBN(0xd510eda2, 0x853a7a36), TOBN(0x78d91e17, 0x570a5843),
+    },
+    {
+	TOBN(0x5557ab50, 0x5c9d5c9a), TOBN(0xa42b83a0, 0xf886d027),
+	TOBN(0x4c8957aa, 0x7e83e9db), TOBN(0x5fdce561, 0xc62a19fa),
+	TOBN(0x941a593d, 0x43468135), TOBN(0x3492433f, 0x8bf4dd93),
+	TOBN(0xeeddae50, 0x470a24bf), TOBN(0xcc7c6799, 0x2caabde4),
+	TOBN(0xfaf9fd3e, 0x4f08ee98), TOBN(0xa04938dd, 0x5cbdcac6),
+	TOBN(0x5380cd33, 0x6bcdf8e9), TOBN(0xb89b3797, 0x11b4b318),
+	TOBN(0x92bb4e22, 0x7c1ce39f), TOBN(0x9b2d76da, 0x8c21d385),
+	TOBN(0xedde87a8, 0x24ed2264), TOBN(0x25204632, 0x72223f21),
+	TOBN(0x26695ab8, 0x932d5e45), TOBN(0x17db8b6f, 0x171e5280),
+	TOBN(0xc13a0dfe, 0xc9e625d6), TOBN(0x5cba5832, 0xbb885c17),
+	TOBN(0x7aba758d, 0xc0eb8aab), TOBN(0xfea0663b, 0x3a8d2deb),
+	TOBN(0xd584b284, 0xe905a665), TOBN(0xd91a3a7b, 0x05261edc),
+	TOBN(0x4a022d1d, 0x621b7f2b), TOBN(0x3486d78d, 0xb90586c4),
+	TOBN(0xbb88d5e0, 0x4034ce09), TOBN(0xc7004e21, 0x42aef8b4),
+	TOBN(0x145ea759, 0x6bfcb62e), TOBN(0x53cf3c9f, 0x7d556d10),
+	TOBN(0x0ac1a0de, 0x25d54a36), TOBN(0x268afdea, 0xe29c3737),
+	TOBN(0x3e049f14, 0x250b1a28), TOBN(0x560a6fec, 0x036aeda1),
+	TOBN(0x02b0c0de, 0x2f263057), TOBN(0xec392723, 0x51dfe4a1),
+	TOBN(0x5453487d, 0xc83672c5), TOBN(0x5a7c6dbb, 0x8b580bd7),
+	TOBN(0xeb500df8, 0xe09b1bfe), TOBN(0xf433d7ab, 0x7630e607),
+	TOBN(0x08ae3467, 0x549cf5c7), TOBN(0xb3e6bfe9, 0x954f9703),
+	TOBN(0xd8b722f6, 0x5706016d), TOBN(0x55f0df3e, 0xe26c1f1d),
+	TOBN(0x96c4d667, 0x8bd80863), TOBN(0x7a6fe2ab, 0x5f07393c),
+	TOBN(0x382b9a1c, 0x9b5d2ce4), TOBN(0xdaf211ae, 0x6e814550),
+	TOBN(0x35e9a797, 0x2b7eae49), TOBN(0x475889bb, 0xef233955),
+	TOBN(0x213fa448, 0xeb654d3e), TOBN(0x9ecdbb6e, 0xbe0a6448),
+	TOBN(0x4389d1a3, 0xaac262e9), TOBN(0xb34f5136, 0xc60c2652),
+	TOBN(0x67c92d33, 0xe2f7b456), TOBN(0xd6f18c8a, 0x24c31d8d),
+	TOBN(0xd786e702, 0x0fd87030), TOBN(0xcc8271d2, 0xc7990c90),
+	TOBN(0xd08d8fbd, 0xae6a7f49), TOBN(0xa9fbe57f, 0xaeb39156),
+	TOBN(0xfaf1b6f3, 0xfeb742c1), TOBN(0xc1f2639e, 0xa68ef864),
+	TOBN(0x97ab2d43, 0x5e930538), TOBN(0x5984ac95, 0x0171ec9a),
+    },
+    {
+	TOBN(0x6e47eacb, 0x9c170d4a), TOBN(0xda769823, 0xe91e6774),
+	TOBN(0x5dc6abce, 0x2031312f), TOBN(0x27436758, 0x5b8f8717),
+	TOBN(0xca2c9388, 0xb74d0c7e), TOBN(0x207d4521, 0x52f7b6eb),
+	TOBN(0x0f37101b, 0xcc3c80f8), TOBN(0x4e4526fc, 0xf38d4332),
+	TOBN(0x7cad2f65, 0xe550b7da), TOBN(0x7f3b4ce3, 0x2e851af7),
+	TOBN(0x0a0996da, 0xb28e4bcc), TOBN(0x9efe6b28, 0x1efe3632),
+	TOBN(0x18d27169, 0x413e43bb), TOBN(0x0554e28c, 0xebd02c94),
+	TOBN(0xa4333133, 0xd618b602), TOBN(0x5f39195b, 0xa6a82048),
+	TOBN(0xaa08b06f, 0xffc811ef), TOBN(0xfe851c0f, 0x745473ea),
+	TOBN(0xf0219696, 0xa812799b), TOBN(0x4a96fd23, 0x0f44b76e),
+	TOBN(0x777cd06f, 0xcbd1a0f1), TOBN(0xcdee2cdf, 0xdbde8d6b),
+	TOBN(0x381d34a8, 0x05f804a2), TOBN(0x216a80ac, 0x9033d9ad),
+	TOBN(0xceb8954f, 0xceb8c1b8), TOBN(0xf5cb7e86, 0x21450d62),
+	TOBN(0xdda3a830, 0x29890af2), TOBN(0x8bbfff39, 0x4663888b),
+	TOBN(0x7d92dd07, 0xf0508279), TOBN(0x7d0f167f, 0x631e3864),
+	TOBN(0x5a97f6ce, 0x3c89f610), TOBN(0x19db323e, 0x5646c346),
+	TOBN(0x6279c0dd, 0xc7c2c974), TOBN(0x2d5daf7a, 0x2a31f9ed),
+	TOBN(0xbd491e43, 0x9fe95685), TOBN(0x8237f72d, 0x1b39f876),
+	TOBN(0x8f081da9, 0xc4d18338), TOBN(0xb893a819, 0xcd4622fd),
+	TOBN(0xbe8f4c4c, 0xe00395f2), TOBN(0x75d77085, 0xe1a11ba3),
+	TOBN(0x2f54198b, 0xec9d4e23), TOBN(0xb4a9b0dd, 0x674cd8c6),
+	TOBN(0xc23cf602, 0x661ecbc1), TOBN(0x1079f6d1, 0x51281e99),
+	TOBN(0xdff65f19, 0x28626b0b), TOBN(0xd41423a3, 0x4fa17358),
+	TOBN(0xf18f2506, 0x0c69fb73), TOBN(0xf15afe02, 0x6673cad8),
+	TOBN(0x02ba110c, 0xf96fde54), TOBN(0x9b67bf66, 0xfa0f01e4),
+	TOBN(0x7d9f59f8, 0x3839cd43), TOBN(0xa5f31994, 0x85bf32a2),
+	TOBN(0xb2963b34, 0xa45dca53), TOBN(0x600e04ed, 0x612c0b1a),
+	TOBN(0x8eb6d4a5, 0xfcf0ee12), TOBN(0x0923e85a, 0xc6d26929),
+	TOBN(0x31031e79, 0x141baada), TOBN(0x942fb17a, 0x941413c8),
+	TOBN(0x6ddd689e, 0x5f4d9556), TOBN(0x70cf8015, 0x10cf954c),
+	TOBN(0xc216a6c3, 0x05f360a9), TOBN(0x81e158b7, 0x1ac079dd),
+	TOBN(0xd6a99b5d, 0x693bf273), TOBN(0x169212cf, 0x160d55c4),
+    },
+    {
+	TOBN(0xe785860b, 0xa6b86ac0), TOBN(0xbeda0c0a, 0xa95fa030),
+	TOBN(0x6a25b379, 0x2eaa9997), TOBN(0xea5cc167, 0x6b77d5a5),
+	TOBN(0x701adeca, 0x07dcda87), TOBN(0x88c305e0, 0x995bfdf7),
+	TOBN(0xb2b02804, 0x0c40d683), TOBN(0xf47e43c7, 0xc957b1e9),
+	TOBN(0xc15d47f2, 0x307683a2), TOBN(0xa7e7883f, 0xba2cf3c5),
+	TOBN(0xc91290f3, 0x7211e4c8), TOBN(0x6b521e1d, 0x561bf81c),
+	TOBN(0x9931ea7b, 0x1dd84b53), TOBN(0x5d054a02, 0x588103a0),
+	TOBN(0x2d08beba, 0x19731391), TOBN(0x34ca5f6e, 0xf20e10f7),
+	TOBN(0x3ceba8b0, 0xfac9e6db), TOBN(0x8ea1057b, 0xcebcc93c),
+	TOBN(0xf569e74e, 0x353fb8d3), TOBN(0xc4dec356, 0xb74fba10),
+	TOBN(0xe453230c, 0xff165592), TOBN(0x3e1bfd2d, 0x1c5c9028),
+	TOBN(0x8eb17f7c, 0x6d0cc0d2), TOBN(0x93d27c34, 0xef7ba293),
+	TOBN(0x7585212e, 0x25be7af7), TOBN(0x20b3c8e2, 0x76fd9d5c),
+	TOBN(0xcaa6d268, 0x01ee9089), TOBN(0x30befb65, 0x7fae79bf),
+	TOBN(0x9428cc70, 0xa72ccbda), TOBN(0x18a732b4, 0x96ea2a10),
+	TOBN(0x80f027a9, 0xf48ab0ce), TOBN(0x147e234d, 0x8da441da),
+	TOBN(0xee191ecc, 0x2235d3bc), TOBN(0x46ac2685, 0xa9908cba),
+	TOBN(0x7fb85f12, 0x6b451b2b), TOBN(0xdc88f377, 0xc1e571f8),
+	TOBN(0xa66173fb, 0xd6c8aeea), TOBN(0x7e840b03, 0x2555fe41),
+	TOBN(0x433f8a74, 0x89c2a47c), TOBN(0xcd363f57, 0x842098d3),
+	TOBN(0x53af3299, 0x32af59da), TOBN(0x576609e7, 0x67e45ff4),
+	TOBN(0xb9594319, 0xd723d2ab), TOBN(0xd9d71052, 0xc9efeca6),
+	TOBN(0xa4704a3f, 0x023906d5), TOBN(0x285d9e3a, 0xd8ffa570),
+	TOBN(0x52b6c67c, 0x95bb2ab0), TOBN(0x4222ac3f, 0x0b3ec740),
+	TOBN(0xfcbe0fc7, 0x932ec37b), TOBN(0x914ac50b, 0x76281c78),
+	TOBN(0xc383e6dd, 0x78cc7d94), TOBN(0x438e6485, 0x55821f95),
+	TOBN(0xdc5dfa15, 0x8cb62e7c), TOBN(0x2f441679, 0x1d9c66b1),
+	TOBN(0xbc892acc, 0xeef4b87a), TOBN(0x260c0202, 0x9ed372a1),
+	TOBN(0x240eeaef, 0xa3cbc1f0), TOBN(0xbad49a57, 0xf3a2f6e0),
+	TOBN(0x3ef7c00f, 0x59a76306), TOBN(0x400eff6e, 0x3652f60c),
+	TOBN(0xe34b1f06, 0xb88a8c34), TOBN(0xdf27fbc8, 0x3bb1b0a6),
+	TOBN(0xce8eb543, 0x0b980a73), TOBN(0x94f9967b, 0x25c15028),
+    },
+    {
+	TOBN(0x26c6e347, 0xcd53f50b), TOBN(0x37695c26, 0xddc3d6bb),
+	TOBN(0x9e4e15bb, 0xf2006fb5), TOBN(0x8e82b26f, 0x43c72c6f),
+	TOBN(0x6248a2c7, 0x7bf305f3), TOBN(0xdec9fbdf, 0xe8116e8a),
+	TOBN(0xe4906997, 0x5236f2fe), TOBN(0x21d76cb1, 0x4f9491bb),
+	TOBN(0x72fa663b, 0x1dd0a915), TOBN(0x68cbfe4f, 0xf51f39d5),
+	TOBN(0x793555e7, 0xd24d0f41), TOBN(0xbc0344b1, 0x96aacdfd),
+	TOBN(0x4396df5f, 0xa60bc67c), TOBN(0x10361a28, 0x9ef95909),
+	TOBN(0x4535fe0a, 0x41c6bf83), TOBN(0x2234394f, 0xa0370b33),
+	TOBN(0x275761df, 0x2a8e71f3), TOBN(0xa4947be4, 0x010808fb),
+	TOBN(0x34ecfe91, 0x21b21dad), TOBN(0x06de3f22, 0x83021ea6),
+	TOBN(0x968b4cf7, 0xefc254d0), TOBN(0x91ead2c2, 0xe2b42a1e),
+	TOBN(0xaf31a19d, 0x9cafae97), TOBN(0x5f0e39da, 0xeffd7b05),
+	TOBN(0xa84762b6, 0xe75d1f15), TOBN(0x75cd828e, 0x3bd07135),
+	TOBN(0x0cb70cb4, 0x09eeb5e2), TOBN(0x3b4d18b7, 0xb74553bb),
+	TOBN(0xa4e3890c, 0x97e615e8), TOBN(0xb9faa8b3, 0x9a18e9bd),
+	TOBN(0x2c0b51ee, 0x19900d20), TOBN(0x7f3ca7a2, 0xb61151da),
+	TOBN(0x81a5f1e7, 0x803fa42a), TOBN(0x7b3e1646, 0x1e18e025),
+	TOBN(0x4d358c92, 0x28b6fe22), TOBN(0xd981a577, 0x02132ccb),
+	TOBN(0xc1f54487, 0x3a6b623e), TOBN(0x74a396ae, 0xd434848b),
+	TOBN(0xb491beca, 0x0818114f), TOBN(0x2ab0a4ce, 0x8f61b9ba),
+	TOBN(0xa48d3b5a, 0xc806b0b6), TOBN(0xd4c8a93e, 0x423a2869),
+	TOBN(0xd64a869c, 0x6a224238), TOBN(0xfe0f8d5a, 0x86c8129d),
+	TOBN(0x9a3ba518, 0x423d9241), TOBN(0x96ac964e, 0xfca716c5),
+	TOBN(0x28a3fd3b, 0xe0356491), TOBN(0xd79e0f62, 0x8492cce5),
+	TOBN(0x4213b388, 0x7f319f2e), TOBN(0x3b4c7e71, 0xb5954d4b),
+	TOBN(0x3d967293, 0x517e013d), TOBN(0xfa29ccfd, 0xe9cc3e3d),
+	TOBN(0xb31551e5, 0xa11ea646), TOBN(0x135588b7, 0xea257c3f),
+	TOBN(0xe24fecb4, 0x7cac510d), TOBN(0x76b0b04c, 0xaa0389bf),
+	TOBN(0xe3796500, 0xccf071fc), TOBN(0x62d9686e, 0x90ce4088),
+	TOBN(0x3e9e5222, 0xf121923f), TOBN(0x8682d498, 0xb6b5bf1c),
+	TOBN(0x5138ee6f, 0x603e9f0e), TOBN(0x4a978f46, 0xb49a88c3),
+	TOBN(0xc42ea0f1, 0xb9970a82), TOBN(0x92e99660, 0x560b2c43),
+    },
+    {
+	TOBN(0xe3259868, 0x089eb9e4), TOBN(0x4efecb37, 0xacf2d63f),
+	TOBN(0x044ea2ab, 0x7a46bd4d), TOBN(0xcc45e2ef, 0x1c9d4926),
+	TOBN(0xc9cf6737, 0xca0e2671), TOBN(0xfc7b1375, 0x40aa7457),
+	TOBN(0x0dbf72ea, 0x7188d594), TOBN(0x7ad961e4, 0x09089f22),
+	TOBN(0xe14f728c, 0x221081f3), TOBN(0x6ab03c05, 0x3d375d19),
+	TOBN(0xce522745, 0x1f9676d2), TOBN(0xaee1b847, 0x3ef8c372),
+	TOBN(0x309f9605, 0x5fd0c5cd), TOBN(0xd2435abd, 0xdd786f8d),
+	TOBN(0x0d17c686, 0x9dcc3059), TOBN(0xe8d2b391, 0xf167cfd1),
+	TOBN(0xe5e16431, 0x2c6d9604), TOBN(0x5188d599, 0x41c27a22),
+	TOBN(0xc843a872, 0x4dd7154c), TOBN(0x3f55ed05, 0x6eecd7fa),
+	TOBN(0x4b806fd7, 0xa687b2c2), TOBN(0xf5408b34, 0x79325861),
+	TOBN(0xb0b19403, 0x12e69712), TOBN(0x1283c10e, 0xecdfe0d1),
+	TOBN(0x2f9de289, 0x5c2ee122), TOBN(0x068daee0, 0xd70c9f9d),
+	TOBN(0x64fd7f74, 0xddde96e9), TOBN(0x18126d6d, 0xf557d856),
+	TOBN(0x9e78d907, 0x6a434298), TOBN(0x44bbd297, 0x54fe5053),
+	TOBN(0x3eaf6750, 0xd8002640), TOBN(0xcf3af35e, 0x4d4dcf11),
+	TOBN(0x44390e73, 0x5ede6e73), TOBN(0xa0079cd0, 0x2fe6c55c),
+	TOBN(0xb24f517a, 0xf05968cd), TOBN(0x9d8824cc, 0xde692063),
+	TOBN(0x3c4f5caa, 0x941c1367), TOBN(0xbbbb677f, 0xf4a56af9),
+	TOBN(0x72ec37a5, 0xd8dde701), TOBN(0x4a983b1c, 0x8f7b046b),
+	TOBN(0x396672c0, 0x485c8ffb), TOBN(0x3f85bd48, 0x64ecb315),
+	TOBN(0x2b370af4, 0xbf5cdb81), TOBN(0xe472c6dc, 0xfd839e42),
+	TOBN(0x36fb23f6, 0x8ca70228), TOBN(0xc6a7027a, 0x2cdfa7ac),
+	TOBN(0x067d5e6c, 0xf6148697), TOBN(0xaad80a51, 0x47952bb9),
+	TOBN(0x415a7871, 0xa63b2ad8), TOBN(0x75334d30, 0xbcf1f9a0),
+	TOBN(0x2423a136, 0x49669e8d), TOBN(0xe1810609, 0x32d7f997),
+	TOBN(0xdd25a7ad, 0xf90c778c), TOBN(0x0a175499, 0x8a7ee0a3),
+	TOBN(0x6d134071, 0x7988a4f2), TOBN(0x36dfbec3, 0x89765956),
+	TOBN(0xf62bf436, 0x0a439de3), TOBN(0xe1708b58, 0x20551ca5),
+	TOBN(0xcd349f96, 0xb6a47275), TOBN(0x75818a45, 0x2b9c01bc),
+	TOBN(0x58ef33dd, 0xdb6f47b7), TOBN(0xcbee9271, 0x7d2fd29c),
+	TOBN(0x92670f19, 0xe4dabb25), TOBN(0xf45655c8, 0xe0abcd9c),
+    },
+    {
+	TOBN(0x4db5cd7e, 0x5434d3a6), TOBN(0x3d037d50, 0x4563f643),
+	TOBN(0x52c1e5c0, 0x2f91c78f), TOBN(0xd5143df2, 0xc8679aaf),
+	TOBN(0xd4845ffa, 0xcbc08c41), TOBN(0x91dc3833, 0xaaac8d07),
+	TOBN(0x88c3f889, 0x4fbc0454), TOBN(0x10825445, 0xf0f677e8),
+	TOBN(0xefdfc19d, 0x074b10af), TOBN(0x37ad0577, 0xe9e21a01),
+	TOBN(0x6329f755, 0x24eea649), TOBN(0xc877b74e, 0x11f67a63),
+	TOBN(0xb6217221, 0xbb2a9b8a), TOBN(0x70ebd6ab, 0xeb45af2a),
+	TOBN(0xbd4d5f79, 0xb410d98e), TOBN(0xa9e15224, 0x3690a980),
+	TOBN(0x54140513, 0x7f2ed364), TOBN(0xd8b75bd4, 0xcbc8abc9),
+	TOBN(0x60c05281, 0xa69353c4), TOBN(0x35149800, 0xe9606087),
+	TOBN(0xd0d80ab1, 0xc5316444), TOBN(0xb1cb7c76, 0xe0907721),
+	TOBN(0x5fdfc5b6, 0x9378cb79), TOBN(0x4760d0aa, 0xa54a4bf4),
+	TOBN(0x926b1b0e, 0x549704fd), TOBN(0xb4716d2f, 0x73b19666),
+	TOBN(0x24a5fe15, 0xbe91b0ad), TOBN(0xc2e40539, 0xb1b6514f),
+	TOBN(0x8648e1ef, 0xe1a97312), TOBN(0xf6bbc431, 0x69da382b),
+	TOBN(0x3e818e82, 0xf3649e3a), TOBN(0x7f50a84a, 0x68ab0c40),
+	TOBN(0x9cfe267d, 0x6256532a), TOBN(0xb06c54de, 0xa2e7b252),
+	TOBN(0x95eb7b05, 0x0b5601d3), TOBN(0x7655a0b1, 0x6167646a),
+	TOBN(0xed28755a, 0xf08b320f), TOBN(0x6be98f26, 0x9bd25fb4),
+	TOBN(0x4fe0db82, 0x55f1c69b), TOBN(0x473ac7a9, 0xbf202033),
+	TOBN(0x576e5839, 0xeeda39c3), TOBN(0x3cc8b38c, 0x0f166f24),
+	TOBN(0x009331eb, 0xa36c4c2c), TOBN(0x6f625daa, 0xb12ddda7),
+	TOBN(0x30659365, 0x996b9513), TOBN(0x4bfba7d5, 0xa49a9fdb),
+	TOBN(0x48b9ebc4, 0x2be35ba5), TOBN(0xd68dad30, 0xa01703a0),
+	TOBN(0xb07b33e3, 0x41bd8ae9), TOBN(0x87a456e0, 0xdc23eaf9),
+	TOBN(0x93a4a977, 0x90de6f5e), TOBN(0xa4bb9a37, 0x28fba683),
+	TOBN(0x141bf8a4, 0xc4d8a4c1), TOBN(0x36977376, 0x61c82343),
+	TOBN(0x67d4fbe6, 0xca0a0b53), TOBN(0xffea393a, 0x71d56c3a),
+	TOBN(0xe846b15e, 0xfecc0d30), TOBN(0x7024be45, 0x188e7154),
+	TOBN(0x0a9b19de, 0x7547465b), TOBN(0x31c65538, 0x6f45c68a),
+	TOBN(0x8ffb1f7d, 0x93e62bb3), TOBN(0xca419057, 0xe5de42e7),
+	TOBN(0x852bb1a1, 0x90910919), TOBN(0x49082c52, 0xb895e6e0),
+    },
+    {
+	TOBN(0x88df5e4f, 0xf04a98d4), TOBN(0x85d06fc7, 0xf654a589),
+	TOBN(0x7dba9c62, 0xb3d12d1b), TOBN(0xe68c74a6, 0x0b689371),
+	TOBN(0x3cf524f3, 0x533d4a72), TOBN(0x9045bd48, 0xc2ddd6d1),
+	TOBN(0x28542368, 0x7d4fb6cc), TOBN(0xc3f5f299, 0x21aee31a),
+	TOBN(0x5a222dd4, 0x0c87f8c0), TOBN(0xfae6e098, 0x6a70884a),
+	TOBN(0x0a4a0118, 0x9968c5d0), TOBN(0x205e1254, 0xae3a2d2c),
+	TOBN(0x189bcc95, 0x3e5bfa4a), TOBN(0xfb4a2ab7, 0x55e434d5),
+	TOBN(0x19a987fd, 0x01d48961), TOBN(0x81148f63, 0xe95e0457),
+	TOBN(0xf9929b68, 0xb228a4e1), TOBN(0x9186b814, 0xfc50a569),
+	TOBN(0x8dd8926c, 0xe5228884), TOBN(0x1dd0ee8f, 0x35d8fd41),
+	TOBN(0xb117afd2, 0x7ac355aa), TOBN(0x341cf004, 0x74489fe2),
+	TOBN(0xb12ffa83, 0x2aa4b5d2), TOBN(0xb91a6253, 0xc2cdb184),
+	TOBN(0x43409d00, 0x61c960ce), TOBN(0x0aefeb05, 0x89d98ba7),
+	TOBN(0x6766f6a6, 0xec428671), TOBN(0x96735b42, 0xe1614397),
+	TOBN(0x70c6953d, 0x9a6fcdf3), TOBN(0x1fc78e91, 0xddf0cd2c),
+	TOBN(0x51cfbd1c, 0xdbeee621), TOBN(0x89106ce3, 0xb13a8765),
+	TOBN(0x455b493e, 0xab8fd172), TOBN(0x73571ad9, 0xe6e285a0),
+	TOBN(0xbaf11aa4, 0x78987b87), TOBN(0x4692fad0, 0x433953a8),
+	TOBN(0x51265d03, 0x246302f0), TOBN(0xa8146899, 0xe4951ad0),
+	TOBN(0x5b18494c, 0x6fe1998d), TOBN(0xf4200e87, 0xc63889ff),
+	TOBN(0x51a76585, 0x706d1344), TOBN(0x7e07bc06, 0xa0128e22),
+	TOBN(0x96be6d12, 0x0307ece5), TOBN(0xa173f1f7, 0x7dd13614),
+	TOBN(0xdc6176a9, 0xde252bbe), TOBN(0xd64b6745, 0x38dbce6c),
+	TOBN(0x17c1d648, 0xc421d1ce), TOBN(0x482e6f68, 0x2603ce93),
+	TOBN(0x1c973b34, 0xdd884c6c), TOBN(0x0c318d5d, 0x01bdddec),
+	TOBN(0xc5e06c15, 0x96e54d30), TOBN(0xcbdabfc1, 0x448d920f),
+	TOBN(0xcbaa9342, 0xc2d36f35), TOBN(0xf3f7afa6, 0x4b9f9385),
+	TOBN(0x25fb3377, 0x442316c9), TOBN(0x24e5ac91, 0x84f9c0d6),
+	TOBN(0xc11d4b86, 0x716775b7), TOBN(0x8bec571f, 0x9357a472),
+	TOBN(0xdd1382ce, 0x18dc9e76), TOBN(0x934c2b2b, 0xd820c5cd),
+	TOBN(0x73225195, 0xd93b3db3), TOBN(0x6277b6a4, 0x411101a7),
+	TOBN(0x70ef2d05, 0xf609582a), TOBN(0x48acad1f, 0xaf3bdaf1),
+    },
+    {
+	TOBN(0x62e3a89d, 0x4db304a4), TOBN(0x6b3f3937, 0x9619b4a4),
+	TOBN(0x7a275519, 0x7b50c3d4), TOBN(0x70a86999, 0xde6dba2d),
+	TOBN(0x0a36f34d, 0x15e9fb72), TOBN(0x54896b93, 0xfc0dc0e3),
+	TOBN(0x715e639b, 0x68b6a75d), TOBN(0x65606958, 0xe516c970),
+	TOBN(0x6bdf9141, 0xf72f2a7e), TOBN(0xd12e2f13, 0xf2cf034b),
+	TOBN(0x37a66058, 0x086c8bc0), TOBN(0x49a518d1, 0x75aab9a7),
+	TOBN(0x61014a7b, 0x0e628021), TOBN(0x08c0e6c3, 0xb05719c5),
+	TOBN(0x06703256, 0x037a8ad0), TOBN(0x4cc0b5bc, 0x0713cd19),
+	TOBN(0x76955608, 0x037361e1), TOBN(0xf8694971, 0xf470f69e),
+	TOBN(0x68a611f1, 0x957d5fe4), TOBN(0x1167f7db, 0x59d7c41a),
+	TOBN(0x18937930, 0x45be34c3), TOBN(0x24dc002f, 0x76a686cd),
+	TOBN(0xde43b0af, 0x540249ee), TOBN(0xc8fa0699, 0x3903d6ce),
+	TOBN(0xf8952db4, 0xf20307aa), TOBN(0x1af86a0b, 0xae89a67c),
+	TOBN(0x4856675d, 0x83eb8526), TOBN(0xf5e75243, 0xeb66576f),
+	TOBN(0x7a7f93a9, 0xd79f69f9), TOBN(0x21999b6c, 0xbc94583c),
+	TOBN(0x0efeb87b, 0xa084de66), TOBN(0x7a1377c4, 0xb4432778),
+	TOBN(0xd55183fb, 0x1437ab68), TOBN(0x97c8a9a0, 0x2f58372a),
+	TOBN(0x2ad17ed9, 0x91696b70), TOBN(0x59546661, 0x9cb19ecd),
+	TOBN(0x35051d5e, 0x602011f5), TOBN(0x60927b9c, 0x938859a5),
+	TOBN(0x36e67077, 0x9ab36131), TOBN(0xdde9e373, 0x25455441),
+	TOBN(0xc3be6c45, 0xe7b4a5ba), TOBN(0x0ae239d1, 0xaa04e0b2),
+	TOBN(0x43f0f8dc, 0x021ecbe7), TOBN(0xa41dbbee, 0x6e509558),
+	TOBN(0x9df5c471, 0xe9b023b4), TOBN(0xad8372c9, 0xf7686ec5),
+	TOBN(0x9bf2ccc5, 0x6ea834b4), TOBN(0x08d32c8a, 0x7c758453),
+	TOBN(0x3e7f8534, 0xafbc703f), TOBN(0xf3ad9a13, 0x561bca3a),
+	TOBN(0x44d51f94, 0x7c346950), TOBN(0xb9c108ab, 0x4a2fb88f),
+	TOBN(0x5f2e1175, 0xdb64fed9), TOBN(0x4a94a483, 0x5f07d6be),
+	TOBN(0x72f24b7d, 0x888bf692), TOBN(0x80c9a8d6, 0xc1526ba1),
+	TOBN(0x16229efb, 0x87c6218b), TOBN(0x2d9b51de, 0x1654bc7b),
+	TOBN(0x78c88009, 0x247ffdb4), TOBN(0x79311a78, 0x1bd60bef),
+	TOBN(0x33df1494, 0x7e62ffcd), TOBN(0xde03b58c, 0x1c724e38),
+	TOBN(0xbe783721, 0x9030a294), TOBN(0x88745bbe, 0xc1bcd001),
+    },
+    {
+	TOBN(0x132bc81a, 0x0d5a0c27), TOBN(0x394c9ed0, 0xdad09948),
+	TOBN(0xdb10546e, 0xf944b96b), TOBN(0x894783e9, 0x5d02f897),
+	TOBN(0x4fef7319, 0xf79498bb), TOBN(0x750dbf9a, 0xc2d27660),
+	TOBN(0xe76ab303, 0x99ac70df), TOBN(0x93a83fcc, 0xfed84702),
+	TOBN(0x3b91b019, 0xf108815d), TOBN(0x19309617, 0xdac95e56),
+	TOBN(0x8e2c4029, 0x7c78bbc9), TOBN(0x77566f3d, 0x2b63357f),
+	TOBN(0x2e4f1fca, 0x382657e3), TOBN(0xbf6be741, 0xad97b41d),
+	TOBN(0xf48c65f8, 0x323cd3e9), TOBN(0x1dacf80c, 0xb5b44a2e),
+	TOBN(0x558a2514, 0x26ef7e19), TOBN(0x1b4418c2, 0x56ad35f0),
+	TOBN(0xbd88189c, 0x616eac68), TOBN(0xe4d6efc0, 0x358a0d3b),
+	TOBN(0x8eb4641b, 0x70306461), TOBN(0x010eb24b, 0xe7b4637b),
+	TOBN(0xf7364b86, 0xcb127494), TOBN(0x7a107895, 0xa5f8232d),
+	TOBN(0x2d0d3cf2, 0x9830bf93), TOBN(0x1f37a6b2, 0x4de7f2b8),
+	TOBN(0xa446efe6, 0x79d676c5), TOBN(0x7db092d0, 0xa80eb59c),
+	TOBN(0x89fba8f4, 0xc3ecd39d), TOBN(0x3a59ac40, 0xeeaa669d),
+	TOBN(0xe14490ca, 0xfe925fad), TOBN(0x01ffaf25, 0xa2797967),
+	TOBN(0x2e4c1410, 0x603ac777), TOBN(0x3d725b1f, 0x873d9447),
+	TOBN(0xa46c598b, 0x8bff17fc), TOBN(0x22e8770f, 0xc1327e31),
+	TOBN(0x2f36ed87, 0xb44c7f79), TOBN(0x0b3c0e10, 0x80308355),
+	TOBN(0x7e192d02, 0xa0b43630), TOBN(0xb9e04924, 0x5374407c),
+	TOBN(0xa53285e7, 0xb1c4feef), TOBN(0x53dceb00, 0xb9ad1203),
+	TOBN(0x54b57a00, 0x25fff5e1), TOBN(0x06d12c07, 0x39053112),
+	TOBN(0xc2740521, 0xbe0cb19e), TOBN(0xd6e96ac5, 0xd2834582),
+	TOBN(0x8c2c435d, 0xda13e510), TOBN(0xb20355f3, 0x910975d4),
+	TOBN(0x7b3fbfa2, 0x345f1f41), TOBN(0x9ef940c9, 0xe16730ca),
+	TOBN(0xfd010717, 0x02fa9162), TOBN(0x22f9a2f0, 0x91c5d714),
+	TOBN(0x9e3a413d, 0xcd9454fc), TOBN(0x8aeae8bb, 0x05121b2b),
+	TOBN(0xa2da38bd, 0xde648241), TOBN(0x2796e7d4, 0xeb900aa5),
+	TOBN(0x1e672da6, 0x1418ef66), TOBN(0xe44892aa, 0xb5611e42),
+	TOBN(0x9862e4a3, 0x8ce89d30), TOBN(0x1daff9c6, 0x4316d9d9),
+	TOBN(0xb46b2467, 0x8c7035a4), TOBN(0xf6ffbd80, 0x551499bf),
+	TOBN(0xb833804a, 0x950af190), TOBN(0x69e3d2c2, 0x631ca065),
+    },
+    {
+	TOBN(0xc8525474, 0x02590cd7), TOBN(0xaf0afe72, 0x0faa4f1b),
+	TOBN(0x43563efd, 0x14cb77aa), TOBN(0x6aecde95, 0xe1a96393),
+	TOBN(0x9373b502, 0x41ecaa8d), TOBN(0x10b12c1c, 0xf998a412),
+	TOBN(0xbb405433, 0x6c3f402c), TOBN(0x841b89f4, 0x1daec56f),
+	TOBN(0x1f5cedd0, 0x0be657b8), TOBN(0xe8809644, 0x9ac2c193),
+	TOBN(0x061d2ac8, 0x36dcad72), TOBN(0xd6c30b3e, 0x635793a6),
+	TOBN(0x9933bc6a, 0xea93be89), TOBN(0xa0e7666f, 0x1e65a676),
+	TOBN(0x70ae21cf, 0x5bca1ccb), TOBN(0xea2e3600, 0xe62d1275),
+	TOBN(0xf55a71f9, 0x9c42ee76), TOBN(0xa871af6d, 0x9bb91d61),
+	TOBN(0x2196d4d4, 0x3ca9e2d4), TOBN(0x9db495df, 0x5963b0d3),
+	TOBN(0xebc1bf18, 0x817cb5ce), TOBN(0xa0f583f2, 0x409379da),
+	TOBN(0xf8bb8c40, 0xeccfd8d7), TOBN(0xed77f379, 0x6e777d16),
+	TOBN(0x1b052c6b, 0x765afcdb), TOBN(0xa5c1d1bc, 0x4eb0ba6a),
+	TOBN(0xb51b91fd, 0xafde2aa5), TOBN(0x77a10abe, 0x8ae23960),
+	TOBN(0x9aa91296, 0x61595f35), TOBN(0x8e40a858, 0x0cd76c80),
+	TOBN(0xe9afddd7, 0x8b161712), TOBN(0x28cc113a, 0xfa852b51),
+	TOBN(0xd49b2a71, 0x626526f6), TOBN(0x9265a98f, 0x78165206),
+	TOBN(0xe3f70cf6, 0xd91b56b9), TOBN(0x276ceeb9, 0x5863baed),
+	TOBN(0x2c155e54, 0x3b8cc11b), TOBN(0x88ad29a9, 0xd63baf23),
+	TOBN(0x50b43e1f, 0x355555ca), TOBN(0x4ef55cd7, 0xfb855c29),
+	TOBN(0xcc6ec142, 0xe9480b9a), TOBN(0xb475c66b, 0x716ad08b),
+	TOBN(0x5e558fd7, 0xc4940801), TOBN(0x91cf6727, 0xa7a300d8),
+	TOBN(0x4d5df764, 0x3f9ac00e), TOBN(0x57ff207e, 0xdb24f2b2),
+	TOBN(0x182f4bf1, 0x0d6ae866), TOBN(0x219af7ee, 0xb493eb6b),
+	TOBN(0xf19a755a, 0xe0e904ce), TOBN(0x362dd39f, 0xd07b8265),
+	TOBN(0xab8a5e60, 0x5552325d), TOBN(0x5f562aa4, 0x80c4285d),
+	TOBN(0xefa1f9b4, 0xbae3eee7), TOBN(0x7e10e5cb, 0xaf0266fa),
+	TOBN(0x41177a62, 0x2177d9fe), TOBN(0xc05a6c1a, 0x8508c67e),
+	TOBN(0x2bdb1b07, 0xd359dccf), TOBN(0x1cbfca4b, 0x86a3697b),
+	TOBN(0x1fb8fcc3, 0x953a750d), TOBN(0xc8376538, 0xffc591d2),
+	TOBN(0x788f8b5f, 0x72d00ec6), TOBN(0x0cf23ed5, 0x1e93d7a4),
+	TOBN(0xf4fdf1df, 0x5d6021b4), TOBN(0x4d63450c, 0xefc4c47d),
+    },
+    {
+	TOBN(0xc5416bb5, 0x2187c9cc), TOBN(0xc8b78ee5, 0xa00bf952),
+	TOBN(0xc83d7d26, 0xb77f200b), TOBN(0x35435844, 0x52401ade),
+	TOBN(0x0ffa18d5, 0xb9582a18), TOBN(0xca390a6e, 0xfb7d1427),
+	TOBN(0xf7809cd4, 0xa39219fb), TOBN(0x977d46fa, 0xefe8fd45),
+	TOBN(0xea8976ec, 0xd25d7a0e), TOBN(0xb9e20ee5, 0x7d30d6c9),
+	TOBN(0x7dfb6519, 0x162dd509), TOBN(0xf18c7ccf, 0x35d9f8e4),
+	TOBN(0x285d5d1a, 0xf8e749b6), TOBN(0x759ab0b6, 0x3d025502),
+	TOBN(0xf598c581, 0x9070353d), TOBN(0x554d318d, 0xaaa8c3f9),
+	TOBN(0x4901354c, 0x884a1c09), TOBN(0xc73154c0, 0x547a04ba),
+	TOBN(0x11bdd832, 0xc6ac7e56), TOBN(0x4ba0a300, 0xeae1902d),
+	TOBN(0xe82b39fa, 0x91e160d8), TOBN(0xa8604a7d, 0xb49451c7),
+	TOBN(0x66fb8f7a, 0x27c67698), TOBN(0x47ccd91e, 0xeb945f29),
+	TOBN(0xae041b7e, 0x146a1f68), TOBN(0x4196dd1a, 0x1bb2527f),
+	TOBN(0x5c879800, 0x61b08983), TOBN(0x5d93c6a4, 0x1983b051),
+	TOBN(0xe3a64d86, 0x1176d9aa), TOBN(0x76901206, 0xcabe7b68),
+	TOBN(0xe17fbcd7, 0x3396b679), TOBN(0xc1923d4f, 0x7b3ffb3b),
+	TOBN(0x89f41c82, 0x86b379bc), TOBN(0xedd348ae, 0x923d6b73),
+	TOBN(0xb497aa9a, 0x6ab3cb07), TOBN(0xb542f38a, 0x69475023),
+	TOBN(0xc4b8a2bc, 0x3a25e521), TOBN(0x15836613, 0xac11e757),
+	TOBN(0x3196a2f9, 0x08cc31af), TOBN(0xa2ad95b9, 0xfa6920f6),
+	TOBN(0xc62ad22a, 0x68b0bfe2), TOBN(0xc6ce948a, 0xcadb555e),
+	TOBN(0x183089e6, 0x76907f93), TOBN(0x2255b6d7, 0xdb01cea4),
+	TOBN(0x69c4cf14, 0x385c838c), TOBN(0xb3a647bd, 0x1e4b87e1),
+	TOBN(0x192f3d6a, 0x76a9d1a6), TOBN(0x4109c2db, 0x44a5252e),
+	TOBN(0x1a96e0e9, 0x5d76a0b9), TOBN(0x06933f7e, 0x1e7873ed),
+	TOBN(0x0d20c3a1, 0xcc2c847b), TOBN(0x11dddca6, 0x6017c56a),
+	TOBN(0x185b7ce7, 0x8cd9c7ba), TOBN(0x0139528e, 0x5d665f2e),
+	TOBN(0x6ef8d546, 0x7e3d7a68), TOBN(0x95885b85, 0x3c25c053),
+	TOBN(0x241e74b2, 0x4808b47a), TOBN(0x39fb6148, 0x8a85f6b1),
+	TOBN(0xb6329d18, 0x055410fc), TOBN(0x82af0769, 0x5cbdd296),
+	TOBN(0x96ce352b, 0x20126e68), TOBN(0x5809ba02, 0x6f191c2d),
+	TOBN(0xfcb93146, 0x401de5fb), TOBN(0x843ae41e, 0x886cd2ac),
+    },
+    {
+	TOBN(0x8f115e75, 0xf574e387), TOBN(0x7f9c235b, 0x1ddcd088),
+	TOBN(0x51aa7499, 0x214f15a3), TOBN(0xb6c5547f, 0x727698dc),
+	TOBN(0xd3c79e7e, 0xcd504722), TOBN(0x6c3ea9c4, 0x72081b5e),
+	TOBN(0x412897f8, 0xe249a9c7), TOBN(0x974d76b8, 0x572fffa9),
+	TOBN(0x56b47a30, 0xf48e76dc), TOBN(0xa38eaa31, 0x77ace1b4),
+	TOBN(0x23f4158b, 0xfbd2b3fd), TOBN(0xc98569b9, 0x8e00e3ac),
+	TOBN(0xc7b1a6b3, 0x4f771f5b), TOBN(0x20cfab7a, 0xc815669c),
+	TOBN(0xa5afaf82, 0x8535a2ef), TOBN(0x5d637d67, 0x531986f5),
+	TOBN(0xe09ec111, 0xb228eb8a), TOBN(0x9a128262, 0xb12d97c2),
+	TOBN(0x6ea9bee5, 0x1c185ba1), TOBN(0x9801ef2b, 0x9f2c4528),
+	TOBN(0xac7acbe9, 0x93501b4d), TOBN(0x1a7e0480, 0x99e1c158),
+	TOBN(0x4c28611b, 0xbbaed001), TOBN(0x880cdb3c, 0x3b9d845c),
+	TOBN(0xeef1655f, 0x786b9cdb), TOBN(0x559e9750, 0x356d4710),
+	TOBN(0x362bd3ea, 0x490b9ca7), TOBN(0xdb753797, 0x0343b654),
+	TOBN(0xb4866457, 0xcf315b14), TOBN(0x1df9b09d, 0xe830245e),
+	TOBN(0x196b9402, 0x2841bbe9), TOBN(0xbfbbb317, 0x886e6a00),
+	TOBN(0xc3e2369e, 0xd8923ff4), TOBN(0xc98a5b06, 0x24f88be8),
+	TOBN(0x69387c4c, 0x3fb88438), TOBN(0x6ba0ac2f, 0x66f12bc4),
+	TOBN(0xc509b1f3, 0x14b5cc12), TOBN(0x507ef906, 0xcb04a8e1),
+	TOBN(0xf38e927c, 0xadefb4de), TOBN(0x2d0d2fe0, 0x801cb71e),
+	TOBN(0xb137b687, 0x77bd6c96), TOBN(0xe19a4901, 0x3f3755ec),
+	TOBN(0x605edc1c, 0xe9f5a927), TOBN(0xa3532ae9, 0x511a3bbb),
+	TOBN(0x6174be4a, 0xc5554269), TOBN(0xd39b8c5e, 0xb21a7b20),
+	TOBN(0xd174b2be, 0xadb1beb7), TOBN(0x52fc4ee9, 0x69e9de2f),
+	TOBN(0x2e86a48c, 0x0d843feb), TOBN(0xa130163d, 0x25cedcfd),
+	TOBN(0xea097052, 0x33ba2a8f), TOBN(0x6a361d0b, 0x6910cee7),
+	TOBN(0xd5bf95c2, 0x34251445), TOBN(0xc28f7cf6, 0xc22b5140),
+	TOBN(0xe9f94a62, 0xf77ac30f), TOBN(0x39f2d4e8, 0x71bb2c17),
+	TOBN(0x4c5932ca, 0x74eeac77), TOBN(0xd020678f, 0xf8e72948),
+	TOBN(0xa863ec61, 0xed5b0340), TOBN(0x3423c314, 0x5c0c4e2a),
+	TOBN(0xa70dd94f, 0x108d2ed4), TOBN(0x5a16c9c5, 0x36321174),
+	TOBN(0xd4a29d93, 0xe53bc0a7), TOBN(0x1600bf17, 0x823a15da),
+    },
+    {
+	TOBN(0x32c26990, 0x38fc7a4d), TOBN(0xaee6a71f, 0x60c353de),
+	TOBN(0x60c04c84, 0xe511773b), TOBN(0x161c9c81, 0xdbf75d06),
+	TOBN(0xfb76e57a, 0x7450ccde), TOBN(0xda6b30b0, 0x796d4b17),
+	TOBN(0x6dc66d53, 0x8ad40be8), TOBN(0x95bbd027, 0xc83293f9),
+	TOBN(0xb38b084f, 0xf9ac5a13), TOBN(0x4d0a1c95, 0xee140830),
+	TOBN(0x2fd754d3, 0xeb038eef), TOBN(0x282d1e3d, 0xdfd04b36),
+	TOBN(0x381f8a82, 0x98140ef5), TOBN(0xe534386c, 0x6ba79025),
+	TOBN(0x16b695b5, 0x63edda09), TOBN(0xb22e940a, 0xd510746f),
+	TOBN(0xc471757b, 0x910a061a), TOBN(0x38b8b9b9, 0x13dcdc3f),
+	TOBN(0x308edf24, 0x6b83fc29), TOBN(0xfbf76bb0, 0xb23b1fd7),
+	TOBN(0x093cad1d, 0x21346c7c), TOBN(0xde12a3c1, 0xbcd28944),
+	TOBN(0x01c47566, 0x37ade2e6), TOBN(0x2fd1b4e3, 0x9a1676e3),
+	TOBN(0x1c894919, 0xc2dc9053), TOBN(0x93eb6058, 0x8b521aa8),
+	TOBN(0xfdca58ae, 0xec9b0d6c), TOBN(0x881f64f3, 0x13f6d124),
+	TOBN(0xbf8cc94f, 0xf0edfd3d), TOBN(0x8f2530ec, 0x57812207),
+	TOBN(0xa4724ab2, 0x69c34bcb), TOBN(0x710aa376, 0x10de98b4),
+	TOBN(0x02ebd51b, 0xc88592b5), TOBN(0x3b86f26e, 0x458d7501),
+	TOBN(0x8d75fa6e, 0x60c972ce), TOBN(0x7ec425b7, 0x49cc90e6),
+	TOBN(0xdf632c2f, 0x610a6453), TOBN(0x79278e42, 0xb6b64557),
+	TOBN(0xefb5e9ff, 0xe053d7c8), TOBN(0x12df7cee, 0xb2dca00e),
+	TOBN(0x20ea2724, 0x1c5edb26), TOBN(0x13c9007b, 0x26de3221),
+	TOBN(0x6274d3e6, 0x9a56b8ae), TOBN(0x61152d68, 0x68d05af6),
+	TOBN(0x49f0e4c9, 0x4e5a8087), TOBN(0x57ad97e5, 0x4d0953a6),
+	TOBN(0x4a224ac4, 0xd0cb519a), TOBN(0xd3d0a08c, 0x7670aaae),
+	TOBN(0x743a6025, 0x31f527d9), TOBN(0x650eca43, 0x5e546286),
+	TOBN(0x2275b26d, 0x0bba41a3), TOBN(0xd35c8cd9, 0xf9fa9d24),
+	TOBN(0xb07771b0, 0xc48b3417), TOBN(0xa93e4143, 0x07d5c91f),
+	TOBN(0xe815601b, 0xdeebcf29), TOBN(0x85b1971a, 0xbdec8744),
+	TOBN(0x0ba02dce, 0xd530deca), TOBN(0x603dd910, 0xcd5cb404),
+	TOBN(0x1a81ae2c, 0xafde4d02), TOBN(0x259b99c2, 0x2bbd3237),
+	TOBN(0xc1fc3132, 0x0e9cfb33), TOBN(0x6651ac2f, 0x527ecdd7),
+	TOBN(0x96a10ed4, 0x9f11cfbd), TOBN(0x216a185b, 0x4793899a),
+    },
+    {
+	TOBN(0x16ef6523, 0xd66338f6), TOBN(0x4f85c3be, 0xa1293554),
+	TOBN(0x6ea53f5c, 0xf0303577), TOBN(0x753da1c4, 0x3bc0a934),
+	TOBN(0x6657aa54, 0x784f334e), TOBN(0xa84e35d1, 0x63d378c9),
+	TOBN(0x448ccfc4, 0x9bdf0ad5), TOBN(0xc1067ee1, 0xe4aa842d),
+	TOBN(0x9c74e6d8, 0x441d9810), TOBN(0x08e70ab2, 0x0dc6ab67),
+	TOBN(0xefcb3418, 0x1fc03f37), TOBN(0x55ce6eab, 0xc2e2e263),
+	TOBN(0xe4dc8ad8, 0x8dd16b59), TOBN(0x8ee72f3f, 0xdacaf25c),
+	TOBN(0x35bfe801, 0xa3f0d20f), TOBN(0xeeb97b52, 0x959f7ae5),
+	TOBN(0x80a6f223, 0x7dbdf97b), TOBN(0x57c04bdb, 0x0dbe2c88),
+	TOBN(0x26c9753a, 0xb2c835b8), TOBN(0x42c32732, 0xfe37d615),
+	TOBN(0x4eb0b7dd, 0xb428e3f1), TOBN(0xe2e3342b, 0x5332370f),
+	TOBN(0x99f162d9, 0x30ba7947), TOBN(0x519c29f6, 0xd38071cc),
+	TOBN(0xddfb8b08, 0x9b01cebf), TOBN(0xde46d906, 0x62c87da1),
+	TOBN(0x038e1911, 0x82eae1f6), TOBN(0xb52d0da0, 0xae1405a8),
+	TOBN(0xfced23fb, 0x9a5d7e1c), TOBN(0x9f245dc0, 0x377b3cdd),
+	TOBN(0x60aac2b2, 0xe567a3a5), TOBN(0x8257a2e0, 0xd244b2e0),
+	TOBN(0xd6c38770, 0x5be576cd), TOBN(0xb66e9906, 0xe3280b3c),
+	TOBN(0x4d907fb0, 0xc40e3fd3), TOBN(0x96c0624f, 0xe7860402),
+	TOBN(0xaa952c23, 0x3aeb541f), TOBN(0x6949670e, 0x4aed6d88),
+	TOBN(0x1e09c7d4, 0x25ceee89), TOBN(0xec541124, 0x7f70fa34),
+	TOBN(0xf2c1a395, 0xbbbd7822), TOBN(0x60ba5542, 0x508f46a3),
+	TOBN(0x56f210f2, 0x177d2c75), TOBN(0xb3f54d0c, 0xe04ce7eb),
+	TOBN(0x29524505, 0xd40b1326), TOBN(0x34a59533, 0xf9e90bf2),
+	TOBN(0x495e22ff, 0x8fd4ee40), TOBN(0x5bc87038, 0x41a614a6),
+	TOBN(0x82e23d56, 0x37995607), TOBN(0xeba3e70c, 0xe5966246),
+	TOBN(0xd6973407, 0x9e8de329), TOBN(0x811d0e55, 0x09e353da),
+	TOBN(0xb846d714, 0xd66f431d), TOBN(0x18b5dffa, 0xde4f10b7),
+	TOBN(0xbdf52828, 0xb4fcdc2b), TOBN(0x08198ddd, 0x04823dba),
+	TOBN(0x79d8191a, 0x854dcfb0), TOBN(0x7b2f52b7, 0xd9b91ca8),
+	TOBN(0x0b2863d4, 0xae1075ca), TOBN(0x304a0214, 0x67d10b5a),
+	TOBN(0x2c015835, 0x6ee11fbc), TOBN(0xb332c161, 0x144febfd),
+	TOBN(0x46b3966e, 0x419733f3), TOBN(0xe7566190, 0xaa82a524),
+    },
+    {
+	TOBN(0x58004d97, 0x067efb00), TOBN(0xa9781fc9, 0x5cbaf265),
+	TOBN(0xc285d7e2, 0x3ae6257f), TOBN(0xe83d4a41, 0xdcc5e358),
+	TOBN(0x5a153615, 0x6c6ad9e4), TOBN(0x2c2c13b3, 0x5ac5cbc0),
+	TOBN(0x09de7269, 0x061cf4d5), TOBN(0xf55fda63, 0x5d7083c8),
+	TOBN(0x4fe2776b, 0x6adde971), TOBN(0xe8af2e42, 0xf1ad5f97),
+	TOBN(0x7f64c696, 0xb044e498), TOBN(0x3110d83d, 0x746defd6),
+	TOBN(0x0b6857e6, 0xb17a0927), TOBN(0x9f5c68db, 0xd40344aa),
+	TOBN(0xf79a7683, 0x6ac4f948), TOBN(0xef44d431, 0x6b412872),
+	TOBN(0x7c6cdd2c, 0x38a53f72), TOBN(0x4c441c71, 0xc41b4c44),
+	TOBN(0x8d87d932, 0xff65ef0d), TOBN(0x3543a637, 0xfe781cf9),
+	TOBN(0x5d973bde, 0xcbdc1249), TOBN(0x92f4333b, 0xf436ab2e),
+	TOBN(0x42b70172, 0xd84e8c61), TOBN(0x27ac3bb6, 0x22f5a16a),
+	TOBN(0xb7b094e8, 0xf18d6a2a), TOBN(0xdd2d8cb7, 0x1318b1bf),
+	TOBN(0x4db24e01, 0x50ca6a11), TOBN(0x135c1e8e, 0x4bb614a7),
+	TOBN(0x8d8161db, 0x51de0c46), TOBN(0x3965b28d, 0x6be9f2c6),
+	TOBN(0xcdce9a1e, 0x4ee66a44), TOBN(0x63df0f44, 0xa78cbba7),
+	TOBN(0xfc869c3e, 0x1ef1d7bd), TOBN(0x2e8aeaf6, 0xfc178d4e),
+	TOBN(0x33443cc9, 0x47b711a8), TOBN(0x4f56f84a, 0x57fd4a83),
+	TOBN(0x2dabe6a1, 0x5324e074), TOBN(0x5c656b61, 0x3c412827),
+	TOBN(0x12e30c79, 0x3ca95d08), TOBN(0x74e86411, 0x70095a82),
+	TOBN(0x9c81aa92, 0xa55c294a), TOBN(0x7f8eb470, 0x5186695f),
+	TOBN(0x585dc299, 0x01f951a4), TOBN(0x974004ee, 0x5bad05e1),
+	TOBN(0x15616476, 0x0f251509), TOBN(0x0b91b436, 0x7eaf61af),
+	TOBN(0xe9559313, 0x68f996f2), TOBN(0xa66e8573, 0x32c72678),
+	TOBN(0x8933615e, 0x4cfa2cc5), TOBN(0x3ec1c5b6, 0xb8e3264f),
+	TOBN(0x9e590019, 0x90d2be32), TOBN(0x797ec785, 0x96e8eebc),
+	TOBN(0xe48cbbe9, 0xaacb5030), TOBN(0xab61f262, 0x4fd0ab2f),
+	TOBN(0x915f0b58, 0xa6085727), TOBN(0x6047dde0, 0xa513bf08),
+	TOBN(0xd19f6401, 0xd6ea8c9c), TOBN(0xa5182de0, 0xb7766c9d),
+	TOBN(0xdba29b00, 0xaebf8d20), TOBN(0xafa862bb, 0x62cf9d8c),
+	TOBN(0x3a9878f6, 0x79b666d8), TOBN(0x674fe6b4, 0xceb7cb5a),
+	TOBN(0xd2d8dd49, 0x17106efc), TOBN(0x22cdb9bd, 0x6a82e522),
+    },
+    {
+	TOBN(0x4c885272, 0xd2684db9), TOBN(0xd835f0d2, 0xe81a5fd4),
+	TOBN(0xcd212e5c, 0x08c8c303), TOBN(0xd342e250, 0x78371090),
+	TOBN(0x1d500733, 0xc85e9392), TOBN(0xe1834c86, 0x2ee2ad4c),
+	TOBN(0xf2dffc8d, 0x6e01578a), TOBN(0xa66299c3, 0x1bdde688),
+	TOBN(0x56b144ea, 0xb86e3777), TOBN(0xee3457ec, 0x4b8f85cc),
+	TOBN(0xd2397cd0, 0xed5bc510), TOBN(0x2a1105be, 0x5dfbcc8a),
+	TOBN(0x2ee975b1, 0xb8cdce23), TOBN(0x4ff5892f, 0xb94db2b4),
+	TOBN(0x4858000a, 0xda9cbba1), TOBN(0x62d767b9, 0x2afff2fb),
+	TOBN(0x7fffa924, 0x5a67340f), TOBN(0xe410fece, 0x29eba858),
+	TOBN(0x20fba916, 0x6f18c25e), TOBN(0xb4c5f0e6, 0x7eda5793),
+	TOBN(0x6098c3df, 0x1ffe805e), TOBN(0xab2d24fe, 0x5fdb5293),
+	TOBN(0x5d3bfff4, 0xdb724c59), TOBN(0x1f4df41f, 0x015e14f0),
+	TOBN(0xd19235ef, 0x2bdb0495), TOBN(0x46aa5eb7, 0xb6f1b70d),
+	TOBN(0x513b9b22, 0x953f56d0), TOBN(0x712dca4e, 0x3698ed3b),
+	TOBN(0xfc5a7e06, 0x409cfd8f), TOBN(0x2c669479, 0xf24bc6b6),
+	TOBN(0x81f1eb96, 0x96602b8c), TOBN(0x3cd983e1, 0xd53ff585),
+	TOBN(0x7f68b4be, 0x434b8696), TOBN(0xd1ae6909, 0xd3a1c94d),
+	TOBN(0x1bb0d862, 0x0c96cb15), TOBN(0x699f9a49, 0xaf7f1a09),
+	TOBN(0x1020c8cf, 0x702c24b7), TOBN(0xf9aa7b3a, 0x7e5e3e46),
+	TOBN(0x9f4e431f, 0xd46690ab), TOBN(0x23e4245d, 0xe4b8c58b),
+	TOBN(0xada426b0, 0x07cd1039), TOBN(0x183b0244, 0x65116939),
+	TOBN(0x52a64958, 0x970bda2d), TOBN(0x7e38eeb9, 0x87fdea84),
+	TOBN(0x5808a7ab, 0xaf774478), TOBN(0x85040a96, 0xb44859ee),
+	TOBN(0xfc0e7b6e, 0x7ba5fbbc), TOBN(0x5a01fda3, 0xf62e2c56),
+	TOBN(0xf909013b, 0x5bc9ced7), TOBN(0xcc872987, 0x464060da),
+	TOBN(0x176908e9, 0x5e25905c), TOBN(0xa7e08138, 0x07f80949),
+	TOBN(0x6d9bdff3, 0x31e69d0d), TOBN(0xf229cfcd, 0x63dc0398),
+	TOBN(0x50b80de9, 0x5dc09db1), TOBN(0x5b742680, 0x4e6c6572),
+	TOBN(0x36db60a8, 0xb0e174b4), TOBN(0x90c05c25, 0x2bcf7aed),
+	TOBN(0x0ac4ce8c, 0x28ec88f7), TOBN(0x98d91938, 0xf709ad6e),
+	TOBN(0x859aa610, 0x0c2481fe), TOBN(0xb94c5df7, 0x448a7f50),
+	TOBN(0xde5c66c6, 0xfbd0d252), TOBN(0x8c0da025, 0xf2f0ac4c),
+    },
+    {
+	TOBN(0x2ecd9359, 0x61c62aa3), TOBN(0xc4f6f09a, 0x901fe752),
+	TOBN(0x7518c264, 0x5ff143b1), TOBN(0xdad10798, 0x4c5bc948),
+	TOBN(0xd0659ea8, 0x47d4186f), TOBN(0x9e5e70f3, 0xa7f19dfd),
+	TOBN(0x7f2d1c43, 0xe423ccd1), TOBN(0x09ed9a62, 0x7b29d3e6),
+	TOBN(0x50f1c768, 0xc411b6b9), TOBN(0x473c457c, 0xa5437614),
+	TOBN(0x02f1a1f2, 0xc72a1f33), TOBN(0x7b8c18d9, 0xefd85ed4),
+	TOBN(0xde4a4a26, 0x418b1c8d), TOBN(0x29f9d5c5, 0x4e3f61d9),
+	TOBN(0xb45926e6, 0xe7e6b5b1), TOBN(0x67fef28d, 0xf807341c),
+	TOBN(0x659f0c85, 0x1f940444), TOBN(0xbc6b9d9e, 0xed3e00f3),
+	TOBN(0x671689f5, 0x54f25d83), TOBN(0x39ac75c7, 0x2e646259),
+	TOBN(0x00f57dff, 0x0fbdb1dc), TOBN(0x4be04205, 0x244173f7),
+	TOBN(0x10131208, 0x920cbdc9), TOBN(0x1ab86cd4, 0x9dea394e),
+	TOBN(0x8f8586bc, 0x2acf8dd0), TOBN(0xd482b6f5, 0xca478cde),
+	TOBN(0x1d86d3da, 0xeb18069f), TOBN(0xdfa36a3a, 0xe0739472),
+	TOBN(0x6fc1bb34, 0x6540371c), TOBN(0x4848f213, 0x4101e486),
+	TOBN(0x3135d91b, 0xd7213655), TOBN(0x5c9b94c1, 0x54503adb),
+	TOBN(0xeee8b3a9, 0x2b13dca6), TOBN(0x7b04fe5b, 0x4359669a),
+	TOBN(0xd4311f9b, 0x02c5226a), TOBN(0x8913a754, 0xd2753da7),
+	TOBN(0x60997d0e, 0xa3415b1c), TOBN(0x3ebb6ae3, 0xe8e2f1ae),
+	TOBN(0x84f301e5, 0xcc5745ab), TOBN(0x5e0f0918, 0x53228b7b),
+	TOBN(0x3064aef5, 0x5d25cf14), TOBN(0x67692b8f, 0x0fcb290b),
+	TOBN(0xbfa21dbd, 0x13617aaa), TOBN(0x8e2f2f75, 0x375463d0),
+	TOBN(0x96319d03, 0x994fcaaf), TOBN(0x41647a58, 0x32d3a653),
+	TOBN(0x3e6e66d5, 0x231405f5), TOBN(0x812b49ca, 0x54c17270),
+	TOBN(0x4357c1eb, 0x351e52d7), TOBN(0xc984990a, 0x1abfe0b2),
+	TOBN(0x8991165d, 0x1a46b826), TOBN(0xfa0e01c4, 0xaf19196b),
+	TOBN(0xc53682d1, 0x5da9b5e2), TOBN(0x7b202ce3, 0x69151d72),
+	TOBN(0x906ec5f0, 0x2a1830fe), TOBN(0x7e4334f0, 0xdde97013),
+	TOBN(0xc5b358d1, 0xec33458f), TOBN(0x77562a4e, 0x1eabf76b),
+	TOBN(0xe2a17a0f, 0x0bd642ca), TOBN(0x913299b4, 0x1870454a),
+	TOBN(0x01351b69, 0x918aed9f), TOBN(0x602b03cc, 0x2d6788c4),
+	TOBN(0x638e1737, 0x5a9ff170), TOBN(0x988a319f, 0x0e30c70d),
+    },
+    {
+	TOBN(0x771ed9b9, 0x9eccb601), TOBN(0xebcc94b4, 0x0f980581),
+	TOBN(0x688fe307, 0xc76a9c1b), TOBN(0x8e617d4e, 0x8f786481),
+	TOBN(0x5d4c2429, 0x588b58fd), TOBN(0xeb21a033, 0xc10ea04c),
+	TOBN(0x59673353, 0x3733ef9b), TOBN(0xea9e5cb7, 0x37cad4e2),
+	TOBN(0xd8f9204d, 0xa2138c8a), TOBN(0xf9c155ac, 0xc9f6bc83),
+	TOBN(0x5208d873, 0x6fc1e32e), TOBN(0x2c876b1c, 0x49662976),
+	TOBN(0x1bb3c08b, 0xdd61ab94), TOBN(0x7dddc70a, 0xa34d5f55),
+	TOBN(0xce7dc0a9, 0x21259cbf), TOBN(0xa9cbe492, 0xb4572e0c),
+	TOBN(0x3c5376d4, 0xcda8a643), TOBN(0xbf140856, 0xadfd2c44),
+	TOBN(0x19b8fd73, 0xdeacabd4), TOBN(0xc6666e1e, 0xe4d6c48b),
+	TOBN(0x8fd767c7, 0x43db9fbc), TOBN(0xbcb2ae26, 0x52db03ec),
+	TOBN(0x591f9539, 0x417d5d48), TOBN(0xe91f3ac4, 0x7708635a),
+	TOBN(0x4a4cef96, 0xa377e494), TOBN(0xe3eb4f61, 0xe2222881),
+	TOBN(0x4c6905f1, 0xd902c32d), TOBN(0x4f877a24, 0x9fd3089d),
+	TOBN(0x0b4c1124, 0x18394bcc), TOBN(0xe797b216, 0xf747864c),
+	TOBN(0x30bcf5f9, 0x62826dd7), TOBN(0x67f1cc2b, 0x44554d73),
+	TOBN(0x0a7abf49, 0xd67332b2), TOBN(0xd64c12ff, 0xa378e145),
+	TOBN(0x69f359c6, 0xb8805f20), TOBN(0xa7886bcb, 0xb7de0044),
+	TOBN(0x09d3d401, 0x89aea7d3), TOBN(0x5a5e7ff8, 0xa647764a),
+	TOBN(0x9c653e4e, 0x3212301b), TOBN(0xde93fa9e, 0x5f935a31),
+	TOBN(0x8638ef01, 0x6bddf11b), TOBN(0x129542cf, 0x943302b0),
+	TOBN(0xbc909713, 0x888353fd), TOBN(0x56b7c275, 0x895e8c25),
+	TOBN(0x70252356, 0xea2359ca), TOBN(0xc59883e5, 0xdb333b8e),
+	TOBN(0x4658610a, 0xd1902255), TOBN(0x1432e120, 0x3980d97d),
+	TOBN(0xc7690a78, 0x6b3c78cc), TOBN(0x72ed990d, 0x2add6e75),
+	TOBN(0x2292e669, 0x95398da5), TOBN(0xd998cc09, 0x758e3d35),
+	TOBN(0xcd87934f, 0x0ea2a86f), TOBN(0x994863cd, 0x129d660f),
+	TOBN(0xd588f72e, 0x435e6de1), TOBN(0x566b97d3, 0xeebf03ce),
+	TOBN(0xfed9ace5, 0x1b74869d), TOBN(0x4a6a8f1a, 0xdc7b9b28),
+	TOBN(0x3658d28b, 0xe990953b), TOBN(0xee0a4346, 0x78a4a1b8),
+	TOBN(0xc1c04318, 0x52c3d30e), TOBN(0x764157ce, 0x04f0f54e),
+	TOBN(0xb509e946, 0x8f4119dd), TOBN(0xd0f89eba, 0xca26883f),
+    },
+    {
+	TOBN(0xbc310fa0, 0x9373b850), TOBN(0xad01716e, 0xf1af23be),
+	TOBN(0xba43eb64, 0xd24bccce), TOBN(0x6e0443e8, 0xaf7d5060),
+	TOBN(0x494a5839, 0xa4a7c815), TOBN(0x2a112d26, 0x5e5894e6),
+	TOBN(0x84284332, 0x2e0f1678), TOBN(0xeadb94f8, 0x74719f53),
+	TOBN(0xd1ddcc12, 0xefdafec6), TOBN(0x9a8a4455, 0x643c16a4),
+	TOBN(0x06cd0390, 0x1b7b4218), TOBN(0xbafbf1f0, 0x9739d14a),
+	TOBN(0x8af90172, 0x3f8bb2ff), TOBN(0x8cf5fad2, 0x6962ea27),
+	TOBN(0xaf0bbb64, 0x8712109f), TOBN(0x08fd21a4, 0x77e2abaa),
+	TOBN(0xb2a5f27e, 0xc77dbeff), TOBN(0x83429868, 0xc6da1233),
+	TOBN(0xe594ce08, 0xf5ed0579), TOBN(0x8ce512d1, 0xe155edd7),
+	TOBN(0x7d0bd7fd, 0xe9d228f7), TOBN(0x8870619f, 0xe96ef6da),
+	TOBN(0x58e8137d, 0xdf869f92), TOBN(0xe2e14f40, 0xe4760f21),
+	TOBN(0x9b198b4b, 0xa62e0fda), TOBN(0x01060cbc, 0x428bc7d4),
+	TOBN(0x1f0939e5, 0x27cb0e69), TOBN(0x8cde01c4, 0x1e505b01),
+	TOBN(0x6a51d76b, 0xf5e5bc79), TOBN(0x2b160dc7, 0xb0be7c23),
+	TOBN(0x59d483d7, 0x1365d7c2), TOBN(0x8aec3b07, 0x449b1caf),
+	TOBN(0x8c818f4a, 0xaf6a114d), TOBN(0x9beff5b0, 0x5eec1fad),
+	TOBN(0x6b1569bb, 0x7b1b96f3), TOBN(0x283db1be, 0x303d8281),
+	TOBN(0xe491c055, 0x0724b932), TOBN(0xb12185e6, 0xfe7f6096),
+	TOBN(0x922c78e1, 0xcd4f1f63), TOBN(0xb141c739, 0x978b46ab),
+	TOBN(0x473b185b, 0xe855e98e), TOBN(0x52dff595, 0x249d29d8),
+	TOBN(0x5022f38c, 0xbce482e1), TOBN(0xd4e01eb5, 0x70838351),
+	TOBN(0x2c530704, 0x9b4f03f4), TOBN(0xec086a67, 0xf0d4d829),
+	TOBN(0x51a9c8af, 0x61d2fc7a), TOBN(0x36a3acef, 0x94ae0aa7),
+	TOBN(0x4403765d, 0x653169b9), TOBN(0x56abc35f, 0x6c56020a),
+	TOBN(0x229356c8, 0x931cde5c), TOBN(0xbda34169, 0x332e74c1),
+	TOBN(0x4a88520d, 0x03b5b189), TOBN(0x61ac12fd, 0xe6b94063),
+	TOBN(0x7659a118, 0x72e000f8), TOBN(0x0f201afd, 0x5d204854),
+	TOBN(0x0c6ab456, 0xd965dc24), TOBN(0x111ccd9f, 0x9c60e24c),
+	TOBN(0x391e09a3, 0xcf3ab14c), TOBN(0xa9ff140b, 0x25f3b84d),
+	TOBN(0x54b0046d, 0x08dc3878), TOBN(0x70bdaedc, 0xacf61fa9),
+	TOBN(0x013b2cae, 0xcc2e3847), TOBN(0xb06407b4, 0x23acf0b2),
+    },
+    {
+	TOBN(0x27547500, 0x4cb7e563), TOBN(0x9ebe9a6b, 0x7aefbb93),
+	TOBN(0xfd5ce72b, 0xf2a7bd4d), TOBN(0xba53d7f1, 0xc08e0a63),
+	TOBN(0x61be5038, 0xa2b72d95), TOBN(0x992d3878, 0x33070e03),
+	TOBN(0x28467fed, 0x011c7b7d), TOBN(0x29483bc9, 0x399ce9fa),
+	TOBN(0x78a86c34, 0x987951ea), TOBN(0x91db6101, 0x81477b7c),
+	TOBN(0xb7c16a37, 0x356fc4b6), TOBN(0x6b7ba375, 0xa807c7cf),
+	TOBN(0xd6569f7c, 0xae9d2650), TOBN(0x5c8ec6ed, 0x60a8bac8),
+	TOBN(0xf9d0784d, 0xc45f0099), TOBN(0x6c096cbc, 0x2fb87b93),
+	TOBN(0xd8183b96, 0x9e7bfc49), TOBN(0x0eabd1b5, 0x5c8ab4c9),
+	TOBN(0x96e132ca, 0x0292a0f8), TOBN(0x8ba56adf, 0xd0100a15),
+	TOBN(0x14858f61, 0xa1b5ca2d), TOBN(0x2390703f, 0x5bf54357),
+	TOBN(0x9f4f65f7, 0xaddb41b7), TOBN(0x73574646, 0x7feea4fa),
+	TOBN(0x92a8e481, 0xa0903c34), TOBN(0x0e85bab6, 0xb90c66c1),
+	TOBN(0xfad9da86, 0xe23e70ce), TOBN(0x662bc411, 0x31d0d691),
+	TOBN(0xd2c116ab, 0x14e33210), TOBN(0x68fdf687, 0xc96dd716),
+	TOBN(0x9159f479, 0xa1a96e9e), TOBN(0xf1b704b5, 0xfea0dc05),
+	TOBN(0xa8a72896, 0x8a1ae048), TOBN(0xc75c0ed4, 0x8c978d72),
+	TOBN(0xfb5bdd15, 0x7c94c29f), TOBN(0xae78b1aa, 0x09aa5708),
+	TOBN(0x4b8a02d5, 0x72d0539f), TOBN(0x05122303, 0xdf01ce7a),
+	TOBN(0x9ccbc2f7, 0xe82b1e0a), TOBN(0x4dcd4b80, 0xf03b7398),
+	TOBN(0x864b0a11, 0x68ff3ea5), TOBN(0xea28deba, 0x6734c56c),
+	TOBN(0xc3fc5b02, 0x33617a0b), TOBN(0xcbc89e60, 0xab0599ce),
+	TOBN(0x564e8daf, 0xa67ddedc), TOBN(0x1663c66d, 0x40dfb06c),
+	TOBN(0x624cd2d9, 0xa9d8429b), TOBN(0x3bb3778a, 0x2dab019e),
+	TOBN(0x6418939c, 0x5c181f90), TOBN(0xb7b7ac33, 0x5d42c904),
+	TOBN(0x3345d576, 0x9ae39a2e), TOBN(0xbc6c90d2, 0x56dc414c),
+	TOBN(0xc371d974, 0x8863b18a), TOBN(0x854a83b2, 0x56484d4c),
+	TOBN(0x65f64c17, 0x677495fe), TOBN(0xbec249ef, 0x10bb2ce9),
+	TOBN(0x5e356ae0, 0x8b2087fe), TOBN(0x847f344c, 0x41c2cf70),
+	TOBN(0xac4e5dae, 0x9fc22f38), TOBN(0xe987c3ab, 0xc4336955),
+	TOBN(0x62bd5ad0, 0xfad7392d), TOBN(0xeadf550f, 0x3b01e736),
+	TOBN(0x84487b8b, 0x51a46202), TOBN(0x1536aac7, 0x198eac3a),
+    },
+    {
+	TOBN(0xce9d8845, 0xf023909e), TOBN(0x2d255a84, 0x1d6f66fe),
+	TOBN(0x7e591c49, 0x46246f10), TOBN(0x46564480, 0x74e9846a),
+	TOBN(0xcb8b9b72, 0x96063d45), TOBN(0x70d677fa, 0xc666a853),
+	TOBN(0x67a8422b, 0x8c090de6), TOBN(0xee5e26a1, 0xe6609d3a),
+	TOBN(0x3849eb55, 0x5d67fec1), TOBN(0xb90735ad, 0x28a3bf21),
+	TOBN(0x8d0cb723, 0x0172dfc8), TOBN(0x3c657287, 0x05a9ca82),
+	TOBN(0xef943462, 0x210d4f2a), TOBN(0xb98155bf, 0xdc316dc2),
+	TOBN(0x1ff8366c, 0xb7248742), TOBN(0x74e0143b, 0x491da29d),
+	TOBN(0x168e26c1, 0xd8f63455), TOBN(0x45c8ef55, 0x34a9e7b2),
+	TOBN(0xafbbdd39, 0x3b6d7e99), TOBN(0xf59e8644, 0xd78e2668),
+	TOBN(0xcdde5f4d, 0xbe8bc472), TOBN(0x65671e9b, 0x4ac5892e),
+	TOBN(0xd817c1ba, 0xc4f18c57), TOBN(0x45b4a526, 0xa1a3572e),
+	TOBN(0x565a5962, 0xfd48db04), TOBN(0x2e3cb366, 0x81916fee),
+	TOBN(0xbe17a6a8, 0x272e9fc9), TOBN(0xc6429b56, 0x8eb1d59f),
+	TOBN(0x67a8f998, 0xa7bf50b1), TOBN(0x5e3eb55f, 0x2cb5b00f),
+	TOBN(0x0e8eca3b, 0xdbcb0ced), TOBN(0x4e60c31b, 0x4d1faa9d),
+	TOBN(0x6c5668b8, 0x07468798), TOBN(0x5149b73a, 0x42490374),
+	TOBN(0x8f769352, 0x5e37398b), TOBN(0x7bbf4be2, 0x1b0aadfe),
+	TOBN(0x0e03fc5d, 0x14eeb822), TOBN(0xca4bb6bf, 0x79a8a9ef),
+	TOBN(0xb4073b43, 0x6f0cd1a6), TOBN(0x2aaa7b60, 0xb49953af),
+	TOBN(0x73af10a6, 0x4b1be51c), TOBN(0xabf73ce6, 0xf0e0c826),
+	TOBN(0x94795018, 0x44e6ab0d), TOBN(0x7dab9358, 0x6b58181d),
+	TOBN(0x353343b8, 0xed41a146), TOBN(0x3d5cb6ef, 0xc515c750),
+	TOBN(0x7fe56ca0, 0xacd8e2a2), TOBN(0x0289b401, 0x95d3783a),
+	TOBN(0xeb8b8cba, 0x698d9f1e), TOBN(0x9d78c62a, 0x777d0912),
+	TOBN(0xdd61994c, 0x9f49366a), TOBN(0x02884a39, 0xae03e173),
+	TOBN(0xf272d41f, 0xf1635cbc), TOBN(0xa799fcbf, 0x7b31fda2),
+	TOBN(0xb4001dd7, 0xbed895ff), TOBN(0xa0ef2689, 0xad57bbfa),
+	TOBN(0x775b339f, 0x198de661), TOBN(0xac246913, 0xa2e6c73f),
+	TOBN(0xc0197753, 0x45b5254b), TOBN(0x5a8c00b4, 0xd8519bd0),
+	TOBN(0x0668681e, 0xefc2bda7), TOBN(0x6692924e, 0x709a7bd4),
+	TOBN(0x55926435, 0x0955e9da), TOBN(0x360b4344, 0xb887c7f4),
+    },
+    {
+	TOBN(0x6557a94e, 0xa9ea2d81), TOBN(0xbaf644d9, 0xb688ab49),
+	TOBN(0x7787c4f5, 0xa3a16db5), TOBN(0xf6df763c, 0x4d35366e),
+	TOBN(0x8e1c4432, 0x740389c3), TOBN(0x55db4d18, 0x8218009c),
+	TOBN(0xdf1e8357, 0xd469f95b), TOBN(0xb8169f72, 0xe38e323f),
+	TOBN(0xf9787115, 0x0fa043c1), TOBN(0x1af18501, 0x0b19213b),
+	TOBN(0xaa74091e, 0x029bc81d), TOBN(0x53fe6737, 0xedd0bac7),
+	TOBN(0xc3928deb, 0x803462f6), TOBN(0x7497e508, 0x50ec0c27),
+	TOBN(0x84134da0, 0x037c2ba5), TOBN(0xb390d15a, 0x2c978136),
+	TOBN(0x0748bbad, 0xb60d3961), TOBN(0xa45fad36, 0x97251dfc),
+	TOBN(0xee1d5aab, 0x799294aa), TOBN(0x846b7db7, 0x5c536b6c),
+	TOBN(0x6b4e645f, 0x36953cb1), TOBN(0xad8e5ee1, 0xeefee5be),
+	TOBN(0x8be5bfde, 0x1126779f), TOBN(0x7ab7d282, 0x6f05d089),
+	TOBN(0x6c0965a8, 0x33ba80c8), TOBN(0x173c8679, 0x4ec71704),
+	TOBN(0xcdc39a14, 0x05d4e126), TOBN(0x4a67a48b, 0x0ce0a715),
+	TOBN(0xfcc686f7, 0xeedbfb35), TOBN(0x15cd7304, 0x4c6dc49a),
+	TOBN(0x17371749, 0xa52cfe6f), TOBN(0xdc9f7e5b, 0x7150e4e7),
+	TOBN(0x7422b26b, 0x9364c8ce), TOBN(0x24ccfea7, 0xa09d9377),
+	TOBN(0xf8619d6b, 0x1d0f33e0), TOBN(0xf0b59e64, 0x58074b56),
+	TOBN(0x8aa4af3d, 0xd6609e33), TOBN(0x100f08bf, 0xc37cf361),
+	TOBN(0x34e36789, 0xc6dab3cb), TOBN(0xbd0057d7, 0xcb826682),
+	TOBN(0x396929b2, 0xfcc7fce6), TOBN(0x323603a9, 0x98fac807),
+	TOBN(0x6db5424d, 0x3f43537a), TOBN(0x44597598, 0x1e94f1c1),
+	TOBN(0x13b54880, 0xfa9005c6), TOBN(0x217c6aa3, 0x49db6aa1),
+	TOBN(0x86c81c6f, 0xb8084fc6), TOBN(0x431dccc3, 0x22c4ae8d),
+	TOBN(0xe282b7d7, 0x732bfa22), TOBN(0x543d92d5, 0x022c737e),
+	TOBN(0x774b642c, 0x5a7e24e5), TOBN(0x682368c7, 0x0dde7cd4),
+	TOBN(0xfe9df950, 0x318ee42b), TOBN(0x86cb7b0a, 0x344d0d9e),
+	TOBN(0x0b3e6389, 0x63be0627), TOBN(0xa0626b07, 0x52d41759),
+	TOBN(0x5353d465, 0x7d5eb673), TOBN(0xb93c398d, 0xdca3cb9c),
+	TOBN(0x4776f085, 0x77aa5098), TOBN(0x6ead63e4, 0x6d848716),
+	TOBN(0x69cd83ac, 0xe57c1954), TOBN(0x9911b570, 0xebdcddf8),
+	TOBN(0xc6be8f3c, 0xc9f2a416), TOBN(0x757e34fe, 0x8daeb781),
+    },
+    {
+	TOBN(0x79f1127d, 0x098661eb), TOBN(0xd9883eb2, 0x0a1b8f76),
+	TOBN(0xb8c1c24a, 0x0475f0b4), TOBN(0xcb21e052, 0x75f8c1bb),
+	TOBN(0xaead221e, 0xdc7ffbe3), TOBN(0x5088f8f4, 0x581cda2b),
+	TOBN(0x0dcc7256, 0xb19d4e3b), TOBN(0xb6f67094, 0xf1714e6d),
+	TOBN(0x15f92ff5, 0xbf5c464b), TOBN(0x7ee4af32, 0xf78faf7e),
+	TOBN(0xbb788d59, 0xbfeca5a0), TOBN(0x2802b49c, 0x74977ca3),
+	TOBN(0x494c1568, 0xc545d3b4), TOBN(0xc0083eb2, 0x7d3f1cb3),
+	TOBN(0xd1941cf5, 0x46d2eef9), TOBN(0x9c4f63f7, 0x22c56b52),
+	TOBN(0x6df3e15f, 0x38a4feeb), TOBN(0xb133a424, 0xfcb30eea),
+	TOBN(0x52518d2c, 0xfe6eb0bb), TOBN(0xab98c178, 0x54a74d87),
+	TOBN(0xa26762e0, 0x18cc482f), TOBN(0x701fba91, 0x69c1c19e),
+	TOBN(0xc971322e, 0xf89b8eb2), TOBN(0x874617dc, 0x40c1bf5f),
+	TOBN(0xb9262ae7, 0xd2432366), TOBN(0xd8e638ed, 0xc86a7218),
+	TOBN(0x82d1ec3f, 0x25b4164c), TOBN(0xb1c6b05f, 0xb8fe9d31),
+	TOBN(0x50c2f45c, 0x813b5c4e), TOBN(0x3c0bd2d2, 0xf8c52265),
+	TOBN(0x7fa19fa6, 0xc83fdafe), TOBN(0xd0a0ab03, 0x411eabba),
+	TOBN(0xbe0be58a, 0x04bf2714), TOBN(0xa6804b58, 0x3c2d6a04),
+	TOBN(0x1229eb62, 0xb534224c), TOBN(0xf1fd40ee, 0x97cd4bee),
+	TOBN(0xee695141, 0x744f5beb), TOBN(0xcf3e0cf4, 0xc0d7d118),
+	TOBN(0x176a0600, 0xd1bba479), TOBN(0xc51e5c09, 0x178fb8b3),
+	TOBN(0x9a55895b, 0x7601964d), TOBN(0x9909468f, 0xf6d44809),
+	TOBN(0x72058415, 0xba7b22c8), TOBN(0x270012db, 0xfe59ce82),
+	TOBN(0x2d90ba66, 0x2af616e5), TOBN(0x62fdaa0b, 0xb55b75d5),
+	TOBN(0x69608658, 0x7447878a), TOBN(0x77820755, 0x171596f6),
+	TOBN(0x02a8a6bc, 0xbb180e28), TOBN(0xe7390679, 0x31e5a9ed),
+	TOBN(0x7206c227, 0x005f69ad), TOBN(0x26a779ca, 0x7ad23b72),
+	TOBN(0x7c329503, 0x4d482202), TOBN(0xcd931265, 0x25a44b8e),
+	TOBN(0xf34344f4, 0x799bb216), TOBN(0x427e4ffe, 0xe33ad8ba),
+	TOBN(0xdf2137f9, 0xa8f63408), TOBN(0x5e394cd1, 0x114df82c),
+	TOBN(0x042ddc4a, 0x7cdbca80), TOBN(0xb83cd6a8, 0x30caee27),
+	TOBN(0x06042366, 0xb06181d7), TOBN(0x94a60308, 0xeaac7a1b),
+	TOBN(0x7445027d, 0x0097ac1f), TOBN(0x1f3f3028, 0xaa506835),
+    },
+    {
+	TOBN(0xebcc2c4d, 0xd413047e), TOBN(0x6958abd1, 0xfa8121f5),
+	TOBN(0x37456ee5, 0xd188230a), TOBN(0xe4e2d375, 0x45ef51d4),
+	TOBN(0xc1e4ae36, 0xc3a78c33), TOBN(0x4a861d60, 0x15486f8d),
+	TOBN(0x3630f366, 0xedba97d5), TOBN(0x6472df6c, 0xea2e638f),
+	TOBN(0x6dc1d80d, 0x54c618c8), TOBN(0x442b335c, 0xeb8fa1dd),
+	TOBN(0x5db3da84, 0x198bf6e5), TOBN(0x18c86728, 0x275f73b2),
+	TOBN(0x71aefff5, 0xc71854ab), TOBN(0x1354ada5, 0xad62cf6f),
+	TOBN(0xfe5b8ab3, 0x10970c55), TOBN(0xa311111f, 0xa0924eb7),
+	TOBN(0xa23fea84, 0x42458e11), TOBN(0xd9298b9b, 0x8a077df3),
+	TOBN(0xd61bb997, 0xbc5505cb), TOBN(0xc2731626, 0x34011ed6),
+	TOBN(0xbe44b673, 0x6fcfead4), TOBN(0x3bd59e98, 0x7dd6971e),
+	TOBN(0x08d76ca4, 0xf793f207), TOBN(0xe516819b, 0x7a20336c),
+	TOBN(0x6938bfc0, 0xa6bc66bb), TOBN(0x29f0dd32, 0x7f407892),
+	TOBN(0x095c534b, 0x844d15ee), TOBN(0xf99ce085, 0xbc52bfaa),
+	TOBN(0xb143e330, 0x65e9cc68), TOBN(0xb52d6f10, 0xe1090d51),
+	TOBN(0x9e5b4c5b, 0x5cbf9455), TOBN(0xa1ace186, 0x813a4767),
+	TOBN(0xbaa930d4, 0x652bc2a5), TOBN(0x1fb90910, 0x9df497c3),
+	TOBN(0xd2dc5f37, 0x3e971e79), TOBN(0x0f5e903b, 0x5869b5b4),
+	TOBN(0x4298fe8f, 0x690243ae), TOBN(0x42a763e5, 0x6da4b5f5),
+	TOBN(0xfa771f12, 0xad57fb58), TOBN(0xeb9e0fc3, 0x29d04d9e),
+	TOBN(0xbb4fad27, 0x16379d6d), TOBN(0x6e997a9e, 0x3e00a480),
+	TOBN(0xee4fdc6e, 0xc2fed33c), TOBN(0xd6120b8e, 0xabbba1a5),
+	TOBN(0x1c0fb12d, 0xea3e5a76), TOBN(0xf8d26094, 0xcebd22c2),
+	TOBN(0x3d745878, 0x575b99fc), TOBN(0xb823f9c7, 0xf73fc35c),
+	TOBN(0x623926d0, 0x48f1ee6b), TOBN(0x869ee033, 0x09a4dc6a),
+	TOBN(0x81e72fe2, 0xfce4c22f), TOBN(0x93f59090, 0xd38144b2),
+	TOBN(0x0e34557c, 0x1d02c545), TOBN(0xbce31194, 0x13029594),
+	TOBN(0x918b10df, 0x0dea6ce6), TOBN(0x58f7f7e9, 0xfd33aad5),
+	TOBN(0xe821ed3f, 0x84853057), TOBN(0x4cb6a3c5, 0x0350c708),
+	TOBN(0x3882263a, 0x805799a5), TOBN(0x84481404, 0xa7bb6f39),
+	TOBN(0xcb78393f, 0xe5436fc1), TOBN(0x627854e9, 0xdd97066e),
+	TOBN(0xfc75d13b, 0x496c6f63), TOBN(0xd83e63ba, 0x80b2d9cd),
+    },
+    {
+	TOBN(0x716c0b2d, 0x279d35fc), TOBN(0xdcc3c858, 0xc0d3a67e),
+	TOBN(0x56ff7213, 0x043fd245), TOBN(0x7cfb6192, 0x6ac95a03),
+	TOBN(0x9de5f619, 0xc3fc1384), TOBN(0xff5e282f, 0x492aa8ba),
+	TOBN(0x6e9a6ac5, 0x5ad0e110), TOBN(0x015351f2, 0xe8bafff2),
+	TOBN(0xabcaa1f5, 0x041d1524), TOBN(0x9a328efc, 0x694592ef),
+	TOBN(0x30173371, 0x13181e82), TOBN(0xff193f11, 0x0188af88),
+	TOBN(0x348c4ada, 0x351850ea), TOBN(0x750c8762, 0xf30f8daf),
+	TOBN(0xf7e8fb45, 0x3afc48d2), TOBN(0x7d28cad5, 0xf23a2411),
+	TOBN(0xddf7293b, 0x3a3f47f0), TOBN(0x07c38c00, 0x85624ca0),
+	TOBN(0xdb2c2fa4, 0xb6661873), TOBN(0x4244742c, 0x1b92ae51),
+	TOBN(0xe47c94df, 0x9ecd6af4), TOBN(0xfaea3914, 0x5dc99bdd),
+	TOBN(0xa5e0f9b2, 0x82939e59), TOBN(0xb2a0048c, 0x8c72ba9f),
+	TOBN(0x41afba62, 0x7f025183), TOBN(0xc3008cff, 0xc2006299),
+	TOBN(0x80fe0e83, 0xa77d241e), TOBN(0xa9d9717a, 0xf444aa52),
+	TOBN(0x02339212, 0x626f9da1), TOBN(0xcacc9da6, 0x393c9910),
+	TOBN(0x3f6c3d39, 0x212d638a), TOBN(0x37b0227f, 0x9e8a0f3d),
+	TOBN(0xda5dc522, 0xc1ce2935), TOBN(0xed25bce3, 0x96a966bd),
+	TOBN(0xdd9fcb3d, 0xb44c709f), TOBN(0xbe3c03e8, 0x7f302ae1),
+	TOBN(0x673b4af7, 0x2817bcdc), TOBN(0xda113809, 0x6dc1540f),
+	TOBN(0xd470efa6, 0xfab7a922), TOBN(0xa27f15e1, 0x60870ea6),
+	TOBN(0x715d9007, 0x7eb729d5), TOBN(0x8de1a6a6, 0x68603823),
+	TOBN(0x065b41c5, 0x429c1de4), TOBN(0xd6091388, 0x714d4e87),
+	TOBN(0x260f4aab, 0x1040381b), TOBN(0x37a4e2c2, 0x6e7d4271),
+	TOBN(0x77da5ef7, 0xbfd1d7d3), TOBN(0xed929162, 0x3beda8f6),
+	TOBN(0x022b4746, 0x3c87b492), TOBN(0xc82b718f, 0xecb6582b),
+	TOBN(0x8a2773d9, 0x66baf86c), TOBN(0x20b9d191, 0xf66bb75e),
+	TOBN(0x8e76b90c, 0x592c7c99), TOBN(0x8114add6, 0xf8dff68c),
+	TOBN(0xfcd0892d, 0x6a24c545), TOBN(0x6ec459f3, 0x6f80402c),
+	TOBN(0xc59aba04, 0xbd62730b), TOBN(0x5ff46ded, 0x38963413),
+	TOBN(0x0e7c9b01, 0x0a36852f), TOBN(0x32a324ff, 0xf8877cfc),
+	TOBN(0x9e83ea3e, 0x46935d2f), TOBN(0x5424f9f2, 0x8dd5ec90),
+	TOBN(0x9b08d4d5, 0x42841891), TOBN(0xd8b9e14e, 0x7f572f0d),
+    },
+    {
+	TOBN(0x02807917, 0x317687ac), TOBN(0xc02884a6, 0x6bcbfca9),
+	TOBN(0x463c38e0, 0x85c2a05b), TOBN(0x3b6557e9, 0x355b3e43),
+	TOBN(0x20d88c17, 0xaef7f488), TOBN(0x118e6310, 0xc4981a4e),
+	TOBN(0xb96414a0, 0xb90216b4), TOBN(0x72981a57, 0x56e4fbe0),
+	TOBN(0xe0f58a7d, 0x169c7da2), TOBN(0x2b1bb72e, 0x05f8fdb2),
+	TOBN(0xfc325855, 0x3d3d2a2d), TOBN(0xd5e45e6f, 0xca5ed952),
+	TOBN(0x50296f3f, 0xe4b208ac), TOBN(0x88eae0d8, 0xd4352278),
+	TOBN(0x7b04f2da, 0xc1798eb5), TOBN(0xad02e718, 0xa4d48660),
+	TOBN(0x002e97be, 0x03f646fb), TOBN(0x75e00134, 0x975d0426),
+	TOBN(0x6b9741ca, 0xeb7aa30f), TOBN(0xcf885d8b, 0x13bad64e),
+	TOBN(0x2c012334, 0x801e9948), TOBN(0x03abbe49, 0x0828dcb9),
+	TOBN(0x16e1c197, 0xe919051a), TOBN(0x5543487f, 0x3eb3778a),
+	TOBN(0xb4dddcb3, 0x5f737f6f), TOBN(0xf21bb808, 0x30edb174),
+	TOBN(0x5cfa3e52, 0xd6fd87c8), TOBN(0x33e4e7bc, 0x6932dc57),
+	TOBN(0x6b4d30ca, 0xa1a4f82d), TOBN(0x79066222, 0x220b28e7),
+	TOBN(0x8afd1195, 0xc059c973), TOBN(0x17435f38, 0xe9822855),
+	TOBN(0x3cd10df1, 0xecd3c563), TOBN(0x9d3ebec0, 0x75b3c9eb),
+	TOBN(0xab867762, 0x404497f0), TOBN(0xba1309ef, 0xf73861ad),
+	TOBN(0xa050db53, 0x5f15da2b), TOBN(0x644bf960, 0x742aae07),
+	TOBN(0x05c2203f, 0x4a6d50c2), TOBN(0xcb83defe, 0xef31e977),
+	TOBN(0x2d4569ba, 0x586ebdd0), TOBN(0xfd3244cb, 0x08796163),
+	TOBN(0x880f9fab, 0x8a09ac55), TOBN(0xc3eefd7c, 0x65fc7ac8),
+	TOBN(0xee167f04, 0xd263df25), TOBN(0x4c189da8, 0x151ba107),
+	TOBN(0x892991c8, 0x4e604cfb), TOBN(0x27590f4d, 0x554305ab),
+	TOBN(0x8af2bcaf, 0xb4718c0c), TOBN(0x466dbbed, 0xe138decb),
+	TOBN(0x0c21ff0f, 0xc760c44d), TOBN(0xe304c7c4, 0x4697dd03),
+	TOBN(0xdade57fd, 0x623f4237), TOBN(0x7f3e56a6, 0xcd2de517),
+	TOBN(0xad1d8ac7, 0x9ab1ece7), TOBN(0x7fa085be, 0xc5c771a5),
+	TOBN(0xf33c0726, 0x973c43c3), TOBN(0x8c24ecf1, 0x6ec02591),
+	TOBN(0xc663b27d, 0x690688e8), TOBN(0x746efc2c, 0xbdc336cc),
+	TOBN(0x59b8f32f, 0x7db3ffeb), TOBN(0xbda4a6a6, 0x6c1f0a17),
+	TOBN(0x11f51903, 0x6bbbc386), TOBN(0xf740a53b, 0xf2b0762a),
+    },
+    {
+	TOBN(0xc065863d, 0x2a289b0b), TOBN(0xa86d0353, 0xcb028ebd),
+	TOBN(0x4ac6f3fd, 0xe14f5e2e), TOBN(0xb785dbc0, 0x417fa6a3),
+	TOBN(0x50760115, 0x5891caab), TOBN(0x79efd73e, 0xe22bd9be),
+	TOBN(0x9cc41ed1, 0x824011ff), TOBN(0x59ce41c4, 0x050b1771),
+	TOBN(0xf18e67b9, 0x8d85c5ff), TOBN(0x66d586d5, 0x9fa107d5),
+	TOBN(0x5775d457, 0x220a5015), TOBN(0xd8ef560a, 0xf8ef3ff3),
+	TOBN(0x58fca03e, 0x83e300f8), TOBN(0xe3f9207b, 0x166b91fe),
+	TOBN(0x02833c3d, 0x1990ee26), TOBN(0x6301c84b, 0xca6e56a1),
+	TOBN(0x3aca29b7, 0x8bcca43a), TOBN(0xe9c96636, 0x9dcd8e8b),
+	TOBN(0x6e6ef749, 0xf107cfb4), TOBN(0x81b48f22, 0xf6aee538),
+	TOBN(0x383f1667, 0x524882f7), TOBN(0xaed8d3ae, 0x590fc5f1),
+	TOBN(0xa4e0f1fb, 0xcb8b99c2), TOBN(0xda705320, 0x82a3acf0),
+	TOBN(0x9fd70c00, 0xb4af86c7), TOBN(0x77c3c276, 0xd1487547),
+	TOBN(0xf6f8f3d4, 0x639a63ea), TOBN(0xb4823acd, 0x45de2000),
+	TOBN(0x8028212e, 0x1dbdb1bd), TOBN(0xb5a10234, 0xe3a0bf19),
+	TOBN(0x1056850d, 0xae773b52), TOBN(0x88aa0044, 0xd434104e),
+	TOBN(0xd0a46f5c, 0x5c7d82bd), TOBN(0x1a1afa38, 0xef1afef9),
+	TOBN(0x01c663c1, 0xcc633d73), TOBN(0xd735c426, 0x3bceefac),
+	TOBN(0x2a6cd51b, 0xa0e43758), TOBN(0x8f7df48a, 0x57801cb9),
+	TOBN(0xa953e377, 0xb4cadf87), TOBN(0x9024a07e, 0x6064003c),
+	TOBN(0x357da7ae, 0x85cc56ea), TOBN(0xc28a2e2c, 0x003593ec),
+	TOBN(0xf2dc4f4c, 0x3eef18e6), TOBN(0x82df0f3d, 0x49f3186e),
+	TOBN(0x0c6d3ade, 0x17f818c7), TOBN(0x026a5385, 0xb0383e62),
+	TOBN(0x00621262, 0x9a97d40c), TOBN(0x5ec351a7, 0x36ae3090),
+	TOBN(0xf2415fe0, 0x696b81d7), TOBN(0xfbbaaa5d, 0x10f56bb7),
+	TOBN(0xe6e6cea0, 0xbf85a0d3), TOBN(0xea54c407, 0x857d5fa1),
+	TOBN(0x2c733707, 0x3cd19cd4), TOBN(0x7f9f8b5e, 0xfebb6d49),
+	TOBN(0x56e7f230, 0xcc6b6263), TOBN(0xad1728d8, 0x048c478a),
+	TOBN(0x60ecdb82, 0x2564b25a), TOBN(0xd316aa6d, 0x4a742761),
+	TOBN(0xce4f2e6d, 0xbf7262c5), TOBN(0x6dc812fe, 0x37a4be58),
+	TOBN(0xe048ee1a, 0x50409ce0), TOBN(0x696928c7, 0x2acce50f),
+	TOBN(0x3b483d71, 0x4c7ba357), TOBN(0x6fc34c0f, 0x17032a9e),
+    },
+    {
+	TOBN(0xc3f94621, 0x3e0a49fc), TOBN(0xe15f3f42, 0x8afa44c0),
+	TOBN(0x9e3134e3, 0x4c53b93f), TOBN(0xb90b439e, 0x3d178353),
+	TOBN(0x49beeb87, 0xe793560e), TOBN(0x004ef8cc, 0x17a07276),
+	TOBN(0xfca5eab8, 0xd11b0bfd), TOBN(0xe431f34e, 0xf8a9f93d),
+	TOBN(0x34985552, 0xfa088e31), TOBN(0x23948205, 0x3f9e3bfe),
+	TOBN(0x6118e8c9, 0x55543f36), TOBN(0x9d3f7ad9, 0xe583b868),
+	TOBN(0x8562db15, 0xe72701d7), TOBN(0x78d9a4a8, 0x54c2d3a5),
+	TOBN(0xa0885329, 0x31fd8375), TOBN(0x749a3f67, 0xc77480e0),
+	TOBN(0x942cd8e6, 0xe71374e4), TOBN(0x07a9d708, 0x534525f3),
+	TOBN(0xee34d436, 0xf9ce866b), TOBN(0x4bf596ac, 0x404d8adf),
+	TOBN(0x551af370, 0xeb8983a6), TOBN(0xde40ae99, 0x341dc107),
+	TOBN(0x25a5d61d, 0xb2a59ed8), TOBN(0xd5ba931a, 0xafa9f8f8),
+	TOBN(0x16f9a508, 0xf26152a0), TOBN(0x8860fd3a, 0x9e6d3a19),
+	TOBN(0x911becc7, 0xfd5da4de), TOBN(0xcf2470b4, 0x12c7eafa),
+	TOBN(0x72ef357b, 0x26967a2f), TOBN(0x12fbf898, 0xb4d6c7c5),
+	TOBN(0xc451dcfd, 0x43dee533), TOBN(0xb67b8fba, 0x53e948d8),
+	TOBN(0x22483c64, 0xb61fafd8), TOBN(0x417cb6eb, 0x52aa1afd),
+	TOBN(0xfe783fa6, 0xa5423600), TOBN(0x4fb96519, 0x359dd31f),
+	TOBN(0xacab88bf, 0x21c1c218), TOBN(0x8c8c3a5c, 0x326d4ef6),
+	TOBN(0xef5426af, 0xb482270f), TOBN(0xf28a7268, 0xf916b87d),
+	TOBN(0x2980c014, 0x371a6646), TOBN(0xb86d7b69, 0xebb45bac),
+	TOBN(0x325cf08c, 0xeae96f39), TOBN(0xf9edc2d5, 0xd79eb760),
+	TOBN(0x985e0d04, 0x6c7ba0cc), TOBN(0x3f6ba4c3, 0x1296cef5),
+	TOBN(0x57ce3569, 0x53b3e3e9), TOBN(0xd89fc86a, 0x81d06152),
+	TOBN(0x93a43c39, 0xeb84a720), TOBN(0x1a91ba80, 0x6782d398),
+	TOBN(0x7aefde7d, 0x7a232e57), TOBN(0x3a229f68, 0x003336a0),
+	TOBN(0x9f958c98, 0x572eff28), TOBN(0xa28a88f0, 0xdd4d9986),
+	TOBN(0x21bbef53, 0xf2520a9d), TOBN(0xf78654e5, 0x0a732a9b),
+	TOBN(0x01ea5772, 0x8f174832), TOBN(0x78295b8d, 0x97d29c66),
+	TOBN(0xa359c2a6, 0x9e43e452), TOBN(0x071455f9, 0xe764db12),
+	TOBN(0xa979fede, 0xf38b2e0c), TOBN(0x8fb03115, 0x727ad9f5),
+	TOBN(0x88ed915d, 0xd921f901), TOBN(0x6ed3754c, 0x73c8c129),
+    },
+    {
+	TOBN(0xadaf0f62, 0x2e70da13), TOBN(0x51289e49, 0xad06f6f7),
+	TOBN(0x4028e6a9, 0xd7ec8456), TOBN(0x94acd4e9, 0x47f37199),
+	TOBN(0x392d3f7c, 0x9bce9395), TOBN(0xb2a260b3, 0x7af7605b),
+	TOBN(0xe218a217, 0xf8537690), TOBN(0x1d53c4d2, 0x7fd254cc),
+	TOBN(0xae79ce90, 0xd66c969e), TOBN(0xc018aaeb, 0xe30dd737),
+	TOBN(0xf25eec88, 0xe4082f37), TOBN(0x669ce0eb, 0x4a26c7ee),
+	TOBN(0x707586b5, 0x97f71adc), TOBN(0x0a6c9654, 0xe559a525),
+	TOBN(0xc2b8cb38, 0x0e73561a), TOBN(0xc7e21009, 0x5a609ddb),
+	TOBN(0xdfd860b7, 0xec6adfc5), TOBN(0xfb52703b, 0xd8614af8),
+	TOBN(0x11bf915b, 0xd9821d41), TOBN(0x7d807e67, 0xe38001a0),
+	TOBN(0xd1d26e78, 0x9d9ab2ed), TOBN(0xc0d3ade9, 0xc05385e7),
+	TOBN(0x74dfe74e, 0x56ed6a3b), TOBN(0x7ac4cef9, 0x2c22a992),
+	TOBN(0x832756f4, 0xf18dc12a), TOBN(0xe0247811, 0x32c8c999),
+	TOBN(0x434a67b8, 0x2a67f927), TOBN(0xfd5dad17, 0x3e789ee6),
+	TOBN(0xc05a5627, 0x352bbdc9), TOBN(0x3f2d66c8, 0x7118f4a6),
+	TOBN(0x9e7b4b17, 0x4432d2cc), TOBN(0xe60aa362, 0x32bc4e8c),
+	TOBN(0xc266a652, 0x84a7c373), TOBN(0x97fb4f1b, 0xa39031d6),
+	TOBN(0x8e349cbf, 0x2bd1b044), TOBN(0xe9b50b25, 0x53bdf37b),
+	TOBN(0xd5cdb93b, 0x0a8e4cb9), TOBN(0x2f6d3d57, 0x57217c18),
+	TOBN(0xb135c2c0, 0x6b1da95a), TOBN(0x09db8bf3, 0xab8afa4a),
+	TOBN(0xbf9f7854, 0x014fead1), TOBN(0xaac29f0c, 0xb65bfd60),
+	TOBN(0xd67a422c, 0xe627fcd5), TOBN(0x0667b893, 0x88348511),
+	TOBN(0x2de266ae, 0x6327e870), TOBN(0x0d6ccbd7, 0xb0f91730),
+	TOBN(0x7717a285, 0x278286e6), TOBN(0x72e37783, 0x79d5d1db),
+	TOBN(0xab01a8cd, 0xd31c5913), TOBN(0x39ca1a35, 0x3a357818),
+	TOBN(0x163f2884, 0x9f6f4c75), TOBN(0xb5d86809, 0xed05411f),
+	TOBN(0xf924d40e, 0x1776819b), TOBN(0x2c7a56d4, 0x19598f15),
+	TOBN(0x96e5b259, 0xee7078cc), TOBN(0xc08cc721, 0xdc983cb3),
+	TOBN(0x4f5614b1, 0xae641169), TOBN(0x5eed7b3c, 0xcfa90cc1),
+	TOBN(0x87513cd2, 0x5f868d50), TOBN(0x6e156492, 0xd6486f1a),
+	TOBN(0x2379c8ce, 0xd4c30ba7), TOBN(0x3404940a, 0xdbe4bafc),
+	TOBN(0xbbab465e, 0x5e3666a5), TOBN(0x3e1d2b17, 0x7d3386f9),
+    },
+    {
+	TOBN(0x61880b58, 0x169b51df), TOBN(0xccb08a4c, 0x4bfcbc41),
+	TOBN(0xac6b94a4, 0xa384d420), TOBN(0x1346807c, 0x5c35a568),
+	TOBN(0x9880251d, 0x0d63b0ec), TOBN(0x6843ec26, 0x18add90c),
+	TOBN(0xcc68c3b7, 0x3042417d), TOBN(0x3e9f7d95, 0x91a3cb98),
+	TOBN(0x357cdf73, 0x37718db6), TOBN(0xe8543290, 0x62c8929a),
+	TOBN(0x7803af3a, 0xd6f70d05), TOBN(0x8f87afc6, 0x1a114ab0),
+	TOBN(0x69d268b5, 0x4e056eaa), TOBN(0xa288ac9b, 0x3a425903),
+	TOBN(0xc173d0fc, 0x474d0306), TOBN(0x7867ca98, 0xa6b9bd72),
+	TOBN(0x842ddebb, 0xaea0d79b), TOBN(0x96a4d134, 0x3a71a739),
+	TOBN(0xad012350, 0x96adf524), TOBN(0x057048b0, 0x6c4a0ecf),
+	TOBN(0x6c8d83cc, 0xcac0ceae), TOBN(0x1f27ee44, 0x08b5a5e3),
+	TOBN(0xdefdff87, 0xa020439c), TOBN(0x3699350c, 0x5d2e0880),
+	TOBN(0x2e78e8a6, 0x86a337b7), TOBN(0xae1cb84f, 0xd6a4fc64),
+	TOBN(0xbab343f1, 0xc61ff1fa), TOBN(0xe8c63c37, 0x59c2d917),
+	TOBN(0x380d8757, 0xa136d74d), TOBN(0x89c4d6f5, 0x7e7d9af3),
+	TOBN(0x08d59cc3, 0xfed47f66), TOBN(0x97bb4f6a, 0x317dd5c0),
+	TOBN(0xf060e22e, 0xd4aadaac), TOBN(0xdadcf632, 0x007607fb),
+	TOBN(0x1af8596a, 0x1d2ec796), TOBN(0xb0017aaf, 0x57b512b5),
+	TOBN(0x2929e21f, 0x741235bf), TOBN(0x2cfadcf8, 0x21a64a50),
+	TOBN(0x22563aed, 0x2883ff7e), TOBN(0x1505a1c2, 0xe55fc3b1),
+	TOBN(0x01f10664, 0x2e3e6ed4), TOBN(0xfaec97b3, 0x3d98c28f),
+	TOBN(0x34cbd4a6, 0x1c8c79f8), TOBN(0x070a7a81, 0x36a194fd),
+	TOBN(0x85c8337c, 0x30535fc3), TOBN(0xd44f2c3f, 0x68723280),
+	TOBN(0x5ed65f9b, 0x0f3fdf95), TOBN(0x9a0db3c3, 0x172f2f64),
+	TOBN(0xbc9e3f26, 0x9501d822), TOBN(0x92baf56e, 0x57e3eeca),
+	TOBN(0x46caf511, 0x9142f6e7), TOBN(0xcb3e0254, 0x8b2c041c),
+	TOBN(0x3e89ef6d, 0xbc852959), TOBN(0x8000c090, 0x7bc676ed),
+	TOBN(0xbc8d3a51, 0xf302ae06), TOBN(0xdd7e95c9, 0x74d633fb),
+	TOBN(0xac61c35e, 0x36453687), TOBN(0x52a91e47, 0xfc402e6d),
+	TOBN(0xdc91f035, 0x403e61f1), TOBN(0x2b749d6a, 0x637d5133),
+	TOBN(0xc1a1185d, 0x2a07e156), TOBN(0x66d9e5fe, 0x9932540c),
+	TOBN(0x37711b77, 0x5b442662), TOBN(0xad05f26c, 0xd3406e39),
+    },
+    {
+	TOBN(0xe50203af, 0xd4c7b4f6), TOBN(0xa03a009a, 0x440257db),
+	TOBN(0x89966489, 0x7c798fa0), TOBN(0xd09e0230, 0x64af3f50),
+	TOBN(0x420e6683, 0x012f3c98), TOBN(0xd661e1f7, 0x6767197b),
+	TOBN(0xae668777, 0xec3ec4c1), TOBN(0x32bbace3, 0xaa3e404a),
+	TOBN(0x14173ecd, 0x3713c611), TOBN(0x665a0980, 0x41917164),
+	TOBN(0x568e13ea, 0xb490507b), TOBN(0x79e95e8b, 0x8ec8d3a4),
+	TOBN(0xbc185e4a, 0x6b7e5211), TOBN(0xe2d07e88, 0xb3247b2f),
+	TOBN(0x369ff1eb, 0x94cf9d51), TOBN(0x46686165, 0x6dad28ad),
+	TOBN(0x9f072649, 0x51819d1d), TOBN(0xe81c5c9a, 0x59a04099),
+	TOBN(0xbdac5226, 0xf0ad59f3), TOBN(0x557e761b, 0x41888cb8),
+	TOBN(0x03fb8d2a, 0x09d88491), TOBN(0xe0d8f549, 0x3f67bcd0),
+	TOBN(0xb15e028a, 0xfc663a5a), TOBN(0x2c8a8903, 0xedd89847),
+	TOBN(0x1028a7c3, 0x3dd9b181), TOBN(0x9fef4c66, 0x8557e6da),
+	TOBN(0x86ebac15, 0x39e025f3), TOBN(0x17f7980f, 0xbb3f3a82),
+	TOBN(0x030b169a, 0xd6d86685), TOBN(0x2a813d2a, 0xbf1c895a),
+	TOBN(0xba85f183, 0xc6bb1eec), TOBN(0xf1e5579c, 0x83e3c485),
+	TOBN(0xd68c4070, 0xb77ab716), TOBN(0xac1c9953, 0xde814545),
+	TOBN(0x116090d7, 0x2e464c2f), TOBN(0xa388f8d1, 0x899988f1),
+	TOBN(0x3cd37e09, 0x04ff1a96), TOBN(0xcc47a086, 0x4faedafd),
+	TOBN(0xde1d00e6, 0x49356303), TOBN(0xc357da11, 0xf669e40d),
+	TOBN(0x491743ff, 0x35ce95ab), TOBN(0xc99b9aa9, 0xb26c9aca),
+	TOBN(0xbe4fae0d, 0x06033d49), TOBN(0x65271724, 0x3e15d6d9),
+	TOBN(0xaabcdf94, 0xa32cdd8b), TOBN(0xc4fb0022, 0x9c18e18a),
+	TOBN(0xec5c175c, 0x816c2281), TOBN(0x3363db8d, 0xdac380ab),
+	TOBN(0xda4d2da6, 0xd957f1d3), TOBN(0x29d57ec8, 0x1085a3e5),
+	TOBN(0xbbb8fd4e, 0x34285647), TOBN(0x119ba7bc, 0x0d5f313f),
+	TOBN(0x4e61ca56, 0xc6d93fb5), TOBN(0x7058bb12, 0x06e7f004),
+	TOBN(0xb679d54c, 0x6d9a530d), TOBN(0x2fa9cc5d, 0xd91f6139),
+	TOBN(0xd0c47b1a, 0xd6667f9b), TOBN(0xeea51b9e, 0xae27900b),
+	TOBN(0xc6120603, 0xedbf38ef), TOBN(0xbcf9c87c, 0x242b35a6),
+	TOBN(0x5a27a2f6, 0x5f184c2f), TOBN(0x88fcf217, 0x022bb6ee),
+	TOBN(0xf77f2026, 0xcd7e7d7f), TOBN(0xcbe5182c, 0xcd6a62e3),
+    },
+    {
+	TOBN(0xe228ad28, 0xc68ac09c), TOBN(0xa8d4f5a9, 0xf9fc9936),
+	TOBN(0x9ed21d2a, 0xcff11b28), TOBN(0xeb6c6c60, 0x1ed5f971),
+	TOBN(0xdf9b6c79, 0x4226ff9c), TOBN(0x4d09dad5, 0x0983c730),
+	TOBN(0xc18f6380, 0x7d4ef157), TOBN(0xd226335d, 0x8c7cace5),
+	TOBN(0x5367f36b, 0x6ce1e1ea), TOBN(0x682ebb8a, 0x2aa24ba6),
+	TOBN(0xc11560c4, 0xf5491676), TOBN(0x592619ab, 0x740a492e),
+	TOBN(0xade5d78a, 0x9b7d2dbe), TOBN(0x53f8a11a, 0x3857e4a3),
+	TOBN(0x17f17595, 0xd16085e8), TOBN(0xb27ba9bf, 0x8cf67f68),
+	TOBN(0xf1962bfe, 0xe9abe7fb), TOBN(0xbf1351b9, 0x5e9286c0),
+	TOBN(0xc3f8a305, 0xf48cebfb), TOBN(0x22ccf3f0, 0x78e4456f),
+	TOBN(0xd5b17608, 0x27db84cc), TOBN(0x9c83c334, 0x2fa9c23c),
+	TOBN(0x46ab7f9c, 0x0d596c0f), TOBN(0x859e766a, 0xce70146d),
+	TOBN(0x4e19c5f2, 0x5fbb26e6), TOBN(0x71662cee, 0xb68d7253),
+	TOBN(0x15e82d11, 0x27fe4825), TOBN(0x0372f7aa, 0x8dc2f507),
+	TOBN(0x0ab219db, 0x9cb2602d), TOBN(0x18e00518, 0xb1925b21),
+	TOBN(0x49cbba1f, 0xf04e0f83), TOBN(0xb6dc9001, 0x34b7a3f9),
+	TOBN(0xcf1eee00, 0xa073e75b), TOBN(0xc5d3b16e, 0x08041088),
+	TOBN(0xaadaf444, 0x8be4354f), TOBN(0x927f19a7, 0x91698a1f),
+	TOBN(0x81718475, 0xff53e9fe), TOBN(0x7266c408, 0xa5fc6d57),
+	TOBN(0xda475eb2, 0x1e4faf65), TOBN(0x1e2719f1, 0x2a81620e),
+	TOBN(0x9b879232, 0x5d67bb8f), TOBN(0x76e1ee30, 0x1a20ef72),
+	TOBN(0x2bc8b1ca, 0x5425bed1), TOBN(0xa248ebfa, 0xcd48a6c1),
+	TOBN(0x90879ffe, 0xfd0fb6ef), TOBN(0x416e2b1f, 0x8e935419),
+	TOBN(0xcb275303, 0x43207984), TOBN(0x1e5ca2e1, 0x79a75d9b),
+	TOBN(0x45d5b070, 0x53f7a85d), TOBN(0x13d034a3, 0xe1d251cc),
+	TOBN(0x82520cf3, 0xc94971e9), TOBN(0xeab6b021, 0xcc73a5a6),
+	TOBN(0xdbaf5b47, 0xc4fccb72), TOBN(0x7d6ed3b3, 0x345838d4),
+	TOBN(0x0183f2c1, 0xc18ffa96), TOBN(0xdde12241, 0x01575972),
+	TOBN(0xea9cee4d, 0xee24afab), TOBN(0x4bfa9268, 0xddb43076),
+	TOBN(0xe8a806c0, 0xdafa9c31), TOBN(0x14f57223, 0xb693da29),
+	TOBN(0x03f828b2, 0x8027dfc6), TOBN(0x12487540, 0xa3182d92),
+	TOBN(0xc6044af2, 0xd0b344b7), TOBN(0x211403b5, 0x7c5ebae7),
+    },
+    {
+	TOBN(0xc6d0dae4, 0xdc2899d8), TOBN(0xb5010e0a, 0x898edb7a),
+	TOBN(0x816d0efc, 0xe605719a), TOBN(0xab0ef026, 0xfd9d3f68),
+	TOBN(0xab3d574a, 0x47a1dff2), TOBN(0xcaa2e7c7, 0x56fe8b1c),
+	TOBN(0xfa1575eb, 0xaad4997a), TOBN(0x7f37e7c9, 0x0be5e116),
+	TOBN(0x52e4ae11, 0x90f3e432), TOBN(0x66e94417, 0xc15945c0),
+	TOBN(0xaaff6f95, 0x867f5784), TOBN(0x4c03cfc7, 0x4774e5eb),
+	TOBN(0xe5c71f7b, 0x5562d73a), TOBN(0x36e77925, 0x2f6ef2c3),
+	TOBN(0x1275581f, 0x9731a973), TOBN(0xa268b656, 0xf6ba2ff4),
+	TOBN(0x78c83e00, 0x4f74edd5), TOBN(0x7a7bafb1, 0x965b818b),
+	TOBN(0x841946ea, 0x38df39eb), TOBN(0x2974a45a, 0xcc4c9a03),
+	TOBN(0x2270b3cb, 0x46d30a34), TOBN(0x72b4e63f, 0x992aaf9e),
+	TOBN(0x4531c555, 0xdb760b30), TOBN(0xabfa601c, 0xbcb7cade),
+	TOBN(0x532674ff, 0x2af7eaa2), TOBN(0xbcedfc79, 0x147a7fa8),
+	TOBN(0x6fe1bd39, 0x7ea78cd9), TOBN(0x74c89fc7, 0x0574edc6),
+	TOBN(0x1f804123, 0x16bdd2ba), TOBN(0x0a5bd415, 0x94e9aef7),
+	TOBN(0x1cfe144a, 0x180ae604), TOBN(0x64041dc9, 0x6a2be8b6),
+	TOBN(0x10597996, 0x3a862d3f), TOBN(0xe5e9e351, 0x43d263d4),
+	TOBN(0x6e090e59, 0xb470401d), TOBN(0xf8cd6c99, 0x3788474e),
+	TOBN(0xd6ee6db9, 0xed4ce7b9), TOBN(0x904e05ab, 0xa2e3081e),
+	TOBN(0x7398f92d, 0x647916b2), TOBN(0xe9c0d5c0, 0x6b135e50),
+	TOBN(0x9b9864a7, 0xcf38b3a7), TOBN(0xb0d52af1, 0x59f3f8c5),
+	TOBN(0x6b2462f4, 0x618fb2cc), TOBN(0xe0861937, 0x1ff67c9b),
+	TOBN(0xa78dee0e, 0xdb7c1d54), TOBN(0x10136da6, 0x4390bc4d),
+	TOBN(0xe71cdade, 0xc6a87931), TOBN(0xd0683739, 0x32519f8d),
+	TOBN(0x0ced95fb, 0x0469561f), TOBN(0x2ad5f342, 0xa0413a22),
+	TOBN(0x0fe5f147, 0xb33b8fd5), TOBN(0x90a7ec67, 0x3c764cd2),
+	TOBN(0x8b6b6395, 0x8a041a80), TOBN(0xbbe1d60a, 0xbb11258e),
+	TOBN(0xda3c5d32, 0xe0609c4d), TOBN(0xc34534d3, 0x7a8699aa),
+	TOBN(0x4db432a2, 0x5fe425e6), TOBN(0x29c79a0d, 0x27a2d318),
+	TOBN(0x5abf649e, 0x3d9e162a), TOBN(0xeb078a04, 0x9dd0c0bc),
+	TOBN(0x33125ce8, 0x9fd9b17d), TOBN(0xc353eecd, 0x0a5e4b5b),
+	TOBN(0x7a7c3ab6, 0xe53757af), TOBN(0x4e092994, 0xdf51cc36),
+    },
+    {
+	TOBN(0xd4d64bc5, 0x515064df), TOBN(0x1c205b75, 0x0a9774d4),
+	TOBN(0x8b6ac2db, 0x88ba485d), TOBN(0x97dde775, 0x70b09626),
+	TOBN(0x6488a5b9, 0x81a5a7c7), TOBN(0xc84ae5e2, 0xa21bb2d3),
+	TOBN(0x8e690630, 0x5fc4e143), TOBN(0x1fe2c091, 0x62ae5ec8),
+	TOBN(0xd1f20471, 0xa5a3255f), TOBN(0x6a82c8c0, 0x2dbefbcb),
+	TOBN(0x175ad078, 0xc65d1ea4), TOBN(0xf647b405, 0xd37cbaac),
+	TOBN(0x7d595817, 0xd72caf12), TOBN(0x9538a324, 0x47cb1a88),
+	TOBN(0xfe25a0b0, 0x5954d359), TOBN(0xeaf85560, 0x20aabbb7),
+	TOBN(0xb6af66a3, 0x6a06691d), TOBN(0xd2614ea5, 0xc472ee9d),
+	TOBN(0x9b96f220, 0x00e21e6e), TOBN(0xb84ad84f, 0x4c95fb0b),
+	TOBN(0x117696ea, 0x3e984e68), TOBN(0xc90062fe, 0x525fddbc),
+	TOBN(0x0f016930, 0x4ef4d4eb), TOBN(0x491bf977, 0xb6411168),
+	TOBN(0xec0d2aee, 0xa017d90a), TOBN(0x055834da, 0xdc5949a1),
+	TOBN(0x91a726e4, 0xb3bc8e55), TOBN(0xfe4bdc11, 0xc5c39fcf),
+	TOBN(0x1d01cb50, 0x0197eee1), TOBN(0xda00b76c, 0x04bbb17b),
+	TOBN(0x60b55c39, 0xa05fa3d7), TOBN(0x19bc5118, 0x6838863d),
+	TOBN(0x47dab92d, 0x0f77f6c6), TOBN(0x591cb908, 0xce921dcf),
+	TOBN(0x6468daf0, 0x22422d1b), TOBN(0xa86a0541, 0xec2a4825),
+	TOBN(0x809c2ad8, 0x91852a3c), TOBN(0x257ccd75, 0xed6e0833),
+	TOBN(0x34a2e267, 0x143ec983), TOBN(0x5d8a8db9, 0x06c3c334),
+	TOBN(0xd70ccd7d, 0x91eb7c3a), TOBN(0xb34e631c, 0x6ea2ed00),
+	TOBN(0x1db8023d, 0x4c3671e7), TOBN(0x4c879c58, 0x7c21cdab),
+	TOBN(0x07bc0382, 0x371e2c63), TOBN(0x39a3833f, 0x662db490),
+	TOBN(0x88168bd5, 0x4351fc2c), TOBN(0x8e9a5ad9, 0xcd0e7121),
+	TOBN(0xed592ef9, 0x43a9214e), TOBN(0x3ea67352, 0x384a5fdb),
+	TOBN(0x54aec661, 0x930990ac), TOBN(0xcf5fe3c9, 0x7fc52a6b),
+	TOBN(0x4be9bbc4, 0x7dd7adf7), TOBN(0xcb941f27, 0x92943785),
+	TOBN(0x8a1cb60b, 0x82e6aca4), TOBN(0x2a5ea3d8, 0x130bae99),
+	TOBN(0x13478c41, 0xa6a930be), TOBN(0xabf727b8, 0x016b7d6f),
+	TOBN(0x4902f273, 0x611f5123), TOBN(0x3f232f12, 0x2661286b),
+	TOBN(0x00c25245, 0x207cfedb), TOBN(0xb8b0510e, 0x46a80e86),
+	TOBN(0x42f5ea8f, 0x9f2b71ac), TOBN(0x8492baef, 0x215e1378),
+    },
+    {
+	TOBN(0x4016d29d, 0x08133ed1), TOBN(0x140875b9, 0x8b564c79),
+	TOBN(0xba0f2ed8, 0xc5bccc90), TOBN(0xa9fd9621, 0x784f9679),
+	TOBN(0x7ccfbb5e, 0xaab0c020), TOBN(0xde27ad4f, 0xc4a57c44),
+	TOBN(0xdb283fab, 0x27141d04), TOBN(0xb6b6bb8e, 0x4c81cbf7),
+	TOBN(0x53e17cce, 0x0ea04240), TOBN(0x670016bb, 0x457122b9),
+	TOBN(0x907b7b92, 0xab49a043), TOBN(0xf6a6bb59, 0xc6b69908),
+	TOBN(0x50992e64, 0xf45c1d56), TOBN(0xa6684756, 0xdbbbbb57),
+	TOBN(0xc922cda4, 0x29610df7), TOBN(0x90f0fcdb, 0x9209a491),
+	TOBN(0xbaec9612, 0x0bd134e7), TOBN(0x2b7dcbc4, 0x6e949526),
+	TOBN(0xb6cbedb4, 0xe198f1da), TOBN(0x9448fe6d, 0x197a9bd0),
+	TOBN(0xef3927b7, 0xc2b08b5c), TOBN(0xe0abfc0c, 0xfba004ad),
+	TOBN(0x09d324ac, 0x8731efdd), TOBN(0x87356190, 0xf1375e03),
+	TOBN(0x30d63e42, 0x297e2219), TOBN(0x884652ca, 0x28cbedcd),
+	TOBN(0x517c36ed, 0x70a01a84), TOBN(0x1bdf57cf, 0x551628aa),
+	TOBN(0x3ce0ce7b, 0xd5958176), TOBN(0x8203ccdc, 0x0aac2ffc),
+	TOBN(0x886c8d29, 0xe526fe22), TOBN(0x51195312, 0x85be1b69),
+	TOBN(0x47601356, 0x02aeb5c7), TOBN(0xa3f67a8e, 0x08e0fcaf),
+	TOBN(0x3698a9d0, 0xc6b903f7), TOBN(0xe194ab8a, 0xbd192eb8),
+	TOBN(0x26e72442, 0x900f6aa9), TOBN(0x57ec4030, 0x97bb3cf5),
+	TOBN(0x58f122bf, 0x672cf666), TOBN(0x70de0369, 0x801f7603),
+	TOBN(0x4529f1e7, 0x0cf915f9), TOBN(0x931eba79, 0x6f2dc783),
+	TOBN(0x7f46e850, 0x2cd75510), TOBN(0x5a60978d, 0x568a53ea),
+	TOBN(0xdbf0c154, 0xe612188e), TOBN(0xe7a1ed77, 0x2ecd6f4e),
+	TOBN(0x63bb4b72, 0x9c5ec1a6), TOBN(0xdce448db, 0x9c76c812),
+	TOBN(0x4ac97174, 0x30136d0e), TOBN(0x3b316975, 0xfa4cdca3),
+	TOBN(0xb91f9405, 0x140230fa), TOBN(0x0ef8fb69, 0xa004107d),
+	TOBN(0x5df68fe6, 0x49a97a33), TOBN(0x52fd3812, 0x9f8ffa72),
+	TOBN(0x2821e00d, 0xc752b333), TOBN(0xdcc09154, 0x53293b3b),
+	TOBN(0xd3d05555, 0x6318c955), TOBN(0xa037db4e, 0xa7eb8189),
+	TOBN(0x5240a44c, 0xc2bb6c20), TOBN(0x059e2c35, 0xe8641dcd),
+	TOBN(0xad6f5d64, 0x57a0ef28), TOBN(0x1bd98503, 0xbe086626),
+	TOBN(0xde137414, 0xc0d0f2b6), TOBN(0xf66b17a2, 0x1d1d5c7c),
+    },
+    {
+	TOBN(0x8b938973, 0x08029694), TOBN(0x0d933ba9, 0x9d6b67d5),
+	TOBN(0x33cfbf05, 0xf3267873), TOBN(0x79c7bc22, 0xc96f36a2),
+	TOBN(0xb362d702, 0x87fc4a30), TOBN(0x85609996, 0x749b6ea3),
+	TOBN(0xef36cd37, 0xbc215518), TOBN(0x738e905c, 0x5bbbb7ec),
+	TOBN(0x6300891e, 0x58c98311), TOBN(0x46fccae6, 0x1ca637fc),
+	TOBN(0x3f72a28d, 0xe6799d47), TOBN(0x035d6095, 0x1207f873),
+	TOBN(0xc4c02725, 0x2639c5fc), TOBN(0xfa1beccb, 0x0229c96e),
+	TOBN(0x768b620c, 0x60de60b1), TOBN(0x78774a50, 0xddb565ff),
+	TOBN(0x4e7480a8, 0x9fb51911), TOBN(0xded199a9, 0xc1308b3f),
+	TOBN(0xafb7dd24, 0xd190627b), TOBN(0xda53999a, 0xa4e9c529),
+	TOBN(0x21491880, 0x52386eb6), TOBN(0xab48bcf6, 0xf73500f3),
+	TOBN(0xc2525317, 0xecaaf885), TOBN(0xdd765503, 0x812a6f58),
+	TOBN(0x3f6fcf61, 0x75f0772a), TOBN(0xffe5e3f4, 0x55bd629e),
+	TOBN(0xb7547989, 0xbb51df7c), TOBN(0x39c700e4, 0x5470aced),
+	TOBN(0x88e49b2e, 0xf116a481), TOBN(0xe7be0612, 0x580d5646),
+	TOBN(0x01e96087, 0xc61fe849), TOBN(0x0bca2520, 0x5900d917),
+	TOBN(0x330849d6, 0xb6dfa696), TOBN(0xc47753bc, 0xd0b3ea3c),
+	TOBN(0x336f3c1b, 0x00f57c0f), TOBN(0x2d2d89f9, 0x97005d72),
+	TOBN(0x13874bea, 0xd82f9264), TOBN(0x1e4910f9, 0x79961639),
+	TOBN(0xcadfcc1a, 0x71aada28), TOBN(0xafcc2941, 0xd4da8cc6),
+	TOBN(0xa7dd7837, 0x4bd5b88d), TOBN(0xf6a0f0d2, 0x00773682),
+	TOBN(0x8782055e, 0x039aab63), TOBN(0x25eeacf6, 0x4d86aefc),
+	TOBN(0xeb560a91, 0x7a8742fd), TOBN(0xb8552674, 0x9808804b),
+	TOBN(0x73419f64, 0xb5273507), TOBN(0xe995ae26, 0x6e071829),
+	TOBN(0x3167cf25, 0xac76a670), TOBN(0x7408ffb1, 0xa35a0c00),
+	TOBN(0x6d1f719d, 0xf36f2bcf), TOBN(0x098fdfd5, 0x6b62b13b),
+	TOBN(0xe761958b, 0x6366d971), TOBN(0xdff3f69f, 0x6afc8d2f),
+	TOBN(0x26ebbcc8, 0x733e0c62), TOBN(0xfa08a538, 0x81b384ea),
+	TOBN(0x7c106ba6, 0xaa3bc243), TOBN(0x6248c0a7, 0x6c34a373),
+	TOBN(0x57cd0351, 0x19d95b5e), TOBN(0x5c4921b7, 0x33fd050f),
+	TOBN(0x6eadaa18, 0xf5da6b48), TOBN(0xd69091b4, 0x0d9c4824),
+	TOBN(0xb4ddb3d2, 0x27c8a35e), TOBN(0x461dedfc, 0xf140fca3),
+    },
+    {
+	TOBN(0xb33d322b, 0x3bc932d6), TOBN(0xf8a36e59, 0x4ab1fe79),
+	TOBN(0x774802e3, 0x609ceb63), TOBN(0xe9be2532, 0x28e35f80),
+	TOBN(0x7e2a0864, 0xd431e218), TOBN(0xa7c84dfa, 0xed7def8d),
+	TOBN(0xa5c044d1, 0xe78a511f), TOBN(0xf0e62523, 0x8dd3894a),
+	TOBN(0xe333312a, 0x8ac9199c), TOBN(0x5a45b630, 0x461dea61),
+	TOBN(0xac7160ff, 0xef203882), TOBN(0x5593ac7a, 0x723a8a4e),
+	TOBN(0x9271af1b, 0x61e19ed2), TOBN(0x6a42e3ee, 0x2b27eb40),
+	TOBN(0x6f114911, 0xcb2968f1), TOBN(0x71a7af1e, 0x553a84ce),
+	TOBN(0xa550d22f, 0x0f49a20d), TOBN(0xc7b6e158, 0x0b470248),
+	TOBN(0x2a1660d1, 0x8917d960), TOBN(0xe690e9a9, 0xc3d1c449),
+	TOBN(0xa125a949, 0x86bcdd4d), TOBN(0xca489cba, 0xa12c6068),
+	TOBN(0x5842e6ce, 0xc210a51a), TOBN(0xe11e742d, 0xc6a36a64),
+	TOBN(0xd20dc6c1, 0x11a820f2), TOBN(0x2fba2138, 0x72ee87fa),
+	TOBN(0xb94f2c22, 0x0e3b10c8), TOBN(0xf8288098, 0x4a44d7da),
+	TOBN(0x85c21af5, 0x5d7053ed), TOBN(0xf1576fc5, 0x95b4ec32),
+	TOBN(0x8b1840da, 0x00de36b8), TOBN(0xae76f34a, 0xad638bcc),
+	TOBN(0xf842cb6e, 0xfd9f24ac), TOBN(0x78410db2, 0xf5df1ba6),
+	TOBN(0x550a2a58, 0xd6396ee7), TOBN(0xa4542d12, 0xc8e38ee7),
+	TOBN(0xb987977b, 0xdfbbc541), TOBN(0x086d4e71, 0xfb8e4c87),
+	TOBN(0x494b3680, 0x2a6b7556), TOBN(0x159edf7d, 0x3c2b8987),
+	TOBN(0x0a731543, 0xf2943378), TOBN(0x10c6072f, 0x09a0fb31),
+	TOBN(0xd30ebbc6, 0x84aef074), TOBN(0x779f4480, 0x7af8736f),
+	TOBN(0xa91b4f94, 0x40999be7), TOBN(0x34953780, 0xd1e60287),
+	TOBN(0x63feca7c, 0x4eee3fd7), TOBN(0x1016559a, 0x9d66b671),
+	TOBN(0xf58111c2, 0x57e774c8), TOBN(0xfdc9b9a5, 0xd704a936),
+	TOBN(0x0286e6ce, 0xc3463766), TOBN(0x862639d5, 0x0de15d50),
+	TOBN(0xa8a89e59, 0x8652f02f), TOBN(0x28ee0707, 0x54ba903c),
+	TOBN(0xfc2d45b8, 0x4f10247a), TOBN(0xac5c352f, 0xc90e014c),
+	TOBN(0xefa43bdf, 0xf833d8e1), TOBN(0xc22f169c, 0xc8d6f1d2),
+	TOBN(0x21da8735, 0x70c5c746), TOBN(0x71912e62, 0xc200280f),
+	TOBN(0xdf0ef4be, 0x4f21a02a), TOBN(0x90f38ee1, 0x699257b1),
+	TOBN(0xb1247dcd, 0x84a50232), TOBN(0x622a1133, 0x52879a26),
+    },
+    {
+	TOBN(0x7d48ec51, 0x6100647d), TOBN(0x95a5b599, 0xf9abd509),
+	TOBN(0xb4c78e2d, 0xc5f82d1e), TOBN(0xa44356bf, 0xc5036007),
+	TOBN(0xbdfbe6dc, 0xe367a2da), TOBN(0x26f9ff1c, 0x3b427db1),
+	TOBN(0x24104c2b, 0xa6df4e77), TOBN(0x5d356a41, 0x85822aab),
+	TOBN(0xf64b24a9, 0xf7092793), TOBN(0x9efd2308, 0x30c16ac5),
+	TOBN(0x71bb9772, 0xc5b8bef0), TOBN(0x40e8a114, 0x9ba90254),
+	TOBN(0x00f94828, 0x06de0b09), TOBN(0xea7d5c70, 0x4932d184),
+	TOBN(0xe90a272b, 0x9e18e14c), TOBN(0xb298fa05, 0xf2d074cf),
+	TOBN(0x38e40598, 0x25263276), TOBN(0x520b36dd, 0xf93064bb),
+	TOBN(0x517c69a5, 0xbf445bad), TOBN(0x51d792be, 0xa15b3ea8),
+	TOBN(0xa33324ff, 0x6f93692f), TOBN(0x310c3b53, 0xed5359d9),
+	TOBN(0xfe0cc322, 0xd96f19fd), TOBN(0x59bbdf30, 0x3a455e5b),
+	TOBN(0x1296935d, 0x6fa385bb), TOBN(0xf7c739df, 0x415b35d6),
+	TOBN(0x907fff23, 0x51d0ebd5), TOBN(0x38e9d1cf, 0x0e685219),
+	TOBN(0x80fe1e2c, 0xe1a150f8), TOBN(0x011d255b, 0x1e831bdd),
+	TOBN(0xf0965e47, 0x96192f98), TOBN(0x3d03dca9, 0x4e06761a),
+	TOBN(0xe10ca4c1, 0x9f16d5e7), TOBN(0x0557456c, 0x6c34aa52),
+	TOBN(0x97a0d30a, 0xb76176ad), TOBN(0x7b8afcd9, 0x5a51025e),
+	TOBN(0x135c90e4, 0xb5174676), TOBN(0x1866bb8c, 0x3ed31216),
+	TOBN(0x4949954e, 0x830d4e0b), TOBN(0x72085acb, 0x7e14c005),
+	TOBN(0xba04ec90, 0x748bedde), TOBN(0x8c2a5f8e, 0x028aa818),
+	TOBN(0xa08bd6f4, 0x3060f082), TOBN(0x5641f898, 0xac1a0c77),
+	TOBN(0xd7ae05aa, 0x76fd40ef), TOBN(0x1255e767, 0x59c39c26),
+	TOBN(0xe7db3853, 0x3dbc606d), TOBN(0x4f510827, 0xd87051ff),
+	TOBN(0x09dca31b, 0xba0c4d15), TOBN(0xdd92ff32, 0x9c76ca4e),
+	TOBN(0x910399f8, 0xc59dce19), TOBN(0x7d59e49b, 0x1c17cbdb),
+	TOBN(0x72b8e0d5, 0x146aec03), TOBN(0xf4610107, 0x93d8e70c),
+	TOBN(0xb518b9c7, 0xe1530785), TOBN(0xba983245, 0xbd25fbee),
+	TOBN(0x91478517, 0xe3b5bad5), TOBN(0x1af9ae29, 0xb66328ea),
+	TOBN(0x41dbc272, 0xe5e25226), TOBN(0x49abb0ad, 0x1753602c),
+	TOBN(0xb31611c5, 0x657d9b9b), TOBN(0xe7f8773d, 0xf0c94fec),
+	TOBN(0xbfdb420c, 0x2c1a757d), TOBN(0x96c97e5e, 0x2539c9a1),
+    },
+    {
+	TOBN(0xd37f747a, 0x9ec9b35d), TOBN(0xbadb76c0, 0xc8342a1b),
+	TOBN(0x0704234e, 0x8a753f1e), TOBN(0x0df1f43b, 0x0af6c7c9),
+	TOBN(0xac6ce98d, 0xb1c1075a), TOBN(0xe9e82b3d, 0x8955284b),
+	TOBN(0x4acd7f8c, 0x26de8f9f), TOBN(0xd40614d9, 0x7901a50c),
+	TOBN(0x9d05c5a4, 0x5effdd74), TOBN(0xdc6f651e, 0x76600d42),
+	TOBN(0x02d4e703, 0xc5c31c48), TOBN(0x7f89e863, 0x7f471258),
+	TOBN(0xf756d95b, 0xe669c22b), TOBN(0x1c207e1c, 0xe5023ac3),
+	TOBN(0x7c805654, 0x64b6e692), TOBN(0xfca1e889, 0xfdc7d141),
+	TOBN(0x190541ec, 0xe6108125), TOBN(0x4c25ae27, 0x9a244493),
+	TOBN(0x218f71d7, 0x6a3ee90c), TOBN(0x38c758da, 0x7b4b4c37),
+	TOBN(0x1e7dde78, 0x0d4c6409), TOBN(0x798f0975, 0x47e9b69a),
+	TOBN(0x0c679c5c, 0xdc9cbf63), TOBN(0x0bbcbb1c, 0x7c08d516),
+	TOBN(0x3b934e55, 0x4c2c0ee9), TOBN(0xb301bef3, 0x5cc99ea2),
+	TOBN(0x169410ef, 0xfcd94a65), TOBN(0x63f3aeb5, 0xc7be8efb),
+	TOBN(0x35fff29d, 0xef499843), TOBN(0xae9189d1, 0x7b7b3aa4),
+	TOBN(0x4fc0e441, 0x1dc87ebd), TOBN(0x4b265b6a, 0x4c3aa9e5),
+	TOBN(0xb2a07400, 0xcb305743), TOBN(0xc648863a, 0xb1aa0e54),
+	TOBN(0xeba6f71a, 0xb4b19d36), TOBN(0x28b28e65, 0x20da5117),
+	TOBN(0xfdb9be98, 0x50ff9fbe), TOBN(0x4ac5d8f8, 0xe4c561fc),
+	TOBN(0x3c6a4e7d, 0xd4d113c2), TOBN(0x88ba984a, 0x5f3f9fc2),
+	TOBN(0xf5b79f26, 0xebd34427), TOBN(0x015ea6c7, 0x82316c5d),
+	TOBN(0xcdd45563, 0x3cac01a2), TOBN(0xb4b2fd63, 0xdf931f31),
+	TOBN(0x1323b1a5, 0x23a862c5), TOBN(0x33007b7a, 0xc11d40ce),
+	TOBN(0xed7e8088, 0x91a1db83), TOBN(0xc1457c69, 0xa9facefc),
+	TOBN(0x7e793aff, 0x4191642b), TOBN(0xa0793cf6, 0xfbff4399),
+	TOBN(0x94ad0612, 0x6935f184), TOBN(0x6cde43b6, 0x24318632),
+	TOBN(0xcd6c4140, 0x75942bba), TOBN(0xa4286aa5, 0x2467863b),
+	TOBN(0xb5425091, 0xfa898962), TOBN(0xa4eb9534, 0xdfbfa699),
+	TOBN(0x610fad3f, 0x313c31e8), TOBN(0xc5c9638b, 0xdf6c43dc),
+	TOBN(0xf49952c4, 0x3667fd9b), TOBN(0xbcc390d0, 0x4808db3e),
+	TOBN(0x6e0b4b10, 0xc8c5715e), TOBN(0x2bccb12b, 0xfeb1de94),
+	TOBN(0xdcee1272, 0xf9fa5349), TOBN(0xcb724ffd, 0x6b8f6ed4),
+    },
+    {
+	TOBN(0x5557f0aa, 0x0ce3d494), TOBN(0xf3bf2509, 0x41566e81),
+	TOBN(0x37ed4722, 0x36763625), TOBN(0xd1cd0719, 0x3b9d4527),
+	TOBN(0x87fa74b5, 0x5c71bbe1), TOBN(0x9287e243, 0x7c067fcf),
+	TOBN(0x1bae1a48, 0x394d20fc), TOBN(0x41416848, 0xfd4b3447),
+	TOBN(0x54a715b5, 0xe04cef87), TOBN(0x7720ed1c, 0xed16d233),
+	TOBN(0x153056c2, 0x147d847a), TOBN(0xa1ca920a, 0xaa71d8d7),
+	TOBN(0xa13ddb20, 0x1afd7e6f), TOBN(0x140e7cda, 0x2fa8f9d3),
+	TOBN(0x90ba3008, 0x635e2454), TOBN(0xbb2bea68, 0x05a38da8),
+	TOBN(0x987bf28b, 0xc1dc6878), TOBN(0xe7f42967, 0xcfecfa0b),
+	TOBN(0x4fca3f66, 0xde05b3fb), TOBN(0xb8a1bd6c, 0xa473fff6),
+	TOBN(0xbfb356f9, 0x3d3a52f5), TOBN(0xbc673c9b, 0xb28e7edd),
+	TOBN(0x6a73451f, 0x2ce10b41), TOBN(0x345056db, 0x9e199ffe),
+	TOBN(0x0292b6c3, 0xdb8fd58a), TOBN(0x2499e232, 0x1a1f88ed),
+	TOBN(0x655bba2a, 0xc44769f1), TOBN(0xb73478c1, 0xc398574c),
+	TOBN(0xc08ec61a, 0xb1459bc2), TOBN(0xe937c792, 0xe59596e7),
+	TOBN(0xde9150f3, 0xcf64801d), TOBN(0x9877956c, 0x4ebc7e06),
+	TOBN(0x147b1f8f, 0x1cbb4a64), TOBN(0xe4979db9, 0x66262831),
+	TOBN(0xe8e6b7b1, 0xc92c627a), TOBN(0x138165cc, 0x4a3a3fb4),
+	TOBN(0x6f0cc790, 0x7c272d21), TOBN(0x23656d74, 0x0eb98b85),
+	TOBN(0x8d391d95, 0x272f1e7d), TOBN(0x5ea0bc71, 0xcb3b156c),
+	TOBN(0xd2803cf1, 0x2cda54c9), TOBN(0xeaff04fc, 0xc48ec51a),
+	TOBN(0x4536911a, 0x1ca928b7), TOBN(0x341b836f, 0x177efe24),
+	TOBN(0x6dafb7ed, 0x400fc124), TOBN(0xbfdbe930, 0x653c32c3),
+	TOBN(0x45caf07d, 0xcd610ebc), TOBN(0x2eab25c8, 0x9d797f2b),
+	TOBN(0x21d1a79b, 0xd2c41254), TOBN(0xc7e6dff2, 0x890d97ac),
+	TOBN(0xd8b3d90b, 0x9a92cf87), TOBN(0x29049d11, 0x7f0fec2c),
+	TOBN(0xd7c7484a, 0xceda4bfa), TOBN(0xc83d4015, 0x9051e87b),
+	TOBN(0xc5ba9346, 0x538dbe47), TOBN(0x49711f90, 0x24dd3e59),
+	TOBN(0xfe6f52b6, 0x240f0921), TOBN(0x4f7421c7, 0x5d926fa0),
+	TOBN(0x1c0bf04c, 0x22d8669a), TOBN(0x717a5bd3, 0xb5de7036),
+	TOBN(0x570ff5c2, 0xa5faf731), TOBN(0xb7365a9b, 0xc6c7fb72),
+	TOBN(0xa213baed, 0xb7d03487), TOBN(0xae525cb3, 0x93cc1dad),
+    },
+    {
+	TOBN(0x1fb3f6e3, 0xe47338cf), TOBN(0x604fb7f2, 0xf1b97354),
+	TOBN(0x1bed174c, 0x27673e8a), TOBN(0xa11bce30, 0x72b0844b),
+	TOBN(0x44f6ed28, 0x63c6d581), TOBN(0xc51c9ed3, 0x9f667d45),
+	TOBN(0x09780d78, 0x1fb61ff1), TOBN(0xaf49a6ec, 0xcc1b96c1),
+	TOBN(0x11edf600, 0xb2b32203), TOBN(0x9d97a4b8, 0xce47324e),
+	TOBN(0x4e6c4dc1, 0x8bc4b01d), TOBN(0xcd045bc4, 0x704df69d),
+	TOBN(0x42764e4e, 0xeb1561e1), TOBN(0xc197a4e3, 0x2e8d089c),
+	TOBN(0x66be6f8d, 0x6c1ddaeb), TOBN(0xdf336b87, 0xc170faa9),
+	TOBN(0x6ed6fa8e, 0x03d6a98d), TOBN(0x49195b7d, 0x1429e7f8),
+	TOBN(0x47dc48c4, 0x5fd4a75b), TOBN(0x09d3a5a9, 0xc61fa453),
+	TOBN(0x0e81fc48, 0xce83c006), TOBN(0x8242eab7, 0xd07f0743),
+	TOBN(0x7c16d018, 0x2a65b303), TOBN(0x583baf9f, 0x3186cb23),
+	TOBN(0xad4f47a8, 0xbec83c99), TOBN(0x4c3a3495, 0x6398b2ea),
+	TOBN(0xb8410873, 0xfd12b744), TOBN(0x94b73d0b, 0x0f6c4898),
+	TOBN(0x77e2fd95, 0xccf91e07), TOBN(0x156cbf1d, 0x5225f3ca),
+	TOBN(0x3e003b13, 0xd5ce05e8), TOBN(0x4a5436ac, 0xaca89dba),
+	TOBN(0x70f4b33a, 0x0d5e0f6b), TOBN(0x96f5f215, 0x99a3c026),
+	TOBN(0x8407c27f, 0x0999433a), TOBN(0xee30cdd7, 0x811988ca),
+	TOBN(0x0881be6a, 0x5148bcd8), TOBN(0x2d787928, 0x9c26dc0e),
+	TOBN(0x7d37a359, 0x90228c84), TOBN(0xeb85e0c6, 0x08aacea0),
+	TOBN(0x49b237cf, 0x54cd1a1e), TOBN(0xeea1f703, 0x319c7abe),
+	TOBN(0xdc0e45f0, 0x34eca43a), TOBN(0x2e088246, 0xcdc59bdb),
+	TOBN(0xaa956b37, 0xd51528f4), TOBN(0xed59421e, 0xcf1ef331),
+	TOBN(0x6a2c063b, 0x9a4c6bd9), TOBN(0xb8b6cb19, 0x0ab85e35),
+	TOBN(0x912dbe14, 0xd59b8651), TOBN(0xb23be791, 0xd2cf38ca),
+	TOBN(0x8a3e74b1, 0xd8cf35fb), TOBN(0x7a9d3772, 0xb0316a37),
+	TOBN(0xce194723, 0x451bb5c7), TOBN(0xcb5f4443, 0x84dbf422),
+	TOBN(0x0233b2ed, 0xe5f81d74), TOBN(0xef280b38, 0x3cc51a08),
+	TOBN(0x7af548cc, 0x8701ab36), TOBN(0x3f0ff36a, 0x99d54a1a),
+	TOBN(0xa9bcab4c, 0x7fb71eeb), TOBN(0x38731361, 0xb12df10d),
+	TOBN(0xed523e25, 0x0266ba6c), TOBN(0x08e30681, 0x208d4710),
+	TOBN(0xf7d2baba, 0x31ce0ee8), TOBN(0x78d2e7e9, 0x946c4313),
+    },
+    {
+	TOBN(0x443c4905, 0x65bc45c7), TOBN(0xfd2f2329, 0x74fa338a),
+	TOBN(0xa808e059, 0x703c9358), TOBN(0xe9597079, 0x48d38a43),
+	TOBN(0xc1105c21, 0x76e66891), TOBN(0x493c608a, 0x37eae1a9),
+	TOBN(0xca4d191d, 0x241fa509), TOBN(0x37101af5, 0x6d141cb6),
+	TOBN(0x649828e2, 0xe5de257b), TOBN(0x7057fdab, 0xa759e777),
+	TOBN(0x1879aac3, 0x7d271882), TOBN(0x25affa8b, 0xd1e5467e),
+	TOBN(0x27fc977f, 0x1290f98d), TOBN(0x2baa0aac, 0x69f91081),
+	TOBN(0xbd014d5b, 0xff9b35d2), TOBN(0xaae6de35, 0xf59f9d20),
+	TOBN(0xfc443c3d, 0x3e2ef535), TOBN(0x25cf4cc1, 0x0838382b),
+	TOBN(0x44a4cbfd, 0x3dd992ac), TOBN(0x89bbe5f4, 0x6263a525),
+	TOBN(0x9d15a1ad, 0x8c2a5976), TOBN(0x064e3c62, 0x048248f4),
+	TOBN(0xd0cf375f, 0xbaed53c4), TOBN(0x717e9ed4, 0x11b1e5ea),
+	TOBN(0x64ed1372, 0xc161921f), TOBN(0xa2f5cca9, 0x90209219),
+	TOBN(0xb540239d, 0x2935936c), TOBN(0xa8c18d1c, 0xafb62e9a),
+	TOBN(0x1823d66f, 0x1d7e0d10), TOBN(0x8cd8cf13, 0x725eb8b5),
+	TOBN(0xafeddd2c, 0x74f3a82c), TOBN(0xe931fee8, 0xf14d1a6d),
+	TOBN(0xb5e8fab9, 0x0baa7499), TOBN(0x9db89a88, 0x7e747237),
+	TOBN(0x0bc5d053, 0x9ff9d2fb), TOBN(0x72324ef8, 0x6d79870f),
+	TOBN(0x9f392531, 0xe4ef49a6), TOBN(0x9ba95efe, 0x70c98710),
+	TOBN(0x264c4634, 0x1dcc48a7), TOBN(0xc1a3cdd9, 0xdab30862),
+	TOBN(0x9bc6e513, 0x406080e0), TOBN(0x7e0c0e5b, 0xbe4a88b4),
+	TOBN(0xf755b638, 0xba5a9d3e), TOBN(0xffb0884f, 0xbc52f358),
+	TOBN(0xc2fe7d09, 0x9f89d004), TOBN(0xd7bc70b3, 0x777ffe73),
+	TOBN(0x54faa7c7, 0xb49ef009), TOBN(0xa9125b61, 0x7999c754),
+	TOBN(0xed5aed12, 0x89d4bf76), TOBN(0x8ebc9eba, 0xfa342f1c),
+	TOBN(0xf3cd6460, 0x0145d130), TOBN(0xdf42732a, 0xa728c4e3),
+	TOBN(0xb24acdca, 0xcf2442e4), TOBN(0x2282596e, 0x42609b73),
+	TOBN(0x3b117c7d, 0x360ca8b4), TOBN(0xf9a31476, 0xb7df5ddd),
+	TOBN(0x37677d20, 0x97d485d6), TOBN(0x22689ec4, 0xec7f30d0),
+	TOBN(0x4f2e7ba6, 0xe67ec997), TOBN(0x512e841f, 0x3a799b68),
+	TOBN(0xef196e41, 0x8a25953a), TOBN(0x4fa1e1a6, 0x90c65da2),
+	TOBN(0xe6dec996, 0xedee0273), TOBN(0xf727c865, 0x3dd2671f),
+    },
+    {
+	TOBN(0x2003b361, 0x2f7a097b), TOBN(0x18a762ba, 0x43d07b09),
+	TOBN(0x9da6f656, 0x52ee52c3), TOBN(0x2e274be5, 0xf80f1dde),
+	TOBN(0x5d7742db, 0xf0a7bc26), TOBN(0x16270729, 0xb802bd83),
+	TOBN(0x798459ef, 0x782ccf40), TOBN(0x9c1b30a9, 0xc41914be),
+	TOBN(0x2f980781, 0xb618a91e), TOBN(0xeba94fa3, 0xa1f1cc08),
+	TOBN(0x4e34a884, 0x1d576624), TOBN(0xb598ae40, 0xeb236aab),
+	TOBN(0x08c74fbe, 0x317cf238), TOBN(0xba72d767, 0x212bb1a3),
+	TOBN(0xb15594af, 0xd7d4b87b), TOBN(0x0c9a2516, 0x45c54ef3),
+	TOBN(0xf60cf2a6, 0xfa3ff670), TOBN(0x2a4ce73f, 0xb5fce4fe),
+	TOBN(0xef088b6f, 0x3af4dfd0), TOBN(0x74df037c, 0x46bbacec),
+	TOBN(0x898682e1, 0xc1edde36), TOBN(0xef9af2e0, 0x95dffc71),
+	TOBN(0x6df2e815, 0xbd913b81), TOBN(0x5b8b7e66, 0xb7c5fd1e),
+	TOBN(0xbcc6a45f, 0xb40b3b5f), TOBN(0x485e2013, 0x89280ad1),
+	TOBN(0x5672a683, 0xbde0c04b), TOBN(0x3328d372, 0x5b3de3fb),
+	TOBN(0x37eed095, 0x7b522684), TOBN(0xe9a40a0e, 0x9d551fcd),
+	TOBN(0x0beb6e60, 0xbebb68da), TOBN(0x57284ede, 0x55634ffb),
+	TOBN(0xaa317116, 0x159f0891), TOBN(0xad541a60, 0x184e95be),
+	TOBN(0xfeeb29e8, 0x85cb966e), TOBN(0xc14414dc, 0x5bdf5764),
+	TOBN(0x4c9cfec0, 0xb9e36423), TOBN(0x8b904a23, 0xff43a14b),
+	TOBN(0xeb64613c, 0xd67bf90a), TOBN(0xd5bb6538, 0xd1169402),
+	TOBN(0x25303e86, 0xed7d6fa3), TOBN(0x4b6bf790, 0xf5807d8a),
+	TOBN(0x3af9f908, 0xad35cd28), TOBN(0xab10c1f2, 0x40a20879),
+	TOBN(0x5f54c814, 0x5725ad16), TOBN(0x7863cc2d, 0xa3d66e93),
+	TOBN(0x11b1e4a9, 0x0f688ef0), TOBN(0xaf931342, 0xfa850952),
+	TOBN(0xc68df865, 0x5ecd36a4), TOBN(0x333f71ac, 0xa0e74f06),
+	TOBN(0x509bd89b, 0x4a25ba42), TOBN(0xe3e8f745, 0xbd539e6c),
+	TOBN(0x780ac298, 0x1289d878), TOBN(0x6d32237b, 0xf6e1dbb4),
+	TOBN(0x65df4fda, 0xdb6da719), TOBN(0xc7be6e80, 0x5a375eac),
+	TOBN(0x6b01f77d, 0x5257ade7), TOBN(0xc9863007, 0x14cda4bf),
+	TOBN(0x888491d3, 0x1070d323), TOBN(0x0aba7b2b, 0x8ae4c522),
+	TOBN(0x3e80810a, 0xa8dcd9ad), TOBN(0xef417eb9, 0x71ba5021),
+	TOBN(0x4785b0f9, 0xc7b3de57), TOBN(0xbd02e3e1, 0x53006d6c),
+    },
+    {
+	TOBN(0x71d86bc9, 0xdc025410), TOBN(0xb8d34bdd, 0xe700eaa0),
+	TOBN(0x81d94482, 0xf8eba952), TOBN(0x5e854e0e, 0x34cc502e),
+	TOBN(0x7c8c55de, 0x116d6b3f), TOBN(0xca005005, 0xbbf14176),
+	TOBN(0xb04cc204, 0xf8847f54), TOBN(0x4639ae08, 0xcf8a9f91),
+	TOBN(0x219e22d0, 0x9bea03de), TOBN(0x632a8d08, 0x4b99a1be),
+	TOBN(0xc5f1816d, 0xea91bd4e), TOBN(0xa7b3c1fd, 0x7560d6de),
+	TOBN(0xce6568f2, 0xd4b9c32e), TOBN(0x834216b2, 0x9eb71df9),
+	TOBN(0x5c768b5a, 0xa3669014), TOBN(0xe22470fe, 0x888dffdf),
+	TOBN(0xdc4c94f8, 0xd910e2d3), TOBN(0xed3057b5, 0xde8ba6b3),
+	TOBN(0x987993bb, 0x545bcfac), TOBN(0x999b0e9a, 0xaaf43988),
+	TOBN(0x1cc517fc, 0x7656df8a), TOBN(0x859ee877, 0x9995d8b4),
+	TOBN(0x5a708bfe, 0x867743e2), TOBN(0x04f05368, 0x66d3d23e),
+	TOBN(0x408eddb3, 0x7fdc0798), TOBN(0x1dbaba84, 0x28e2681f),
+	TOBN(0xef6470e9, 0x4130b350), TOBN(0xae117374, 0x7049bab5),
+	TOBN(0xcf7a4bba, 0xc1c81270), TOBN(0x0800f28d, 0xede172d3),
+	TOBN(0x9068bbd7, 0x29352f99), TOBN(0x29e6c298, 0x92bb4730),
+	TOBN(0xfa8f8eb9, 0xe0765081), TOBN(0xcea812f5, 0x93471b89),
+	TOBN(0xe545b077, 0xf89146e4), TOBN(0x900ff248, 0x6bc1d0a5),
+	TOBN(0x008bcdc6, 0xbae61518), TOBN(0x1260705b, 0x384b67f4),
+	TOBN(0x0af619a7, 0x0c20a790), TOBN(0x7c8fc5aa, 0x17c88d52),
+	TOBN(0xfbc0fb72, 0x9940a08b), TOBN(0x237e7acf, 0xa10b06ed),
+	TOBN(0x44083af5, 0x9cf8a728), TOBN(0x92599d8a, 0xc1558ed2),
+	TOBN(0x7390c3a3, 0xcb731d74), TOBN(0x128020bc, 0x1d9aaa43),
+	TOBN(0x037ee51f, 0xec09c6e6), TOBN(0x5397c8d7, 0x43aee9c9),
+	TOBN(0x0115e4a6, 0xadf1d733), TOBN(0xc0c2f860, 0x71794658),
+	TOBN(0xdcf25eb6, 0x737fe386), TOBN(0x7ff42ddc, 0xb537f3f6),
+	TOBN(0xdc1120b3, 0xf7a0c550), TOBN(0x1cf28aaf, 0x8f63812e),
+	TOBN(0x43a70cf8, 0x73730bdd), TOBN(0x648c7270, 0x6eea2650),
+	TOBN(0xb84cc42d, 0xbb4dce1b), TOBN(0xe870addd, 0x6fa64f5d),
+	TOBN(0xe71eaf37, 0x55799bd7), TOBN(0x69d0e71d, 0x2441d608),
+	TOBN(0xf499d5b8, 0xc938c2f2), TOBN(0xdd97a9d2, 0x68e2b5e7),
+	TOBN(0x7c3e9054, 0x6888149f), TOBN(0x3ff1f7eb, 0xc4e3a5fd),
+    },
+    {
+	TOBN(0xe07208be, 0xab4b6d82), TOBN(0x45e5b971, 0x4cc99a18),
+	TOBN(0x862668db, 0x2ab0a80f), TOBN(0x35dbc6bc, 0x14704cae),
+	TOBN(0xc7c4db1f, 0xac0680d9), TOBN(0x1bfc22bd, 0xde0b90dd),
+	TOBN(0x69513fbf, 0xba384827), TOBN(0x898e9736, 0x7c8d57fe),
+	TOBN(0xf22c6eb6, 0x79334eb1), TOBN(0x8b962d2b, 0x38bbed07),
+	TOBN(0x35c17b69, 0x9458d9bf), TOBN(0xf131d700, 0x68a7a5ab),
+	TOBN(0x658f9dd1, 0x012f3dfb), TOBN(0x2a55d595, 0x3e6f5f37),
+	TOBN(0x73233b03, 0x1c41e11a), TOBN(0x65fd71fa, 0x0309d198),
+	TOBN(0xdf7f31e4, 0x89c7fdf2), TOBN(0x60f5c27a, 0x2b72d625),
+	TOBN(0xfc3b1bb1, 0x9ab5a379), TOBN(0x5234f6c0, 0xfb5bf770),
+	TOBN(0x90adbd2c, 0xaab4f387), TOBN(0x06625414, 0x0c36c3df),
+	TOBN(0xf8ea88e1, 0xcd737aef), TOBN(0xdcef102a, 0xa65bee9a),
+	TOBN(0x30c45312, 0x78048799), TOBN(0xc4d8c907, 0xeb276a01),
+	TOBN(0x3ad2d110, 0x15e9487a), TOBN(0xc76f2555, 0x94fbf888),
+	TOBN(0x54db173a, 0x3dcf7a82), TOBN(0xde701566, 0xdeb5a79c),
+	TOBN(0x4354fee6, 0x09e797ad), TOBN(0x3fa4e289, 0x6db23d27),
+	TOBN(0x41bb6896, 0x081dd2fb), TOBN(0xa572e5b9, 0x948959c3),
+	TOBN(0x621a3f6e, 0xcc13dbb6), TOBN(0xdc848d94, 0x99e8cd3a),
+	TOBN(0xd78fa066, 0xf6eaa2f7), TOBN(0x8e458c43, 0x3091484f),
+	TOBN(0xd35e39da, 0x66ca0578), TOBN(0x4673e8e8, 0x530ebfe1),
+	TOBN(0x4e523891, 0x45907275), TOBN(0xf01768cd, 0xd879f3be),
+	TOBN(0x76f04838, 0x263700ad), TOBN(0xf98d3757, 0xa7ba521d),
+	TOBN(0x39fadca9, 0x600d3b92), TOBN(0xe76c3335, 0xbfa3a45e),
+	TOBN(0x643f0144, 0x74a76e2c), TOBN(0xca724b07, 0xd7a48873),
+	TOBN(0xd9be4a0a, 0x1d784bb1), TOBN(0x14db091f, 0x9e074c67),
+	TOBN(0x408f2ef1, 0xd2e9c358), TOBN(0xc9571df9, 0x234cde8e),
+	TOBN(0xdb5c6173, 0xa46a41be), TOBN(0xa9e682ba, 0x9aa32107),
+	TOBN(0xafcfc728, 0x259a880d), TOBN(0x409a4eab, 0x8654ba63),
+	TOBN(0xb2362e74, 0x82358e58), TOBN(0x6e761fcd, 0xe7fec757),
+	TOBN(0xeeac3d59, 0xf3967fb2), TOBN(0x63c21f31, 0xb7eb5c2f),
+	TOBN(0x3c3febee, 0x83a0e34c), TOBN(0xab77d977, 0x8899c1bb),
+	TOBN(0x64b1adb5, 0xac1583c5), TOBN(0xe4caa6e7, 0x7a849ccf),
+    },
+    {
+	TOBN(0xf53b3b59, 0xd3f0e0f8), TOBN(0x8c6bc831, 0x8cde9835),
+	TOBN(0x4b71cf70, 0x86c9b373), TOBN(0x3ba66372, 0x80b3f0e1),
+	TOBN(0xa365c3ab, 0x9ed0cf8a), TOBN(0x8c25c0ea, 0x6d384f25),
+	TOBN(0xc441c937, 0xe1eaa36a), TOBN(0x43bc8d23, 0x0dee5589),
+	TOBN(0xe3538598, 0xac6f81ff), TOBN(0x8f1c6cdc, 0x9c9451f4),
+	TOBN(0xc0db0166, 0xdf9c61af), TOBN(0x6bc390f4, 0x61539d69),
+	TOBN(0x0facbe85, 0x46ed6f25), TOBN(0x32d991bd, 0xa3adab61),
+	TOBN(0x29edae0b, 0xeaedfa19), TOBN(0x1452d7f4, 0x89e789c2),
+	TOBN(0x4f601435, 0xc1a750ab), TOBN(0x170625c9, 0xbed283a9),
+	TOBN(0xe1e355a7, 0xfa10de85), TOBN(0x176fcc4c, 0x86a60931),
+	TOBN(0x15967a40, 0x6c227b7b), TOBN(0x8163500d, 0x0d96d6fd),
+	TOBN(0x5e25f483, 0xccf5eefd), TOBN(0x005557fa, 0x79217f4d),
+	TOBN(0xefb62dc7, 0xc1c0d0c4), TOBN(0x488575da, 0xbd0ed3a8),
+	TOBN(0x783f1a91, 0xd958606c), TOBN(0x08693c04, 0x5f14e196),
+	TOBN(0xc26047e8, 0x32e3db0b), TOBN(0x1902d490, 0x1e52820b),
+	TOBN(0xfb5593db, 0x986e5c87), TOBN(0xe6b66ef0, 0x6ceaf882),
+	TOBN(0xb8067bd0, 0x438e8ed9), TOBN(0x8673ffe4, 0x21d094b1),
+	TOBN(0x78f0267e, 0xfc3c531b), TOBN(0xe7d7b813, 0x9c5425ee),
+	TOBN(0x33520419, 0x22bb3be7), TOBN(0xf54eb4ae, 0xac542e9c),
+	TOBN(0xb447085a, 0x793ab5a6), TOBN(0xb0289a27, 0x76b562b1),
+	TOBN(0x43124706, 0xd62beca6), TOBN(0xa1ccd103, 0x1909fa46),
+	TOBN(0xea592fcd, 0x4432afff), TOBN(0x06cc7cd4, 0x56d7f7eb),
+	TOBN(0x5c0f4e39, 0xd499a66f), TOBN(0x791680c9, 0x4be7c1a3),
+	TOBN(0xf03825da, 0x36e155af), TOBN(0x85fdbafd, 0x3dfe592e),
+	TOBN(0x4076e021, 0x545614a5), TOBN(0x01226141, 0xa886ed51),
+	TOBN(0xeeb21d2c, 0x350ee6da), TOBN(0x4ece772d, 0x1ee4e4d6),
+	TOBN(0x2fee1036, 0x9aedd48b), TOBN(0x19faa299, 0x2d08de66),
+	TOBN(0x5d813edc, 0x017f7391), TOBN(0xfe207ab8, 0xa46bd0aa),
+	TOBN(0x61282158, 0x9d9ce8c5), TOBN(0x2b8f0f17, 0xa263082f),
+	TOBN(0xafa216c2, 0xd5176b6b), TOBN(0xb55ea155, 0xd772a3ac),
+	TOBN(0x021c8a39, 0x55f4cadf), TOBN(0x61c1b763, 0xe39450df),
+	TOBN(0xf7979501, 0x6f4267a8), TOBN(0xdbbffe76, 0xd5feec95),
+    },
+    {
+	TOBN(0x0aa0899d, 0x26577076), TOBN(0x5cf65a0d, 0xb0c38b38),
+	TOBN(0xf5492a18, 0xa16bf31f), TOBN(0x0ac81d33, 0x7e2264ab),
+	TOBN(0xe70e80ae, 0x0489aa6f), TOBN(0x23f42ecc, 0x7c61d973),
+	TOBN(0xeba562e1, 0xaf45dfba), TOBN(0xff0b0494, 0x05e7b4bd),
+	TOBN(0x5ad66fbc, 0x1cb8b773), TOBN(0x39b30414, 0x64e3c03e),
+	TOBN(0xdbdad102, 0x33652926), TOBN(0xe6d04712, 0x528f229c),
+	TOBN(0x76d05d1b, 0x8e588aa4), TOBN(0x986b7388, 0x6306a947),
+	TOBN(0x8fc8dc41, 0x4a7fbba3), TOBN(0x7d5568ac, 0xae576cd0),
+	TOBN(0x9cb08ab4, 0x29209f3e), TOBN(0xc95ce6d5, 0x5a93b6d3),
+	TOBN(0x2cf6b8b2, 0xa1c74891), TOBN(0x125a4284, 0x0c2a1b3d),
+	TOBN(0xdb9f7d7e, 0x053a0b20), TOBN(0x77971152, 0xac6c78d2),
+	TOBN(0x3a8bac43, 0x6c07f697), TOBN(0xb2967963, 0xadaa4b26),
+	TOBN(0x954785ce, 0xfd22d6e7), TOBN(0x174c0e90, 0x920ba16f),
+	TOBN(0x0d9b47aa, 0x416087d2), TOBN(0x659dd5a6, 0xc0258f88),
+	TOBN(0x28ba0547, 0xc1c1ed41), TOBN(0x2c38f778, 0x680ab471),
+	TOBN(0x4d74df25, 0x5cb0ae17), TOBN(0xe7d5067d, 0xcdbfb58a),
+	TOBN(0x54d04855, 0x32f4b38d), TOBN(0xc83fc0c1, 0x29967a44),
+	TOBN(0xcaa9b1aa, 0x22c828c7), TOBN(0x2c901962, 0x2fb4db23),
+	TOBN(0x30aed5ad, 0xf904c3fb), TOBN(0x8699d63a, 0x3535b757),
+	TOBN(0xb3d639b9, 0x135e7a1c), TOBN(0xc73d0df8, 0x791df357),
+	TOBN(0x418075b4, 0xe6df07ca), TOBN(0xff53ac64, 0xaaaf83dd),
+	TOBN(0xc1c1795b, 0xf917e8c9), TOBN(0xede0a21d, 0x5d31cbbd),
+	TOBN(0x0f5ba481, 0xb4fd1d18), TOBN(0x075534cc, 0x4727c9f0),
+	TOBN(0x29861ef7, 0xce74158a), TOBN(0xa1ca026a, 0x467d5457),
+	TOBN(0x1bf54e77, 0x0f3574f8), TOBN(0xec04e79b, 0x18a82e93),
+	TOBN(0xc53e27df, 0xa46cb47f), TOBN(0x02dd7324, 0x12eec209),
+	TOBN(0x528afa84, 0xe40a541a), TOBN(0x2989fb3b, 0x9022df16),
+	TOBN(0x2ef1c01f, 0x5931ee3f), TOBN(0x8e75bbd1, 0x41a9d990),
+	TOBN(0x74b94096, 0x1e647e22), TOBN(0x5465f431, 0x7a7d3566),
+	TOBN(0xfd4e1160, 0x1b793242), TOBN(0xaa208cd7, 0xf8cbcac5),
+	TOBN(0x4134c144, 0x6a6c8987), TOBN(0xa9b51d5a, 0xee28cea1),
+	TOBN(0x367e282d, 0x48b038ac), TOBN(0x3d530a0c, 0xe73f3d4e),
+    },
+    {
+	TOBN(0x09560ded, 0x63430507), TOBN(0x62a77df4, 0xb2c4a880),
+	TOBN(0x90990870, 0x8f304479), TOBN(0x618ea18b, 0x2483b4b8),
+	TOBN(0x56ce4fad, 0x491fbe28), TOBN(0x5f5203c6, 0x0fd9fc4a),
+	TOBN(0x08de571e, 0xc64e621a), TOBN(0x3a77f370, 0x0c2ef816),
+	TOBN(0xe7d70cf6, 0xaab9fd94), TOBN(0x9e00b4a5, 0xfaf75298),
+	TOBN(0x536ec0b3, 0x4278b129), TOBN(0xab1e0e2e, 0x0549fd76),
+	TOBN(0x70ba3b02, 0x6a346420), TOBN(0x3a950f84, 0xc77d1325),
+	TOBN(0xb268f4d2, 0x9290480d), TOBN(0xfe5752e4, 0x5d92d2ea),
+	TOBN(0x088c5c80, 0xee46cb31), TOBN(0x10751a1a, 0x586c1e9f),
+	TOBN(0x48524c1b, 0xbbfa2063), TOBN(0xc7280882, 0x076542e2),
+	TOBN(0x75a7ddb5, 0x5345b837), TOBN(0xe65783a4, 0x59c66147),
+	TOBN(0x59edcf8b, 0xe959812f), TOBN(0xb80dc44c, 0x051ce39c),
+	TOBN(0x57b75d29, 0x2dad10a1), TOBN(0x1ce570e7, 0x5d10feae),
+	TOBN(0x52f1efd2, 0x43c70a82), TOBN(0xbff02046, 0x28fd687b),
+	TOBN(0x02abb539, 0x8ccfd1d2), TOBN(0x9d54c828, 0x687ab732),
+	TOBN(0xef6b028a, 0x5c84b5f3), TOBN(0x5d1e9a82, 0xdcb39a3e),
+	TOBN(0xb928dad4, 0x1408ad33), TOBN(0xaa178bc2, 0x9aa784b4),
+	TOBN(0x8ee911e6, 0x1d58b245), TOBN(0x8e2f658e, 0x34231ebe),
+	TOBN(0xd385bb8e, 0x93f908de), TOBN(0x74d0c52b, 0x94b7244d),
+	TOBN(0xec3323b3, 0x9b128f6b), TOBN(0xaad3ffde, 0x5f96235b),
+	TOBN(0x70c211ef, 0x58f3e23c), TOBN(0xee558841, 0x1c359ec3),
+	TOBN(0x3d9ed683, 0xfbc55236), TOBN(0xc6e06bae, 0x8ab5d4a4),
+	TOBN(0xe1a0be46, 0xd493de63), TOBN(0x8eea842c, 0x5389f5b0),
+	TOBN(0xaf5838c0, 0x17fcbc50), TOBN(0xd9cba841, 0xcb8ee50b),
+	TOBN(0x7ede8c69, 0x061b5347), TOBN(0xadb68dcc, 0x74887e76),
+	TOBN(0x221efadc, 0xc060c11a), TOBN(0xe5308e6d, 0x7f158bbb),
+	TOBN(0x61fcefef, 0xafc7d206), TOBN(0x1c8ebe89, 0xca766255),
+	TOBN(0xb31b0679, 0x6a6d7bae), TOBN(0x15ca5c6a, 0x04bc08c3),
+	TOBN(0xe2c4fd0b, 0x29b4eb39), TOBN(0x0270e8ea, 0xbe1aa4f9),
+	TOBN(0x7c9ecf6c, 0x6c3c34aa), TOBN(0xd115680e, 0xfa7b4f15),
+	TOBN(0x6d2934ec, 0xa543011f), TOBN(0x04b9f8e4, 0xd3f7147c),
+	TOBN(0x6667d941, 0x544ab7b9), TOBN(0xdc177678, 0xa6709eaa),
+    },
+    {
+	TOBN(0x2c28ea2f, 0x11fd4d0c), TOBN(0x8d379b65, 0x70793c9b),
+	TOBN(0xd39f3879, 0x54e289a4), TOBN(0x4dc3cf12, 0xa3947bff),
+	TOBN(0xc58b1e0d, 0x1a47f7a1), TOBN(0x6dfb6ee2, 0x3ac2cb00),
+	TOBN(0x366901f1, 0xfb277d52), TOBN(0xf36b74d9, 0x6cd1197d),
+	TOBN(0x913d872d, 0x9f63dfd9), TOBN(0xc9f17b9f, 0xcb698c96),
+	TOBN(0xa6a191ac, 0x809c548a), TOBN(0x74c420d2, 0x7cb25c5a),
+	TOBN(0x0f3a8a59, 0x667ffdc9), TOBN(0x6e7a0fcb, 0x8fb5cf99),
+	TOBN(0xc1af456f, 0xfde3cc08), TOBN(0xe0d2c07f, 0xec709ae5),
+	TOBN(0x8f0d490b, 0x511d1c2e), TOBN(0x4b1b8c7e, 0xddbdf3d5),
+	TOBN(0x2898f719, 0x19e68f1f), TOBN(0x20b68d56, 0xa2ab389b),
+	TOBN(0xf8c86bc8, 0x6cfe3263), TOBN(0xa7e9af7e, 0x070f1ede),
+	TOBN(0x24b65c6e, 0x64356c90), TOBN(0x101eb472, 0x5a393160),
+	TOBN(0x61c6ac19, 0x270051a7), TOBN(0x1af87c95, 0x6809ea82),
+	TOBN(0x85f102e2, 0x471a1c52), TOBN(0x0253e967, 0x55c05c9c),
+	TOBN(0xc1b6f697, 0x8700cd92), TOBN(0x376dd009, 0xd5c0510f),
+	TOBN(0xb855bc80, 0xd7b09e50), TOBN(0x4ba19792, 0xd529f338),
+	TOBN(0x8d5bcf29, 0xaa495c5a), TOBN(0x7954c2ea, 0x6992336b),
+	TOBN(0x6828a222, 0x3e7f6e70), TOBN(0x81625552, 0xe4cee5e7),
+	TOBN(0xcb44b504, 0x1f93cab2), TOBN(0x77a957cc, 0xe4c09292),
+	TOBN(0x422837e6, 0x0eafbbbd), TOBN(0x5774a3a6, 0x86ad1a88),
+	TOBN(0xb4dea008, 0x27a24331), TOBN(0xa78a8471, 0x50b2276f),
+	TOBN(0x717f1d0d, 0xe12d6cb9), TOBN(0xd18e8cdd, 0x8590ce58),
+	TOBN(0x4f3abd88, 0x7773ccd2), TOBN(0xa6cb5112, 0x01bb488d),
+	TOBN(0x187e4bd7, 0x43929952), TOBN(0x9935867d, 0xc339fb69),
+	TOBN(0x112d232a, 0x13887d8a), TOBN(0x54d67060, 0xc7c20e49),
+	TOBN(0x91f3beba, 0x25eab5da), TOBN(0x40e98086, 0xc520a448),
+	TOBN(0x6e8100a7, 0x78ece933), TOBN(0x6d17664e, 0x87513ad1),
+	TOBN(0xaf3b61f9, 0xa397073d), TOBN(0x55ea3708, 0x1863fe8e),
+	TOBN(0x4548dc0f, 0x3c442774), TOBN(0x3923020c, 0xb5106dc4),
+	TOBN(0xf2899a37, 0xe57743bb), TOBN(0x0d1a0eb0, 0x7d36e0ba),
+	TOBN(0x07dbd7f0, 0x2de1ea34), TOBN(0xeec06c97, 0x47f8ac29),
+	TOBN(0x77e41106, 0xb4d3fe56), TOBN(0xcbafa981, 0x4bef64ed),
+    },
+    {
+	TOBN(0x3b396d0a, 0x39605966), TOBN(0x33c08c46, 0xe9178cd2),
+	TOBN(0x094f81e8, 0xa65af8c6), TOBN(0x61f45a54, 0x63aac78c),
+	TOBN(0xb18aa886, 0x94bd0952), TOBN(0x8d968ab1, 0x66042374),
+	TOBN(0xb5e29aea, 0x589bf95d), TOBN(0xf4cac9fe, 0xcc8c170c),
+	TOBN(0x0552ab7f, 0x9e60e64f), TOBN(0x57b62f6d, 0x1e319568),
+	TOBN(0xe05df1bf, 0xedda7bbc), TOBN(0x3dabbc1e, 0x28732feb),
+	TOBN(0x0da9d065, 0x5cf257a5), TOBN(0x3a9110c0, 0xbb47d475),
+	TOBN(0x61e658e5, 0x76810241), TOBN(0x89d83789, 0xed2d6445),
+	TOBN(0x2c328046, 0x3135e374), TOBN(0xaa303cad, 0x8b533254),
+	TOBN(0xc1c7d14b, 0x6c6ec5ed), TOBN(0x0855c78c, 0xe6af4a11),
+	TOBN(0x713b6261, 0xd0af2394), TOBN(0x2fa20835, 0xa11d2e2a),
+	TOBN(0x44dd078d, 0x729032cd), TOBN(0x9047425a, 0xfca3a47f),
+	TOBN(0x975ac4bd, 0x8baf5505), TOBN(0xca067acb, 0x554dc7e7),
+	TOBN(0xc8f60aee, 0x12e7aa9a), TOBN(0xcfed0b10, 0x8c1d3ead),
+	TOBN(0xcfa7f9b6, 0xc7342c32), TOBN(0x32673262, 0xe26370f8),
+	TOBN(0xe0047fcc, 0xe86b4942), TOBN(0xd19d2bc1, 0x1fcbbd75),
+	TOBN(0xbe8338fc, 0x04cb8ff7), TOBN(0x7b2e57aa, 0xbd972283),
+	TOBN(0xc6b35f7f, 0xa238b6d1), TOBN(0xc62e9f90, 0x0f88263d),
+	TOBN(0x837b7391, 0x1b68c4be), TOBN(0x1b01c8a3, 0xa6704836),
+	TOBN(0x2f21cd91, 0xc9ede1b7), TOBN(0xad9f2e15, 0x59676897),
+	TOBN(0xd4efa7c1, 0x62b21461), TOBN(0xeaf60cfb, 0xf57d200b),
+	TOBN(0xc6531b98, 0x2265aa1b), TOBN(0x685efbe3, 0xe28741cf),
+	TOBN(0xf1cb42ca, 0xdc750cd1), TOBN(0xa3e273c4, 0x6266da4c),
+	TOBN(0x719a359f, 0xf0e27882), TOBN(0x03bafe52, 0x6d74f34d),
+	TOBN(0x1b4ff8d9, 0x0f90d826), TOBN(0x0541d507, 0xafd78a42),
+	TOBN(0x99e2034c, 0x2cc670ad), TOBN(0x85b7989c, 0x5dc9bd5a),
+	TOBN(0x15706211, 0x4f6d2e0a), TOBN(0x0ec3b2a3, 0x3c18a5d0),
+	TOBN(0xe71066aa, 0x224b7ab2), TOBN(0x1c193a79, 0xa2578854),
+	TOBN(0x3b1545e6, 0xa4acfbd8), TOBN(0xbac14b56, 0xe47e292c),
+	TOBN(0xda06170b, 0x6ed941ce), TOBN(0xa784a828, 0xdfbc3ffd),
+	TOBN(0xf970928f, 0xdf79d82e), TOBN(0xd9313d91, 0xfe2cd39a),
+	TOBN(0x289b1d9f, 0x9c1b454b), TOBN(0xa0919f23, 0xe2bc4706),
+    },
+    {
+	TOBN(0x36b7e21c, 0xed870855), TOBN(0x15497392, 0x021e6d2d),
+	TOBN(0x05588c47, 0x137e057e), TOBN(0x5a7bf776, 0xe23f6495),
+	TOBN(0x14aaf19f, 0xb245c8ac), TOBN(0x508fac9c, 0x0729181d),
+	TOBN(0xe0ab95b5, 0x667b4219), TOBN(0x3845783d, 0x922a95ad),
+	TOBN(0x1eedf622, 0x4bda6fd3), TOBN(0xd4165dc0, 0xcd2db337),
+	TOBN(0x9547046e, 0x36e5b80c), TOBN(0x96580a57, 0x95cfdc78),
+	TOBN(0x389a230d, 0x994c36b5), TOBN(0x618c0f0a, 0x5d67c755),
+	TOBN(0x915ee8b9, 0xcdeb7a30), TOBN(0xe06f2855, 0x969b7aae),
+	TOBN(0x987bc73d, 0x9f639c7b), TOBN(0xc56fac00, 0xe53419d5),
+	TOBN(0xdac98e25, 0x3b127e42), TOBN(0x473770d4, 0xb31b4cf0),
+	TOBN(0x33530eee, 0xb13c2849), TOBN(0xd5d5bf2f, 0x39878125),
+	TOBN(0x69ebdb0b, 0x69489552), TOBN(0x0f4414c6, 0xeda6b9a4),
+	TOBN(0x7cef07a0, 0x1844d6bd), TOBN(0x734ff045, 0xfdaf428c),
+	TOBN(0x5a51ac59, 0x76a46aed), TOBN(0xc8441cfd, 0xd00ae1c4),
+	TOBN(0x66e4fab7, 0x68f6a4b5), TOBN(0xdc83c32a, 0x0c4241c8),
+	TOBN(0x4f52c025, 0x3f15c031), TOBN(0x39c92819, 0xdc729321),
+	TOBN(0x956e63b1, 0x1ac94b49), TOBN(0x02f3c3b2, 0x7bb5bda0),
+	TOBN(0x1626b2c8, 0x3e257c59), TOBN(0x5d8318d7, 0xcaed3efb),
+	TOBN(0x6d990044, 0x72ce12d7), TOBN(0x6aa46419, 0x124c39ab),
+	TOBN(0x0450671f, 0x1e38dd49), TOBN(0x4f57ac57, 0xa9c6a4b7),
+	TOBN(0x5f87864e, 0x74fea445), TOBN(0x22457bce, 0xa72257fd),
+	TOBN(0x9dc2caaa, 0xbd06d1b3), TOBN(0x3bcc040c, 0x795def1b),
+	TOBN(0x39225305, 0x9efc1e1f), TOBN(0x9db0cd54, 0x4ec6c68d),
+	TOBN(0xa336f096, 0x84a7377b), TOBN(0x74f35aa5, 0x3d909532),
+	TOBN(0x0e521180, 0x9a1efe5d), TOBN(0x8d663b53, 0x882cccad),
+	TOBN(0x80a8ff9c, 0x01f41ae3), TOBN(0xb1e8ed4f, 0xfefe75b4),
+	TOBN(0xe4c472ae, 0x9e21e335), TOBN(0xefda4333, 0x3710d7a3),
+	TOBN(0x55e97854, 0x2bc2823f), TOBN(0x1cc89b50, 0xe999d7d8),
+	TOBN(0xb793f1cb, 0xcbc2dfce), TOBN(0x2d04d928, 0x5679b853),
+	TOBN(0x93ec97c8, 0xab0177d6), TOBN(0x324221b0, 0xa9a01e90),
+	TOBN(0x7567932b, 0xb38f8e42), TOBN(0xdb258f9b, 0x4a4fe568),
+	TOBN(0xdce8b22a, 0xe32b15ca), TOBN(0xddc16fe0, 0xc4c02457),
+    },
+    {
+	TOBN(0xe5cb114f, 0xaedb5162), TOBN(0x574f4e70, 0x4ab6326c),
+	TOBN(0x7519f1db, 0xa7de39f2), TOBN(0xf2faf50a, 0x2cb23d70),
+	TOBN(0xb401e9e0, 0x025ce467), TOBN(0xc131173a, 0x35facba6),
+	TOBN(0x640df39b, 0x4c6e2485), TOBN(0x39735628, 0xac2e8859),
+	TOBN(0xa60faa57, 0xfa9e1d5d), TOBN(0xa35483ed, 0xaee23192),
+	TOBN(0xa76effd6, 0xa3a25074), TOBN(0x4dcd64e3, 0xedf20b91),
+	TOBN(0xda8c2afc, 0x4e8fd884), TOBN(0x6d716e4c, 0x4c276a1c),
+	TOBN(0xa61dddf9, 0x0bb3a27e), TOBN(0x9d47c7a1, 0x6d62ddd1),
+	TOBN(0x3303ce0f, 0x65d04ea7), TOBN(0xeb74e699, 0x719161bc),
+	TOBN(0x8051303b, 0x551172ed), TOBN(0x5bac729d, 0x6d47edfc),
+	TOBN(0xe16629a7, 0x31f4444c), TOBN(0xf63489c0, 0xe11410df),
+	TOBN(0x956cfa17, 0x09009ef5), TOBN(0xb73f1dd1, 0x7175f50b),
+	TOBN(0x69106351, 0xe0add89f), TOBN(0xe6e0a820, 0x7f4aab05),
+	TOBN(0x933fcbf2, 0x4af395db), TOBN(0xdbc4ec8c, 0x2087879b),
+	TOBN(0x86e997b7, 0x42d3d182), TOBN(0xf0baaa1a, 0x5b3b3f34),
+	TOBN(0xd1538ea7, 0x87075099), TOBN(0xdb2564f8, 0x113014c8),
+	TOBN(0x4ffe65b8, 0x51861e78), TOBN(0x6a242461, 0x10e7e020),
+	TOBN(0xaf7697ae, 0x4adf52fd), TOBN(0x7e916498, 0xaf1c678f),
+	TOBN(0xc7efb8ea, 0x772d8192), TOBN(0xee23f78e, 0x2aa1e259),
+	TOBN(0xa64a22d9, 0xca12ca3c), TOBN(0x77abc4d5, 0xbcdbff20),
+	TOBN(0x1c612455, 0x1615ee43), TOBN(0x6d148921, 0x6b84628a),
+	TOBN(0x636be18e, 0xf7a8a28e), TOBN(0x481941ad, 0xfdbe24c1),
+	TOBN(0x98bb7390, 0x80420d41), TOBN(0x9ab5bf0e, 0x1e72dd54),
+	TOBN(0xb5be0f38, 0xf062d93c), TOBN(0xf7b12f82, 0xd49a9e08),
+	TOBN(0x25e7eb40, 0x5592bdd1), TOBN(0xe09681bb, 0x31adb2d6),
+	TOBN(0x2c3b70e1, 0x89643b62), TOBN(0x759fc1a6, 0x260ca108),
+	TOBN(0xb7784bdc, 0xb54cc969), TOBN(0x759a3f5c, 0xd0f7534d),
+	TOBN(0x346ffce6, 0x2b26677b), TOBN(0x4cb932d0, 0xa11ad357),
+	TOBN(0x2d9f1f7f, 0x52602007), TOBN(0x0f468ca4, 0x2a45da29),
+	TOBN(0x011f48b3, 0xdf55c839), TOBN(0x5e8e6fbc, 0x26e38e54),
+	TOBN(0x1df20e10, 0xed50b790), TOBN(0x10f4b9d8, 0xba4c27b1),
+	TOBN(0xc95efb9a, 0x083a5cc4), TOBN(0xcf13d9dc, 0xd4688e16),
+    },
+    {
+	TOBN(0xe8d80078, 0xeb3f7dd8), TOBN(0x688ac40d, 0xfeb03a52),
+	TOBN(0xdcdab49e, 0xaed58e39), TOBN(0xdc9d1cb6, 0x8495cdd7),
+	TOBN(0x6dbabaac, 0x69935cdf), TOBN(0xd487379b, 0xd9868556),
+	TOBN(0x09ea3ba6, 0xbcf26cc4), TOBN(0x00879c1f, 0x6fae6793),
+	TOBN(0xc3841c28, 0x5b09ce91), TOBN(0x32e0aac0, 0x814907ab),
+	TOBN(0xa39357e9, 0x9191e8cd), TOBN(0x4e58e20f, 0x786d5893),
+	TOBN(0x3df16530, 0x3c0bbe0b), TOBN(0xf57c8eb7, 0x3c51b5d5),
+	TOBN(0x7942ae02, 0x883f0416), TOBN(0xcb77916d, 0xc1174e28),
+	TOBN(0x2e2ae900, 0x282a1aa1), TOBN(0xfc8930b4, 0x9e7b0247),
+	TOBN(0xbfcc3323, 0xca7cf7c0), TOBN(0x69a487b9, 0x902c3678),
+	TOBN(0xce6da1e5, 0xa3e11976), TOBN(0xc4b990cf, 0x3f6bcd63),
+	TOBN(0x06d2b94e, 0xee4d07c3), TOBN(0xcb12a6d4, 0x4c0bf93f),
+	TOBN(0xdb06f0fb, 0x26921d1e), TOBN(0xc67a7388, 0x5ea581cc),
+	TOBN(0x38a5bf79, 0x0c2b91a7), TOBN(0xd2498c74, 0x656de854),
+	TOBN(0x6a90e51e, 0xd04a3ebd), TOBN(0x30ea1788, 0x61fe35b2),
+	TOBN(0x28ec4115, 0x93848f9f), TOBN(0xaea5533b, 0x2208b140),
+	TOBN(0xfd6af7b6, 0x599e1767), TOBN(0xadee4052, 0xbe3cd0fa),
+	TOBN(0x395473cb, 0xe3f70b65), TOBN(0xef870e50, 0x257c5dda),
+	TOBN(0x8b180da8, 0x10ae0531), TOBN(0xc4cefa13, 0xebb58f41),
+	TOBN(0x41ad02a9, 0x2eff357b), TOBN(0x0cddb2a1, 0x942d6eb7),
+	TOBN(0xbfa496c7, 0x5a136953), TOBN(0xcc44327e, 0xc6c5c73d),
+	TOBN(0x8e3cfc14, 0x4e1c31d5), TOBN(0xc854ca9d, 0x07f7da44),
+	TOBN(0xbf7f59dd, 0xb0543cf4), TOBN(0x2b31e028, 0xf3eac9da),
+	TOBN(0x3d176a7e, 0x47ee8de5), TOBN(0x41ab27b6, 0x3c0be22b),
+	TOBN(0xa8f1dbbd, 0x2dc88f35), TOBN(0x638202a0, 0xbe0e1108),
+	TOBN(0x0ade7825, 0x4466504d), TOBN(0xb2955298, 0x871f00cc),
+	TOBN(0xda84dbc5, 0x01eb4026), TOBN(0x10b198d6, 0x84ab54ea),
+	TOBN(0x8d8988a0, 0x20c16d29), TOBN(0x1cd7328c, 0x39bbe0e2),
+	TOBN(0x5269db68, 0x90c23653), TOBN(0x4821886f, 0xd4c38320),
+	TOBN(0x65bc0cad, 0x386ab0a5), TOBN(0x85c7868e, 0x2e861915),
+	TOBN(0xec662c1b, 0x8b24f974), TOBN(0xa4ca1247, 0x249a8dfc),
+	TOBN(0x7064afdc, 0x2624fd3f), TOBN(0xc4b297d5, 0x23021f32),
+    },
+};
+
+__END_HIDDEN_DECLS
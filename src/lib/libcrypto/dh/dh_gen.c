@@ -70,14 +70,32 @@
 #include "dh_local.h"
 
 static int dh_builtin_genparams(DH *ret, int prime_len, int generator,
-	    BN_GENCB *cb);
+	    int nthreads, int (*start_thread)(void (*)(void *), void *, void *),
+	    void *arg, BN_GENCB *cb);
 
 int
 DH_generate_parameters_ex(DH *ret, int prime_len, int generator, BN_GENCB *cb)
 {
 	if (ret->meth->generate_params)
 		return ret->meth->generate_params(ret, prime_len, generator, cb);
-	return dh_builtin_genparams(ret, prime_len, generator, cb);
+	return dh_builtin_genparams(ret, prime_len, generator, 1, NULL, NULL,
+	    cb);
+}
+
+/*
+ * Like DH_generate_parameters_ex(), but search for the prime with
+ * BN_generate_prime_mt() on threads provided by the caller.
+ */
+int
+DH_generate_parameters_mt(DH *ret, int prime_len, int generator,
+    int nthreads,
+    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+    void *arg, BN_GENCB *cb)
+{
+	if (ret->meth->generate_params)
+		return ret->meth->generate_params(ret, prime_len, generator, cb);
+	return dh_builtin_genparams(ret, prime_len, generator, nthreads,
+	    start_thread, arg, cb);
 }
 
 /*
@@ -107,7 +125,9 @@ DH_generate_parameters_ex(DH *ret, int prime_len, int generator, BN_GENCB *cb)
  * order-q subgroup.
  */
 static int
-dh_builtin_genparams(DH *ret, int prime_len, int generator, BN_GENCB *cb)
+dh_builtin_genparams(DH *ret, int prime_len, int generator, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb)
 {
 	BIGNUM *t1, *t2;
 	int g, ok = -1;
@@ -160,8 +180,14 @@ dh_builtin_genparams(DH *ret, int prime_len, int generator, BN_GENCB *cb)
 		g = generator;
 	}
 	
-	if (!BN_generate_prime_ex(ret->p, prime_len, 1, t1, t2, cb))
-		goto err;
+	if (start_thread == NULL) {
+		if (!BN_generate_prime_ex(ret->p, prime_len, 1, t1, t2, cb))
+			goto err;
+	} else {
+		if (!BN_generate_prime_mt(ret->p, prime_len, 1, t1, t2,
+		    nthreads, start_thread, arg, cb))
+			goto err;
+	}
 	if (!BN_GENCB_call(cb, 3, 0))
 		goto err;
 	if (!BN_set_word(ret->g, g))
@@ -106,6 +106,7 @@ generate_key(DH *dh)
 	unsigned l;
 	BN_CTX *ctx;
 	BN_MONT_CTX *mont = NULL;
+	const struct dh_comb *comb = NULL;
 	BIGNUM *pub_key = NULL, *priv_key = NULL, *two = NULL;
 
 	if (BN_num_bits(dh->p) > OPENSSL_DH_MAX_MODULUS_BITS) {
@@ -150,8 +151,14 @@ generate_key(DH *dh)
 		}
 	}
 
-	if (!dh->meth->bn_mod_exp(dh, pub_key, dh->g, priv_key, dh->p, ctx,
-	    mont))
+	/* Use the precomputed tables if this is a well-known group. */
+	if (dh->meth->bn_mod_exp == dh_bn_mod_exp)
+		comb = dh_comb_find(dh, priv_key);
+	if (comb != NULL) {
+		if (!dh_comb_mod_exp(comb, pub_key, priv_key, mont, ctx))
+			goto err;
+	} else if (!dh->meth->bn_mod_exp(dh, pub_key, dh->g, priv_key, dh->p,
+	    ctx, mont))
 		goto err;
 
 	dh->pub_key = pub_key;
@@ -112,6 +112,12 @@ int DH_check_params(const DH *dh, int *flags);
 int DH_check_ex(const DH *dh);
 int DH_check_pub_key_ex(const DH *dh, const BIGNUM *pub_key);
 
+struct dh_comb;
+
+const struct dh_comb *dh_comb_find(const DH *dh, const BIGNUM *e);
+int dh_comb_mod_exp(const struct dh_comb *comb, BIGNUM *r, const BIGNUM *e,
+    BN_MONT_CTX *mont, BN_CTX *ctx);
+
 __END_HIDDEN_DECLS
 
 #endif /* !HEADER_DH_LOCAL_H */
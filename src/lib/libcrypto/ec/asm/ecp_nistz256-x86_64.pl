@@ -51,6 +51,10 @@
 # Ranges denote minimum and maximum improvement coefficients depending
 # on benchmark. Lower coefficients are for ECDSA sign, relatively fastest
 # server-side operation. Keep in mind that +100% means 2x improvement.
+#
+# Field multiplication, squaring and the point operations have a second
+# code path using the BMI2 MULX and ADX ADCX/ADOX instructions, selected
+# at run time when both extensions are reported in OPENSSL_ia32cap_ext_P.
 
 $flavour = shift;
 $output  = shift;
@@ -68,6 +72,8 @@ open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\"";
 
 $code.=<<___;
 .text
+.extern	OPENSSL_ia32cap_ext_P
+.hidden	OPENSSL_ia32cap_ext_P
 
 # The polynomial
 .align 64
@@ -200,6 +206,8 @@ $code.=<<___;
 .type	ecp_nistz256_mul_mont,\@function,3
 .align	32
 ecp_nistz256_mul_mont:
+	mov	\$0x80100, %ecx		# BMI2 and ADX
+	and	OPENSSL_ia32cap_ext_P(%rip), %ecx
 .Lmul_mont:
 	push	%rbp
 	push	%rbx
@@ -207,6 +215,8 @@ ecp_nistz256_mul_mont:
 	push	%r13
 	push	%r14
 	push	%r15
+	cmp	\$0x80100, %ecx
+	je	.Lmul_montx
 
 	mov	$b_org, $b_ptr
 	mov	8*0($b_org), %rax
@@ -216,7 +226,20 @@ ecp_nistz256_mul_mont:
 	mov	8*3($a_ptr), $acc4
 
 	call	__ecp_nistz256_mul_montq
+	jmp	.Lmul_mont_done
+
+.align	32
+.Lmul_montx:
+	mov	$b_org, $b_ptr
+	mov	8*0($b_org), %rdx
+	mov	8*0($a_ptr), $acc1
+	mov	8*1($a_ptr), $acc2
+	mov	8*2($a_ptr), $acc3
+	mov	8*3($a_ptr), $acc4
+	lea	-128($a_ptr), $a_ptr	# biased, see __ecp_nistz256_mul_montx
 
+	call	__ecp_nistz256_mul_montx
+.Lmul_mont_done:
 	pop	%r15
 	pop	%r14
 	pop	%r13
@@ -453,12 +476,16 @@ __ecp_nistz256_mul_montq:
 .type	ecp_nistz256_sqr_mont,\@function,2
 .align	32
 ecp_nistz256_sqr_mont:
+	mov	\$0x80100, %ecx		# BMI2 and ADX
+	and	OPENSSL_ia32cap_ext_P(%rip), %ecx
 	push	%rbp
 	push	%rbx
 	push	%r12
 	push	%r13
 	push	%r14
 	push	%r15
+	cmp	\$0x80100, %ecx
+	je	.Lsqr_montx
 
 	mov	8*0($a_ptr), %rax
 	mov	8*1($a_ptr), $acc6
@@ -466,7 +493,18 @@ ecp_nistz256_sqr_mont:
 	mov	8*3($a_ptr), $acc0
 
 	call	__ecp_nistz256_sqr_montq
+	jmp	.Lsqr_mont_done
 
+.align	32
+.Lsqr_montx:
+	mov	8*0($a_ptr), %rdx
+	mov	8*1($a_ptr), $acc6
+	mov	8*2($a_ptr), $acc7
+	mov	8*3($a_ptr), $acc0
+	lea	-128($a_ptr), $a_ptr	# biased, see __ecp_nistz256_mul_montx
+
+	call	__ecp_nistz256_sqr_montx
+.Lsqr_mont_done:
 	pop	%r15
 	pop	%r14
 	pop	%r13
@@ -639,6 +677,259 @@ __ecp_nistz256_sqr_montq:
 .size	__ecp_nistz256_sqr_montq,.-__ecp_nistz256_sqr_montq
 ___
 
+{
+########################################################################
+# MULX/ADCX/ADOX versions of the above. b[0] (or a[0] for the squaring)
+# is passed in %rdx, and $a_ptr is biased by -128 so that all the memory
+# operands fit in a signed byte displacement. On return the registers
+# hold the same values as on return from the q versions: the result in
+# acc4-5-0-1 with .Lpoly[1] and .Lpoly[3] in $poly1 and $poly3 for the
+# multiplication, the result in acc4-7 with .Lpoly[1] and .Lpoly[3] in
+# $a_ptr and $t1 for the squaring.
+my @acc=($acc0,$acc1,$acc2,$acc3,$acc4,$acc5);
+sub A { $acc[$_[0]%6]; }
+
+$code.=<<___;
+.type	__ecp_nistz256_mul_montx,\@abi-omnipotent
+.align	32
+__ecp_nistz256_mul_montx:
+	########################################################################
+	# Multiply by b[0]
+	mulx	$acc1, $acc0, $acc1
+	mulx	$acc2, $t0, $acc2
+	mov	\$32, $poly1
+	xor	$acc5, $acc5		# cf=0
+	mulx	$acc3, $t1, $acc3
+	mov	.Lpoly+8*3(%rip), $poly3
+	adc	$t0, $acc1
+	mulx	$acc4, $t0, $acc4
+	 mov	$acc0, %rdx
+	adc	$t1, $acc2
+	 shlx	$poly1, $acc0, $t1
+	adc	$t0, $acc3
+	 shrx	$poly1, $acc0, $t0
+	adc	\$0, $acc4
+
+	########################################################################
+	# First reduction step
+	add	$t1, $acc1
+	adc	$t0, $acc2
+
+	mulx	$poly3, $t0, $t1
+	 mov	8*1($b_ptr), %rdx
+	adc	$t0, $acc3
+	adc	$t1, $acc4
+	adc	\$0, $acc5
+	xor	$acc0, $acc0		# $acc0=0,cf=0,of=0
+___
+for (my $i=1; $i<4; $i++) {
+$code.=<<___;
+
+	########################################################################
+	# Multiply by b[$i]
+	mulx	8*0+128($a_ptr), $t0, $t1
+	adcx	$t0, @{[A($i)]}
+	adox	$t1, @{[A($i+1)]}
+
+	mulx	8*1+128($a_ptr), $t0, $t1
+	adcx	$t0, @{[A($i+1)]}
+	adox	$t1, @{[A($i+2)]}
+
+	mulx	8*2+128($a_ptr), $t0, $t1
+	adcx	$t0, @{[A($i+2)]}
+	adox	$t1, @{[A($i+3)]}
+
+	mulx	8*3+128($a_ptr), $t0, $t1
+	 mov	@{[A($i)]}, %rdx
+	adcx	$t0, @{[A($i+3)]}
+	 shlx	$poly1, @{[A($i)]}, $t0
+	adox	$t1, @{[A($i+4)]}
+	 shrx	$poly1, @{[A($i)]}, $t1
+
+	adcx	@{[A($i+5)]}, @{[A($i+4)]}
+	adox	@{[A($i+5)]}, @{[A($i+5)]}
+	adc	\$0, @{[A($i+5)]}
+
+	########################################################################
+	# Reduction step
+	add	$t0, @{[A($i+1)]}
+	adc	$t1, @{[A($i+2)]}
+
+	mulx	$poly3, $t0, $t1
+___
+$code.=<<___	if ($i<3);
+	 mov	8*@{[$i+1]}($b_ptr), %rdx
+	adc	$t0, @{[A($i+3)]}
+	adc	$t1, @{[A($i+4)]}
+	adc	\$0, @{[A($i+5)]}
+	xor	@{[A($i)]}, @{[A($i)]}		# @{[A($i)]}=0,cf=0,of=0
+___
+}
+$code.=<<___;
+	 mov	$acc4, $t2
+	mov	.Lpoly+8*1(%rip), $poly1
+	adc	$t0, $acc0
+	 mov	$acc5, $t3
+	adc	$t1, $acc1
+	adc	\$0, $acc2
+	 mov	$acc0, $t0
+
+	########################################################################
+	# Branch-less conditional subtraction of P
+	 mov	$acc1, $t1
+	sub	\$-1, $acc4		# .Lpoly[0]
+	sbb	$poly1, $acc5		# .Lpoly[1]
+	sbb	\$0, $acc0		# .Lpoly[2]
+	sbb	$poly3, $acc1		# .Lpoly[3]
+	sbb	\$0, $acc2
+
+	cmovc	$t2, $acc4
+	cmovc	$t3, $acc5
+	mov	$acc4, 8*0($r_ptr)
+	cmovc	$t0, $acc0
+	mov	$acc5, 8*1($r_ptr)
+	cmovc	$t1, $acc1
+	mov	$acc0, 8*2($r_ptr)
+	mov	$acc1, 8*3($r_ptr)
+
+	ret
+.size	__ecp_nistz256_mul_montx,.-__ecp_nistz256_mul_montx
+
+.type	__ecp_nistz256_sqr_montx,\@abi-omnipotent
+.align	32
+__ecp_nistz256_sqr_montx:
+	mulx	$acc6, $acc1, $acc2	# a[0]*a[1]
+	mulx	$acc7, $t0, $acc3	# a[0]*a[2]
+	xor	%eax, %eax
+	adc	$t0, $acc2
+	mulx	$acc0, $t1, $acc4	# a[0]*a[3]
+	 mov	$acc6, %rdx
+	adc	$t1, $acc3
+	adc	\$0, $acc4
+	xor	$acc5, $acc5		# $acc5=0,cf=0,of=0
+
+	#################################
+	mulx	$acc7, $t0, $t1		# a[1]*a[2]
+	adcx	$t0, $acc3
+	adox	$t1, $acc4
+
+	mulx	$acc0, $t0, $t1		# a[1]*a[3]
+	 mov	$acc7, %rdx
+	adcx	$t0, $acc4
+	adox	$t1, $acc5
+	adc	\$0, $acc5
+
+	#################################
+	mulx	$acc0, $t0, $acc6	# a[2]*a[3]
+	 mov	8*0+128($a_ptr), %rdx
+	xor	$acc7, $acc7		# $acc7=0,cf=0,of=0
+	 adcx	$acc1, $acc1		# acc1:6<<1
+	adox	$t0, $acc5
+	 adcx	$acc2, $acc2
+	adox	$acc7, $acc6		# of=0
+
+	mulx	%rdx, $acc0, $t1
+	mov	8*1+128($a_ptr), %rdx
+	 adcx	$acc3, $acc3
+	adox	$t1, $acc1
+	 adcx	$acc4, $acc4
+	mulx	%rdx, $t0, $t4
+	mov	8*2+128($a_ptr), %rdx
+	 adcx	$acc5, $acc5
+	adox	$t0, $acc2
+	 adcx	$acc6, $acc6
+	mulx	%rdx, $t0, $t1
+	mov	8*3+128($a_ptr), %rdx
+	adox	$t4, $acc3
+	 adcx	$acc7, $acc7
+	adox	$t0, $acc4
+	 mov	\$32, $a_ptr
+	adox	$t1, $acc5
+	mulx	%rdx, $t0, $t4
+	 mov	.Lpoly+8*3(%rip), %rdx
+	adox	$t0, $acc6
+	 shlx	$a_ptr, $acc0, $t0
+	adox	$t4, $acc7
+	 shrx	$a_ptr, $acc0, $t4
+	mov	%rdx, $t1
+
+	##########################################
+	# Now the reduction
+	# First iteration
+	add	$t0, $acc1
+	adc	$t4, $acc2
+
+	mulx	$acc0, $t0, $acc0
+	adc	$t0, $acc3
+	 shlx	$a_ptr, $acc1, $t0
+	adc	\$0, $acc0
+	 shrx	$a_ptr, $acc1, $t4
+
+	##########################################
+	# Second iteration
+	add	$t0, $acc2
+	adc	$t4, $acc3
+
+	mulx	$acc1, $t0, $acc1
+	adc	$t0, $acc0
+	 shlx	$a_ptr, $acc2, $t0
+	adc	\$0, $acc1
+	 shrx	$a_ptr, $acc2, $t4
+
+	##########################################
+	# Third iteration
+	add	$t0, $acc3
+	adc	$t4, $acc0
+
+	mulx	$acc2, $t0, $acc2
+	adc	$t0, $acc1
+	 shlx	$a_ptr, $acc3, $t0
+	adc	\$0, $acc2
+	 shrx	$a_ptr, $acc3, $t4
+
+	###########################################
+	# Last iteration
+	add	$t0, $acc0
+	adc	$t4, $acc1
+
+	mulx	$acc3, $t0, $acc3
+	adc	$t0, $acc2
+	adc	\$0, $acc3
+
+	############################################
+	# Add the rest of the acc
+	xor	$t3, $t3
+	add	$acc0, $acc4
+	 mov	.Lpoly+8*1(%rip), $a_ptr
+	adc	$acc1, $acc5
+	 mov	$acc4, $acc0
+	adc	$acc2, $acc6
+	adc	$acc3, $acc7
+	 mov	$acc5, $acc1
+	adc	\$0, $t3
+
+	sub	\$-1, $acc4		# .Lpoly[0]
+	 mov	$acc6, $acc2
+	sbb	$a_ptr, $acc5		# .Lpoly[1]
+	sbb	\$0, $acc6		# .Lpoly[2]
+	 mov	$acc7, $acc3
+	sbb	$t1, $acc7		# .Lpoly[3]
+	sbb	\$0, $t3
+
+	cmovc	$acc0, $acc4
+	cmovc	$acc1, $acc5
+	mov	$acc4, 8*0($r_ptr)
+	cmovc	$acc2, $acc6
+	mov	$acc5, 8*1($r_ptr)
+	cmovc	$acc3, $acc7
+	mov	$acc6, 8*2($r_ptr)
+	mov	$acc7, 8*3($r_ptr)
+
+	ret
+.size	__ecp_nistz256_sqr_montx,.-__ecp_nistz256_sqr_montx
+___
+}
+
 }
 {
 my ($r_ptr,$in_ptr)=("%rdi","%rsi");
@@ -1096,6 +1387,138 @@ __ecp_nistz256_mul_by_2q:
 
 	ret
 .size	__ecp_nistz256_mul_by_2q,.-__ecp_nistz256_mul_by_2q
+___
+
+# The x versions avoid the sbb-from-itself partial flag dependency; they
+# are used together with __ecp_nistz256_[mul|sqr]_montx.
+$code.=<<___;
+.type	__ecp_nistz256_add_tox,\@abi-omnipotent
+.align	32
+__ecp_nistz256_add_tox:
+	xor	$t4, $t4
+	adc	8*0($b_ptr), $a0
+	adc	8*1($b_ptr), $a1
+	 mov	$a0, $t0
+	adc	8*2($b_ptr), $a2
+	adc	8*3($b_ptr), $a3
+	 mov	$a1, $t1
+	adc	\$0, $t4
+
+	xor	$t3, $t3
+	sbb	\$-1, $a0
+	 mov	$a2, $t2
+	sbb	$poly1, $a1
+	sbb	\$0, $a2
+	 mov	$a3, $t3
+	sbb	$poly3, $a3
+	sbb	\$0, $t4
+
+	cmovc	$t0, $a0
+	cmovc	$t1, $a1
+	mov	$a0, 8*0($r_ptr)
+	cmovc	$t2, $a2
+	mov	$a1, 8*1($r_ptr)
+	cmovc	$t3, $a3
+	mov	$a2, 8*2($r_ptr)
+	mov	$a3, 8*3($r_ptr)
+
+	ret
+.size	__ecp_nistz256_add_tox,.-__ecp_nistz256_add_tox
+
+.type	__ecp_nistz256_sub_fromx,\@abi-omnipotent
+.align	32
+__ecp_nistz256_sub_fromx:
+	xor	$t4, $t4
+	sbb	8*0($b_ptr), $a0
+	sbb	8*1($b_ptr), $a1
+	 mov	$a0, $t0
+	sbb	8*2($b_ptr), $a2
+	sbb	8*3($b_ptr), $a3
+	 mov	$a1, $t1
+	sbb	\$0, $t4
+
+	xor	$t3, $t3
+	adc	\$-1, $a0
+	 mov	$a2, $t2
+	adc	$poly1, $a1
+	adc	\$0, $a2
+	 mov	$a3, $t3
+	adc	$poly3, $a3
+
+	bt	\$0, $t4
+	cmovnc	$t0, $a0
+	cmovnc	$t1, $a1
+	mov	$a0, 8*0($r_ptr)
+	cmovnc	$t2, $a2
+	mov	$a1, 8*1($r_ptr)
+	cmovnc	$t3, $a3
+	mov	$a2, 8*2($r_ptr)
+	mov	$a3, 8*3($r_ptr)
+
+	ret
+.size	__ecp_nistz256_sub_fromx,.-__ecp_nistz256_sub_fromx
+
+.type	__ecp_nistz256_subx,\@abi-omnipotent
+.align	32
+__ecp_nistz256_subx:
+	xor	$t4, $t4
+	sbb	$a0, $t0
+	sbb	$a1, $t1
+	 mov	$t0, $a0
+	sbb	$a2, $t2
+	sbb	$a3, $t3
+	 mov	$t1, $a1
+	sbb	\$0, $t4
+
+	xor	$a3, $a3
+	adc	\$-1, $t0
+	 mov	$t2, $a2
+	adc	$poly1, $t1
+	adc	\$0, $t2
+	 mov	$t3, $a3
+	adc	$poly3, $t3
+
+	bt	\$0, $t4
+	cmovc	$t0, $a0
+	cmovc	$t1, $a1
+	cmovc	$t2, $a2
+	cmovc	$t3, $a3
+
+	ret
+.size	__ecp_nistz256_subx,.-__ecp_nistz256_subx
+
+.type	__ecp_nistz256_mul_by_2x,\@abi-omnipotent
+.align	32
+__ecp_nistz256_mul_by_2x:
+	xor	$t4, $t4
+	adc	$a0, $a0		# a0:a3+a0:a3
+	adc	$a1, $a1
+	 mov	$a0, $t0
+	adc	$a2, $a2
+	adc	$a3, $a3
+	 mov	$a1, $t1
+	adc	\$0, $t4
+
+	xor	$t3, $t3
+	sbb	\$-1, $a0
+	 mov	$a2, $t2
+	sbb	$poly1, $a1
+	sbb	\$0, $a2
+	 mov	$a3, $t3
+	sbb	$poly3, $a3
+	sbb	\$0, $t4
+
+	cmovc	$t0, $a0
+	cmovc	$t1, $a1
+	mov	$a0, 8*0($r_ptr)
+	cmovc	$t2, $a2
+	mov	$a1, 8*1($r_ptr)
+	cmovc	$t3, $a3
+	mov	$a2, 8*2($r_ptr)
+	mov	$a3, 8*3($r_ptr)
+
+	ret
+.size	__ecp_nistz256_mul_by_2x,.-__ecp_nistz256_mul_by_2x
 ___
 									}
 sub gen_double () {
@@ -1113,6 +1536,10 @@ $code.=<<___;
 .type	ecp_nistz256_point_double,\@function,2
 .align	32
 ecp_nistz256_point_double:
+	mov	\$0x80100, %ecx		# BMI2 and ADX
+	and	OPENSSL_ia32cap_ext_P(%rip), %ecx
+	cmp	\$0x80100, %ecx
+	je	.Lpoint_doublex
 ___
     } else {
 	$src0 = "%rdx";
@@ -1316,6 +1743,7 @@ $code.=<<___;
 ___
 }
 &gen_double("q");
+&gen_double("x");
 
 sub gen_add () {
     my $x = shift;
@@ -1337,11 +1765,22 @@ $code.=<<___;
 .type	ecp_nistz256_point_add,\@function,3
 .align	32
 ecp_nistz256_point_add:
+	mov	\$0x80100, %ecx		# BMI2 and ADX
+	and	OPENSSL_ia32cap_ext_P(%rip), %ecx
+	cmp	\$0x80100, %ecx
+	je	.Lpoint_addx
 ___
     } else {
 	$src0 = "%rdx";
 	$sfx  = "x";
 	$bias = 128;
+
+$code.=<<___;
+.type	ecp_nistz256_point_addx,\@function,3
+.align	32
+ecp_nistz256_point_addx:
+.Lpoint_addx:
+___
     }
 $code.=<<___;
 	push	%rbp
@@ -1672,6 +2111,7 @@ $code.=<<___;
 ___
 }
 &gen_add("q");
+&gen_add("x");
 
 sub gen_add_affine () {
     my $x = shift;
@@ -1692,11 +2132,22 @@ $code.=<<___;
 .type	ecp_nistz256_point_add_affine,\@function,3
 .align	32
 ecp_nistz256_point_add_affine:
+	mov	\$0x80100, %ecx		# BMI2 and ADX
+	and	OPENSSL_ia32cap_ext_P(%rip), %ecx
+	cmp	\$0x80100, %ecx
+	je	.Lpoint_add_affinex
 ___
     } else {
 	$src0 = "%rdx";
 	$sfx  = "x";
 	$bias = 128;
+
+$code.=<<___;
+.type	ecp_nistz256_point_add_affinex,\@function,3
+.align	32
+ecp_nistz256_point_add_affinex:
+.Lpoint_add_affinex:
+___
     }
 $code.=<<___;
 	push	%rbp
@@ -1963,6 +2414,7 @@ $code.=<<___;
 ___
 }
 &gen_add_affine("q");
+&gen_add_affine("x");
 
 }}}
 
@@ -0,0 +1,375 @@
+/*	$OpenBSD$	*/
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * Multiplication of the P-384 and P-521 generators with the comb tables in
+ * ec_comb_table.h, which are generated by ec_comb.pl. This is used
+ * by the generic GF(p) methods in place of the Montgomery ladder, which
+ * costs a doubling and an addition per scalar bit. The comb needs one
+ * doubling per d = ceil(n / (EC_COMB_TABLES * EC_COMB_TEETH)) bits and
+ * EC_COMB_TABLES additions of affine points per doubling.
+ *
+ * opensslfeatures.h defines OPENSSL_NO_EC_NISTP_64_GCC_128, so by default
+ * ec_curve.c builds P-384 and P-521 with EC_GFp_mont_method() or
+ * EC_GFp_nist_method() and this is their generator multiplication.
+ *
+ * Table entries are read in constant time. An addition is done for every
+ * table and column, also where the scalar bits select the point at
+ * infinity; its result is then discarded with a constant time swap. The
+ * sum starts at an offset point that is removed at the end, so that the
+ * generic point addition never sees the point at infinity. The BIGNUM
+ * arithmetic underneath is as constant time as it is for the ladder.
+ */
+
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+
+#include "bn_lcl.h"
+#include "constant_time_locl.h"
+#include "ec_lcl.h"
+
+#if BN_BITS2 != 64
+#define	TOBN(hi,lo)	lo,hi
+#else
+#define	TOBN(hi,lo)	((BN_ULONG)hi << 32 | lo)
+#endif
+
+#include "ec_comb_table.h"
+
+#define EC_COMB_ROWS	(EC_COMB_TABLES * EC_COMB_TEETH)
+
+struct ec_comb {
+	int words;		/* BN_ULONGs per coordinate */
+	const BN_ULONG *p;
+	const BN_ULONG *a;
+	const BN_ULONG *b;
+	const BN_ULONG *order;
+	const BN_ULONG *table;	/* [TABLES << TEETH][2][words] */
+	const BN_ULONG *offset;	/* Q and -2^(d - 1) * Q, [2][2][words] */
+	const BN_ULONG *table_mont;
+	const BN_ULONG *offset_mont;
+};
+
+static const struct ec_comb ec_combs[] = {
+	{
+		.words = 6 * 64 / BN_BITS2,
+		.p = ec_comb_p384_p,
+		.a = ec_comb_p384_a,
+		.b = ec_comb_p384_b,
+		.order = ec_comb_p384_order,
+		.table = &ec_comb_p384_table[0][0][0],
+		.offset = &ec_comb_p384_offset[0][0][0],
+		.table_mont = &ec_comb_p384_table_mont[0][0][0],
+		.offset_mont = &ec_comb_p384_offset_mont[0][0][0],
+	},
+	{
+		.words = 9 * 64 / BN_BITS2,
+		.p = ec_comb_p521_p,
+		.a = ec_comb_p521_a,
+		.b = ec_comb_p521_b,
+		.order = ec_comb_p521_order,
+		.table = &ec_comb_p521_table[0][0][0],
+		.offset = &ec_comb_p521_offset[0][0][0],
+		.table_mont = &ec_comb_p521_table_mont[0][0][0],
+		.offset_mont = &ec_comb_p521_offset_mont[0][0][0],
+	},
+};
+
+#define N_EC_COMBS (sizeof(ec_combs) / sizeof(ec_combs[0]))
+
+static int
+ec_comb_bn_equal(const BIGNUM *bn, const BN_ULONG *words, int n)
+{
+	int i;
+
+	if (BN_is_negative(bn) || bn->top > n)
+		return 0;
+	for (i = 0; i < n; i++) {
+		if ((i < bn->top ? bn->d[i] : 0) != words[i])
+			return 0;
+	}
+	return 1;
+}
+
+static int
+ec_comb_uses_mont(const EC_GROUP *group)
+{
+	return group->meth->field_encode == ec_GFp_mont_field_encode;
+}
+
+/*
+ * Return the comb for the generator of group, or NULL if there is none.
+ * The curve, the generator and the field representation of the method
+ * must all match the table.
+ */
+static const struct ec_comb *
+ec_comb_find(const EC_GROUP *group, BN_CTX *ctx)
+{
+	const struct ec_comb *comb = NULL;
+	const BN_ULONG *g;
+	BIGNUM *a, *b;
+	size_t i;
+
+	if (group->meth->field_type != NID_X9_62_prime_field)
+		return NULL;
+	if (group->meth->field_encode != NULL && !ec_comb_uses_mont(group))
+		return NULL;
+	if (group->generator == NULL || !group->generator->Z_is_one)
+		return NULL;
+
+	for (i = 0; i < N_EC_COMBS; i++) {
+		if (ec_comb_bn_equal(&group->field, ec_combs[i].p,
+		    ec_combs[i].words)) {
+			comb = &ec_combs[i];
+			break;
+		}
+	}
+	if (comb == NULL)
+		return NULL;
+	if (!ec_comb_bn_equal(&group->order, comb->order, comb->words))
+		return NULL;
+
+	/* Entry 1 of the first table is the generator. */
+	g = ec_comb_uses_mont(group) ? comb->table_mont : comb->table;
+	g += 2 * comb->words;
+	if (!ec_comb_bn_equal(&group->generator->X, g, comb->words) ||
+	    !ec_comb_bn_equal(&group->generator->Y, g + comb->words,
+	    comb->words))
+		return NULL;
+
+	BN_CTX_start(ctx);
+	if ((a = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if ((b = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if (group->meth->field_decode != NULL) {
+		if (!group->meth->field_decode(group, a, &group->a, ctx))
+			goto err;
+		if (!group->meth->field_decode(group, b, &group->b, ctx))
+			goto err;
+	} else {
+		if (!BN_copy(a, &group->a) || !BN_copy(b, &group->b))
+			goto err;
+	}
+	if (!ec_comb_bn_equal(a, comb->a, comb->words) ||
+	    !ec_comb_bn_equal(b, comb->b, comb->words))
+		comb = NULL;
+	BN_CTX_end(ctx);
+
+	return comb;
+
+ err:
+	BN_CTX_end(ctx);
+	return NULL;
+}
+
+static void
+ec_comb_load(EC_POINT *r, const BN_ULONG *point, int n)
+{
+	memcpy(r->X.d, point, n * sizeof(BN_ULONG));
+	memcpy(r->Y.d, point + n, n * sizeof(BN_ULONG));
+	r->X.top = r->Y.top = n;
+	r->X.neg = r->Y.neg = 0;
+	bn_correct_top(&r->X);
+	bn_correct_top(&r->Y);
+}
+
+/*
+ * Load entry idx of a table of affine points into r, in constant time. The
+ * coordinates are left at the full width of n words, even if their top
+ * words are zero, so that their top does not depend on idx. Since acc is
+ * blinded and never has Z_is_one set, EC_POINT_add() only passes them to
+ * field_mul, which works on such values.
+ */
+static void
+ec_comb_select(EC_POINT *r, const BN_ULONG *table, int n, int idx)
+{
+	BN_ULONG mask;
+	int i, j;
+
+	memset(r->X.d, 0, n * sizeof(BN_ULONG));
+	memset(r->Y.d, 0, n * sizeof(BN_ULONG));
+	for (i = 0; i < 1 << EC_COMB_TEETH; i++, table += 2 * n) {
+		mask = (BN_ULONG)0 - (constant_time_eq_int(i, idx) & 1);
+		for (j = 0; j < n; j++) {
+			r->X.d[j] |= table[j] & mask;
+			r->Y.d[j] |= table[n + j] & mask;
+		}
+	}
+	r->X.top = r->Y.top = n;
+	r->X.neg = r->Y.neg = 0;
+}
+
+static int
+ec_comb_point_swap(BN_ULONG cond, EC_POINT *a, EC_POINT *b, int n)
+{
+	int t;
+
+	if (!BN_swap_ct(cond, &a->X, &b->X, n) ||
+	    !BN_swap_ct(cond, &a->Y, &b->Y, n) ||
+	    !BN_swap_ct(cond, &a->Z, &b->Z, n))
+		return 0;
+	t = (a->Z_is_one ^ b->Z_is_one) & (int)(cond & 1);
+	a->Z_is_one ^= t;
+	b->Z_is_one ^= t;
+
+	return 1;
+}
+
+static int
+ec_comb_point_new(const EC_GROUP *group, EC_POINT **p, int n, BN_CTX *ctx)
+{
+	EC_POINT *point;
+
+	if ((*p = point = EC_POINT_new(group)) == NULL)
+		return 0;
+	if (bn_wexpand(&point->X, n) == NULL ||
+	    bn_wexpand(&point->Y, n) == NULL ||
+	    bn_wexpand(&point->Z, n) == NULL)
+		return 0;
+	BN_set_flags(&point->X, BN_FLG_CONSTTIME);
+	BN_set_flags(&point->Y, BN_FLG_CONSTTIME);
+	BN_set_flags(&point->Z, BN_FLG_CONSTTIME);
+
+	if (group->meth->field_set_to_one != NULL) {
+		if (!group->meth->field_set_to_one(group, &point->Z, ctx))
+			return 0;
+	} else {
+		if (!BN_one(&point->Z))
+			return 0;
+	}
+	point->Z_is_one = 1;
+
+	return 1;
+}
+
+static int
+ec_comb_mul(const EC_GROUP *group, const struct ec_comb *comb, EC_POINT *r,
+    const BIGNUM *scalar, BN_CTX *ctx)
+{
+	const BN_ULONG *table, *offset;
+	EC_POINT *acc = NULL, *sum = NULL, *t = NULL;
+	BIGNUM *k = NULL;
+	int order_bits, d, n, nw, kw, top;
+	int i, j, l, bit, idx;
+	BN_ULONG nonzero;
+	int ret = 0;
+
+	BN_CTX_start(ctx);
+
+	table = ec_comb_uses_mont(group) ? comb->table_mont : comb->table;
+	offset = ec_comb_uses_mont(group) ? comb->offset_mont : comb->offset;
+
+	n = comb->words;
+	order_bits = BN_num_bits(&group->order);
+	d = (order_bits + EC_COMB_ROWS - 1) / EC_COMB_ROWS;
+	nw = (EC_COMB_ROWS * d + BN_BITS2 - 1) / BN_BITS2;
+	top = n > group->field.top ? n : group->field.top;
+
+	if ((k = BN_CTX_get(ctx)) == NULL)
+		goto err;
+	if (!BN_copy(k, scalar))
+		goto err;
+	BN_set_flags(k, BN_FLG_CONSTTIME);
+	if (BN_num_bits(k) > order_bits || BN_is_negative(k)) {
+		/*
+		 * This is an unusual input, and we don't guarantee
+		 * constant-timeness
+		 */
+		if (!BN_nnmod(k, k, &group->order, ctx))
+			goto err;
+	}
+	/* Pad the scalar so that every row can be read without checks. */
+	kw = k->top;
+	if (bn_wexpand(k, nw) == NULL)
+		goto err;
+	memset(k->d + kw, 0, (nw - kw) * sizeof(BN_ULONG));
+
+	if (!ec_comb_point_new(group, &acc, top, ctx) ||
+	    !ec_comb_point_new(group, &sum, top, ctx) ||
+	    !ec_comb_point_new(group, &t, top, ctx))
+		goto err;
+
+	ec_comb_load(acc, offset, n);
+	if (!ec_point_blind_coordinates(group, acc, ctx))
+		goto err;
+
+	for (i = d - 1; i >= 0; i--) {
+		if (i != d - 1) {
+			if (!EC_POINT_dbl(group, acc, acc, ctx))
+				goto err;
+		}
+		for (j = 0; j < EC_COMB_TABLES; j++) {
+			idx = 0;
+			for (l = 0; l < EC_COMB_TEETH; l++) {
+				bit = (j * EC_COMB_TEETH + l) * d + i;
+				idx |= ((k->d[bit / BN_BITS2] >>
+				    (bit % BN_BITS2)) & 1) << l;
+			}
+
+			/* Add entry 1 instead of the point at infinity. */
+			nonzero = 1 & ~constant_time_is_zero(idx);
+			ec_comb_select(t, table + (j << EC_COMB_TEETH) * 2 * n,
+			    n, idx | (1 & ~nonzero));
+			if (!EC_POINT_add(group, sum, acc, t, ctx))
+				goto err;
+			if (!ec_comb_point_swap(nonzero, acc, sum, top))
+				goto err;
+		}
+	}
+
+	ec_comb_load(t, offset + 2 * n, n);
+	if (!EC_POINT_add(group, r, acc, t, ctx))
+		goto err;
+
+	ret = 1;
+
+ err:
+	if (k != NULL)
+		BN_clear(k);
+	EC_POINT_free(acc);
+	EC_POINT_free(sum);
+	EC_POINT_free(t);
+	BN_CTX_end(ctx);
+
+	return ret;
+}
+
+/*
+ * Compute r = scalar * G with the comb tables if group is P-384 or P-521
+ * with the standard generator. Return 1 on success, 0 on error and -1 if
+ * there is no table for the group.
+ */
+int
+ec_comb_mul_generator(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *scalar, BN_CTX *ctx)
+{
+	const struct ec_comb *comb;
+	BN_CTX *new_ctx = NULL;
+	int ret = -1;
+
+	if (ctx == NULL && (ctx = new_ctx = BN_CTX_new()) == NULL)
+		return 0;
+
+	if ((comb = ec_comb_find(group, ctx)) != NULL)
+		ret = ec_comb_mul(group, comb, r, scalar, ctx);
+
+	BN_CTX_free(new_ctx);
+
+	return ret;
+}
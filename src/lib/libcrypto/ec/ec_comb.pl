@@ -0,0 +1,248 @@
+#!/usr/bin/perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Generate the generator comb tables for P-384 and P-521 used by ec_comb.c.
+#
+# usage: ec_comb.pl ec_curve.c ec_comb_table.h
+#
+# The output is kept in the tree and is not rebuilt by the Makefile. Run
+# it from lib/libcrypto after changing the curves or the comb parameters:
+#
+#	perl ec/ec_comb.pl ec/ec_curve.c ec/ec_comb_table.h
+#
+# The curve parameters are read from ec_curve.c. For a group order of n
+# bits the scalar is split into ROWS rows of d = ceil(n / ROWS) bits, and
+# the rows are grouped into TABLES tables of TEETH rows each. Entry i of
+# table t is the sum of 2^(r * d) * G over the rows r = t * TEETH + j for
+# which bit j of i is set. Entry 0 would be the point at infinity and is
+# left zero.
+#
+# ec_comb.c starts from the offset point Q = 2^(ROWS * d) * G, so that it
+# never has to add the point at infinity, and removes it at the end by
+# adding -2^(d - 1) * Q. Both are written out after the tables.
+#
+# All points are affine. They are written both as they are and in the
+# Montgomery form used by EC_GFp_mont_method(), which depends on the
+# size of a BN_ULONG for P-521.
+
+use strict;
+use warnings;
+use Math::BigInt try => 'GMP';
+
+my $TEETH = 5;
+my $TABLES = 2;
+my $ROWS = $TEETH * $TABLES;
+my @CURVES = (384, 521);
+
+my ($in, $out) = @ARGV;
+die "usage: ec_comb.pl ec_curve.c ec_comb_table.h\n"
+    unless defined($in) && defined($out);
+
+open(my $fh, '<', $in) or die "$in: $!\n";
+my $src = do { local $/; <$fh> };
+close($fh);
+
+my ($p, $a);
+
+sub dbl {
+	my ($X, $Y, $Z) = @_;
+
+	return ($X, $Y, $Z) if ($Z->is_zero());
+	my $XX = $X->copy()->bmul($X)->bmod($p);
+	my $YY = $Y->copy()->bmul($Y)->bmod($p);
+	my $ZZ = $Z->copy()->bmul($Z)->bmod($p);
+	my $S = $X->copy()->bmul($YY)->bmul(4)->bmod($p);
+	my $M = $XX->copy()->bmul(3)->badd($ZZ->copy()->bmul($ZZ)->bmul($a))->
+	    bmod($p);
+	my $X3 = $M->copy()->bmul($M)->bsub($S)->bsub($S)->bmod($p);
+	my $Y3 = $S->copy()->bsub($X3)->bmul($M)->
+	    bsub($YY->copy()->bmul($YY)->bmul(8))->bmod($p);
+	my $Z3 = $Y->copy()->bmul($Z)->bmul(2)->bmod($p);
+	return ($X3, $Y3, $Z3);
+}
+
+sub add {
+	my ($X1, $Y1, $Z1, $X2, $Y2, $Z2) = @_;
+
+	return ($X2, $Y2, $Z2) if ($Z1->is_zero());
+	return ($X1, $Y1, $Z1) if ($Z2->is_zero());
+	my $Z1Z1 = $Z1->copy()->bmul($Z1)->bmod($p);
+	my $Z2Z2 = $Z2->copy()->bmul($Z2)->bmod($p);
+	my $U1 = $X1->copy()->bmul($Z2Z2)->bmod($p);
+	my $U2 = $X2->copy()->bmul($Z1Z1)->bmod($p);
+	my $S1 = $Y1->copy()->bmul($Z2Z2)->bmul($Z2)->bmod($p);
+	my $S2 = $Y2->copy()->bmul($Z1Z1)->bmul($Z1)->bmod($p);
+	my $H = $U2->copy()->bsub($U1)->bmod($p);
+	my $R = $S2->copy()->bsub($S1)->bmod($p);
+	if ($H->is_zero()) {
+		return dbl($X1, $Y1, $Z1) if ($R->is_zero());
+		return (Math::BigInt->new(1), Math::BigInt->new(1),
+		    Math::BigInt->new(0));
+	}
+	my $HH = $H->copy()->bmul($H)->bmod($p);
+	my $HHH = $HH->copy()->bmul($H)->bmod($p);
+	my $V = $U1->copy()->bmul($HH)->bmod($p);
+	my $X3 = $R->copy()->bmul($R)->bsub($HHH)->bsub($V)->bsub($V)->
+	    bmod($p);
+	my $Y3 = $V->copy()->bsub($X3)->bmul($R)->
+	    bsub($S1->copy()->bmul($HHH))->bmod($p);
+	my $Z3 = $H->copy()->bmul($Z1)->bmul($Z2)->bmod($p);
+	return ($X3, $Y3, $Z3);
+}
+
+sub affine {
+	my ($X, $Y, $Z) = @_;
+
+	die "point at infinity\n" if ($Z->is_zero());
+	my $zi = $Z->copy()->bmodinv($p);
+	my $zi2 = $zi->copy()->bmul($zi)->bmod($p);
+	return ($X->copy()->bmul($zi2)->bmod($p),
+	    $Y->copy()->bmul($zi2)->bmul($zi)->bmod($p));
+}
+
+# Print a number as little-endian 64-bit words, two per line.
+sub words {
+	my ($x, $nwords, $indent) = @_;
+	my $hex = substr($x->as_hex(), 2);
+	my @w;
+
+	$hex = ('0' x ($nwords * 16 - length($hex))) . $hex;
+	for (my $i = $nwords * 16; $i > 0; $i -= 16) {
+		my $word = substr($hex, $i - 16, 16);
+		push(@w, sprintf("TOBN(0x%s, 0x%s)",
+		    substr($word, 0, 8), substr($word, 8, 8)));
+	}
+	my $s = "";
+	for (my $i = 0; $i < @w; $i += 2) {
+		my $last = $i + 1 < @w ? $i + 1 : $i;
+		$s .= $indent . join(", ", @w[$i .. $last]) . ",\n";
+	}
+	return $s;
+}
+
+sub points {
+	my ($name, $dims, $pts, $r, $nwords) = @_;
+	my $s = "static const BN_ULONG\n$name$dims = {\n";
+
+	foreach my $pt (@$pts) {
+		$s .= "    {\n";
+		foreach my $c (@$pt) {
+			my $v = defined($r) ? $c->copy()->bmul($r)->bmod($p) :
+			    $c;
+			$s .= "\t{\n" . words($v, $nwords, "\t    ") . "\t},\n";
+		}
+		$s .= "    },\n";
+	}
+	return $s . "};\n";
+}
+
+open(my $oh, '>', "$out.tmp") or die "$out.tmp: $!\n";
+print $oh <<EOF;
+/*
+ * THIS FILE IS GENERATED FROM ec_curve.c BY ec_comb.pl. DO NOT EDIT.
+ */
+
+__BEGIN_HIDDEN_DECLS
+
+#define EC_COMB_TEETH	$TEETH
+#define EC_COMB_TABLES	$TABLES
+EOF
+
+foreach my $bits (@CURVES) {
+	$src =~ /_EC_NIST_PRIME_$bits\s*=\s*\{\s*\{\s*\w+,\s*(\d+),\s*(\d+),\s*\d+\s*\},\s*\{([^}]*)\}/
+	    or die "$in: no _EC_NIST_PRIME_$bits\n";
+	my ($seedlen, $len, $data) = ($1, $2, $3);
+	$data =~ s,/\*.*?\*/,,gs;
+	my @bytes = ($data =~ /0x([0-9a-fA-F]{2})/g);
+	die "$in: _EC_NIST_PRIME_$bits has the wrong size\n"
+	    unless @bytes == $seedlen + 6 * $len;
+	splice(@bytes, 0, $seedlen);
+	my @param;
+	for (my $i = 0; $i < 6; $i++) {
+		push(@param, Math::BigInt->from_hex(join("",
+		    @bytes[$i * $len .. ($i + 1) * $len - 1])));
+	}
+	my ($b, $x, $y, $order);
+	($p, $a, $b, $x, $y, $order) = @param;
+
+	my $nwords = int(($bits + 63) / 64);
+	my $obits = length($order->as_bin()) - 2;
+	my $d = int(($obits + $ROWS - 1) / $ROWS);
+
+	# 2^(r * d) * G for r < ROWS, then the offset and its correction
+	my @pt = ($x, $y, Math::BigInt->new(1));
+	my @base;
+	for (my $i = 0; $i < $ROWS * $d + $d - 1; $i++) {
+		push(@base, [ @pt ]) if ($i % $d == 0 && $i < $ROWS * $d);
+		@pt = dbl(@pt);
+	}
+	my @offset = affine(@pt);
+	$offset[1] = $p->copy()->bsub($offset[1]);
+	@pt = ($x, $y, Math::BigInt->new(1));
+	for (my $i = 0; $i < $ROWS * $d; $i++) {
+		@pt = dbl(@pt);
+	}
+	my @q = affine(@pt);
+
+	my @table;
+	for (my $t = 0; $t < $TABLES; $t++) {
+		my @jac = ([ Math::BigInt->new(1), Math::BigInt->new(1),
+		    Math::BigInt->new(0) ]);
+		push(@table, [ Math::BigInt->new(0), Math::BigInt->new(0) ]);
+		for (my $i = 1; $i < (1 << $TEETH); $i++) {
+			my $j = 0;
+			$j++ while (($i >> $j) > 1);
+			push(@jac, [ add(@{$jac[$i & ~(1 << $j)]},
+			    @{$base[$t * $TEETH + $j]}) ]);
+			push(@table, [ affine(@{$jac[$i]}) ]);
+		}
+	}
+
+	my $name = "ec_comb_p$bits";
+	my $dims = "[$nwords * 64 / BN_BITS2]";
+	print $oh "\n";
+	foreach my $v ([ "p", $p ], [ "a", $a ], [ "b", $b ],
+	    [ "order", $order ]) {
+		print $oh "static const BN_ULONG ${name}_$v->[0]\[] = {\n";
+		print $oh words($v->[1], $nwords, "\t");
+		print $oh "};\n";
+	}
+
+	my $r64 = Math::BigInt->new(2)->bpow(64 * $nwords)->bmod($p);
+	my $r32 = Math::BigInt->new(2)->bpow(32 * int(($bits + 31) / 32))->
+	    bmod($p);
+	my @forms = ([ "", undef ]);
+	if ($r64 == $r32) {
+		push(@forms, [ "_mont", $r64 ]);
+	} else {
+		push(@forms, [ "_mont", $r64, "#if BN_BITS2 == 64" ]);
+		push(@forms, [ "_mont", $r32, "#else" ]);
+	}
+	foreach my $f (@forms) {
+		my ($suffix, $r, $cpp) = @$f;
+		print $oh "\n";
+		print $oh "$cpp\n" if (defined($cpp));
+		print $oh points("${name}_table$suffix",
+		    "[EC_COMB_TABLES << EC_COMB_TEETH][2]$dims", \@table, $r,
+		    $nwords);
+		print $oh points("${name}_offset$suffix", "[2][2]$dims",
+		    [ \@q, \@offset ], $r, $nwords);
+	}
+	print $oh "#endif\n" if (@forms > 2);
+}
+
+print $oh "\n__END_HIDDEN_DECLS\n";
+close($oh) or die "$out.tmp: $!\n";
+rename("$out.tmp", $out) or die "$out: $!\n";
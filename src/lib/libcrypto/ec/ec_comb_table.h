@@ -0,0 +1,4850 @@
+/*
+ * THIS FILE IS GENERATED FROM ec_curve.c BY ec_comb.pl. DO NOT EDIT.
+ */
+
+__BEGIN_HIDDEN_DECLS
+
+#define EC_COMB_TEETH	5
+#define EC_COMB_TABLES	2
+
+static const BN_ULONG ec_comb_p384_p[] = {
+	TOBN(0x00000000, 0xffffffff), TOBN(0xffffffff, 0x00000000),
+	TOBN(0xffffffff, 0xfffffffe), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+};
+static const BN_ULONG ec_comb_p384_a[] = {
+	TOBN(0x00000000, 0xfffffffc), TOBN(0xffffffff, 0x00000000),
+	TOBN(0xffffffff, 0xfffffffe), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+};
+static const BN_ULONG ec_comb_p384_b[] = {
+	TOBN(0x2a85c8ed, 0xd3ec2aef), TOBN(0xc656398d, 0x8a2ed19d),
+	TOBN(0x0314088f, 0x5013875a), TOBN(0x181d9c6e, 0xfe814112),
+	TOBN(0x988e056b, 0xe3f82d19), TOBN(0xb3312fa7, 0xe23ee7e4),
+};
+static const BN_ULONG ec_comb_p384_order[] = {
+	TOBN(0xecec196a, 0xccc52973), TOBN(0x581a0db2, 0x48b0a77a),
+	TOBN(0xc7634d81, 0xf4372ddf), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+};
+
+static const BN_ULONG
+ec_comb_p384_table[EC_COMB_TABLES << EC_COMB_TEETH][2][6 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x3a545e38, 0x72760ab7), TOBN(0x5502f25d, 0xbf55296c),
+	    TOBN(0x59f741e0, 0x82542a38), TOBN(0x6e1d3b62, 0x8ba79b98),
+	    TOBN(0x8eb1c71e, 0xf320ad74), TOBN(0xaa87ca22, 0xbe8b0537),
+	},
+	{
+	    TOBN(0x7a431d7c, 0x90ea0e5f), TOBN(0x0a60b1ce, 0x1d7e819d),
+	    TOBN(0xe9da3113, 0xb5f0b8c0), TOBN(0xf8f41dbd, 0x289a147c),
+	    TOBN(0x5d9e98bf, 0x9292dc29), TOBN(0x3617de4a, 0x96262c6f),
+	},
+    },
+    {
+	{
+	    TOBN(0xcbd89c74, 0xee69fc0f), TOBN(0xceaa5177, 0x777bd97c),
+	    TOBN(0xe113574a, 0x03955391), TOBN(0x98bb969c, 0x1b6fcf81),
+	    TOBN(0xd1c6bce5, 0x64591d15), TOBN(0x1ec28025, 0xba330842),
+	},
+	{
+	    TOBN(0xfd1e4b9e, 0x34829dc8), TOBN(0x1b0007d1, 0x5b2aadde),
+	    TOBN(0x391dee1c, 0x25ecf474), TOBN(0xd41ee6ec, 0x70ba0b4d),
+	    TOBN(0xe3c9e311, 0xa942b396), TOBN(0x7bbc02cd, 0xba9a279c),
+	},
+    },
+    {
+	{
+	    TOBN(0xdb8086a4, 0xf66637f5), TOBN(0x55cf72f5, 0x7704f3b9),
+	    TOBN(0xeb4a6c28, 0x32a6990b), TOBN(0x57c6f4e6, 0x911db9e3),
+	    TOBN(0x503b5599, 0xc9f59c20), TOBN(0x31fb52bc, 0xd920a08f),
+	},
+	{
+	    TOBN(0xb4e217be, 0x26cfe2fe), TOBN(0x54358fe7, 0xa00c158b),
+	    TOBN(0x37194153, 0xbe896d26), TOBN(0x9a27068a, 0x39f80172),
+	    TOBN(0xeaf1fef9, 0x9993a5d3), TOBN(0xed3ee158, 0x9296ccd4),
+	},
+    },
+    {
+	{
+	    TOBN(0x63c86b90, 0x43ad5051), TOBN(0x3e5a44a7, 0x037db034),
+	    TOBN(0x46471963, 0x4f6bbc3e), TOBN(0xbcbee39a, 0x6d59f0c5),
+	    TOBN(0x89b81c4f, 0x6a8ece33), TOBN(0x79d29243, 0xdcde4107),
+	},
+	{
+	    TOBN(0xce4e0ce5, 0x928f3240), TOBN(0xb32dd9da, 0x7579045d),
+	    TOBN(0x24c45a58, 0xec1346f4), TOBN(0x4204b656, 0x94918c2e),
+	    TOBN(0xe225dcce, 0x675bbb07), TOBN(0x99a5cf1b, 0xd320b877),
+	},
+    },
+    {
+	{
+	    TOBN(0x3ed4e32a, 0xa7d9380d), TOBN(0x396354f9, 0x877f918c),
+	    TOBN(0x70955caf, 0xbd840bcc), TOBN(0x3431cc25, 0x255eacfb),
+	    TOBN(0x4db66f1b, 0xae87ba46), TOBN(0x07f514bf, 0x94bc480b),
+	},
+	{
+	    TOBN(0x52b1b62a, 0x3dd78ff1), TOBN(0xf0dfdac7, 0x58022f46),
+	    TOBN(0xf818ebc4, 0x52f6bac5), TOBN(0x54ecc52c, 0xed2c79ab),
+	    TOBN(0x5d107bed, 0x3f0e64a6), TOBN(0x90848d10, 0xa74d518b),
+	},
+    },
+    {
+	{
+	    TOBN(0xa81a8c48, 0xe8b1c294), TOBN(0xbe3b9f88, 0x7e98ec77),
+	    TOBN(0x1b8baf73, 0x966268f8), TOBN(0x27e24c03, 0xc7cb8572),
+	    TOBN(0x088caf80, 0xe2d07be3), TOBN(0x90fea81f, 0x1ab8a70f),
+	},
+	{
+	    TOBN(0x98a210ba, 0xb87be8f5), TOBN(0xd16d0cad, 0x9e211036),
+	    TOBN(0x7e16a626, 0x4fb73498), TOBN(0x5d56b143, 0x1ac70f38),
+	    TOBN(0x4249c172, 0x244689ee), TOBN(0x0dfaf4f5, 0x7fc65a6a),
+	},
+    },
+    {
+	{
+	    TOBN(0x98ee7463, 0x4014a5b0), TOBN(0x58cee641, 0xdc36ee23),
+	    TOBN(0x338314b7, 0x9d8a7b66), TOBN(0xaae9eb73, 0xe7f3fc4e),
+	    TOBN(0x3f861f51, 0x241028d3), TOBN(0x59d238ea, 0xdb4e162e),
+	},
+	{
+	    TOBN(0x4d495ece, 0xc4a59deb), TOBN(0x3ed4efd4, 0x262be0c9),
+	    TOBN(0xfc433694, 0x5ed70a74), TOBN(0xd76bec67, 0xd35460a4),
+	    TOBN(0xcb5cb04a, 0x6df24e5f), TOBN(0x00bf97fe, 0xbefe7017),
+	},
+    },
+    {
+	{
+	    TOBN(0x61f246f1, 0x5d80df16), TOBN(0x282c3a33, 0x8e87308b),
+	    TOBN(0x0df0a00e, 0x089c502c), TOBN(0x9f92bc77, 0x8c637292),
+	    TOBN(0xb9254295, 0x6c78bda4), TOBN(0xd4fb4faf, 0x93aafe25),
+	},
+	{
+	    TOBN(0x6d4f4907, 0x7dbf2133), TOBN(0x49647396, 0x0d783e12),
+	    TOBN(0x30ee099e, 0xb6c179c2), TOBN(0xaeed6fab, 0xd9f6fcdc),
+	    TOBN(0x269eacb5, 0x636724d3), TOBN(0xb6224913, 0xaf108fb9),
+	},
+    },
+    {
+	{
+	    TOBN(0x088d66b3, 0xc366994e), TOBN(0x89a35f66, 0xcff068fd),
+	    TOBN(0x1c1fd77b, 0x8110e5d1), TOBN(0x8e6be3a5, 0x0f24fa70),
+	    TOBN(0x0f6c418e, 0x2fc10d36), TOBN(0x3a03d9b3, 0x467dd55e),
+	},
+	{
+	    TOBN(0xaf9b2f39, 0x7530b712), TOBN(0xc8647675, 0x924711f1),
+	    TOBN(0x80c606e2, 0x8c1fbc04), TOBN(0xbd4fe848, 0x7079ec35),
+	    TOBN(0x64bbee46, 0x55ce2c91), TOBN(0x5b5c81fc, 0xf4fb4c4b),
+	},
+    },
+    {
+	{
+	    TOBN(0x40adf57c, 0xb33ab156), TOBN(0x5ad499f3, 0xc3cb2891),
+	    TOBN(0x7420794e, 0x7c7fb275), TOBN(0xcab80c22, 0xae380f4a),
+	    TOBN(0x91d43945, 0x42a8f8f2), TOBN(0xd60d871f, 0xe460de06),
+	},
+	{
+	    TOBN(0xb713c319, 0xfe676195), TOBN(0x7a1e0414, 0xbdee917f),
+	    TOBN(0x10aa8b14, 0xb033a319), TOBN(0xa1d8c9ba, 0x29cfd427),
+	    TOBN(0xbce788a0, 0x21d7a7f5), TOBN(0x9c2b6ba5, 0xe4fc0458),
+	},
+    },
+    {
+	{
+	    TOBN(0xf3e8e855, 0x7adc8563), TOBN(0x0e076d2f, 0xc0688b84),
+	    TOBN(0x74407601, 0xa803569b), TOBN(0x1286ea01, 0x508b3d0b),
+	    TOBN(0xf49944b7, 0x432fcff8), TOBN(0x6f2045db, 0xd6925c77),
+	},
+	{
+	    TOBN(0x182c2386, 0x677bb469), TOBN(0x4812bdc9, 0xd15b065e),
+	    TOBN(0xa28c08e6, 0x8f2b57cd), TOBN(0x9e99ac33, 0x30f3c9d0),
+	    TOBN(0x64052479, 0x651802e7), TOBN(0x6060bc48, 0x5d80b52f),
+	},
+    },
+    {
+	{
+	    TOBN(0xfd78ca57, 0xe919214e), TOBN(0x16453e62, 0x50b49f10),
+	    TOBN(0x3a787101, 0xfdcd57e3), TOBN(0x9d64f846, 0x221bd7d7),
+	    TOBN(0x1dd7cc93, 0x9fe1e20b), TOBN(0x75e8d614, 0x66f8e384),
+	},
+	{
+	    TOBN(0xe3b664bf, 0xcbf5afe9), TOBN(0xe6f4e6d2, 0x6f1e2a23),
+	    TOBN(0x72a5fa98, 0x9d896e31), TOBN(0xd52dffa0, 0x4366769c),
+	    TOBN(0x17934f9f, 0xae97d7d3), TOBN(0x4e18366b, 0x73d78631),
+	},
+    },
+    {
+	{
+	    TOBN(0x875824b2, 0x9985d9fb), TOBN(0x6c7784ba, 0x46826c09),
+	    TOBN(0xb6fad1fd, 0x0244922e), TOBN(0x94a6f8fb, 0xb87a6ea7),
+	    TOBN(0x95fdf140, 0x69d5e91c), TOBN(0x00ef8cf6, 0xc76a83ff),
+	},
+	{
+	    TOBN(0xa0a1e77f, 0x31caba4f), TOBN(0x00c37c31, 0xf377e1b6),
+	    TOBN(0x471c61b2, 0xfd380c3f), TOBN(0x854477d9, 0x1719f389),
+	    TOBN(0x706e4377, 0x0c02370e), TOBN(0x9134441c, 0xa11fc671),
+	},
+    },
+    {
+	{
+	    TOBN(0x4caf5c77, 0x37621de3), TOBN(0xa88dc671, 0xee7708db),
+	    TOBN(0x100ae731, 0xadfa43f6), TOBN(0x109b1e2a, 0x5dd06ed8),
+	    TOBN(0xbbdbe06d, 0xe76967b3), TOBN(0xb4694adb, 0xa9884189),
+	},
+	{
+	    TOBN(0x53a787bb, 0xfc28f624), TOBN(0x7c85be18, 0xe1092463),
+	    TOBN(0xe38bf229, 0x8af89d4b), TOBN(0xfcecc998, 0x619c6c35),
+	    TOBN(0x9f8f19b3, 0xad115a28), TOBN(0x4e8a11a2, 0x856ca1c4),
+	},
+    },
+    {
+	{
+	    TOBN(0x68d529b9, 0xb5926c2a), TOBN(0x83247fb4, 0x57a30518),
+	    TOBN(0xc680e252, 0xd180932d), TOBN(0x8febd69a, 0x59591dc5),
+	    TOBN(0x27ff6839, 0x2ad92421), TOBN(0x2a4c5c3c, 0xd9940da1),
+	},
+	{
+	    TOBN(0xcd0a7583, 0xf636c08c), TOBN(0x2665a64c, 0x2b3b561d),
+	    TOBN(0x40f48e44, 0x2619bd9c), TOBN(0x9c10d6fc, 0x97306168),
+	    TOBN(0x82a1d45b, 0x0ba162aa), TOBN(0x585ddad9, 0xcce6163c),
+	},
+    },
+    {
+	{
+	    TOBN(0x98163d17, 0x91f22d45), TOBN(0xdb56b796, 0xc56e9558),
+	    TOBN(0x84d52975, 0x6d0f4d11), TOBN(0x0e7c0d8f, 0xd2000d91),
+	    TOBN(0xdd83eadf, 0xe0e16028), TOBN(0xd15fdfb4, 0xeccf825f),
+	},
+	{
+	    TOBN(0x183b44e1, 0x92b01ea6), TOBN(0x7414770c, 0x01ae050c),
+	    TOBN(0xf339b53d, 0xd705d880), TOBN(0xab2344eb, 0xfaa8f031),
+	    TOBN(0x04ae4be6, 0x65ab7f33), TOBN(0x1bbea6c3, 0x8ab95c34),
+	},
+    },
+    {
+	{
+	    TOBN(0xcc650cdc, 0x1e1e6c79), TOBN(0xd5ae875d, 0x1562b7d5),
+	    TOBN(0x652cf2c8, 0xafb94d4e), TOBN(0x4a9d8ae7, 0x9856bdc7),
+	    TOBN(0x80e1b080, 0xbe8f3fff), TOBN(0x0f4f432c, 0x9bb0b3f5),
+	},
+	{
+	    TOBN(0x5c240569, 0x6bfd1abc), TOBN(0xc2059b49, 0xa36de353),
+	    TOBN(0x4f8157d1, 0xa53aaca0), TOBN(0x3034162e, 0xc63311c8),
+	    TOBN(0xef8e8f8c, 0x441bec88), TOBN(0xc78ef191, 0x09b6d189),
+	},
+    },
+    {
+	{
+	    TOBN(0xd5c7f047, 0xa489f7bf), TOBN(0x49a2af50, 0x91438bf6),
+	    TOBN(0x6aaa1811, 0xe4602baa), TOBN(0x17a4f535, 0x285e2cc2),
+	    TOBN(0x1ecd0011, 0x6ce27a92), TOBN(0x94169ec8, 0x057d33ef),
+	},
+	{
+	    TOBN(0x43a71ad5, 0x5d813ba0), TOBN(0x195598ac, 0x354057d8),
+	    TOBN(0x8949426e, 0x20573bee), TOBN(0x73a8e034, 0xff2fe3a6),
+	    TOBN(0xf44d96ec, 0x859f322d), TOBN(0x8aeeff62, 0x7dbef59a),
+	},
+    },
+    {
+	{
+	    TOBN(0xda500684, 0x59211c0a), TOBN(0x9f0bbb31, 0xc01c9978),
+	    TOBN(0x2449c47e, 0xd509bd31), TOBN(0x1a89e550, 0x18ef274f),
+	    TOBN(0x5965c52b, 0xa10d3ec8), TOBN(0x437adfd8, 0xa34b2c0a),
+	},
+	{
+	    TOBN(0x03cc8e48, 0xa76d4a5b), TOBN(0x41cf2fa2, 0xfd3b0d4e),
+	    TOBN(0x1309b8d1, 0xaa93a9e8), TOBN(0xe6594df4, 0xd5894362),
+	    TOBN(0x50e46fbd, 0x38af14d5), TOBN(0x6dcf75e5, 0xb9c63b98),
+	},
+    },
+    {
+	{
+	    TOBN(0xf892c656, 0x0ec655c3), TOBN(0xd38f0887, 0x380dc09b),
+	    TOBN(0x588b5a6a, 0xa08b4263), TOBN(0x2df0f08d, 0xee510538),
+	    TOBN(0x6cc88ff6, 0xe0fa458f), TOBN(0x43ccff5e, 0x2ff5684d),
+	},
+	{
+	    TOBN(0x8fef54cc, 0x029ea2d1), TOBN(0x21f31f7c, 0x8703e243),
+	    TOBN(0x6c538c94, 0xc945d2f3), TOBN(0xd6d2086b, 0x00f0fc32),
+	    TOBN(0xe9f12c81, 0xcaa4fb1c), TOBN(0x8b10cd3a, 0x3c942643),
+	},
+    },
+    {
+	{
+	    TOBN(0x06b9cbe5, 0x271a72fd), TOBN(0x6858660d, 0x8f6fced7),
+	    TOBN(0x155d6ca1, 0x9177e087), TOBN(0x831e016e, 0xbd334f38),
+	    TOBN(0xd673d487, 0xc3d826aa), TOBN(0xe3ffb726, 0x9f544b1a),
+	},
+	{
+	    TOBN(0x4ac6e694, 0x58a7c088), TOBN(0x3911fd33, 0x1a3b3331),
+	    TOBN(0xa9d4eb62, 0x32126da8), TOBN(0xb6376785, 0x0f05eb8a),
+	    TOBN(0xd47cb267, 0xee5669c2), TOBN(0xe3c7362d, 0x7d0c619d),
+	},
+    },
+    {
+	{
+	    TOBN(0x2bdc7558, 0x80b22c87), TOBN(0xf66c85d0, 0x5967205f),
+	    TOBN(0x7366a505, 0x10bbefa6), TOBN(0xdda15872, 0xe2ad0f39),
+	    TOBN(0x6f537ae8, 0x009ba6be), TOBN(0xc8c0c1d9, 0x79f9e421),
+	},
+	{
+	    TOBN(0x286b49a5, 0x12870d40), TOBN(0x76ea7ca8, 0x05acab90),
+	    TOBN(0xf95caa8f, 0x6bacad99), TOBN(0x4cef9fd3, 0x093dab71),
+	    TOBN(0x37bb76a4, 0xca44774a), TOBN(0x6ccd480a, 0x28bb7f1d),
+	},
+    },
+    {
+	{
+	    TOBN(0xdfbaa94d, 0x588c3af9), TOBN(0x8a3ec82d, 0xfc0324bf),
+	    TOBN(0x30606737, 0xa89490fb), TOBN(0x89d716e2, 0x1ed11547),
+	    TOBN(0x80a3cbd0, 0x2e1baa7f), TOBN(0xfcbe1135, 0x79ed856a),
+	},
+	{
+	    TOBN(0x90c8e436, 0x1a9aad48), TOBN(0x90580ace, 0xee4baa03),
+	    TOBN(0xe1474965, 0x1f6099fb), TOBN(0x05e09a14, 0xa21fbd0f),
+	    TOBN(0x5143af0e, 0x0cd0e894), TOBN(0x92675b3f, 0x347bb351),
+	},
+    },
+    {
+	{
+	    TOBN(0xe6d398f0, 0xa1815d15), TOBN(0x0ba75ee0, 0xe7741b13),
+	    TOBN(0x43d59267, 0x8cf78a40), TOBN(0x33e20a06, 0x8126c86a),
+	    TOBN(0xfe7de35e, 0x225ac056), TOBN(0xfb6110d6, 0xc5341e8f),
+	},
+	{
+	    TOBN(0xe49110c5, 0x54128e80), TOBN(0x347982f8, 0xcb7873af),
+	    TOBN(0xe1b6f02e, 0xe40a0f5e), TOBN(0x0b938562, 0xaa40f9ed),
+	    TOBN(0xe7d203bd, 0x667cf91b), TOBN(0xe7d77e7e, 0x30451e7f),
+	},
+    },
+    {
+	{
+	    TOBN(0x49da15b4, 0xee880376), TOBN(0x87a48ecb, 0xfdd83198),
+	    TOBN(0x7fb7d1f0, 0x8a67994e), TOBN(0x2a9d118a, 0x50a256ed),
+	    TOBN(0x5fc7a4e5, 0xcf501908), TOBN(0xf6764bb0, 0x422ba7aa),
+	},
+	{
+	    TOBN(0xd95d5dd2, 0x2e7ef00b), TOBN(0x2be0ffdd, 0x7dd02bf2),
+	    TOBN(0xed338c04, 0x0fcc434f), TOBN(0xe76aa8fb, 0x031055b8),
+	    TOBN(0x003cd7cb, 0xe7801e81), TOBN(0xcb0f56b1, 0xad30538f),
+	},
+    },
+    {
+	{
+	    TOBN(0x007384ee, 0xbc119f86), TOBN(0xfcf2b3b9, 0x5973eec4),
+	    TOBN(0x645d8e57, 0xbcff8c67), TOBN(0x954e73c3, 0x3f3b4862),
+	    TOBN(0xb3adde60, 0x94bbc0da), TOBN(0x0e82327c, 0x354a1dd2),
+	},
+	{
+	    TOBN(0xec91409f, 0xe853eb02), TOBN(0x90813e99, 0x569cd51f),
+	    TOBN(0xcdab23cb, 0x2500a07d), TOBN(0x58371515, 0x70f4fefb),
+	    TOBN(0x7bccfd5f, 0x186ba630), TOBN(0xe4fa4b5b, 0xf74b7a30),
+	},
+    },
+    {
+	{
+	    TOBN(0xafd273d4, 0xe5fe7eb1), TOBN(0x14ef9812, 0xb5e1f8ad),
+	    TOBN(0x57040fff, 0xaedefb29), TOBN(0x1f34bac6, 0xe66fccb2),
+	    TOBN(0x6b438a04, 0xd56a8c9d), TOBN(0xd1dd13ab, 0xb6b7a0ab),
+	},
+	{
+	    TOBN(0x01f7ccb8, 0xa5d5e741), TOBN(0x49eb9465, 0x4480ee59),
+	    TOBN(0xcb79eb8a, 0x496d9677), TOBN(0x4d2a1768, 0x8bf83396),
+	    TOBN(0x571fe8d9, 0xd24efe5c), TOBN(0x79b2b2e2, 0x01510c8b),
+	},
+    },
+    {
+	{
+	    TOBN(0x75cceaca, 0xd65951e8), TOBN(0xb605ce25, 0xf217a652),
+	    TOBN(0xfa23a6a6, 0x044d277b), TOBN(0x5647be20, 0x10adf17d),
+	    TOBN(0xe372b47b, 0x3138eb4b), TOBN(0xa23698d6, 0xad144159),
+	},
+	{
+	    TOBN(0xa75db9bb, 0x9190f271), TOBN(0x0855a530, 0x577f3372),
+	    TOBN(0xc8eb5a83, 0x6214e500), TOBN(0xae387d11, 0xbe91bfc7),
+	    TOBN(0x14c65290, 0x031017c4), TOBN(0xc9a82e01, 0x1fe444ce),
+	},
+    },
+    {
+	{
+	    TOBN(0xed93627d, 0x4f6242f6), TOBN(0x311c49a8, 0x98f8168d),
+	    TOBN(0x02c23489, 0x3a489c2a), TOBN(0x5b1c07a7, 0x9086115f),
+	    TOBN(0x1d0726e0, 0x888361f1), TOBN(0x66f950db, 0xce47587d),
+	},
+	{
+	    TOBN(0xa711b4b5, 0xb685f0be), TOBN(0xe408bfbb, 0x99b46772),
+	    TOBN(0x51d93852, 0xd76ad612), TOBN(0x4d73592b, 0x5902529b),
+	    TOBN(0x8e0cc759, 0x3d1eebbe), TOBN(0x003ff108, 0xb3203be8),
+	},
+    },
+    {
+	{
+	    TOBN(0xb94ff57e, 0xc81540d4), TOBN(0x0096ed9e, 0xc78aa705),
+	    TOBN(0xfe67ee1f, 0x0a9a7291), TOBN(0xd4052ad8, 0x48208d33),
+	    TOBN(0x27e37b73, 0x18c53e78), TOBN(0x47c88117, 0x44da57cc),
+	},
+	{
+	    TOBN(0x5bbbd01a, 0x6ac25d85), TOBN(0x78445dcb, 0xd47d2b83),
+	    TOBN(0x59f1dba5, 0x0a621238), TOBN(0x3979eefe, 0x4ef44469),
+	    TOBN(0x832375ba, 0x47cf61f4), TOBN(0x32ca8029, 0x3eba7035),
+	},
+    },
+    {
+	{
+	    TOBN(0x8f3011c5, 0x42521efa), TOBN(0x75f7c631, 0x195b41dc),
+	    TOBN(0xdd5a294b, 0xc65d1967), TOBN(0x89b00a95, 0xe7aded6b),
+	    TOBN(0x41247cb6, 0x8e979338), TOBN(0x85a4479f, 0xef526881),
+	},
+	{
+	    TOBN(0x16bfe633, 0x9b1e3a0f), TOBN(0xe38cf2f9, 0x8771a560),
+	    TOBN(0xd0a6710e, 0xdea05eb0), TOBN(0x1070acd7, 0x8b2b5dd2),
+	    TOBN(0xf836faea, 0xca79a910), TOBN(0x208ca698, 0xc216e528),
+	},
+    },
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0xaefea69f, 0x3d36263b), TOBN(0x00ed9abb, 0x9fef7208),
+	    TOBN(0x3291757f, 0x84bd8434), TOBN(0x2a8f6998, 0x9374df94),
+	    TOBN(0x1d2f03cf, 0x2e93f34c), TOBN(0x9c936818, 0x4eadad3f),
+	},
+	{
+	    TOBN(0x916baaff, 0x916cde09), TOBN(0x8317497d, 0xd62df5b0),
+	    TOBN(0xf5d41e42, 0x3a0958b0), TOBN(0x8d7d6d6a, 0x7f1317ea),
+	    TOBN(0x0a41b8aa, 0x3d48973d), TOBN(0x953b8743, 0x02848605),
+	},
+    },
+    {
+	{
+	    TOBN(0xec3fa501, 0x30d96b56), TOBN(0x7cbf4582, 0x47497265),
+	    TOBN(0xd759a88a, 0xe250b41c), TOBN(0xe40eb4d8, 0x85a752cb),
+	    TOBN(0x599e5b75, 0xccb7732a), TOBN(0xa2e41ceb, 0x2dd3d73b),
+	},
+	{
+	    TOBN(0x3c29d7a8, 0x2247d827), TOBN(0x038ab2f2, 0x9cb90c44),
+	    TOBN(0x4ebecc3d, 0xd1cdc8b2), TOBN(0xa5bb57aa, 0x04ec0991),
+	    TOBN(0xe5fc6441, 0xd0a8808b), TOBN(0x25fa5fe3, 0xc6ed4fc9),
+	},
+    },
+    {
+	{
+	    TOBN(0x04e91d87, 0x0002309e), TOBN(0x7437b317, 0x37cd88fc),
+	    TOBN(0x66188928, 0x1fe1404c), TOBN(0x882b40e6, 0x418d08bc),
+	    TOBN(0x63cb4301, 0x44e2fca9), TOBN(0x9bd758d5, 0x9961832e),
+	},
+	{
+	    TOBN(0x5b522ae6, 0xfec07279), TOBN(0x55b0bc64, 0x5bf675a3),
+	    TOBN(0x88e36d08, 0xb8228839), TOBN(0x192c8fb6, 0xbe7b3940),
+	    TOBN(0x290eb978, 0xcc5ea7ca), TOBN(0x9870fe72, 0x57f14716),
+	},
+    },
+    {
+	{
+	    TOBN(0x6e3c3520, 0xb9f7f75e), TOBN(0xf9f6c4dd, 0xeb0c25a4),
+	    TOBN(0xc1283674, 0x4d956605), TOBN(0x8164788c, 0x2ae22bf9),
+	    TOBN(0xf48a2ace, 0x281e4f3b), TOBN(0xe5b0f9a3, 0x3e952f7a),
+	},
+	{
+	    TOBN(0x64de88ef, 0x0327c326), TOBN(0xf6c18ce1, 0x2fbd403f),
+	    TOBN(0x3e6c13c0, 0xcaf49231), TOBN(0xc4274920, 0xcd5a51f7),
+	    TOBN(0x8deb1878, 0xc0a30f18), TOBN(0x5109da19, 0xcbe51ad3),
+	},
+    },
+    {
+	{
+	    TOBN(0xaccd18e6, 0xf9e44a7d), TOBN(0x506bd972, 0x3c094f69),
+	    TOBN(0x69a85d5a, 0x753676d8), TOBN(0x7cf893ce, 0xd770e86c),
+	    TOBN(0x8f8355d6, 0x9af19d4f), TOBN(0xaf262401, 0xd6115849),
+	},
+	{
+	    TOBN(0xf211e496, 0x0492b45f), TOBN(0x62109cba, 0x1d4bbd7c),
+	    TOBN(0x1dd1aeb8, 0xe6a82ede), TOBN(0x17f7e126, 0x8b23d16a),
+	    TOBN(0x2301712d, 0xe0918cd0), TOBN(0x81d0884e, 0x2a49955b),
+	},
+    },
+    {
+	{
+	    TOBN(0x7346755a, 0x840c8af0), TOBN(0x35a7548e, 0xcc6489b0),
+	    TOBN(0xf03dfd80, 0x9d87075e), TOBN(0xcd89f366, 0xff7611d2),
+	    TOBN(0x47a801f9, 0xd3a89a98), TOBN(0xd3f29871, 0xf1e91ad2),
+	},
+	{
+	    TOBN(0x58b6863f, 0xe827c40e), TOBN(0x2ef0f7cf, 0xa25931be),
+	    TOBN(0x82b55c51, 0x4548a172), TOBN(0x07e42d94, 0x1a9a4085),
+	    TOBN(0xf1559bf2, 0x7e5d465e), TOBN(0xc87f4f6c, 0x64a530a2),
+	},
+    },
+    {
+	{
+	    TOBN(0x9ebf45df, 0x0453fd3a), TOBN(0x474783da, 0xf25bb023),
+	    TOBN(0x4c39d199, 0x68112fca), TOBN(0x19a85797, 0xe32f1eee),
+	    TOBN(0x0a2b65f6, 0x5df937db), TOBN(0x73be358a, 0x985bc776),
+	},
+	{
+	    TOBN(0x84fa9114, 0x5b88d309), TOBN(0x0e31a07e, 0x9a909c3e),
+	    TOBN(0xba587dfe, 0x95671481), TOBN(0xf9ef2c02, 0xa2ebbf17),
+	    TOBN(0xe8070be2, 0x88f3992c), TOBN(0x8c68558d, 0x871ea8fb),
+	},
+    },
+    {
+	{
+	    TOBN(0x09da59b0, 0xd9a0d716), TOBN(0xe90f2266, 0x3ba58128),
+	    TOBN(0xe867df85, 0xf30671a0), TOBN(0x4bf10cfb, 0xaba22d8c),
+	    TOBN(0x017faf54, 0x18406ee8), TOBN(0x4cbf6414, 0xb97c0053),
+	},
+	{
+	    TOBN(0x516090d9, 0xb0228bd2), TOBN(0x2599843f, 0x80745095),
+	    TOBN(0x2fe05207, 0x28a501be), TOBN(0xbffe106a, 0xfea4fa16),
+	    TOBN(0xf83a3767, 0xe03baebb), TOBN(0x71b00e3d, 0x8ec66837),
+	},
+    },
+    {
+	{
+	    TOBN(0xa23d2004, 0x0054a768), TOBN(0x104a6886, 0x23f97826),
+	    TOBN(0x13694b8a, 0xc1561135), TOBN(0xe0e7dc3a, 0x2f01b7c1),
+	    TOBN(0x582b7184, 0x116499b9), TOBN(0x6b086a60, 0x80255e88),
+	},
+	{
+	    TOBN(0xb9e0dda2, 0x15d9a68c), TOBN(0x4839ad31, 0xdeb8c576),
+	    TOBN(0xbddaeecc, 0x9d185376), TOBN(0x7119da93, 0xd8b801e2),
+	    TOBN(0x9fcc3f18, 0xef1b0a0f), TOBN(0x52139775, 0x3a067812),
+	},
+    },
+    {
+	{
+	    TOBN(0x3c4ac563, 0x6b06fe02), TOBN(0x832f561f, 0x782655b8),
+	    TOBN(0x71f4864a, 0x5744debe), TOBN(0x80e00634, 0x95385c6c),
+	    TOBN(0x6cd832ea, 0x90ae9ac7), TOBN(0x23929957, 0xd8b646cc),
+	},
+	{
+	    TOBN(0x1da618e6, 0x68d09ae3), TOBN(0x9ed7286d, 0x23ba1432),
+	    TOBN(0xf5dc0706, 0x093ae0d4), TOBN(0x848c2a25, 0xb82b9915),
+	    TOBN(0xb67a3270, 0xbc0af655), TOBN(0x008ac947, 0xf779f9b9),
+	},
+    },
+    {
+	{
+	    TOBN(0x84a448e5, 0xbf8052cb), TOBN(0x671cfe52, 0xfb545ca3),
+	    TOBN(0x176be2b0, 0x6d0f4a3f), TOBN(0x367276f8, 0xaa1a14f0),
+	    TOBN(0x06dab6ba, 0x72746a49), TOBN(0x736e95ba, 0x7beb750f),
+	},
+	{
+	    TOBN(0xdca02e27, 0x376f9253), TOBN(0x4431df21, 0xbdc5c9b3),
+	    TOBN(0x59b87f94, 0xaef869e8), TOBN(0x7669cc79, 0x6f5305c5),
+	    TOBN(0xbe4cf243, 0x5ba08184), TOBN(0x38c9e98a, 0xd0ca154b),
+	},
+    },
+    {
+	{
+	    TOBN(0xf3cd04f9, 0xdb2a40fe), TOBN(0xe80e3d3e, 0x8ed9c7ce),
+	    TOBN(0xe8bb9e60, 0x92565e14), TOBN(0xd4dad226, 0x8ea0844d),
+	    TOBN(0x5def6b9a, 0x52335439), TOBN(0x7fbb8aaa, 0x29b2f547),
+	},
+	{
+	    TOBN(0x4f4cc3f6, 0xe0ede7a5), TOBN(0xa38dc654, 0xb5b2ab9b),
+	    TOBN(0xbc983c0f, 0xd973164c), TOBN(0xad61c59d, 0x3a5cacd7),
+	    TOBN(0x67bfe0d4, 0x896b02b1), TOBN(0x7b70d99d, 0x1434a056),
+	},
+    },
+    {
+	{
+	    TOBN(0xc15e5f90, 0xf9121816), TOBN(0x91647a0e, 0x9451a07e),
+	    TOBN(0x9d9e138d, 0xb01b25b3), TOBN(0x27420bba, 0xd162b2a3),
+	    TOBN(0x549f4b55, 0x2e9de246), TOBN(0x1d9bfef2, 0x5269b907),
+	},
+	{
+	    TOBN(0xe847913b, 0x43627a4b), TOBN(0x9c8cefb0, 0x9ed8efdb),
+	    TOBN(0x95ef1014, 0x4cd54907), TOBN(0x6b338c06, 0xad9b976f),
+	    TOBN(0x283dd3d2, 0x4e811355), TOBN(0x1512d196, 0x5daec1e7),
+	},
+    },
+    {
+	{
+	    TOBN(0x15ff9a9b, 0xb568cd4e), TOBN(0x9e8b6bf6, 0x50bc5d74),
+	    TOBN(0x7d949f8d, 0x605ec41d), TOBN(0x22f899c0, 0x3c3c5d6f),
+	    TOBN(0x539d0370, 0x8bb63bed), TOBN(0xb390263c, 0x456365ae),
+	},
+	{
+	    TOBN(0xccd200ce, 0x482bd4c3), TOBN(0x0411843a, 0x1400317e),
+	    TOBN(0x9bd2c04c, 0x9e9c7488), TOBN(0xcd69685b, 0x9bc33c82),
+	    TOBN(0x805eb5c4, 0x50669a51), TOBN(0x582198d2, 0x3710888b),
+	},
+    },
+    {
+	{
+	    TOBN(0x4afdc53e, 0x27d47126), TOBN(0xc6942729, 0x13906e2a),
+	    TOBN(0xf6e6ba1d, 0x3f12cf21), TOBN(0x8ff5035e, 0xb05e0c41),
+	    TOBN(0x6563cc71, 0x6f7d675f), TOBN(0x628f7897, 0xbb9e1e52),
+	},
+	{
+	    TOBN(0xff3b4141, 0x2d6cb72e), TOBN(0x0c5888ec, 0x14348bad),
+	    TOBN(0xa880aeb1, 0x667b3292), TOBN(0x68122357, 0x73d276f6),
+	    TOBN(0xa7851f8e, 0x553b106a), TOBN(0x2d942a34, 0x115c8678),
+	},
+    },
+    {
+	{
+	    TOBN(0xb2e77631, 0x0cbfc247), TOBN(0xed26c0a0, 0x07ac9315),
+	    TOBN(0xc33e2121, 0xa8254ada), TOBN(0xa8c05c2e, 0x29ded690),
+	    TOBN(0x9d65d460, 0x8e70e87e), TOBN(0x616104d5, 0x2b20930e),
+	},
+	{
+	    TOBN(0xf7689f79, 0x05c44088), TOBN(0xfff1f5fc, 0x5c8786a6),
+	    TOBN(0x81261f40, 0xa2db534c), TOBN(0x8193cd89, 0x4e8fddc0),
+	    TOBN(0x3a837b7a, 0xc32efcfd), TOBN(0x08413cc0, 0xc6d78382),
+	},
+    },
+    {
+	{
+	    TOBN(0x87d55b0d, 0xa54db0b3), TOBN(0xd45394d2, 0x1aa70e57),
+	    TOBN(0x4b691196, 0x0fcc7b4a), TOBN(0xa0cccdb0, 0xa1463950),
+	    TOBN(0xde09ed86, 0xfa1f6460), TOBN(0x6deaef7e, 0x19a1ad61),
+	},
+	{
+	    TOBN(0xf307d2d4, 0xff99a1c6), TOBN(0x3a21df7a, 0x0cf3e615),
+	    TOBN(0xbe3155bc, 0x598d8195), TOBN(0xfd502a56, 0x2836aaa7),
+	    TOBN(0x78228bff, 0x4ce3594d), TOBN(0x8075a873, 0xd7c4c90f),
+	},
+    },
+    {
+	{
+	    TOBN(0x899901f1, 0x7266f660), TOBN(0x4d852ad4, 0x700a8e79),
+	    TOBN(0x71fd15df, 0x3b8813d6), TOBN(0x3cb9a2c9, 0x31fed428),
+	    TOBN(0x70bffe4e, 0x3d608efe), TOBN(0xc9eb9974, 0x5f63c3b4),
+	},
+	{
+	    TOBN(0xe1b8bfdc, 0x5f1243aa), TOBN(0x10fde5c7, 0x2c3b8d21),
+	    TOBN(0x14546eed, 0x6a373961), TOBN(0x82d8995d, 0xb243a6c3),
+	    TOBN(0x36df6f5a, 0xdc847458), TOBN(0x43e00f48, 0x9f27904a),
+	},
+    },
+    {
+	{
+	    TOBN(0xcf16dd4e, 0xbfa6457a), TOBN(0xe44ea7b1, 0x582630c1),
+	    TOBN(0x02b6dba7, 0x5d1e086b), TOBN(0x8517f7da, 0x0258cdfd),
+	    TOBN(0x7f43d1f3, 0xec554bbc), TOBN(0x196037a6, 0x4b4831f3),
+	},
+	{
+	    TOBN(0x6d2d8202, 0xa4b3e1a5), TOBN(0x29b289df, 0x47c32ba5),
+	    TOBN(0xe59228d8, 0x5f470026), TOBN(0xafccc28e, 0xcfc3b339),
+	    TOBN(0xe0bb8c73, 0xe2644cbc), TOBN(0x467f8672, 0xd03f8419),
+	},
+    },
+    {
+	{
+	    TOBN(0x0310c519, 0xbfedd719), TOBN(0xfcc5dab1, 0xfdf85239),
+	    TOBN(0xdd128784, 0xc51b2d9f), TOBN(0x755ecf70, 0x008c6750),
+	    TOBN(0x10f9bf55, 0xbdb0d624), TOBN(0xeacf03ee, 0x2a31994d),
+	},
+	{
+	    TOBN(0x992fafd7, 0x2469acf4), TOBN(0x59e43680, 0x2a74d135),
+	    TOBN(0xb4eae852, 0x0b6d2bd2), TOBN(0xc9dd754a, 0x3ea7f56f),
+	    TOBN(0x5cbef11e, 0xb4942b58), TOBN(0xe35712b6, 0x0aa68717),
+	},
+    },
+    {
+	{
+	    TOBN(0x1c469847, 0x3851752a), TOBN(0x9fecdf73, 0x4be4f955),
+	    TOBN(0x96d9fe1a, 0x9b881e18), TOBN(0xa35b6d1b, 0xfc053403),
+	    TOBN(0xd3cd59bf, 0x6b50345e), TOBN(0x4847b682, 0xde67bc91),
+	},
+	{
+	    TOBN(0xadd5b34d, 0x3f222e39), TOBN(0x6a0c403d, 0xe3cf9a9a),
+	    TOBN(0xb134c23b, 0x799b54fe), TOBN(0xec78ebce, 0x932048b6),
+	    TOBN(0xfa0606cb, 0x95c82097), TOBN(0x2dbc23fe, 0xdfc08c5f),
+	},
+    },
+    {
+	{
+	    TOBN(0xf5228178, 0xea455623), TOBN(0x6db96158, 0xfac24b9b),
+	    TOBN(0x27807fa8, 0x75f69897), TOBN(0x878429eb, 0x7af68704),
+	    TOBN(0x910ea7a9, 0x0c9a498a), TOBN(0x041c9469, 0x12dc40c9),
+	},
+	{
+	    TOBN(0x8181fa55, 0x30753939), TOBN(0x4dc81d30, 0x09d39cde),
+	    TOBN(0x0eeace8c, 0xb649cf26), TOBN(0x48194779, 0xe9ef0470),
+	    TOBN(0x1867552a, 0xb71c7f06), TOBN(0x2f32b5d9, 0xf66fe3cb),
+	},
+    },
+    {
+	{
+	    TOBN(0xee53963a, 0x6774df01), TOBN(0xb68f4f50, 0x96fd0a41),
+	    TOBN(0x55ed90ad, 0xfcb32f0b), TOBN(0x4a5330ee, 0xa3fb2397),
+	    TOBN(0xcd49e0a1, 0xf0d14656), TOBN(0x32a75b66, 0x9eb10e79),
+	},
+	{
+	    TOBN(0x1afbabc8, 0xc1190a53), TOBN(0x2249bc02, 0x12020c8b),
+	    TOBN(0xf6dd7183, 0xb0cf0696), TOBN(0x6ea684b2, 0xa11c3c04),
+	    TOBN(0x1c5ddff4, 0x70825a01), TOBN(0x63543c29, 0x574eea22),
+	},
+    },
+    {
+	{
+	    TOBN(0x476d7d05, 0x1beb75ff), TOBN(0x173ef582, 0x1e02fb30),
+	    TOBN(0x17ef19da, 0xb61a3050), TOBN(0x3e7522a2, 0x2d4fc9f6),
+	    TOBN(0xc3b52ad5, 0x12e3d98b), TOBN(0x3ebe4d9b, 0x1544b4ab),
+	},
+	{
+	    TOBN(0xf5dd0339, 0x790b018f), TOBN(0x19e8ac6b, 0x51041a55),
+	    TOBN(0x7469aefe, 0xc3d13900), TOBN(0x09bf87d9, 0x966e5f49),
+	    TOBN(0xfdf07959, 0x24f3448a), TOBN(0xa3e05656, 0x2a60dcae),
+	},
+    },
+    {
+	{
+	    TOBN(0xf0b5907f, 0x80adb0f5), TOBN(0x8fef9c8b, 0xd5085724),
+	    TOBN(0xed681654, 0xf65b7e8b), TOBN(0x8f614423, 0xe30343df),
+	    TOBN(0x6b801310, 0x99760764), TOBN(0x535046fa, 0xa3bb7eee),
+	},
+	{
+	    TOBN(0xc82697bf, 0xbaf9435c), TOBN(0x1d400384, 0xaeb6211f),
+	    TOBN(0x952e6b8e, 0xa69d4056), TOBN(0x0ca505c4, 0xe936ee94),
+	    TOBN(0x2b3dc775, 0x158945f4), TOBN(0x813120e2, 0xeb3693d9),
+	},
+    },
+    {
+	{
+	    TOBN(0xf95c189d, 0x187032bd), TOBN(0x9c03626b, 0xa630b6ef),
+	    TOBN(0x14703dd3, 0x49355fc7), TOBN(0xfb0e8dc8, 0xf6444376),
+	    TOBN(0xc758ead8, 0x7763d5cf), TOBN(0x17599a0a, 0x4b533ea7),
+	},
+	{
+	    TOBN(0x9403d41d, 0xc1ab66b3), TOBN(0x82172fc5, 0xfeebdd6a),
+	    TOBN(0xbcaf4390, 0x97280231), TOBN(0x66cb3950, 0xd61cfb43),
+	    TOBN(0xdfbb4266, 0x9429ae5f), TOBN(0xa7d59069, 0x0f9bf0d1),
+	},
+    },
+    {
+	{
+	    TOBN(0x62f3c5ae, 0x60cc5503), TOBN(0x1d0a3a3f, 0x0c01aa81),
+	    TOBN(0xb2c6c399, 0xbaee4f89), TOBN(0xe0a97387, 0x91ebb314),
+	    TOBN(0xed0ffce7, 0x3b238131), TOBN(0x21c8ec67, 0x811f1788),
+	},
+	{
+	    TOBN(0xe1284fb6, 0xb1a51b4b), TOBN(0xfc6878b4, 0x409bb395),
+	    TOBN(0x0db4fa18, 0xbc25774d), TOBN(0x43384ec9, 0x9b198f70),
+	    TOBN(0xbafb4214, 0xf2de6018), TOBN(0xd2a0fb9f, 0xb36aa1f3),
+	},
+    },
+    {
+	{
+	    TOBN(0x0a547bc0, 0xa59289b2), TOBN(0x00eff5fa, 0x39b684b0),
+	    TOBN(0xa216c243, 0xc6509fd8), TOBN(0x270586bc, 0x8f8be90c),
+	    TOBN(0xb0a62c59, 0x89e36317), TOBN(0xef24b847, 0x19ae20a8),
+	},
+	{
+	    TOBN(0x7e6ab561, 0x57b6c5da), TOBN(0x4b8ce923, 0xfc79b4cb),
+	    TOBN(0xf2e95031, 0xa9f95d7d), TOBN(0x7929f74a, 0xba5adfed),
+	    TOBN(0xa9e1825c, 0xc5e90c7f), TOBN(0xda5cc30a, 0xa4d866bf),
+	},
+    },
+    {
+	{
+	    TOBN(0x58a37685, 0xcab67493), TOBN(0x0b1bbd26, 0xf32cdf32),
+	    TOBN(0x3e3896c2, 0x0e89b286), TOBN(0xb77997e2, 0x8674ee59),
+	    TOBN(0x12f5136a, 0xec4dc09c), TOBN(0x2f6c8af6, 0x1e839aa4),
+	},
+	{
+	    TOBN(0xb8aa61f1, 0x2f0d0d89), TOBN(0xf78640d5, 0x5cbab8bc),
+	    TOBN(0xaad91ee1, 0xa2ee632c), TOBN(0xd09c6397, 0x19905c9d),
+	    TOBN(0x513f02f0, 0xa2c3aa5e), TOBN(0x6b4c6a7d, 0x1adc76e3),
+	},
+    },
+    {
+	{
+	    TOBN(0xde3cfa43, 0x70d9bc82), TOBN(0x46329acd, 0x387b717f),
+	    TOBN(0xa0c1bfcc, 0xa2a38171), TOBN(0x487f69a9, 0xcf6679a3),
+	    TOBN(0xbc25c85f, 0x1c722671), TOBN(0x9a6ad474, 0x37fff88a),
+	},
+	{
+	    TOBN(0x377d912a, 0xfa8a837a), TOBN(0x220c3912, 0xb167d72e),
+	    TOBN(0xdf0591ed, 0x6f266dd2), TOBN(0x55c60e09, 0x00fc9861),
+	    TOBN(0xfe27ae1a, 0x99abd464), TOBN(0xf143f504, 0xe7cabd97),
+	},
+    },
+    {
+	{
+	    TOBN(0x6e578b6f, 0x28b8d7b6), TOBN(0x88cc38dd, 0xacf1a724),
+	    TOBN(0xc819ca78, 0x061c3219), TOBN(0x6c744c37, 0x058f6b3b),
+	    TOBN(0x93443fcd, 0x13a36d95), TOBN(0x2bb7bd35, 0x115df054),
+	},
+	{
+	    TOBN(0xfca9a4b8, 0xa7e5f70f), TOBN(0x677decdb, 0x7d2271db),
+	    TOBN(0x30b99ab4, 0x543346c7), TOBN(0x1d51faf0, 0x6227b675),
+	    TOBN(0x9ccdc043, 0x7db2c760), TOBN(0xf958f71d, 0x915db325),
+	},
+    },
+};
+static const BN_ULONG
+ec_comb_p384_offset[2][2][6 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0xbcdcc6d0, 0xb552e853), TOBN(0x4e54c3ff, 0x407269a8),
+	    TOBN(0x35068a01, 0xea6b9dca), TOBN(0xb9a8c530, 0x7170c0a7),
+	    TOBN(0x11905456, 0xf07d4171), TOBN(0xde67c602, 0x06626714),
+	},
+	{
+	    TOBN(0x6bc248ef, 0xcc2fa73f), TOBN(0xf826292f, 0x02a480c4),
+	    TOBN(0xe74f445d, 0x2146c51c), TOBN(0x26cc3b5a, 0x2bb6e657),
+	    TOBN(0x00e0ac33, 0xd7ac2d35), TOBN(0xfa15d470, 0xd9d64a94),
+	},
+    },
+    {
+	{
+	    TOBN(0x2aadae69, 0x27933ddd), TOBN(0x7d149a2c, 0x66fe0518),
+	    TOBN(0x67435e2f, 0xe60c1475), TOBN(0xee922d89, 0x82f18e6e),
+	    TOBN(0x2cab94ed, 0x432d44a3), TOBN(0xf5d025fc, 0x307367dd),
+	},
+	{
+	    TOBN(0xdac2ba44, 0x4ad5f39d), TOBN(0x384fe28b, 0xc2cb6d94),
+	    TOBN(0x21261bd8, 0x52a2679b), TOBN(0xf0bbf0be, 0x03885199),
+	    TOBN(0xedcc0fc9, 0x4bf6293c), TOBN(0xb5da0188, 0x138b2519),
+	},
+    },
+};
+
+static const BN_ULONG
+ec_comb_p384_table_mont[EC_COMB_TABLES << EC_COMB_TEETH][2][6 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x3dd07566, 0x49c0b528), TOBN(0x20e378e2, 0xa0d6ce38),
+	    TOBN(0x879c3afc, 0x541b4d6e), TOBN(0x64548684, 0x59a30eff),
+	    TOBN(0x812ff723, 0x614ede2b), TOBN(0x4d3aadc2, 0x299e1513),
+	},
+	{
+	    TOBN(0x23043dad, 0x4b03a4fe), TOBN(0xa1bfa8bf, 0x7bb4a9ac),
+	    TOBN(0x8bade756, 0x2e83b050), TOBN(0xc6c35219, 0x68f4ffd9),
+	    TOBN(0xdd800226, 0x3969a840), TOBN(0x2b78abc2, 0x5a15c5e9),
+	},
+    },
+    {
+	{
+	    TOBN(0x520b0bb9, 0x05c755e4), TOBN(0xa2c2c59b, 0xf89f0048),
+	    TOBN(0x85c1c73a, 0x73c23975), TOBN(0x6e4dec49, 0x783aabba),
+	    TOBN(0x69f0c69b, 0xb0463155), TOBN(0x61a42b94, 0x9c97b17b),
+	},
+	{
+	    TOBN(0x55af24a9, 0x45d331a3), TOBN(0x4b0e63f8, 0xf5fe81fd),
+	    TOBN(0x4034283d, 0x708671c4), TOBN(0x200ddab3, 0x5fd9001a),
+	    TOBN(0xe45f28e4, 0x342eaf3b), TOBN(0x3e8375b4, 0x1ba936c4),
+	},
+    },
+    {
+	{
+	    TOBN(0x2640a5db, 0xde9bd6f2), TOBN(0xe445b59e, 0x7d446a38),
+	    TOBN(0x3fa136f0, 0x8e542718), TOBN(0x811a99c0, 0xafbefa74),
+	    TOBN(0x02addf85, 0x901fac6d), TOBN(0x7a974334, 0x71c9f9c0),
+	},
+	{
+	    TOBN(0x74543d18, 0xbe16a673), TOBN(0xdfa953fa, 0xed76e02d),
+	    TOBN(0xcadc7b71, 0x6d9685e4), TOBN(0x602ce380, 0x6434f518),
+	    TOBN(0xc26f9beb, 0xf50f4dc4), TOBN(0x8e62c0e1, 0x7bc3d5d7),
+	},
+    },
+    {
+	{
+	    TOBN(0x0c3d2056, 0xbe21a890), TOBN(0x1c1ffbfb, 0x8fcfba99),
+	    TOBN(0x1b68a98b, 0x1fbf56ca), TOBN(0x56fd85ff, 0x396e31cd),
+	    TOBN(0xd2ca5844, 0x4382c03b), TOBN(0xc442030a, 0x7d3ef917),
+	},
+	{
+	    TOBN(0x4129a731, 0x426afafa), TOBN(0xacff17ff, 0x5eaae9c6),
+	    TOBN(0x9e854180, 0x653f3b23), TOBN(0xe65a1a14, 0x9ee066bd),
+	    TOBN(0x3420084e, 0x362ea5fe), TOBN(0x6fe58801, 0xc7911e2e),
+	},
+    },
+    {
+	{
+	    TOBN(0x85254da2, 0x9c224caf), TOBN(0xb949c811, 0x02e95405),
+	    TOBN(0xf889d98c, 0x39958913), TOBN(0x0daf94af, 0x1a52a85b),
+	    TOBN(0x3522be80, 0xa86f569d), TOBN(0x55f2531f, 0xa0965210),
+	},
+	{
+	    TOBN(0x0d9da02e, 0x4971e374), TOBN(0x3b023d6a, 0x38c48a40),
+	    TOBN(0x8c05c282, 0x7213ba04), TOBN(0x3c1b6e20, 0x064c03a2),
+	    TOBN(0x03477cb7, 0x35314604), TOBN(0x7d326558, 0x8c561477),
+	},
+    },
+    {
+	{
+	    TOBN(0x884f9cff, 0x431045d9), TOBN(0x67fa51db, 0x5ef058cd),
+	    TOBN(0x7ad964f8, 0x55984a02), TOBN(0x45b37733, 0x25ca594c),
+	    TOBN(0x09136883, 0x6cdc484c), TOBN(0x80f8c8f7, 0x01d9c904),
+	},
+	{
+	    TOBN(0x49a0ed37, 0x11113f60), TOBN(0xc496e16c, 0xd13032ff),
+	    TOBN(0xb4f3fdba, 0xdc129eec), TOBN(0x71aed846, 0xa7faca4b),
+	    TOBN(0xb6e0ece2, 0x94bdb36a), TOBN(0x0fd1d5bc, 0xb59a5973),
+	},
+    },
+    {
+	{
+	    TOBN(0x69e9f4f8, 0x49d8b4ea), TOBN(0xeb2296da, 0x5d94935a),
+	    TOBN(0x5b12806f, 0xe884bb05), TOBN(0x132189b9, 0x78694400),
+	    TOBN(0x36ed0783, 0x4a33cd7e), TOBN(0x4d7e3704, 0x2ea5de9f),
+	},
+	{
+	    TOBN(0xda6f7a9a, 0xfd350496), TOBN(0x56dfa389, 0x0e4569ae),
+	    TOBN(0x5afa9430, 0xf41c0668), TOBN(0xa2831e09, 0xfc8f9ac3),
+	    TOBN(0x2d01f923, 0xf1a0a300), TOBN(0x871f62ae, 0x9e620cda),
+	},
+    },
+    {
+	{
+	    TOBN(0x009ef80a, 0xae238fa1), TOBN(0xb41d9b24, 0x486af6b5),
+	    TOBN(0xab4455ed, 0x685add95), TOBN(0x18f323f6, 0x72c7dac8),
+	    TOBN(0xe7009790, 0xe372f168), TOBN(0x4d5bcba6, 0x067bea99),
+	},
+	{
+	    TOBN(0xf15bdbcc, 0x51a2a9a9), TOBN(0xde7e4f74, 0x2fac9169),
+	    TOBN(0x2fd62c30, 0x4bdbec36), TOBN(0x8b3ea93d, 0x1b3ac6c7),
+	    TOBN(0xce1c8e5c, 0x9c293889), TOBN(0x19664dda, 0x11564f8b),
+	},
+    },
+    {
+	{
+	    TOBN(0x95e76f40, 0xc8900e5f), TOBN(0x3bc52f6a, 0xf1fa9a6e),
+	    TOBN(0x49f88757, 0xe47138b6), TOBN(0xc3ff0821, 0x071e741d),
+	    TOBN(0x0af00643, 0x3e85e6de), TOBN(0xb1b2f530, 0xd4a271e5),
+	},
+	{
+	    TOBN(0x34f419dd, 0xd45e4fed), TOBN(0x15806825, 0xd94c766f),
+	    TOBN(0xe09794e2, 0x460f7d4a), TOBN(0xfcb6b08a, 0xf613bdff),
+	    TOBN(0x002db4cc, 0xa5640730), TOBN(0x797f4a8b, 0xbe093283),
+	},
+    },
+    {
+	{
+	    TOBN(0x0538b059, 0xb1aa5c6e), TOBN(0x6452efca, 0xc75680f0),
+	    TOBN(0x2cbd6157, 0xb42afa97), TOBN(0xc9e1d062, 0xe93344c8),
+	    TOBN(0x7183c8eb, 0x68911894), TOBN(0xff0dae2e, 0xcb7cc02e),
+	},
+	{
+	    TOBN(0x17fc298d, 0x40fb2685), TOBN(0x182e94c1, 0xe61eb16c),
+	    TOBN(0xf884398b, 0x33dca9f6), TOBN(0x3e860868, 0x6e84ba4b),
+	    TOBN(0xd58a3fe6, 0x40dd0c6a), TOBN(0x7adfd8fc, 0xf3bd1999),
+	},
+    },
+    {
+	{
+	    TOBN(0x7b8f354e, 0x43855436), TOBN(0xba91d969, 0x4706a454),
+	    TOBN(0x916cd6c3, 0x2d758149), TOBN(0xe726b69d, 0x5f8da7ee),
+	    TOBN(0x763527cc, 0x4cecb293), TOBN(0xee44a35d, 0x450b3ecd),
+	},
+	{
+	    TOBN(0x0979ddac, 0xd0381f82), TOBN(0xe96f21be, 0xb58a7aa7),
+	    TOBN(0x7c4f261d, 0x90a1fa6b), TOBN(0xa544b442, 0xc617b2d2),
+	    TOBN(0xd26cf448, 0xf835b768), TOBN(0x0691b633, 0xc90906b9),
+	},
+    },
+    {
+	{
+	    TOBN(0x515f8096, 0x30e9f9d9), TOBN(0x8f81b5a6, 0xab4cde3a),
+	    TOBN(0xec8aec37, 0x24d2b7b4), TOBN(0x05448cc9, 0xa167d3f5),
+	    TOBN(0xda8a3361, 0x3ac2b2ab), TOBN(0x4c36cce2, 0x08a1e70d),
+	},
+	{
+	    TOBN(0x2b18999f, 0x4408a0f1), TOBN(0x4807d76e, 0xc1ecac30),
+	    TOBN(0x754badb7, 0x1ba62c75), TOBN(0x645e1474, 0x36db8002),
+	    TOBN(0x1f07e900, 0xe99940fe), TOBN(0x5e0687ae, 0x74d8acce),
+	},
+    },
+    {
+	{
+	    TOBN(0x4c567291, 0x986a2761), TOBN(0xf6f4bc12, 0x2a1be30d),
+	    TOBN(0xa85356c1, 0x120841d0), TOBN(0x4bd82e33, 0x7dc32b5b),
+	    TOBN(0x9b9d48c8, 0x8e6e544c), TOBN(0x3801eb0f, 0x7e8dfa62),
+	},
+	{
+	    TOBN(0x952900af, 0x1d06f0b8), TOBN(0x8932c4c2, 0x739bfadd),
+	    TOBN(0x21e0331f, 0x3a772e0f), TOBN(0xfd5a50de, 0x87c13e6a),
+	    TOBN(0xc2a261a4, 0xcb122d27), TOBN(0x815b2c92, 0xcd0fee5c),
+	},
+    },
+    {
+	{
+	    TOBN(0x8bd56345, 0x263e1b29), TOBN(0x36cc9736, 0x9a5516d2),
+	    TOBN(0x608cb6e9, 0x2954cc40), TOBN(0xbdbc0497, 0xf7252e35),
+	    TOBN(0x424dcec4, 0x94d374b1), TOBN(0x02e58f2f, 0x5c17ee1e),
+	},
+	{
+	    TOBN(0x7e63ead5, 0xfa3f585e), TOBN(0x104f504f, 0x3c5c9496),
+	    TOBN(0x86366fdc, 0x32cb6922), TOBN(0xf158ca69, 0xfe202192),
+	    TOBN(0x37a61dea, 0x1ea92005), TOBN(0x731b939f, 0x4466bddf),
+	},
+    },
+    {
+	{
+	    TOBN(0x8c4a034b, 0xde1e9c48), TOBN(0x300c0942, 0xf11acf62),
+	    TOBN(0xbaec5daf, 0x6c96f318), TOBN(0xb58427f3, 0x9bcc865a),
+	    TOBN(0x1d004430, 0x32eec307), TOBN(0x0b7d4957, 0x9ad999c8),
+	},
+	{
+	    TOBN(0xf0764363, 0x2c1c1cb8), TOBN(0x5a6056aa, 0x33ece718),
+	    TOBN(0x87ec77f6, 0xf004b949), TOBN(0xa9bdb457, 0x257e9b7e),
+	    TOBN(0x4f25615c, 0xd69ed78e), TOBN(0x3329fe44, 0x7d857a46),
+	},
+    },
+    {
+	{
+	    TOBN(0xe37211be, 0x7ef79898), TOBN(0xa8103877, 0x21344d16),
+	    TOBN(0xfdcd7e26, 0xa1b9f8b4), TOBN(0x5641e45d, 0x7d7f72d5),
+	    TOBN(0x5377c1be, 0xc449c920), TOBN(0xd3edcb0c, 0xefc7b2a1),
+	},
+	{
+	    TOBN(0xc657a9ff, 0xe14b42fc), TOBN(0xc8f858c8, 0x00831b07),
+	    TOBN(0x6bfcd1bc, 0xd020eaa8), TOBN(0x17534b0a, 0x3f6860c7),
+	    TOBN(0x8ce57222, 0x84c7c806), TOBN(0xa1d40eaf, 0x2bd7456b),
+	},
+    },
+    {
+	{
+	    TOBN(0x9ab75786, 0x4e4019cc), TOBN(0x72db355d, 0xd76b3da5),
+	    TOBN(0x5ecdc5c4, 0x01f30de3), TOBN(0x46fde4f8, 0xd88a4480),
+	    TOBN(0xbfd62111, 0x88d7f52f), TOBN(0x7ccb5a1d, 0xfdc34c23),
+	},
+	{
+	    TOBN(0x7d50c13e, 0xd818a540), TOBN(0xecf98bad, 0x1f4a3fef),
+	    TOBN(0x7463b81d, 0x49282b84), TOBN(0x98d03de3, 0x74f9ed40),
+	    TOBN(0xc1270c9e, 0x08a3dacc), TOBN(0x322822be, 0x108f69f4),
+	},
+    },
+    {
+	{
+	    TOBN(0x5def50ac, 0x9c22d39b), TOBN(0x4f04c306, 0x30c53a66),
+	    TOBN(0xab336f5c, 0x9cdbd574), TOBN(0xb1604236, 0xc644c177),
+	    TOBN(0x44f2ca53, 0xa447c919), TOBN(0x1320daa0, 0x26b355d5),
+	},
+	{
+	    TOBN(0x6934a204, 0x4c7f0558), TOBN(0xb2d55091, 0x883aa579),
+	    TOBN(0x5c93fab1, 0x7e455093), TOBN(0x3914d08c, 0x5819861d),
+	    TOBN(0xf7278ad3, 0xbb96d055), TOBN(0x06781c29, 0xfc4a2289),
+	},
+    },
+    {
+	{
+	    TOBN(0xc6e7b795, 0x10194025), TOBN(0x4bbd35d3, 0xcfe1ada1),
+	    TOBN(0xcd23a462, 0xd99d5a06), TOBN(0xb92b163d, 0x7e0ea336),
+	    TOBN(0xf5917231, 0x7fd6db28), TOBN(0x5bc6d7e6, 0x7d5e737d),
+	},
+	{
+	    TOBN(0x4b45e095, 0xc3315908), TOBN(0x4dff3fc5, 0x1659852e),
+	    TOBN(0x9bbe0752, 0xcc9d9705), TOBN(0x6b025a04, 0x96eeeee5),
+	    TOBN(0x00c8571b, 0x0ff3299b), TOBN(0xd3119d18, 0x24c45d32),
+	},
+    },
+    {
+	{
+	    TOBN(0x7c9492af, 0x18bc2beb), TOBN(0x84480b89, 0x167f69ad),
+	    TOBN(0xf920fee8, 0x373c2503), TOBN(0xf787359f, 0x58f1dafa),
+	    TOBN(0xd2aaaa0a, 0xac1ff1cf), TOBN(0x22c2cd2d, 0xdf6ece1c),
+	},
+	{
+	    TOBN(0x8a50aa5c, 0x2c23fd35), TOBN(0x8a7f142a, 0x98342e30),
+	    TOBN(0xa82b36f3, 0xfeda8b02), TOBN(0x4c2acbe3, 0x904a3216),
+	    TOBN(0x8c90ba2c, 0x296c523a), TOBN(0xeff3aa7e, 0x2a65fe5f),
+	},
+    },
+    {
+	{
+	    TOBN(0x9f1b347d, 0xdd66b709), TOBN(0x16fb0325, 0x9641e591),
+	    TOBN(0x132b48b8, 0x9f0865e3), TOBN(0xa3baaff4, 0x06f1d0e4),
+	    TOBN(0xe52c69b6, 0xe78f7265), TOBN(0x8ba19425, 0x0931c739),
+	},
+	{
+	    TOBN(0x649c5413, 0x37b3a686), TOBN(0xd97e0eea, 0xdebed063),
+	    TOBN(0x8f21434e, 0xe93cdb66), TOBN(0xf61d1d04, 0xfd18fe86),
+	    TOBN(0x9f011f92, 0x14065b48), TOBN(0x0b48a5d7, 0x6dcd0245),
+	},
+    },
+    {
+	{
+	    TOBN(0xed49480c, 0x27e08c55), TOBN(0x4aec0da5, 0x86f7f1f8),
+	    TOBN(0x13f65018, 0x8e9908b3), TOBN(0xcadd808b, 0xca957839),
+	    TOBN(0xc4cb8867, 0xa71ce2f8), TOBN(0x2d03dce9, 0xcaf4d0e5),
+	},
+	{
+	    TOBN(0xe1288c41, 0xa7b9b325), TOBN(0xf03c0520, 0x12533350),
+	    TOBN(0xb1c7af13, 0xb890db72), TOBN(0x931666ad, 0x8ece384c),
+	    TOBN(0x7011555b, 0xe25e2fa0), TOBN(0x5b45e00a, 0x472d53bd),
+	},
+    },
+    {
+	{
+	    TOBN(0xcfbe5a73, 0x0a8da014), TOBN(0x1edbbe18, 0x9862c0d8),
+	    TOBN(0xd4c68c22, 0x06715233), TOBN(0x9a976bfb, 0xe81c42d3),
+	    TOBN(0xa1b99dcf, 0x7d398bd1), TOBN(0x3ac34d2c, 0xa1f1e5c3),
+	},
+	{
+	    TOBN(0x30405ce9, 0xe647e9ab), TOBN(0x53d89725, 0x9ea671ff),
+	    TOBN(0x8d9dae91, 0xf971642d), TOBN(0xa5e0dd0f, 0x98c6924d),
+	    TOBN(0xc7d9ccef, 0x079831e0), TOBN(0x709d2a96, 0x8b385b67),
+	},
+    },
+    {
+	{
+	    TOBN(0xe38caaea, 0xc6f8eff3), TOBN(0x25f81530, 0xfd83af9c),
+	    TOBN(0x096ced7e, 0xf76da559), TOBN(0x46bb3b95, 0xec62f036),
+	    TOBN(0xa11f7dd9, 0xbf45d2f8), TOBN(0x8c69bca3, 0x7bbf0da2),
+	},
+	{
+	    TOBN(0x421e2626, 0xba8a0cdb), TOBN(0xf345fda4, 0xe6ecddac),
+	    TOBN(0xddea247f, 0x7eeb4dc3), TOBN(0x61ad9c4b, 0xc8701be4),
+	    TOBN(0x0d4cf4bf, 0x20aa7346), TOBN(0x29a2de7b, 0xfe479a13),
+	},
+    },
+    {
+	{
+	    TOBN(0xc4a3ec90, 0x272975b4), TOBN(0x6eca2b3e, 0x4aacc2ae),
+	    TOBN(0x1797bfd8, 0x1f4396ca), TOBN(0xe27d2e69, 0x857f846d),
+	    TOBN(0x60d1b4bb, 0xaed272bd), TOBN(0xae37ce98, 0x5da36b3c),
+	},
+	{
+	    TOBN(0x3b9df985, 0x4b2c8fa7), TOBN(0x4c0d1003, 0x6f454d07),
+	    TOBN(0x5a41a813, 0xead30593), TOBN(0xeb16ed22, 0x02dcf678),
+	    TOBN(0x09009b06, 0xfd1544da), TOBN(0xecc9ca9f, 0x976e7a77),
+	},
+    },
+    {
+	{
+	    TOBN(0xf37274dc, 0xf5f90c45), TOBN(0x642db367, 0xb3d4bdf0),
+	    TOBN(0x2e09c224, 0x90ef3399), TOBN(0x1e879dfe, 0x8392df53),
+	    TOBN(0xc28af440, 0x20ca67d7), TOBN(0x03424947, 0x5625fb97),
+	},
+	{
+	    TOBN(0xc81774f8, 0x97924336), TOBN(0xda2b327f, 0xd338e27d),
+	    TOBN(0x3b36d627, 0xa6c111ec), TOBN(0x81be408e, 0x4ba7ffd3),
+	    TOBN(0xa20179f5, 0xb2e05564), TOBN(0x5e518c71, 0x44aa90e2),
+	},
+    },
+    {
+	{
+	    TOBN(0x7cfe1cdc, 0x54cf81a8), TOBN(0xfd258062, 0x6ca90e80),
+	    TOBN(0xb869605e, 0xeeaf6f96), TOBN(0xce7094fd, 0xb4af1576),
+	    TOBN(0xd34cda19, 0xbc18dcff), TOBN(0x0fc4ba64, 0x51189e1f),
+	},
+	{
+	    TOBN(0x04d6a688, 0x55921b95), TOBN(0x59abb516, 0x651beba9),
+	    TOBN(0x9bf9c4f6, 0x35ca2ce2), TOBN(0xce3dc191, 0x43a13d1a),
+	    TOBN(0xdc43099e, 0x9a0c68f5), TOBN(0x97dabc1b, 0x83536eb0),
+	},
+    },
+    {
+	{
+	    TOBN(0xbd8587c7, 0x48ce58d8), TOBN(0x5fa83f52, 0x3b0e9fe3),
+	    TOBN(0x3d8ce04b, 0xfb32f9f6), TOBN(0xa2235b1b, 0xb0293258),
+	    TOBN(0xbd0b6153, 0xd961fb4d), TOBN(0x7ca300e8, 0x30973c7c),
+	},
+	{
+	    TOBN(0xfc492253, 0xdfbf2ec5), TOBN(0x70b15bb5, 0x65035528),
+	    TOBN(0x83ea6cdd, 0x4bde91ac), TOBN(0x23b9757d, 0x08afdeb8),
+	    TOBN(0x99335516, 0x7fd7da37), TOBN(0x5b0c7e09, 0x77e82f17),
+	},
+    },
+    {
+	{
+	    TOBN(0x4aee66ee, 0x8df37aec), TOBN(0x57d05589, 0xf556de0c),
+	    TOBN(0x6f943a20, 0x09085e6c), TOBN(0x9cf42cf7, 0xf4123741),
+	    TOBN(0x27cc0ad7, 0x6a722afd), TOBN(0x7c5161f7, 0x9ce24aa3),
+	},
+	{
+	    TOBN(0x66cd052b, 0x8171b2cc), TOBN(0x18a5cf2c, 0x64d5dc6c),
+	    TOBN(0xafc1ae9b, 0x5cd29012), TOBN(0xb0248d67, 0x38865f70),
+	    TOBN(0xfbc96689, 0x18efa0f8), TOBN(0xd7b1fa09, 0xcb892055),
+	},
+    },
+    {
+	{
+	    TOBN(0x65184f15, 0xc0f579a8), TOBN(0xb5276875, 0x2e1fb72b),
+	    TOBN(0x6e08c434, 0xa93e4640), TOBN(0xdede7eeb, 0xe6458db4),
+	    TOBN(0x55a6b84d, 0x4dc27450), TOBN(0xefb8929c, 0x391c9465),
+	},
+	{
+	    TOBN(0x1aaf0100, 0x02eab50a), TOBN(0x67f7771d, 0x286865d8),
+	    TOBN(0xb32b9b58, 0x7fd79f57), TOBN(0x9ff69ac2, 0xe613629b),
+	    TOBN(0xe43a33d4, 0x72a960d3), TOBN(0x755960e6, 0x44052de2),
+	},
+    },
+    {
+	{
+	    TOBN(0x333d0fb3, 0x8c69e749), TOBN(0xf9b4031c, 0xceaafb01),
+	    TOBN(0x64f5f8de, 0x16d1e9db), TOBN(0x63fb4463, 0x9441c3ef),
+	    TOBN(0x77950035, 0xa89ecb56), TOBN(0xae997ced, 0x1f8be3cc),
+	},
+	{
+	    TOBN(0x93cb8ed6, 0x3d423771), TOBN(0xd7469fe1, 0x99076ada),
+	    TOBN(0x2d2909c6, 0xe8d6c2d6), TOBN(0x67ff4748, 0x28b3b778),
+	    TOBN(0x898f20bc, 0x694fcbf8), TOBN(0x39601757, 0x657bf4e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x2e75a26e, 0xec65b53e), TOBN(0xfeb630b2, 0x70552fb3),
+	    TOBN(0x53dfd057, 0xee7d8e4a), TOBN(0xb959110d, 0x8994f449),
+	    TOBN(0xb4a16596, 0xbb538367), TOBN(0xa70917bd, 0xef82f29c),
+	},
+	{
+	    TOBN(0x5a764300, 0x43bba6ae), TOBN(0xee207476, 0xcfbc194a),
+	    TOBN(0xc7eab238, 0x03a4184b), TOBN(0x60c67ef2, 0x0f7fcd62),
+	    TOBN(0x41e05799, 0xdfa8a0c6), TOBN(0x5d7d05e6, 0x04d352b0),
+	},
+    },
+    {
+	{
+	    TOBN(0xbf66baa5, 0xb44b1d0c), TOBN(0xbbed18ed, 0xa44f8eda),
+	    TOBN(0x80bc32ab, 0xeaaa466c), TOBN(0x605b7897, 0xe5f2733b),
+	    TOBN(0xe9e7e3a1, 0xa2531afa), TOBN(0x25d66db3, 0x3deb8369),
+	},
+	{
+	    TOBN(0x36212ea3, 0xb2f25d10), TOBN(0x52d6b3f4, 0xa08d303e),
+	    TOBN(0xefa54b31, 0x444e9e9f), TOBN(0x9c2229a1, 0x69530c1b),
+	    TOBN(0x68feb985, 0x4b79bdd1), TOBN(0xd570e84f, 0x8b984cc3),
+	},
+    },
+    {
+	{
+	    TOBN(0xf53ccc43, 0x0cd91773), TOBN(0xafe1be60, 0x6af08149),
+	    TOBN(0xb5539191, 0x1ec12f88), TOBN(0x768e8464, 0x5889f081),
+	    TOBN(0xc68dd83c, 0x42b18538), TOBN(0xcf841336, 0xff4e89cf),
+	},
+	{
+	    TOBN(0x8095562b, 0x5bbcd54a), TOBN(0xfd85d4f5, 0x70068fb6),
+	    TOBN(0xf96bcb70, 0x020fce21), TOBN(0x00f59987, 0x7012423a),
+	    TOBN(0xa40eb7f7, 0xf4380d56), TOBN(0x260aeedd, 0x068a5694),
+	},
+    },
+    {
+	{
+	    TOBN(0xb06c17a3, 0xf0ef77c5), TOBN(0xc144e784, 0x6df6bf59),
+	    TOBN(0x2440ae99, 0x0038aeb2), TOBN(0x83bf711b, 0x58b402ca),
+	    TOBN(0xb8763e00, 0xb577732a), TOBN(0x509e91ef, 0xf651a932),
+	},
+	{
+	    TOBN(0xbe02ab9d, 0x00ac109e), TOBN(0xfbcb426c, 0x8dfd78f1),
+	    TOBN(0x7ed272f6, 0x4283f80f), TOBN(0x098cf057, 0x2365da5e),
+	    TOBN(0xd90e6f18, 0x05dc6beb), TOBN(0x09ef177f, 0xcf7b9d72),
+	},
+    },
+    {
+	{
+	    TOBN(0x9d2ead65, 0x753319a1), TOBN(0xb3844b60, 0xaedf04ae),
+	    TOBN(0xc814793c, 0xfd395a0b), TOBN(0x1a501fb0, 0x2e9b543b),
+	    TOBN(0x35aafe4d, 0xfcd7ddb4), TOBN(0xf0fefcd6, 0x9af77eae),
+	},
+	{
+	    TOBN(0xb907c10f, 0x86552a0f), TOBN(0xa0d073f1, 0x8a08f007),
+	    TOBN(0x3fec461e, 0xc8791f03), TOBN(0x575d63a4, 0x1a9922e0),
+	    TOBN(0xeb656480, 0xcd138941), TOBN(0x501060e9, 0xaa63d6bd),
+	},
+    },
+    {
+	{
+	    TOBN(0xe16d0314, 0xcb6a8f11), TOBN(0x42c43f1d, 0xe568aace),
+	    TOBN(0x91cec53c, 0x0c2f3b94), TOBN(0x7534d5f4, 0xab123e48),
+	    TOBN(0x63b376b4, 0x93e3ac11), TOBN(0x833c0b9f, 0x77411e12),
+	},
+	{
+	    TOBN(0x1f55fbe2, 0x8f5b56f2), TOBN(0xb74dec61, 0x20cc5ef9),
+	    TOBN(0xbb9bbf80, 0x8be503fc), TOBN(0x2a02d5be, 0x5ed2dd3e),
+	    TOBN(0x1047f26b, 0x3e77168e), TOBN(0xea1b92bb, 0x95ce02ca),
+	},
+    },
+    {
+	{
+	    TOBN(0x488c0dc9, 0xf8ba6581), TOBN(0xb54a71c2, 0xbd2f39d9),
+	    TOBN(0x23e4c23d, 0xe70c4f30), TOBN(0x599021da, 0x5070b3df),
+	    TOBN(0xdb9b1ea2, 0xf89be1a7), TOBN(0x5303fd87, 0x8b07d805),
+	},
+	{
+	    TOBN(0xb4052367, 0x401b228b), TOBN(0x2c9d7dcf, 0xb9f754d5),
+	    TOBN(0xc7294a37, 0x2f0886f2), TOBN(0x87047779, 0x3144d1ed),
+	    TOBN(0xbc57afcb, 0xdec3ffaa), TOBN(0x882c71c1, 0x3bf28833),
+	},
+    },
+    {
+	{
+	    TOBN(0x1e34781a, 0xa6a1913d), TOBN(0x9a8f3228, 0x7d0adc38),
+	    TOBN(0xfc185ccc, 0x28af85ba), TOBN(0xc923d78b, 0x3ae9ba11),
+	    TOBN(0x7d494d7e, 0xa7bdb313), TOBN(0xf774dfa5, 0xaf8f8b87),
+	},
+	{
+	    TOBN(0xc178ccc1, 0x16e863b8), TOBN(0x2d472f2a, 0xa8899691),
+	    TOBN(0x608747cc, 0x80a50372), TOBN(0x8147aa90, 0xe6f90197),
+	    TOBN(0x4683d4c9, 0x78c2f216), TOBN(0x8323652c, 0x552f3b51),
+	},
+    },
+    {
+	{
+	    TOBN(0x7bb1a7ca, 0xfedc4845), TOBN(0x6b07da1c, 0x949950ff),
+	    TOBN(0xdbc86b74, 0xbf6d76a3), TOBN(0xee8f0895, 0xa612802c),
+	    TOBN(0x8931db16, 0x053c1a3f), TOBN(0xdd2f81cc, 0x37e380ff),
+	},
+	{
+	    TOBN(0x41063c8e, 0x52ad583f), TOBN(0x8227c7e7, 0xd71f4031),
+	    TOBN(0x1f490521, 0xe92bfbdb), TOBN(0xcfc770cf, 0x1ffd2cbc),
+	    TOBN(0x474425b8, 0xd8f471be), TOBN(0x78420405, 0xe40c1570),
+	},
+    },
+    {
+	{
+	    TOBN(0x3cde0cbe, 0x44fb325c), TOBN(0x774debf6, 0xf295f6c2),
+	    TOBN(0x10f81c82, 0x775760bd), TOBN(0xe9ae77fe, 0x3e74fb76),
+	    TOBN(0xe3567ad9, 0xd907f99b), TOBN(0x5c6af387, 0x81f67682),
+	},
+	{
+	    TOBN(0xf0cf4aaf, 0xdacafa61), TOBN(0x5e6e14e2, 0x50249222),
+	    TOBN(0xd3fa4276, 0x103e2e91), TOBN(0x74fd6399, 0x7d705af8),
+	    TOBN(0xa876dc37, 0x3695b40a), TOBN(0x49a7f009, 0x7db78a84),
+	},
+    },
+    {
+	{
+	    TOBN(0x4209969a, 0xc560de14), TOBN(0xb53e0ab4, 0xe343f2be),
+	    TOBN(0x9c75748c, 0x5f4f08f4), TOBN(0xd3f34056, 0x57e82dba),
+	    TOBN(0x55ec4411, 0xc07d2040), TOBN(0xa06a01ed, 0x559d4a3d),
+	},
+	{
+	    TOBN(0x53241926, 0x18931c90), TOBN(0xce351cb2, 0x5ba292d4),
+	    TOBN(0xddd113ec, 0xb646f381), TOBN(0x330af949, 0x59f01767),
+	    TOBN(0x2bb7f618, 0xede79e88), TOBN(0x3a0a223c, 0xf839f547),
+	},
+    },
+    {
+	{
+	    TOBN(0x6fddefb3, 0x0b917628), TOBN(0x3b12f650, 0xbcd8e1e5),
+	    TOBN(0x0a1cede6, 0xb18d722f), TOBN(0x405a73d7, 0x45f6f597),
+	    TOBN(0x83183a0e, 0xf86a7e89), TOBN(0x7d16bbc3, 0x2f3ee021),
+	},
+	{
+	    TOBN(0x74995393, 0x56a7f18e), TOBN(0x304e6bf1, 0x7a16e06d),
+	    TOBN(0xf3be9072, 0xdc5dad0a), TOBN(0x6b76cf04, 0xe21b3648),
+	    TOBN(0xd549c70a, 0x72148f71), TOBN(0x9e090195, 0x943331f6),
+	},
+    },
+    {
+	{
+	    TOBN(0x09b41d2e, 0x5eb346bf), TOBN(0x095c6747, 0x9beff48b),
+	    TOBN(0x5a41aa3f, 0xc835575f), TOBN(0xb4faf7cb, 0xe71c708f),
+	    TOBN(0x95022f40, 0x55150fcc), TOBN(0x211233eb, 0xf66f2c10),
+	},
+	{
+	    TOBN(0xc9259718, 0xa50e8fdc), TOBN(0x4513cdc9, 0xa3665c64),
+	    TOBN(0xc8e8715a, 0xae783e91), TOBN(0xbc0cfee5, 0xdae6cbfb),
+	    TOBN(0x1d476800, 0xc611e06a), TOBN(0x7118af0b, 0x4e40118b),
+	},
+    },
+    {
+	{
+	    TOBN(0xcdd41d49, 0xe12be670), TOBN(0xe9978f44, 0x9aafe5a4),
+	    TOBN(0x15e5c887, 0x9e6f1c14), TOBN(0x993692a2, 0x5a733974),
+	    TOBN(0x81b7c480, 0x46b105d8), TOBN(0x1cdb963b, 0x50fb596d),
+	},
+	{
+	    TOBN(0xc371b316, 0xc0cf8c07), TOBN(0x79d05637, 0x1ef113be),
+	    TOBN(0x24a9ddbe, 0x877a22a0), TOBN(0x2c75bd6d, 0xff55ec1f),
+	    TOBN(0x678e1841, 0xbd6c66cb), TOBN(0x3ee112f4, 0x1fde77a5),
+	},
+    },
+    {
+	{
+	    TOBN(0xd1d983a2, 0x9a262c5f), TOBN(0x918bc70b, 0xc5be5512),
+	    TOBN(0x5591a011, 0x1c150bc1), TOBN(0x47cd6600, 0x1458f6fa),
+	    TOBN(0x9d2b2b71, 0x1581ed40), TOBN(0xa663c503, 0x968d6181),
+	},
+	{
+	    TOBN(0xbb842a55, 0xfc98bcf2), TOBN(0xe36033b7, 0x9b085512),
+	    TOBN(0x4d479fc1, 0xe14423ab), TOBN(0x94a79213, 0x5863b7c0),
+	    TOBN(0x6e9d34cb, 0xfc24ce56), TOBN(0xd984d77d, 0x45bc0138),
+	},
+    },
+    {
+	{
+	    TOBN(0xa438634e, 0xd7357a51), TOBN(0x918f14cd, 0x18c04d59),
+	    TOBN(0x2ab4dedf, 0xac40dd56), TOBN(0x758e95ee, 0x4956a5de),
+	    TOBN(0xfc11e394, 0x5113f84d), TOBN(0x6d71b673, 0x6059f16c),
+	},
+	{
+	    TOBN(0xfd8e2236, 0xfb357c3f), TOBN(0xd7c86812, 0x32dca873),
+	    TOBN(0x02aeb153, 0x8ea13b44), TOBN(0xde1275d3, 0x013d3827),
+	    TOBN(0x470a7b7e, 0x659ca201), TOBN(0x862c83c5, 0x5c77b351),
+	},
+    },
+    {
+	{
+	    TOBN(0x6ff4e2da, 0x0f8c131c), TOBN(0xaf96ec35, 0x22b2b541),
+	    TOBN(0x5d513778, 0x5c9b000c), TOBN(0x519193fc, 0x3a4f5742),
+	    TOBN(0xd099d40c, 0xb4882391), TOBN(0xef35742d, 0x7daac6db),
+	},
+	{
+	    TOBN(0xfec54944, 0x4429de9f), TOBN(0x99930ef4, 0x223f2fb5),
+	    TOBN(0x0cc153a3, 0x260f0029), TOBN(0xe93e8932, 0x89cb3473),
+	    TOBN(0x11a73315, 0x67520649), TOBN(0xf2e46308, 0x8529120e),
+	},
+    },
+    {
+	{
+	    TOBN(0x0320d9bb, 0x569bea38), TOBN(0xd4b2c2df, 0x3f9d27af),
+	    TOBN(0x298bb19d, 0xd46ffdb8), TOBN(0x5db3a6c1, 0x70cc6e35),
+	    TOBN(0xd75b5957, 0xae2c15eb), TOBN(0xe4a20787, 0x5d5c3c57),
+	},
+	{
+	    TOBN(0x8929a76c, 0x2e961815), TOBN(0x7430e070, 0x57836d33),
+	    TOBN(0x712021c1, 0xfbaf1be7), TOBN(0x8faa210c, 0x0210599a),
+	    TOBN(0x20f310b2, 0xd8378349), TOBN(0x04158cb4, 0x9d646110),
+	},
+    },
+    {
+	{
+	    TOBN(0x87c3b5b2, 0x11df2b84), TOBN(0x52bf7080, 0x232bb925),
+	    TOBN(0xfc0a4ecd, 0x0af135ce), TOBN(0xdd8c11a0, 0xba1f6c08),
+	    TOBN(0x97fe2fdb, 0xc71237f5), TOBN(0x3f854949, 0x537525d6),
+	},
+	{
+	    TOBN(0xfcd45e2d, 0x21543463), TOBN(0x33040e83, 0x4059a3a1),
+	    TOBN(0x02f5f174, 0x2e91b6c7), TOBN(0xaf821fcd, 0xb8e5d0e6),
+	    TOBN(0xb3ad1bc9, 0x7770b32c), TOBN(0x087111a4, 0x6f146d6e),
+	},
+    },
+    {
+	{
+	    TOBN(0x9a72b516, 0xa3c968a5), TOBN(0x786557d1, 0xd4bcd1b8),
+	    TOBN(0x692c6713, 0xbf8bd560), TOBN(0x21827461, 0x1e07ade1),
+	    TOBN(0x30e7d806, 0xea7fbbda), TOBN(0xf3ad1035, 0x8f2310b8),
+	},
+	{
+	    TOBN(0xae2f7156, 0x5265b6b6), TOBN(0x772e94ea, 0x17dd42f6),
+	    TOBN(0xc2854f8e, 0x212cc15e), TOBN(0xd3ddf4e4, 0xdf6ac157),
+	    TOBN(0x9bbda387, 0xab0eca33), TOBN(0x57222c41, 0xb66d00b2),
+	},
+    },
+    {
+	{
+	    TOBN(0x9f5461d3, 0x2f274cc5), TOBN(0xa4c77651, 0xa418bdd1),
+	    TOBN(0x3c61fb03, 0xb0f6837f), TOBN(0x2b12ed27, 0xbff43849),
+	    TOBN(0xfb5c577e, 0xfa56e376), TOBN(0x788b9b6b, 0xa9fb03f1),
+	},
+	{
+	    TOBN(0xe66814db, 0xa134319d), TOBN(0x47b04ae0, 0x69b00480),
+	    TOBN(0xb081feaf, 0x0aa368d7), TOBN(0x6abc5c53, 0x6b0035b1),
+	    TOBN(0xa892f125, 0xd41f4c03), TOBN(0xd03ca405, 0x6553ba19),
+	},
+    },
+    {
+	{
+	    TOBN(0x153bb6fe, 0x83d1b2ed), TOBN(0xe3ec87e0, 0x78adb6e3),
+	    TOBN(0x5c5271cb, 0x20ffbfad), TOBN(0xf45a3140, 0xd7071dec),
+	    TOBN(0x26eb64cb, 0x228d37de), TOBN(0x855ec715, 0x84484a10),
+	},
+	{
+	    TOBN(0xbf92dbba, 0xd0c65790), TOBN(0x1e4af416, 0x9f1d0338),
+	    TOBN(0x18706934, 0x9a6e86f7), TOBN(0x916ee53a, 0x87753f71),
+	    TOBN(0x5a24a921, 0x3437d53f), TOBN(0x37f8988f, 0x1010da8a),
+	},
+    },
+    {
+	{
+	    TOBN(0x6765dac3, 0xf2e8aa92), TOBN(0x73c9e127, 0x0e06eecc),
+	    TOBN(0x1bde5b1a, 0x60b3b43c), TOBN(0x8c41e71a, 0x9f99b1c3),
+	    TOBN(0xd6614e90, 0xf91ed521), TOBN(0xcf1ac431, 0xbfb5825d),
+	},
+	{
+	    TOBN(0xa4036dbf, 0xeaa5081f), TOBN(0xa39dcd74, 0x3dfcbcf7),
+	    TOBN(0xa15c13a2, 0xa47e8c68), TOBN(0x03f7476f, 0xfc81f583),
+	    TOBN(0x43d5337b, 0xa9884d69), TOBN(0xeb2e30bb, 0x4ab3cae5),
+	},
+    },
+    {
+	{
+	    TOBN(0x6ca12fc1, 0xb3c62cc4), TOBN(0x97bd726a, 0x519ea0f1),
+	    TOBN(0xf4424387, 0x344a767c), TOBN(0x1d3ccc19, 0xdd63f0af),
+	    TOBN(0xf610351a, 0xa2780114), TOBN(0x7ad2951c, 0xbd54766e),
+	},
+	{
+	    TOBN(0x261ff024, 0xf80e691c), TOBN(0x96921e83, 0x0116f41a),
+	    TOBN(0xee0c1c9a, 0x1c44f89b), TOBN(0xf4eb6452, 0xff130067),
+	    TOBN(0xe3d54317, 0x536ea4af), TOBN(0xa832460a, 0xcc9e4a78),
+	},
+    },
+    {
+	{
+	    TOBN(0xcd9d9e0f, 0x3253846f), TOBN(0x497f4ae7, 0xcc22fa8f),
+	    TOBN(0xc311d755, 0x456041f2), TOBN(0x85f96256, 0xa4ef2e1f),
+	    TOBN(0xa27565e0, 0xedd85821), TOBN(0xd86c1394, 0xaa9ff3e1),
+	},
+	{
+	    TOBN(0x640bc32b, 0x7a8f2fe2), TOBN(0xfde27e6e, 0x3c82e2ce),
+	    TOBN(0xe849f421, 0x61563edd), TOBN(0x687c7bef, 0x0d977d49),
+	    TOBN(0x9419dba4, 0x44afec14), TOBN(0xb828d8c2, 0xb5d4c0bd),
+	},
+    },
+    {
+	{
+	    TOBN(0xcc34e8c2, 0x3fd3595b), TOBN(0xea52c62e, 0xfcd54d84),
+	    TOBN(0xe020afca, 0xe1b3fec9), TOBN(0x015ca690, 0x9e0e91ba),
+	    TOBN(0x5aa99651, 0xd9fae5a2), TOBN(0x3e78befb, 0x754d250e),
+	},
+	{
+	    TOBN(0xf5a04045, 0x8dbac710), TOBN(0x014a289a, 0x3302574f),
+	    TOBN(0x5f3fa759, 0x7e511068), TOBN(0x51c3006e, 0xf9b7d688),
+	    TOBN(0xde5dd2db, 0x8135bad1), TOBN(0x932e8747, 0x6cc8e2ff),
+	},
+    },
+    {
+	{
+	    TOBN(0x69ebf36a, 0x6736e6b4), TOBN(0xf7205ee8, 0xddc6d453),
+	    TOBN(0x77e4fca0, 0xb474e9b4), TOBN(0x487f36a2, 0xcce1c493),
+	    TOBN(0xf69ef263, 0xc82f20cd), TOBN(0xbc76c998, 0x06a4413d),
+	},
+	{
+	    TOBN(0xc2b071e5, 0x8cddc1d9), TOBN(0x953fe504, 0x77191d6a),
+	    TOBN(0x67c507b1, 0xc987f891), TOBN(0x334daafd, 0x23155ad5),
+	    TOBN(0x70eb6b85, 0x798082b6), TOBN(0x554d088d, 0xd6c13e18),
+	},
+    },
+    {
+	{
+	    TOBN(0xe3b167e5, 0xf0f760dc), TOBN(0x9e82b17e, 0x6de094dd),
+	    TOBN(0xf2f848cc, 0x9bdc1b34), TOBN(0x4ddeebcb, 0x201332aa),
+	    TOBN(0x58657492, 0xcb453e77), TOBN(0x865f8172, 0x1f996418),
+	},
+	{
+	    TOBN(0xe0000cd0, 0xed2491ac), TOBN(0x975f5f45, 0xae8a4018),
+	    TOBN(0x91c36fc6, 0x3e58e177), TOBN(0x8eb2210a, 0x690a1a81),
+	    TOBN(0x913ca5fc, 0xe9a1c2e4), TOBN(0x74976015, 0x2e7bbb9b),
+	},
+    },
+    {
+	{
+	    TOBN(0xef8f66f0, 0x9a8cbda4), TOBN(0x93f800f4, 0xb700e037),
+	    TOBN(0xfae80d9c, 0xf8aa4ca1), TOBN(0x7a16a42c, 0xc3e1a480),
+	    TOBN(0xeb54d7e9, 0x81967202), TOBN(0xb4b048d1, 0x497d0d74),
+	},
+	{
+	    TOBN(0x6d028b69, 0xb7c3505b), TOBN(0x37b26190, 0xbe1dbe58),
+	    TOBN(0x0f943196, 0x1ca4e3fa), TOBN(0xbccd1579, 0xb46d832c),
+	    TOBN(0x72e4d411, 0x1feec8d6), TOBN(0xc3d0018f, 0xb3ca3427),
+	},
+    },
+    {
+	{
+	    TOBN(0x235be44e, 0xaf06d6de), TOBN(0x84be07a1, 0x38838352),
+	    TOBN(0xdb673806, 0x436fa43a), TOBN(0xfc59e0ba, 0x1a286797),
+	    TOBN(0x0fdbdb5e, 0x1757fe05), TOBN(0xc75c6c04, 0x93c01379),
+	},
+	{
+	    TOBN(0x7c55ebe8, 0xa11a10f4), TOBN(0x29f3b541, 0x6d068cee),
+	    TOBN(0x17c5aac2, 0x1a604d8b), TOBN(0xd7401192, 0xbfbdbe58),
+	    TOBN(0x447e0405, 0x9211c61b), TOBN(0xf8eb19da, 0x4065b5e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x6f10f3ad, 0xa3e8c7e3), TOBN(0x6e656947, 0xd70d991d),
+	    TOBN(0xbefea89d, 0x087abf7a), TOBN(0x21850927, 0xdc00eb84),
+	    TOBN(0x4d4a07eb, 0x75651df0), TOBN(0x9a7186ac, 0xf01d67fa),
+	},
+	{
+	    TOBN(0x61c7908a, 0xc90d8796), TOBN(0x220b4f70, 0xdd0403fe),
+	    TOBN(0x0f34882b, 0xe73f0285), TOBN(0x70346f3d, 0x9a1e1bda),
+	    TOBN(0xb1fc4a0c, 0xe54dadec), TOBN(0x03000648, 0x7409a447),
+	},
+    },
+};
+static const BN_ULONG
+ec_comb_p384_offset_mont[2][2][6 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0xfbd6ca20, 0xd8f8b81a), TOBN(0xe078ab5d, 0x506d1483),
+	    TOBN(0x44a70530, 0x6b774e1d), TOBN(0x5f602c56, 0x8e635766),
+	    TOBN(0xc78a5d8e, 0x5646a40e), TOBN(0x822b6590, 0x1feb9894),
+	},
+	{
+	    TOBN(0x9bd2937e, 0xaaa6ac38), TOBN(0xc6520a0f, 0x90176012),
+	    TOBN(0xe3125ebf, 0x202ab36b), TOBN(0x0e9817c1, 0x0d343f64),
+	    TOBN(0x3c3aa9b3, 0xb975fb56), TOBN(0x1eb7f26c, 0x2b78c012),
+	},
+    },
+    {
+	{
+	    TOBN(0xe630b9c0, 0xa19bf172), TOBN(0x873f1eaa, 0x0574e7be),
+	    TOBN(0x964587dd, 0x9c8ff0f1), TOBN(0xc49173bb, 0x1bd48359),
+	    TOBN(0xd3b33ce7, 0xa1ea89c0), TOBN(0xf71c304c, 0x754b8ee7),
+	},
+	{
+	    TOBN(0x0d5bc40b, 0xcebe2b1b), TOBN(0x30b77af8, 0xb016a510),
+	    TOBN(0x36ce379a, 0x0f509dc9), TOBN(0x2dffead5, 0x5cbcae0c),
+	    TOBN(0xc68453fd, 0xcf02bbf3), TOBN(0xdf00f669, 0x1a0357a7),
+	},
+    },
+};
+
+static const BN_ULONG ec_comb_p521_p[] = {
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0x00000000, 0x000001ff),
+};
+static const BN_ULONG ec_comb_p521_a[] = {
+	TOBN(0xffffffff, 0xfffffffc), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0x00000000, 0x000001ff),
+};
+static const BN_ULONG ec_comb_p521_b[] = {
+	TOBN(0xef451fd4, 0x6b503f00), TOBN(0x3573df88, 0x3d2c34f1),
+	TOBN(0x1652c0bd, 0x3bb1bf07), TOBN(0x56193951, 0xec7e937b),
+	TOBN(0xb8b48991, 0x8ef109e1), TOBN(0xa2da725b, 0x99b315f3),
+	TOBN(0x929a21a0, 0xb68540ee), TOBN(0x953eb961, 0x8e1c9a1f),
+	TOBN(0x00000000, 0x00000051),
+};
+static const BN_ULONG ec_comb_p521_order[] = {
+	TOBN(0xbb6fb71e, 0x91386409), TOBN(0x3bb5c9b8, 0x899c47ae),
+	TOBN(0x7fcc0148, 0xf709a5d0), TOBN(0x51868783, 0xbf2f966b),
+	TOBN(0xffffffff, 0xfffffffa), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0xffffffff),
+	TOBN(0x00000000, 0x000001ff),
+};
+
+static const BN_ULONG
+ec_comb_p521_table[EC_COMB_TABLES << EC_COMB_TEETH][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0xf97e7e31, 0xc2e5bd66), TOBN(0x3348b3c1, 0x856a429b),
+	    TOBN(0xfe1dc127, 0xa2ffa8de), TOBN(0xa14b5e77, 0xefe75928),
+	    TOBN(0xf828af60, 0x6b4d3dba), TOBN(0x9c648139, 0x053fb521),
+	    TOBN(0x9e3ecb66, 0x2395b442), TOBN(0x858e06b7, 0x0404e9cd),
+	    TOBN(0x00000000, 0x000000c6),
+	},
+	{
+	    TOBN(0x88be9476, 0x9fd16650), TOBN(0x353c7086, 0xa272c240),
+	    TOBN(0xc550b901, 0x3fad0761), TOBN(0x97ee7299, 0x5ef42640),
+	    TOBN(0x17afbd17, 0x273e662c), TOBN(0x98f54449, 0x579b4468),
+	    TOBN(0x5c8a5fb4, 0x2c7d1bd9), TOBN(0x39296a78, 0x9a3bc004),
+	    TOBN(0x00000000, 0x00000118),
+	},
+    },
+    {
+	{
+	    TOBN(0xb19a5828, 0x676a875a), TOBN(0x40729f28, 0xc83a4911),
+	    TOBN(0x511949b1, 0xc6dce05b), TOBN(0x25914c8c, 0x3fcf0490),
+	    TOBN(0xc49490de, 0x0c6c2742), TOBN(0x3b21feef, 0xdf6cd770),
+	    TOBN(0x012d2802, 0xdd1a82a2), TOBN(0x72f5a0b7, 0x6453439d),
+	    TOBN(0x00000000, 0x00000020),
+	},
+	{
+	    TOBN(0x3e85d07d, 0x9b58e26d), TOBN(0x56527bdd, 0x1c50af24),
+	    TOBN(0x564b5658, 0x7df377d0), TOBN(0xf5b03358, 0x65e97a30),
+	    TOBN(0x2b22d6e9, 0x6b31bc52), TOBN(0x8ad449ab, 0xcccd4bba),
+	    TOBN(0x84b8b888, 0xf7c162a2), TOBN(0x3b647f0e, 0x4d56f29b),
+	    TOBN(0x00000000, 0x000001fb),
+	},
+    },
+    {
+	{
+	    TOBN(0x1d4408ef, 0xb6e356fb), TOBN(0x9aea805f, 0x0d5c2895),
+	    TOBN(0x565817b5, 0xbe66ecbf), TOBN(0x44aff738, 0x30f7bd94),
+	    TOBN(0x943f2489, 0x31292f65), TOBN(0xde4b6ee4, 0xfc8a1f91),
+	    TOBN(0xa1c62b7c, 0xac30cd57), TOBN(0x54c5bb53, 0x05f3077a),
+	    TOBN(0x00000000, 0x00000084),
+	},
+	{
+	    TOBN(0x5b86d697, 0x1a862cfb), TOBN(0x47e1a85e, 0x21a49e56),
+	    TOBN(0x45b5e347, 0x4333f2ab), TOBN(0xac20df05, 0xc309733b),
+	    TOBN(0xf10776f6, 0x89fa0f99), TOBN(0xc1e74976, 0xb3b4ccc8),
+	    TOBN(0x4589bb6e, 0xf294b300), TOBN(0xc41b930b, 0x95b3874c),
+	    TOBN(0x00000000, 0x00000055),
+	},
+    },
+    {
+	{
+	    TOBN(0xc06a64ce, 0x981fd289), TOBN(0xb8dc2603, 0xd11fcd02),
+	    TOBN(0xea27a922, 0x770d2eb2), TOBN(0x83c64076, 0xda8f19ed),
+	    TOBN(0x9f6d1b65, 0x0ae6a311), TOBN(0x977277bf, 0x73fa8721),
+	    TOBN(0x7115ef98, 0xcc0292d8), TOBN(0x93237ae7, 0xd2e0c67e),
+	    TOBN(0x00000000, 0x00000069),
+	},
+	{
+	    TOBN(0x83481b59, 0x5c151734), TOBN(0xba00bd74, 0x0ac1576e),
+	    TOBN(0x48f33272, 0xf178d4f2), TOBN(0xe09fde38, 0x16492d95),
+	    TOBN(0x876124db, 0xb9dfce3f), TOBN(0x27e7b1e5, 0x03fe728f),
+	    TOBN(0x79347e46, 0x04f98f99), TOBN(0x63ec8c5d, 0x48dcf0ee),
+	    TOBN(0x00000000, 0x00000149),
+	},
+    },
+    {
+	{
+	    TOBN(0x0303cc01, 0xd4ce0cda), TOBN(0x5849826e, 0xfe08eeab),
+	    TOBN(0x14922a17, 0x13537534), TOBN(0x796f40fd, 0xd57d6a82),
+	    TOBN(0x58068999, 0x69bd564e), TOBN(0x23fed1c8, 0xcdb0f1df),
+	    TOBN(0x0a30ff0f, 0x65bca377), TOBN(0x190c614b, 0x71607321),
+	    TOBN(0x00000000, 0x00000113),
+	},
+	{
+	    TOBN(0x6149128c, 0x6e6a83a7), TOBN(0xcdd2ef65, 0xdcc2e0cd),
+	    TOBN(0x115c42b4, 0x68610121), TOBN(0xb3fdad5d, 0x7dfb78c3),
+	    TOBN(0x2e16ce25, 0x21edf0bf), TOBN(0x5155fcf7, 0x92ae1e95),
+	    TOBN(0xf10f0ccf, 0xdff79345), TOBN(0x90d5832e, 0xb7f8417f),
+	    TOBN(0x00000000, 0x000000e4),
+	},
+    },
+    {
+	{
+	    TOBN(0x8d7317e8, 0xb75da2bb), TOBN(0x6c60038e, 0x81e5d5c9),
+	    TOBN(0x4ab058f0, 0xb9d48a0b), TOBN(0xe90e156e, 0x4eca1cd0),
+	    TOBN(0x6d5b904e, 0x81cd0da4), TOBN(0xd8344731, 0xfaaccc3f),
+	    TOBN(0xe96ba7f2, 0xfc24f6f3), TOBN(0x3ad51d5f, 0xd161444a),
+	    TOBN(0x00000000, 0x000001f8),
+	},
+	{
+	    TOBN(0x51279d66, 0xbe4ca896), TOBN(0x2e49d501, 0xeb5b6253),
+	    TOBN(0x7daced30, 0xc99b28dc), TOBN(0x2f4d3ef6, 0xef94c84e),
+	    TOBN(0x52dc6b5d, 0xaa4ca282), TOBN(0x8dca17d7, 0x37e37253),
+	    TOBN(0x709a47fe, 0x07f6d080), TOBN(0xd0a4d635, 0xe4a778ff),
+	    TOBN(0x00000000, 0x00000052),
+	},
+    },
+    {
+	{
+	    TOBN(0xb1298e28, 0x9f4dd83c), TOBN(0x8dcca8ca, 0xae8a75ad),
+	    TOBN(0x928c6d09, 0x19a13385), TOBN(0x79398480, 0xa8ba7682),
+	    TOBN(0x3e9ccb11, 0x3fe6cc5b), TOBN(0x62ac771c, 0x5885a242),
+	    TOBN(0x6514bb33, 0xc36adc65), TOBN(0x3234d613, 0xfecd22dd),
+	    TOBN(0x00000000, 0x00000139),
+	},
+	{
+	    TOBN(0xc89111bc, 0x5bee8ca8), TOBN(0x90bbbe91, 0xbcb89121),
+	    TOBN(0xa3c165e9, 0xf59fedfd), TOBN(0xf3fd593f, 0x07228f90),
+	    TOBN(0x2022a3ab, 0x238bb703), TOBN(0xa97dcd78, 0xebc45a00),
+	    TOBN(0x325270d0, 0x91ce860a), TOBN(0x2cb1ab2b, 0xd3f141b6),
+	    TOBN(0x00000000, 0x00000012),
+	},
+    },
+    {
+	{
+	    TOBN(0x08136cbf, 0x025189d4), TOBN(0xa1c389cb, 0xc1b25a05),
+	    TOBN(0xbecdade7, 0x6e9ed11d), TOBN(0x6557006b, 0xa7f3f38a),
+	    TOBN(0x96d6c877, 0xbc852dbd), TOBN(0x3a0afe4b, 0xc53efd4f),
+	    TOBN(0xc7f58410, 0xfebe4737), TOBN(0x86deba3b, 0x84e35e2f),
+	    TOBN(0x00000000, 0x0000015b),
+	},
+	{
+	    TOBN(0x96256db2, 0x4dfa7da8), TOBN(0x37973557, 0x3dccf202),
+	    TOBN(0x2e0b263e, 0x8fcc1274), TOBN(0x14870fe8, 0x9ee7b82e),
+	    TOBN(0xcb8f9ba5, 0x425ca276), TOBN(0x683c748e, 0x7d876e79),
+	    TOBN(0x48e990d5, 0xde2f2cfe), TOBN(0x2ecc8f1f, 0x48547013),
+	    TOBN(0x00000000, 0x0000018f),
+	},
+    },
+    {
+	{
+	    TOBN(0x68ab5d2f, 0x09975a81), TOBN(0x7acd8fa6, 0xfdc6c774),
+	    TOBN(0x1fb3cf53, 0x727a6887), TOBN(0x82b8cdb2, 0x0ee80fd2),
+	    TOBN(0x6945e6a5, 0x2878d127), TOBN(0xe93b98f1, 0xe4c494c6),
+	    TOBN(0xa3af8319, 0x38f656f9), TOBN(0x4a3877ef, 0x6fc6a007),
+	    TOBN(0x00000000, 0x000001b2),
+	},
+	{
+	    TOBN(0xd95bf209, 0x73a5c071), TOBN(0x4fa40d5a, 0x46b53ee5),
+	    TOBN(0x9bf0674e, 0xed28ce97), TOBN(0x51423d1f, 0xa0b52fcc),
+	    TOBN(0x5711b965, 0x092ccaeb), TOBN(0x045fcaf0, 0x4ad60d22),
+	    TOBN(0x9db711fb, 0x1359c654), TOBN(0x60afa70c, 0x53431c72),
+	    TOBN(0x00000000, 0x00000166),
+	},
+    },
+    {
+	{
+	    TOBN(0x9dea3d3b, 0xdfae82d4), TOBN(0xdc0adcf1, 0x0fd1a066),
+	    TOBN(0x8b34b6ec, 0x45eb29ed), TOBN(0x69be8057, 0x04b908df),
+	    TOBN(0xef0410a9, 0xc233831d), TOBN(0xd0e72358, 0x7bb36226),
+	    TOBN(0x657b474b, 0xf1138358), TOBN(0xbe0f6ef5, 0x56c43421),
+	    TOBN(0x00000000, 0x000000f0),
+	},
+	{
+	    TOBN(0x1dc4541a, 0xe47364d0), TOBN(0xe9dc2602, 0x0d39b3fc),
+	    TOBN(0x39536f54, 0xbf7949b7), TOBN(0xe6d725ea, 0x7a5644d2),
+	    TOBN(0xdf094485, 0x8c34de16), TOBN(0x071f11fd, 0xf0f1a37d),
+	    TOBN(0x8f856065, 0x06f63f0a), TOBN(0x9a3a964f, 0x5a6a909f),
+	    TOBN(0x00000000, 0x000000b9),
+	},
+    },
+    {
+	{
+	    TOBN(0xd627b9f4, 0x3cb45628), TOBN(0xe9f1b5ee, 0xac1f9f0e),
+	    TOBN(0x629131db, 0x9cfb62a2), TOBN(0x244592ea, 0x6574a7a5),
+	    TOBN(0xa924b9db, 0x3df1c026), TOBN(0x0a27b7c7, 0x633908ee),
+	    TOBN(0xc5f09d5d, 0x9acb84da), TOBN(0xa8494332, 0x1ad1203d),
+	    TOBN(0x00000000, 0x000000fc),
+	},
+	{
+	    TOBN(0x026570b2, 0xdbdac4f9), TOBN(0x48bfd01a, 0xed0cf0ff),
+	    TOBN(0x474dc48f, 0xafaf45f4), TOBN(0xc3d6ca58, 0xf5e8aab4),
+	    TOBN(0xa598c2e7, 0x62c85ad6), TOBN(0xac1e490d, 0x28191619),
+	    TOBN(0xe20f4b81, 0x659eaf2e), TOBN(0x96ae1d89, 0x22dc1ca4),
+	    TOBN(0x00000000, 0x0000011b),
+	},
+    },
+    {
+	{
+	    TOBN(0x11d3a594, 0xbe7612da), TOBN(0xdb97aac2, 0x21d03ac5),
+	    TOBN(0x373f8b6a, 0x119e3147), TOBN(0x46ee7654, 0x19f44b22),
+	    TOBN(0x10f109e1, 0x7a53c9c0), TOBN(0x2618bd7c, 0xdfd41834),
+	    TOBN(0x31171a78, 0x4f3d7aa0), TOBN(0xcd941459, 0x4fe91a42),
+	    TOBN(0x00000000, 0x000000fe),
+	},
+	{
+	    TOBN(0xbfbb1708, 0xe23032f4), TOBN(0x06a1407f, 0x7ecec755),
+	    TOBN(0xe0c12bff, 0xa874918d), TOBN(0x19c1e39b, 0xc2e0ec7d),
+	    TOBN(0x7cae2449, 0xbbe984e2), TOBN(0x3b8a71d0, 0xc490b98a),
+	    TOBN(0xd211f45d, 0xffef9087), TOBN(0xfc02686d, 0xcd14a7d4),
+	    TOBN(0x00000000, 0x000000df),
+	},
+    },
+    {
+	{
+	    TOBN(0x80734a3b, 0xd47abb75), TOBN(0xc21e3d3e, 0x5ab91f07),
+	    TOBN(0xd3660482, 0x783c9fee), TOBN(0x949d308e, 0x82a39ac0),
+	    TOBN(0x5f4977b1, 0x502ed56b), TOBN(0x211060cb, 0x553805e2),
+	    TOBN(0x03eca729, 0x56caee87), TOBN(0x46da029c, 0x22c42ba1),
+	    TOBN(0x00000000, 0x000000c8),
+	},
+	{
+	    TOBN(0x7a3f46d4, 0x8744620d), TOBN(0x1b73e1de, 0x3574b2c7),
+	    TOBN(0xe06ad93a, 0x9691af64), TOBN(0xdc8fa8e7, 0x5a5f90ff),
+	    TOBN(0xac428a45, 0xeeb4aad3), TOBN(0xaf4c00ec, 0x8f7d1ff6),
+	    TOBN(0xb6a8b17c, 0xf478865d), TOBN(0x3e547283, 0x9544b3f5),
+	    TOBN(0x00000000, 0x000000d8),
+	},
+    },
+    {
+	{
+	    TOBN(0x6869b421, 0x1b05c1c6), TOBN(0xa3da997f, 0x20bc3d8d),
+	    TOBN(0xeb55c4ac, 0x4c428d31), TOBN(0x2c4aa046, 0xa282d41d),
+	    TOBN(0x0dbe4dfe, 0x11734193), TOBN(0x9c2a442f, 0x2877c679),
+	    TOBN(0x5aeb1c5c, 0xa8d385ba), TOBN(0x791f0a83, 0x46401506),
+	    TOBN(0x00000000, 0x00000059),
+	},
+	{
+	    TOBN(0xddda462d, 0x2ea95d99), TOBN(0x0e9356f2, 0xc6c28d8a),
+	    TOBN(0x5c813667, 0x344aaf3d), TOBN(0x6b019d7a, 0x0cce0663),
+	    TOBN(0x3c9a515f, 0x97c75f5f), TOBN(0xdc716567, 0x442fdf22),
+	    TOBN(0x484b43d5, 0x8ca4fd28), TOBN(0x473e74de, 0xab1ae5de),
+	    TOBN(0x00000000, 0x000000fc),
+	},
+    },
+    {
+	{
+	    TOBN(0xc10e8166, 0xe96fda3c), TOBN(0x18ab768a, 0x87f01026),
+	    TOBN(0x3b7501ec, 0x020be528), TOBN(0x9e692ee5, 0x0c8bf560),
+	    TOBN(0xb0e174da, 0xd2b13913), TOBN(0x125f4770, 0xa7e4fe44),
+	    TOBN(0x65d4fb94, 0x156bd54a), TOBN(0x05c4572c, 0xde32fcb6),
+	    TOBN(0x00000000, 0x00000059),
+	},
+	{
+	    TOBN(0xd802dc81, 0xcebdb96f), TOBN(0x3bd101b6, 0xe59af03f),
+	    TOBN(0x1fb44353, 0x448ce3ab), TOBN(0xdcdbf870, 0xc1151534),
+	    TOBN(0x1a25e9e5, 0xc6067e1a), TOBN(0x6253b0c1, 0xfd269820),
+	    TOBN(0x466e3fa4, 0xd9674a9d), TOBN(0xfd45488c, 0xf5fb34cd),
+	    TOBN(0x00000000, 0x0000004e),
+	},
+    },
+    {
+	{
+	    TOBN(0x2bad7686, 0xd90119ae), TOBN(0x8dcd64f0, 0x464b230c),
+	    TOBN(0x1d1eeb94, 0xdad19cb1), TOBN(0x3b470389, 0x86f0eb48),
+	    TOBN(0x42abb37d, 0x2c50f380), TOBN(0xfabbcebb, 0xa7a99eb1),
+	    TOBN(0xfeed69dd, 0x33fb0b08), TOBN(0x8de8b50e, 0x31dc2b1e),
+	    TOBN(0x00000000, 0x00000057),
+	},
+	{
+	    TOBN(0xe10dc8a6, 0x054ed7a9), TOBN(0x7094fc36, 0xcf39bec8),
+	    TOBN(0x487789a8, 0x25848527), TOBN(0x8786eaa3, 0x39974124),
+	    TOBN(0x47a0d6b0, 0xa6e3e5ab), TOBN(0x54ed0b21, 0xe981e517),
+	    TOBN(0x85cf17ea, 0xe768123b), TOBN(0xd9a933b0, 0x636e78c6),
+	    TOBN(0x00000000, 0x00000127),
+	},
+    },
+    {
+	{
+	    TOBN(0x8ef4c70c, 0xc23fcffd), TOBN(0xa9e62fcc, 0x3899a59d),
+	    TOBN(0xc9ec0c89, 0xa3ef76f1), TOBN(0xec00c92f, 0xe4cf1d94),
+	    TOBN(0xdc2bd72e, 0x7d29627b), TOBN(0xa88d1299, 0xeda482b0),
+	    TOBN(0x346b2d4f, 0xe8316190), TOBN(0x67562e28, 0xa0152c3b),
+	    TOBN(0x00000000, 0x0000016c),
+	},
+	{
+	    TOBN(0xe5de0a39, 0xe5e86e00), TOBN(0x631618ac, 0x07da7fa7),
+	    TOBN(0x13bc8a0b, 0x87bbe30c), TOBN(0x47d1ee99, 0x30a1c608),
+	    TOBN(0xfc93eb66, 0xf4b79cb6), TOBN(0x70508aba, 0xe14850bb),
+	    TOBN(0xe448adbf, 0x586feba7), TOBN(0xaf24da8c, 0x2542fdae),
+	    TOBN(0x00000000, 0x0000014f),
+	},
+    },
+    {
+	{
+	    TOBN(0xe5c5e029, 0xbe877cd2), TOBN(0xe77479d3, 0x65590edf),
+	    TOBN(0xaa8587bc, 0x6fc6d808), TOBN(0x303d9132, 0xb045a2d7),
+	    TOBN(0xfff1f630, 0xd5439ec6), TOBN(0xddf0755c, 0xc63b995a),
+	    TOBN(0x900de4aa, 0xe34c9e95), TOBN(0x254ae66d, 0xd379caf7),
+	    TOBN(0x00000000, 0x000000ff),
+	},
+	{
+	    TOBN(0xd5ec1551, 0x513365d7), TOBN(0x464cf52f, 0xe50e1450),
+	    TOBN(0x6efc6305, 0xf50abb24), TOBN(0x3716765a, 0xa771d829),
+	    TOBN(0xb6a108e4, 0x744c0da2), TOBN(0x54fe1876, 0x33385f57),
+	    TOBN(0xb5dc0492, 0x6719d3d4), TOBN(0xc9d6f7cb, 0x6d801493),
+	    TOBN(0x00000000, 0x00000089),
+	},
+    },
+    {
+	{
+	    TOBN(0x4c6969a4, 0xc854df32), TOBN(0xe75251f0, 0xc07dfb7f),
+	    TOBN(0x2df8b072, 0x40cfeb8f), TOBN(0xdd269ede, 0x51d368f8),
+	    TOBN(0xd2b3d6e0, 0xf80966eb), TOBN(0xaff15bf0, 0xb2977873),
+	    TOBN(0x480145b7, 0x7c5cfcd4), TOBN(0xc5fb61b1, 0x9b7de3df),
+	    TOBN(0x00000000, 0x00000096),
+	},
+	{
+	    TOBN(0x40cbf8f5, 0xe02177f7), TOBN(0x2784a544, 0xe4f2fc38),
+	    TOBN(0x5a78c444, 0xaa301ddd), TOBN(0xb9269fb0, 0x64f02b47),
+	    TOBN(0xec5369e0, 0xdefa615c), TOBN(0x90717a68, 0x8917bafc),
+	    TOBN(0x59c12f4b, 0x991b5419), TOBN(0xe97bd18b, 0xd39f7fe7),
+	    TOBN(0x00000000, 0x0000019c),
+	},
+    },
+    {
+	{
+	    TOBN(0xabd57c31, 0x30be3f3b), TOBN(0x5ed5b904, 0xc7a686f1),
+	    TOBN(0x21bc5cd0, 0x97cf15ce), TOBN(0x0ed87695, 0x8c53a622),
+	    TOBN(0xd79c35fe, 0xa35fb716), TOBN(0xb292fe5b, 0x564d593a),
+	    TOBN(0x7be449e6, 0x4aefe764), TOBN(0xf84632f8, 0x60b8875e),
+	    TOBN(0x00000000, 0x000000c7),
+	},
+	{
+	    TOBN(0x622ca196, 0xab4906b1), TOBN(0xf2029f62, 0x2bc36aee),
+	    TOBN(0xdb034197, 0x24700ebc), TOBN(0x9c0e21b2, 0x79e26342),
+	    TOBN(0x358b7c26, 0x48fc9631), TOBN(0xec5bca80, 0xfdf1c7ee),
+	    TOBN(0x89054a34, 0x61825005), TOBN(0xb83d2636, 0xeb98ddce),
+	    TOBN(0x00000000, 0x000001a1),
+	},
+    },
+    {
+	{
+	    TOBN(0xf1475bb2, 0xa392f9ff), TOBN(0xc980a16e, 0xfbe2a6c7),
+	    TOBN(0x6b5b9248, 0xf336f468), TOBN(0xf82c2b70, 0x9fd728cb),
+	    TOBN(0x56a8b061, 0x774efa63), TOBN(0x211390c4, 0x8dfd5d7f),
+	    TOBN(0x2d2b92d9, 0xe7d765f1), TOBN(0x6b914b66, 0x86ee944c),
+	    TOBN(0x00000000, 0x000001ce),
+	},
+	{
+	    TOBN(0x978e095b, 0xd45a9c99), TOBN(0x0ef208c7, 0x3c2456f3),
+	    TOBN(0x8c7d684f, 0xc9bc30b8), TOBN(0x064e48aa, 0xa389f964),
+	    TOBN(0xfeb897b3, 0x35a4fdd6), TOBN(0x85a39aa2, 0x4f62300c),
+	    TOBN(0x031586b0, 0x90f667fe), TOBN(0x7d72f2ed, 0xa2cc0d21),
+	    TOBN(0x00000000, 0x000000e2),
+	},
+    },
+    {
+	{
+	    TOBN(0x32bd281f, 0x94e68e44), TOBN(0x3c2f16e2, 0xcad0f9cf),
+	    TOBN(0x0e55718f, 0x8e5d4dd6), TOBN(0xcc8d3c61, 0x52d0bc7f),
+	    TOBN(0x6f2432d7, 0x5c74d01f), TOBN(0x6f7dac36, 0xcfc7aa33),
+	    TOBN(0x2b4bb15b, 0x778e28b6), TOBN(0x77c495db, 0xe8810a5b),
+	    TOBN(0x00000000, 0x000000c5),
+	},
+	{
+	    TOBN(0x97c09104, 0x34cc823a), TOBN(0x61f6a415, 0xe5282cbd),
+	    TOBN(0x81a07bd0, 0xc71cfdeb), TOBN(0x0ba55de3, 0x1782ba89),
+	    TOBN(0x9d8ae8ac, 0x418f9bf6), TOBN(0x8409863b, 0x4fbbd3af),
+	    TOBN(0xe0359ae2, 0xa90a4965), TOBN(0xf97dd561, 0x0dc7ac38),
+	    TOBN(0x00000000, 0x00000104),
+	},
+    },
+    {
+	{
+	    TOBN(0x47993c13, 0xf2bde76e), TOBN(0x8decdd34, 0x9b912773),
+	    TOBN(0xe18ab92d, 0xd620fb42), TOBN(0x41231e1e, 0x3b33549a),
+	    TOBN(0xdb85e93e, 0x02d4e920), TOBN(0x774ef64f, 0x61f7fd3f),
+	    TOBN(0xd4042d07, 0xd8c4ba30), TOBN(0x14763697, 0x9be01143),
+	    TOBN(0x00000000, 0x0000008c),
+	},
+	{
+	    TOBN(0x79b77319, 0x7d33966d), TOBN(0x5dd97b38, 0xd0b1997b),
+	    TOBN(0xb0fe2af1, 0x769e6717), TOBN(0x41ce3185, 0x7ec2b1a4),
+	    TOBN(0x3871cf20, 0x6877a862), TOBN(0x157442ea, 0xbec05fac),
+	    TOBN(0xde2df551, 0x85cae2f3), TOBN(0x660358cd, 0xa5f50a14),
+	    TOBN(0x00000000, 0x000001e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x3fde9e77, 0x9a57e567), TOBN(0x352bb63b, 0x837d331f),
+	    TOBN(0xee538013, 0xce9486ee), TOBN(0x05482824, 0x3309889d),
+	    TOBN(0xcf7cb534, 0x1b756257), TOBN(0x496c8004, 0x2b0f0d14),
+	    TOBN(0xe77edce9, 0x58f0b91a), TOBN(0xf8e1030b, 0x89f40e18),
+	    TOBN(0x00000000, 0x00000137),
+	},
+	{
+	    TOBN(0x18897d90, 0x06277670), TOBN(0x5eee6919, 0x95c2d3bb),
+	    TOBN(0x65a2a102, 0x3b277280), TOBN(0x8ed935bc, 0xb9573aa5),
+	    TOBN(0xec432f5b, 0x741251bb), TOBN(0xb5e230ae, 0x04671b3b),
+	    TOBN(0x5f6f64c0, 0x5677b48a), TOBN(0xbabc8d5b, 0xc1578502),
+	    TOBN(0x00000000, 0x00000151),
+	},
+    },
+    {
+	{
+	    TOBN(0x5cf81f08, 0xc33c7825), TOBN(0x02324fb3, 0x9c1e606c),
+	    TOBN(0xc33263f1, 0x0cffd944), TOBN(0x49a73964, 0x1d6bb8d1),
+	    TOBN(0xcc966810, 0x0e79b392), TOBN(0xc377cead, 0xb30ba3fe),
+	    TOBN(0x99f86c2f, 0x4ae60ce0), TOBN(0x9fcefefe, 0xd01fabb1),
+	    TOBN(0x00000000, 0x00000001),
+	},
+	{
+	    TOBN(0x0e987f25, 0x25abe43f), TOBN(0xbcee7baa, 0xba92a56e),
+	    TOBN(0x02c82eca, 0x0c25fbaf), TOBN(0x24b323b1, 0x82d1b503),
+	    TOBN(0xe638dd8b, 0xb1c861a2), TOBN(0xf3ca33ab, 0xf02390dd),
+	    TOBN(0x00938302, 0xfca18ddc), TOBN(0x3efa354a, 0xbc1166d6),
+	    TOBN(0x00000000, 0x00000037),
+	},
+    },
+    {
+	{
+	    TOBN(0x5589d869, 0x90eaf1ed), TOBN(0xb84a16dd, 0x4c7659f6),
+	    TOBN(0x7b88945a, 0x791e5115), TOBN(0xafb365e2, 0xbb651ea8),
+	    TOBN(0xe18f02df, 0xfbf54b1f), TOBN(0x199f7e7d, 0x911190c6),
+	    TOBN(0x76bf82ce, 0xe72ae571), TOBN(0x83a2e4e1, 0x139582ac),
+	    TOBN(0x00000000, 0x00000071),
+	},
+	{
+	    TOBN(0x1fac403d, 0x45debfe4), TOBN(0x702e47e5, 0xa342d722),
+	    TOBN(0x048beaee, 0x8f6d96d2), TOBN(0x6951bd78, 0x19ca087c),
+	    TOBN(0x1c497373, 0x626875e4), TOBN(0x879b8b5f, 0x4305c847),
+	    TOBN(0xaf5207dd, 0xf8f7e7a9), TOBN(0xb6ddbee0, 0x4e61adc5),
+	    TOBN(0x00000000, 0x0000019f),
+	},
+    },
+    {
+	{
+	    TOBN(0x9073e703, 0x90f2dae8), TOBN(0x2c32fc73, 0x5f5f224c),
+	    TOBN(0xf9358b26, 0x1fc34d8e), TOBN(0x8f4763b2, 0xc6935b20),
+	    TOBN(0x14b20ae8, 0xb68f1dbe), TOBN(0xe9314622, 0x202bf9ad),
+	    TOBN(0x80d864f1, 0x670b0c97), TOBN(0x78bbc6f9, 0xacfeacad),
+	    TOBN(0x00000000, 0x00000191),
+	},
+	{
+	    TOBN(0x63e65686, 0x91198a18), TOBN(0x5d8b9f37, 0x48349603),
+	    TOBN(0x1e17ca76, 0xdbf19a07), TOBN(0x52945edd, 0x83ab0a72),
+	    TOBN(0x989688ba, 0x0ce3d10f), TOBN(0xb4dbbec0, 0xbe4b06b0),
+	    TOBN(0x59b3bd36, 0x473556c9), TOBN(0xc7475a43, 0xcd529c8c),
+	    TOBN(0x00000000, 0x00000033),
+	},
+    },
+    {
+	{
+	    TOBN(0xa7c39d7f, 0x483b885f), TOBN(0xa7c92239, 0xcdf02be1),
+	    TOBN(0x2899044b, 0x54a2c741), TOBN(0x06ef3446, 0x7b1d4528),
+	    TOBN(0xeaa61ff3, 0x875e5108), TOBN(0x2454de00, 0xc6df1ef3),
+	    TOBN(0xc2c56486, 0x7e8d8a87), TOBN(0xf694f039, 0xc4e06fdb),
+	    TOBN(0x00000000, 0x0000015c),
+	},
+	{
+	    TOBN(0x43779714, 0x4c071231), TOBN(0x595f7b8b, 0x513305a5),
+	    TOBN(0xc827d12b, 0xec347305), TOBN(0x3b31a5d7, 0x91ba78ac),
+	    TOBN(0xd250c682, 0x27fc7918), TOBN(0x2ce926fd, 0x75960e91),
+	    TOBN(0xe5ee2f00, 0x18b1bb16), TOBN(0xe43e87b2, 0xef6ea4da),
+	    TOBN(0x00000000, 0x00000122),
+	},
+    },
+    {
+	{
+	    TOBN(0x2868ac38, 0x981552d7), TOBN(0x8bbc400f, 0x14065305),
+	    TOBN(0x161ec3a6, 0x90e79543), TOBN(0x61a015b5, 0x9f6767dc),
+	    TOBN(0x6379e995, 0xbc422f67), TOBN(0x35425717, 0x9b7f401d),
+	    TOBN(0xd91a707c, 0x6b2ee349), TOBN(0x15dbce96, 0x35eb349b),
+	    TOBN(0x00000000, 0x000001f7),
+	},
+	{
+	    TOBN(0x44975f9a, 0xed9f5183), TOBN(0x5e159e42, 0xfea5a905),
+	    TOBN(0x7998f118, 0x96a22b50), TOBN(0xfa16c201, 0x39ab2af8),
+	    TOBN(0x2a33479f, 0xac4b27d9), TOBN(0x4167291f, 0xb3ffbf31),
+	    TOBN(0x9040f14c, 0xde7e7db4), TOBN(0x152a5fc1, 0xe5e085d4),
+	    TOBN(0x00000000, 0x000000e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x68a4190e, 0x6934bc36), TOBN(0x4f2e504c, 0x335b8486),
+	    TOBN(0xe6fe2d7e, 0x587cf9d0), TOBN(0xa7693140, 0x9f756d73),
+	    TOBN(0x14fcaeef, 0x83d50774), TOBN(0x5487aaf6, 0xac606245),
+	    TOBN(0xd4601e8d, 0x7949c789), TOBN(0x17c113a8, 0x3c5ce0c0),
+	    TOBN(0x00000000, 0x00000016),
+	},
+	{
+	    TOBN(0x3f493a60, 0x2f19069a), TOBN(0x7439f5e2, 0x6bd06996),
+	    TOBN(0xc55d61d1, 0x3eb30057), TOBN(0x80080fe5, 0xdf418a0d),
+	    TOBN(0x643f8a28, 0x01a3b8fd), TOBN(0x79f3ca32, 0x71aac158),
+	    TOBN(0xba9e8a0d, 0xd103a7a5), TOBN(0xacf6fb4f, 0xd2bf2470),
+	    TOBN(0x00000000, 0x000000d9),
+	},
+    },
+    {
+	{
+	    TOBN(0x06d76342, 0x53ae4089), TOBN(0xe6459e95, 0x86c60b28),
+	    TOBN(0x892cdde9, 0x2ea8c30b), TOBN(0x7baa234a, 0xdce6b6c9),
+	    TOBN(0xa34d6aff, 0x0461b942), TOBN(0xbd4ded57, 0xa6fe92a0),
+	    TOBN(0x42b7901f, 0x0c3eed6b), TOBN(0xa3753c82, 0x5aa4b214),
+	    TOBN(0x00000000, 0x00000011),
+	},
+	{
+	    TOBN(0x256483b2, 0x459b2510), TOBN(0xa3021fe5, 0xb69c6995),
+	    TOBN(0x18e29e4b, 0x0608df27), TOBN(0x81479507, 0x68dc0af6),
+	    TOBN(0x30037184, 0x2f870bdd), TOBN(0x09814795, 0xc7aa0252),
+	    TOBN(0xe39e6b4b, 0xd5ef4417), TOBN(0xddbfda39, 0xa240412e),
+	    TOBN(0x00000000, 0x000000d4),
+	},
+    },
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x225256fd, 0xb79711e5), TOBN(0xbdcf3433, 0xa6a843b7),
+	    TOBN(0xbd3d4548, 0x414a71ab), TOBN(0x2e13fd39, 0xe29e7606),
+	    TOBN(0x194b6e92, 0xe07f29c4), TOBN(0xd6f5e492, 0xb68fd0d2),
+	    TOBN(0x3ac64998, 0x5de0ae9b), TOBN(0x10e5afe9, 0x4e5ba961),
+	    TOBN(0x00000000, 0x000001f7),
+	},
+	{
+	    TOBN(0x27df3c4b, 0x8ec9ccff), TOBN(0xdb291372, 0x2a7b0a2b),
+	    TOBN(0x1ca89222, 0xf045afde), TOBN(0xa666763c, 0x69c99247),
+	    TOBN(0xd8d9f6b1, 0x99033177), TOBN(0x10b696f6, 0x90eca082),
+	    TOBN(0x41991d66, 0x0d180f50), TOBN(0x7cee7f9b, 0x82d6f6bc),
+	    TOBN(0x00000000, 0x000001df),
+	},
+    },
+    {
+	{
+	    TOBN(0xc4387644, 0x9d2224b8), TOBN(0x80c92ac5, 0x563094e8),
+	    TOBN(0xef919bdb, 0xf6d0542e), TOBN(0xc71a882d, 0x5c40a787),
+	    TOBN(0xdb3851be, 0x0880c1b1), TOBN(0x4f72ff0c, 0x287cae73),
+	    TOBN(0x0a628f17, 0x2bf3efe6), TOBN(0x29db6924, 0x0150e4a7),
+	    TOBN(0x00000000, 0x00000175),
+	},
+	{
+	    TOBN(0x7983f80a, 0xcc367287), TOBN(0xfe2c8f3d, 0xc4633183),
+	    TOBN(0x41b0e222, 0xae89f8c9), TOBN(0x93fdd59b, 0xeb58ac1e),
+	    TOBN(0x5ee164c7, 0x97538725), TOBN(0xb8e3b75b, 0x7591fb4e),
+	    TOBN(0xa2d0fa2e, 0x355a6a6c), TOBN(0x391a0554, 0x0405f33a),
+	    TOBN(0x00000000, 0x000000e6),
+	},
+    },
+    {
+	{
+	    TOBN(0xc4e95f91, 0xd3c21303), TOBN(0x1d081667, 0x507ab363),
+	    TOBN(0x2d0d08ec, 0x54bfa44b), TOBN(0x1b335513, 0x0134a552),
+	    TOBN(0xf4b9be3a, 0x4e134ee7), TOBN(0x98cf7bf3, 0x7868ba98),
+	    TOBN(0xd4946eab, 0x65b218a6), TOBN(0xd9ce9d4f, 0x1099f31a),
+	    TOBN(0x00000000, 0x0000003d),
+	},
+	{
+	    TOBN(0x894b56e8, 0xd5a0e6e0), TOBN(0xe335e648, 0x9e4c68b9),
+	    TOBN(0x0a786946, 0x6fd96f82), TOBN(0x2ef6aa5a, 0x492145e6),
+	    TOBN(0x58ed4c80, 0xde5012e0), TOBN(0x26941e6e, 0x12b958ba),
+	    TOBN(0x4a1d1067, 0xc02482c7), TOBN(0xcc7ac7b0, 0x246bb28a),
+	    TOBN(0x00000000, 0x00000196),
+	},
+    },
+    {
+	{
+	    TOBN(0x55417ffa, 0x525abf32), TOBN(0x1ff40e16, 0x78067dfc),
+	    TOBN(0x431a0ae1, 0x2795ea6a), TOBN(0xc3de691c, 0xef54c597),
+	    TOBN(0x60a0c51b, 0x95f9d2bb), TOBN(0x30840ca9, 0x82772f1a),
+	    TOBN(0xddaf4604, 0x96eb0344), TOBN(0x03a9f6f4, 0x8615d783),
+	    TOBN(0x00000000, 0x00000035),
+	},
+	{
+	    TOBN(0x74598cb2, 0x33edcfa4), TOBN(0xbb866bc9, 0xde9dccde),
+	    TOBN(0x0c483116, 0x2a673bb2), TOBN(0x3eddd388, 0xfee306a7),
+	    TOBN(0x8785a002, 0xc80eb5b9), TOBN(0xe2bd81f7, 0x1937371f),
+	    TOBN(0x50164859, 0x5684a105), TOBN(0xf0f3fdde, 0x1f26e0db),
+	    TOBN(0x00000000, 0x00000119),
+	},
+    },
+    {
+	{
+	    TOBN(0xbf89ad88, 0x7c3c8162), TOBN(0xe58416ce, 0xd1c7d9de),
+	    TOBN(0x32d95903, 0xa8be6602), TOBN(0x15472d52, 0xe81c9d96),
+	    TOBN(0x94ec396e, 0x30135b96), TOBN(0xad54bb6d, 0x1afc1aad),
+	    TOBN(0xdc73e452, 0x5b70ae01), TOBN(0xd57f0416, 0xe967c072),
+	    TOBN(0x00000000, 0x00000044),
+	},
+	{
+	    TOBN(0xc2374e88, 0xe75f620d), TOBN(0x76a90652, 0x3954d8ab),
+	    TOBN(0x2fcb5daf, 0xf417c7f5), TOBN(0x41ef1145, 0x5bb65626),
+	    TOBN(0xba526e56, 0xc19b0730), TOBN(0x5d0268ce, 0x6145c45e),
+	    TOBN(0x3f2f82b8, 0x0d6a6cbd), TOBN(0x2f9bcadc, 0xfe45e7b9),
+	    TOBN(0x00000000, 0x00000173),
+	},
+    },
+    {
+	{
+	    TOBN(0xb19ab118, 0x5d1df560), TOBN(0x75f9daa3, 0x59c37d59),
+	    TOBN(0xd58a67c1, 0x24d7cb86), TOBN(0x1b9a2373, 0xbe7dca65),
+	    TOBN(0xe28942f0, 0x76b81a39), TOBN(0x2a8e4290, 0x6797efbf),
+	    TOBN(0x1cddb4dc, 0x8b806c08), TOBN(0x790ece1c, 0xcc8297a3),
+	    TOBN(0x00000000, 0x0000002f),
+	},
+	{
+	    TOBN(0xdb217f86, 0x0d70a819), TOBN(0xeaa76d2a, 0x11023e8d),
+	    TOBN(0x543c55a7, 0x1d5d298d), TOBN(0xa67f1eef, 0x9070f595),
+	    TOBN(0xba941ff0, 0x64673e5b), TOBN(0xe994a2f2, 0x4a9a3db1),
+	    TOBN(0x44c1bb3b, 0xadb80b71), TOBN(0x617f209f, 0x494720fb),
+	    TOBN(0x00000000, 0x0000010d),
+	},
+    },
+    {
+	{
+	    TOBN(0xbc388b29, 0xefff9cc9), TOBN(0x4a308a63, 0xb71fc6e5),
+	    TOBN(0x298473e1, 0x3545a88f), TOBN(0x3bd9e1e2, 0x8dd33b18),
+	    TOBN(0xeba7cbd4, 0xe159519d), TOBN(0x57ab635f, 0xc7bb8fe4),
+	    TOBN(0xbf8d899e, 0xcd9e47de), TOBN(0x2279f8ce, 0x4da880be),
+	    TOBN(0x00000000, 0x0000014d),
+	},
+	{
+	    TOBN(0x4d309b7a, 0x9c625ec1), TOBN(0x31fbc402, 0x212537e3),
+	    TOBN(0x40776284, 0x56788032), TOBN(0xe2e09beb, 0x1cbf0c85),
+	    TOBN(0x913885a0, 0x24ffc24b), TOBN(0x4cdcd2c0, 0x56b265e4),
+	    TOBN(0xf242c2dc, 0x259a2179), TOBN(0xfc4a6a38, 0x4c98f545),
+	    TOBN(0x00000000, 0x000001bf),
+	},
+    },
+    {
+	{
+	    TOBN(0x7d6e4240, 0x4e1080a4), TOBN(0x5cf6c427, 0xe1adb078),
+	    TOBN(0xe74ec603, 0x3d594e28), TOBN(0xc0185404, 0xbdf853f2),
+	    TOBN(0x287d94de, 0xc3335717), TOBN(0xf735656a, 0xc3179807),
+	    TOBN(0xd356f2bf, 0x604e93f7), TOBN(0xb1fdc2f2, 0xcbe27815),
+	    TOBN(0x00000000, 0x00000151),
+	},
+	{
+	    TOBN(0x7b17e356, 0xda1d3ea1), TOBN(0x0ed57d7e, 0xa7af9610),
+	    TOBN(0x4a6ac3e5, 0x3ae89c0e), TOBN(0xc8f722b8, 0x5f82b4a3),
+	    TOBN(0x453d5a4a, 0x7f0850fa), TOBN(0xd6f79d23, 0x7b3ac4a3),
+	    TOBN(0xe1c9dfc2, 0x0dbae800), TOBN(0x56e4f0f5, 0xc4b9258e),
+	    TOBN(0x00000000, 0x000001ca),
+	},
+    },
+    {
+	{
+	    TOBN(0xc7de77e1, 0x31752de8), TOBN(0xf35fc723, 0xba64df55),
+	    TOBN(0x24ffd503, 0xa81b220a), TOBN(0xfa67b73e, 0x93578fca),
+	    TOBN(0xb22cdb53, 0x74969400), TOBN(0xe85fb3fe, 0x1b2b7d1e),
+	    TOBN(0x888d548e, 0xe2bfb9fb), TOBN(0xb5630819, 0x08e01162),
+	    TOBN(0x00000000, 0x0000006b),
+	},
+	{
+	    TOBN(0x1ec394ac, 0xbff5f49b), TOBN(0x9c83f45f, 0x8af956d9),
+	    TOBN(0xba74f23f, 0xdf893bb0), TOBN(0x73baf65d, 0x45a7cf13),
+	    TOBN(0x6eab2247, 0xa0763e86), TOBN(0x97400e6d, 0x4140c7b3),
+	    TOBN(0x38295c48, 0x42bdab45), TOBN(0x988832ff, 0x02cd897d),
+	    TOBN(0x00000000, 0x000000f9),
+	},
+    },
+    {
+	{
+	    TOBN(0x5f420541, 0x35da448a), TOBN(0x9318ef62, 0x066a90be),
+	    TOBN(0x21b3ce3b, 0x82fe4b18), TOBN(0x3442eb03, 0x9b55ca2a),
+	    TOBN(0x114494d2, 0xf165abac), TOBN(0x8f556373, 0xab815ae4),
+	    TOBN(0xf9a8c005, 0xde8e0f34), TOBN(0x28ffa49b, 0x5821c9ad),
+	    TOBN(0x00000000, 0x000000a8),
+	},
+	{
+	    TOBN(0xafb501cd, 0xb8a9478b), TOBN(0x7200dd63, 0x1617d197),
+	    TOBN(0x39b8433b, 0x8fd2d128), TOBN(0x17d0f74f, 0xa369c4bf),
+	    TOBN(0xd521d2e1, 0x93fa84ad), TOBN(0x55aa019c, 0x50702310),
+	    TOBN(0x997a2b3a, 0x4728ccc4), TOBN(0xcb99b219, 0xc3e6e217),
+	    TOBN(0x00000000, 0x00000136),
+	},
+    },
+    {
+	{
+	    TOBN(0xb730b23d, 0x732881ba), TOBN(0xbd073b36, 0x766b43f1),
+	    TOBN(0x7a384fe6, 0x62d3f423), TOBN(0x33b925ca, 0xe9d1242f),
+	    TOBN(0x0ca73071, 0xd0318479), TOBN(0x69ee382b, 0x10d81c0c),
+	    TOBN(0x54b03ec1, 0x86cd5f80), TOBN(0x842d372f, 0xedf94514),
+	    TOBN(0x00000000, 0x000000a9),
+	},
+	{
+	    TOBN(0x44a4be71, 0xa3efbd4d), TOBN(0x66d2523c, 0x034f785f),
+	    TOBN(0x9bde302e, 0x0bd93333), TOBN(0xe262b790, 0x3a53187a),
+	    TOBN(0xab1b1334, 0xd593b947), TOBN(0xf9156af3, 0xc8565376),
+	    TOBN(0xcbc2c0e0, 0xd8460fb9), TOBN(0xcf013168, 0x77c79e9c),
+	    TOBN(0x00000000, 0x000000ed),
+	},
+    },
+    {
+	{
+	    TOBN(0x6831d7f8, 0x564313c7), TOBN(0xca0c1ffa, 0x30940c65),
+	    TOBN(0x549b2ace, 0x9f8a9fe7), TOBN(0xb2e3b4f9, 0xae4b09d1),
+	    TOBN(0xfae4dac9, 0x9b17c47e), TOBN(0x4106643d, 0xa44830d2),
+	    TOBN(0xed0f710a, 0xf9be8d7b), TOBN(0x708099c5, 0xd11891f0),
+	    TOBN(0x00000000, 0x00000179),
+	},
+	{
+	    TOBN(0x23d52c6c, 0x6c58670c), TOBN(0xfe8f21ad, 0xc50a6680),
+	    TOBN(0xd88be639, 0x2446441d), TOBN(0x3d4a5560, 0xa7a42571),
+	    TOBN(0x5a7dbe9f, 0x11bcaa3b), TOBN(0x1effa3a7, 0x65b34274),
+	    TOBN(0xdef68443, 0xd74cc197), TOBN(0x7ff43f3d, 0xac98a8ce),
+	    TOBN(0x00000000, 0x00000005),
+	},
+    },
+    {
+	{
+	    TOBN(0x79816a6f, 0xa19bada5), TOBN(0x98f21067, 0x55f8890a),
+	    TOBN(0x3f3ea45d, 0x9c57ea1f), TOBN(0x478b34b3, 0x22851683),
+	    TOBN(0x582db3e7, 0x2b646176), TOBN(0x42b0f343, 0x66cd5cc0),
+	    TOBN(0x7dfdaddb, 0x84915506), TOBN(0x3eb638ac, 0x22f5c469),
+	    TOBN(0x00000000, 0x00000110),
+	},
+	{
+	    TOBN(0x89292a1b, 0x8df5ec4e), TOBN(0x7527546a, 0xf48c92a5),
+	    TOBN(0x571341fc, 0xf07deb65), TOBN(0xd410e28e, 0xae17e0e5),
+	    TOBN(0xb26d187e, 0xa92d67d6), TOBN(0x2ef7d5ab, 0xb121ae96),
+	    TOBN(0xe3886c32, 0xbb177938), TOBN(0xe5044734, 0x2ca5d1a6),
+	    TOBN(0x00000000, 0x0000008b),
+	},
+    },
+    {
+	{
+	    TOBN(0xf62b1426, 0x8f2a04be), TOBN(0x7f97b053, 0x85a183e7),
+	    TOBN(0x4fad00f7, 0x0c1976c2), TOBN(0xe45d6be8, 0x6a4c4a76),
+	    TOBN(0xe760db2a, 0x40817929), TOBN(0x8b70c8b1, 0xc6e09ed6),
+	    TOBN(0xac65b639, 0x258afa31), TOBN(0xe7056bff, 0xa6da688d),
+	    TOBN(0x00000000, 0x00000015),
+	},
+	{
+	    TOBN(0x1be4f5f9, 0x3f178bf6), TOBN(0xad0ccec0, 0x7ede6c16),
+	    TOBN(0xf7d28695, 0x5eae48d5), TOBN(0xd7b67edf, 0x2b86c624),
+	    TOBN(0xec3c9266, 0x996a9355), TOBN(0xe6e1e95d, 0x4053330c),
+	    TOBN(0xe019e086, 0x74fe7d22), TOBN(0xf3647ded, 0x10c1f41b),
+	    TOBN(0x00000000, 0x00000024),
+	},
+    },
+    {
+	{
+	    TOBN(0x2bf43c35, 0xe34b9dc8), TOBN(0x0c01155c, 0x3a8e920b),
+	    TOBN(0x64cc98ac, 0xd92cddc6), TOBN(0x35f60412, 0x8f260ddf),
+	    TOBN(0xfe1201ba, 0x361457fe), TOBN(0xea6f5cb2, 0xa9aa54c1),
+	    TOBN(0x8230bded, 0xc53ac4f0), TOBN(0x92c3693c, 0xf366acdb),
+	    TOBN(0x00000000, 0x0000002e),
+	},
+	{
+	    TOBN(0x366a493c, 0x939e7a58), TOBN(0xf90ad5d1, 0xe5a1566b),
+	    TOBN(0xe7a8bdff, 0xdd1b40c5), TOBN(0x00b9bda8, 0xe7ac0868),
+	    TOBN(0x0d0ce6af, 0xfa76aeb4), TOBN(0x561cece0, 0x85d13dfe),
+	    TOBN(0x6cbec84a, 0xd0afab94), TOBN(0x7c2990d4, 0x693b8cf0),
+	    TOBN(0x00000000, 0x00000089),
+	},
+    },
+    {
+	{
+	    TOBN(0x2fafc73f, 0x189a0360), TOBN(0xe08428f1, 0xa68509e8),
+	    TOBN(0x4700e3eb, 0x3a2af597), TOBN(0x143c0bf1, 0x4b298188),
+	    TOBN(0x9fb03775, 0xf0b9b8f6), TOBN(0x7c9e5a3a, 0x2653d193),
+	    TOBN(0x41109c62, 0xd1f8ab93), TOBN(0x8ad7cb71, 0x434536b8),
+	    TOBN(0x00000000, 0x00000073),
+	},
+	{
+	    TOBN(0x82c43b2d, 0xaa844edd), TOBN(0xad5be7ac, 0x3cafb62d),
+	    TOBN(0x8dd99c5b, 0x4a5b4b0c), TOBN(0x2a11dc41, 0x31c113aa),
+	    TOBN(0xe62332e9, 0x3390e968), TOBN(0xa912cdea, 0x4b073b39),
+	    TOBN(0xbb0b8141, 0xbc11cb2c), TOBN(0x504272d1, 0xc9dca239),
+	    TOBN(0x00000000, 0x0000007f),
+	},
+    },
+    {
+	{
+	    TOBN(0xe552a04a, 0x94c22c36), TOBN(0xde5fa5c2, 0x6f9e6297),
+	    TOBN(0x1ffdb66a, 0xb452828f), TOBN(0x24771bd0, 0x16267372),
+	    TOBN(0x84cd50ac, 0x9c34cfe1), TOBN(0x6d70e86e, 0xe622a0eb),
+	    TOBN(0x975ec554, 0xb2d24f67), TOBN(0xa0dbabb3, 0x1d9db38d),
+	    TOBN(0x00000000, 0x00000030),
+	},
+	{
+	    TOBN(0xbfd41780, 0xaffe402a), TOBN(0xe5c5c813, 0xd9e04366),
+	    TOBN(0xe1887e7c, 0x8d1e290a), TOBN(0xf96aeb47, 0xbbc07ff2),
+	    TOBN(0x7228265c, 0xef6adff7), TOBN(0x05717108, 0x47e0f7db),
+	    TOBN(0x3323b897, 0x53339ec7), TOBN(0x1a205251, 0x9a2426de),
+	    TOBN(0x00000000, 0x0000006a),
+	},
+    },
+    {
+	{
+	    TOBN(0xd477d077, 0x33dca8cc), TOBN(0x8935d044, 0xd13f699c),
+	    TOBN(0xfb097f21, 0x2e92b833), TOBN(0xf5f53fa2, 0x419b56ab),
+	    TOBN(0xdec7f4ba, 0xe0f175cf), TOBN(0x629fb05a, 0xcfc34dde),
+	    TOBN(0x305bdad2, 0x3dfb7bf2), TOBN(0xccdf4cf9, 0xdc30e1f9),
+	    TOBN(0x00000000, 0x00000190),
+	},
+	{
+	    TOBN(0x4552311e, 0x453a115d), TOBN(0x143d23a7, 0xc11fee54),
+	    TOBN(0x80efa23f, 0x42a28d07), TOBN(0x9a3551f2, 0x2384aa48),
+	    TOBN(0x7e51fc0f, 0xf406b55c), TOBN(0xf72fe5cf, 0xc960a7d0),
+	    TOBN(0x86b7e982, 0x3f758ace), TOBN(0x79950dc3, 0xb6af0e74),
+	    TOBN(0x00000000, 0x000000fa),
+	},
+    },
+    {
+	{
+	    TOBN(0x0c104b68, 0x91b7a42b), TOBN(0x059b8e37, 0x9376d113),
+	    TOBN(0x3a965ff1, 0xd008f97f), TOBN(0xe8fff59d, 0x8d9425c2),
+	    TOBN(0x2e70d12d, 0x8f7f5f4b), TOBN(0x0db4ab86, 0x1a212720),
+	    TOBN(0x142247fe, 0x5941fb93), TOBN(0xbdcc543e, 0xae64eb3d),
+	    TOBN(0x00000000, 0x00000012),
+	},
+	{
+	    TOBN(0x3b71f091, 0x603d5698), TOBN(0xffb5d2a0, 0x170f5d2c),
+	    TOBN(0x607e124f, 0x1fd33437), TOBN(0x7bd2ebfc, 0x06583d96),
+	    TOBN(0x84241d11, 0x0c1f432d), TOBN(0x0ed2cddb, 0x8a6ba576),
+	    TOBN(0x265da44a, 0x91dc47e3), TOBN(0x2102b5d4, 0xfce378da),
+	    TOBN(0x00000000, 0x000001ef),
+	},
+    },
+    {
+	{
+	    TOBN(0x37fc3577, 0x29a135f1), TOBN(0x6801e7ec, 0xf0b7fee5),
+	    TOBN(0x2108f1a8, 0x64d812e3), TOBN(0x1a434b4b, 0x40e15783),
+	    TOBN(0x5c7c39c4, 0x7e4d05f5), TOBN(0xa2d2b197, 0xdfc24630),
+	    TOBN(0x8fc9af2e, 0x9c574535), TOBN(0xd9425aca, 0xf173f20c),
+	    TOBN(0x00000000, 0x00000005),
+	},
+	{
+	    TOBN(0xd363a937, 0x2fc8b709), TOBN(0x524aaa5d, 0x3a437d6f),
+	    TOBN(0x48775ae3, 0xa4940210), TOBN(0x740e3b49, 0x5460c5fa),
+	    TOBN(0xa2a875f4, 0xbdc86411), TOBN(0x2ead157b, 0x68d2efe6),
+	    TOBN(0x05423a91, 0xaea36a27), TOBN(0x4f7d8955, 0xf2a5e845),
+	    TOBN(0x00000000, 0x000001e3),
+	},
+    },
+    {
+	{
+	    TOBN(0x47df3ff2, 0x32436a36), TOBN(0xd2abfebd, 0xeb65b884),
+	    TOBN(0x2b6a967c, 0xfe5f98ca), TOBN(0x0e51bacd, 0xb7d9deaa),
+	    TOBN(0xb9e43b56, 0x1ecd8b64), TOBN(0x50f926b5, 0x8cf02a2b),
+	    TOBN(0x0436e7a9, 0x9e40da70), TOBN(0x358c113c, 0xca742ce2),
+	    TOBN(0x00000000, 0x0000004c),
+	},
+	{
+	    TOBN(0x0d4c266c, 0x38f08f19), TOBN(0x14cf8d38, 0x7fa7c5ca),
+	    TOBN(0xd23eb2cf, 0x56263251), TOBN(0xa4101a11, 0x4951562a),
+	    TOBN(0xa771c64a, 0x360a204c), TOBN(0xab654ac1, 0x1fd6de0b),
+	    TOBN(0x559a2c25, 0xbb98a94a), TOBN(0x8aff56f6, 0x14525eb2),
+	    TOBN(0x00000000, 0x000000d5),
+	},
+    },
+    {
+	{
+	    TOBN(0x310fbb44, 0x08ead548), TOBN(0x62c67ca6, 0x5b8eab0c),
+	    TOBN(0x5b27db84, 0x8cd56307), TOBN(0xb6a1ade3, 0x2fe3047f),
+	    TOBN(0x84eb8027, 0x2789e93d), TOBN(0x03b0dbc6, 0xfd2f981d),
+	    TOBN(0x4a574866, 0xda8c85dd), TOBN(0xcff6c637, 0xd89aa8aa),
+	    TOBN(0x00000000, 0x0000002f),
+	},
+	{
+	    TOBN(0x4fa03bb2, 0x0b615c7b), TOBN(0xac6cb79f, 0x9ddaa93b),
+	    TOBN(0xc1741c47, 0xe48fca26), TOBN(0x6e8b5eef, 0x649391d4),
+	    TOBN(0x9badb868, 0xa05f4e29), TOBN(0x84ef5184, 0x82ff651f),
+	    TOBN(0xad8c7a3f, 0x8be9ad52), TOBN(0xefa52c01, 0xf424dee4),
+	    TOBN(0x00000000, 0x000000a5),
+	},
+    },
+    {
+	{
+	    TOBN(0xd996af77, 0x51eb951e), TOBN(0x52041be0, 0x8a1a2df7),
+	    TOBN(0xff9c810a, 0xa3f1482d), TOBN(0xe26673d5, 0x93febf78),
+	    TOBN(0x94525ad0, 0x1b252406), TOBN(0x22e48182, 0x46bbdd27),
+	    TOBN(0xfb1aea6a, 0x8db8e225), TOBN(0x1ad23b7a, 0x07cf96cf),
+	    TOBN(0x00000000, 0x00000045),
+	},
+	{
+	    TOBN(0x2351c631, 0x58f9f62e), TOBN(0x719d2e7e, 0x55a83d7c),
+	    TOBN(0x98dc46cc, 0xf0da82eb), TOBN(0x264e6b3c, 0x85530b2c),
+	    TOBN(0xd75d3dd0, 0xe53579a0), TOBN(0xb64bf074, 0x6e7f991e),
+	    TOBN(0x8fb53722, 0x4f47e961), TOBN(0xf290d405, 0x160ed726),
+	    TOBN(0x00000000, 0x00000035),
+	},
+    },
+    {
+	{
+	    TOBN(0x3f363ed5, 0x81babbe3), TOBN(0xd643ab9a, 0x98edd3d7),
+	    TOBN(0x1bfd75f7, 0x56818f7f), TOBN(0x3cabc186, 0x7b1436cb),
+	    TOBN(0x8edfb72d, 0xc793accc), TOBN(0xa7f74dd0, 0xb0603ad0),
+	    TOBN(0x565f60da, 0x2e71df76), TOBN(0x94b480a8, 0x7823b32a),
+	    TOBN(0x00000000, 0x000000ed),
+	},
+	{
+	    TOBN(0x73df6f44, 0xf9d095e5), TOBN(0xaf95c85f, 0xb9b3df1c),
+	    TOBN(0x9523f447, 0xa4403205), TOBN(0x699d1d59, 0x385a974a),
+	    TOBN(0x41b070cd, 0xb57f0d6f), TOBN(0x17fed468, 0x14f5cf39),
+	    TOBN(0x5fe3a784, 0x6c720d3e), TOBN(0xcef875ac, 0xa3621a23),
+	    TOBN(0x00000000, 0x000001ef),
+	},
+    },
+    {
+	{
+	    TOBN(0xc5241e0a, 0x285c54fd), TOBN(0x0fd64167, 0x729fd7cb),
+	    TOBN(0xd9b24e3b, 0x4051b863), TOBN(0x98b87715, 0x1ac84a13),
+	    TOBN(0x59e3e470, 0x38264deb), TOBN(0x26780535, 0x20215aad),
+	    TOBN(0x3a48bd92, 0x4253643e), TOBN(0x190b3ec9, 0x646331bd),
+	    TOBN(0x00000000, 0x00000065),
+	},
+	{
+	    TOBN(0xc002dc29, 0x196e9438), TOBN(0x1599f851, 0xc930e02d),
+	    TOBN(0x3dd0bc48, 0x69c4be2f), TOBN(0x3968429d, 0x8651c9b4),
+	    TOBN(0xbc96ce54, 0x52608c8e), TOBN(0x0388f4e5, 0xd231f00a),
+	    TOBN(0xb74f2419, 0xb83312a2), TOBN(0xb039b5c0, 0x625531d2),
+	    TOBN(0x00000000, 0x00000087),
+	},
+    },
+    {
+	{
+	    TOBN(0xf53137c8, 0x5d0dc224), TOBN(0xbeba7ccd, 0x3e8cda48),
+	    TOBN(0x2332cdf4, 0x0945b3de), TOBN(0xdf4ec286, 0xa2e74f77),
+	    TOBN(0xfa171497, 0x7de856bd), TOBN(0x1da30ca4, 0x3b2c658f),
+	    TOBN(0xeb46d8fa, 0x02d9ce6e), TOBN(0x10ca5e89, 0x0f4807d6),
+	    TOBN(0x00000000, 0x0000010c),
+	},
+	{
+	    TOBN(0xf3a0def0, 0x73126131), TOBN(0x24fc2a2b, 0x253bbe98),
+	    TOBN(0x010480a8, 0x26432498), TOBN(0x9daa4bde, 0xbd8324b3),
+	    TOBN(0xc6697eff, 0x6d49e170), TOBN(0x6d9baabc, 0x02071300),
+	    TOBN(0x411b3319, 0xfd517711), TOBN(0xecc67695, 0x5163b9a2),
+	    TOBN(0x00000000, 0x000000ee),
+	},
+    },
+    {
+	{
+	    TOBN(0x3576a473, 0x11b1d17f), TOBN(0x6bb0e7ae, 0x33047ee7),
+	    TOBN(0xea4d2962, 0x69b34b5f), TOBN(0x8fff59dc, 0x9b261544),
+	    TOBN(0x015c6b30, 0xae498ad5), TOBN(0x1a43db62, 0x9501b64a),
+	    TOBN(0xa7fed727, 0xe071f636), TOBN(0x78e99bbf, 0x871401e5),
+	    TOBN(0x00000000, 0x0000018b),
+	},
+	{
+	    TOBN(0x622bd054, 0x56d1473c), TOBN(0xd939b490, 0x50f3b496),
+	    TOBN(0xc736778c, 0x03bc0ce3), TOBN(0xe03c725b, 0x5e73a934),
+	    TOBN(0xf6fcb280, 0x4ef26872), TOBN(0xdc7c7ddb, 0x13703b00),
+	    TOBN(0x2757322d, 0x7bbfcefa), TOBN(0x3b302196, 0x6a3c54ca),
+	    TOBN(0x00000000, 0x000001f4),
+	},
+    },
+    {
+	{
+	    TOBN(0x1251def7, 0xe650f267), TOBN(0xb9ac4faa, 0x6c45341b),
+	    TOBN(0x86cb1515, 0x0fc6b530), TOBN(0x1b27f200, 0x66be655d),
+	    TOBN(0x6bb39164, 0x59f0c78e), TOBN(0x95e505e1, 0x3396324c),
+	    TOBN(0xafa8dfeb, 0x1fe3fe95), TOBN(0x3376de73, 0x1a1401c8),
+	    TOBN(0x00000000, 0x000000e9),
+	},
+	{
+	    TOBN(0xcd096667, 0xacffa8b1), TOBN(0x29577d72, 0xac4e6399),
+	    TOBN(0xc3e20b55, 0x1f510eee), TOBN(0xe305235d, 0xecf547d2),
+	    TOBN(0x74c724ce, 0x805e89f3), TOBN(0xcc05c647, 0x4227d606),
+	    TOBN(0xe9a90305, 0x2db52516), TOBN(0x3ca1eaab, 0xd81ee73a),
+	    TOBN(0x00000000, 0x0000015b),
+	},
+    },
+    {
+	{
+	    TOBN(0x6da58b5a, 0x8bf7cff0), TOBN(0x4dad236e, 0xc052a841),
+	    TOBN(0x31270f40, 0x234b09a2), TOBN(0x4803bd2d, 0x99f64707),
+	    TOBN(0xafd40d10, 0xa097f172), TOBN(0x561a6d44, 0xccde9c55),
+	    TOBN(0xe1e51197, 0x18ed91c3), TOBN(0x4fe8588c, 0xfa8b734c),
+	    TOBN(0x00000000, 0x0000011b),
+	},
+	{
+	    TOBN(0xfa324849, 0x3cee88a6), TOBN(0x936c6e64, 0xb903dd11),
+	    TOBN(0x3eee8252, 0x566883da), TOBN(0x7a4428e3, 0x67adbe74),
+	    TOBN(0xb3dabda5, 0x1c03ff53), TOBN(0x3890d26a, 0xfed404ff),
+	    TOBN(0x1ffc1a95, 0x64958bb7), TOBN(0x2c28614c, 0x0ca6e303),
+	    TOBN(0x00000000, 0x00000123),
+	},
+    },
+    {
+	{
+	    TOBN(0xef3fbe68, 0x362820b5), TOBN(0x09e1ea9c, 0xd96e3767),
+	    TOBN(0x198aa81b, 0x9f854421), TOBN(0x14b48a57, 0xcdd60866),
+	    TOBN(0x87f706a6, 0x55fffb82), TOBN(0xf7015c81, 0xebf83284),
+	    TOBN(0x23a2e279, 0x295877b4), TOBN(0x06e4be92, 0xd6dba340),
+	    TOBN(0x00000000, 0x000001c2),
+	},
+	{
+	    TOBN(0x2f298108, 0x977bee11), TOBN(0x3009d530, 0x80c001ee),
+	    TOBN(0x255611d9, 0x0ac57bd8), TOBN(0xd61930bd, 0x0fd6965d),
+	    TOBN(0xacb7b6a0, 0x310003c2), TOBN(0x0688996c, 0x5dfaa8de),
+	    TOBN(0xf65b691f, 0xaae1c4e7), TOBN(0x6c935c1d, 0xf81e4851),
+	    TOBN(0x00000000, 0x0000014b),
+	},
+    },
+    {
+	{
+	    TOBN(0x2c836f76, 0xf8226d70), TOBN(0x6bad10f3, 0x8924f1fe),
+	    TOBN(0x5df3795c, 0xb1cfe61e), TOBN(0x48cf2fef, 0x6bafa4a1),
+	    TOBN(0xc8d6adcd, 0xf7f55a4e), TOBN(0x83e302da, 0x407549d3),
+	    TOBN(0x5dda3408, 0x06e0f4b0), TOBN(0x303263b9, 0x9638ae2f),
+	    TOBN(0x00000000, 0x00000118),
+	},
+	{
+	    TOBN(0xa4c6085e, 0x0e37ac4e), TOBN(0x5f954f69, 0xa6c5b807),
+	    TOBN(0x9e2fe25c, 0x4beaca57), TOBN(0x37990b4e, 0x1bad1e46),
+	    TOBN(0x6f4d7feb, 0x04a86876), TOBN(0xfba42029, 0xffadc604),
+	    TOBN(0x7aa805f9, 0x50784104), TOBN(0x084f5ba2, 0xadca2a69),
+	    TOBN(0x00000000, 0x0000012b),
+	},
+    },
+};
+static const BN_ULONG
+ec_comb_p521_offset[2][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0xd4bc2e48, 0x463661f9), TOBN(0xc0e64ee6, 0x2cb9aaf5),
+	    TOBN(0x0431d6ac, 0x9dfc50b0), TOBN(0x87babfa4, 0xffb58333),
+	    TOBN(0x558c25ab, 0x5a55a639), TOBN(0x9c705c66, 0xed9ac9a1),
+	    TOBN(0x086ee421, 0x99097b18), TOBN(0x8b819503, 0x68c7840e),
+	    TOBN(0x00000000, 0x000000c4),
+	},
+	{
+	    TOBN(0x1a17ba66, 0x771d0988), TOBN(0xea0fb214, 0x98d8da67),
+	    TOBN(0x09b55b65, 0x8b1dea83), TOBN(0x02e7707f, 0x7886eed2),
+	    TOBN(0x78c51ad6, 0x99ba8944), TOBN(0xe572cad8, 0x09b5ac22),
+	    TOBN(0xebcc5225, 0x288ead50), TOBN(0x8b785220, 0x71b6f0c7),
+	    TOBN(0x00000000, 0x00000084),
+	},
+    },
+    {
+	{
+	    TOBN(0x2837328c, 0x291780e6), TOBN(0x599d82cb, 0x2a85a94f),
+	    TOBN(0x262ee99c, 0x7fd8533f), TOBN(0xad5fa557, 0x502bd1bc),
+	    TOBN(0x5b237c7e, 0xe2fc9a5f), TOBN(0x40c7b78c, 0x1ffe5948),
+	    TOBN(0x62e1fc8e, 0xe201d4a9), TOBN(0x2f92d316, 0x11f3ecc2),
+	    TOBN(0x00000000, 0x00000120),
+	},
+	{
+	    TOBN(0x15f7bd02, 0x91d92f12), TOBN(0x2d004612, 0xd27d7f73),
+	    TOBN(0xc50441fc, 0x56506573), TOBN(0x6288c354, 0x5bd4a836),
+	    TOBN(0xa9fa2be7, 0x3b400418), TOBN(0x1591e23d, 0x83f38202),
+	    TOBN(0x91fe050a, 0x4aaf44bf), TOBN(0x237bcda0, 0xab4d946a),
+	    TOBN(0x00000000, 0x000000a9),
+	},
+    },
+};
+
+#if BN_BITS2 == 64
+static const BN_ULONG
+ec_comb_p521_table_mont[EC_COMB_TABLES << EC_COMB_TEETH][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0xb331a163, 0x81adc101), TOBN(0x4dfcbf3f, 0x18e172de),
+	    TOBN(0x6f19a459, 0xe0c2b521), TOBN(0x947f0ee0, 0x93d17fd4),
+	    TOBN(0xdd50a5af, 0x3bf7f3ac), TOBN(0x90fc1457, 0xb035a69e),
+	    TOBN(0x214e3240, 0x9c829fda), TOBN(0xe6cf1f65, 0xb311cada),
+	    TOBN(0x00000000, 0x00000074),
+	},
+	{
+	    TOBN(0x28460e4a, 0x5a9e268e), TOBN(0x20445f4a, 0x3b4fe8b3),
+	    TOBN(0xb09a9e38, 0x43513961), TOBN(0x2062a85c, 0x809fd683),
+	    TOBN(0x164bf739, 0x4caf7a13), TOBN(0x340bd7de, 0x8b939f33),
+	    TOBN(0xeccc7aa2, 0x24abcda2), TOBN(0x022e452f, 0xda163e8d),
+	    TOBN(0x00000000, 0x000001e0),
+	},
+    },
+    {
+	{
+	    TOBN(0xad081cbd, 0x682dd914), TOBN(0x88d8cd2c, 0x1433b543),
+	    TOBN(0x2da0394f, 0x94641d24), TOBN(0x48288ca4, 0xd8e36e70),
+	    TOBN(0xa112c8a6, 0x461fe782), TOBN(0xb8624a48, 0x6f063613),
+	    TOBN(0x511d90ff, 0x77efb66b), TOBN(0xce809694, 0x016e8d41),
+	    TOBN(0x00000000, 0x000001a1),
+	},
+	{
+	    TOBN(0x36feced9, 0x1fc39355), TOBN(0x921f42e8, 0x3ecdac71),
+	    TOBN(0xe82b293d, 0xee8e2857), TOBN(0x182b25ab, 0x2c3ef9bb),
+	    TOBN(0x297ad819, 0xac32f4bd), TOBN(0xdd15916b, 0x74b598de),
+	    TOBN(0x51456a24, 0xd5e666a5), TOBN(0x4dc25c5c, 0x447be0b1),
+	    TOBN(0x00000000, 0x00000179),
+	},
+    },
+    {
+	{
+	    TOBN(0x7da11531, 0x6ed4c17c), TOBN(0x4a8ea204, 0x77db71ab),
+	    TOBN(0x5fcd7540, 0x2f86ae14), TOBN(0xca2b2c0b, 0xdadf3376),
+	    TOBN(0xb2a257fb, 0x9c187bde), TOBN(0xc8ca1f92, 0x44989497),
+	    TOBN(0xabef25b7, 0x727e450f), TOBN(0xbd50e315, 0xbe561866),
+	    TOBN(0x00000000, 0x00000183),
+	},
+	{
+	    TOBN(0x7d957106, 0xe4c2e56c), TOBN(0x2b2dc36b, 0x4b8d4316),
+	    TOBN(0x55a3f0d4, 0x2f10d24f), TOBN(0x9da2daf1, 0xa3a199f9),
+	    TOBN(0xccd6106f, 0x82e184b9), TOBN(0x647883bb, 0x7b44fd07),
+	    TOBN(0x8060f3a4, 0xbb59da66), TOBN(0xa622c4dd, 0xb7794a59),
+	    TOBN(0x00000000, 0x000001c3),
+	},
+    },
+    {
+	{
+	    TOBN(0x449a64c8, 0xdeb9f4b8), TOBN(0x81603532, 0x674c0fe9),
+	    TOBN(0x595c6e13, 0x01e88fe6), TOBN(0xf6f513d4, 0x913b8697),
+	    TOBN(0x88c1e320, 0x3b6d478c), TOBN(0x90cfb68d, 0xb2857351),
+	    TOBN(0x6c4bb93b, 0xdfb9fd43), TOBN(0x3f388af7, 0xcc660149),
+	    TOBN(0x00000000, 0x00000063),
+	},
+	{
+	    TOBN(0x9a5258fb, 0x23175237), TOBN(0xb741a40d, 0xacae0a8b),
+	    TOBN(0x795d005e, 0xba0560ab), TOBN(0xcaa47999, 0x3978bc6a),
+	    TOBN(0x1ff04fef, 0x1c0b2496), TOBN(0x47c3b092, 0x6ddcefe7),
+	    TOBN(0xcc93f3d8, 0xf281ff39), TOBN(0x773c9a3f, 0x23027cc7),
+	    TOBN(0x00000000, 0x00000078),
+	},
+    },
+    {
+	{
+	    TOBN(0x6d44c643, 0x1852dc58), TOBN(0x558181e6, 0x00ea6706),
+	    TOBN(0x9a2c24c1, 0x377f0477), TOBN(0x410a4915, 0x0b89a9ba),
+	    TOBN(0x273cb7a0, 0x7eeabeb5), TOBN(0xefac0344, 0xccb4deab),
+	    TOBN(0xbb91ff68, 0xe466d878), TOBN(0x9085187f, 0x87b2de51),
+	    TOBN(0x00000000, 0x00000039),
+	},
+	{
+	    TOBN(0xd3b92435, 0x60cbadfe), TOBN(0x66b0a489, 0x46373541),
+	    TOBN(0x90e6e977, 0xb2ee6170), TOBN(0x6188ae21, 0x5a343080),
+	    TOBN(0x5fd9fed6, 0xaebefdbc), TOBN(0x4a970b67, 0x1290f6f8),
+	    TOBN(0xa2a8aafe, 0x7bc9570f), TOBN(0xbff88786, 0x67effbc9),
+	    TOBN(0x00000000, 0x00000020),
+	},
+    },
+    {
+	{
+	    TOBN(0x5dfe0eb5, 0x4757f458), TOBN(0xe4c6b98b, 0xf45baed1),
+	    TOBN(0x05b63001, 0xc740f2ea), TOBN(0x6825582c, 0x785cea45),
+	    TOBN(0xd274870a, 0xb727650e), TOBN(0x1fb6adc8, 0x2740e686),
+	    TOBN(0x79ec1a23, 0x98fd5666), TOBN(0x2574b5d3, 0xf97e127b),
+	    TOBN(0x00000000, 0x000000a2),
+	},
+	{
+	    TOBN(0x4b14b429, 0x358d7929), TOBN(0x29a893ce, 0xb35f2654),
+	    TOBN(0x6e1724ea, 0x80f5adb1), TOBN(0x273ed676, 0x9864cd94),
+	    TOBN(0x4117a69f, 0x7b77ca64), TOBN(0x29a96e35, 0xaed52651),
+	    TOBN(0x4046e50b, 0xeb9bf1b9), TOBN(0x7fb84d23, 0xff03fb68),
+	    TOBN(0x00000000, 0x000001bc),
+	},
+    },
+    {
+	{
+	    TOBN(0x1e4e4c8d, 0x3584ffb3), TOBN(0xd6d894c7, 0x144fa6ec),
+	    TOBN(0xc2c6e654, 0x6557453a), TOBN(0x41494636, 0x848cd099),
+	    TOBN(0x2dbc9cc2, 0x40545d3b), TOBN(0x211f4e65, 0x889ff366),
+	    TOBN(0x32b1563b, 0x8e2c42d1), TOBN(0x6eb28a5d, 0x99e1b56e),
+	    TOBN(0x00000000, 0x00000091),
+	},
+	{
+	    TOBN(0x54048b2c, 0x6acaf4fc), TOBN(0x90e44888, 0xde2df746),
+	    TOBN(0xfec85ddf, 0x48de5c48), TOBN(0xc851e0b2, 0xf4facff6),
+	    TOBN(0x81f9feac, 0x9f839147), TOBN(0x00101151, 0xd591c5db),
+	    TOBN(0x0554bee6, 0xbc75e22d), TOBN(0xdb192938, 0x6848e743),
+	    TOBN(0x00000000, 0x000000a0),
+	},
+    },
+    {
+	{
+	    TOBN(0xea56e1b7, 0xae8ee138), TOBN(0x028409b6, 0x5f8128c4),
+	    TOBN(0x8ed0e1c4, 0xe5e0d92d), TOBN(0xc55f66d6, 0xf3b74f68),
+	    TOBN(0xdeb2ab80, 0x35d3f9f9), TOBN(0xa7cb6b64, 0x3bde4296),
+	    TOBN(0x9b9d057f, 0x25e29f7e), TOBN(0x17e3fac2, 0x087f5f23),
+	    TOBN(0x00000000, 0x000001af),
+	},
+	{
+	    TOBN(0xd463cbb3, 0x23c7d215), TOBN(0x014b12b6, 0xd926fd3e),
+	    TOBN(0x3a1bcb9a, 0xab9ee679), TOBN(0x17170593, 0x1f47e609),
+	    TOBN(0x3b0a4387, 0xf44f73dc), TOBN(0x3ce5c7cd, 0xd2a12e51),
+	    TOBN(0x7f341e3a, 0x473ec3b7), TOBN(0x09a474c8, 0x6aef1796),
+	    TOBN(0x00000000, 0x00000038),
+	},
+    },
+    {
+	{
+	    TOBN(0x40ec928e, 0x1dfbdbf1), TOBN(0xba3455ae, 0x9784cbad),
+	    TOBN(0x43bd66c7, 0xd37ee363), TOBN(0xe90fd9e7, 0xa9b93d34),
+	    TOBN(0x93c15c66, 0xd9077407), TOBN(0x6334a2f3, 0x52943c68),
+	    TOBN(0x7cf49dcc, 0x78f2624a), TOBN(0x03d1d7c1, 0x8c9c7b2b),
+	    TOBN(0x00000000, 0x00000150),
+	},
+	{
+	    TOBN(0x38d9982b, 0xe9c314d0), TOBN(0x72ecadf9, 0x04b9d2e0),
+	    TOBN(0x4ba7d206, 0xad235a9f), TOBN(0xe64df833, 0xa7769467),
+	    TOBN(0x75a8a11e, 0x8fd05a97), TOBN(0x912b88dc, 0xb2849665),
+	    TOBN(0x2a022fe5, 0x78256b06), TOBN(0x394edb88, 0xfd89ace3),
+	    TOBN(0x00000000, 0x0000018e),
+	},
+    },
+    {
+	{
+	    TOBN(0x6a3c2f83, 0xdbbd55b1), TOBN(0x334ef51e, 0x9defd741),
+	    TOBN(0xf6ee056e, 0x7887e8d0), TOBN(0x6fc59a5b, 0x7622f594),
+	    TOBN(0x8eb4df40, 0x2b825c84), TOBN(0x13778208, 0x54e119c1),
+	    TOBN(0xac687391, 0xac3dd9b1), TOBN(0x10b2bda3, 0xa5f889c1),
+	    TOBN(0x00000000, 0x0000001a),
+	},
+	{
+	    TOBN(0x682e668e, 0xa593d69a), TOBN(0xfe0ee22a, 0x0d7239b2),
+	    TOBN(0xdbf4ee13, 0x01069cd9), TOBN(0x691ca9b7, 0xaa5fbca4),
+	    TOBN(0x0b736b92, 0xf53d2b22), TOBN(0xbeef84a2, 0x42c61a6f),
+	    TOBN(0x85038f88, 0xfef878d1), TOBN(0x4fc7c2b0, 0x32837b1f),
+	    TOBN(0x00000000, 0x00000148),
+	},
+    },
+    {
+	{
+	    TOBN(0x143f2a12, 0x50cc86b4), TOBN(0x876b13dc, 0xfa1e5a2b),
+	    TOBN(0x5174f8da, 0xf7560fcf), TOBN(0xd2b14898, 0xedce7db1),
+	    TOBN(0x131222c9, 0x7532ba53), TOBN(0x7754925c, 0xed9ef8e0),
+	    TOBN(0x6d0513db, 0xe3b19c84), TOBN(0x1ee2f84e, 0xaecd65c2),
+	    TOBN(0x00000000, 0x00000090),
+	},
+	{
+	    TOBN(0x7cc6e5ab, 0x876248b7), TOBN(0x7f8132b8, 0x596ded62),
+	    TOBN(0xfa245fe8, 0x0d768678), TOBN(0x5a23a6e2, 0x47d7d7a2),
+	    TOBN(0x6b61eb65, 0x2c7af455), TOBN(0x0cd2cc61, 0x73b1642d),
+	    TOBN(0x97560f24, 0x86940c8b), TOBN(0x527107a5, 0xc0b2cf57),
+	    TOBN(0x00000000, 0x0000000e),
+	},
+    },
+    {
+	{
+	    TOBN(0x6d3fb365, 0x051653fa), TOBN(0x6288e9d2, 0xca5f3b09),
+	    TOBN(0xa3edcbd5, 0x6110e81d), TOBN(0x911b9fc5, 0xb508cf18),
+	    TOBN(0xe023773b, 0x2a0cfa25), TOBN(0x1a087884, 0xf0bd29e4),
+	    TOBN(0x50130c5e, 0xbe6fea0c), TOBN(0x21188b8d, 0x3c279ebd),
+	    TOBN(0x00000000, 0x0000008d),
+	},
+	{
+	    TOBN(0x7a37ff00, 0x9a1b7345), TOBN(0xaadfdd8b, 0x84711819),
+	    TOBN(0xc68350a0, 0x3fbf6763), TOBN(0x3ef06095, 0xffd43a48),
+	    TOBN(0x710ce0f1, 0xcde17076), TOBN(0xc53e5712, 0x24ddf4c2),
+	    TOBN(0x439dc538, 0xe862485c), TOBN(0xea6908fa, 0x2efff7c8),
+	    TOBN(0x00000000, 0x00000053),
+	},
+    },
+    {
+	{
+	    TOBN(0xbab211b6, 0x80a708b1), TOBN(0x83c039a5, 0x1dea3d5d),
+	    TOBN(0xf7610f1e, 0x9f2d5c8f), TOBN(0x6069b302, 0x413c1e4f),
+	    TOBN(0xb5ca4e98, 0x474151cd), TOBN(0xf12fa4bb, 0xd8a8176a),
+	    TOBN(0x43908830, 0x65aa9c02), TOBN(0xd081f653, 0x94ab6577),
+	    TOBN(0x00000000, 0x00000015),
+	},
+	{
+	    TOBN(0x06b60f95, 0x1ca0e551), TOBN(0x63bd1fa3, 0x6a43a231),
+	    TOBN(0xb20db9f0, 0xef1aba59), TOBN(0x7ff0356c, 0x9d4b48d7),
+	    TOBN(0x69ee47d4, 0x73ad2fc8), TOBN(0xfb562145, 0x22f75a55),
+	    TOBN(0x2ed7a600, 0x7647be8f), TOBN(0xfadb5458, 0xbe7a3c43),
+	    TOBN(0x00000000, 0x00000059),
+	},
+    },
+    {
+	{
+	    TOBN(0xe3165e47, 0xc2a0d190), TOBN(0xc6b434da, 0x108d82e0),
+	    TOBN(0x98d1ed4c, 0xbf905e1e), TOBN(0x0ef5aae2, 0x56262146),
+	    TOBN(0xc9962550, 0x2351416a), TOBN(0x3c86df26, 0xff08b9a0),
+	    TOBN(0xdd4e1522, 0x17943be3), TOBN(0x832d758e, 0x2e5469c2),
+	    TOBN(0x00000000, 0x0000000a),
+	},
+	{
+	    TOBN(0xccbf11cf, 0x9d37aac6), TOBN(0xc56eed23, 0x169754ae),
+	    TOBN(0x9e8749ab, 0x79636146), TOBN(0x31ae409b, 0x339a2557),
+	    TOBN(0xafb580ce, 0xbd066703), TOBN(0x911e4d28, 0xafcbe3af),
+	    TOBN(0x946e38b2, 0xb3a217ef), TOBN(0xef2425a1, 0xeac6527e),
+	    TOBN(0x00000000, 0x00000172),
+	},
+    },
+    {
+	{
+	    TOBN(0x1e164171, 0x15cb378c), TOBN(0x13608740, 0xb374b7ed),
+	    TOBN(0x940c55bb, 0x4543f808), TOBN(0xb01dba80, 0xf60105f2),
+	    TOBN(0x89cf3497, 0x728645fa), TOBN(0x225870ba, 0x6d69589c),
+	    TOBN(0xa5092fa3, 0xb853f27f), TOBN(0x5b32ea7d, 0xca0ab5ea),
+	    TOBN(0x00000000, 0x0000017e),
+	},
+	{
+	    TOBN(0xb793bf51, 0x52233d7e), TOBN(0x1fec016e, 0x40e75edc),
+	    TOBN(0xd59de880, 0xdb72cd78), TOBN(0x9a0fda21, 0xa9a24671),
+	    TOBN(0x0d6e6dfc, 0x38608a8a), TOBN(0x100d12f4, 0xf2e3033f),
+	    TOBN(0x4eb129d8, 0x60fe934c), TOBN(0x66a3371f, 0xd26cb3a5),
+	    TOBN(0x00000000, 0x0000019a),
+	},
+    },
+    {
+	{
+	    TOBN(0xd715e37a, 0x2d438c77), TOBN(0x8615d6bb, 0x436c808c),
+	    TOBN(0x58c6e6b2, 0x78232591), TOBN(0xa40e8f75, 0xca6d68ce),
+	    TOBN(0xc01da381, 0xc4c37875), TOBN(0x58a155d9, 0xbe962879),
+	    TOBN(0x847d5de7, 0x5dd3d4cf), TOBN(0x8f7f76b4, 0xee99fd85),
+	    TOBN(0x00000000, 0x00000015),
+	},
+	{
+	    TOBN(0xd4c9f66a, 0x4cec18db), TOBN(0x647086e4, 0x5302a76b),
+	    TOBN(0x93b84a7e, 0x1b679cdf), TOBN(0x92243bc4, 0xd412c242),
+	    TOBN(0xd5c3c375, 0x519ccba0), TOBN(0x8ba3d06b, 0x585371f2),
+	    TOBN(0x1daa7685, 0x90f4c0f2), TOBN(0x6342e78b, 0xf573b409),
+	    TOBN(0x00000000, 0x0000013c),
+	},
+    },
+    {
+	{
+	    TOBN(0xfedb19d5, 0x8b8a2805), TOBN(0xcec77a63, 0x86611fe7),
+	    TOBN(0x78d4f317, 0xe61c4cd2), TOBN(0xca64f606, 0x44d1f7bb),
+	    TOBN(0x3df60064, 0x97f2678e), TOBN(0x586e15eb, 0x973e94b1),
+	    TOBN(0xc8544689, 0x4cf6d241), TOBN(0x1d9a3596, 0xa7f418b0),
+	    TOBN(0x00000000, 0x00000096),
+	},
+	{
+	    TOBN(0x0053ebc9, 0x36a30950), TOBN(0xd3f2ef05, 0x1cf2f437),
+	    TOBN(0x86318b0c, 0x5603ed3f), TOBN(0x0409de45, 0x05c3ddf1),
+	    TOBN(0x5b23e8f7, 0x4c9850e3), TOBN(0x5dfe49f5, 0xb37a5bce),
+	    TOBN(0xd3b82845, 0x5d70a428), TOBN(0xd7722456, 0xdfac37f5),
+	    TOBN(0x00000000, 0x0000017e),
+	},
+    },
+    {
+	{
+	    TOBN(0x693fc952, 0xb99b74de), TOBN(0x6ff2e2f0, 0x14df43be),
+	    TOBN(0x0473ba3c, 0xe9b2ac87), TOBN(0x6bd542c3, 0xde37e36c),
+	    TOBN(0x63181ec8, 0x995822d1), TOBN(0xad7ff8fb, 0x186aa1cf),
+	    TOBN(0x4aeef83a, 0xae631dcc), TOBN(0x7bc806f2, 0x5571a64f),
+	    TOBN(0x00000000, 0x000000e5),
+	},
+	{
+	    TOBN(0xeba27275, 0xbdf2db60), TOBN(0x286af60a, 0xa8a899b2),
+	    TOBN(0x9223267a, 0x97f2870a), TOBN(0x14b77e31, 0x82fa855d),
+	    TOBN(0xd11b8b3b, 0x2d53b8ec), TOBN(0xabdb5084, 0x723a2606),
+	    TOBN(0xea2a7f0c, 0x3b199c2f), TOBN(0x49daee02, 0x49338ce9),
+	    TOBN(0x00000000, 0x0000000a),
+	},
+    },
+    {
+	{
+	    TOBN(0x9925b17e, 0xd86c66df), TOBN(0xbfa634b4, 0xd2642a6f),
+	    TOBN(0xc7f3a928, 0xf8603efd), TOBN(0x7c16fc58, 0x392067f5),
+	    TOBN(0x75ee934f, 0x6f28e9b4), TOBN(0x39e959eb, 0x707c04b3),
+	    TOBN(0x6a57f8ad, 0xf8594bbc), TOBN(0xefa400a2, 0xdbbe2e7e),
+	    TOBN(0x00000000, 0x000000f1),
+	},
+	{
+	    TOBN(0xfbe73a5e, 0xf462f4e7), TOBN(0x1c2065fc, 0x7af010bb),
+	    TOBN(0xee93c252, 0xa272797e), TOBN(0xa3ad3c62, 0x2255180e),
+	    TOBN(0xae5c934f, 0xd8327815), TOBN(0x7e7629b4, 0xf06f7d30),
+	    TOBN(0x0cc838bd, 0x34448bdd), TOBN(0xf3ace097, 0xa5cc8daa),
+	    TOBN(0x00000000, 0x000001bf),
+	},
+    },
+    {
+	{
+	    TOBN(0x9db1fe11, 0x8cbe182e), TOBN(0x78d5eabe, 0x18985f1f),
+	    TOBN(0xe72f6adc, 0x8263d343), TOBN(0x1110de2e, 0x684be78a),
+	    TOBN(0x8b076c3b, 0x4ac629d3), TOBN(0x9d6bce1a, 0xff51afdb),
+	    TOBN(0xb259497f, 0x2dab26ac), TOBN(0xaf3df224, 0xf32577f3),
+	    TOBN(0x00000000, 0x00000043),
+	},
+	{
+	    TOBN(0x58e86e0f, 0x498dbae6), TOBN(0x77311650, 0xcb55a483),
+	    TOBN(0x5e79014f, 0xb115e1b5), TOBN(0xa16d81a0, 0xcb923807),
+	    TOBN(0x18ce0710, 0xd93cf131), TOBN(0xf71ac5be, 0x13247e4b),
+	    TOBN(0x02f62de5, 0x407ef8e3), TOBN(0xe74482a5, 0x1a30c128),
+	    TOBN(0x00000000, 0x0000006e),
+	},
+    },
+    {
+	{
+	    TOBN(0xfff39ae4, 0x52d9a1bb), TOBN(0x63f8a3ad, 0xd951c97c),
+	    TOBN(0x3464c050, 0xb77df153), TOBN(0x65b5adc9, 0x24799b7a),
+	    TOBN(0x31fc1615, 0xb84feb94), TOBN(0xbfab5458, 0x30bba77d),
+	    TOBN(0xf89089c8, 0x6246feae), TOBN(0x261695c9, 0x6cf3ebb2),
+	    TOBN(0x00000000, 0x0000014a),
+	},
+	{
+	    TOBN(0x4cb89f5c, 0xbcbb68b3), TOBN(0x79cbc704, 0xadea2d4e),
+	    TOBN(0x5c077904, 0x639e122b), TOBN(0xb2463eb4, 0x27e4de18),
+	    TOBN(0xeb032724, 0x5551c4fc), TOBN(0x067f5c4b, 0xd99ad27e),
+	    TOBN(0xff42d1cd, 0x5127b118), TOBN(0x90818ac3, 0x58487b33),
+	    TOBN(0x00000000, 0x00000006),
+	},
+    },
+    {
+	{
+	    TOBN(0x22315df1, 0x2576fa20), TOBN(0xe7995e94, 0x0fca7347),
+	    TOBN(0xeb1e178b, 0x7165687c), TOBN(0x3f872ab8, 0xc7c72ea6),
+	    TOBN(0x0fe6469e, 0x30a9685e), TOBN(0x19b79219, 0x6bae3a68),
+	    TOBN(0x5b37bed6, 0x1b67e3d5), TOBN(0x2d95a5d8, 0xadbbc714),
+	    TOBN(0x00000000, 0x00000085),
+	},
+	{
+	    TOBN(0x1d413e5f, 0x75584371), TOBN(0x5ecbe048, 0x821a6641),
+	    TOBN(0xf5b0fb52, 0x0af29416), TOBN(0x44c0d03d, 0xe8638e7e),
+	    TOBN(0xfb05d2ae, 0xf18bc15d), TOBN(0xd7cec574, 0x5620c7cd),
+	    TOBN(0xb2c204c3, 0x1da7dde9), TOBN(0x1c701acd, 0x71548524),
+	    TOBN(0x00000000, 0x000001d6),
+	},
+    },
+    {
+	{
+	    TOBN(0xb723051d, 0x8da5e6f8), TOBN(0xb9a3cc9e, 0x09f95ef3),
+	    TOBN(0xa146f66e, 0x9a4dc893), TOBN(0x4d70c55c, 0x96eb107d),
+	    TOBN(0x9020918f, 0x0f1d99aa), TOBN(0x9fedc2f4, 0x9f016a74),
+	    TOBN(0x183ba77b, 0x27b0fbfe), TOBN(0xa1ea0216, 0x83ec625d),
+	    TOBN(0x00000000, 0x00000008),
+	},
+	{
+	    TOBN(0x36fa1980, 0xd633697d), TOBN(0xbdbcdbb9, 0x8cbe99cb),
+	    TOBN(0x8baeecbd, 0x9c6858cc), TOBN(0xd2587f15, 0x78bb4f33),
+	    TOBN(0x3120e718, 0xc2bf6158), TOBN(0xd61c38e7, 0x90343bd4),
+	    TOBN(0x798aba21, 0x755f602f), TOBN(0x0a6f16fa, 0xa8c2e571),
+	    TOBN(0x00000000, 0x00000085),
+	},
+    },
+    {
+	{
+	    TOBN(0xb3cdfe38, 0x40c2e27d), TOBN(0x8f9fef4f, 0x3bcd2bf2),
+	    TOBN(0x771a95db, 0x1dc1be99), TOBN(0x4ef729c0, 0x09e74a43),
+	    TOBN(0x2b82a414, 0x121984c4), TOBN(0x8a67be5a, 0x9a0dbab1),
+	    TOBN(0x8d24b640, 0x02158786), TOBN(0x0c73bf6e, 0x74ac785c),
+	    TOBN(0x00000000, 0x00000007),
+	},
+	{
+	    TOBN(0x38546eaf, 0x2356f055), TOBN(0xdd8c44be, 0xc80313bb),
+	    TOBN(0x402f7734, 0x8ccae169), TOBN(0x52b2d150, 0x811d93b9),
+	    TOBN(0xddc76c9a, 0xde5cab9d), TOBN(0x9df62197, 0xadba0928),
+	    TOBN(0x455af118, 0x5702338d), TOBN(0x812fb7b2, 0x602b3bda),
+	    TOBN(0x00000000, 0x000001c2),
+	},
+    },
+    {
+	{
+	    TOBN(0x128067f3, 0xbfbfb407), TOBN(0x362e7c0f, 0x84619e3c),
+	    TOBN(0xa2011927, 0xd9ce0f30), TOBN(0x68e19931, 0xf8867fec),
+	    TOBN(0xc924d39c, 0xb20eb5dc), TOBN(0xff664b34, 0x08073cd9),
+	    TOBN(0x7061bbe7, 0x56d985d1), TOBN(0xd8ccfc36, 0x17a57306),
+	    TOBN(0x00000000, 0x000001d5),
+	},
+	{
+	    TOBN(0x1f8dcfbe, 0x8d52af04), TOBN(0xb7074c3f, 0x9292d5f2),
+	    TOBN(0xd7de773d, 0xd55d4952), TOBN(0x81816417, 0x650612fd),
+	    TOBN(0xd1125991, 0xd8c168da), TOBN(0x6ef31c6e, 0xc5d8e430),
+	    TOBN(0xee79e519, 0xd5f811c8), TOBN(0x6b0049c1, 0x817e50c6),
+	    TOBN(0x00000000, 0x000000b3),
+	},
+    },
+    {
+	{
+	    TOBN(0xf69c60e8, 0xb93844e5), TOBN(0xfb2ac4ec, 0x34c87578),
+	    TOBN(0x8adc250b, 0x6ea63b2c), TOBN(0x543dc44a, 0x2d3c8f28),
+	    TOBN(0x8fd7d9b2, 0xf15db28f), TOBN(0x6370c781, 0x6ffdfaa5),
+	    TOBN(0xb88ccfbf, 0x3ec888c8), TOBN(0x563b5fc1, 0x67739572),
+	    TOBN(0x00000000, 0x000000c1),
+	},
+	{
+	    TOBN(0xf267edb7, 0x6fb81398), TOBN(0x910fd620, 0x1ea2ef5f),
+	    TOBN(0x69381723, 0xf2d1a16b), TOBN(0x3e0245f5, 0x7747b6cb),
+	    TOBN(0xf234a8de, 0xbc0ce504), TOBN(0x238e24b9, 0xb9b1343a),
+	    TOBN(0xd4c3cdc5, 0xafa182e4), TOBN(0xe2d7a903, 0xeefc7bf3),
+	    TOBN(0x00000000, 0x000000d6),
+	},
+    },
+    {
+	{
+	    TOBN(0x74645e2e, 0xf1be6b3f), TOBN(0x264839f3, 0x81c8796d),
+	    TOBN(0xc716197e, 0x39afaf91), TOBN(0x907c9ac5, 0x930fe1a6),
+	    TOBN(0xdf47a3b1, 0xd96349ad), TOBN(0xd68a5905, 0x745b478e),
+	    TOBN(0x4bf498a3, 0x111015fc), TOBN(0x56c06c32, 0x78b38586),
+	    TOBN(0x00000000, 0x00000156),
+	},
+	{
+	    TOBN(0x0c0cf1d1, 0xd690f354), TOBN(0x01b1f32b, 0x43488cc5),
+	    TOBN(0x03aec5cf, 0x9ba41a4b), TOBN(0x390f0be5, 0x3b6df8cd),
+	    TOBN(0x87a94a2f, 0x6ec1d585), TOBN(0x584c4b44, 0x5d0671e8),
+	    TOBN(0x64da6ddf, 0x605f2583), TOBN(0x462cd9de, 0x9b239aab),
+	    TOBN(0x00000000, 0x0000014e),
+	},
+    },
+    {
+	{
+	    TOBN(0x2fd73da5, 0x3c0e7138), TOBN(0xf0d3e1ce, 0xbfa41dc4),
+	    TOBN(0xa0d3e491, 0x1ce6f815), TOBN(0x94144c82, 0x25aa5163),
+	    TOBN(0x8403779a, 0x233d8ea2), TOBN(0x79f5530f, 0xf9c3af28),
+	    TOBN(0x43922a6f, 0x00636f8f), TOBN(0xede162b2, 0x433f46c5),
+	    TOBN(0x00000000, 0x00000037),
+	},
+	{
+	    TOBN(0x18c8b90f, 0xa1ecbbdb), TOBN(0xd2a1bbcb, 0x8a260389),
+	    TOBN(0x82acafbd, 0xc5a89982), TOBN(0x566413e8, 0x95f61a39),
+	    TOBN(0x8c1d98d2, 0xebc8dd3c), TOBN(0x48e92863, 0x4113fe3c),
+	    TOBN(0x8b167493, 0x7ebacb07), TOBN(0x6d72f717, 0x800c58dd),
+	    TOBN(0x00000000, 0x00000152),
+	},
+    },
+    {
+	{
+	    TOBN(0x6bfdc576, 0xf3a58d7a), TOBN(0x82943456, 0x1c4c0aa9),
+	    TOBN(0xa1c5de20, 0x078a0329), TOBN(0xee0b0f61, 0xd34873ca),
+	    TOBN(0xb3b0d00a, 0xdacfb3b3), TOBN(0x0eb1bcf4, 0xcade2117),
+	    TOBN(0xa49aa12b, 0x8bcdbfa0), TOBN(0x4dec8d38, 0x3e359771),
+	    TOBN(0x00000000, 0x0000019a),
+	},
+	{
+	    TOBN(0xc1ba054a, 0x97f07978), TOBN(0x82a24baf, 0xcd76cfa8),
+	    TOBN(0xa82f0acf, 0x217f52d4), TOBN(0x7c3ccc78, 0x8c4b5115),
+	    TOBN(0xecfd0b61, 0x009cd595), TOBN(0x989519a3, 0xcfd62593),
+	    TOBN(0xda20b394, 0x8fd9ffdf), TOBN(0xea482078, 0xa66f3f3e),
+	    TOBN(0x00000000, 0x00000042),
+	},
+    },
+    {
+	{
+	    TOBN(0x1b0585f0, 0x44ea0f17), TOBN(0x4334520c, 0x87349a5e),
+	    TOBN(0xe8279728, 0x2619adc2), TOBN(0xb9f37f16, 0xbf2c3e7c),
+	    TOBN(0xba53b498, 0xa04fbab6), TOBN(0x228a7e57, 0x77c1ea83),
+	    TOBN(0xc4aa43d5, 0x7b563031), TOBN(0x606a300f, 0x46bca4e3),
+	    TOBN(0x00000000, 0x00000070),
+	},
+	{
+	    TOBN(0x4d366b3d, 0xbed3f4af), TOBN(0xcb1fa49d, 0x30178c83),
+	    TOBN(0x2bba1cfa, 0xf135e834), TOBN(0x06e2aeb0, 0xe89f5980),
+	    TOBN(0x7ec00407, 0xf2efa0c5), TOBN(0xac321fc5, 0x1400d1dc),
+	    TOBN(0xd2bcf9e5, 0x1938d560), TOBN(0x385d4f45, 0x06e881d3),
+	    TOBN(0x00000000, 0x00000192),
+	},
+    },
+    {
+	{
+	    TOBN(0x448468dd, 0x4f2096a9), TOBN(0x94036bb1, 0xa129d720),
+	    TOBN(0x85f322cf, 0x4ac36305), TOBN(0x64c4966e, 0xf4975461),
+	    TOBN(0xa13dd511, 0xa56e735b), TOBN(0x5051a6b5, 0x7f8230dc),
+	    TOBN(0xb5dea6f6, 0xabd37f49), TOBN(0x0a215bc8, 0x0f861f76),
+	    TOBN(0x00000000, 0x00000059),
+	},
+	{
+	    TOBN(0x8835376f, 0xf68e6890), TOBN(0xca92b241, 0xd922cd92),
+	    TOBN(0x93d1810f, 0xf2db4e34), TOBN(0x7b0c714f, 0x2583046f),
+	    TOBN(0xeec0a3ca, 0x83b46e05), TOBN(0x291801b8, 0xc217c385),
+	    TOBN(0x0b84c0a3, 0xcae3d501), TOBN(0x9771cf35, 0xa5eaf7a2),
+	    TOBN(0x00000000, 0x00000020),
+	},
+    },
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0xf2fdc439, 0x6bfa5396), TOBN(0xdb91292b, 0x7edbcb88),
+	    TOBN(0xd5dee79a, 0x19d35421), TOBN(0x035e9ea2, 0xa420a538),
+	    TOBN(0xe21709fe, 0x9cf14f3b), TOBN(0x690ca5b7, 0x49703f94),
+	    TOBN(0x4deb7af2, 0x495b47e8), TOBN(0xb09d6324, 0xcc2ef057),
+	    TOBN(0x00000000, 0x000001d4),
+	},
+	{
+	    TOBN(0x7ff7df3b, 0x9fe6e0b5), TOBN(0x1593ef9e, 0x25c764e6),
+	    TOBN(0xef6d9489, 0xb9153d85), TOBN(0x238e5449, 0x117822d7),
+	    TOBN(0xbbd3333b, 0x1e34e4c9), TOBN(0x416c6cfb, 0x58cc8198),
+	    TOBN(0xa8085b4b, 0x7b487650), TOBN(0x5e20cc8e, 0xb3068c07),
+	    TOBN(0x00000000, 0x0000017b),
+	},
+    },
+    {
+	{
+	    TOBN(0x5c5d4a76, 0xda490054), TOBN(0x74621c3b, 0x224e9112),
+	    TOBN(0x17406495, 0x62ab184a), TOBN(0xc3f7c8cd, 0xedfb682a),
+	    TOBN(0xd8e38d44, 0x16ae2053), TOBN(0x39ed9c28, 0xdf044060),
+	    TOBN(0xf327b97f, 0x86143e57), TOBN(0x53853147, 0x8b95f9f7),
+	    TOBN(0x00000000, 0x00000072),
+	},
+	{
+	    TOBN(0x43b98e46, 0x81550101), TOBN(0xc1bcc1fc, 0x05661b39),
+	    TOBN(0x64ff1647, 0x9ee23198), TOBN(0x0f20d871, 0x115744fc),
+	    TOBN(0x92c9feea, 0xcdf5ac56), TOBN(0xa72f70b2, 0x63cba9c3),
+	    TOBN(0x365c71db, 0xadbac8fd), TOBN(0x9d51687d, 0x171aad35),
+	    TOBN(0x00000000, 0x000000f9),
+	},
+    },
+    {
+	{
+	    TOBN(0x818f7673, 0xa753c426), TOBN(0xb1e274af, 0xc8e9e109),
+	    TOBN(0x258e840b, 0x33a83d59), TOBN(0xa9168684, 0x762a5fd2),
+	    TOBN(0x738d99aa, 0x89809a52), TOBN(0x4c7a5cdf, 0x1d2709a7),
+	    TOBN(0x534c67bd, 0xf9bc345d), TOBN(0x8d6a4a37, 0x55b2d90c),
+	    TOBN(0x00000000, 0x000000f9),
+	},
+	{
+	    TOBN(0x7065b31e, 0xb1ec091a), TOBN(0x5cc4a5ab, 0x746ad073),
+	    TOBN(0xc1719af3, 0x244f2634), TOBN(0xf3053c34, 0xa337ecb7),
+	    TOBN(0x70177b55, 0x2d2490a2), TOBN(0x5d2c76a6, 0x406f2809),
+	    TOBN(0x63934a0f, 0x37095cac), TOBN(0x45250e88, 0x33e01241),
+	    TOBN(0x00000000, 0x000001d9),
+	},
+    },
+    {
+	{
+	    TOBN(0x990d40ea, 0x7dbd2185), TOBN(0xfe2aa0bf, 0xfd292d5f),
+	    TOBN(0x350ffa07, 0x0b3c033e), TOBN(0xcba18d05, 0x7093caf5),
+	    TOBN(0x5de1ef34, 0x8e77aa62), TOBN(0x8d305062, 0x8dcafce9),
+	    TOBN(0xa2184206, 0x54c13b97), TOBN(0xc1eed7a3, 0x024b7581),
+	    TOBN(0x00000000, 0x000000eb),
+	},
+	{
+	    TOBN(0xd2467c3c, 0xff7787c9), TOBN(0x6f3a2cc6, 0x5919f6e7),
+	    TOBN(0xd95dc335, 0xe4ef4ee6), TOBN(0x53862418, 0x8b15339d),
+	    TOBN(0xdc9f6ee9, 0xc47f7183), TOBN(0x8fc3c2d0, 0x0164075a),
+	    TOBN(0x82f15ec0, 0xfb8c9b9b), TOBN(0x6da80b24, 0x2cab4250),
+	    TOBN(0x00000000, 0x00000170),
+	},
+    },
+    {
+	{
+	    TOBN(0xb111355f, 0xc105ba59), TOBN(0xef5fc4d6, 0xc43e1e40),
+	    TOBN(0x0172c20b, 0x6768e3ec), TOBN(0xcb196cac, 0x81d45f33),
+	    TOBN(0xcb0aa396, 0xa9740e4e), TOBN(0x56ca761c, 0xb71809ad),
+	    TOBN(0x00d6aa5d, 0xb68d7e0d), TOBN(0x396e39f2, 0x292db857),
+	    TOBN(0x00000000, 0x000001e0),
+	},
+	{
+	    TOBN(0x06dccbe6, 0xf2b73f91), TOBN(0x55e11ba7, 0x4473afb1),
+	    TOBN(0xfabb5483, 0x291caa6c), TOBN(0x1317e5ae, 0xd7fa0be3),
+	    TOBN(0x9820f788, 0xa2addb2b), TOBN(0x2f5d2937, 0x2b60cd83),
+	    TOBN(0x5eae8134, 0x6730a2e2), TOBN(0xdc9f97c1, 0x5c06b536),
+	    TOBN(0x00000000, 0x000000f3),
+	},
+    },
+    {
+	{
+	    TOBN(0xb00bde43, 0xb3873320), TOBN(0xacd8cd58, 0x8c2e8efa),
+	    TOBN(0xc33afced, 0x51ace1be), TOBN(0x32eac533, 0xe0926be5),
+	    TOBN(0x1c8dcd11, 0xb9df3ee5), TOBN(0xdff144a1, 0x783b5c0d),
+	    TOBN(0x04154721, 0x4833cbf7), TOBN(0xd18e6eda, 0x6e45c036),
+	    TOBN(0x00000000, 0x0000014b),
+	},
+	{
+	    TOBN(0x0cc3585f, 0xc827d251), TOBN(0x46ed90bf, 0xc306b854),
+	    TOBN(0xc6f553b6, 0x9508811f), TOBN(0xcaaa1e2a, 0xd38eae94),
+	    TOBN(0x2dd33f8f, 0x77c8387a), TOBN(0xd8dd4a0f, 0xf832339f),
+	    TOBN(0xb8f4ca51, 0x79254d1e), TOBN(0x7da260dd, 0x9dd6dc05),
+	    TOBN(0x00000000, 0x00000190),
+	},
+    },
+    {
+	{
+	    TOBN(0x64d3489e, 0x7e33936a), TOBN(0x72de1c45, 0x94f7ffce),
+	    TOBN(0x47a51845, 0x31db8fe3), TOBN(0x8c14c239, 0xf09aa2d4),
+	    TOBN(0xce9decf0, 0xf146e99d), TOBN(0xf275d3e5, 0xea70aca8),
+	    TOBN(0xef2bd5b1, 0xafe3ddc7), TOBN(0x5f5fc6c4, 0xcf66cf23),
+	    TOBN(0x00000000, 0x00000040),
+	},
+	{
+	    TOBN(0x60efff12, 0x9a8e1326), TOBN(0xf1a6984d, 0xbd4e312f),
+	    TOBN(0x1918fde2, 0x0110929b), TOBN(0x42a03bb1, 0x422b3c40),
+	    TOBN(0x25f1704d, 0xf58e5f86), TOBN(0xf2489c42, 0xd0127fe1),
+	    TOBN(0xbca66e69, 0x602b5932), TOBN(0xa2f92161, 0x6e12cd10),
+	    TOBN(0x00000000, 0x0000007a),
+	},
+    },
+    {
+	{
+	    TOBN(0x52546c7f, 0x70bcb2f8), TOBN(0x3c3eb721, 0x20270840),
+	    TOBN(0x142e7b62, 0x13f0d6d8), TOBN(0xf973a763, 0x019eaca7),
+	    TOBN(0x8be00c2a, 0x025efc29), TOBN(0x03943eca, 0x6f6199ab),
+	    TOBN(0xfbfb9ab2, 0xb5618bcc), TOBN(0x0ae9ab79, 0x5fb02749),
+	    TOBN(0x00000000, 0x0000013c),
+	},
+	{
+	    TOBN(0x50f295b9, 0x3c3d712e), TOBN(0x083d8bf1, 0xab6d0e9f),
+	    TOBN(0x07076abe, 0xbf53d7cb), TOBN(0x51a53561, 0xf29d744e),
+	    TOBN(0x7d647b91, 0x5c2fc15a), TOBN(0x51a29ead, 0x253f8428),
+	    TOBN(0x006b7bce, 0x91bd9d62), TOBN(0xc770e4ef, 0xe106dd74),
+	    TOBN(0x00000000, 0x00000092),
+	},
+    },
+    {
+	{
+	    TOBN(0xf41aed58, 0xc2064238), TOBN(0xaae3ef3b, 0xf098ba96),
+	    TOBN(0x0579afe3, 0x91dd326f), TOBN(0xe5127fea, 0x81d40d91),
+	    TOBN(0x007d33db, 0x9f49abc7), TOBN(0x8f59166d, 0xa9ba4b4a),
+	    TOBN(0xfdf42fd9, 0xff0d95be), TOBN(0xb14446aa, 0x47715fdc),
+	    TOBN(0x00000000, 0x00000008),
+	},
+	{
+	    TOBN(0x4dbe6622, 0x0cbfc0b3), TOBN(0x6c8f61ca, 0x565ffafa),
+	    TOBN(0xd84e41fa, 0x2fc57cab), TOBN(0x89dd3a79, 0x1fefc49d),
+	    TOBN(0x4339dd7b, 0x2ea2d3e7), TOBN(0xd9b75591, 0x23d03b1f),
+	    TOBN(0xa2cba007, 0x36a0a063), TOBN(0xbe9c14ae, 0x24215ed5),
+	    TOBN(0x00000000, 0x000000c4),
+	},
+    },
+    {
+	{
+	    TOBN(0x452a0a3f, 0xe926d608), TOBN(0x5f2fa102, 0xa09aed22),
+	    TOBN(0x8c498c77, 0xb1033548), TOBN(0x1510d9e7, 0x1dc17f25),
+	    TOBN(0xd61a2175, 0x81cdaae5), TOBN(0x7208a24a, 0x6978b2d5),
+	    TOBN(0x9a47aab1, 0xb9d5c0ad), TOBN(0xd6fcd460, 0x02ef4707),
+	    TOBN(0x00000000, 0x000000e4),
+	},
+	{
+	    TOBN(0xc5cdb2e6, 0x6c8670f9), TOBN(0xcbd7da80, 0xe6dc54a3),
+	    TOBN(0x9439006e, 0xb18b0be8), TOBN(0x5f9cdc21, 0x9dc7e968),
+	    TOBN(0x568be87b, 0xa7d1b4e2), TOBN(0x886a90e9, 0x70c9fd42),
+	    TOBN(0x622ad500, 0xce283811), TOBN(0x0bccbd15, 0x9d239466),
+	    TOBN(0x00000000, 0x00000171),
+	},
+    },
+    {
+	{
+	    TOBN(0xdd2a610b, 0x4dcbfb7e), TOBN(0xf8db9859, 0x1eb99440),
+	    TOBN(0x11de839d, 0x9b3b35a1), TOBN(0x17bd1c27, 0xf33169fa),
+	    TOBN(0x3c99dc92, 0xe574e892), TOBN(0x06065398, 0x38e818c2),
+	    TOBN(0xc034f71c, 0x15886c0e), TOBN(0x8a2a581f, 0x60c366af),
+	    TOBN(0x00000000, 0x000000a2),
+	},
+	{
+	    TOBN(0xa6bb73c0, 0x4c5a1df1), TOBN(0x2fa2525f, 0x38d1f7de),
+	    TOBN(0x99b36929, 0x1e01a7bc), TOBN(0x3d4def18, 0x1705ec99),
+	    TOBN(0xa3f1315b, 0xc81d298c), TOBN(0xbb558d89, 0x9a6ac9dc),
+	    TOBN(0xdcfc8ab5, 0x79e42b29), TOBN(0x4e65e160, 0x706c2307),
+	    TOBN(0x00000000, 0x000001cf),
+	},
+    },
+    {
+	{
+	    TOBN(0xe3de5c20, 0x26717446), TOBN(0x32b418eb, 0xfc2b2189),
+	    TOBN(0xf3e5060f, 0xfd184a06), TOBN(0xe8aa4d95, 0x674fc54f),
+	    TOBN(0x3f5971da, 0x7cd72584), TOBN(0x697d726d, 0x64cd8be2),
+	    TOBN(0xbda08332, 0x1ed22418), TOBN(0xf87687b8, 0x857cdf46),
+	    TOBN(0x00000000, 0x00000048),
+	},
+	{
+	    TOBN(0x86015ffd, 0x0fcf6b26), TOBN(0x4011ea96, 0x36362c33),
+	    TOBN(0x0eff4790, 0xd6e28533), TOBN(0xb8ec45f3, 0x1c922322),
+	    TOBN(0x1d9ea52a, 0xb053d212), TOBN(0x3a2d3edf, 0x4f88de55),
+	    TOBN(0xcb8f7fd1, 0xd3b2d9a1), TOBN(0x676f7b42, 0x21eba660),
+	    TOBN(0x00000000, 0x00000054),
+	},
+    },
+    {
+	{
+	    TOBN(0xd2c40fad, 0x8e2b08bd), TOBN(0x853cc0b5, 0x37d0cdd6),
+	    TOBN(0x0fcc7908, 0x33aafc44), TOBN(0x419f9f52, 0x2ece2bf5),
+	    TOBN(0xbb23c59a, 0x5991428b), TOBN(0x602c16d9, 0xf395b230),
+	    TOBN(0x83215879, 0xa1b366ae), TOBN(0x34befed6, 0xedc248aa),
+	    TOBN(0x00000000, 0x000000e2),
+	},
+	{
+	    TOBN(0x2722f941, 0x11cd0b29), TOBN(0x52c49495, 0x0dc6faf6),
+	    TOBN(0xb2ba93aa, 0x357a4649), TOBN(0x72ab89a0, 0xfe783ef5),
+	    TOBN(0xeb6a0871, 0x47570bf0), TOBN(0x4b59368c, 0x3f5496b3),
+	    TOBN(0x9c177bea, 0xd5d890d7), TOBN(0xd371c436, 0x195d8bbc),
+	    TOBN(0x00000000, 0x000000e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x5f0579c1, 0x5affe9b6), TOBN(0xf3fb158a, 0x13479502),
+	    TOBN(0x613fcbd8, 0x29c2d0c1), TOBN(0x3b27d680, 0x7b860cbb),
+	    TOBN(0x94f22eb5, 0xf4352625), TOBN(0x6b73b06d, 0x952040bc),
+	    TOBN(0x18c5b864, 0x58e3704f), TOBN(0x46d632db, 0x1c92c57d),
+	    TOBN(0x00000000, 0x00000134),
+	},
+	{
+	    TOBN(0xfb093cd9, 0x1f7b4430), TOBN(0x0b0df27a, 0xfc9f8bc5),
+	    TOBN(0x6ad68667, 0x603f6f36), TOBN(0x127be943, 0x4aaf5724),
+	    TOBN(0xaaebdb3f, 0x6f95c363), TOBN(0x86761e49, 0x334cb549),
+	    TOBN(0x917370f4, 0xaea02999), TOBN(0x0df00cf0, 0x433a7f3e),
+	    TOBN(0x00000000, 0x000000fa),
+	},
+    },
+    {
+	{
+	    TOBN(0xe40ba4b0, 0xda4f3cd9), TOBN(0x0595fa1e, 0x1af1a5ce),
+	    TOBN(0xe306008a, 0xae1d4749), TOBN(0xefb2664c, 0x566c966e),
+	    TOBN(0xff1afb02, 0x09479306), TOBN(0x60ff0900, 0xdd1b0a2b),
+	    TOBN(0x787537ae, 0x5954d52a), TOBN(0x6dc1185e, 0xf6e29d62),
+	    TOBN(0x00000000, 0x00000156),
+	},
+	{
+	    TOBN(0x2c225f0a, 0x64351a4e), TOBN(0x359b3524, 0x9e49cf3d),
+	    TOBN(0x62fc856a, 0xe8f2d0ab), TOBN(0x3473d45e, 0xffee8da0),
+	    TOBN(0x5a005cde, 0xd473d604), TOBN(0xff068673, 0x57fd3b57),
+	    TOBN(0xca2b0e76, 0x7042e89e), TOBN(0x78365f64, 0x256857d5),
+	    TOBN(0x00000000, 0x000001c6),
+	},
+    },
+    {
+	{
+	    TOBN(0xb01ce2b5, 0xf2dc50d1), TOBN(0xf417d7e3, 0x9f8c4d01),
+	    TOBN(0xcbf04214, 0x78d34284), TOBN(0xc4238071, 0xf59d157a),
+	    TOBN(0x7b0a1e05, 0xf8a594c0), TOBN(0xc9cfd81b, 0xbaf85cdc),
+	    TOBN(0xc9be4f2d, 0x1d1329e8), TOBN(0x5c20884e, 0x3168fc55),
+	    TOBN(0x00000000, 0x0000009b),
+	},
+	{
+	    TOBN(0x6e9fd410, 0x9cb47277), TOBN(0x16c1621d, 0x96d54227),
+	    TOBN(0x8656adf3, 0xd61e57db), TOBN(0xd546ecce, 0x2da52da5),
+	    TOBN(0xb41508ee, 0x2098e089), TOBN(0x9cf31199, 0x7499c874),
+	    TOBN(0x96548966, 0xf525839d), TOBN(0x1cdd85c0, 0xa0de08e5),
+	    TOBN(0x00000000, 0x00000051),
+	},
+    },
+    {
+	{
+	    TOBN(0x1b0c2836, 0xeaecc767), TOBN(0x4bf2a950, 0x254a6116),
+	    TOBN(0x47ef2fd2, 0xe137cf31), TOBN(0xb90ffedb, 0x355a2941),
+	    TOBN(0xf0923b8d, 0xe80b1339), TOBN(0x75c266a8, 0x564e1a67),
+	    TOBN(0xb3b6b874, 0x37731150), TOBN(0xc6cbaf62, 0xaa596927),
+	    TOBN(0x00000000, 0x000000d9),
+	},
+	{
+	    TOBN(0x151a8688, 0x14946689), TOBN(0xb35fea0b, 0xc057ff20),
+	    TOBN(0x8572e2e4, 0x09ecf021), TOBN(0xf970c43f, 0x3e468f14),
+	    TOBN(0xfbfcb575, 0xa3dde03f), TOBN(0xedb91413, 0x2e77b56f),
+	    TOBN(0x6382b8b8, 0x8423f07b), TOBN(0x6f1991dc, 0x4ba999cf),
+	    TOBN(0x00000000, 0x00000013),
+	},
+    },
+    {
+	{
+	    TOBN(0x66643337, 0xd33e770c), TOBN(0xce6a3be8, 0x3b99ee54),
+	    TOBN(0x19c49ae8, 0x22689fb4), TOBN(0x55fd84bf, 0x9097495c),
+	    TOBN(0xe7fafa9f, 0xd120cdab), TOBN(0xef6f63fa, 0x5d7078ba),
+	    TOBN(0xf9314fd8, 0x2d67e1a6), TOBN(0xfc982ded, 0x691efdbd),
+	    TOBN(0x00000000, 0x00000070),
+	},
+	{
+	    TOBN(0xaebe9e65, 0x4370edab), TOBN(0x2a22a918, 0x8f229d08),
+	    TOBN(0x838a1e91, 0xd3e08ff7), TOBN(0x244077d1, 0x1fa15146),
+	    TOBN(0xae4d1aa8, 0xf911c255), TOBN(0xe83f28fe, 0x07fa035a),
+	    TOBN(0x677b97f2, 0xe7e4b053), TOBN(0x3a435bf4, 0xc11fbac5),
+	    TOBN(0x00000000, 0x00000187),
+	},
+    },
+    {
+	{
+	    TOBN(0x1584af73, 0x150fab99), TOBN(0x89860825, 0xb448dbd2),
+	    TOBN(0xbf82cdc7, 0x1bc9bb68), TOBN(0xe11d4b2f, 0xf8e8047c),
+	    TOBN(0xa5f47ffa, 0xcec6ca12), TOBN(0x90173868, 0x96c7bfaf),
+	    TOBN(0xc986da55, 0xc30d1093), TOBN(0x9e8a1123, 0xff2ca0fd),
+	    TOBN(0x00000000, 0x00000075),
+	},
+	{
+	    TOBN(0x4c7bc840, 0xad753f38), TOBN(0x961db8f8, 0x48b01eab),
+	    TOBN(0x1bffdae9, 0x500b87ae), TOBN(0xcb303f09, 0x278fe99a),
+	    TOBN(0x96bde975, 0xfe032c1e), TOBN(0xbb42120e, 0x88860fa1),
+	    TOBN(0xf1876966, 0xedc535d2), TOBN(0x6d132ed2, 0x2548ee23),
+	    TOBN(0x00000000, 0x000001bc),
+	},
+    },
+    {
+	{
+	    TOBN(0xf8817650, 0x96b2bc5c), TOBN(0x729bfe1a, 0xbb94d09a),
+	    TOBN(0x71b400f3, 0xf6785bff), TOBN(0xc1908478, 0xd4326c09),
+	    TOBN(0xfa8d21a5, 0xa5a070ab), TOBN(0x182e3e1c, 0xe23f2682),
+	    TOBN(0x9ad16958, 0xcbefe123), TOBN(0x0647e4d7, 0x974e2ba2),
+	    TOBN(0x00000000, 0x000001f9),
+	},
+	{
+	    TOBN(0x84f8d3df, 0x62557ca9), TOBN(0xb7e9b1d4, 0x9b97e45b),
+	    TOBN(0x08292555, 0x2e9d21be), TOBN(0xfd243bad, 0x71d24a01),
+	    TOBN(0x08ba071d, 0xa4aa3062), TOBN(0xf351543a, 0xfa5ee432),
+	    TOBN(0x1397568a, 0xbdb46977), TOBN(0x2282a11d, 0x48d751b5),
+	    TOBN(0x00000000, 0x000000f4),
+	},
+    },
+    {
+	{
+	    TOBN(0x1b130d63, 0x044f329d), TOBN(0x4223ef9f, 0xf91921b5),
+	    TOBN(0x656955ff, 0x5ef5b2dc), TOBN(0x5515b54b, 0x3e7f2fcc),
+	    TOBN(0xb20728dd, 0x66dbecef), TOBN(0x15dcf21d, 0xab0f66c5),
+	    TOBN(0x38287c93, 0x5ac67815), TOBN(0x71021b73, 0xd4cf206d),
+	    TOBN(0x00000000, 0x00000016),
+	},
+	{
+	    TOBN(0x8cb562bf, 0xd5bd8514), TOBN(0xe506a613, 0x361c7847),
+	    TOBN(0x288a67c6, 0x9c3fd3e2), TOBN(0x15691f59, 0x67ab1319),
+	    TOBN(0x2652080d, 0x08a4a8ab), TOBN(0x05d3b8e3, 0x251b0510),
+	    TOBN(0xa555b2a5, 0x608feb6f), TOBN(0x592acd16, 0x12ddcc54),
+	    TOBN(0x00000000, 0x0000012f),
+	},
+    },
+    {
+	{
+	    TOBN(0xa40bf3fd, 0xb18df626), TOBN(0x861887dd, 0xa204756a),
+	    TOBN(0x83b1633e, 0x532dc755), TOBN(0x3fad93ed, 0xc2466ab1),
+	    TOBN(0x9edb50d6, 0xf197f182), TOBN(0x0ec275c0, 0x1393c4f4),
+	    TOBN(0xee81d86d, 0xe37e97cc), TOBN(0x55252ba4, 0x336d4642),
+	    TOBN(0x00000000, 0x00000154),
+	},
+	{
+	    TOBN(0x3da97be9, 0x4b007d09), TOBN(0x9da7d01d, 0xd905b0ae),
+	    TOBN(0x1356365b, 0xcfceed54), TOBN(0xea60ba0e, 0x23f247e5),
+	    TOBN(0x14b745af, 0x77b249c8), TOBN(0x8fcdd6dc, 0x34502fa7),
+	    TOBN(0xa94277a8, 0xc2417fb2), TOBN(0x7256c63d, 0x1fc5f4d6),
+	    TOBN(0x00000000, 0x0000006f),
+	},
+    },
+    {
+	{
+	    TOBN(0x8f1146b4, 0x8ede81f3), TOBN(0xfbeccb57, 0xbba8f5ca),
+	    TOBN(0x16a9020d, 0xf0450d16), TOBN(0xbc7fce40, 0x8551f8a4),
+	    TOBN(0x03713339, 0xeac9ff5f), TOBN(0x93ca292d, 0x680d9292),
+	    TOBN(0x12917240, 0xc1235dee), TOBN(0x67fd8d75, 0x3546dc71),
+	    TOBN(0x00000000, 0x000001cb),
+	},
+	{
+	    TOBN(0x170d7ca4, 0x35014583), TOBN(0xbe11a8e3, 0x18ac7cfb),
+	    TOBN(0x75b8ce97, 0x3f2ad41e), TOBN(0x964c6e23, 0x66786d41),
+	    TOBN(0xd0132735, 0x9e42a985), TOBN(0x8f6bae9e, 0xe8729abc),
+	    TOBN(0xb0db25f8, 0x3a373fcc), TOBN(0x9347da9b, 0x9127a3f4),
+	    TOBN(0x00000000, 0x0000016b),
+	},
+    },
+    {
+	{
+	    TOBN(0xf1bb652d, 0x202a1e08), TOBN(0xeb9f9b1f, 0x6ac0dd5d),
+	    TOBN(0xbfeb21d5, 0xcd4c76e9), TOBN(0x658dfeba, 0xfbab40c7),
+	    TOBN(0x661e55e0, 0xc33d8a1b), TOBN(0x68476fdb, 0x96e3c9d6),
+	    TOBN(0xbb53fba6, 0xe858301d), TOBN(0x952b2fb0, 0x6d1738ef),
+	    TOBN(0x00000000, 0x000001d9),
+	},
+	{
+	    TOBN(0xf2fbf3be, 0x1d6b28d8), TOBN(0x8e39efb7, 0xa27ce84a),
+	    TOBN(0x02d7cae4, 0x2fdcd9ef), TOBN(0xa54a91fa, 0x23d22019),
+	    TOBN(0xb7b4ce8e, 0xac9c2d4b), TOBN(0x9ca0d838, 0x66dabf86),
+	    TOBN(0x9f0bff6a, 0x340a7ae7), TOBN(0x11aff1d3, 0xc2363906),
+	    TOBN(0x00000000, 0x0000010d),
+	},
+    },
+    {
+	{
+	    TOBN(0x7e994642, 0xcfb25918), TOBN(0xe5e2920f, 0x05142e2a),
+	    TOBN(0x3187eb20, 0xb3b94feb), TOBN(0x09ecd927, 0x1da028dc),
+	    TOBN(0xf5cc5c3b, 0x8a8d6425), TOBN(0x56acf1f2, 0x381c1326),
+	    TOBN(0x1f133c02, 0x9a9010ad), TOBN(0xde9d245e, 0xc92129b2),
+	    TOBN(0x00000000, 0x00000198),
+	},
+	{
+	    TOBN(0x1c21ec0e, 0x6d701895), TOBN(0x16e0016e, 0x148cb74a),
+	    TOBN(0x178accfc, 0x28e49870), TOBN(0xda1ee85e, 0x2434e25f),
+	    TOBN(0x471cb421, 0x4ec328e4), TOBN(0x055e4b67, 0x2a293046),
+	    TOBN(0x5101c47a, 0x72e918f8), TOBN(0xe95ba792, 0x0cdc1989),
+	    TOBN(0x00000000, 0x00000098),
+	},
+    },
+    {
+	{
+	    TOBN(0x12430432, 0x97a243d2), TOBN(0x247a989b, 0xe42e86e1),
+	    TOBN(0xef5f5d3e, 0x669f466d), TOBN(0xbb919966, 0xfa04a2d9),
+	    TOBN(0x5eefa761, 0x435173a7), TOBN(0xc7fd0b8a, 0x4bbef42b),
+	    TOBN(0x370ed186, 0x521d9632), TOBN(0xeb75a36c, 0x7d016ce7),
+	    TOBN(0x00000000, 0x00000003),
+	},
+	{
+	    TOBN(0x98bbbb31, 0x9da55458), TOBN(0x4c79d06f, 0x78398930),
+	    TOBN(0x4c127e15, 0x15929ddf), TOBN(0x59808240, 0x54132192),
+	    TOBN(0xb84ed525, 0xef5ec192), TOBN(0x806334bf, 0x7fb6a4f0),
+	    TOBN(0x88b6cdd5, 0x5e010389), TOBN(0xd1208d99, 0x8cfea8bb),
+	    TOBN(0x00000000, 0x000001dc),
+	},
+    },
+    {
+	{
+	    TOBN(0xbfe2de3a, 0x66efe1c5), TOBN(0x739abb52, 0x3988d8e8),
+	    TOBN(0xafb5d873, 0xd719823f), TOBN(0xa2752694, 0xb134d9a5),
+	    TOBN(0x6ac7ffac, 0xee4d930a), TOBN(0x2500ae35, 0x985724c5),
+	    TOBN(0x1b0d21ed, 0xb14a80db), TOBN(0xf2d3ff6b, 0x93f038fb),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x9e7d0ecc, 0x08659a8f), TOBN(0x4b3115e8, 0x2a2b68a3),
+	    TOBN(0x71ec9cda, 0x482879da), TOBN(0x9a639b3b, 0xc601de06),
+	    TOBN(0x39701e39, 0x2daf39d4), TOBN(0x807b7e59, 0x40277934),
+	    TOBN(0x7d6e3e3e, 0xed89b81d), TOBN(0x6513ab99, 0x16bddfe7),
+	    TOBN(0x00000000, 0x0000002a),
+	},
+    },
+    {
+	{
+	    TOBN(0x33ba4cdd, 0xb79cc685), TOBN(0x0d8928ef, 0x7bf32879),
+	    TOBN(0x985cd627, 0xd536229a), TOBN(0xaec3658a, 0x8a87e35a),
+	    TOBN(0xc70d93f9, 0x00335f32), TOBN(0x2635d9c8, 0xb22cf863),
+	    TOBN(0x4acaf282, 0xf099cb19), TOBN(0xe457d46f, 0xf58ff1ff),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x58d6cf28, 0x7aaaf607), TOBN(0xcce684b3, 0x33d67fd4),
+	    TOBN(0x7714abbe, 0xb9562731), TOBN(0xe961f105, 0xaa8fa887),
+	    TOBN(0xf9f18291, 0xaef67aa3), TOBN(0x033a6392, 0x67402f44),
+	    TOBN(0x8b6602e3, 0x23a113eb), TOBN(0x9d74d481, 0x8296da92),
+	    TOBN(0x00000000, 0x00000173),
+	},
+    },
+    {
+	{
+	    TOBN(0xf846d3fa, 0x16233ea2), TOBN(0x20b6d2c5, 0xad45fbe7),
+	    TOBN(0xd126d691, 0xb7602954), TOBN(0x83989387, 0xa011a584),
+	    TOBN(0xb92401de, 0x96ccfb23), TOBN(0x2ad7ea06, 0x88504bf8),
+	    TOBN(0xe1ab0d36, 0xa2666f4e), TOBN(0xa670f288, 0xcb8c76c8),
+	    TOBN(0x00000000, 0x000001b9),
+	},
+	{
+	    TOBN(0x5348cb0a, 0x18530329), TOBN(0x88fd1924, 0x249e7744),
+	    TOBN(0xed49b637, 0x325c81ee), TOBN(0x3a1f7741, 0x292b3441),
+	    TOBN(0xa9bd2214, 0x71b3d6df), TOBN(0x7fd9ed5e, 0xd28e01ff),
+	    TOBN(0xdb9c4869, 0x357f6a02), TOBN(0x818ffe0d, 0x4ab24ac5),
+	    TOBN(0x00000000, 0x00000171),
+	},
+    },
+    {
+	{
+	    TOBN(0x5af081b9, 0x2fa4b5b6), TOBN(0xb3f79fdf, 0x341b1410),
+	    TOBN(0x1084f0f5, 0x4e6cb71b), TOBN(0x330cc554, 0x0dcfc2a2),
+	    TOBN(0xc10a5a45, 0x2be6eb04), TOBN(0x4243fb83, 0x532afffd),
+	    TOBN(0xda7b80ae, 0x40f5fc19), TOBN(0xa011d171, 0x3c94ac3b),
+	    TOBN(0x00000000, 0x000001d1),
+	},
+	{
+	    TOBN(0x08d2db24, 0xd7077e07), TOBN(0xf71794c0, 0x844bbdf7),
+	    TOBN(0xec1804ea, 0x98406000), TOBN(0x2e92ab08, 0xec8562bd),
+	    TOBN(0xe16b0c98, 0x5e87eb4b), TOBN(0x6f565bdb, 0x50188001),
+	    TOBN(0x7383444c, 0xb62efd54), TOBN(0x28fb2db4, 0x8fd570e2),
+	    TOBN(0x00000000, 0x00000124),
+	},
+    },
+    {
+	{
+	    TOBN(0xb8460c0c, 0x98ee658e), TOBN(0xff1641b7, 0xbb7c1136),
+	    TOBN(0x0f35d688, 0x79c49278), TOBN(0x50aef9bc, 0xae58e7f3),
+	    TOBN(0x27246797, 0xf7b5d7d2), TOBN(0xe9e46b56, 0xe6fbfaad),
+	    TOBN(0x5841f181, 0x6d203aa4), TOBN(0x17aeed1a, 0x0403707a),
+	    TOBN(0x00000000, 0x00000057),
+	},
+	{
+	    TOBN(0x274ac213, 0xd6e8ab72), TOBN(0x03d26304, 0x2f071bd6),
+	    TOBN(0x2bafcaa7, 0xb4d362dc), TOBN(0x234f17f1, 0x2e25f565),
+	    TOBN(0x3b1bcc85, 0xa70dd68f), TOBN(0x0237a6bf, 0xf5825434),
+	    TOBN(0x827dd210, 0x14ffd6e3), TOBN(0x34bd5402, 0xfca83c20),
+	    TOBN(0x00000000, 0x00000115),
+	},
+    },
+};
+static const BN_ULONG
+ec_comb_p521_offset_mont[2][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0xfcb122e0, 0x6540da31), TOBN(0x7aea5e17, 0x24231b30),
+	    TOBN(0x58607327, 0x73165cd5), TOBN(0x998218eb, 0x564efe28),
+	    TOBN(0x1cc3dd5f, 0xd27fdac1), TOBN(0xd0aac612, 0xd5ad2ad3),
+	    TOBN(0x8c4e382e, 0x3376cd64), TOBN(0x07043772, 0x10cc84bd),
+	    TOBN(0x00000000, 0x000001c2),
+	},
+	{
+	    TOBN(0xc42122de, 0x14881c6d), TOBN(0x338d0bdd, 0x333b8e84),
+	    TOBN(0x41f507d9, 0x0a4c6c6d), TOBN(0x6904daad, 0xb2c58ef5),
+	    TOBN(0xa20173b8, 0x3fbc4377), TOBN(0x113c628d, 0x6b4cdd44),
+	    TOBN(0xa872b965, 0x6c04dad6), TOBN(0x63f5e629, 0x12944756),
+	    TOBN(0x00000000, 0x00000178),
+	},
+    },
+    {
+	{
+	    TOBN(0x73480be4, 0xb4c5847c), TOBN(0xa7941b99, 0x46148bc0),
+	    TOBN(0x9faccec1, 0x659542d4), TOBN(0xde131774, 0xce3fec29),
+	    TOBN(0x2fd6afd2, 0xaba815e8), TOBN(0xa42d91be, 0x3f717e4d),
+	    TOBN(0x54a063db, 0xc60fff2c), TOBN(0x613170fe, 0x477100ea),
+	    TOBN(0x00000000, 0x000001f6),
+	},
+	{
+	    TOBN(0x892a48de, 0xf3682ad3), TOBN(0xb98afbde, 0x8148ec97),
+	    TOBN(0xb9968023, 0x09693ebf), TOBN(0x1b628220, 0xfe2b2832),
+	    TOBN(0x0c314461, 0xaa2dea54), TOBN(0x0154fd15, 0xf39da002),
+	    TOBN(0x5f8ac8f1, 0x1ec1f9c1), TOBN(0x3548ff02, 0x852557a2),
+	    TOBN(0x00000000, 0x000000ca),
+	},
+    },
+};
+
+#else
+static const BN_ULONG
+ec_comb_p521_table_mont[EC_COMB_TABLES << EC_COMB_TEETH][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x18e172de, 0xb331a163), TOBN(0xe0c2b521, 0x4dfcbf3f),
+	    TOBN(0x93d17fd4, 0x6f19a459), TOBN(0x3bf7f3ac, 0x947f0ee0),
+	    TOBN(0xb035a69e, 0xdd50a5af), TOBN(0x9c829fda, 0x90fc1457),
+	    TOBN(0xb311cada, 0x214e3240), TOBN(0x5b820274, 0xe6cf1f65),
+	    TOBN(0x00000000, 0x00000103),
+	},
+	{
+	    TOBN(0x3b4fe8b3, 0x28460e4a), TOBN(0x43513961, 0x20445f4a),
+	    TOBN(0x809fd683, 0xb09a9e38), TOBN(0x4caf7a13, 0x2062a85c),
+	    TOBN(0x8b939f33, 0x164bf739), TOBN(0x24abcda2, 0x340bd7de),
+	    TOBN(0xda163e8d, 0xeccc7aa2), TOBN(0x3c4d1de0, 0x022e452f),
+	    TOBN(0x00000000, 0x000000b5),
+	},
+    },
+    {
+	{
+	    TOBN(0x1433b543, 0xad081cbd), TOBN(0x94641d24, 0x88d8cd2c),
+	    TOBN(0xd8e36e70, 0x2da0394f), TOBN(0x461fe782, 0x48288ca4),
+	    TOBN(0x6f063613, 0xa112c8a6), TOBN(0x77efb66b, 0xb8624a48),
+	    TOBN(0x016e8d41, 0x511d90ff), TOBN(0x5bb229a1, 0xce809694),
+	    TOBN(0x00000000, 0x000000d0),
+	},
+	{
+	    TOBN(0x3ecdac71, 0x36feced9), TOBN(0xee8e2857, 0x921f42e8),
+	    TOBN(0x2c3ef9bb, 0xe82b293d), TOBN(0xac32f4bd, 0x182b25ab),
+	    TOBN(0x74b598de, 0x297ad819), TOBN(0xd5e666a5, 0xdd15916b),
+	    TOBN(0x447be0b1, 0x51456a24), TOBN(0x8726ab79, 0x4dc25c5c),
+	    TOBN(0x00000000, 0x0000003f),
+	},
+    },
+    {
+	{
+	    TOBN(0x77db71ab, 0x7da11531), TOBN(0x2f86ae14, 0x4a8ea204),
+	    TOBN(0xdadf3376, 0x5fcd7540), TOBN(0x9c187bde, 0xca2b2c0b),
+	    TOBN(0x44989497, 0xb2a257fb), TOBN(0x727e450f, 0xc8ca1f92),
+	    TOBN(0xbe561866, 0xabef25b7), TOBN(0xa982f983, 0xbd50e315),
+	    TOBN(0x00000000, 0x000000dd),
+	},
+	{
+	    TOBN(0x4b8d4316, 0x7d957106), TOBN(0x2f10d24f, 0x2b2dc36b),
+	    TOBN(0xa3a199f9, 0x55a3f0d4), TOBN(0x82e184b9, 0x9da2daf1),
+	    TOBN(0x7b44fd07, 0xccd6106f), TOBN(0xbb59da66, 0x647883bb),
+	    TOBN(0xb7794a59, 0x8060f3a4), TOBN(0x85cad9c3, 0xa622c4dd),
+	    TOBN(0x00000000, 0x000001c9),
+	},
+    },
+    {
+	{
+	    TOBN(0x674c0fe9, 0x449a64c8), TOBN(0x01e88fe6, 0x81603532),
+	    TOBN(0x913b8697, 0x595c6e13), TOBN(0x3b6d478c, 0xf6f513d4),
+	    TOBN(0xb2857351, 0x88c1e320), TOBN(0xdfb9fd43, 0x90cfb68d),
+	    TOBN(0xcc660149, 0x6c4bb93b), TOBN(0x73e97063, 0x3f388af7),
+	    TOBN(0x00000000, 0x000001bd),
+	},
+	{
+	    TOBN(0xacae0a8b, 0x9a5258fb), TOBN(0xba0560ab, 0xb741a40d),
+	    TOBN(0x3978bc6a, 0x795d005e), TOBN(0x1c0b2496, 0xcaa47999),
+	    TOBN(0x6ddcefe7, 0x1ff04fef), TOBN(0xf281ff39, 0x47c3b092),
+	    TOBN(0x23027cc7, 0xcc93f3d8), TOBN(0x2ea46e78, 0x773c9a3f),
+	    TOBN(0x00000000, 0x00000046),
+	},
+    },
+    {
+	{
+	    TOBN(0x00ea6706, 0x6d44c643), TOBN(0x377f0477, 0x558181e6),
+	    TOBN(0x0b89a9ba, 0x9a2c24c1), TOBN(0x7eeabeb5, 0x410a4915),
+	    TOBN(0xccb4deab, 0x273cb7a0), TOBN(0xe466d878, 0xefac0344),
+	    TOBN(0x87b2de51, 0xbb91ff68), TOBN(0xa5b8b039, 0x9085187f),
+	    TOBN(0x00000000, 0x00000030),
+	},
+	{
+	    TOBN(0x46373541, 0xd3b92435), TOBN(0xb2ee6170, 0x66b0a489),
+	    TOBN(0x5a343080, 0x90e6e977), TOBN(0xaebefdbc, 0x6188ae21),
+	    TOBN(0x1290f6f8, 0x5fd9fed6), TOBN(0x7bc9570f, 0x4a970b67),
+	    TOBN(0x67effbc9, 0xa2a8aafe), TOBN(0x975bfc20, 0xbff88786),
+	    TOBN(0x00000000, 0x000000c1),
+	},
+    },
+    {
+	{
+	    TOBN(0xf45baed1, 0x5dfe0eb5), TOBN(0xc740f2ea, 0xe4c6b98b),
+	    TOBN(0x785cea45, 0x05b63001), TOBN(0xb727650e, 0x6825582c),
+	    TOBN(0x2740e686, 0xd274870a), TOBN(0x98fd5666, 0x1fb6adc8),
+	    TOBN(0xf97e127b, 0x79ec1a23), TOBN(0xafe8b0a2, 0x2574b5d3),
+	    TOBN(0x00000000, 0x0000008e),
+	},
+	{
+	    TOBN(0xb35f2654, 0x4b14b429), TOBN(0x80f5adb1, 0x29a893ce),
+	    TOBN(0x9864cd94, 0x6e1724ea), TOBN(0x7b77ca64, 0x273ed676),
+	    TOBN(0xaed52651, 0x4117a69f), TOBN(0xeb9bf1b9, 0x29a96e35),
+	    TOBN(0xff03fb68, 0x4046e50b), TOBN(0x1af253bc, 0x7fb84d23),
+	    TOBN(0x00000000, 0x0000006b),
+	},
+    },
+    {
+	{
+	    TOBN(0x144fa6ec, 0x1e4e4c8d), TOBN(0x6557453a, 0xd6d894c7),
+	    TOBN(0x848cd099, 0xc2c6e654), TOBN(0x40545d3b, 0x41494636),
+	    TOBN(0x889ff366, 0x2dbc9cc2), TOBN(0x8e2c42d1, 0x211f4e65),
+	    TOBN(0x99e1b56e, 0x32b1563b), TOBN(0x09ff6691, 0x6eb28a5d),
+	    TOBN(0x00000000, 0x0000006b),
+	},
+	{
+	    TOBN(0xde2df746, 0x54048b2c), TOBN(0x48de5c48, 0x90e44888),
+	    TOBN(0xf4facff6, 0xfec85ddf), TOBN(0x9f839147, 0xc851e0b2),
+	    TOBN(0xd591c5db, 0x81f9feac), TOBN(0xbc75e22d, 0x00101151),
+	    TOBN(0x6848e743, 0x0554bee6), TOBN(0x95e9f8a0, 0xdb192938),
+	    TOBN(0x00000000, 0x000000d5),
+	},
+    },
+    {
+	{
+	    TOBN(0x5f8128c4, 0xea56e1b7), TOBN(0xe5e0d92d, 0x028409b6),
+	    TOBN(0xf3b74f68, 0x8ed0e1c4), TOBN(0x35d3f9f9, 0xc55f66d6),
+	    TOBN(0x3bde4296, 0xdeb2ab80), TOBN(0x25e29f7e, 0xa7cb6b64),
+	    TOBN(0x087f5f23, 0x9b9d057f), TOBN(0x1dc271af, 0x17e3fac2),
+	    TOBN(0x00000000, 0x0000015d),
+	},
+	{
+	    TOBN(0xd926fd3e, 0xd463cbb3), TOBN(0xab9ee679, 0x014b12b6),
+	    TOBN(0x1f47e609, 0x3a1bcb9a), TOBN(0xf44f73dc, 0x17170593),
+	    TOBN(0xd2a12e51, 0x3b0a4387), TOBN(0x473ec3b7, 0x3ce5c7cd),
+	    TOBN(0x6aef1796, 0x7f341e3a), TOBN(0x8fa42a38, 0x09a474c8),
+	    TOBN(0x00000000, 0x00000047),
+	},
+    },
+    {
+	{
+	    TOBN(0x9784cbad, 0x40ec928e), TOBN(0xd37ee363, 0xba3455ae),
+	    TOBN(0xa9b93d34, 0x43bd66c7), TOBN(0xd9077407, 0xe90fd9e7),
+	    TOBN(0x52943c68, 0x93c15c66), TOBN(0x78f2624a, 0x6334a2f3),
+	    TOBN(0x8c9c7b2b, 0x7cf49dcc), TOBN(0xf7b7e350, 0x03d1d7c1),
+	    TOBN(0x00000000, 0x0000003b),
+	},
+	{
+	    TOBN(0x04b9d2e0, 0x38d9982b), TOBN(0xad235a9f, 0x72ecadf9),
+	    TOBN(0xa7769467, 0x4ba7d206), TOBN(0x8fd05a97, 0xe64df833),
+	    TOBN(0xb2849665, 0x75a8a11e), TOBN(0x78256b06, 0x912b88dc),
+	    TOBN(0xfd89ace3, 0x2a022fe5), TOBN(0x8629a18e, 0x394edb88),
+	    TOBN(0x00000000, 0x000001d3),
+	},
+    },
+    {
+	{
+	    TOBN(0x9defd741, 0x6a3c2f83), TOBN(0x7887e8d0, 0x334ef51e),
+	    TOBN(0x7622f594, 0xf6ee056e), TOBN(0x2b825c84, 0x6fc59a5b),
+	    TOBN(0x54e119c1, 0x8eb4df40), TOBN(0xac3dd9b1, 0x13778208),
+	    TOBN(0xa5f889c1, 0xac687391), TOBN(0x7aab621a, 0x10b2bda3),
+	    TOBN(0x00000000, 0x000001b7),
+	},
+	{
+	    TOBN(0x0d7239b2, 0x682e668e), TOBN(0x01069cd9, 0xfe0ee22a),
+	    TOBN(0xaa5fbca4, 0xdbf4ee13), TOBN(0xf53d2b22, 0x691ca9b7),
+	    TOBN(0x42c61a6f, 0x0b736b92), TOBN(0xfef878d1, 0xbeef84a2),
+	    TOBN(0x32837b1f, 0x85038f88), TOBN(0x27ad3548, 0x4fc7c2b0),
+	    TOBN(0x00000000, 0x0000014b),
+	},
+    },
+    {
+	{
+	    TOBN(0xfa1e5a2b, 0x143f2a12), TOBN(0xf7560fcf, 0x876b13dc),
+	    TOBN(0xedce7db1, 0x5174f8da), TOBN(0x7532ba53, 0xd2b14898),
+	    TOBN(0xed9ef8e0, 0x131222c9), TOBN(0xe3b19c84, 0x7754925c),
+	    TOBN(0xaecd65c2, 0x6d0513db), TOBN(0x990d6890, 0x1ee2f84e),
+	    TOBN(0x00000000, 0x000000a1),
+	},
+	{
+	    TOBN(0x596ded62, 0x7cc6e5ab), TOBN(0x0d768678, 0x7f8132b8),
+	    TOBN(0x47d7d7a2, 0xfa245fe8), TOBN(0x2c7af455, 0x5a23a6e2),
+	    TOBN(0x73b1642d, 0x6b61eb65), TOBN(0x86940c8b, 0x0cd2cc61),
+	    TOBN(0xc0b2cf57, 0x97560f24), TOBN(0xc4916e0e, 0x527107a5),
+	    TOBN(0x00000000, 0x0000010e),
+	},
+    },
+    {
+	{
+	    TOBN(0xca5f3b09, 0x6d3fb365), TOBN(0x6110e81d, 0x6288e9d2),
+	    TOBN(0xb508cf18, 0xa3edcbd5), TOBN(0x2a0cfa25, 0x911b9fc5),
+	    TOBN(0xf0bd29e4, 0xe023773b), TOBN(0xbe6fea0c, 0x1a087884),
+	    TOBN(0x3c279ebd, 0x50130c5e), TOBN(0x2ca7f48d, 0x21188b8d),
+	    TOBN(0x00000000, 0x0000000a),
+	},
+	{
+	    TOBN(0x84711819, 0x7a37ff00), TOBN(0x3fbf6763, 0xaadfdd8b),
+	    TOBN(0xffd43a48, 0xc68350a0), TOBN(0xcde17076, 0x3ef06095),
+	    TOBN(0x24ddf4c2, 0x710ce0f1), TOBN(0xe862485c, 0xc53e5712),
+	    TOBN(0x2efff7c8, 0x439dc538), TOBN(0x36e68a53, 0xea6908fa),
+	    TOBN(0x00000000, 0x00000134),
+	},
+    },
+    {
+	{
+	    TOBN(0x1dea3d5d, 0xbab211b6), TOBN(0x9f2d5c8f, 0x83c039a5),
+	    TOBN(0x413c1e4f, 0xf7610f1e), TOBN(0x474151cd, 0x6069b302),
+	    TOBN(0xd8a8176a, 0xb5ca4e98), TOBN(0x65aa9c02, 0xf12fa4bb),
+	    TOBN(0x94ab6577, 0x43908830), TOBN(0x4e116215, 0xd081f653),
+	    TOBN(0x00000000, 0x00000101),
+	},
+	{
+	    TOBN(0x6a43a231, 0x06b60f95), TOBN(0xef1aba59, 0x63bd1fa3),
+	    TOBN(0x9d4b48d7, 0xb20db9f0), TOBN(0x73ad2fc8, 0x7ff0356c),
+	    TOBN(0x22f75a55, 0x69ee47d4), TOBN(0x7647be8f, 0xfb562145),
+	    TOBN(0xbe7a3c43, 0x2ed7a600), TOBN(0x41caa259, 0xfadb5458),
+	    TOBN(0x00000000, 0x00000039),
+	},
+    },
+    {
+	{
+	    TOBN(0x108d82e0, 0xe3165e47), TOBN(0xbf905e1e, 0xc6b434da),
+	    TOBN(0x56262146, 0x98d1ed4c), TOBN(0x2351416a, 0x0ef5aae2),
+	    TOBN(0xff08b9a0, 0xc9962550), TOBN(0x17943be3, 0x3c86df26),
+	    TOBN(0x2e5469c2, 0xdd4e1522), TOBN(0x41a3200a, 0x832d758e),
+	    TOBN(0x00000000, 0x00000185),
+	},
+	{
+	    TOBN(0x169754ae, 0xccbf11cf), TOBN(0x79636146, 0xc56eed23),
+	    TOBN(0x339a2557, 0x9e8749ab), TOBN(0xbd066703, 0x31ae409b),
+	    TOBN(0xafcbe3af, 0xafb580ce), TOBN(0xb3a217ef, 0x911e4d28),
+	    TOBN(0xeac6527e, 0x946e38b2), TOBN(0x6f558d72, 0xef2425a1),
+	    TOBN(0x00000000, 0x0000013a),
+	},
+    },
+    {
+	{
+	    TOBN(0xb374b7ed, 0x1e164171), TOBN(0x4543f808, 0x13608740),
+	    TOBN(0xf60105f2, 0x940c55bb), TOBN(0x728645fa, 0xb01dba80),
+	    TOBN(0x6d69589c, 0x89cf3497), TOBN(0xb853f27f, 0x225870ba),
+	    TOBN(0xca0ab5ea, 0xa5092fa3), TOBN(0x966f197e, 0x5b32ea7d),
+	    TOBN(0x00000000, 0x0000002b),
+	},
+	{
+	    TOBN(0x40e75edc, 0xb793bf51), TOBN(0xdb72cd78, 0x1fec016e),
+	    TOBN(0xa9a24671, 0xd59de880), TOBN(0x38608a8a, 0x9a0fda21),
+	    TOBN(0xf2e3033f, 0x0d6e6dfc), TOBN(0x60fe934c, 0x100d12f4),
+	    TOBN(0xd26cb3a5, 0x4eb129d8), TOBN(0x467afd9a, 0x66a3371f),
+	    TOBN(0x00000000, 0x000000a4),
+	},
+    },
+    {
+	{
+	    TOBN(0x436c808c, 0xd715e37a), TOBN(0x78232591, 0x8615d6bb),
+	    TOBN(0xca6d68ce, 0x58c6e6b2), TOBN(0xc4c37875, 0xa40e8f75),
+	    TOBN(0xbe962879, 0xc01da381), TOBN(0x5dd3d4cf, 0x58a155d9),
+	    TOBN(0xee99fd85, 0x847d5de7), TOBN(0x8718ee15, 0x8f7f76b4),
+	    TOBN(0x00000000, 0x0000005a),
+	},
+	{
+	    TOBN(0x5302a76b, 0xd4c9f66a), TOBN(0x1b679cdf, 0x647086e4),
+	    TOBN(0xd412c242, 0x93b84a7e), TOBN(0x519ccba0, 0x92243bc4),
+	    TOBN(0x585371f2, 0xd5c3c375), TOBN(0x90f4c0f2, 0x8ba3d06b),
+	    TOBN(0xf573b409, 0x1daa7685), TOBN(0xd831b73c, 0x6342e78b),
+	    TOBN(0x00000000, 0x00000099),
+	},
+    },
+    {
+	{
+	    TOBN(0x86611fe7, 0xfedb19d5), TOBN(0xe61c4cd2, 0xcec77a63),
+	    TOBN(0x44d1f7bb, 0x78d4f317), TOBN(0x97f2678e, 0xca64f606),
+	    TOBN(0x973e94b1, 0x3df60064), TOBN(0x4cf6d241, 0x586e15eb),
+	    TOBN(0xa7f418b0, 0xc8544689), TOBN(0x14500a96, 0x1d9a3596),
+	    TOBN(0x00000000, 0x00000117),
+	},
+	{
+	    TOBN(0x1cf2f437, 0x0053ebc9), TOBN(0x5603ed3f, 0xd3f2ef05),
+	    TOBN(0x05c3ddf1, 0x86318b0c), TOBN(0x4c9850e3, 0x0409de45),
+	    TOBN(0xb37a5bce, 0x5b23e8f7), TOBN(0x5d70a428, 0x5dfe49f5),
+	    TOBN(0xdfac37f5, 0xd3b82845), TOBN(0x4612a17e, 0xd7722456),
+	    TOBN(0x00000000, 0x0000006d),
+	},
+    },
+    {
+	{
+	    TOBN(0x14df43be, 0x693fc952), TOBN(0xe9b2ac87, 0x6ff2e2f0),
+	    TOBN(0xde37e36c, 0x0473ba3c), TOBN(0x995822d1, 0x6bd542c3),
+	    TOBN(0x186aa1cf, 0x63181ec8), TOBN(0xae631dcc, 0xad7ff8fb),
+	    TOBN(0x5571a64f, 0x4aeef83a), TOBN(0x36e9bce5, 0x7bc806f2),
+	    TOBN(0x00000000, 0x00000173),
+	},
+	{
+	    TOBN(0xa8a899b2, 0xeba27275), TOBN(0x97f2870a, 0x286af60a),
+	    TOBN(0x82fa855d, 0x9223267a), TOBN(0x2d53b8ec, 0x14b77e31),
+	    TOBN(0x723a2606, 0xd11b8b3b), TOBN(0x3b199c2f, 0xabdb5084),
+	    TOBN(0x49338ce9, 0xea2a7f0c), TOBN(0xe5b6c00a, 0x49daee02),
+	    TOBN(0x00000000, 0x0000017b),
+	},
+    },
+    {
+	{
+	    TOBN(0xd2642a6f, 0x9925b17e), TOBN(0xf8603efd, 0xbfa634b4),
+	    TOBN(0x392067f5, 0xc7f3a928), TOBN(0x6f28e9b4, 0x7c16fc58),
+	    TOBN(0x707c04b3, 0x75ee934f), TOBN(0xf8594bbc, 0x39e959eb),
+	    TOBN(0xdbbe2e7e, 0x6a57f8ad), TOBN(0xd8cdbef1, 0xefa400a2),
+	    TOBN(0x00000000, 0x000001b0),
+	},
+	{
+	    TOBN(0x7af010bb, 0xfbe73a5e), TOBN(0xa272797e, 0x1c2065fc),
+	    TOBN(0x2255180e, 0xee93c252), TOBN(0xd8327815, 0xa3ad3c62),
+	    TOBN(0xf06f7d30, 0xae5c934f), TOBN(0x34448bdd, 0x7e7629b4),
+	    TOBN(0xa5cc8daa, 0x0cc838bd), TOBN(0xc5e9cfbf, 0xf3ace097),
+	    TOBN(0x00000000, 0x000001e8),
+	},
+    },
+    {
+	{
+	    TOBN(0x18985f1f, 0x9db1fe11), TOBN(0x8263d343, 0x78d5eabe),
+	    TOBN(0x684be78a, 0xe72f6adc), TOBN(0x4ac629d3, 0x1110de2e),
+	    TOBN(0xff51afdb, 0x8b076c3b), TOBN(0x2dab26ac, 0x9d6bce1a),
+	    TOBN(0xf32577f3, 0xb259497f), TOBN(0x7c305c43, 0xaf3df224),
+	    TOBN(0x00000000, 0x00000119),
+	},
+	{
+	    TOBN(0xcb55a483, 0x58e86e0f), TOBN(0xb115e1b5, 0x77311650),
+	    TOBN(0xcb923807, 0x5e79014f), TOBN(0xd93cf131, 0xa16d81a0),
+	    TOBN(0x13247e4b, 0x18ce0710), TOBN(0x407ef8e3, 0xf71ac5be),
+	    TOBN(0x1a30c128, 0x02f62de5), TOBN(0x1b75cc6e, 0xe74482a5),
+	    TOBN(0x00000000, 0x00000093),
+	},
+    },
+    {
+	{
+	    TOBN(0xd951c97c, 0xfff39ae4), TOBN(0xb77df153, 0x63f8a3ad),
+	    TOBN(0x24799b7a, 0x3464c050), TOBN(0xb84feb94, 0x65b5adc9),
+	    TOBN(0x30bba77d, 0x31fc1615), TOBN(0x6246feae, 0xbfab5458),
+	    TOBN(0x6cf3ebb2, 0xf89089c8), TOBN(0xb343774a, 0x261695c9),
+	    TOBN(0x00000000, 0x000000a5),
+	},
+	{
+	    TOBN(0xadea2d4e, 0x4cb89f5c), TOBN(0x639e122b, 0x79cbc704),
+	    TOBN(0x27e4de18, 0x5c077904), TOBN(0x5551c4fc, 0xb2463eb4),
+	    TOBN(0xd99ad27e, 0xeb032724), TOBN(0x5127b118, 0x067f5c4b),
+	    TOBN(0x58487b33, 0xff42d1cd), TOBN(0x76d16606, 0x90818ac3),
+	    TOBN(0x00000000, 0x00000179),
+	},
+    },
+    {
+	{
+	    TOBN(0x0fca7347, 0x22315df1), TOBN(0x7165687c, 0xe7995e94),
+	    TOBN(0xc7c72ea6, 0xeb1e178b), TOBN(0x30a9685e, 0x3f872ab8),
+	    TOBN(0x6bae3a68, 0x0fe6469e), TOBN(0x1b67e3d5, 0x19b79219),
+	    TOBN(0xadbbc714, 0x5b37bed6), TOBN(0xedf44085, 0x2d95a5d8),
+	    TOBN(0x00000000, 0x0000004a),
+	},
+	{
+	    TOBN(0x821a6641, 0x1d413e5f), TOBN(0x0af29416, 0x5ecbe048),
+	    TOBN(0xe8638e7e, 0xf5b0fb52), TOBN(0xf18bc15d, 0x44c0d03d),
+	    TOBN(0x5620c7cd, 0xfb05d2ae), TOBN(0x1da7dde9, 0xd7cec574),
+	    TOBN(0x71548524, 0xb2c204c3), TOBN(0xb086e3d6, 0x1c701acd),
+	    TOBN(0x00000000, 0x000000ea),
+	},
+    },
+    {
+	{
+	    TOBN(0x09f95ef3, 0xb723051d), TOBN(0x9a4dc893, 0xb9a3cc9e),
+	    TOBN(0x96eb107d, 0xa146f66e), TOBN(0x0f1d99aa, 0x4d70c55c),
+	    TOBN(0x9f016a74, 0x9020918f), TOBN(0x27b0fbfe, 0x9fedc2f4),
+	    TOBN(0x83ec625d, 0x183ba77b), TOBN(0x4bcdf008, 0xa1ea0216),
+	    TOBN(0x00000000, 0x0000011b),
+	},
+	{
+	    TOBN(0x8cbe99cb, 0x36fa1980), TOBN(0x9c6858cc, 0xbdbcdbb9),
+	    TOBN(0x78bb4f33, 0x8baeecbd), TOBN(0xc2bf6158, 0xd2587f15),
+	    TOBN(0x90343bd4, 0x3120e718), TOBN(0x755f602f, 0xd61c38e7),
+	    TOBN(0xa8c2e571, 0x798aba21), TOBN(0x66d2fa85, 0x0a6f16fa),
+	    TOBN(0x00000000, 0x000001ac),
+	},
+    },
+    {
+	{
+	    TOBN(0x3bcd2bf2, 0xb3cdfe38), TOBN(0x1dc1be99, 0x8f9fef4f),
+	    TOBN(0x09e74a43, 0x771a95db), TOBN(0x121984c4, 0x4ef729c0),
+	    TOBN(0x9a0dbab1, 0x2b82a414), TOBN(0x02158786, 0x8a67be5a),
+	    TOBN(0x74ac785c, 0x8d24b640), TOBN(0x85c4fa07, 0x0c73bf6e),
+	    TOBN(0x00000000, 0x00000081),
+	},
+	{
+	    TOBN(0xc80313bb, 0x38546eaf), TOBN(0x8ccae169, 0xdd8c44be),
+	    TOBN(0x811d93b9, 0x402f7734), TOBN(0xde5cab9d, 0x52b2d150),
+	    TOBN(0xadba0928, 0xddc76c9a), TOBN(0x5702338d, 0x9df62197),
+	    TOBN(0x602b3bda, 0x455af118), TOBN(0xade0abc2, 0x812fb7b2),
+	    TOBN(0x00000000, 0x00000046),
+	},
+    },
+    {
+	{
+	    TOBN(0x84619e3c, 0x128067f3), TOBN(0xd9ce0f30, 0x362e7c0f),
+	    TOBN(0xf8867fec, 0xa2011927), TOBN(0xb20eb5dc, 0x68e19931),
+	    TOBN(0x08073cd9, 0xc924d39c), TOBN(0x56d985d1, 0xff664b34),
+	    TOBN(0x17a57306, 0x7061bbe7), TOBN(0x7f680fd5, 0xd8ccfc36),
+	    TOBN(0x00000000, 0x0000017f),
+	},
+	{
+	    TOBN(0x9292d5f2, 0x1f8dcfbe), TOBN(0xd55d4952, 0xb7074c3f),
+	    TOBN(0x650612fd, 0xd7de773d), TOBN(0xd8c168da, 0x81816417),
+	    TOBN(0xc5d8e430, 0xd1125991), TOBN(0xd5f811c8, 0x6ef31c6e),
+	    TOBN(0x817e50c6, 0xee79e519), TOBN(0xa55e08b3, 0x6b0049c1),
+	    TOBN(0x00000000, 0x0000011a),
+	},
+    },
+    {
+	{
+	    TOBN(0x34c87578, 0xf69c60e8), TOBN(0x6ea63b2c, 0xfb2ac4ec),
+	    TOBN(0x2d3c8f28, 0x8adc250b), TOBN(0xf15db28f, 0x543dc44a),
+	    TOBN(0x6ffdfaa5, 0x8fd7d9b2), TOBN(0x3ec888c8, 0x6370c781),
+	    TOBN(0x67739572, 0xb88ccfbf), TOBN(0x7089cac1, 0x563b5fc1),
+	    TOBN(0x00000000, 0x00000172),
+	},
+	{
+	    TOBN(0x1ea2ef5f, 0xf267edb7), TOBN(0xf2d1a16b, 0x910fd620),
+	    TOBN(0x7747b6cb, 0x69381723), TOBN(0xbc0ce504, 0x3e0245f5),
+	    TOBN(0xb9b1343a, 0xf234a8de), TOBN(0xafa182e4, 0x238e24b9),
+	    TOBN(0xeefc7bf3, 0xd4c3cdc5), TOBN(0x702730d6, 0xe2d7a903),
+	    TOBN(0x00000000, 0x000000df),
+	},
+    },
+    {
+	{
+	    TOBN(0x81c8796d, 0x74645e2e), TOBN(0x39afaf91, 0x264839f3),
+	    TOBN(0x930fe1a6, 0xc716197e), TOBN(0xd96349ad, 0x907c9ac5),
+	    TOBN(0x745b478e, 0xdf47a3b1), TOBN(0x111015fc, 0xd68a5905),
+	    TOBN(0x78b38586, 0x4bf498a3), TOBN(0x7cd67f56, 0x56c06c32),
+	    TOBN(0x00000000, 0x000001e3),
+	},
+	{
+	    TOBN(0x43488cc5, 0x0c0cf1d1), TOBN(0x9ba41a4b, 0x01b1f32b),
+	    TOBN(0x3b6df8cd, 0x03aec5cf), TOBN(0x6ec1d585, 0x390f0be5),
+	    TOBN(0x5d0671e8, 0x87a94a2f), TOBN(0x605f2583, 0x584c4b44),
+	    TOBN(0x9b239aab, 0x64da6ddf), TOBN(0x21e6a94e, 0x462cd9de),
+	    TOBN(0x00000000, 0x000001ad),
+	},
+    },
+    {
+	{
+	    TOBN(0xbfa41dc4, 0x2fd73da5), TOBN(0x1ce6f815, 0xf0d3e1ce),
+	    TOBN(0x25aa5163, 0xa0d3e491), TOBN(0x233d8ea2, 0x94144c82),
+	    TOBN(0xf9c3af28, 0x8403779a), TOBN(0x00636f8f, 0x79f5530f),
+	    TOBN(0x433f46c5, 0x43922a6f), TOBN(0x1ce27037, 0xede162b2),
+	    TOBN(0x00000000, 0x00000078),
+	},
+	{
+	    TOBN(0x8a260389, 0x18c8b90f), TOBN(0xc5a89982, 0xd2a1bbcb),
+	    TOBN(0x95f61a39, 0x82acafbd), TOBN(0xebc8dd3c, 0x566413e8),
+	    TOBN(0x4113fe3c, 0x8c1d98d2), TOBN(0x7ebacb07, 0x48e92863),
+	    TOBN(0x800c58dd, 0x8b167493), TOBN(0xd977b752, 0x6d72f717),
+	    TOBN(0x00000000, 0x00000143),
+	},
+    },
+    {
+	{
+	    TOBN(0x1c4c0aa9, 0x6bfdc576), TOBN(0x078a0329, 0x82943456),
+	    TOBN(0xd34873ca, 0xa1c5de20), TOBN(0xdacfb3b3, 0xee0b0f61),
+	    TOBN(0xcade2117, 0xb3b0d00a), TOBN(0x8bcdbfa0, 0x0eb1bcf4),
+	    TOBN(0x3e359771, 0xa49aa12b), TOBN(0x4b1af59a, 0x4dec8d38),
+	    TOBN(0x00000000, 0x000001e7),
+	},
+	{
+	    TOBN(0xcd76cfa8, 0xc1ba054a), TOBN(0x217f52d4, 0x82a24baf),
+	    TOBN(0x8c4b5115, 0xa82f0acf), TOBN(0x009cd595, 0x7c3ccc78),
+	    TOBN(0xcfd62593, 0xecfd0b61), TOBN(0x8fd9ffdf, 0x989519a3),
+	    TOBN(0xa66f3f3e, 0xda20b394), TOBN(0xe0f2f042, 0xea482078),
+	    TOBN(0x00000000, 0x0000012f),
+	},
+    },
+    {
+	{
+	    TOBN(0x87349a5e, 0x1b0585f0), TOBN(0x2619adc2, 0x4334520c),
+	    TOBN(0xbf2c3e7c, 0xe8279728), TOBN(0xa04fbab6, 0xb9f37f16),
+	    TOBN(0x77c1ea83, 0xba53b498), TOBN(0x7b563031, 0x228a7e57),
+	    TOBN(0x46bca4e3, 0xc4aa43d5), TOBN(0xd41e2e70, 0x606a300f),
+	    TOBN(0x00000000, 0x00000089),
+	},
+	{
+	    TOBN(0x30178c83, 0x4d366b3d), TOBN(0xf135e834, 0xcb1fa49d),
+	    TOBN(0xe89f5980, 0x2bba1cfa), TOBN(0xf2efa0c5, 0x06e2aeb0),
+	    TOBN(0x1400d1dc, 0x7ec00407), TOBN(0x1938d560, 0xac321fc5),
+	    TOBN(0x06e881d3, 0xd2bcf9e5), TOBN(0xa7e95f92, 0x385d4f45),
+	    TOBN(0x00000000, 0x0000017d),
+	},
+    },
+    {
+	{
+	    TOBN(0xa129d720, 0x448468dd), TOBN(0x4ac36305, 0x94036bb1),
+	    TOBN(0xf4975461, 0x85f322cf), TOBN(0xa56e735b, 0x64c4966e),
+	    TOBN(0x7f8230dc, 0xa13dd511), TOBN(0xabd37f49, 0x5051a6b5),
+	    TOBN(0x0f861f76, 0xb5dea6f6), TOBN(0x412d5259, 0x0a215bc8),
+	    TOBN(0x00000000, 0x0000009e),
+	},
+	{
+	    TOBN(0xd922cd92, 0x8835376f), TOBN(0xf2db4e34, 0xca92b241),
+	    TOBN(0x2583046f, 0x93d1810f), TOBN(0x83b46e05, 0x7b0c714f),
+	    TOBN(0xc217c385, 0xeec0a3ca), TOBN(0xcae3d501, 0x291801b8),
+	    TOBN(0xa5eaf7a2, 0x0b84c0a3), TOBN(0x1cd12020, 0x9771cf35),
+	    TOBN(0x00000000, 0x000001ed),
+	},
+    },
+    {
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+	{
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000), TOBN(0x00000000, 0x00000000),
+	    TOBN(0x00000000, 0x00000000),
+	},
+    },
+    {
+	{
+	    TOBN(0x7edbcb88, 0xf2fdc439), TOBN(0x19d35421, 0xdb91292b),
+	    TOBN(0xa420a538, 0xd5dee79a), TOBN(0x9cf14f3b, 0x035e9ea2),
+	    TOBN(0x49703f94, 0xe21709fe), TOBN(0x495b47e8, 0x690ca5b7),
+	    TOBN(0xcc2ef057, 0x4deb7af2), TOBN(0xf4a72dd4, 0xb09d6324),
+	    TOBN(0x00000000, 0x000000d7),
+	},
+	{
+	    TOBN(0x25c764e6, 0x7ff7df3b), TOBN(0xb9153d85, 0x1593ef9e),
+	    TOBN(0x117822d7, 0xef6d9489), TOBN(0x1e34e4c9, 0x238e5449),
+	    TOBN(0x58cc8198, 0xbbd3333b), TOBN(0x7b487650, 0x416c6cfb),
+	    TOBN(0xb3068c07, 0xa8085b4b), TOBN(0xcdc16b7b, 0x5e20cc8e),
+	    TOBN(0x00000000, 0x0000013f),
+	},
+    },
+    {
+	{
+	    TOBN(0x224e9112, 0x5c5d4a76), TOBN(0x62ab184a, 0x74621c3b),
+	    TOBN(0xedfb682a, 0x17406495), TOBN(0x16ae2053, 0xc3f7c8cd),
+	    TOBN(0xdf044060, 0xd8e38d44), TOBN(0x86143e57, 0x39ed9c28),
+	    TOBN(0x8b95f9f7, 0xf327b97f), TOBN(0x9200a872, 0x53853147),
+	    TOBN(0x00000000, 0x000001b4),
+	},
+	{
+	    TOBN(0x05661b39, 0x43b98e46), TOBN(0x9ee23198, 0xc1bcc1fc),
+	    TOBN(0x115744fc, 0x64ff1647), TOBN(0xcdf5ac56, 0x0f20d871),
+	    TOBN(0x63cba9c3, 0x92c9feea), TOBN(0xadbac8fd, 0xa72f70b2),
+	    TOBN(0x171aad35, 0x365c71db), TOBN(0xaa0202f9, 0x9d51687d),
+	    TOBN(0x00000000, 0x00000102),
+	},
+    },
+    {
+	{
+	    TOBN(0xc8e9e109, 0x818f7673), TOBN(0x33a83d59, 0xb1e274af),
+	    TOBN(0x762a5fd2, 0x258e840b), TOBN(0x89809a52, 0xa9168684),
+	    TOBN(0x1d2709a7, 0x738d99aa), TOBN(0xf9bc345d, 0x4c7a5cdf),
+	    TOBN(0x55b2d90c, 0x534c67bd), TOBN(0xa7884cf9, 0x8d6a4a37),
+	    TOBN(0x00000000, 0x0000014e),
+	},
+	{
+	    TOBN(0x746ad073, 0x7065b31e), TOBN(0x244f2634, 0x5cc4a5ab),
+	    TOBN(0xa337ecb7, 0xc1719af3), TOBN(0x2d2490a2, 0xf3053c34),
+	    TOBN(0x406f2809, 0x70177b55), TOBN(0x37095cac, 0x5d2c76a6),
+	    TOBN(0x33e01241, 0x63934a0f), TOBN(0xd81235d9, 0x45250e88),
+	    TOBN(0x00000000, 0x00000163),
+	},
+    },
+    {
+	{
+	    TOBN(0xfd292d5f, 0x990d40ea), TOBN(0x0b3c033e, 0xfe2aa0bf),
+	    TOBN(0x7093caf5, 0x350ffa07), TOBN(0x8e77aa62, 0xcba18d05),
+	    TOBN(0x8dcafce9, 0x5de1ef34), TOBN(0x54c13b97, 0x8d305062),
+	    TOBN(0x024b7581, 0xa2184206), TOBN(0x7a430aeb, 0xc1eed7a3),
+	    TOBN(0x00000000, 0x000000fb),
+	},
+	{
+	    TOBN(0x5919f6e7, 0xd2467c3c), TOBN(0xe4ef4ee6, 0x6f3a2cc6),
+	    TOBN(0x8b15339d, 0xd95dc335), TOBN(0xc47f7183, 0x53862418),
+	    TOBN(0x0164075a, 0xdc9f6ee9), TOBN(0xfb8c9b9b, 0x8fc3c2d0),
+	    TOBN(0x2cab4250, 0x82f15ec0), TOBN(0xef0f9370, 0x6da80b24),
+	    TOBN(0x00000000, 0x000001fe),
+	},
+    },
+    {
+	{
+	    TOBN(0xc43e1e40, 0xb111355f), TOBN(0x6768e3ec, 0xef5fc4d6),
+	    TOBN(0x81d45f33, 0x0172c20b), TOBN(0xa9740e4e, 0xcb196cac),
+	    TOBN(0xb71809ad, 0xcb0aa396), TOBN(0xb68d7e0d, 0x56ca761c),
+	    TOBN(0x292db857, 0x00d6aa5d), TOBN(0x0b74b3e0, 0x396e39f2),
+	    TOBN(0x00000000, 0x00000182),
+	},
+	{
+	    TOBN(0x4473afb1, 0x06dccbe6), TOBN(0x291caa6c, 0x55e11ba7),
+	    TOBN(0xd7fa0be3, 0xfabb5483), TOBN(0xa2addb2b, 0x1317e5ae),
+	    TOBN(0x2b60cd83, 0x9820f788), TOBN(0x6730a2e2, 0x2f5d2937),
+	    TOBN(0x5c06b536, 0x5eae8134), TOBN(0x6e7f22f3, 0xdc9f97c1),
+	    TOBN(0x00000000, 0x000001e5),
+	},
+    },
+    {
+	{
+	    TOBN(0x8c2e8efa, 0xb00bde43), TOBN(0x51ace1be, 0xacd8cd58),
+	    TOBN(0xe0926be5, 0xc33afced), TOBN(0xb9df3ee5, 0x32eac533),
+	    TOBN(0x783b5c0d, 0x1c8dcd11), TOBN(0x4833cbf7, 0xdff144a1),
+	    TOBN(0x6e45c036, 0x04154721), TOBN(0x0e66414b, 0xd18e6eda),
+	    TOBN(0x00000000, 0x00000167),
+	},
+	{
+	    TOBN(0xc306b854, 0x0cc3585f), TOBN(0x9508811f, 0x46ed90bf),
+	    TOBN(0xd38eae94, 0xc6f553b6), TOBN(0x77c8387a, 0xcaaa1e2a),
+	    TOBN(0xf832339f, 0x2dd33f8f), TOBN(0x79254d1e, 0xd8dd4a0f),
+	    TOBN(0x9dd6dc05, 0xb8f4ca51), TOBN(0x4fa4a390, 0x7da260dd),
+	    TOBN(0x00000000, 0x00000190),
+	},
+    },
+    {
+	{
+	    TOBN(0x94f7ffce, 0x64d3489e), TOBN(0x31db8fe3, 0x72de1c45),
+	    TOBN(0xf09aa2d4, 0x47a51845), TOBN(0xf146e99d, 0x8c14c239),
+	    TOBN(0xea70aca8, 0xce9decf0), TOBN(0xafe3ddc7, 0xf275d3e5),
+	    TOBN(0xcf66cf23, 0xef2bd5b1), TOBN(0x6726d440, 0x5f5fc6c4),
+	    TOBN(0x00000000, 0x000000fc),
+	},
+	{
+	    TOBN(0xbd4e312f, 0x60efff12), TOBN(0x0110929b, 0xf1a6984d),
+	    TOBN(0x422b3c40, 0x1918fde2), TOBN(0xf58e5f86, 0x42a03bb1),
+	    TOBN(0xd0127fe1, 0x25f1704d), TOBN(0x602b5932, 0xf2489c42),
+	    TOBN(0x6e12cd10, 0xbca66e69), TOBN(0x1c264c7a, 0xa2f92161),
+	    TOBN(0x00000000, 0x00000135),
+	},
+    },
+    {
+	{
+	    TOBN(0x20270840, 0x52546c7f), TOBN(0x13f0d6d8, 0x3c3eb721),
+	    TOBN(0x019eaca7, 0x142e7b62), TOBN(0x025efc29, 0xf973a763),
+	    TOBN(0x6f6199ab, 0x8be00c2a), TOBN(0xb5618bcc, 0x03943eca),
+	    TOBN(0x5fb02749, 0xfbfb9ab2), TOBN(0x7965f13c, 0x0ae9ab79),
+	    TOBN(0x00000000, 0x000000e1),
+	},
+	{
+	    TOBN(0xab6d0e9f, 0x50f295b9), TOBN(0xbf53d7cb, 0x083d8bf1),
+	    TOBN(0xf29d744e, 0x07076abe), TOBN(0x5c2fc15a, 0x51a53561),
+	    TOBN(0x253f8428, 0x7d647b91), TOBN(0x91bd9d62, 0x51a29ead),
+	    TOBN(0xe106dd74, 0x006b7bce), TOBN(0x7ae25c92, 0xc770e4ef),
+	    TOBN(0x00000000, 0x00000078),
+	},
+    },
+    {
+	{
+	    TOBN(0xf098ba96, 0xf41aed58), TOBN(0x91dd326f, 0xaae3ef3b),
+	    TOBN(0x81d40d91, 0x0579afe3), TOBN(0x9f49abc7, 0xe5127fea),
+	    TOBN(0xa9ba4b4a, 0x007d33db), TOBN(0xff0d95be, 0x8f59166d),
+	    TOBN(0x47715fdc, 0xfdf42fd9), TOBN(0x0c847008, 0xb14446aa),
+	    TOBN(0x00000000, 0x00000184),
+	},
+	{
+	    TOBN(0x565ffafa, 0x4dbe6622), TOBN(0x2fc57cab, 0x6c8f61ca),
+	    TOBN(0x1fefc49d, 0xd84e41fa), TOBN(0x2ea2d3e7, 0x89dd3a79),
+	    TOBN(0x23d03b1f, 0x4339dd7b), TOBN(0x36a0a063, 0xd9b75591),
+	    TOBN(0x24215ed5, 0xa2cba007), TOBN(0x7f8166c4, 0xbe9c14ae),
+	    TOBN(0x00000000, 0x00000019),
+	},
+    },
+    {
+	{
+	    TOBN(0xa09aed22, 0x452a0a3f), TOBN(0xb1033548, 0x5f2fa102),
+	    TOBN(0x1dc17f25, 0x8c498c77), TOBN(0x81cdaae5, 0x1510d9e7),
+	    TOBN(0x6978b2d5, 0xd61a2175), TOBN(0xb9d5c0ad, 0x7208a24a),
+	    TOBN(0x02ef4707, 0x9a47aab1), TOBN(0x4dac10e4, 0xd6fcd460),
+	    TOBN(0x00000000, 0x000001d2),
+	},
+	{
+	    TOBN(0xe6dc54a3, 0xc5cdb2e6), TOBN(0xb18b0be8, 0xcbd7da80),
+	    TOBN(0x9dc7e968, 0x9439006e), TOBN(0xa7d1b4e2, 0x5f9cdc21),
+	    TOBN(0x70c9fd42, 0x568be87b), TOBN(0xce283811, 0x886a90e9),
+	    TOBN(0x9d239466, 0x622ad500), TOBN(0x0ce1f371, 0x0bccbd15),
+	    TOBN(0x00000000, 0x000000d9),
+	},
+    },
+    {
+	{
+	    TOBN(0x1eb99440, 0xdd2a610b), TOBN(0x9b3b35a1, 0xf8db9859),
+	    TOBN(0xf33169fa, 0x11de839d), TOBN(0xe574e892, 0x17bd1c27),
+	    TOBN(0x38e818c2, 0x3c99dc92), TOBN(0x15886c0e, 0x06065398),
+	    TOBN(0x60c366af, 0xc034f71c), TOBN(0x97f6fca2, 0x8a2a581f),
+	    TOBN(0x00000000, 0x0000009b),
+	},
+	{
+	    TOBN(0x38d1f7de, 0xa6bb73c0), TOBN(0x1e01a7bc, 0x2fa2525f),
+	    TOBN(0x1705ec99, 0x99b36929), TOBN(0xc81d298c, 0x3d4def18),
+	    TOBN(0x9a6ac9dc, 0xa3f1315b), TOBN(0x79e42b29, 0xbb558d89),
+	    TOBN(0x706c2307, 0xdcfc8ab5), TOBN(0xb43be3cf, 0x4e65e160),
+	    TOBN(0x00000000, 0x00000098),
+	},
+    },
+    {
+	{
+	    TOBN(0xfc2b2189, 0xe3de5c20), TOBN(0xfd184a06, 0x32b418eb),
+	    TOBN(0x674fc54f, 0xf3e5060f), TOBN(0x7cd72584, 0xe8aa4d95),
+	    TOBN(0x64cd8be2, 0x3f5971da), TOBN(0x1ed22418, 0x697d726d),
+	    TOBN(0x857cdf46, 0xbda08332), TOBN(0xe2e88c48, 0xf87687b8),
+	    TOBN(0x00000000, 0x0000004c),
+	},
+	{
+	    TOBN(0x36362c33, 0x86015ffd), TOBN(0xd6e28533, 0x4011ea96),
+	    TOBN(0x1c922322, 0x0eff4790), TOBN(0xb053d212, 0xb8ec45f3),
+	    TOBN(0x4f88de55, 0x1d9ea52a), TOBN(0xd3b2d9a1, 0x3a2d3edf),
+	    TOBN(0x21eba660, 0xcb8f7fd1), TOBN(0x9ed64c54, 0x676f7b42),
+	    TOBN(0x00000000, 0x0000001f),
+	},
+    },
+    {
+	{
+	    TOBN(0x37d0cdd6, 0xd2c40fad), TOBN(0x33aafc44, 0x853cc0b5),
+	    TOBN(0x2ece2bf5, 0x0fcc7908), TOBN(0x5991428b, 0x419f9f52),
+	    TOBN(0xf395b230, 0xbb23c59a), TOBN(0xa1b366ae, 0x602c16d9),
+	    TOBN(0xedc248aa, 0x83215879), TOBN(0x56117ae2, 0x34befed6),
+	    TOBN(0x00000000, 0x0000011c),
+	},
+	{
+	    TOBN(0x0dc6faf6, 0x2722f941), TOBN(0x357a4649, 0x52c49495),
+	    TOBN(0xfe783ef5, 0xb2ba93aa), TOBN(0x47570bf0, 0x72ab89a0),
+	    TOBN(0x3f5496b3, 0xeb6a0871), TOBN(0xd5d890d7, 0x4b59368c),
+	    TOBN(0x195d8bbc, 0x9c177bea), TOBN(0x9a1652e8, 0xd371c436),
+	    TOBN(0x00000000, 0x00000023),
+	},
+    },
+    {
+	{
+	    TOBN(0x13479502, 0x5f0579c1), TOBN(0x29c2d0c1, 0xf3fb158a),
+	    TOBN(0x7b860cbb, 0x613fcbd8), TOBN(0xf4352625, 0x3b27d680),
+	    TOBN(0x952040bc, 0x94f22eb5), TOBN(0x58e3704f, 0x6b73b06d),
+	    TOBN(0x1c92c57d, 0x18c5b864), TOBN(0xffd36d34, 0x46d632db),
+	    TOBN(0x00000000, 0x000000b5),
+	},
+	{
+	    TOBN(0xfc9f8bc5, 0xfb093cd9), TOBN(0x603f6f36, 0x0b0df27a),
+	    TOBN(0x4aaf5724, 0x6ad68667), TOBN(0x6f95c363, 0x127be943),
+	    TOBN(0x334cb549, 0xaaebdb3f), TOBN(0xaea02999, 0x86761e49),
+	    TOBN(0x433a7f3e, 0x917370f4), TOBN(0xf68860fa, 0x0df00cf0),
+	    TOBN(0x00000000, 0x0000003e),
+	},
+    },
+    {
+	{
+	    TOBN(0x1af1a5ce, 0xe40ba4b0), TOBN(0xae1d4749, 0x0595fa1e),
+	    TOBN(0x566c966e, 0xe306008a), TOBN(0x09479306, 0xefb2664c),
+	    TOBN(0xdd1b0a2b, 0xff1afb02), TOBN(0x5954d52a, 0x60ff0900),
+	    TOBN(0xf6e29d62, 0x787537ae), TOBN(0x9e79b356, 0x6dc1185e),
+	    TOBN(0x00000000, 0x000001b4),
+	},
+	{
+	    TOBN(0x9e49cf3d, 0x2c225f0a), TOBN(0xe8f2d0ab, 0x359b3524),
+	    TOBN(0xffee8da0, 0x62fc856a), TOBN(0xd473d604, 0x3473d45e),
+	    TOBN(0x57fd3b57, 0x5a005cde), TOBN(0x7042e89e, 0xff068673),
+	    TOBN(0x256857d5, 0xca2b0e76), TOBN(0x6a349dc6, 0x78365f64),
+	    TOBN(0x00000000, 0x000000c8),
+	},
+    },
+    {
+	{
+	    TOBN(0x9f8c4d01, 0xb01ce2b5), TOBN(0x78d34284, 0xf417d7e3),
+	    TOBN(0xf59d157a, 0xcbf04214), TOBN(0xf8a594c0, 0xc4238071),
+	    TOBN(0xbaf85cdc, 0x7b0a1e05), TOBN(0x1d1329e8, 0xc9cfd81b),
+	    TOBN(0x3168fc55, 0xc9be4f2d), TOBN(0xb8a1a29b, 0x5c20884e),
+	    TOBN(0x00000000, 0x000001e5),
+	},
+	{
+	    TOBN(0x96d54227, 0x6e9fd410), TOBN(0xd61e57db, 0x16c1621d),
+	    TOBN(0x2da52da5, 0x8656adf3), TOBN(0x2098e089, 0xd546ecce),
+	    TOBN(0x7499c874, 0xb41508ee), TOBN(0xf525839d, 0x9cf31199),
+	    TOBN(0xa0de08e5, 0x96548966), TOBN(0x68e4ee51, 0x1cdd85c0),
+	    TOBN(0x00000000, 0x00000139),
+	},
+    },
+    {
+	{
+	    TOBN(0x254a6116, 0x1b0c2836), TOBN(0xe137cf31, 0x4bf2a950),
+	    TOBN(0x355a2941, 0x47ef2fd2), TOBN(0xe80b1339, 0xb90ffedb),
+	    TOBN(0x564e1a67, 0xf0923b8d), TOBN(0x37731150, 0x75c266a8),
+	    TOBN(0xaa596927, 0xb3b6b874), TOBN(0xd98eced9, 0xc6cbaf62),
+	    TOBN(0x00000000, 0x000001d5),
+	},
+	{
+	    TOBN(0xc057ff20, 0x151a8688), TOBN(0x09ecf021, 0xb35fea0b),
+	    TOBN(0x3e468f14, 0x8572e2e4), TOBN(0xa3dde03f, 0xf970c43f),
+	    TOBN(0x2e77b56f, 0xfbfcb575), TOBN(0x8423f07b, 0xedb91413),
+	    TOBN(0x4ba999cf, 0x6382b8b8), TOBN(0x28cd1213, 0x6f1991dc),
+	    TOBN(0x00000000, 0x00000029),
+	},
+    },
+    {
+	{
+	    TOBN(0x3b99ee54, 0x66643337), TOBN(0x22689fb4, 0xce6a3be8),
+	    TOBN(0x9097495c, 0x19c49ae8), TOBN(0xd120cdab, 0x55fd84bf),
+	    TOBN(0x5d7078ba, 0xe7fafa9f), TOBN(0x2d67e1a6, 0xef6f63fa),
+	    TOBN(0x691efdbd, 0xf9314fd8), TOBN(0x7cee1870, 0xfc982ded),
+	    TOBN(0x00000000, 0x000001a6),
+	},
+	{
+	    TOBN(0x8f229d08, 0xaebe9e65), TOBN(0xd3e08ff7, 0x2a22a918),
+	    TOBN(0x1fa15146, 0x838a1e91), TOBN(0xf911c255, 0x244077d1),
+	    TOBN(0x07fa035a, 0xae4d1aa8), TOBN(0xe7e4b053, 0xe83f28fe),
+	    TOBN(0xc11fbac5, 0x677b97f2), TOBN(0xe1db5787, 0x3a435bf4),
+	    TOBN(0x00000000, 0x00000086),
+	},
+    },
+    {
+	{
+	    TOBN(0xb448dbd2, 0x1584af73), TOBN(0x1bc9bb68, 0x89860825),
+	    TOBN(0xf8e8047c, 0xbf82cdc7), TOBN(0xcec6ca12, 0xe11d4b2f),
+	    TOBN(0x96c7bfaf, 0xa5f47ffa), TOBN(0xc30d1093, 0x90173868),
+	    TOBN(0xff2ca0fd, 0xc986da55), TOBN(0x1f573275, 0x9e8a1123),
+	    TOBN(0x00000000, 0x0000002a),
+	},
+	{
+	    TOBN(0x48b01eab, 0x4c7bc840), TOBN(0x500b87ae, 0x961db8f8),
+	    TOBN(0x278fe99a, 0x1bffdae9), TOBN(0xfe032c1e, 0xcb303f09),
+	    TOBN(0x88860fa1, 0x96bde975), TOBN(0xedc535d2, 0xbb42120e),
+	    TOBN(0x2548ee23, 0xf1876966), TOBN(0xea7e71bc, 0x6d132ed2),
+	    TOBN(0x00000000, 0x0000015a),
+	},
+    },
+    {
+	{
+	    TOBN(0xbb94d09a, 0xf8817650), TOBN(0xf6785bff, 0x729bfe1a),
+	    TOBN(0xd4326c09, 0x71b400f3), TOBN(0xa5a070ab, 0xc1908478),
+	    TOBN(0xe23f2682, 0xfa8d21a5), TOBN(0xcbefe123, 0x182e3e1c),
+	    TOBN(0x974e2ba2, 0x9ad16958), TOBN(0x6578b9f9, 0x0647e4d7),
+	    TOBN(0x00000000, 0x0000012d),
+	},
+	{
+	    TOBN(0x9b97e45b, 0x84f8d3df), TOBN(0x2e9d21be, 0xb7e9b1d4),
+	    TOBN(0x71d24a01, 0x08292555), TOBN(0xa4aa3062, 0xfd243bad),
+	    TOBN(0xfa5ee432, 0x08ba071d), TOBN(0xbdb46977, 0xf351543a),
+	    TOBN(0x48d751b5, 0x1397568a), TOBN(0xaaf952f4, 0x2282a11d),
+	    TOBN(0x00000000, 0x000000c4),
+	},
+    },
+    {
+	{
+	    TOBN(0xf91921b5, 0x1b130d63), TOBN(0x5ef5b2dc, 0x4223ef9f),
+	    TOBN(0x3e7f2fcc, 0x656955ff), TOBN(0x66dbecef, 0x5515b54b),
+	    TOBN(0xab0f66c5, 0xb20728dd), TOBN(0x5ac67815, 0x15dcf21d),
+	    TOBN(0xd4cf206d, 0x38287c93), TOBN(0x9e653a16, 0x71021b73),
+	    TOBN(0x00000000, 0x00000008),
+	},
+	{
+	    TOBN(0x361c7847, 0x8cb562bf), TOBN(0x9c3fd3e2, 0xe506a613),
+	    TOBN(0x67ab1319, 0x288a67c6), TOBN(0x08a4a8ab, 0x15691f59),
+	    TOBN(0x251b0510, 0x2652080d), TOBN(0x608feb6f, 0x05d3b8e3),
+	    TOBN(0x12ddcc54, 0xa555b2a5), TOBN(0x7b0a292f, 0x592acd16),
+	    TOBN(0x00000000, 0x000001ab),
+	},
+    },
+    {
+	{
+	    TOBN(0xa204756a, 0xa40bf3fd), TOBN(0x532dc755, 0x861887dd),
+	    TOBN(0xc2466ab1, 0x83b1633e), TOBN(0xf197f182, 0x3fad93ed),
+	    TOBN(0x1393c4f4, 0x9edb50d6), TOBN(0xe37e97cc, 0x0ec275c0),
+	    TOBN(0x336d4642, 0xee81d86d), TOBN(0x1bec4d54, 0x55252ba4),
+	    TOBN(0x00000000, 0x00000163),
+	},
+	{
+	    TOBN(0xd905b0ae, 0x3da97be9), TOBN(0xcfceed54, 0x9da7d01d),
+	    TOBN(0x23f247e5, 0x1356365b), TOBN(0x77b249c8, 0xea60ba0e),
+	    TOBN(0x34502fa7, 0x14b745af), TOBN(0xc2417fb2, 0x8fcdd6dc),
+	    TOBN(0x1fc5f4d6, 0xa94277a8), TOBN(0x00fa126f, 0x7256c63d),
+	    TOBN(0x00000000, 0x00000096),
+	},
+    },
+    {
+	{
+	    TOBN(0xbba8f5ca, 0x8f1146b4), TOBN(0xf0450d16, 0xfbeccb57),
+	    TOBN(0x8551f8a4, 0x16a9020d), TOBN(0xeac9ff5f, 0xbc7fce40),
+	    TOBN(0x680d9292, 0x03713339), TOBN(0xc1235dee, 0x93ca292d),
+	    TOBN(0x3546dc71, 0x12917240), TOBN(0xbd03e7cb, 0x67fd8d75),
+	    TOBN(0x00000000, 0x0000011d),
+	},
+	{
+	    TOBN(0x18ac7cfb, 0x170d7ca4), TOBN(0x3f2ad41e, 0xbe11a8e3),
+	    TOBN(0x66786d41, 0x75b8ce97), TOBN(0x9e42a985, 0x964c6e23),
+	    TOBN(0xe8729abc, 0xd0132735), TOBN(0x3a373fcc, 0x8f6bae9e),
+	    TOBN(0x9127a3f4, 0xb0db25f8), TOBN(0x028b076b, 0x9347da9b),
+	    TOBN(0x00000000, 0x0000006a),
+	},
+    },
+    {
+	{
+	    TOBN(0x6ac0dd5d, 0xf1bb652d), TOBN(0xcd4c76e9, 0xeb9f9b1f),
+	    TOBN(0xfbab40c7, 0xbfeb21d5), TOBN(0xc33d8a1b, 0x658dfeba),
+	    TOBN(0x96e3c9d6, 0x661e55e0), TOBN(0xe858301d, 0x68476fdb),
+	    TOBN(0x6d1738ef, 0xbb53fba6), TOBN(0x543c11d9, 0x952b2fb0),
+	    TOBN(0x00000000, 0x00000040),
+	},
+	{
+	    TOBN(0xa27ce84a, 0xf2fbf3be), TOBN(0x2fdcd9ef, 0x8e39efb7),
+	    TOBN(0x23d22019, 0x02d7cae4), TOBN(0xac9c2d4b, 0xa54a91fa),
+	    TOBN(0x66dabf86, 0xb7b4ce8e), TOBN(0x340a7ae7, 0x9ca0d838),
+	    TOBN(0xc2363906, 0x9f0bff6a), TOBN(0xd651b10d, 0x11aff1d3),
+	    TOBN(0x00000000, 0x0000003a),
+	},
+    },
+    {
+	{
+	    TOBN(0x05142e2a, 0x7e994642), TOBN(0xb3b94feb, 0xe5e2920f),
+	    TOBN(0x1da028dc, 0x3187eb20), TOBN(0x8a8d6425, 0x09ecd927),
+	    TOBN(0x381c1326, 0xf5cc5c3b), TOBN(0x9a9010ad, 0x56acf1f2),
+	    TOBN(0xc92129b2, 0x1f133c02), TOBN(0x64b23198, 0xde9d245e),
+	    TOBN(0x00000000, 0x0000019f),
+	},
+	{
+	    TOBN(0x148cb74a, 0x1c21ec0e), TOBN(0x28e49870, 0x16e0016e),
+	    TOBN(0x2434e25f, 0x178accfc), TOBN(0x4ec328e4, 0xda1ee85e),
+	    TOBN(0x2a293046, 0x471cb421), TOBN(0x72e918f8, 0x055e4b67),
+	    TOBN(0x0cdc1989, 0x5101c47a), TOBN(0xe0312a98, 0xe95ba792),
+	    TOBN(0x00000000, 0x000000da),
+	},
+    },
+    {
+	{
+	    TOBN(0xe42e86e1, 0x12430432), TOBN(0x669f466d, 0x247a989b),
+	    TOBN(0xfa04a2d9, 0xef5f5d3e), TOBN(0x435173a7, 0xbb919966),
+	    TOBN(0x4bbef42b, 0x5eefa761), TOBN(0x521d9632, 0xc7fd0b8a),
+	    TOBN(0x7d016ce7, 0x370ed186), TOBN(0x4487a403, 0xeb75a36c),
+	    TOBN(0x00000000, 0x0000012f),
+	},
+	{
+	    TOBN(0x78398930, 0x98bbbb31), TOBN(0x15929ddf, 0x4c79d06f),
+	    TOBN(0x54132192, 0x4c127e15), TOBN(0xef5ec192, 0x59808240),
+	    TOBN(0x7fb6a4f0, 0xb84ed525), TOBN(0x5e010389, 0x806334bf),
+	    TOBN(0x8cfea8bb, 0x88b6cdd5), TOBN(0x4aa8b1dc, 0xd1208d99),
+	    TOBN(0x00000000, 0x0000013b),
+	},
+    },
+    {
+	{
+	    TOBN(0x3988d8e8, 0xbfe2de3a), TOBN(0xd719823f, 0x739abb52),
+	    TOBN(0xb134d9a5, 0xafb5d873), TOBN(0xee4d930a, 0xa2752694),
+	    TOBN(0x985724c5, 0x6ac7ffac), TOBN(0xb14a80db, 0x2500ae35),
+	    TOBN(0x93f038fb, 0x1b0d21ed), TOBN(0xdfc38a00, 0xf2d3ff6b),
+	    TOBN(0x00000000, 0x000000cd),
+	},
+	{
+	    TOBN(0x2a2b68a3, 0x9e7d0ecc), TOBN(0x482879da, 0x4b3115e8),
+	    TOBN(0xc601de06, 0x71ec9cda), TOBN(0x2daf39d4, 0x9a639b3b),
+	    TOBN(0x40277934, 0x39701e39), TOBN(0xed89b81d, 0x807b7e59),
+	    TOBN(0x16bddfe7, 0x7d6e3e3e), TOBN(0xcb351e2a, 0x6513ab99),
+	    TOBN(0x00000000, 0x00000010),
+	},
+    },
+    {
+	{
+	    TOBN(0x7bf32879, 0x33ba4cdd), TOBN(0xd536229a, 0x0d8928ef),
+	    TOBN(0x8a87e35a, 0x985cd627), TOBN(0x00335f32, 0xaec3658a),
+	    TOBN(0xb22cf863, 0xc70d93f9), TOBN(0xf099cb19, 0x2635d9c8),
+	    TOBN(0xf58ff1ff, 0x4acaf282), TOBN(0x398d0a00, 0xe457d46f),
+	    TOBN(0x00000000, 0x0000016f),
+	},
+	{
+	    TOBN(0x33d67fd4, 0x58d6cf28), TOBN(0xb9562731, 0xcce684b3),
+	    TOBN(0xaa8fa887, 0x7714abbe), TOBN(0xaef67aa3, 0xe961f105),
+	    TOBN(0x67402f44, 0xf9f18291), TOBN(0x23a113eb, 0x033a6392),
+	    TOBN(0x8296da92, 0x8b6602e3), TOBN(0x55ec0f73, 0x9d74d481),
+	    TOBN(0x00000000, 0x000000f5),
+	},
+    },
+    {
+	{
+	    TOBN(0xad45fbe7, 0xf846d3fa), TOBN(0xb7602954, 0x20b6d2c5),
+	    TOBN(0xa011a584, 0xd126d691), TOBN(0x96ccfb23, 0x83989387),
+	    TOBN(0x88504bf8, 0xb92401de), TOBN(0xa2666f4e, 0x2ad7ea06),
+	    TOBN(0xcb8c76c8, 0xe1ab0d36), TOBN(0x467d45b9, 0xa670f288),
+	    TOBN(0x00000000, 0x0000002c),
+	},
+	{
+	    TOBN(0x249e7744, 0x5348cb0a), TOBN(0x325c81ee, 0x88fd1924),
+	    TOBN(0x292b3441, 0xed49b637), TOBN(0x71b3d6df, 0x3a1f7741),
+	    TOBN(0xd28e01ff, 0xa9bd2214), TOBN(0x357f6a02, 0x7fd9ed5e),
+	    TOBN(0x4ab24ac5, 0xdb9c4869), TOBN(0xa6065371, 0x818ffe0d),
+	    TOBN(0x00000000, 0x00000030),
+	},
+    },
+    {
+	{
+	    TOBN(0x341b1410, 0x5af081b9), TOBN(0x4e6cb71b, 0xb3f79fdf),
+	    TOBN(0x0dcfc2a2, 0x1084f0f5), TOBN(0x2be6eb04, 0x330cc554),
+	    TOBN(0x532afffd, 0xc10a5a45), TOBN(0x40f5fc19, 0x4243fb83),
+	    TOBN(0x3c94ac3b, 0xda7b80ae), TOBN(0x496b6dd1, 0xa011d171),
+	    TOBN(0x00000000, 0x0000005f),
+	},
+	{
+	    TOBN(0x844bbdf7, 0x08d2db24), TOBN(0x98406000, 0xf71794c0),
+	    TOBN(0xec8562bd, 0xec1804ea), TOBN(0x5e87eb4b, 0x2e92ab08),
+	    TOBN(0x50188001, 0xe16b0c98), TOBN(0xb62efd54, 0x6f565bdb),
+	    TOBN(0x8fd570e2, 0x7383444c), TOBN(0x0efc0f24, 0x28fb2db4),
+	    TOBN(0x00000000, 0x000001ae),
+	},
+    },
+    {
+	{
+	    TOBN(0xbb7c1136, 0xb8460c0c), TOBN(0x79c49278, 0xff1641b7),
+	    TOBN(0xae58e7f3, 0x0f35d688), TOBN(0xf7b5d7d2, 0x50aef9bc),
+	    TOBN(0xe6fbfaad, 0x27246797), TOBN(0x6d203aa4, 0xe9e46b56),
+	    TOBN(0x0403707a, 0x5841f181), TOBN(0xdccb1c57, 0x17aeed1a),
+	    TOBN(0x00000000, 0x00000131),
+	},
+	{
+	    TOBN(0x2f071bd6, 0x274ac213), TOBN(0xb4d362dc, 0x03d26304),
+	    TOBN(0x2e25f565, 0x2bafcaa7), TOBN(0xa70dd68f, 0x234f17f1),
+	    TOBN(0xf5825434, 0x3b1bcc85), TOBN(0x14ffd6e3, 0x0237a6bf),
+	    TOBN(0xfca83c20, 0x827dd210), TOBN(0xd156e515, 0x34bd5402),
+	    TOBN(0x00000000, 0x000001ad),
+	},
+    },
+};
+static const BN_ULONG
+ec_comb_p521_offset_mont[2][2][9 * 64 / BN_BITS2] = {
+    {
+	{
+	    TOBN(0x24231b30, 0xfcb122e0), TOBN(0x73165cd5, 0x7aea5e17),
+	    TOBN(0x564efe28, 0x58607327), TOBN(0xd27fdac1, 0x998218eb),
+	    TOBN(0xd5ad2ad3, 0x1cc3dd5f), TOBN(0x3376cd64, 0xd0aac612),
+	    TOBN(0x10cc84bd, 0x8c4e382e), TOBN(0x81b463c2, 0x07043772),
+	    TOBN(0x00000000, 0x000000ca),
+	},
+	{
+	    TOBN(0x333b8e84, 0xc42122de), TOBN(0x0a4c6c6d, 0x338d0bdd),
+	    TOBN(0xb2c58ef5, 0x41f507d9), TOBN(0x3fbc4377, 0x6904daad),
+	    TOBN(0x6b4cdd44, 0xa20173b8), TOBN(0x6c04dad6, 0x113c628d),
+	    TOBN(0x12944756, 0xa872b965), TOBN(0x1038db78, 0x63f5e629),
+	    TOBN(0x00000000, 0x00000029),
+	},
+    },
+    {
+	{
+	    TOBN(0x46148bc0, 0x73480be4), TOBN(0x659542d4, 0xa7941b99),
+	    TOBN(0xce3fec29, 0x9faccec1), TOBN(0xaba815e8, 0xde131774),
+	    TOBN(0x3f717e4d, 0x2fd6afd2), TOBN(0xc60fff2c, 0xa42d91be),
+	    TOBN(0x477100ea, 0x54a063db), TOBN(0x8b08f9f6, 0x613170fe),
+	    TOBN(0x00000000, 0x00000169),
+	},
+	{
+	    TOBN(0x8148ec97, 0x892a48de), TOBN(0x09693ebf, 0xb98afbde),
+	    TOBN(0xfe2b2832, 0xb9968023), TOBN(0xaa2dea54, 0x1b628220),
+	    TOBN(0xf39da002, 0x0c314461), TOBN(0x1ec1f9c1, 0x0154fd15),
+	    TOBN(0x852557a2, 0x5f8ac8f1), TOBN(0xd055a6ca, 0x3548ff02),
+	    TOBN(0x00000000, 0x000001e6),
+	},
+    },
+};
+#endif
+
+__END_HIDDEN_DECLS
@@ -3190,7 +3190,11 @@ static const ec_list_element curve_list[] = {
 #endif
 	{NID_secp256k1, &_EC_SECG_PRIME_256K1.h, 0, "SECG curve over a 256 bit prime field"},
 	/* SECG secp256r1 is the same as X9.62 prime256v1 and hence omitted */
+#ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
+	{NID_secp384r1, &_EC_NIST_PRIME_384.h, EC_GFp_nistp384_method, "NIST/SECG curve over a 384 bit prime field"},
+#else
 	{NID_secp384r1, &_EC_NIST_PRIME_384.h, 0, "NIST/SECG curve over a 384 bit prime field"},
+#endif
 #ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
 	{NID_secp521r1, &_EC_NIST_PRIME_521.h, EC_GFp_nistp521_method, "NIST/SECG curve over a 521 bit prime field"},
 #else
@@ -440,6 +440,7 @@ EC_KEY_set_group(EC_KEY * key, const EC_GROUP * group)
 	if (key->meth->set_group != NULL &&
 	    key->meth->set_group(key, group) == 0)
 		return 0;
+	ec_wNAF_free_key_mult(key);
 	EC_GROUP_free(key->group);
 	key->group = EC_GROUP_dup(group);
 	return (key->group == NULL) ? 0 : 1;
@@ -474,6 +475,7 @@ EC_KEY_set_public_key(EC_KEY * key, const EC_POINT * pub_key)
 	if (key->meth->set_public != NULL &&
 	    key->meth->set_public(key, pub_key) == 0)
 		return 0;
+	ec_wNAF_free_key_mult(key);
 	EC_POINT_free(key->pub_key);
 	key->pub_key = EC_POINT_dup(pub_key, key->group);
 	return (key->pub_key == NULL) ? 0 : 1;
@@ -552,6 +554,19 @@ EC_KEY_precompute_mult(EC_KEY * key, BN_CTX * ctx)
 	return EC_GROUP_precompute_mult(key->group, ctx);
 }
 
+int
+EC_KEY_precompute_public_mult(EC_KEY * key, BN_CTX * ctx)
+{
+	if (key->group == NULL || key->pub_key == NULL) {
+		ECerror(ERR_R_PASSED_NULL_PARAMETER);
+		return 0;
+	}
+	/* Only the generic wNAF code makes use of the tables. */
+	if (key->group->meth->mul_double_nonct != ec_GFp_simple_mul_double_nonct)
+		return 1;
+	return ec_wNAF_precompute_key_mult(key, ctx);
+}
+
 int 
 EC_KEY_get_flags(const EC_KEY * key)
 {
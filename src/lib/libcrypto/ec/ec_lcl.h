@@ -306,6 +306,14 @@ int ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 	size_t num, const EC_POINT *points[], const BIGNUM *scalars[], BN_CTX *);
 int ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *);
 int ec_wNAF_have_precompute_mult(const EC_GROUP *group);
+int ec_wNAF_precompute_key_mult(EC_KEY *key, BN_CTX *);
+void ec_wNAF_free_key_mult(EC_KEY *key);
+int ec_wNAF_key_mul(const EC_KEY *key, EC_POINT *r, const BIGNUM *g_scalar,
+	const BIGNUM *p_scalar, BN_CTX *);
+
+/* generator multiplication for P-384 and P-521 in ec_comb.c */
+int ec_comb_mul_generator(const EC_GROUP *group, EC_POINT *r,
+	const BIGNUM *scalar, BN_CTX *);
 
 
 /* method functions in ecp_smpl.c */
@@ -447,6 +455,11 @@ int ec_GFp_nistp256_have_precompute_mult(const EC_GROUP *group);
 const EC_METHOD *EC_GFp_nistz256_method(void);
 #endif
 
+#ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
+/* method in ecp_nistp384.c */
+const EC_METHOD *EC_GFp_nistp384_method(void);
+#endif
+
 /* EC_METHOD definitions */
 
 struct ec_key_method_st {
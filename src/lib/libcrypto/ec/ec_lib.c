@@ -623,10 +623,25 @@ EC_GROUP_cmp(const EC_GROUP * a, const EC_GROUP * b, BN_CTX * ctx)
 	if (r || BN_cmp(a1, b1) || BN_cmp(a2, b2) || BN_cmp(a3, b3))
 		r = 1;
 
-	/* XXX EC_POINT_cmp() assumes that the methods are equal */
-	if (r || EC_POINT_cmp(a, EC_GROUP_get0_generator(a),
-		EC_GROUP_get0_generator(b), ctx))
-		r = 1;
+	/*
+	 * EC_POINT_cmp() assumes that the methods are equal. A named curve
+	 * may use a dedicated method, such as EC_GFp_nistz256_method(),
+	 * while the same curve decoded from explicit parameters uses the
+	 * generic one, so compare the affine coordinates in that case.
+	 */
+	if (!r && a->meth == b->meth) {
+		if (EC_POINT_cmp(a, EC_GROUP_get0_generator(a),
+		    EC_GROUP_get0_generator(b), ctx))
+			r = 1;
+	} else if (!r) {
+		if (!EC_POINT_get_affine_coordinates(a,
+		    EC_GROUP_get0_generator(a), a1, a2, ctx) ||
+		    !EC_POINT_get_affine_coordinates(b,
+		    EC_GROUP_get0_generator(b), b1, b2, ctx))
+			r = 1;
+		if (r || BN_cmp(a1, b1) || BN_cmp(a2, b2))
+			r = 1;
+	}
 
 	if (!r) {
 		/* compare the order and cofactor */
@@ -702,29 +702,29 @@ ec_wNAF_mul(const EC_GROUP * group, EC_POINT * r, const BIGNUM * scalar,
 }
 
 
-/* ec_wNAF_precompute_mult()
- * creates an EC_PRE_COMP object with preprecomputed multiples of the generator
+/* ec_pre_comp_compute()
+ * creates an EC_PRE_COMP object with preprecomputed multiples of 'base'
  * for use with wNAF splitting as implemented in ec_wNAF_mul().
  *
- * 'pre_comp->points' is an array of multiples of the generator
+ * 'pre_comp->points' is an array of multiples of 'base'
  * of the following form:
- * points[0] =     generator;
- * points[1] = 3 * generator;
+ * points[0] =     base;
+ * points[1] = 3 * base;
  * ...
- * points[2^(w-1)-1] =     (2^(w-1)-1) * generator;
- * points[2^(w-1)]   =     2^blocksize * generator;
- * points[2^(w-1)+1] = 3 * 2^blocksize * generator;
+ * points[2^(w-1)-1] =     (2^(w-1)-1) * base;
+ * points[2^(w-1)]   =     2^blocksize * base;
+ * points[2^(w-1)+1] = 3 * 2^blocksize * base;
  * ...
- * points[2^(w-1)*(numblocks-1)-1] = (2^(w-1)) *  2^(blocksize*(numblocks-2)) * generator
- * points[2^(w-1)*(numblocks-1)]   =              2^(blocksize*(numblocks-1)) * generator
+ * points[2^(w-1)*(numblocks-1)-1] = (2^(w-1)) *  2^(blocksize*(numblocks-2)) * base
+ * points[2^(w-1)*(numblocks-1)]   =              2^(blocksize*(numblocks-1)) * base
  * ...
- * points[2^(w-1)*numblocks-1]     = (2^(w-1)) *  2^(blocksize*(numblocks-1)) * generator
+ * points[2^(w-1)*numblocks-1]     = (2^(w-1)) *  2^(blocksize*(numblocks-1)) * base
  * points[2^(w-1)*numblocks]       = NULL
  */
-int 
-ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
+static EC_PRE_COMP *
+ec_pre_comp_compute(const EC_GROUP * group, const EC_POINT * base_point,
+    BN_CTX * ctx)
 {
-	const EC_POINT *generator;
 	EC_POINT *tmp_point = NULL, *base = NULL, **var;
 	BN_CTX *new_ctx = NULL;
 	BIGNUM *order;
@@ -732,19 +732,11 @@ ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
 	 num;
 	EC_POINT **points = NULL;
 	EC_PRE_COMP *pre_comp;
-	int ret = 0;
-
-	/* if there is an old EC_PRE_COMP object, throw it away */
-	EC_EX_DATA_free_data(&group->extra_data, ec_pre_comp_dup, ec_pre_comp_free, ec_pre_comp_clear_free);
+	EC_PRE_COMP *ret = NULL;
 
 	if ((pre_comp = ec_pre_comp_new(group)) == NULL)
-		return 0;
+		return NULL;
 
-	generator = EC_GROUP_get0_generator(group);
-	if (generator == NULL) {
-		ECerror(EC_R_UNDEFINED_GENERATOR);
-		goto err;
-	}
 	if (ctx == NULL) {
 		ctx = new_ctx = BN_CTX_new();
 		if (ctx == NULL)
@@ -801,7 +793,7 @@ ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
 		ECerror(ERR_R_MALLOC_FAILURE);
 		goto err;
 	}
-	if (!EC_POINT_copy(base, generator))
+	if (!EC_POINT_copy(base, base_point))
 		goto err;
 
 	/* do the precomputation */
@@ -851,12 +843,8 @@ ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
 	points = NULL;
 	pre_comp->num = num;
 
-	if (!EC_EX_DATA_set_data(&group->extra_data, pre_comp,
-		ec_pre_comp_dup, ec_pre_comp_free, ec_pre_comp_clear_free))
-		goto err;
+	ret = pre_comp;
 	pre_comp = NULL;
-
-	ret = 1;
  err:
 	if (ctx != NULL)
 		BN_CTX_end(ctx);
@@ -875,6 +863,37 @@ ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
 }
 
 
+/* ec_wNAF_precompute_mult()
+ * stores precomputed multiples of the generator in the group's extra data,
+ * see ec_pre_comp_compute().
+ */
+int 
+ec_wNAF_precompute_mult(EC_GROUP * group, BN_CTX * ctx)
+{
+	const EC_POINT *generator;
+	EC_PRE_COMP *pre_comp;
+
+	/* if there is an old EC_PRE_COMP object, throw it away */
+	EC_EX_DATA_free_data(&group->extra_data, ec_pre_comp_dup, ec_pre_comp_free, ec_pre_comp_clear_free);
+
+	generator = EC_GROUP_get0_generator(group);
+	if (generator == NULL) {
+		ECerror(EC_R_UNDEFINED_GENERATOR);
+		return 0;
+	}
+	if ((pre_comp = ec_pre_comp_compute(group, generator, ctx)) == NULL)
+		return 0;
+
+	if (!EC_EX_DATA_set_data(&group->extra_data, pre_comp,
+		ec_pre_comp_dup, ec_pre_comp_free, ec_pre_comp_clear_free)) {
+		ec_pre_comp_free(pre_comp);
+		return 0;
+	}
+
+	return 1;
+}
+
+
 int 
 ec_wNAF_have_precompute_mult(const EC_GROUP * group)
 {
@@ -883,3 +902,324 @@ ec_wNAF_have_precompute_mult(const EC_GROUP * group)
 	else
 		return 0;
 }
+
+
+/*
+ * Precomputed multiples of the generator and of the public key of an
+ * EC_KEY, so that ECDSA verification can use wNAF splitting for both
+ * scalars.  The object is kept in the key's method data and never changes
+ * once it has been inserted, so it is shared by reference counting.
+ */
+typedef struct ec_key_pre_comp_st {
+	EC_PRE_COMP *generator;
+	EC_PRE_COMP *pub_key;
+	int references;
+} EC_KEY_PRE_COMP;
+
+static void *ec_key_pre_comp_dup(void *);
+static void ec_key_pre_comp_free(void *);
+static void ec_key_pre_comp_clear_free(void *);
+
+static void *
+ec_key_pre_comp_dup(void *src_)
+{
+	EC_KEY_PRE_COMP *src = src_;
+
+	CRYPTO_add(&src->references, 1, CRYPTO_LOCK_EC_PRE_COMP);
+
+	return src_;
+}
+
+static void
+ec_key_pre_comp_free(void *pre_)
+{
+	EC_KEY_PRE_COMP *pre = pre_;
+
+	if (pre == NULL)
+		return;
+
+	if (CRYPTO_add(&pre->references, -1, CRYPTO_LOCK_EC_PRE_COMP) > 0)
+		return;
+
+	ec_pre_comp_free(pre->generator);
+	ec_pre_comp_free(pre->pub_key);
+	free(pre);
+}
+
+static void
+ec_key_pre_comp_clear_free(void *pre_)
+{
+	EC_KEY_PRE_COMP *pre = pre_;
+
+	if (pre == NULL)
+		return;
+
+	if (CRYPTO_add(&pre->references, -1, CRYPTO_LOCK_EC_PRE_COMP) > 0)
+		return;
+
+	ec_pre_comp_clear_free(pre->generator);
+	ec_pre_comp_clear_free(pre->pub_key);
+	freezero(pre, sizeof *pre);
+}
+
+/*
+ * Compute  \sum scalars[i] * P_i,  where pre_comp[i] holds the precomputed
+ * multiples of P_i.  Every scalar is split into blocks using the block
+ * size of its table and all blocks are interleaved, so only about one
+ * block size worth of doublings is needed.
+ */
+static int
+ec_wNAF_mul_pre_comp(const EC_GROUP * group, EC_POINT * r, size_t num,
+    const EC_PRE_COMP * pre_comp[], const BIGNUM * scalars[], BN_CTX * ctx)
+{
+	signed char **wNAF = NULL;
+	const signed char **block_wNAF = NULL;
+	size_t *block_len = NULL;
+	EC_POINT ***block_points = NULL;
+	size_t totalnum = 0, nblocks = 0, max_len = 0;
+	size_t i, j;
+	int k;
+	int r_is_inverted = 0;
+	int r_is_at_infinity = 1;
+	int ret = 0;
+
+	for (i = 0; i < num; i++) {
+		const EC_PRE_COMP *pre = pre_comp[i];
+
+		/* check that pre_comp looks sane */
+		if (pre->numblocks == 0 ||
+		    pre->num != (pre->numblocks << (pre->w - 1))) {
+			ECerror(ERR_R_INTERNAL_ERROR);
+			return 0;
+		}
+		totalnum += pre->numblocks;
+	}
+
+	wNAF = calloc(num, sizeof wNAF[0]);
+	block_wNAF = reallocarray(NULL, totalnum, sizeof block_wNAF[0]);
+	block_len = reallocarray(NULL, totalnum, sizeof block_len[0]);
+	block_points = reallocarray(NULL, totalnum, sizeof block_points[0]);
+	if (wNAF == NULL || block_wNAF == NULL || block_len == NULL ||
+	    block_points == NULL) {
+		ECerror(ERR_R_MALLOC_FAILURE);
+		goto err;
+	}
+
+	for (i = 0; i < num; i++) {
+		const EC_PRE_COMP *pre = pre_comp[i];
+		size_t len;
+
+		if ((wNAF[i] = compute_wNAF(scalars[i], pre->w, &len)) == NULL)
+			goto err;
+
+		/* the last block gets whatever is left */
+		for (j = 0; j < pre->numblocks && len > 0; j++) {
+			block_wNAF[nblocks] = wNAF[i] + j * pre->blocksize;
+			block_len[nblocks] = len;
+			if (j < pre->numblocks - 1 && len > pre->blocksize)
+				block_len[nblocks] = pre->blocksize;
+			block_points[nblocks] =
+			    pre->points + (j << (pre->w - 1));
+			if (block_len[nblocks] > max_len)
+				max_len = block_len[nblocks];
+			len -= block_len[nblocks];
+			nblocks++;
+		}
+	}
+
+	for (k = max_len - 1; k >= 0; k--) {
+		if (!r_is_at_infinity) {
+			if (!EC_POINT_dbl(group, r, r, ctx))
+				goto err;
+		}
+		for (i = 0; i < nblocks; i++) {
+			int digit, is_neg;
+
+			if (block_len[i] <= (size_t) k)
+				continue;
+			if ((digit = block_wNAF[i][k]) == 0)
+				continue;
+
+			is_neg = digit < 0;
+			if (is_neg)
+				digit = -digit;
+
+			if (is_neg != r_is_inverted) {
+				if (!r_is_at_infinity) {
+					if (!EC_POINT_invert(group, r, ctx))
+						goto err;
+				}
+				r_is_inverted = !r_is_inverted;
+			}
+			/* digit > 0 */
+
+			if (r_is_at_infinity) {
+				if (!EC_POINT_copy(r, block_points[i][digit >> 1]))
+					goto err;
+				r_is_at_infinity = 0;
+			} else {
+				if (!EC_POINT_add(group, r, r,
+				    block_points[i][digit >> 1], ctx))
+					goto err;
+			}
+		}
+	}
+
+	if (r_is_at_infinity) {
+		if (!EC_POINT_set_to_infinity(group, r))
+			goto err;
+	} else {
+		if (r_is_inverted)
+			if (!EC_POINT_invert(group, r, ctx))
+				goto err;
+	}
+
+	ret = 1;
+
+ err:
+	if (wNAF != NULL) {
+		for (i = 0; i < num; i++)
+			free(wNAF[i]);
+		free(wNAF);
+	}
+	free(block_wNAF);
+	free(block_len);
+	free(block_points);
+	return ret;
+}
+
+/*
+ * ec_wNAF_precompute_key_mult()
+ * stores precomputed multiples of the generator and of the public key in the
+ * key's method data.  The generator table of the group is shared if there is
+ * one.  An existing table for the key is kept.
+ */
+int
+ec_wNAF_precompute_key_mult(EC_KEY * key, BN_CTX * ctx)
+{
+	const EC_GROUP *group = key->group;
+	const EC_POINT *generator;
+	EC_PRE_COMP *gen_pre_comp;
+	EC_KEY_PRE_COMP *pre;
+	BN_CTX *new_ctx = NULL;
+	int ret = 0;
+
+	if (EC_KEY_get_key_method_data(key, ec_key_pre_comp_dup,
+	    ec_key_pre_comp_free, ec_key_pre_comp_clear_free) != NULL)
+		return 1;
+
+	if ((generator = EC_GROUP_get0_generator(group)) == NULL) {
+		ECerror(EC_R_UNDEFINED_GENERATOR);
+		return 0;
+	}
+
+	if ((pre = calloc(1, sizeof *pre)) == NULL) {
+		ECerror(ERR_R_MALLOC_FAILURE);
+		return 0;
+	}
+	pre->references = 1;
+
+	if (ctx == NULL) {
+		ctx = new_ctx = BN_CTX_new();
+		if (ctx == NULL)
+			goto err;
+	}
+
+	gen_pre_comp = EC_EX_DATA_get_data(group->extra_data, ec_pre_comp_dup,
+	    ec_pre_comp_free, ec_pre_comp_clear_free);
+	if (gen_pre_comp != NULL && gen_pre_comp->numblocks != 0 &&
+	    EC_POINT_cmp(group, generator, gen_pre_comp->points[0], ctx) == 0)
+		pre->generator = ec_pre_comp_dup(gen_pre_comp);
+	else if ((pre->generator = ec_pre_comp_compute(group, generator,
+	    ctx)) == NULL)
+		goto err;
+
+	if ((pre->pub_key = ec_pre_comp_compute(group, key->pub_key,
+	    ctx)) == NULL)
+		goto err;
+
+	/*
+	 * Another thread may have been faster, in which case use its table.
+	 * EC_KEY_insert_key_method_data() returns NULL both when it stored
+	 * the table and when it failed to, so do its work here.
+	 */
+	CRYPTO_w_lock(CRYPTO_LOCK_EC);
+	if (EC_EX_DATA_get_data(key->method_data, ec_key_pre_comp_dup,
+	    ec_key_pre_comp_free, ec_key_pre_comp_clear_free) == NULL) {
+		if (!EC_EX_DATA_set_data(&key->method_data, pre,
+		    ec_key_pre_comp_dup, ec_key_pre_comp_free,
+		    ec_key_pre_comp_clear_free)) {
+			CRYPTO_w_unlock(CRYPTO_LOCK_EC);
+			goto err;
+		}
+		pre = NULL;
+	}
+	CRYPTO_w_unlock(CRYPTO_LOCK_EC);
+
+	ret = 1;
+
+ err:
+	BN_CTX_free(new_ctx);
+	ec_key_pre_comp_free(pre);
+	return ret;
+}
+
+/*
+ * ec_wNAF_free_key_mult()
+ * discards the precomputed multiples of the key, if any.
+ */
+void
+ec_wNAF_free_key_mult(EC_KEY * key)
+{
+	CRYPTO_w_lock(CRYPTO_LOCK_EC);
+	EC_EX_DATA_free_data(&key->method_data, ec_key_pre_comp_dup,
+	    ec_key_pre_comp_free, ec_key_pre_comp_clear_free);
+	CRYPTO_w_unlock(CRYPTO_LOCK_EC);
+}
+
+/*
+ * ec_wNAF_key_mul()
+ * computes  g_scalar * generator + p_scalar * pub_key  for ECDSA verification,
+ * using the tables made by ec_wNAF_precompute_key_mult() if the key has them
+ * and EC_POINT_mul() otherwise.
+ */
+int
+ec_wNAF_key_mul(const EC_KEY * key, EC_POINT * r, const BIGNUM * g_scalar,
+    const BIGNUM * p_scalar, BN_CTX * ctx)
+{
+	const EC_GROUP *group = key->group;
+	const EC_PRE_COMP *pre_comp[2];
+	const BIGNUM *scalars[2];
+	EC_KEY_PRE_COMP *pre;
+	int ret;
+
+	/*
+	 * Take a reference while holding the lock, so that the table stays
+	 * around even if the key's method data is changed concurrently.
+	 */
+	CRYPTO_r_lock(CRYPTO_LOCK_EC);
+	pre = EC_EX_DATA_get_data(key->method_data, ec_key_pre_comp_dup,
+	    ec_key_pre_comp_free, ec_key_pre_comp_clear_free);
+	if (pre != NULL)
+		ec_key_pre_comp_dup(pre);
+	CRYPTO_r_unlock(CRYPTO_LOCK_EC);
+
+	if (pre == NULL || group->meth != r->meth ||
+	    EC_POINT_cmp(group, key->pub_key, pre->pub_key->points[0],
+	    ctx) != 0) {
+		ec_key_pre_comp_free(pre);
+		return EC_POINT_mul(group, r, g_scalar, key->pub_key, p_scalar,
+		    ctx);
+	}
+
+	pre_comp[0] = pre->generator;
+	scalars[0] = g_scalar;
+	pre_comp[1] = pre->pub_key;
+	scalars[1] = p_scalar;
+
+	ret = ec_wNAF_mul_pre_comp(group, r, 2, pre_comp, scalars, ctx);
+
+	ec_key_pre_comp_free(pre);
+
+	return ret;
+}
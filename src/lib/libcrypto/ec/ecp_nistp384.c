@@ -0,0 +1,1150 @@
+/* $OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * A 64-bit implementation of the NIST P-384 elliptic curve point
+ * multiplication.
+ *
+ * Field elements are six 64-bit limbs in Montgomery form, R = 2^384, and
+ * the field operations are the word-by-word Montgomery reduction that
+ * fiat-crypto derives for this prime: straight-line code without
+ * secret-dependent branches or memory accesses. Points are in Jacobian
+ * coordinates and the structure of the point multiplication follows
+ * ecp_nistp256.c: a fixed-window ladder with signed 5-bit digits for
+ * arbitrary points and a two-table comb for the generator, with table
+ * lookups done in constant time.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/err.h>
+#include <openssl/opensslconf.h>
+
+#ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
+
+#include "ec_lcl.h"
+
+#if !defined(__SIZEOF_INT128__) || __SIZEOF_INT128__ != 16
+#error "Need a compiler with a 128-bit integer type"
+#endif
+
+typedef __uint128_t u128;
+typedef uint8_t u8;
+typedef uint64_t u64;
+
+#define NLIMBS	6
+
+/* A field element, in Montgomery form and fully reduced modulo p. */
+typedef u64 fe[NLIMBS];
+
+/*
+ * 48 bytes holding a 384-bit number. Scalars are stored little-endian by
+ * nistp384_scalar(); the curve parameters below are big-endian and are
+ * converted with BN_bin2bn().
+ */
+typedef u8 fe_bytearray[48];
+
+/*
+ * The parameters of P-384, from FIPS 186-4, section D.1.2.4. These values
+ * are big-endian.
+ */
+static const fe_bytearray nistp384_curve_params[5] = {
+	{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	/* p */
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+	{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,	/* a = -3 */
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+	 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc},
+	{0xb3, 0x31, 0x2f, 0xa7, 0xe2, 0x3e, 0xe7, 0xe4,	/* b */
+	 0x98, 0x8e, 0x05, 0x6b, 0xe3, 0xf8, 0x2d, 0x19,
+	 0x18, 0x1d, 0x9c, 0x6e, 0xfe, 0x81, 0x41, 0x12,
+	 0x03, 0x14, 0x08, 0x8f, 0x50, 0x13, 0x87, 0x5a,
+	 0xc6, 0x56, 0x39, 0x8d, 0x8a, 0x2e, 0xd1, 0x9d,
+	 0x2a, 0x85, 0xc8, 0xed, 0xd3, 0xec, 0x2a, 0xef},
+	{0xaa, 0x87, 0xca, 0x22, 0xbe, 0x8b, 0x05, 0x37,	/* x */
+	 0x8e, 0xb1, 0xc7, 0x1e, 0xf3, 0x20, 0xad, 0x74,
+	 0x6e, 0x1d, 0x3b, 0x62, 0x8b, 0xa7, 0x9b, 0x98,
+	 0x59, 0xf7, 0x41, 0xe0, 0x82, 0x54, 0x2a, 0x38,
+	 0x55, 0x02, 0xf2, 0x5d, 0xbf, 0x55, 0x29, 0x6c,
+	 0x3a, 0x54, 0x5e, 0x38, 0x72, 0x76, 0x0a, 0xb7},
+	{0x36, 0x17, 0xde, 0x4a, 0x96, 0x26, 0x2c, 0x6f,	/* y */
+	 0x5d, 0x9e, 0x98, 0xbf, 0x92, 0x92, 0xdc, 0x29,
+	 0xf8, 0xf4, 0x1d, 0xbd, 0x28, 0x9a, 0x14, 0x7c,
+	 0xe9, 0xda, 0x31, 0x13, 0xb5, 0xf0, 0xb8, 0xc0,
+	 0x0a, 0x60, 0xb1, 0xce, 0x1d, 0x7e, 0x81, 0x9d,
+	 0x7a, 0x43, 0x1d, 0x7c, 0x90, 0xea, 0x0e, 0x5f},
+};
+
+/* p = 2^384 - 2^128 - 2^96 + 2^32 - 1 */
+static const fe kPrime = {
+	0x00000000ffffffff, 0xffffffff00000000, 0xfffffffffffffffe,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+};
+
+/* -p^-1 mod 2^64 */
+static const u64 kPrimeInv = 0x0000000100000001;
+
+/* R^2 mod p, for conversion into Montgomery form. */
+static const fe kRR = {
+	0xfffffffe00000001, 0x0000000200000000, 0xfffffffe00000000,
+	0x0000000200000000, 0x0000000000000001, 0x0000000000000000,
+};
+
+/* p - 2, the exponent for inversion. */
+static const fe kPrimeMinus2 = {
+	0x00000000fffffffd, 0xffffffff00000000, 0xfffffffffffffffe,
+	0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+};
+
+/******************************************************************************/
+/*				FIELD OPERATIONS
+ */
+
+static void
+fe_copy(fe out, const fe in)
+{
+	memcpy(out, in, sizeof(fe));
+}
+
+/*
+ * Subtract p from the 385-bit value (carry, in) if it is at least p, and
+ * store the result in out.
+ */
+static void
+fe_reduce_once(fe out, const fe in, u64 carry)
+{
+	u128 acc;
+	u64 tmp[NLIMBS], borrow, mask;
+	int i;
+
+	borrow = 0;
+	for (i = 0; i < NLIMBS; i++) {
+		acc = (u128)in[i] - kPrime[i] - borrow;
+		tmp[i] = (u64)acc;
+		borrow = (u64)(acc >> 64) & 1;
+	}
+	/* mask is all ones if (carry, in) < p, that is, keep in. */
+	mask = 0 - (borrow & ~carry & 1);
+	for (i = 0; i < NLIMBS; i++)
+		out[i] = (in[i] & mask) | (tmp[i] & ~mask);
+}
+
+static void
+fe_add(fe out, const fe a, const fe b)
+{
+	u128 acc = 0;
+	u64 tmp[NLIMBS];
+	int i;
+
+	for (i = 0; i < NLIMBS; i++) {
+		acc += (u128)a[i] + b[i];
+		tmp[i] = (u64)acc;
+		acc >>= 64;
+	}
+	fe_reduce_once(out, tmp, (u64)acc);
+}
+
+static void
+fe_sub(fe out, const fe a, const fe b)
+{
+	u128 acc;
+	u64 tmp[NLIMBS], borrow, mask;
+	int i;
+
+	borrow = 0;
+	for (i = 0; i < NLIMBS; i++) {
+		acc = (u128)a[i] - b[i] - borrow;
+		tmp[i] = (u64)acc;
+		borrow = (u64)(acc >> 64) & 1;
+	}
+	/* Add p back if the subtraction borrowed. */
+	mask = 0 - borrow;
+	acc = 0;
+	for (i = 0; i < NLIMBS; i++) {
+		acc += (u128)tmp[i] + (kPrime[i] & mask);
+		out[i] = (u64)acc;
+		acc >>= 64;
+	}
+}
+
+/*
+ * Montgomery multiplication, out = a * b / R mod p. Operand scanning with
+ * one reduction step per word of b; the intermediate value stays below
+ * 2p, so that a single conditional subtraction is enough at the end.
+ */
+static void
+fe_mul(fe out, const fe a, const fe b)
+{
+	u64 t[NLIMBS + 2], m, carry;
+	u128 acc;
+	int i, j;
+
+	memset(t, 0, sizeof(t));
+	for (i = 0; i < NLIMBS; i++) {
+		carry = 0;
+		for (j = 0; j < NLIMBS; j++) {
+			acc = (u128)a[j] * b[i] + t[j] + carry;
+			t[j] = (u64)acc;
+			carry = (u64)(acc >> 64);
+		}
+		acc = (u128)t[NLIMBS] + carry;
+		t[NLIMBS] = (u64)acc;
+		t[NLIMBS + 1] = (u64)(acc >> 64);
+
+		m = t[0] * kPrimeInv;
+		acc = (u128)m * kPrime[0] + t[0];
+		carry = (u64)(acc >> 64);
+		for (j = 1; j < NLIMBS; j++) {
+			acc = (u128)m * kPrime[j] + t[j] + carry;
+			t[j - 1] = (u64)acc;
+			carry = (u64)(acc >> 64);
+		}
+		acc = (u128)t[NLIMBS] + carry;
+		t[NLIMBS - 1] = (u64)acc;
+		t[NLIMBS] = t[NLIMBS + 1] + (u64)(acc >> 64);
+	}
+	fe_reduce_once(out, t, t[NLIMBS]);
+}
+
+static void
+fe_sqr(fe out, const fe a)
+{
+	fe_mul(out, a, a);
+}
+
+/* Returns all ones if in is zero, and zero otherwise. */
+static u64
+fe_is_zero(const fe in)
+{
+	u64 acc = 0;
+	int i;
+
+	for (i = 0; i < NLIMBS; i++)
+		acc |= in[i];
+	/* acc is zero iff the top bit of ~acc & (acc - 1) is set. */
+	return 0 - ((~acc & (acc - 1)) >> 63);
+}
+
+/*
+ * Inversion by Fermat's little theorem, out = in^(p - 2), with a fixed
+ * 4-bit window. The exponent is public, so the sequence of operations does
+ * not depend on the input.
+ */
+static void
+fe_inv(fe out, const fe in)
+{
+	fe table[16], acc;
+	unsigned int nibble;
+	int i, first = 1;
+
+	/* table[i] = in^i, table[0] is unused. */
+	fe_copy(table[1], in);
+	for (i = 2; i < 16; i++)
+		fe_mul(table[i], table[i - 1], in);
+
+	memset(acc, 0, sizeof(acc));
+	for (i = 4 * NLIMBS * 4 - 1; i >= 0; i--) {
+		nibble = (kPrimeMinus2[i / 16] >> (4 * (i % 16))) & 0xf;
+		if (!first) {
+			fe_sqr(acc, acc);
+			fe_sqr(acc, acc);
+			fe_sqr(acc, acc);
+			fe_sqr(acc, acc);
+		}
+		if (nibble != 0) {
+			if (first)
+				fe_copy(acc, table[nibble]);
+			else
+				fe_mul(acc, acc, table[nibble]);
+			first = 0;
+		}
+	}
+	fe_copy(out, acc);
+
+	explicit_bzero(table, sizeof(table));
+}
+
+/* copy_conditional copies in to out iff mask is all ones. */
+static void
+copy_conditional(fe out, const fe in, u64 mask)
+{
+	int i;
+
+	for (i = 0; i < NLIMBS; i++)
+		out[i] ^= mask & (in[i] ^ out[i]);
+}
+
+/*
+ * Conversion between BIGNUMs and field elements. BN_to_fe() expects
+ * 0 <= bn < 2^384, fe_to_BN() produces the unique representative in [0, p).
+ */
+static int
+BN_to_fe(fe out, const BIGNUM *bn)
+{
+	u8 b_in[48];
+	fe tmp;
+	int i, j;
+
+	if (BN_is_negative(bn) || BN_num_bytes(bn) > (int)sizeof(b_in)) {
+		ECerror(EC_R_BIGNUM_OUT_OF_RANGE);
+		return 0;
+	}
+	if (BN_bn2lebinpad(bn, b_in, sizeof(b_in)) != sizeof(b_in))
+		return 0;
+	for (i = 0; i < NLIMBS; i++) {
+		tmp[i] = 0;
+		for (j = 7; j >= 0; j--)
+			tmp[i] = tmp[i] << 8 | b_in[8 * i + j];
+	}
+	fe_mul(out, tmp, kRR);
+	return 1;
+}
+
+static BIGNUM *
+fe_to_BN(BIGNUM *out, const fe in)
+{
+	static const fe one = { 1 };
+	u8 b_out[48];
+	fe tmp;
+	int i, j;
+
+	fe_mul(tmp, in, one);
+	for (i = 0; i < NLIMBS; i++) {
+		for (j = 0; j < 8; j++)
+			b_out[8 * i + j] = tmp[i] >> (8 * j);
+	}
+	return BN_lebin2bn(b_out, sizeof(b_out), out);
+}
+
+/******************************************************************************/
+/*				 ELLIPTIC CURVE POINT OPERATIONS
+ *
+ * Points are represented in Jacobian projective coordinates:
+ * (X, Y, Z) corresponds to the affine point (X/Z^2, Y/Z^3),
+ * or to the point at infinity if Z == 0.
+ */
+
+/*
+ * point_double calculates 2*(x_in, y_in, z_in)
+ *
+ * The method is taken from:
+ *   http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
+ *
+ * Outputs can equal corresponding inputs, i.e., x_out == x_in is allowed,
+ * while x_out == y_in is not (maybe this works, but it's not tested).
+ */
+static void
+point_double(fe x_out, fe y_out, fe z_out,
+    const fe x_in, const fe y_in, const fe z_in)
+{
+	fe delta, gamma, beta, alpha, tmp, tmp2;
+
+	/* delta = z^2, gamma = y^2, beta = x * gamma */
+	fe_sqr(delta, z_in);
+	fe_sqr(gamma, y_in);
+	fe_mul(beta, x_in, gamma);
+
+	/* alpha = 3 * (x - delta) * (x + delta) */
+	fe_sub(tmp, x_in, delta);
+	fe_add(tmp2, x_in, delta);
+	fe_mul(alpha, tmp, tmp2);
+	fe_add(tmp, alpha, alpha);
+	fe_add(alpha, alpha, tmp);
+
+	/* z' = (y + z)^2 - gamma - delta */
+	fe_add(tmp, y_in, z_in);
+	fe_sqr(tmp, tmp);
+	fe_sub(tmp, tmp, gamma);
+	fe_sub(z_out, tmp, delta);
+
+	/* x' = alpha^2 - 8 * beta */
+	fe_add(beta, beta, beta);
+	fe_add(beta, beta, beta);
+	fe_add(tmp2, beta, beta);
+	fe_sqr(tmp, alpha);
+	fe_sub(x_out, tmp, tmp2);
+
+	/* y' = alpha * (4 * beta - x') - 8 * gamma^2 */
+	fe_sub(tmp, beta, x_out);
+	fe_mul(tmp, alpha, tmp);
+	fe_sqr(gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_sub(y_out, tmp, gamma);
+}
+
+/*
+ * point_add calculates (x1, y1, z1) + (x2, y2, z2)
+ *
+ * The method is taken from:
+ *   http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-add-2007-bl,
+ * adapted for mixed addition (z2 = 1, or z2 = 0 for the point at infinity).
+ *
+ * This function includes a branch for checking whether the two input points
+ * are equal, (while not equal to the point at infinity). This case never
+ * happens during single point multiplication, so there is no timing leak for
+ * ECDH or ECDSA signing.
+ */
+static void
+point_add(fe x3, fe y3, fe z3, const fe x1, const fe y1, const fe z1,
+    const int mixed, const fe x2, const fe y2, const fe z2)
+{
+	fe z1z1, z2z2, u1, u2, s1, s2, h, r, i, j, v, tmp;
+	fe x_out, y_out, z_out;
+	u64 x_equal, y_equal, z1_is_zero, z2_is_zero;
+
+	z1_is_zero = fe_is_zero(z1);
+	z2_is_zero = fe_is_zero(z2);
+
+	/* z1z1 = z1^2 */
+	fe_sqr(z1z1, z1);
+
+	if (!mixed) {
+		/* z2z2 = z2^2 */
+		fe_sqr(z2z2, z2);
+
+		/* u1 = x1 * z2z2, s1 = y1 * z2^3 */
+		fe_mul(u1, x1, z2z2);
+		fe_mul(s1, y1, z2);
+		fe_mul(s1, s1, z2z2);
+
+		/* tmp = (z1 + z2)^2 - z1z1 - z2z2 = 2 * z1 * z2 */
+		fe_add(tmp, z1, z2);
+		fe_sqr(tmp, tmp);
+		fe_sub(tmp, tmp, z1z1);
+		fe_sub(tmp, tmp, z2z2);
+	} else {
+		/* We'll assume z2 = 1 (special case z2 = 0 is handled later) */
+		fe_copy(u1, x1);
+		fe_copy(s1, y1);
+		fe_add(tmp, z1, z1);
+	}
+
+	/* u2 = x2 * z1z1, s2 = y2 * z1^3 */
+	fe_mul(u2, x2, z1z1);
+	fe_mul(s2, y2, z1);
+	fe_mul(s2, s2, z1z1);
+
+	/* h = u2 - u1, r = 2 * (s2 - s1) */
+	fe_sub(h, u2, u1);
+	x_equal = fe_is_zero(h);
+	fe_sub(r, s2, s1);
+	fe_add(r, r, r);
+	y_equal = fe_is_zero(r);
+
+	if (x_equal & y_equal & ~z1_is_zero & ~z2_is_zero) {
+		point_double(x3, y3, z3, x1, y1, z1);
+		return;
+	}
+
+	/* z_out = 2 * z1 * z2 * h */
+	fe_mul(z_out, tmp, h);
+
+	/* i = (2 * h)^2, j = h * i, v = u1 * i */
+	fe_add(i, h, h);
+	fe_sqr(i, i);
+	fe_mul(j, h, i);
+	fe_mul(v, u1, i);
+
+	/* x_out = r^2 - j - 2 * v */
+	fe_sqr(x_out, r);
+	fe_sub(x_out, x_out, j);
+	fe_sub(x_out, x_out, v);
+	fe_sub(x_out, x_out, v);
+
+	/* y_out = r * (v - x_out) - 2 * s1 * j */
+	fe_sub(tmp, v, x_out);
+	fe_mul(y_out, r, tmp);
+	fe_mul(tmp, s1, j);
+	fe_add(tmp, tmp, tmp);
+	fe_sub(y_out, y_out, tmp);
+
+	copy_conditional(x_out, x2, z1_is_zero);
+	copy_conditional(x_out, x1, z2_is_zero);
+	copy_conditional(y_out, y2, z1_is_zero);
+	copy_conditional(y_out, y1, z2_is_zero);
+	copy_conditional(z_out, z2, z1_is_zero);
+	copy_conditional(z_out, z1, z2_is_zero);
+	fe_copy(x3, x_out);
+	fe_copy(y3, y_out);
+	fe_copy(z3, z_out);
+}
+
+/******************************************************************************/
+/*			 SCALAR MULTIPLICATION
+ */
+
+/*
+ * The generator comb table, in Montgomery form. gmul[0][i], with
+ * i = b3 b2 b1 b0 in binary, is the affine point
+ *
+ *	b0 * G + b1 * 2^96 * G + b2 * 2^192 * G + b3 * 2^288 * G
+ *
+ * with z = 1, or (0, 0, 0) for i = 0. gmul[1][i] is 2^48 * gmul[0][i].
+ */
+static const fe gmul[2][16][3] = {
+	{
+		{{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+		 {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+		 {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x3dd0756649c0b528, 0x20e378e2a0d6ce38, 0x879c3afc541b4d6e,
+		  0x6454868459a30eff, 0x812ff723614ede2b, 0x4d3aadc2299e1513},
+		 {0x23043dad4b03a4fe, 0xa1bfa8bf7bb4a9ac, 0x8bade7562e83b050,
+		  0xc6c3521968f4ffd9, 0xdd8002263969a840, 0x2b78abc25a15c5e9},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x24480c57f26feef9, 0xc31a26943a0e1240, 0x735002c3273e2bc7,
+		  0x8c42e9c53ef1ed4c, 0x028babf67f4948e8, 0x6a502f438a978632},
+		 {0xf5f13a46b74536fe, 0x1d218babd8a9f0eb, 0x30f36bcc37232768,
+		  0xc5317b31576e8c18, 0xef1d57a69bbcb766, 0x917c4930b3e3d4dc},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x11426e2ee349ddd0, 0x9f117ef99b2fc250, 0xff36b480ec0174a6,
+		  0x4f4bde7618458466, 0x2f2edb6d05806049, 0x8adc75d119dfca92},
+		 {0xa619d097b7d5a7ce, 0x874275e5a34411e9, 0x5403e0470da4b4ef,
+		  0x2ebaafd977901d8f, 0x5e63ebcea747170f, 0x12a369447f9d8036},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x378205de2f9fbe67, 0xc4afcb837f728e44, 0xdbcec06c682e00f1,
+		  0xf2a145c3114d5423, 0xa01d98747a52463e, 0xfc0935b17d717b0a},
+		 {0x9653bc4fd4d01f95, 0x9aa83ea89560ad34, 0xf77943dcaf8e3f3f,
+		  0x70774a10e86fe16e, 0x6b62e6f1bf9ffdcf, 0x8a72f39e588745c9},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x73ade4da2341c342, 0xdd326e54ea704422, 0x336c7d983741cef3,
+		  0x1eafa00d59e61549, 0xcd3ed892bd9a3efd, 0x03faf26cc5c6c7e4},
+		 {0x087e2fcf3045f8ac, 0x14a65532174f1e73, 0x2cf84f28fe0af9a7,
+		  0xddfd7a842cdc935b, 0x4c0f117b6929c895, 0x356572d64c8bcfcc},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xfab086073f3b236f, 0x19e9d41d81e221da, 0xf3f6571e3927b428,
+		  0x4348a9337550f1f6, 0x7167b996a85e62f0, 0x62d437597f5452bf},
+		 {0xd85feb9ef2955926, 0x440a561f6df78353, 0x389668ec9ca36b59,
+		  0x052bf1a1a22da016, 0xbdfbff72f6093254, 0x94e50f28e22209f3},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x90b2e5b33062e8af, 0xa8572375e8a3d369, 0x3fe1b00b201db7b1,
+		  0xe926def0ee651aa2, 0x6542c9beb9b10ad7, 0x098e309ba2fcbe74},
+		 {0x779deeb3fff1d63f, 0x23d0e80a20bfd374, 0x8452bb3b8768f797,
+		  0xcf75bb4d1f952856, 0x8fe6b40029ea3faa, 0x12bd3e4081373a53},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x070d34e116973cf4, 0x20aee08b7e4f34f7, 0x269af9b95eb8ad29,
+		  0xdde0a036a6a45dda, 0xa18b528e63df41e0, 0x03cc71b2a260df2a},
+		 {0x24a6770aa06b1dd7, 0x5bfa9c119d2675d3, 0x73c1e2a196844432,
+		  0x3660558d131a6cf0, 0xb0289c832ee79454, 0xa6aefb01c6d8ddcd},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xba1464b401ab5245, 0x9b8d0b6dc48d93ff, 0x939867dc93ad272c,
+		  0xbebe085eae9fdc77, 0x73ae5103894ea8bd, 0x740fc89a39ac22e1},
+		 {0x5e28b0a328e23b23, 0x2352722ee13104d0, 0xf4667a18b0a2640d,
+		  0xac74a72e49bb37c3, 0x79f734f0e81e183a, 0xbffe5b6c3fd9c0eb},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x03cf292200623f3b, 0x095c71115f29ebff, 0x42d7224780aa6823,
+		  0x044c7ba17458c0b0, 0xca62f7ef0959ec20, 0x40ae2ab7f8ca929f},
+		 {0xb8c5377aa927b102, 0x398a86a0dc031771, 0x04908f9dc216a406,
+		  0xb423a73a918d3300, 0x634b0ff1e0b94739, 0xe29de7252d69f697},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x744d14008435af04, 0x5f255b1dfec192da, 0x1f17dc12336dc542,
+		  0x5c90c2a7636a68a8, 0x960c9eb77704ca1e, 0x9de8cf1e6fb3d65a},
+		 {0xc60fee0d511d3d06, 0x466e2313f9eb52c7, 0x743c0f5f206b0914,
+		  0x42f55bac2191aa4d, 0xcefc7c8fffebdbc2, 0xd4fa6081e6e8ed1c},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x867db63998683186, 0xfb5cf424ddcc4ea9, 0xcc9a7ffed4f0e7bd,
+		  0x7c57f71c7a779f7e, 0x90774079d6b25ef2, 0x90eae903b4081680},
+		 {0xdf2aae5e0ee1fceb, 0x3ff1da24e86c1a1f, 0x80f587d6ca193edf,
+		  0xa5695523dc9b9d6a, 0x7b84090085920303, 0x1efa4dfcba6dbdef},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xfbd838f9e0540015, 0x2c323946c39077dc, 0x8b1fb9e6ad619124,
+		  0x9612440c0ca62ea8, 0x9ad9b52c2dbe00ff, 0xf52abaa1ae197643},
+		 {0xd0e898942cac32ad, 0xdfb79e4262a98f91, 0x65452ecf276f55cb,
+		  0xdb1ac0d27ad23e12, 0xf68c5f6ade4986f0, 0x389ac37b82ce327d},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xcd96866db8a9e8c9, 0xa11963b85bb8091e, 0xc7f90d53045b3cd2,
+		  0x755a72b580f36504, 0x46f8b39921d3751c, 0x4bffdc9153c193de},
+		 {0xcd15c049b89554e7, 0x353c6754f7a26be6, 0x79602370bd41d970,
+		  0xde16470b12b176c0, 0x56ba117540c8809d, 0xe2db35c3e435fb1e},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xd71e4aab6328e33f, 0x5486782baf8136d1, 0x07a4995f86d57231,
+		  0xf1f0a5bd1651a968, 0xa5dc5b2476803b6d, 0x5c587cbc42dda935},
+		 {0x2b6cdb32bae8b4c0, 0x66d1598bb1331138, 0x4a23b2d25d7e9614,
+		  0x93e402a674a8c05d, 0x45ac94e6da7ce82e, 0xeb9f8281e463d465},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+	},
+	{
+		{{0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+		 {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000},
+		 {0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x298647532b0c535b, 0x90dd695370506296, 0x038cd6b4216ab9ac,
+		  0x3df9b7b7be12d76a, 0x13f4d9785f347bdb, 0x222c5c9c13e94489},
+		 {0x5f8e796f2680dc64, 0x120e7cb758352417, 0x254b5d8ad10740b8,
+		  0xc38b8efb5337dee6, 0xf688c2e194f02247, 0x7b5c75f36c25bc4c},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x5584cbb3893b9a2d, 0x820c660b00850c5d, 0x4126d8267df2d43d,
+		  0xdd5bbbf00109e801, 0x85b92ee338172f1c, 0x609d4f93f31430d9},
+		 {0x1e059a07eadaf9d6, 0x70e6536c0f125fb0, 0xd6220751560f20e7,
+		  0xa59489ae7aaf3a9a, 0x7b70e2f664bae14e, 0x0dd0370176d08249},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xc07611f4df5bdf53, 0x45d331a758b11a6d, 0x58965daf1c4ee394,
+		  0xba8bebe75a5878d1, 0xaecc0a1882dd3025, 0xcf2a3899a923eb8b},
+		 {0xf98c9281d24fd048, 0x841bfb598bbb025d, 0xb8ddf8cec9ab9d53,
+		  0x538a4cb67fef044e, 0x092ac21f23236662, 0xa919d3850b66f065},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xc0426b775e3c647b, 0xbfcbd9398cf05348, 0x31d312e3172c0d3d,
+		  0x5f49fde6ee754737, 0x895530f06da7ee61, 0xcf281b0ae8b3a5fb},
+		 {0xfd14973541b8a543, 0x41a625a73080dd30, 0xe2baae07653908cf,
+		  0xc3d01436ba02a278, 0xa0d0222e7b21b8f8, 0xfdc270e9d7ec1297},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x4e50430efc14ab48, 0x195b7f4f26706a74, 0x2fe8a228cc881ff6,
+		  0xb1b968e2d945013d, 0x936aa5794b92162b, 0x4fb766b7364e754a},
+		 {0x13f93bca31e1ff7f, 0x696eb5cace4f2691, 0xff754bf8a2b09e02,
+		  0x58f13c9ce58e3ff8, 0xb757346f1678c0b0, 0xd54200dba86692b3},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x5cd9f5a87237cac0, 0x93f0b59d43586794, 0x4384a764e94f6c4e,
+		  0x8304ed2bb62782d3, 0x0b8db8b3cde06015, 0x4336dd535dbe190f},
+		 {0x5744355392ab473a, 0x031c7275be5ed046, 0x3e78678c21909aa4,
+		  0x4ab7e04f99202ddb, 0x2648d2066977e635, 0xd427d184093198be},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x8e74dc3579efdc58, 0x456bd3694ff68ddb, 0x724e74ccd32096a5,
+		  0xe41cff42386783d0, 0xa04c7f217c70d8a4, 0x41199d2fe61a19a2},
+		 {0xd389a3e029c05dd2, 0x535f2a6be7e3fda9, 0x26ecf72d7c2b4df8,
+		  0x678275f4fe745294, 0x6319c9cc9d23f519, 0x1e05a02d88048fc4},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x87c7dd7d139b3239, 0x8b57824e4d833bae, 0xbcbc48789fff0015,
+		  0x8ffcef8b909eaf1a, 0x9905f4eef1443a78, 0x020dd4a2e15cbfed},
+		 {0xca2969eca306d695, 0xdf940cadb93caf60, 0x67f7fab787ea6e39,
+		  0x0d0ee10ff98c4fe5, 0xc646879ac19cb91e, 0x4b4ea50c7d1d7ab4},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xd6d9aec823e4712c, 0x7ca8376cc3c198ee, 0xe6d8318731bebd8a,
+		  0xed57aff3d88bfef3, 0x72a645eecf44edc7, 0xd4e63d0b5cbb1517},
+		 {0x98ce7a1cceee0ecf, 0x8f0126335383ee8e, 0x3b879078a6b455e8,
+		  0xcbcd3d96c7658c06, 0x721d6fe70783336a, 0xf21a72635a677136},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x18482cec9b3f5034, 0x962d445acd9e68fd, 0x266fb1d695746f23,
+		  0xc66ade5a58c94a4b, 0xdbbda826ed68a5b6, 0x05664a4d7ab0d6ae},
+		 {0xbcd4fe51025e32fc, 0x61a5aebfa96df252, 0xd88a07e231592a31,
+		  0x5d9d94de98905517, 0x96bb40105fd440e7, 0x1b0c47a2e807db4c},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xc1004cff44b2e045, 0x91b5e1364b1c05d4, 0x53ae409088a48a07,
+		  0x73fb2995ea11bb1a, 0x320485703d93a4ea, 0xcce45de83bfc8a5f},
+		 {0xaff4a97ec2b3106e, 0x9069c630b6848b4f, 0xeda837a6ed76241c,
+		  0x8a0daf136cc3f6cf, 0x199d049d3da018a8, 0xf867c6b1d9093ba3},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x5285d116141d161c, 0x67cd2e0e93c4ed17, 0x12c62a647c36187e,
+		  0xf5329539ed2584ca, 0xc4c777c442fbbd69, 0x107de7761bdfc50a},
+		 {0x9976dcc5e96beebd, 0xbe2aff95a865a151, 0x0e0a9da19d8872af,
+		  0x5e357a3da63c17cc, 0xd31fdfd8e15cc67c, 0xc44bbefd7970c6d8},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0x1a60d1522ca8f2fe, 0x61640948491bd41f, 0x6dae29a558dfe035,
+		  0x9a615bea278e4863, 0xbbdb44779ad7c8e5, 0x1c7066302ceac2fc},
+		 {0x5e2b54c699699b4b, 0xb509ca6d239e17e8, 0x728165feea063a82,
+		  0x6b5e609db6a22e02, 0x12813905b26ee1df, 0x07b9f722439491fa},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xaa9da167b8153a9d, 0xa49fe3ac9e83ecf0, 0x14c18f8e1b661384,
+		  0x61c24dab38434de1, 0x3d973c3a283dae96, 0xc99baa0182754fc9},
+		 {0x477d198f4c26b1e3, 0x12e8e186a7516202, 0x386e52f6362addfa,
+		  0x31e8f695c3962853, 0xdec2af136aaedb60, 0xfcfdb4c629cf74ac},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+		{{0xe361a1987ffa0a5f, 0xf4b26102c63fe109, 0x264acbc56c74e111,
+		  0x4af445fa77abebaf, 0x448c4fdd24cddb75, 0x0b13157d44506eea},
+		 {0x22a6b15972e9993d, 0x2c3c57e485e5ecbe, 0xa673560bfd83e1a1,
+		  0x6be23f82c3b8c83b, 0x40b13a9640bbe38e, 0x66eea033ad17399b},
+		 {0xffffffff00000001, 0x00000000ffffffff, 0x0000000000000001,
+		  0x0000000000000000, 0x0000000000000000, 0x0000000000000000}},
+	},
+};
+
+/* Constant time access to a table of points. */
+static void
+select_point(const u64 idx, unsigned int size, const fe pre_comp[][3],
+    fe out[3])
+{
+	unsigned int i, j;
+	u64 *outlimbs = &out[0][0];
+
+	memset(outlimbs, 0, 3 * sizeof(fe));
+
+	for (i = 0; i < size; i++) {
+		const u64 *inlimbs = &pre_comp[i][0][0];
+		u64 mask = i ^ idx;
+		mask |= mask >> 4;
+		mask |= mask >> 2;
+		mask |= mask >> 1;
+		mask &= 1;
+		mask--;
+		for (j = 0; j < NLIMBS * 3; j++)
+			outlimbs[j] |= inlimbs[j] & mask;
+	}
+}
+
+/* get_bit returns the |i|th bit in |in| */
+static u64
+get_bit(const fe_bytearray in, int i)
+{
+	if ((i < 0) || (i >= 384))
+		return 0;
+	return (in[i >> 3] >> (i & 7)) & 1;
+}
+
+/*
+ * Recode the six bits of a window into a signed digit, as done by
+ * ec_GFp_nistp_recode_scalar_bits().
+ */
+static void
+recode_scalar_bits(u8 *sign, u8 *digit, u8 in)
+{
+	u8 s, d;
+
+	s = ~((in >> 5) - 1);	/* all ones iff bit 5 of in is set */
+	d = (1 << 6) - in - 1;
+	d = (d & s) | (in & ~s);
+	d = (d >> 1) + (d & 1);
+
+	*sign = s & 1;
+	*digit = d;
+}
+
+/*
+ * Interleaved point multiplication using the precomputed point multiples:
+ * the generator multiples are added in the last 48 rounds, two at a time,
+ * and the multiples of the other points every fifth round. The scalars
+ * are little-endian and less than 2^384, and the top window (bits 384 to
+ * 379) is therefore never negative.
+ */
+static void
+batch_mul(fe x_out, fe y_out, fe z_out, const fe_bytearray scalars[],
+    const unsigned int num_points, const u8 *g_scalar,
+    const fe pre_comp[][17][3])
+{
+	int i, skip;
+	unsigned int num, gen_mul = (g_scalar != NULL);
+	fe nq[3], tmp[3], ftmp;
+	u64 bits;
+	u8 sign, digit;
+
+	/* set nq to the point at infinity */
+	memset(nq, 0, sizeof(nq));
+
+	skip = 1;		/* save two point operations in the first
+				 * round */
+	for (i = (num_points ? 380 : 47); i >= 0; --i) {
+		/* double */
+		if (!skip)
+			point_double(nq[0], nq[1], nq[2], nq[0], nq[1], nq[2]);
+
+		/* add multiples of the generator */
+		if (gen_mul && (i <= 47)) {
+			/* first, look 48 bits upwards */
+			bits = get_bit(g_scalar, i + 336) << 3;
+			bits |= get_bit(g_scalar, i + 240) << 2;
+			bits |= get_bit(g_scalar, i + 144) << 1;
+			bits |= get_bit(g_scalar, i + 48);
+			/* select the point to add, in constant time */
+			select_point(bits, 16, gmul[1], tmp);
+
+			if (!skip) {
+				point_add(nq[0], nq[1], nq[2],
+				    nq[0], nq[1], nq[2],
+				    1 /* mixed */ , tmp[0], tmp[1], tmp[2]);
+			} else {
+				memcpy(nq, tmp, sizeof(nq));
+				skip = 0;
+			}
+
+			/* second, look at the current position */
+			bits = get_bit(g_scalar, i + 288) << 3;
+			bits |= get_bit(g_scalar, i + 192) << 2;
+			bits |= get_bit(g_scalar, i + 96) << 1;
+			bits |= get_bit(g_scalar, i);
+			/* select the point to add, in constant time */
+			select_point(bits, 16, gmul[0], tmp);
+			point_add(nq[0], nq[1], nq[2],
+			    nq[0], nq[1], nq[2],
+			    1 /* mixed */ , tmp[0], tmp[1], tmp[2]);
+		}
+
+		/* do other additions every 5 doublings */
+		if (num_points && (i % 5 == 0)) {
+			/* loop over all scalars */
+			for (num = 0; num < num_points; ++num) {
+				bits = get_bit(scalars[num], i + 4) << 5;
+				bits |= get_bit(scalars[num], i + 3) << 4;
+				bits |= get_bit(scalars[num], i + 2) << 3;
+				bits |= get_bit(scalars[num], i + 1) << 2;
+				bits |= get_bit(scalars[num], i) << 1;
+				bits |= get_bit(scalars[num], i - 1);
+				recode_scalar_bits(&sign, &digit, bits);
+
+				/*
+				 * select the point to add or subtract, in
+				 * constant time
+				 */
+				select_point(digit, 17, pre_comp[num], tmp);
+				memset(ftmp, 0, sizeof(ftmp));
+				/* (X, -Y, Z) is the negative point */
+				fe_sub(ftmp, ftmp, tmp[1]);
+				copy_conditional(tmp[1], ftmp, 0 - (u64)sign);
+
+				if (!skip) {
+					point_add(nq[0], nq[1], nq[2],
+					    nq[0], nq[1], nq[2],
+					    0, tmp[0], tmp[1], tmp[2]);
+				} else {
+					memcpy(nq, tmp, sizeof(nq));
+					skip = 0;
+				}
+			}
+		}
+	}
+	fe_copy(x_out, nq[0]);
+	fe_copy(y_out, nq[1]);
+	fe_copy(z_out, nq[2]);
+}
+
+/******************************************************************************/
+/*		       FUNCTIONS TO MANAGE PRECOMPUTATION
+ */
+
+static int
+ec_GFp_nistp384_group_init(EC_GROUP *group)
+{
+	int ret;
+
+	ret = ec_GFp_simple_group_init(group);
+	group->a_is_minus3 = 1;
+	return ret;
+}
+
+static int
+ec_GFp_nistp384_group_set_curve(EC_GROUP *group, const BIGNUM *p,
+    const BIGNUM *a, const BIGNUM *b, BN_CTX *ctx)
+{
+	int ret = 0;
+	BN_CTX *new_ctx = NULL;
+	BIGNUM *curve_p, *curve_a, *curve_b;
+
+	if (ctx == NULL)
+		if ((ctx = new_ctx = BN_CTX_new()) == NULL)
+			return 0;
+	BN_CTX_start(ctx);
+	if (((curve_p = BN_CTX_get(ctx)) == NULL) ||
+	    ((curve_a = BN_CTX_get(ctx)) == NULL) ||
+	    ((curve_b = BN_CTX_get(ctx)) == NULL))
+		goto err;
+	BN_bin2bn(nistp384_curve_params[0], sizeof(fe_bytearray), curve_p);
+	BN_bin2bn(nistp384_curve_params[1], sizeof(fe_bytearray), curve_a);
+	BN_bin2bn(nistp384_curve_params[2], sizeof(fe_bytearray), curve_b);
+	if ((BN_cmp(curve_p, p)) || (BN_cmp(curve_a, a)) ||
+	    (BN_cmp(curve_b, b))) {
+		ECerror(EC_R_WRONG_CURVE_PARAMETERS);
+		goto err;
+	}
+	group->field_mod_func = BN_nist_mod_384;
+	ret = ec_GFp_simple_group_set_curve(group, p, a, b, ctx);
+ err:
+	BN_CTX_end(ctx);
+	BN_CTX_free(new_ctx);
+	return ret;
+}
+
+/*
+ * Takes the Jacobian coordinates (X, Y, Z) of a point and returns
+ * (X', Y') = (X/Z^2, Y/Z^3)
+ */
+static int
+ec_GFp_nistp384_point_get_affine_coordinates(const EC_GROUP *group,
+    const EC_POINT *point, BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
+{
+	fe z1, z2, x_in, y_in;
+
+	if (EC_POINT_is_at_infinity(group, point) > 0) {
+		ECerror(EC_R_POINT_AT_INFINITY);
+		return 0;
+	}
+	if ((!BN_to_fe(x_in, &point->X)) || (!BN_to_fe(y_in, &point->Y)) ||
+	    (!BN_to_fe(z1, &point->Z)))
+		return 0;
+	fe_inv(z2, z1);
+	fe_sqr(z1, z2);
+	fe_mul(x_in, x_in, z1);
+	if (x != NULL) {
+		if (!fe_to_BN(x, x_in)) {
+			ECerror(ERR_R_BN_LIB);
+			return 0;
+		}
+	}
+	fe_mul(z1, z1, z2);
+	fe_mul(y_in, y_in, z1);
+	if (y != NULL) {
+		if (!fe_to_BN(y, y_in)) {
+			ECerror(ERR_R_BN_LIB);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Reduce scalar to 0 <= scalar < 2^384 and store it little-endian in out.
+ * Scalars that need a reduction are unusual inputs, for which constant
+ * time is not guaranteed.
+ */
+static int
+nistp384_scalar(fe_bytearray out, const EC_GROUP *group, const BIGNUM *scalar,
+    BIGNUM *tmp_scalar, BN_CTX *ctx)
+{
+	if (BN_num_bits(scalar) > 384 || BN_is_negative(scalar)) {
+		if (!BN_nnmod(tmp_scalar, scalar, &group->order, ctx)) {
+			ECerror(ERR_R_BN_LIB);
+			return 0;
+		}
+		scalar = tmp_scalar;
+	}
+	if (BN_bn2lebinpad(scalar, out, sizeof(fe_bytearray)) !=
+	    sizeof(fe_bytearray)) {
+		ECerror(ERR_R_BN_LIB);
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * Computes g_scalar * generator + p_scalar * point, ignoring NULL values.
+ * Result is stored in r (r can equal point).
+ */
+static int
+ec_GFp_nistp384_points_mul(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *g_scalar, const EC_POINT *point, const BIGNUM *p_scalar,
+    BN_CTX *ctx)
+{
+	int ret = 0;
+	int j;
+	unsigned int i, num_points = 0;
+	BN_CTX *new_ctx = NULL;
+	BIGNUM *x, *y, *z, *tmp_scalar;
+	fe_bytearray g_secret;
+	fe_bytearray secrets[2];
+	fe pre_comp[2][17][3];
+	fe x_out, y_out, z_out;
+	int have_pre_comp = 0;
+	EC_POINT *generator = NULL;
+	const EC_POINT *p[2];
+	const BIGNUM *p_scalars[2];
+
+	if (ctx == NULL)
+		if ((ctx = new_ctx = BN_CTX_new()) == NULL)
+			return 0;
+	BN_CTX_start(ctx);
+	if (((x = BN_CTX_get(ctx)) == NULL) ||
+	    ((y = BN_CTX_get(ctx)) == NULL) ||
+	    ((z = BN_CTX_get(ctx)) == NULL) ||
+	    ((tmp_scalar = BN_CTX_get(ctx)) == NULL))
+		goto err;
+
+	if (point != NULL && p_scalar != NULL) {
+		p[num_points] = point;
+		p_scalars[num_points++] = p_scalar;
+	}
+	if (g_scalar != NULL) {
+		generator = EC_POINT_new(group);
+		if (generator == NULL)
+			goto err;
+		/* get the generator from the standard precomputation */
+		if (!fe_to_BN(x, gmul[0][1][0]) ||
+		    !fe_to_BN(y, gmul[0][1][1]) ||
+		    !fe_to_BN(z, gmul[0][1][2])) {
+			ECerror(ERR_R_BN_LIB);
+			goto err;
+		}
+		if (!EC_POINT_set_Jprojective_coordinates(group, generator,
+		    x, y, z, ctx))
+			goto err;
+		if (0 == EC_POINT_cmp(group, generator, group->generator, ctx))
+			/* precomputation matches generator */
+			have_pre_comp = 1;
+		else {
+			/*
+			 * we don't have valid precomputation: treat the
+			 * generator as a random point
+			 */
+			p[num_points] = group->generator;
+			p_scalars[num_points++] = g_scalar;
+		}
+	}
+
+	memset(pre_comp, 0, sizeof(pre_comp));
+	for (i = 0; i < num_points; i++) {
+		if (!nistp384_scalar(secrets[i], group, p_scalars[i],
+		    tmp_scalar, ctx))
+			goto err;
+		/* precompute multiples */
+		if ((!BN_to_fe(pre_comp[i][1][0], &p[i]->X)) ||
+		    (!BN_to_fe(pre_comp[i][1][1], &p[i]->Y)) ||
+		    (!BN_to_fe(pre_comp[i][1][2], &p[i]->Z)))
+			goto err;
+		for (j = 2; j <= 16; ++j) {
+			if (j & 1) {
+				point_add(
+				    pre_comp[i][j][0], pre_comp[i][j][1], pre_comp[i][j][2],
+				    pre_comp[i][1][0], pre_comp[i][1][1], pre_comp[i][1][2],
+				    0, pre_comp[i][j - 1][0], pre_comp[i][j - 1][1],
+				    pre_comp[i][j - 1][2]);
+			} else {
+				point_double(
+				    pre_comp[i][j][0], pre_comp[i][j][1], pre_comp[i][j][2],
+				    pre_comp[i][j / 2][0], pre_comp[i][j / 2][1],
+				    pre_comp[i][j / 2][2]);
+			}
+		}
+	}
+
+	if (have_pre_comp) {
+		/* the scalar for the generator */
+		if (!nistp384_scalar(g_secret, group, g_scalar, tmp_scalar,
+		    ctx))
+			goto err;
+		/* do the multiplication with generator precomputation */
+		batch_mul(x_out, y_out, z_out, (const fe_bytearray *)secrets,
+		    num_points, g_secret, (const fe (*)[17][3])pre_comp);
+	} else
+		/* do the multiplication without generator precomputation */
+		batch_mul(x_out, y_out, z_out, (const fe_bytearray *)secrets,
+		    num_points, NULL, (const fe (*)[17][3])pre_comp);
+
+	if ((!fe_to_BN(x, x_out)) || (!fe_to_BN(y, y_out)) ||
+	    (!fe_to_BN(z, z_out))) {
+		ECerror(ERR_R_BN_LIB);
+		goto err;
+	}
+	ret = EC_POINT_set_Jprojective_coordinates(group, r, x, y, z, ctx);
+
+ err:
+	BN_CTX_end(ctx);
+	EC_POINT_free(generator);
+	BN_CTX_free(new_ctx);
+	explicit_bzero(g_secret, sizeof(g_secret));
+	explicit_bzero(secrets, sizeof(secrets));
+	explicit_bzero(pre_comp, sizeof(pre_comp));
+	return ret;
+}
+
+static int
+ec_GFp_nistp384_mul_generator_ct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *scalar, BN_CTX *ctx)
+{
+	return ec_GFp_nistp384_points_mul(group, r, scalar, NULL, NULL, ctx);
+}
+
+static int
+ec_GFp_nistp384_mul_single_ct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *scalar, const EC_POINT *point, BN_CTX *ctx)
+{
+	return ec_GFp_nistp384_points_mul(group, r, NULL, point, scalar, ctx);
+}
+
+static int
+ec_GFp_nistp384_mul_double_nonct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *g_scalar, const BIGNUM *p_scalar, const EC_POINT *point,
+    BN_CTX *ctx)
+{
+	return ec_GFp_nistp384_points_mul(group, r, g_scalar, point, p_scalar,
+	    ctx);
+}
+
+const EC_METHOD *
+EC_GFp_nistp384_method(void)
+{
+	static const EC_METHOD ret = {
+		.flags = EC_FLAGS_DEFAULT_OCT,
+		.field_type = NID_X9_62_prime_field,
+		.group_init = ec_GFp_nistp384_group_init,
+		.group_finish = ec_GFp_simple_group_finish,
+		.group_clear_finish = ec_GFp_simple_group_clear_finish,
+		.group_copy = ec_GFp_nist_group_copy,
+		.group_set_curve = ec_GFp_nistp384_group_set_curve,
+		.group_get_curve = ec_GFp_simple_group_get_curve,
+		.group_get_degree = ec_GFp_simple_group_get_degree,
+		.group_order_bits = ec_group_simple_order_bits,
+		.group_check_discriminant =
+		    ec_GFp_simple_group_check_discriminant,
+		.point_init = ec_GFp_simple_point_init,
+		.point_finish = ec_GFp_simple_point_finish,
+		.point_clear_finish = ec_GFp_simple_point_clear_finish,
+		.point_copy = ec_GFp_simple_point_copy,
+		.point_set_to_infinity = ec_GFp_simple_point_set_to_infinity,
+		.point_set_Jprojective_coordinates =
+		    ec_GFp_simple_set_Jprojective_coordinates,
+		.point_get_Jprojective_coordinates =
+		    ec_GFp_simple_get_Jprojective_coordinates,
+		.point_set_affine_coordinates =
+		    ec_GFp_simple_point_set_affine_coordinates,
+		.point_get_affine_coordinates =
+		    ec_GFp_nistp384_point_get_affine_coordinates,
+		.add = ec_GFp_simple_add,
+		.dbl = ec_GFp_simple_dbl,
+		.invert = ec_GFp_simple_invert,
+		.is_at_infinity = ec_GFp_simple_is_at_infinity,
+		.is_on_curve = ec_GFp_simple_is_on_curve,
+		.point_cmp = ec_GFp_simple_cmp,
+		.make_affine = ec_GFp_simple_make_affine,
+		.points_make_affine = ec_GFp_simple_points_make_affine,
+		.mul_generator_ct = ec_GFp_nistp384_mul_generator_ct,
+		.mul_single_ct = ec_GFp_nistp384_mul_single_ct,
+		.mul_double_nonct = ec_GFp_nistp384_mul_double_nonct,
+		.field_mul = ec_GFp_nist_field_mul,
+		.field_sqr = ec_GFp_nist_field_sqr,
+	};
+
+	return &ret;
+}
+
+#endif /* OPENSSL_NO_EC_NISTP_64_GCC_128 */
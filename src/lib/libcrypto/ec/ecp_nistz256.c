@@ -994,6 +994,34 @@ ecp_nistz256_points_mul(const EC_GROUP *group, EC_POINT *r,
 	return ret;
 }
 
+/*
+ * Both the generator table walk and the windowed multiplication are
+ * constant time, so ecp_nistz256_points_mul() serves all three cases.
+ */
+static int
+ecp_nistz256_mul_generator_ct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *scalar, BN_CTX *ctx)
+{
+	return ecp_nistz256_points_mul(group, r, scalar, 0, NULL, NULL, ctx);
+}
+
+static int
+ecp_nistz256_mul_single_ct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *scalar, const EC_POINT *point, BN_CTX *ctx)
+{
+	return ecp_nistz256_points_mul(group, r, NULL, 1, &point, &scalar,
+	    ctx);
+}
+
+static int
+ecp_nistz256_mul_double_nonct(const EC_GROUP *group, EC_POINT *r,
+    const BIGNUM *g_scalar, const BIGNUM *p_scalar, const EC_POINT *point,
+    BN_CTX *ctx)
+{
+	return ecp_nistz256_points_mul(group, r, g_scalar, 1, &point,
+	    &p_scalar, ctx);
+}
+
 static int
 ecp_nistz256_get_affine(const EC_GROUP *group, const EC_POINT *point,
     BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
@@ -1175,7 +1203,9 @@ EC_GFp_nistz256_method(void)
 		.point_cmp = ec_GFp_simple_cmp,
 		.make_affine = ec_GFp_simple_make_affine,
 		.points_make_affine = ec_GFp_simple_points_make_affine,
-		.mul = ecp_nistz256_points_mul,
+		.mul_generator_ct = ecp_nistz256_mul_generator_ct,
+		.mul_single_ct = ecp_nistz256_mul_single_ct,
+		.mul_double_nonct = ecp_nistz256_mul_double_nonct,
 		.precompute_mult = ecp_nistz256_mult_precompute,
 		.have_precompute_mult =
 		    ecp_nistz256_window_have_precompute_mult,
@@ -1706,6 +1706,10 @@ int
 ec_GFp_simple_mul_generator_ct(const EC_GROUP *group, EC_POINT *r,
     const BIGNUM *scalar, BN_CTX *ctx)
 {
+	int ret;
+
+	if ((ret = ec_comb_mul_generator(group, r, scalar, ctx)) != -1)
+		return ret;
 	return ec_GFp_simple_mul_ct(group, r, scalar, NULL, ctx);
 }
 
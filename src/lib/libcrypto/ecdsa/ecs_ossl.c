@@ -65,6 +65,7 @@
 #include <openssl/objects.h>
 
 #include "bn_lcl.h"
+#include "ec_lcl.h"
 #include "ecs_locl.h"
 
 static int ecdsa_prepare_digest(const unsigned char *dgst, int dgst_len,
@@ -510,7 +511,7 @@ ecdsa_do_verify(const unsigned char *dgst, int dgst_len, const ECDSA_SIG *sig,
 		ECDSAerror(ERR_R_MALLOC_FAILURE);
 		goto err;
 	}
-	if (!EC_POINT_mul(group, point, u1, pub_key, u2, ctx)) {
+	if (!ec_wNAF_key_mul(eckey, point, u1, u2, ctx)) {
 		ECDSAerror(ERR_R_EC_LIB);
 		goto err;
 	}
@@ -71,7 +71,7 @@ engine_unlocked_init(ENGINE *e)
 	if (to_return) {
 		/* OK, we return a functional reference which is also a
 		 * structural reference. */
-		e->struct_ref++;
+		CRYPTO_add(&e->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		e->funct_ref++;
 		engine_ref_debug(e, 0, 1)
 		engine_ref_debug(e, 1, 1)
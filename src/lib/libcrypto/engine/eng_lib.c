@@ -117,10 +117,11 @@ engine_free_util(ENGINE *e, int locked)
 
 	if (e == NULL)
 		return 1;
-	if (locked)
-		i = CRYPTO_add(&e->struct_ref, -1, CRYPTO_LOCK_ENGINE);
-	else
-		i = --e->struct_ref;
+	/*
+	 * CRYPTO_add() is atomic and does not take the lock, so it is used
+	 * whether or not the caller holds CRYPTO_LOCK_ENGINE.
+	 */
+	i = CRYPTO_add(&e->struct_ref, -1, CRYPTO_LOCK_ENGINE);
 	engine_ref_debug(e, 0, -1)
 	if (i > 0)
 		return 1;
@@ -140,7 +140,7 @@ engine_list_add(ENGINE *e)
 	}
 	/* Having the engine in the list assumes a structural
 	 * reference. */
-	e->struct_ref++;
+	CRYPTO_add(&e->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 	engine_ref_debug(e, 0, 1)
 	/* However it came to be, e is the last item in the list. */
 	engine_list_tail = e;
@@ -188,7 +188,7 @@ ENGINE_get_first(void)
 	CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
 	ret = engine_list_head;
 	if (ret) {
-		ret->struct_ref++;
+		CRYPTO_add(&ret->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		engine_ref_debug(ret, 0, 1)
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -203,7 +203,7 @@ ENGINE_get_last(void)
 	CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
 	ret = engine_list_tail;
 	if (ret) {
-		ret->struct_ref++;
+		CRYPTO_add(&ret->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		engine_ref_debug(ret, 0, 1)
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -224,7 +224,7 @@ ENGINE_get_next(ENGINE *e)
 	ret = e->next;
 	if (ret) {
 		/* Return a valid structural refernce to the next ENGINE */
-		ret->struct_ref++;
+		CRYPTO_add(&ret->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		engine_ref_debug(ret, 0, 1)
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -246,7 +246,7 @@ ENGINE_get_prev(ENGINE *e)
 	ret = e->prev;
 	if (ret) {
 		/* Return a valid structural reference to the next ENGINE */
-		ret->struct_ref++;
+		CRYPTO_add(&ret->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		engine_ref_debug(ret, 0, 1)
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
@@ -360,7 +360,8 @@ ENGINE_by_id(const char *id)
 				iterator = cp;
 			}
 		} else {
-			iterator->struct_ref++;
+			CRYPTO_add(&iterator->struct_ref, 1,
+			    CRYPTO_LOCK_ENGINE);
 			engine_ref_debug(iterator, 0, 1)
 		}
 	}
@@ -53,6 +53,8 @@
  *
  */
 
+#include <stdint.h>
+
 #include <openssl/err.h>
 #include <openssl/evp.h>
 #include <openssl/lhash.h>
@@ -73,16 +75,40 @@ typedef struct st_engine_pile {
 
 DECLARE_LHASH_OF(ENGINE_PILE);
 
-/* The type exposed in eng_int.h */
+/* The number of nids covered by the 'nids' bitmap of an ENGINE_TABLE */
+#define ENGINE_TABLE_NIDS	2048
+
+/* The type exposed in eng_int.h. engine_table_select() looks at 'nids'
+ * without holding the lock, even while engine_table_cleanup() runs, so a
+ * table must never be freed. Tables are therefore taken from the static
+ * engine_tables[] below rather than allocated: the first registration with
+ * a table pointer gives it a slot, which it keeps through cleanups and later
+ * registrations. All heap memory of a table is in 'piles', which cleanup
+ * frees. */
 struct st_engine_table {
-	LHASH_OF(ENGINE_PILE) piles;
+	/* NULL after engine_table_cleanup() */
+	LHASH_OF(ENGINE_PILE) *piles;
+	/* A bit is set for each nid whose pile may yield an ENGINE. Only
+	 * changed with the lock held, but read without it. */
+	uint32_t nids[ENGINE_TABLE_NIDS / 32];
 }; /* ENGINE_TABLE */
 
+/* One for each table pointer in the tb_*.c files, with room to spare */
+#define ENGINE_TABLES_MAX	16
+
+static ENGINE_TABLE engine_tables[ENGINE_TABLES_MAX];
+static int engine_tables_num = 0;
+
 typedef struct st_engine_pile_doall {
 	engine_table_doall_cb *cb;
 	void *arg;
 } ENGINE_PILE_DOALL;
 
+typedef struct st_engine_pile_unregister {
+	ENGINE_TABLE *table;
+	ENGINE *e;
+} ENGINE_PILE_UNREGISTER;
+
 /* Global flags (ENGINE_TABLE_FLAG_***). */
 static unsigned int table_flags = 0;
 
@@ -117,18 +143,53 @@ static IMPLEMENT_LHASH_COMP_FN(engine_pile, ENGINE_PILE)
 static int
 int_table_check(ENGINE_TABLE **t, int create)
 {
-	LHASH_OF(ENGINE_PILE) *lh;
+	ENGINE_TABLE *table;
 
-	if (*t)
+	if (*t != NULL && (*t)->piles != NULL)
 		return 1;
 	if (!create)
 		return 0;
-	if ((lh = lh_ENGINE_PILE_new()) == NULL)
+	if ((table = *t) == NULL) {
+		if (engine_tables_num >= ENGINE_TABLES_MAX)
+			return 0;
+		table = &engine_tables[engine_tables_num];
+	}
+	if ((table->piles = lh_ENGINE_PILE_new()) == NULL)
 		return 0;
-	*t = (ENGINE_TABLE *)lh;
+	if (*t == NULL) {
+		engine_tables_num++;
+		__atomic_store_n(t, table, __ATOMIC_RELEASE);
+	}
 	return 1;
 }
 
+/* Whether 'nid' may have an ENGINE in 'table'. Doesn't lock. */
+static int
+int_table_nid_isset(const ENGINE_TABLE *table, int nid)
+{
+	if (nid < 0 || nid >= ENGINE_TABLE_NIDS)
+		return 1;
+	return (__atomic_load_n(&table->nids[nid / 32], __ATOMIC_RELAXED) &
+	    (1U << (nid % 32))) != 0;
+}
+
+/* Needs the lock held */
+static void
+int_table_nid_set(ENGINE_TABLE *table, int nid, int on)
+{
+	uint32_t bit;
+
+	if (nid < 0 || nid >= ENGINE_TABLE_NIDS)
+		return;
+	bit = 1U << (nid % 32);
+	if (on)
+		__atomic_or_fetch(&table->nids[nid / 32], bit,
+		    __ATOMIC_RELEASE);
+	else
+		__atomic_and_fetch(&table->nids[nid / 32], ~bit,
+		    __ATOMIC_RELEASE);
+}
+
 /* Privately exposed (via eng_int.h) functions for adding and/or removing
  * ENGINEs from the implementation table */
 int
@@ -139,7 +200,7 @@ engine_table_register(ENGINE_TABLE **table, ENGINE_CLEANUP_CB *cleanup,
 	ENGINE_PILE tmplate, *fnd;
 
 	CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
-	if (!(*table))
+	if (*table == NULL || (*table)->piles == NULL)
 		added = 1;
 	if (!int_table_check(table, 1))
 		goto end;
@@ -148,7 +209,7 @@ engine_table_register(ENGINE_TABLE **table, ENGINE_CLEANUP_CB *cleanup,
 		engine_cleanup_add_first(cleanup);
 	while (num_nids--) {
 		tmplate.nid = *nids;
-		fnd = lh_ENGINE_PILE_retrieve(&(*table)->piles, &tmplate);
+		fnd = lh_ENGINE_PILE_retrieve((*table)->piles, &tmplate);
 		if (!fnd) {
 			fnd = malloc(sizeof(ENGINE_PILE));
 			if (!fnd)
@@ -161,7 +222,7 @@ engine_table_register(ENGINE_TABLE **table, ENGINE_CLEANUP_CB *cleanup,
 				goto end;
 			}
 			fnd->funct = NULL;
-			(void)lh_ENGINE_PILE_insert(&(*table)->piles, fnd);
+			(void)lh_ENGINE_PILE_insert((*table)->piles, fnd);
 		}
 		/* A registration shouldn't add duplciate entries */
 		(void)sk_ENGINE_delete_ptr(fnd->sk, e);
@@ -170,6 +231,7 @@ engine_table_register(ENGINE_TABLE **table, ENGINE_CLEANUP_CB *cleanup,
 			goto end;
 		/* "touch" this ENGINE_PILE */
 		fnd->uptodate = 0;
+		int_table_nid_set(*table, fnd->nid, 1);
 		if (setdefault) {
 			if (!engine_unlocked_init(e)) {
 				ENGINEerror(ENGINE_R_INIT_FAILED);
@@ -189,8 +251,9 @@ end:
 }
 
 static void
-int_unregister_cb_doall_arg(ENGINE_PILE *pile, ENGINE *e)
+int_unregister_cb_doall_arg(ENGINE_PILE *pile, ENGINE_PILE_UNREGISTER *unreg)
 {
+	ENGINE *e = unreg->e;
 	int n;
 
 	/* Iterate the 'c->sk' stack removing any occurance of 'e' */
@@ -202,16 +265,25 @@ int_unregister_cb_doall_arg(ENGINE_PILE *pile, ENGINE *e)
 		engine_unlocked_finish(e, 0);
 		pile->funct = NULL;
 	}
+	if (sk_ENGINE_num(pile->sk) == 0 && pile->funct == NULL)
+		int_table_nid_set(unreg->table, pile->nid, 0);
 }
-static IMPLEMENT_LHASH_DOALL_ARG_FN(int_unregister_cb, ENGINE_PILE, ENGINE)
+static IMPLEMENT_LHASH_DOALL_ARG_FN(int_unregister_cb, ENGINE_PILE,
+    ENGINE_PILE_UNREGISTER)
 
 void
 engine_table_unregister(ENGINE_TABLE **table, ENGINE *e)
 {
+	ENGINE_PILE_UNREGISTER unreg;
+
 	CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
-	if (int_table_check(table, 0))
-		lh_ENGINE_PILE_doall_arg(&(*table)->piles,
-		    LHASH_DOALL_ARG_FN(int_unregister_cb), ENGINE, e);
+	if (int_table_check(table, 0)) {
+		unreg.table = *table;
+		unreg.e = e;
+		lh_ENGINE_PILE_doall_arg((*table)->piles,
+		    LHASH_DOALL_ARG_FN(int_unregister_cb),
+		    ENGINE_PILE_UNREGISTER, &unreg);
+	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
 }
 
@@ -228,12 +300,18 @@ static IMPLEMENT_LHASH_DOALL_FN(int_cleanup_cb, ENGINE_PILE)
 void
 engine_table_cleanup(ENGINE_TABLE **table)
 {
+	int i;
+
 	CRYPTO_w_lock(CRYPTO_LOCK_ENGINE);
-	if (*table) {
-		lh_ENGINE_PILE_doall(&(*table)->piles,
+	if (int_table_check(table, 0)) {
+		/* The table itself stays, see the definition. */
+		for (i = 0; i < ENGINE_TABLE_NIDS / 32; i++)
+			__atomic_store_n(&(*table)->nids[i], 0,
+			    __ATOMIC_RELEASE);
+		lh_ENGINE_PILE_doall((*table)->piles,
 		    LHASH_DOALL_FN(int_cleanup_cb));
-		lh_ENGINE_PILE_free(&(*table)->piles);
-		*table = NULL;
+		lh_ENGINE_PILE_free((*table)->piles);
+		(*table)->piles = NULL;
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ENGINE);
 }
@@ -247,11 +325,13 @@ ENGINE *
 engine_table_select_tmp(ENGINE_TABLE **table, int nid, const char *f, int l)
 #endif
 {
+	ENGINE_TABLE *t;
 	ENGINE *ret = NULL;
 	ENGINE_PILE tmplate, *fnd = NULL;
 	int initres, loop = 0;
 
-	if (!(*table)) {
+	if ((t = __atomic_load_n(table, __ATOMIC_ACQUIRE)) == NULL ||
+	    !int_table_nid_isset(t, nid)) {
 #ifdef ENGINE_TABLE_DEBUG
 		fprintf(stderr, "engine_table_dbg: %s:%d, nid=%d, nothing "
 		    "registered!\n", f, l, nid);
@@ -265,7 +345,7 @@ engine_table_select_tmp(ENGINE_TABLE **table, int nid, const char *f, int l)
 	if (!int_table_check(table, 0))
 		goto end;
 	tmplate.nid = nid;
-	fnd = lh_ENGINE_PILE_retrieve(&(*table)->piles, &tmplate);
+	fnd = lh_ENGINE_PILE_retrieve((*table)->piles, &tmplate);
 	if (!fnd)
 		goto end;
 	if (fnd->funct && engine_unlocked_init(fnd->funct)) {
@@ -318,6 +398,10 @@ end:
 	 * registrations have taken place. In all cases, we cache. */
 	if (fnd)
 		fnd->uptodate = 1;
+	/* Until then, don't take the lock for this nid at all. */
+	if (ret == NULL && (fnd == NULL || fnd->funct == NULL) &&
+	    int_table_check(table, 0))
+		int_table_nid_set(*table, nid, 0);
 #ifdef ENGINE_TABLE_DEBUG
 	if (ret)
 		fprintf(stderr, "engine_table_dbg: %s:%d, nid=%d, caching "
@@ -347,8 +431,10 @@ engine_table_doall(ENGINE_TABLE *table, engine_table_doall_cb *cb, void *arg)
 {
 	ENGINE_PILE_DOALL dall;
 
+	if (table == NULL || table->piles == NULL)
+		return;
 	dall.cb = cb;
 	dall.arg = arg;
-	lh_ENGINE_PILE_doall_arg(&table->piles, LHASH_DOALL_ARG_FN(int_cb),
+	lh_ENGINE_PILE_doall_arg(table->piles, LHASH_DOALL_ARG_FN(int_cb),
 	    ENGINE_PILE_DOALL, &dall);
 }
@@ -246,7 +246,7 @@ ENGINE_pkey_asn1_find_str(ENGINE **pe, const char *str, int len)
 	engine_table_doall(pkey_asn1_meth_table, look_str_cb, &fstr);
 	/* If found obtain a structural reference to engine */
 	if (fstr.e) {
-		fstr.e->struct_ref++;
+		CRYPTO_add(&fstr.e->struct_ref, 1, CRYPTO_LOCK_ENGINE);
 		engine_ref_debug(fstr.e, 0, 1)
 	}
 	*pe = fstr.e;
@@ -122,6 +122,10 @@
 #include <openssl/err.h>
 #include <openssl/lhash.h>
 
+#ifndef OPENSSL_NO_ERR
+#include "err_table.h"
+#endif
+
 DECLARE_LHASH_OF(ERR_STRING_DATA);
 DECLARE_LHASH_OF(ERR_STATE);
 
@@ -286,6 +290,126 @@ static int int_err_library_number = ERR_LIB_USER;
 
 static pthread_t err_init_thread;
 
+#ifndef OPENSSL_NO_ERR
+static inline uint32_t
+err_table_mix(uint32_t h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+
+	return h;
+}
+#endif
+
+#ifndef OPENSSL_NO_ERR
+/*
+ * One bit for each entry of err_table that is currently loaded, and one for
+ * each entry whose string was replaced by a different one.
+ */
+static uint32_t err_table_loaded[(ERR_TABLE_SIZE + 31) / 32];
+static uint32_t err_table_replaced[(ERR_TABLE_SIZE + 31) / 32];
+static int SYS_str_reasons_loaded;
+#endif
+
+/*
+ * The strings of libcrypto itself are in err_table, which err_table.pl
+ * generates from the ERR_STRING_DATA tables at build time. They are never
+ * loaded into int_error_hash, which only holds strings added at run time,
+ * such as those of libssl. As with the hash, a string is only found after
+ * ERR_load_strings() was called for it and until it is unloaded again,
+ * which sets and clears its bit in err_table_loaded. Neither takes a lock.
+ *
+ * If a caller loads a different string for one of these codes, that string
+ * goes into int_error_hash like any other, and the bit in
+ * err_table_replaced sends lookups for the code there until it is unloaded
+ * or the built-in string is loaded again.
+ */
+static int
+err_table_index(unsigned long e)
+{
+#ifndef OPENSSL_NO_ERR
+	const ERR_STRING_DATA *p;
+	uint32_t b;
+
+	b = err_table_mix(e) >> (32 - ERR_TABLE_BUCKET_BITS);
+	p = &err_table[err_table_mix(e ^ err_table_disp[b]) &
+	    (ERR_TABLE_SIZE - 1)];
+	if (p->string != NULL && p->error == e)
+		return p - err_table;
+#endif
+	return -1;
+}
+
+#ifndef OPENSSL_NO_ERR
+static int
+err_table_bit(const uint32_t *bits, int i)
+{
+	return (__atomic_load_n(&bits[i / 32], __ATOMIC_ACQUIRE) &
+	    1U << (i % 32)) != 0;
+}
+
+static void
+err_table_set_bit(uint32_t *bits, int i, int on)
+{
+	uint32_t bit = 1U << (i % 32);
+
+	if (on)
+		__atomic_or_fetch(&bits[i / 32], bit, __ATOMIC_RELEASE);
+	else
+		__atomic_and_fetch(&bits[i / 32], ~bit, __ATOMIC_RELEASE);
+}
+#endif
+
+static void
+err_table_load(int i, ERR_STRING_DATA *str)
+{
+#ifndef OPENSSL_NO_ERR
+	if (str->string != NULL &&
+	    strcmp(str->string, err_table[i].string) == 0) {
+		if (err_table_bit(err_table_replaced, i)) {
+			err_table_set_bit(err_table_replaced, i, 0);
+			ERRFN(err_del_item)(str);
+		}
+	} else {
+		ERRFN(err_set_item)(str);
+		err_table_set_bit(err_table_replaced, i, 1);
+	}
+	err_table_set_bit(err_table_loaded, i, 1);
+#endif
+}
+
+static void
+err_table_unload(int i, ERR_STRING_DATA *str)
+{
+#ifndef OPENSSL_NO_ERR
+	err_table_set_bit(err_table_loaded, i, 0);
+	if (err_table_bit(err_table_replaced, i)) {
+		err_table_set_bit(err_table_replaced, i, 0);
+		ERRFN(err_del_item)(str);
+	}
+#endif
+}
+
+static const ERR_STRING_DATA *
+err_table_lookup(unsigned long e)
+{
+#ifndef OPENSSL_NO_ERR
+	int i;
+
+	if ((i = err_table_index(e)) == -1)
+		return NULL;
+	if (!err_table_bit(err_table_loaded, i) ||
+	    err_table_bit(err_table_replaced, i))
+		return NULL;
+	return &err_table[i];
+#else
+	return NULL;
+#endif
+}
+
 /* Internal function that checks whether "err_fns" is set and if not, sets it to
  * the defaults. */
 static void
@@ -460,7 +584,7 @@ LHASH_OF(ERR_STATE) *int_thread_get(int create)
 		CRYPTO_pop_info();
 	}
 	if (int_thread_hash) {
-		int_thread_hash_references++;
+		CRYPTO_add(&int_thread_hash_references, 1, CRYPTO_LOCK_ERR);
 		ret = int_thread_hash;
 	}
 	CRYPTO_w_unlock(CRYPTO_LOCK_ERR);
@@ -573,26 +697,18 @@ static ERR_STRING_DATA SYS_str_reasons[NUM_SYS_STR_REASONS + 1];
  * will be returned for SYSerror(which always gets an errno
  * value and never one of those 'standard' reason codes. */
 
+static pthread_once_t SYS_str_reasons_once = PTHREAD_ONCE_INIT;
+
+/*
+ * Only run through SYS_str_reasons_once. The strings are looked up in
+ * SYS_str_reasons directly, rather than loaded into int_error_hash.
+ */
 static void
 build_SYS_str_reasons(void)
 {
 	/* malloc cannot be used here, use static storage instead */
 	static char strerror_tab[NUM_SYS_STR_REASONS][LEN_SYS_STR_REASON];
 	int i;
-	static int init = 1;
-
-	CRYPTO_r_lock(CRYPTO_LOCK_ERR);
-	if (!init) {
-		CRYPTO_r_unlock(CRYPTO_LOCK_ERR);
-		return;
-	}
-
-	CRYPTO_r_unlock(CRYPTO_LOCK_ERR);
-	CRYPTO_w_lock(CRYPTO_LOCK_ERR);
-	if (!init) {
-		CRYPTO_w_unlock(CRYPTO_LOCK_ERR);
-		return;
-	}
 
 	for (i = 1; i <= NUM_SYS_STR_REASONS; i++) {
 		ERR_STRING_DATA *str = &SYS_str_reasons[i - 1];
@@ -613,10 +729,6 @@ build_SYS_str_reasons(void)
 
 	/* Now we still have SYS_str_reasons[NUM_SYS_STR_REASONS] = {0, NULL},
 	 * as required by ERR_load_strings. */
-
-	init = 0;
-
-	CRYPTO_w_unlock(CRYPTO_LOCK_ERR);
 }
 #endif
 
@@ -662,8 +774,8 @@ ERR_load_ERR_strings_internal(void)
 	err_load_strings(0, ERR_str_libraries);
 	err_load_strings(0, ERR_str_reasons);
 	err_load_strings(ERR_LIB_SYS, ERR_str_functs);
-	build_SYS_str_reasons();
-	err_load_strings(ERR_LIB_SYS, SYS_str_reasons);
+	(void) pthread_once(&SYS_str_reasons_once, build_SYS_str_reasons);
+	__atomic_store_n(&SYS_str_reasons_loaded, 1, __ATOMIC_RELEASE);
 #endif
 }
 
@@ -685,10 +797,15 @@ ERR_load_ERR_strings(void)
 static void
 err_load_strings(int lib, ERR_STRING_DATA *str)
 {
+	int i;
+
 	while (str->error) {
 		if (lib)
 			str->error |= ERR_PACK(lib, 0, 0);
-		ERRFN(err_set_item)(str);
+		if ((i = err_table_index(str->error)) != -1)
+			err_table_load(i, str);
+		else
+			ERRFN(err_set_item)(str);
 		str++;
 	}
 }
@@ -703,13 +820,18 @@ ERR_load_strings(int lib, ERR_STRING_DATA *str)
 void
 ERR_unload_strings(int lib, ERR_STRING_DATA *str)
 {
+	int i;
+
 	/* Prayer and clean living lets you ignore errors, OpenSSL style */
 	(void) OPENSSL_init_crypto(0, NULL);
 
 	while (str->error) {
 		if (lib)
 			str->error |= ERR_PACK(lib, 0, 0);
-		ERRFN(err_del_item)(str);
+		if ((i = err_table_index(str->error)) != -1)
+			err_table_unload(i, str);
+		else
+			ERRFN(err_del_item)(str);
 		str++;
 	}
 }
@@ -717,11 +839,22 @@ ERR_unload_strings(int lib, ERR_STRING_DATA *str)
 void
 ERR_free_strings(void)
 {
+#ifndef OPENSSL_NO_ERR
+	int i;
+#endif
+
 	/* Prayer and clean living lets you ignore errors, OpenSSL style */
 	(void) OPENSSL_init_crypto(0, NULL);
 
 	err_fns_check();
 	ERRFN(err_del)();
+#ifndef OPENSSL_NO_ERR
+	__atomic_store_n(&SYS_str_reasons_loaded, 0, __ATOMIC_RELAXED);
+	for (i = 0; i < (ERR_TABLE_SIZE + 31) / 32; i++) {
+		__atomic_store_n(&err_table_loaded[i], 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&err_table_replaced[i], 0, __ATOMIC_RELAXED);
+	}
+#endif
 }
 
 /********************************************************/
@@ -973,64 +1106,145 @@ ERR_release_err_state_table(LHASH_OF(ERR_STATE) **hash)
 	ERRFN(thread_release)(hash);
 }
 
+static const char *
+err_string(unsigned long e)
+{
+	const ERR_STRING_DATA *s;
+	ERR_STRING_DATA d, *p;
+
+	if ((s = err_table_lookup(e)) != NULL)
+		return s->string;
+
+	err_fns_check();
+	d.error = e;
+	p = ERRFN(err_get_item)(&d);
+	return ((p == NULL) ? NULL : p->string);
+}
+
 const char *
 ERR_lib_error_string(unsigned long e)
 {
-	ERR_STRING_DATA d, *p;
+	const ERR_STRING_DATA *s;
 	unsigned long l;
 
+	l = ERR_GET_LIB(e);
+	if ((s = err_table_lookup(ERR_PACK(l, 0, 0))) != NULL)
+		return s->string;
+
 	if (!OPENSSL_init_crypto(0, NULL))
 		return NULL;
 
-	err_fns_check();
-	l = ERR_GET_LIB(e);
-	d.error = ERR_PACK(l, 0, 0);
-	p = ERRFN(err_get_item)(&d);
-	return ((p == NULL) ? NULL : p->string);
+	return err_string(ERR_PACK(l, 0, 0));
 }
 
 const char *
 ERR_func_error_string(unsigned long e)
 {
-	ERR_STRING_DATA d, *p;
 	unsigned long l, f;
 
-	err_fns_check();
 	l = ERR_GET_LIB(e);
 	f = ERR_GET_FUNC(e);
-	d.error = ERR_PACK(l, f, 0);
-	p = ERRFN(err_get_item)(&d);
-	return ((p == NULL) ? NULL : p->string);
+	return err_string(ERR_PACK(l, f, 0));
 }
 
 const char *
 ERR_reason_error_string(unsigned long e)
 {
-	ERR_STRING_DATA d, *p = NULL;
+	const char *p;
 	unsigned long l, r;
 
-	err_fns_check();
 	l = ERR_GET_LIB(e);
 	r = ERR_GET_REASON(e);
-	d.error = ERR_PACK(l, 0, r);
-	p = ERRFN(err_get_item)(&d);
-	if (!p) {
-		d.error = ERR_PACK(0, 0, r);
-		p = ERRFN(err_get_item)(&d);
+#ifndef OPENSSL_NO_ERR
+	if (l == ERR_LIB_SYS && r > 0 && r <= NUM_SYS_STR_REASONS &&
+	    __atomic_load_n(&SYS_str_reasons_loaded, __ATOMIC_ACQUIRE))
+		return SYS_str_reasons[r - 1].string;
+#endif
+	if ((p = err_string(ERR_PACK(l, 0, r))) == NULL)
+		p = err_string(ERR_PACK(0, 0, r));
+	return p;
+}
+
+/*
+ * With the default implementation, every thread keeps its ERR_STATE in
+ * thread-specific storage rather than in int_thread_hash, so that getting
+ * at it takes neither CRYPTO_LOCK_ERR nor a hash lookup. The state is
+ * freed when the thread exits.
+ */
+static pthread_once_t err_state_once = PTHREAD_ONCE_INIT;
+static pthread_key_t err_state_key;
+static int err_state_key_ok;
+
+static void
+err_state_thread_free(void *arg)
+{
+	ERR_STATE_free(arg);
+}
+
+static void
+err_state_init(void)
+{
+	if (pthread_key_create(&err_state_key, err_state_thread_free) == 0)
+		err_state_key_ok = 1;
+}
+
+/*
+ * Runs when libcrypto is unloaded, so that threads exiting afterwards
+ * don't call err_state_thread_free(). The states of other threads that
+ * are still running are leaked.
+ */
+static void __attribute__((__destructor__))
+err_state_unload(void)
+{
+	ERR_STATE *es;
+
+	if (!err_state_key_ok)
+		return;
+	err_state_key_ok = 0;
+	if ((es = pthread_getspecific(err_state_key)) != NULL)
+		ERR_STATE_free(es);
+	(void)pthread_key_delete(err_state_key);
+}
+
+static ERR_STATE *
+err_thread_state(int create)
+{
+	ERR_STATE *es;
+
+	if (pthread_once(&err_state_once, err_state_init) != 0 ||
+	    !err_state_key_ok)
+		return NULL;
+	if ((es = pthread_getspecific(err_state_key)) != NULL || !create)
+		return es;
+	if ((es = calloc(1, sizeof(*es))) == NULL)
+		return NULL;
+	CRYPTO_THREADID_current(&es->tid);
+	if (pthread_setspecific(err_state_key, es) != 0) {
+		free(es);
+		return NULL;
 	}
-	return ((p == NULL) ? NULL : p->string);
+	return es;
 }
 
 void
 ERR_remove_thread_state(const CRYPTO_THREADID *id)
 {
-	ERR_STATE tmp;
+	ERR_STATE tmp, *es;
 
 	if (id)
 		CRYPTO_THREADID_cpy(&tmp.tid, id);
 	else
 		CRYPTO_THREADID_current(&tmp.tid);
 	err_fns_check();
+	if (err_fns == &err_defaults) {
+		/* Other threads free their state themselves on exit. */
+		if ((es = err_thread_state(0)) == NULL ||
+		    CRYPTO_THREADID_cmp(&es->tid, &tmp.tid) != 0)
+			return;
+		(void)pthread_setspecific(err_state_key, NULL);
+		ERR_STATE_free(es);
+		return;
+	}
 	/* thread_del_item automatically destroys the LHASH if the number of
 	 * items reaches zero. */
 	ERRFN(thread_del_item)(&tmp);
@@ -1053,6 +1267,12 @@ ERR_get_state(void)
 	CRYPTO_THREADID tid;
 
 	err_fns_check();
+	if (err_fns == &err_defaults) {
+		if ((ret = err_thread_state(1)) == NULL)
+			return (&fallback);
+		return ret;
+	}
+
 	CRYPTO_THREADID_current(&tid);
 	CRYPTO_THREADID_cpy(&tmp.tid, &tid);
 	ret = ERRFN(thread_get_item)(&tmp);
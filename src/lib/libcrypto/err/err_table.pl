@@ -0,0 +1,229 @@
+#!/usr/bin/perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Generate the table of built-in error strings used by err.c.
+#
+# usage: err_table.pl srcdir err_table.h file ...
+#
+# The ERR_STRING_DATA tables are read from the given source files, which
+# are relative to srcdir, the way they are loaded by the ERR_load_strings()
+# calls in the same file. The codes are evaluated using the numeric
+# defines from the headers in srcdir.
+#
+# The result is a perfect hash. A code e is found in bucket
+# err_table_mix(e) >> (32 - ERR_TABLE_BUCKET_BITS), which holds the
+# displacement d of the bucket, and is then looked up in the single slot
+# err_table_mix(e ^ d) & (ERR_TABLE_SIZE - 1) of err_table.
+
+use strict;
+use warnings;
+
+my $BUCKET_BITS;
+my $BITS;
+
+my ($srcdir, $out, @files) = @ARGV;
+die "usage: err_table.pl srcdir err_table.h file ...\n"
+    unless defined($out) && @files;
+
+sub slurp {
+	my ($file) = @_;
+
+	open(my $fh, '<', $file) or die "$file: $!\n";
+	my $s = do { local $/; <$fh> };
+	close($fh);
+	$s =~ s,/\*.*?\*/,,gs;
+	return $s;
+}
+
+# Numeric defines from all headers. A name defined with different values
+# is only an error if it is used.
+my %define;
+foreach my $h (glob("$srcdir/*.h"), glob("$srcdir/*/*.h")) {
+	foreach (split(/\n/, slurp($h))) {
+		next unless /^\s*#\s*define\s+(\w+)\s+(.+?)\s*$/;
+		my ($name, $value) = ($1, $2);
+		next unless $value =~ /^[\w\s()|+<>-]+$/;
+		$define{$name}{$value} = 1;
+	}
+}
+
+my %resolving;
+
+sub resolve {
+	my ($expr, $file) = @_;
+
+	$expr =~ s/\b(0x[0-9a-fA-F]+|\d+)[uUlL]*\b/$1/g;
+	$expr =~ s{\b([A-Za-z_]\w*)\b}{
+		my $name = $1;
+		my @v = keys(%{ $define{$name} || {} });
+		die "$file: unknown name $name\n" if (@v == 0);
+		die "$file: $name is recursive\n" if ($resolving{$name});
+		$resolving{$name} = 1;
+		my %n = map { resolve($_, $file) => 1 } @v;
+		delete($resolving{$name});
+		die "$file: $name has several values\n" if (keys(%n) > 1);
+		(keys(%n))[0];
+	}ge;
+	die "$file: cannot evaluate $expr\n"
+	    unless $expr =~ /^[0-9a-fA-Fx\s()|+<>-]+$/;
+	my $n = eval($expr);
+	die "$file: cannot evaluate $expr\n" if (!defined($n));
+	return $n;
+}
+
+sub pack_error {
+	my ($l, $f, $r) = @_;
+
+	return (($l & 0xff) << 24) | (($f & 0xfff) << 12) | ($r & 0xfff);
+}
+
+# Expand ERR_PACK() and the per file ERR_FUNC() and ERR_REASON() macros.
+sub expand {
+	my ($expr, $macros, $file) = @_;
+
+	while ($expr =~ /\b(ERR_FUNC|ERR_REASON)\(([^()]*)\)/) {
+		my ($m, $arg) = ($1, $2);
+		die "$file: $m is not defined\n" unless defined($macros->{$m});
+		$expr =~ s/\b$m\([^()]*\)/"($macros->{$m}{body})" =~
+		    s|\b$macros->{$m}{arg}\b|$arg|gr/e;
+	}
+	while ($expr =~ /\bERR_PACK\(([^()]*(?:\([^()]*\))?[^()]*)\)/) {
+		my @args = split(/,/, $1);
+		die "$file: bad ERR_PACK($1)\n" unless @args == 3;
+		my $v = pack_error(map { resolve($_, $file) } @args);
+		$expr =~ s/\bERR_PACK\(([^()]*(?:\([^()]*\))?[^()]*)\)/$v/;
+	}
+	return resolve($expr, $file);
+}
+
+my %string;
+my %from;
+
+foreach my $file (@files) {
+	my $src = slurp("$srcdir/$file");
+	my %macros;
+	my %tables;
+
+	while ($src =~ /^[ \t]*\#[ \t]*define[ \t]+(ERR_FUNC|ERR_REASON)\((\w+)\)[ \t]+([^\n]*)$
+	    |^static[ \t]+ERR_STRING_DATA[ \t]+(\w+)\s*\[\]\s*=\s*\{(.*?)\n\s*\}\s*;/gmsx) {
+		if (defined($1)) {
+			$macros{$1} = { arg => $2, body => $3 };
+			next;
+		}
+		my ($name, $body) = ($4, $5);
+		my @entries;
+		while ($body =~ /\{\s*([^{}"]*?)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\}/g) {
+			push(@entries, [ expand($1, \%macros, $file), $2 ]);
+		}
+		$tables{$name} = \@entries;
+	}
+
+	while ($src =~ /\b(?:ERR|err)_load_strings\(\s*(\w+)\s*,\s*(\w+)\s*\)/g) {
+		my ($lib, $name) = ($1, $2);
+		next unless defined($tables{$name});
+		$lib = $lib eq "0" ? 0 : resolve($lib, $file);
+		foreach my $e (@{ $tables{$name} }) {
+			my $code = $e->[0];
+			$code |= pack_error($lib, 0, 0) if ($lib);
+			# Within a file, a later entry replaces an earlier one
+			# as it does in the hash.
+			if (defined($from{$code}) && $from{$code} ne $file) {
+				die sprintf("%s: error 0x%08x is also defined in %s\n",
+				    $file, $code, $from{$code});
+			}
+			$string{$code} = $e->[1];
+			$from{$code} = $file;
+		}
+	}
+}
+
+sub mul32 {
+	my ($a, $b) = @_;
+
+	return ((($a * ($b & 0xffff)) & 0xffffffff) +
+	    ((($a * ($b >> 16)) & 0xffff) << 16)) & 0xffffffff;
+}
+
+# The finalizer of MurmurHash3, as in err_table_mix() in err.c.
+sub mix {
+	my ($h) = @_;
+
+	$h ^= $h >> 16;
+	$h = mul32($h, 0x85ebca6b);
+	$h ^= $h >> 13;
+	$h = mul32($h, 0xc2b2ae35);
+	$h ^= $h >> 16;
+	return $h;
+}
+
+my @codes = sort { $a <=> $b } keys(%string);
+die "no error strings found\n" unless @codes;
+
+$BITS = 1;
+$BITS++ while ((1 << $BITS) < @codes + @codes / 4);
+$BUCKET_BITS = $BITS - 2;
+$BUCKET_BITS = 1 if ($BUCKET_BITS < 1);
+
+my @buckets;
+push(@{ $buckets[mix($_) >> (32 - $BUCKET_BITS)] }, $_) foreach (@codes);
+
+my @slot;
+my @disp = (0) x (1 << $BUCKET_BITS);
+foreach my $b (sort { @{ $buckets[$b] || [] } <=> @{ $buckets[$a] || [] } ||
+    $a <=> $b } (0 .. (1 << $BUCKET_BITS) - 1)) {
+	my @keys = @{ $buckets[$b] || [] };
+	next unless @keys;
+	DISP: for (my $d = 0; ; $d++) {
+		die "cannot place bucket $b\n" if ($d > 0xffff);
+		my %used;
+		foreach my $k (@keys) {
+			my $s = mix($k ^ $d) & ((1 << $BITS) - 1);
+			next DISP if (defined($slot[$s]) || $used{$s});
+			$used{$s} = 1;
+		}
+		$slot[mix($_ ^ $d) & ((1 << $BITS) - 1)] = $_ foreach (@keys);
+		$disp[$b] = $d;
+		last;
+	}
+}
+
+open(my $oh, '>', "$out.tmp") or die "$out.tmp: $!\n";
+print $oh <<EOF;
+/*
+ * THIS FILE IS GENERATED BY err_table.pl. DO NOT EDIT.
+ */
+
+#define ERR_TABLE_BUCKET_BITS	$BUCKET_BITS
+#define ERR_TABLE_BITS		$BITS
+#define ERR_TABLE_SIZE		(1 << ERR_TABLE_BITS)
+
+static const uint16_t err_table_disp[1 << ERR_TABLE_BUCKET_BITS] = {
+EOF
+for (my $i = 0; $i < @disp; $i += 8) {
+	my $last = $i + 7 < $#disp ? $i + 7 : $#disp;
+	print $oh "\t" . join(", ", @disp[$i .. $last]) . ",\n";
+}
+print $oh "};\n\n";
+print $oh "static const ERR_STRING_DATA err_table[ERR_TABLE_SIZE] = {\n";
+foreach my $k (@slot[0 .. (1 << $BITS) - 1]) {
+	if (defined($k)) {
+		printf $oh "\t{ 0x%08xUL, \"%s\" },\n", $k, $string{$k};
+	} else {
+		print $oh "\t{ 0, NULL },\n";
+	}
+}
+print $oh "};\n";
+close($oh) or die "$out.tmp: $!\n";
+rename("$out.tmp", $out) or die "$out: $!\n";
@@ -121,6 +121,43 @@ poly1305_update_with_pad16(poly1305_state *poly1305,
 	poly1305_pad16(poly1305, data_len);
 }
 
+/*
+ * Encrypt with ChaCha20 and authenticate the ciphertext with Poly1305 one
+ * chunk at a time, so that each chunk is authenticated while it is still
+ * in the cache rather than in a second pass over the data. The chunk size
+ * is a multiple of the ChaCha20 block size, so that the counter can be
+ * advanced between chunks, and is large enough for the multi-block
+ * implementations of both primitives.
+ *
+ * Open does not use this: it must not write to out before the tag has
+ * been checked, so it authenticates the whole ciphertext first.
+ */
+#define CHACHA20_POLY1305_CHUNK_LEN 8192
+
+static void
+chacha20_poly1305_encrypt(poly1305_state *poly1305, unsigned char *out,
+    const unsigned char *in, size_t len, const unsigned char key[32],
+    const unsigned char iv[8], uint64_t counter)
+{
+	size_t data_len = len;
+	size_t n;
+
+	while (len > 0) {
+		if ((n = len) > CHACHA20_POLY1305_CHUNK_LEN)
+			n = CHACHA20_POLY1305_CHUNK_LEN;
+
+		CRYPTO_chacha_20(out, in, n, key, iv, counter);
+		CRYPTO_poly1305_update(poly1305, out, n);
+
+		counter += n / 64;
+		in += n;
+		out += n;
+		len -= n;
+	}
+
+	poly1305_pad16(poly1305, data_len);
+}
+
 static int
 aead_chacha20_poly1305_seal(const EVP_AEAD_CTX *ctx, unsigned char *out,
     size_t *out_len, size_t max_out_len, const unsigned char *nonce,
@@ -153,8 +190,8 @@ aead_chacha20_poly1305_seal(const EVP_AEAD_CTX *ctx, unsigned char *out,
 
 	CRYPTO_poly1305_init(&poly1305, poly1305_key);
 	poly1305_update_with_pad16(&poly1305, ad, ad_len);
-	CRYPTO_chacha_20(out, in, in_len, c20_ctx->key, iv, ctr + 1);
-	poly1305_update_with_pad16(&poly1305, out, in_len);
+	chacha20_poly1305_encrypt(&poly1305, out, in, in_len, c20_ctx->key,
+	    iv, ctr + 1);
 	poly1305_update_with_length(&poly1305, NULL, ad_len);
 	poly1305_update_with_length(&poly1305, NULL, in_len);
 
@@ -251,15 +288,14 @@ aead_xchacha20_poly1305_seal(const EVP_AEAD_CTX *ctx, unsigned char *out,
 
 	CRYPTO_hchacha_20(subkey, c20_ctx->key, nonce);
 
-	CRYPTO_chacha_20(out, in, in_len, subkey, nonce + 16, 1);
-
 	memset(poly1305_key, 0, sizeof(poly1305_key));
 	CRYPTO_chacha_20(poly1305_key, poly1305_key, sizeof(poly1305_key),
 	    subkey, nonce + 16, 0);
 
 	CRYPTO_poly1305_init(&poly1305, poly1305_key);
 	poly1305_update_with_pad16(&poly1305, ad, ad_len);
-	poly1305_update_with_pad16(&poly1305, out, in_len);
+	chacha20_poly1305_encrypt(&poly1305, out, in, in_len, subkey,
+	    nonce + 16, 1);
 	poly1305_update_with_length(&poly1305, NULL, ad_len);
 	poly1305_update_with_length(&poly1305, NULL, in_len);
 
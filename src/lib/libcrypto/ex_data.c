@@ -138,8 +138,10 @@
  *
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include <openssl/err.h>
-#include <openssl/lhash.h>
 
 /* What an "implementation of ex_data functionality" looks like */
 struct st_CRYPTO_EX_DATA_IMPL {
@@ -235,139 +237,128 @@ CRYPTO_set_ex_data_implementation(const CRYPTO_EX_DATA_IMPL *i)
 /* Interal (default) implementation of "ex_data" support. API functions are
  * further down. */
 
-/* The type that represents what each "class" used to implement locally. A STACK
- * of CRYPTO_EX_DATA_FUNCS plus a index-counter. The 'class_index' is the global
- * value representing the class that is used to distinguish these items. */
+/* The methods registered for one class. Methods are only ever appended:
+ * meth[meth_num] is filled in before meth_num is raised, so a reader that
+ * loads meth_num and then meth sees at least meth_num methods. */
 typedef struct st_ex_class_item {
 	int class_index;
-	STACK_OF(CRYPTO_EX_DATA_FUNCS) *meth;
 	int meth_num;
+	int meth_max;
+	CRYPTO_EX_DATA_FUNCS **meth;
 } EX_CLASS_ITEM;
 
+/* An array that was replaced by a larger one. Readers may still use it, so
+ * it is only freed by int_cleanup(). Since arrays double in size, the
+ * retired arrays together are never larger than the current ones. */
+typedef struct st_ex_retired {
+	void *array;
+	struct st_ex_retired *next;
+} EX_RETIRED;
+
 /* When assigning new class indexes, this is our counter */
 static int ex_class = CRYPTO_EX_INDEX_USER;
 
-/* The global hash table of EX_CLASS_ITEM items */
-DECLARE_LHASH_OF(EX_CLASS_ITEM);
-static LHASH_OF(EX_CLASS_ITEM) *ex_data = NULL;
-
-/* The callbacks required in the "ex_data" hash table */
-static unsigned long
-ex_class_item_hash(const EX_CLASS_ITEM *a)
-{
-	return a->class_index;
-}
-
-static IMPLEMENT_LHASH_HASH_FN(ex_class_item, EX_CLASS_ITEM)
+/* The classes that have methods, appended to in the same way as the methods
+ * of a class. They are only changed with the CRYPTO_LOCK_EX_DATA write lock
+ * held. */
+static EX_CLASS_ITEM **ex_classes = NULL;
+static int ex_classes_num = 0;
+static int ex_classes_max = 0;
+static EX_RETIRED *ex_retired = NULL;
 
+/* Set *meth to the methods of a class and return their number. Doesn't
+ * lock. */
 static int
-ex_class_item_cmp(const EX_CLASS_ITEM *a, const EX_CLASS_ITEM *b)
+def_get_meth(int class_index, CRYPTO_EX_DATA_FUNCS ***meth)
 {
-	return a->class_index - b->class_index;
-}
-
-static IMPLEMENT_LHASH_COMP_FN(ex_class_item, EX_CLASS_ITEM)
-
-/* Internal functions used by the "impl_default" implementation to access the
- * state */
+	EX_CLASS_ITEM **classes, *item;
+	int i, num;
 
-static int
-ex_data_check(void)
-{
-	int toret = 1;
-	CRYPTO_w_lock(CRYPTO_LOCK_EX_DATA);
-	if (!ex_data &&
-	    (ex_data = lh_EX_CLASS_ITEM_new()) == NULL)
-		toret = 0;
-	CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
-	return toret;
-}
-/* This macros helps reduce the locking from repeated checks because the
- * ex_data_check() function checks ex_data again inside a lock. */
-#define EX_DATA_CHECK(iffail) if(!ex_data && !ex_data_check()) {iffail}
-
-/* This "inner" callback is used by the callback function that follows it */
-static void
-def_cleanup_util_cb(CRYPTO_EX_DATA_FUNCS *funcs)
-{
-	free(funcs);
-}
-
-/* This callback is used in lh_doall to destroy all EX_CLASS_ITEM values from
- * "ex_data" prior to the ex_data hash table being itself destroyed. Doesn't do
- * any locking. */
-static void
-def_cleanup_cb(void *a_void)
-{
-	EX_CLASS_ITEM *item = (EX_CLASS_ITEM *)a_void;
-	sk_CRYPTO_EX_DATA_FUNCS_pop_free(item->meth, def_cleanup_util_cb);
-	free(item);
+	if ((num = __atomic_load_n(&ex_classes_num, __ATOMIC_ACQUIRE)) == 0)
+		return 0;
+	classes = __atomic_load_n(&ex_classes, __ATOMIC_ACQUIRE);
+	for (i = 0; i < num; i++) {
+		item = classes[i];
+		if (item->class_index == class_index) {
+			num = __atomic_load_n(&item->meth_num,
+			    __ATOMIC_ACQUIRE);
+			*meth = __atomic_load_n(&item->meth, __ATOMIC_ACQUIRE);
+			return num;
+		}
+	}
+	return 0;
 }
 
-/* Return the EX_CLASS_ITEM from the "ex_data" hash table that corresponds to a
- * given class. Handles locking. */
-static EX_CLASS_ITEM *
-def_get_class(int class_index)
+/* Return an array with room for num + 1 elements of the given size, which is
+ * either "array" or a larger copy of it. In the latter case "array" goes on
+ * the retired list. Must be called with the write lock held. */
+static void *
+def_grow(void *array, int num, int *max, size_t size)
 {
-	EX_CLASS_ITEM d, *p, *gen;
-	EX_DATA_CHECK(return NULL;)
-	d.class_index = class_index;
-	if (!OPENSSL_init_crypto(0, NULL))
+	EX_RETIRED *r = NULL;
+	void *a;
+	int n;
+
+	if (num < *max)
+		return array;
+	n = *max > 0 ? *max * 2 : 4;
+	if ((a = reallocarray(NULL, n, size)) == NULL)
 		return NULL;
-	CRYPTO_w_lock(CRYPTO_LOCK_EX_DATA);
-	p = lh_EX_CLASS_ITEM_retrieve(ex_data, &d);
-	if (!p) {
-		gen = malloc(sizeof(EX_CLASS_ITEM));
-		if (gen) {
-			gen->class_index = class_index;
-			gen->meth_num = 0;
-			gen->meth = sk_CRYPTO_EX_DATA_FUNCS_new_null();
-			if (!gen->meth)
-				free(gen);
-			else {
-				/* Because we're inside the ex_data lock, the
-				 * return value from the insert will be NULL */
-				(void)lh_EX_CLASS_ITEM_insert(ex_data, gen);
-				p = gen;
-			}
+	if (array != NULL) {
+		if ((r = malloc(sizeof(EX_RETIRED))) == NULL) {
+			free(a);
+			return NULL;
 		}
+		memcpy(a, array, num * size);
+		r->array = array;
+		r->next = ex_retired;
+		ex_retired = r;
 	}
-	CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
-	if (!p)
-		CRYPTOerror(ERR_R_MALLOC_FAILURE);
-	return p;
+	*max = n;
+	return a;
 }
 
-/* Add a new method to the given EX_CLASS_ITEM and return the corresponding
- * index (or -1 for error). Handles locking. */
+/* Append "a" to the methods of its class and return the index of it (or -1
+ * for error). Handles locking. */
 static int
-def_add_index(EX_CLASS_ITEM *item, long argl, void *argp,
-    CRYPTO_EX_new *new_func, CRYPTO_EX_dup *dup_func, CRYPTO_EX_free *free_func)
+def_add_index(int class_index, CRYPTO_EX_DATA_FUNCS *a)
 {
-	int toret = -1;
-	CRYPTO_EX_DATA_FUNCS *a = malloc(sizeof(CRYPTO_EX_DATA_FUNCS));
+	EX_CLASS_ITEM **classes, *item = NULL;
+	CRYPTO_EX_DATA_FUNCS **meth;
+	int i, toret = -1;
 
-	if (!a) {
-		CRYPTOerror(ERR_R_MALLOC_FAILURE);
-		return -1;
-	}
-	a->argl = argl;
-	a->argp = argp;
-	a->new_func = new_func;
-	a->dup_func = dup_func;
-	a->free_func = free_func;
 	CRYPTO_w_lock(CRYPTO_LOCK_EX_DATA);
-	while (sk_CRYPTO_EX_DATA_FUNCS_num(item->meth) <= item->meth_num) {
-		if (!sk_CRYPTO_EX_DATA_FUNCS_push(item->meth, NULL)) {
-			CRYPTOerror(ERR_R_MALLOC_FAILURE);
-			free(a);
-			goto err;
+	for (i = 0; i < ex_classes_num; i++) {
+		if (ex_classes[i]->class_index == class_index) {
+			item = ex_classes[i];
+			break;
 		}
 	}
-	toret = item->meth_num++;
-	(void)sk_CRYPTO_EX_DATA_FUNCS_set(item->meth, toret, a);
-err:
+	if (item == NULL) {
+		if ((classes = def_grow(ex_classes, ex_classes_num,
+		    &ex_classes_max, sizeof(EX_CLASS_ITEM *))) == NULL)
+			goto err;
+		__atomic_store_n(&ex_classes, classes, __ATOMIC_RELEASE);
+		if ((item = calloc(1, sizeof(EX_CLASS_ITEM))) == NULL)
+			goto err;
+		item->class_index = class_index;
+		classes[ex_classes_num] = item;
+		__atomic_store_n(&ex_classes_num, ex_classes_num + 1,
+		    __ATOMIC_RELEASE);
+	}
+
+	if ((meth = def_grow(item->meth, item->meth_num, &item->meth_max,
+	    sizeof(CRYPTO_EX_DATA_FUNCS *))) == NULL)
+		goto err;
+	__atomic_store_n(&item->meth, meth, __ATOMIC_RELEASE);
+	meth[item->meth_num] = a;
+	toret = item->meth_num;
+	__atomic_store_n(&item->meth_num, toret + 1, __ATOMIC_RELEASE);
+
+ err:
 	CRYPTO_w_unlock(CRYPTO_LOCK_EX_DATA);
+	if (toret == -1)
+		CRYPTOerror(ERR_R_MALLOC_FAILURE);
 	return toret;
 }
 
@@ -388,10 +379,26 @@ int_new_class(void)
 static void
 int_cleanup(void)
 {
-	EX_DATA_CHECK(return;)
-	lh_EX_CLASS_ITEM_doall(ex_data, def_cleanup_cb);
-	lh_EX_CLASS_ITEM_free(ex_data);
-	ex_data = NULL;
+	EX_CLASS_ITEM *item;
+	EX_RETIRED *r;
+	int i, j;
+
+	for (i = 0; i < ex_classes_num; i++) {
+		item = ex_classes[i];
+		for (j = 0; j < item->meth_num; j++)
+			free(item->meth[j]);
+		free(item->meth);
+		free(item);
+	}
+	free(ex_classes);
+	while ((r = ex_retired) != NULL) {
+		ex_retired = r->next;
+		free(r->array);
+		free(r);
+	}
+	ex_classes = NULL;
+	ex_classes_num = 0;
+	ex_classes_max = 0;
 	impl = NULL;
 }
 
@@ -400,53 +407,44 @@ int_get_new_index(int class_index, long argl, void *argp,
     CRYPTO_EX_new *new_func, CRYPTO_EX_dup *dup_func,
     CRYPTO_EX_free *free_func)
 {
-	EX_CLASS_ITEM *item = def_get_class(class_index);
+	CRYPTO_EX_DATA_FUNCS *a;
+	int toret;
 
-	if (!item)
+	if (!OPENSSL_init_crypto(0, NULL))
+		return -1;
+	if ((a = malloc(sizeof(CRYPTO_EX_DATA_FUNCS))) == NULL) {
+		CRYPTOerror(ERR_R_MALLOC_FAILURE);
 		return -1;
-	return def_add_index(item, argl, argp, new_func, dup_func, free_func);
+	}
+	a->argl = argl;
+	a->argp = argp;
+	a->new_func = new_func;
+	a->dup_func = dup_func;
+	a->free_func = free_func;
+	if ((toret = def_add_index(class_index, a)) == -1)
+		free(a);
+	return toret;
 }
 
-/* Thread-safe by copying a class's array of "CRYPTO_EX_DATA_FUNCS" entries in
- * the lock, then using them outside the lock. NB: Thread-safety only applies to
- * the global "ex_data" state (ie. class definitions), not thread-safe on 'ad'
- * itself. */
+/* The methods of a class are read without a lock, since published methods
+ * never change. NB: Thread-safety only applies to the global "ex_data" state
+ * (ie. class definitions), not thread-safe on 'ad' itself. */
 static int
 int_new_ex_data(int class_index, void *obj, CRYPTO_EX_DATA *ad)
 {
-	int mx, i;
+	CRYPTO_EX_DATA_FUNCS **meth, *f;
 	void *ptr;
-	CRYPTO_EX_DATA_FUNCS **storage = NULL;
-	EX_CLASS_ITEM *item = def_get_class(class_index);
+	int i, mx;
 
-	if (!item)
-		/* error is already set */
-		return 0;
 	ad->sk = NULL;
-	CRYPTO_r_lock(CRYPTO_LOCK_EX_DATA);
-	mx = sk_CRYPTO_EX_DATA_FUNCS_num(item->meth);
-	if (mx > 0) {
-		storage = reallocarray(NULL, mx, sizeof(CRYPTO_EX_DATA_FUNCS*));
-		if (!storage)
-			goto skip;
-		for (i = 0; i < mx; i++)
-			storage[i] = sk_CRYPTO_EX_DATA_FUNCS_value(
-			    item->meth, i);
-	}
-skip:
-	CRYPTO_r_unlock(CRYPTO_LOCK_EX_DATA);
-	if ((mx > 0) && !storage) {
-		CRYPTOerror(ERR_R_MALLOC_FAILURE);
-		return 0;
-	}
+	mx = def_get_meth(class_index, &meth);
 	for (i = 0; i < mx; i++) {
-		if (storage[i] && storage[i]->new_func) {
+		f = meth[i];
+		if (f->new_func) {
 			ptr = CRYPTO_get_ex_data(ad, i);
-			storage[i]->new_func(obj, ptr, ad, i,
-			    storage[i]->argl, storage[i]->argp);
+			f->new_func(obj, ptr, ad, i, f->argl, f->argp);
 		}
 	}
-	free(storage);
 	return 1;
 }
 
@@ -454,43 +452,23 @@ skip:
 static int
 int_dup_ex_data(int class_index, CRYPTO_EX_DATA *to, CRYPTO_EX_DATA *from)
 {
-	int mx, j, i;
-	char *ptr;
-	CRYPTO_EX_DATA_FUNCS **storage = NULL;
-	EX_CLASS_ITEM *item;
+	CRYPTO_EX_DATA_FUNCS **meth, *f;
+	void *ptr;
+	int mx, i;
 
 	if (!from->sk)
 		/* 'to' should be "blank" which *is* just like 'from' */
 		return 1;
-	if ((item = def_get_class(class_index)) == NULL)
-		return 0;
-	CRYPTO_r_lock(CRYPTO_LOCK_EX_DATA);
-	mx = sk_CRYPTO_EX_DATA_FUNCS_num(item->meth);
-	j = sk_void_num(from->sk);
-	if (j < mx)
-		mx = j;
-	if (mx > 0) {
-		storage = reallocarray(NULL, mx, sizeof(CRYPTO_EX_DATA_FUNCS*));
-		if (!storage)
-			goto skip;
-		for (i = 0; i < mx; i++)
-			storage[i] = sk_CRYPTO_EX_DATA_FUNCS_value(
-			    item->meth, i);
-	}
-skip:
-	CRYPTO_r_unlock(CRYPTO_LOCK_EX_DATA);
-	if ((mx > 0) && !storage) {
-		CRYPTOerror(ERR_R_MALLOC_FAILURE);
-		return 0;
-	}
+	mx = def_get_meth(class_index, &meth);
+	if (sk_void_num(from->sk) < mx)
+		mx = sk_void_num(from->sk);
 	for (i = 0; i < mx; i++) {
+		f = meth[i];
 		ptr = CRYPTO_get_ex_data(from, i);
-		if (storage[i] && storage[i]->dup_func)
-			storage[i]->dup_func(to, from, &ptr, i,
-			    storage[i]->argl, storage[i]->argp);
+		if (f->dup_func)
+			f->dup_func(to, from, &ptr, i, f->argl, f->argp);
 		CRYPTO_set_ex_data(to, i, ptr);
 	}
-	free(storage);
 	return 1;
 }
 
@@ -498,37 +476,18 @@ skip:
 static void
 int_free_ex_data(int class_index, void *obj, CRYPTO_EX_DATA *ad)
 {
-	int mx, i;
-	EX_CLASS_ITEM *item;
+	CRYPTO_EX_DATA_FUNCS **meth, *f;
 	void *ptr;
-	CRYPTO_EX_DATA_FUNCS **storage = NULL;
-
-	if ((item = def_get_class(class_index)) == NULL)
-		return;
-	CRYPTO_r_lock(CRYPTO_LOCK_EX_DATA);
-	mx = sk_CRYPTO_EX_DATA_FUNCS_num(item->meth);
-	if (mx > 0) {
-		storage = reallocarray(NULL, mx, sizeof(CRYPTO_EX_DATA_FUNCS*));
-		if (!storage)
-			goto skip;
-		for (i = 0; i < mx; i++)
-			storage[i] = sk_CRYPTO_EX_DATA_FUNCS_value(
-			    item->meth, i);
-	}
-skip:
-	CRYPTO_r_unlock(CRYPTO_LOCK_EX_DATA);
-	if ((mx > 0) && !storage) {
-		CRYPTOerror(ERR_R_MALLOC_FAILURE);
-		return;
-	}
+	int i, mx;
+
+	mx = def_get_meth(class_index, &meth);
 	for (i = 0; i < mx; i++) {
-		if (storage[i] && storage[i]->free_func) {
+		f = meth[i];
+		if (f->free_func) {
 			ptr = CRYPTO_get_ex_data(ad, i);
-			storage[i]->free_func(obj, ptr, ad, i,
-			    storage[i]->argl, storage[i]->argp);
+			f->free_func(obj, ptr, ad, i, f->argl, f->argp);
 		}
 	}
-	free(storage);
 	if (ad->sk) {
 		sk_void_free(ad->sk);
 		ad->sk = NULL;
@@ -108,6 +108,17 @@
 #define UP_LOAD		(2*LH_LOAD_MULT) /* load times 256  (default 2) */
 #define DOWN_LOAD	(LH_LOAD_MULT)   /* load times 256  (default 1) */
 
+/*
+ * lh_retrieve() is called concurrently under CRYPTO_r_lock(), so the
+ * statistics on the lookup path are counted atomically and lh->error is
+ * only written there if it has to be cleared.
+ */
+#ifdef __ATOMIC_RELAXED
+#define LH_COUNT(x)	((void)__atomic_add_fetch(&(x), 1, __ATOMIC_RELAXED))
+#else
+#define LH_COUNT(x)	((void)__sync_add_and_fetch(&(x), 1))
+#endif
+
 static void expand(_LHASH *lh);
 static void contract(_LHASH *lh);
 static LHASH_NODE **getrn(_LHASH *lh, const void *data, unsigned long *rhash);
@@ -228,15 +239,16 @@ lh_retrieve(_LHASH *lh, const void *data)
 	LHASH_NODE **rn;
 	void *ret;
 
-	lh->error = 0;
+	if (lh->error != 0)
+		lh->error = 0;
 	rn = getrn(lh, data, &hash);
 
 	if (*rn == NULL) {
-		lh->num_retrieve_miss++;
+		LH_COUNT(lh->num_retrieve_miss);
 		return (NULL);
 	} else {
 		ret = (*rn)->data;
-		lh->num_retrieve++;
+		LH_COUNT(lh->num_retrieve);
 	}
 	return (ret);
 }
@@ -375,7 +387,7 @@ static LHASH_NODE **getrn(_LHASH *lh, const void *data, unsigned long *rhash)
 	LHASH_COMP_FN_TYPE cf;
 
 	hash = (*(lh->hash))(data);
-	lh->num_hash_calls++;
+	LH_COUNT(lh->num_hash_calls);
 	*rhash = hash;
 
 	nn = hash % lh->pmax;
@@ -386,13 +398,13 @@ static LHASH_NODE **getrn(_LHASH *lh, const void *data, unsigned long *rhash)
 	ret = &(lh->b[(int)nn]);
 	for (n1 = *ret; n1 != NULL; n1 = n1->next) {
 #ifndef OPENSSL_NO_HASH_COMP
-		lh->num_hash_comps++;
+		LH_COUNT(lh->num_hash_comps);
 		if (n1->hash != hash) {
 			ret = &(n1->next);
 			continue;
 		}
 #endif
-		lh->num_comp_calls++;
+		LH_COUNT(lh->num_comp_calls);
 		if (cf(n1->data, data) == 0)
 			break;
 		ret = &(n1->next);
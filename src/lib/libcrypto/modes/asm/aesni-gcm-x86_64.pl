@@ -0,0 +1,329 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Stitched AES-NI CTR32 and PCLMULQDQ GHASH for GCM.
+#
+# CRYPTO_gcm128_[en|de]crypt_ctr32 with aesni_ctr32_encrypt_blocks and
+# gcm_ghash_clmul make two passes over the data: CTR over a chunk, then
+# GHASH over the same chunk. Here both run in one pass, six blocks at a
+# time. The 18 carry-less multiplications and the single aggregated
+# reduction for six blocks are scheduled between the aesenc rounds for
+# the next six counter blocks, so that the AES and the PCLMULQDQ units
+# are busy at the same time.
+#
+# The six-block aggregated reduction uses H^1..H^6, which gcm_init_clmul
+# stores in Htable as follows:
+#
+#	0x00	H	(also used by gcm_[gmult|ghash]_clmul)
+#	0x10	H^2	(also used by gcm_ghash_clmul)
+#	0x20	H^3
+#	0x30	H^4
+#	0x40	H^5
+#	0x50	H^6
+#	0x60	lo^hi of H	| lo^hi of H^2
+#	0x70	lo^hi of H^3	| lo^hi of H^4
+#	0x80	lo^hi of H^5	| lo^hi of H^6
+#
+# Htable is located 32 bytes after Xi in struct gcm128_context, see
+# modes_lcl.h.
+#
+# size_t aesni_gcm_encrypt(const void *in, void *out, size_t len,
+#     const AES_KEY *key, unsigned char ivec[16], u64 Xi[2]);
+# size_t aesni_gcm_decrypt(const void *in, void *out, size_t len,
+#     const AES_KEY *key, unsigned char ivec[16], u64 Xi[2]);
+#
+# Both process the largest multiple of 96 bytes not exceeding len and
+# return the number of bytes processed. The 32-bit big-endian counter
+# in ivec and the hash value in Xi are updated in place. The caller is
+# responsible for the remaining tail.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($inp,$out,$len,$key,$ivp,$Xip)=("%rdi","%rsi","%rdx","%rcx","%r8","%r9");
+$ctr="%r10d";		# host order 32-bit counter
+$ctrq="%r10";
+$rounds="%r11d";	# key->rounds
+$start="%rbx";		# backup of $out, for return value
+
+$rndkey="%xmm0";
+@inout=map("%xmm$_",(1..6));
+($Z0,$Z1,$Z2)=("%xmm7","%xmm8","%xmm9");	# lo, mid, hi; Xi in $Z0
+($T1,$T2,$T3)=("%xmm10","%xmm11","%xmm12");
+$Hkey="%xmm13";
+$bswap="%xmm14";
+$ivec="%xmm15";
+
+# GHASH six blocks at $off($ptr) into Xi (held in $Z0), returned as a list of
+# instructions so that they can be spread over the AES rounds.
+sub ghash6 {
+my ($off,$ptr)=@_;
+my @insns;
+
+    for (my $j=0; $j<6; $j++) {
+	my $k=6-$j;				# power of H
+	my $hoff=16*($k-1);
+	my $foff=0x60+16*int(($k-1)/2);
+	my $sel=(($k-1)%2)?"0x10":"0x00";
+
+	if ($j==0) {
+	    push @insns,
+		"movdqu	$off+16*$j($ptr),$T1",
+		"movdqu	32+$hoff($Xip),$Hkey",
+		"pshufb	$bswap,$T1",
+		"pxor	$T1,$Z0",		# Xi^I0
+		"pshufd	\$0b01001110,$Z0,$Z1",
+		"movdqa	$Z0,$Z2",
+		"pxor	$Z0,$Z1",
+		"pclmulqdq	\$0x00,$Hkey,$Z0",
+		"pclmulqdq	\$0x11,$Hkey,$Z2",
+		"movdqu	32+$foff($Xip),$Hkey",
+		"pclmulqdq	\$$sel,$Hkey,$Z1";
+	} else {
+	    push @insns,
+		"movdqu	$off+16*$j($ptr),$T1",
+		"movdqu	32+$hoff($Xip),$Hkey",
+		"pshufb	$bswap,$T1",
+		"pshufd	\$0b01001110,$T1,$T2",
+		"movdqa	$T1,$T3",
+		"pxor	$T1,$T2",
+		"pclmulqdq	\$0x00,$Hkey,$T1",
+		"pclmulqdq	\$0x11,$Hkey,$T3",
+		"movdqu	32+$foff($Xip),$Hkey",
+		"pclmulqdq	\$$sel,$Hkey,$T2",
+		"pxor	$T1,$Z0",
+		"pxor	$T3,$Z2",
+		"pxor	$T2,$Z1";
+	}
+    }
+
+    # Karatsuba post-processing
+    push @insns,
+	"pxor	$Z0,$Z1",
+	"pxor	$Z2,$Z1",
+	"movdqa	$Z1,$T1",
+	"psrldq	\$8,$Z1",
+	"pslldq	\$8,$T1",
+	"pxor	$Z1,$Z2",
+	"pxor	$T1,$Z0";
+
+    # reduction, same as reduction_alg9 in ghash-x86_64.pl
+    push @insns,
+	"movdqa	$Z0,$T1",
+	"psllq	\$1,$Z0",
+	"pxor	$T1,$Z0",
+	"psllq	\$5,$Z0",
+	"pxor	$T1,$Z0",
+	"psllq	\$57,$Z0",
+	"movdqa	$Z0,$T2",
+	"pslldq	\$8,$Z0",
+	"psrldq	\$8,$T2",
+	"pxor	$T1,$Z0",
+	"pxor	$T2,$Z2",
+
+	"movdqa	$Z0,$T2",
+	"psrlq	\$5,$Z0",
+	"pxor	$T2,$Z0",
+	"psrlq	\$1,$Z0",
+	"pxor	$T2,$Z0",
+	"pxor	$Z2,$T2",
+	"psrlq	\$1,$Z0",
+	"pxor	$T2,$Z0";
+
+    return @insns;
+}
+
+# Encrypt six counter blocks and xor them into the input at $inp,
+# storing the result at $out. If @ghash is not empty, its instructions
+# are interleaved with rounds 1 to 9.
+sub aes6 {
+my ($sn,@ghash)=@_;
+my $per=int((scalar(@ghash)+8)/9);
+
+    for (my $i=0; $i<6; $i++) {
+	$code.=<<___;
+	lea	$i($ctrq),%eax
+	movdqa	$ivec,$inout[$i]
+	bswap	%eax
+	pinsrd	\$3,%eax,$inout[$i]
+___
+    }
+    $code.=<<___;
+	movups	($key),$rndkey
+	add	\$6,$ctr
+___
+    $code.="\tpxor	$rndkey,$_\n" for (@inout);
+
+    for (my $r=1; $r<=9; $r++) {
+	$code.="\tmovups	".(16*$r)."($key),$rndkey\n";
+	for (my $i=0; $i<6; $i++) {
+	    $code.="\taesenc	$rndkey,$inout[$i]\n";
+	    $code.="\t".shift(@ghash)."\n" if (@ghash && $i%2==1);
+	}
+	for (my $i=0; $i<$per-3 && @ghash; $i++) {
+	    $code.="\t".shift(@ghash)."\n";
+	}
+    }
+    $code.="\t$_\n" for (@ghash);
+
+    $code.=<<___;
+	movups	160($key),$rndkey
+	cmp	\$11,$rounds
+	jb	.Lenc_last_$sn
+___
+    $code.="\taesenc	$rndkey,$_\n" for (@inout);
+    $code.="\tmovups	176($key),$rndkey\n";
+    $code.="\taesenc	$rndkey,$_\n" for (@inout);
+    $code.=<<___;
+	movups	192($key),$rndkey
+	je	.Lenc_last_$sn
+___
+    $code.="\taesenc	$rndkey,$_\n" for (@inout);
+    $code.="\tmovups	208($key),$rndkey\n";
+    $code.="\taesenc	$rndkey,$_\n" for (@inout);
+    $code.=<<___;
+	movups	224($key),$rndkey
+.Lenc_last_$sn:
+___
+    for (my $i=0; $i<6; $i++) {
+	my $t=($i%2)?$T2:$T1;
+	$code.=<<___;
+	movdqu	16*$i($inp),$t
+	pxor	$rndkey,$t
+	aesenclast	$t,$inout[$i]
+	movdqu	$inout[$i],16*$i($out)
+___
+    }
+    $code.=<<___;
+	lea	96($inp),$inp
+	lea	96($out),$out
+___
+}
+
+sub prologue {
+$code.=<<___;
+	xor	%eax,%eax
+	cmp	\$96,$len
+	jb	.L$_[0]_abort
+
+	push	%rbx
+	mov	$out,$start
+
+	movdqa	.Lbswap_mask(%rip),$bswap
+	movdqu	($Xip),$Z0
+	movdqu	($ivp),$ivec
+	mov	240($key),$rounds
+	pshufb	$bswap,$Z0
+	pextrd	\$3,$ivec,$ctr
+	bswap	$ctr
+___
+}
+
+sub epilogue {
+$code.=<<___;
+	bswap	$ctr
+	pshufb	$bswap,$Z0
+	mov	$ctr,12($ivp)
+	movdqu	$Z0,($Xip)
+
+	mov	$out,%rax
+	sub	$start,%rax
+	pop	%rbx
+.L$_[0]_abort:
+	ret
+___
+}
+
+$code=".text\n";
+
+{
+$code.=<<___;
+.globl	aesni_gcm_encrypt
+.type	aesni_gcm_encrypt,\@function,6
+.align	32
+aesni_gcm_encrypt:
+___
+	&prologue("enc");
+	&aes6("enc_first");
+$code.=<<___;
+	sub	\$96,$len
+	cmp	\$96,$len
+	jb	.Lenc_tail
+.align	32
+.Lenc_loop:
+___
+	&aes6("enc_loop",ghash6(-96,$out));
+$code.=<<___;
+	sub	\$96,$len
+	cmp	\$96,$len
+	jae	.Lenc_loop
+.Lenc_tail:
+___
+	$code.="\t$_\n" for (ghash6(-96,$out));
+	&epilogue("enc");
+$code.=<<___;
+.size	aesni_gcm_encrypt,.-aesni_gcm_encrypt
+___
+}
+
+{
+$code.=<<___;
+.globl	aesni_gcm_decrypt
+.type	aesni_gcm_decrypt,\@function,6
+.align	32
+aesni_gcm_decrypt:
+___
+	&prologue("dec");
+$code.=<<___;
+.align	32
+.Ldec_loop:
+___
+	&aes6("dec_loop",ghash6(0,$inp));
+$code.=<<___;
+	sub	\$96,$len
+	cmp	\$96,$len
+	jae	.Ldec_loop
+___
+	&epilogue("dec");
+$code.=<<___;
+.size	aesni_gcm_decrypt,.-aesni_gcm_decrypt
+___
+}
+
+$code.=<<___;
+.align	64
+.Lbswap_mask:
+	.byte	15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0
+.align	64
+___
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
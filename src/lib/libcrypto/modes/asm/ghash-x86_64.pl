@@ -437,6 +437,34 @@ ___
 $code.=<<___;
 	movdqu		$Hkey,($Htbl)		# save H
 	movdqu		$Xi,16($Htbl)		# save H^2
+
+	# H^3..H^6 and Karatsuba pre-computations for aesni-gcm-x86_64
+	pshufd		\$0b01001110,$Hkey,$T1
+	pshufd		\$0b01001110,$Xi,$T2
+	pxor		$Hkey,$T1
+	pxor		$Xi,$T2
+	punpcklqdq	$T2,$T1
+	movdqu		$T1,0x60($Htbl)		# save lo^hi of H and H^2
+___
+for (my $i=3; $i<=6; $i++) {
+	&clmul64x64_T2	($Xhi,$Xi,$Hkey);
+	&reduction_alg9	($Xhi,$Xi);
+$code.=<<___;
+	movdqu		$Xi,`16*($i-1)`($Htbl)	# save H^$i
+___
+$code.=<<___ if ($i%2);
+	movdqa		$Xi,$T3
+___
+$code.=<<___ if (!($i%2));
+	pshufd		\$0b01001110,$T3,$T1
+	pshufd		\$0b01001110,$Xi,$T2
+	pxor		$T3,$T1
+	pxor		$Xi,$T2
+	punpcklqdq	$T2,$T1
+	movdqu		$T1,`0x60+8*($i-2)`($Htbl)	# save lo^hi of H^`$i-1` and H^$i
+___
+}
+$code.=<<___;
 	ret
 .size	gcm_init_clmul,.-gcm_init_clmul
 ___
@@ -679,6 +679,27 @@ void gcm_ghash_neon(u64 Xi[2],const u128 Htable[16],const u8 *inp,size_t len);
 # endif
 #endif
 
+#if	defined(AESNI_GCM_ASM) && defined(GHASH_ASM_X86_OR_64) && \
+	!defined(GHASH_ASM_X86) && !defined(OPENSSL_SMALL_FOOTPRINT)
+void aesni_ctr32_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const void *key, const unsigned char ivec[16]);
+
+size_t aesni_gcm_encrypt(const u8 *in, u8 *out, size_t len, const void *key,
+	u8 ivec[16], u64 *Xi);
+size_t aesni_gcm_decrypt(const u8 *in, u8 *out, size_t len, const void *key,
+	u8 ivec[16], u64 *Xi);
+
+/*
+ * The stitched AES-NI/PCLMULQDQ kernels can be used if CTR is done by
+ * aesni_ctr32_encrypt_blocks and GHASH by gcm_ghash_clmul, in which case
+ * gcm_init_clmul has stored H^1..H^6 in Htable. Both process 96-byte
+ * chunks, update Yi and Xi in place and return the number of bytes done.
+ */
+# define AESNI_GCM_CAPABLE(ctx,stream) \
+	((stream) == (ctr128_f)aesni_ctr32_encrypt_blocks && \
+	 (ctx)->ghash == gcm_ghash_clmul)
+#endif
+
 void CRYPTO_gcm128_init(GCM128_CONTEXT *ctx,void *key,block128_f block)
 {
 	memset(ctx,0,sizeof(*ctx));
@@ -1305,6 +1326,15 @@ int CRYPTO_gcm128_encrypt_ctr32(GCM128_CONTEXT *ctx,
 			return 0;
 		}
 	}
+#ifdef AESNI_GCM_CAPABLE
+	if (len>=6*16 && AESNI_GCM_CAPABLE(ctx,stream)) {
+		i = aesni_gcm_encrypt(in,out,len,key,ctx->Yi.c,ctx->Xi.u);
+		ctr = GETU32(ctx->Yi.c+12);
+		out += i;
+		in  += i;
+		len -= i;
+	}
+#endif
 #if defined(GHASH) && !defined(OPENSSL_SMALL_FOOTPRINT)
 	while (len>=GHASH_CHUNK) {
 		(*stream)(in,out,GHASH_CHUNK/16,key,ctx->Yi.c);
@@ -1425,6 +1455,15 @@ int CRYPTO_gcm128_decrypt_ctr32(GCM128_CONTEXT *ctx,
 			return 0;
 		}
 	}
+#ifdef AESNI_GCM_CAPABLE
+	if (len>=6*16 && AESNI_GCM_CAPABLE(ctx,stream)) {
+		i = aesni_gcm_decrypt(in,out,len,key,ctx->Yi.c,ctx->Xi.u);
+		ctr = GETU32(ctx->Yi.c+12);
+		out += i;
+		in  += i;
+		len -= i;
+	}
+#endif
 #if defined(GHASH) && !defined(OPENSSL_SMALL_FOOTPRINT)
 	while (len>=GHASH_CHUNK) {
 		GHASH(ctx,in,GHASH_CHUNK);
@@ -0,0 +1,268 @@
+#!/usr/bin/env perl
+# $OpenBSD$
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# AVX2 Poly1305 block function.
+#
+# Four blocks are processed in parallel, with the same radix 2^26
+# representation as poly1305-donna.c and one block per 64-bit lane.
+# Lane j accumulates blocks j, j+4, j+8, ... with Horner's rule in r^4:
+#
+#	H_j = (...((h*[j==0] + m_j)*r^4 + m_{j+4})*r^4 + ...) + m_{n-4+j}
+#
+# and the last step multiplies lane j by r^(4-j) instead of r^4, so
+# that the sum of the four lanes is the new value of h.
+#
+# void poly1305_blocks_avx2(unsigned long h[5],
+#     const unsigned long rp[5][4], const unsigned char *m, size_t blocks);
+#
+# h is the donna accumulator. rp[i] holds limb i of r^4, r^3, r^2 and r,
+# in this order. blocks must be a non-zero multiple of 4; all blocks are
+# full blocks, with the 2^128 bit set.
+
+$flavour = shift;
+$output  = shift;
+if ($flavour =~ /\./) { $output = $flavour; undef $flavour; }
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+die "Win64 is not supported" if ($win64);
+
+open OUT,"| \"$^X\" $xlate $flavour $output";
+*STDOUT=*OUT;
+
+($hp,$rp,$inp,$blocks)=("%rdi","%rsi","%rdx","%rcx");
+
+@H=map("%ymm$_",(0..4));	# accumulator
+@D=map("%ymm$_",(5..9));	# products
+@M=map("%ymm$_",(10..14));	# message, temporaries
+$mask="%ymm15";			# 2^26-1 in each lane
+
+# Stack frame, 32 bytes per entry: limbs of r^4 and 5*r^4 in each lane,
+# then limbs of [r^4,r^3,r^2,r] and five times those.
+$R4=0;
+$S4=5*32;
+$RF=10*32;
+$SF=15*32;
+$frame=20*32;
+
+sub xmm { my $r=shift; $r=~s/ymm/xmm/; $r; }
+
+# D = H * (R, S), with R the limbs of the multiplier and S five times
+# those, at offsets $r and $s from %rsp.
+sub mul {
+my ($r,$s)=@_;
+my @c=(
+	[ "$r+0", "$s+128", "$s+96", "$s+64", "$s+32" ],
+	[ "$r+32", "$r+0", "$s+128", "$s+96", "$s+64" ],
+	[ "$r+64", "$r+32", "$r+0", "$s+128", "$s+96" ],
+	[ "$r+96", "$r+64", "$r+32", "$r+0", "$s+128" ],
+	[ "$r+128", "$r+96", "$r+64", "$r+32", "$r+0" ]);
+my $code="";
+
+    for (my $k=0; $k<5; $k++) {
+	$code.="\tvpmuludq	".eval($c[$k][0])."(%rsp),$H[0],$D[$k]\n";
+    }
+    for (my $i=1; $i<5; $i++) {
+	for (my $k=0; $k<5; $k++) {
+	    my $t=$M[$k];
+	    $code.="\tvpmuludq	".eval($c[$k][$i])."(%rsp),$H[$i],$t\n";
+	    $code.="\tvpaddq	$t,$D[$k],$D[$k]\n";
+	}
+    }
+    return $code;
+}
+
+# Load four blocks into @M, one block per lane, in radix 2^26.
+sub load {
+my ($t0,$t1)=@M[0,1];
+    return <<___;
+	vmovdqu	($inp),$t0
+	vmovdqu	32($inp),$t1
+	lea	64($inp),$inp
+	vpunpckhqdq	$t1,$t0,$M[4]
+	vpunpcklqdq	$t1,$t0,$M[0]
+	vpermq	\$0xd8,$M[4],$M[4]		# high halves of blocks 0-3
+	vpermq	\$0xd8,$M[0],$M[0]		# low halves of blocks 0-3
+	vpsrlq	\$26,$M[0],$M[1]
+	vpsrlq	\$52,$M[0],$M[2]
+	vpsllq	\$12,$M[4],$M[3]
+	vpor	$M[3],$M[2],$M[2]
+	vpsrlq	\$14,$M[4],$M[3]
+	vpsrlq	\$40,$M[4],$M[4]
+	vpand	$mask,$M[0],$M[0]
+	vpand	$mask,$M[1],$M[1]
+	vpand	$mask,$M[2],$M[2]
+	vpand	$mask,$M[3],$M[3]
+	vpor	.Lhibit(%rip),$M[4],$M[4]
+___
+}
+
+# Partial reduction of @D, with the carries of the five limbs
+# interleaved in two chains.
+sub carry {
+my ($t0,$t1)=@M[3,4];
+    return <<___;
+	vpsrlq	\$26,$D[3],$t0
+	vpand	$mask,$D[3],$D[3]
+	vpaddq	$t0,$D[4],$D[4]
+	vpsrlq	\$26,$D[0],$t1
+	vpand	$mask,$D[0],$D[0]
+	vpaddq	$t1,$D[1],$D[1]
+	vpsrlq	\$26,$D[4],$t0
+	vpand	$mask,$D[4],$D[4]
+	vpsrlq	\$26,$D[1],$t1
+	vpand	$mask,$D[1],$D[1]
+	vpaddq	$t1,$D[2],$D[2]
+	vpaddq	$t0,$D[0],$D[0]
+	vpsllq	\$2,$t0,$t0
+	vpaddq	$t0,$D[0],$D[0]
+	vpsrlq	\$26,$D[2],$t1
+	vpand	$mask,$D[2],$D[2]
+	vpaddq	$t1,$D[3],$D[3]
+	vpsrlq	\$26,$D[0],$t0
+	vpand	$mask,$D[0],$D[0]
+	vpaddq	$t0,$D[1],$D[1]
+	vpsrlq	\$26,$D[3],$t1
+	vpand	$mask,$D[3],$D[3]
+	vpaddq	$t1,$D[4],$D[4]
+___
+}
+
+$code=<<___;
+.text
+
+.globl	poly1305_blocks_avx2
+.type	poly1305_blocks_avx2,\@function,4
+.align	32
+poly1305_blocks_avx2:
+	push	%rbp
+	mov	%rsp,%rbp
+	sub	\$$frame,%rsp
+	and	\$-32,%rsp
+
+	vmovdqa	.Lmask26(%rip),$mask
+___
+for (my $i=0; $i<5; $i++) {
+    $code.=<<___;
+	vpbroadcastq	32*$i($rp),$M[0]
+	vmovdqu	32*$i($rp),$M[1]
+	vpsllq	\$2,$M[0],$M[2]
+	vpsllq	\$2,$M[1],$M[3]
+	vpaddq	$M[0],$M[2],$M[2]
+	vpaddq	$M[1],$M[3],$M[3]
+	vmovdqa	$M[0],$R4+32*$i(%rsp)
+	vmovdqa	$M[2],$S4+32*$i(%rsp)
+	vmovdqa	$M[1],$RF+32*$i(%rsp)
+	vmovdqa	$M[3],$SF+32*$i(%rsp)
+___
+}
+for (my $i=0; $i<5; $i++) {
+    $code.="\tvmovq	8*$i($hp),".xmm($H[$i])."\n";
+}
+$code.=&load();
+for (my $i=0; $i<5; $i++) {
+    $code.="\tvpaddq	$M[$i],$H[$i],$H[$i]\n";
+}
+$code.=<<___;
+	sub	\$4,$blocks
+	jz	.Lfinal
+	jmp	.Loop
+
+.align	32
+.Loop:
+___
+$code.=&mul($R4,$S4);
+$code.=&carry();
+$code.=&load();
+for (my $i=0; $i<5; $i++) {
+    $code.="\tvpaddq	$M[$i],$D[$i],$H[$i]\n";
+}
+$code.=<<___;
+	sub	\$4,$blocks
+	jnz	.Loop
+
+.Lfinal:
+___
+$code.=&mul($RF,$SF);
+
+# Sum the four lanes.
+for (my $i=0; $i<5; $i++) {
+    my ($d,$t)=(xmm($D[$i]),xmm($M[$i]));
+    $code.=<<___;
+	vextracti128	\$1,$D[$i],$t
+	vpaddq	$t,$d,$d
+	vpsrldq	\$8,$d,$t
+	vpaddq	$t,$d,$d
+___
+}
+
+# Carry as poly1305_blocks() does and store h.
+{
+my @d=map(xmm($_),@D);
+my $t=xmm($M[0]);
+my $m=xmm($mask);
+    for (my $i=0; $i<4; $i++) {
+	$code.=<<___;
+	vpsrlq	\$26,$d[$i],$t
+	vpand	$m,$d[$i],$d[$i]
+	vpaddq	$t,$d[$i+1],$d[$i+1]
+___
+    }
+    $code.=<<___;
+	vpsrlq	\$26,$d[4],$t
+	vpand	$m,$d[4],$d[4]
+	vpaddq	$t,$d[0],$d[0]
+	vpsllq	\$2,$t,$t
+	vpaddq	$t,$d[0],$d[0]
+	vpsrlq	\$26,$d[0],$t
+	vpand	$m,$d[0],$d[0]
+	vpaddq	$t,$d[1],$d[1]
+___
+    for (my $i=0; $i<5; $i++) {
+	$code.="\tvmovq	$d[$i],8*$i($hp)\n";
+    }
+}
+
+# Do not leave powers of r on the stack.
+$code.="\tvpxor	$M[0],$M[0],$M[0]\n";
+for (my $i=0; $i<20; $i++) {
+    $code.="\tvmovdqa	$M[0],32*$i(%rsp)\n";
+}
+$code.=<<___;
+
+	vzeroupper
+	mov	%rbp,%rsp
+	pop	%rbp
+	ret
+.size	poly1305_blocks_avx2,.-poly1305_blocks_avx2
+
+.align	32
+.Lmask26:
+	.quad	0x3ffffff,0x3ffffff,0x3ffffff,0x3ffffff
+.Lhibit:
+	.quad	0x1000000,0x1000000,0x1000000,0x1000000
+.align	64
+___
+
+$code =~ s/\`([^\`]*)\`/eval($1)/gem;
+
+print $code;
+
+close STDOUT;
@@ -15,9 +15,112 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <string.h>
+
 #include <openssl/poly1305.h>
 #include "poly1305-donna.c"
 
+#ifdef POLY1305_ASM
+#include <openssl/crypto.h>
+
+#include "cryptlib.h"
+#include "x86_arch.h"
+
+void poly1305_blocks_avx2(unsigned long h[5], const unsigned long rp[5][4],
+    const unsigned char *m, size_t blocks);
+
+/*
+ * Shorter inputs are left to poly1305-donna, as computing the powers of
+ * r costs about as much as hashing a few blocks.
+ */
+#define POLY1305_AVX2_MIN	256
+
+/* h = a * b, partially reduced as in poly1305_blocks(). */
+static void
+poly1305_mul(unsigned long h[5], const unsigned long a[5],
+    const unsigned long b[5])
+{
+	unsigned long s1, s2, s3, s4, c;
+	unsigned long long d0, d1, d2, d3, d4;
+
+	s1 = b[1] * 5;
+	s2 = b[2] * 5;
+	s3 = b[3] * 5;
+	s4 = b[4] * 5;
+
+	d0 = ((unsigned long long)a[0] * b[0]) +
+	    ((unsigned long long)a[1] * s4) +
+	    ((unsigned long long)a[2] * s3) +
+	    ((unsigned long long)a[3] * s2) +
+	    ((unsigned long long)a[4] * s1);
+	d1 = ((unsigned long long)a[0] * b[1]) +
+	    ((unsigned long long)a[1] * b[0]) +
+	    ((unsigned long long)a[2] * s4) +
+	    ((unsigned long long)a[3] * s3) +
+	    ((unsigned long long)a[4] * s2);
+	d2 = ((unsigned long long)a[0] * b[2]) +
+	    ((unsigned long long)a[1] * b[1]) +
+	    ((unsigned long long)a[2] * b[0]) +
+	    ((unsigned long long)a[3] * s4) +
+	    ((unsigned long long)a[4] * s3);
+	d3 = ((unsigned long long)a[0] * b[3]) +
+	    ((unsigned long long)a[1] * b[2]) +
+	    ((unsigned long long)a[2] * b[1]) +
+	    ((unsigned long long)a[3] * b[0]) +
+	    ((unsigned long long)a[4] * s4);
+	d4 = ((unsigned long long)a[0] * b[4]) +
+	    ((unsigned long long)a[1] * b[3]) +
+	    ((unsigned long long)a[2] * b[2]) +
+	    ((unsigned long long)a[3] * b[1]) +
+	    ((unsigned long long)a[4] * b[0]);
+
+	c = (unsigned long)(d0 >> 26);
+	h[0] = (unsigned long)d0 & 0x3ffffff;
+	d1 += c;
+	c = (unsigned long)(d1 >> 26);
+	h[1] = (unsigned long)d1 & 0x3ffffff;
+	d2 += c;
+	c = (unsigned long)(d2 >> 26);
+	h[2] = (unsigned long)d2 & 0x3ffffff;
+	d3 += c;
+	c = (unsigned long)(d3 >> 26);
+	h[3] = (unsigned long)d3 & 0x3ffffff;
+	d4 += c;
+	c = (unsigned long)(d4 >> 26);
+	h[4] = (unsigned long)d4 & 0x3ffffff;
+	h[0] += c * 5;
+	c = h[0] >> 26;
+	h[0] &= 0x3ffffff;
+	h[1] += c;
+}
+
+static void
+poly1305_blocks_simd(poly1305_state_internal_t *st, const unsigned char *m,
+    size_t bytes)
+{
+	unsigned long r2[5], r3[5], r4[5];
+	unsigned long rp[5][4];
+	int i;
+
+	poly1305_mul(r2, st->r, st->r);
+	poly1305_mul(r3, r2, st->r);
+	poly1305_mul(r4, r2, r2);
+	for (i = 0; i < 5; i++) {
+		rp[i][0] = r4[i];
+		rp[i][1] = r3[i];
+		rp[i][2] = r2[i];
+		rp[i][3] = st->r[i];
+	}
+
+	poly1305_blocks_avx2(st->h, rp, m, bytes / poly1305_block_size);
+
+	explicit_bzero(r2, sizeof(r2));
+	explicit_bzero(r3, sizeof(r3));
+	explicit_bzero(r4, sizeof(r4));
+	explicit_bzero(rp, sizeof(rp));
+}
+#endif
+
 void
 CRYPTO_poly1305_init(poly1305_context *ctx, const unsigned char key[32])
 {
@@ -28,6 +131,25 @@ void
 CRYPTO_poly1305_update(poly1305_context *ctx, const unsigned char *in,
     size_t len)
 {
+#ifdef POLY1305_ASM
+	poly1305_state_internal_t *st = (poly1305_state_internal_t *)ctx;
+	size_t n;
+
+	if (len >= POLY1305_AVX2_MIN &&
+	    (OPENSSL_cpu_caps_ext() & IA32CAP_MASK2_AVX2) != 0) {
+		/* Complete any buffered block first. */
+		if (st->leftover != 0) {
+			n = poly1305_block_size - st->leftover;
+			poly1305_update(ctx, in, n);
+			in += n;
+			len -= n;
+		}
+		n = len & ~(4 * poly1305_block_size - 1);
+		poly1305_blocks_simd(st, in, n);
+		in += n;
+		len -= n;
+	}
+#endif
 	poly1305_update(ctx, in, len);
 }
 
@@ -248,6 +248,9 @@ RSA *RSA_generate_key(int bits, unsigned long e,
 
 /* New version */
 int RSA_generate_key_ex(RSA *rsa, int bits, BIGNUM *e, BN_GENCB *cb);
+int RSA_generate_key_mt(RSA *rsa, int bits, BIGNUM *e, int nthreads,
+    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+    void *arg, BN_GENCB *cb);
 
 int RSA_check_key(const RSA *);
 /* next 4 return -1 on error */
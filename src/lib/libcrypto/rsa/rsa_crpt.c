@@ -220,3 +220,16 @@ err:
 
 	return ret;
 }
+
+void
+rsa_blinding_pool_free(RSA_BLINDING_POOL *pool)
+{
+	int i;
+
+	if (pool == NULL)
+		return;
+
+	for (i = 0; i < RSA_BLINDING_POOL_SIZE; i++)
+		BN_BLINDING_free(pool->slot[i].blinding);
+	free(pool);
+}
@@ -110,6 +110,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <openssl/opensslconf.h>
@@ -252,97 +253,84 @@ err:
 	return r;
 }
 
+/*
+ * Private key operations take their BN_BLINDING from a pool that hangs off
+ * the RSA key.  A slot belongs to the thread that managed to set its busy
+ * flag, so the blinding in it can be used and updated without a lock, and
+ * every slot has its own blinding factors.  A thread starts looking at the
+ * slot selected by its thread ID, so with fewer threads than slots each
+ * thread usually finds the same free slot every time.
+ *
+ * As before the pool existed, the blinding set up by RSA_blinding_on() is
+ * used by the thread that called it, and only by that thread.
+ */
+#define RSA_BLINDING_ONCE	-1	/* made for one operation */
+#define RSA_BLINDING_KEY	-2	/* rsa->blinding */
+
 static BN_BLINDING *
-rsa_get_blinding(RSA *rsa, int *local, BN_CTX *ctx)
+rsa_get_blinding(RSA *rsa, int *slot, BN_CTX *ctx)
 {
-	BN_BLINDING *ret;
-	int got_write_lock = 0;
+	RSA_BLINDING_POOL *pool;
 	CRYPTO_THREADID cur;
+	BN_BLINDING *b;
+	unsigned long h;
+	int i, n;
 
-	CRYPTO_r_lock(CRYPTO_LOCK_RSA);
-
-	if (rsa->blinding == NULL) {
-		CRYPTO_r_unlock(CRYPTO_LOCK_RSA);
-		CRYPTO_w_lock(CRYPTO_LOCK_RSA);
-		got_write_lock = 1;
-
-		if (rsa->blinding == NULL)
-			rsa->blinding = RSA_setup_blinding(rsa, ctx);
+	CRYPTO_THREADID_current(&cur);
+	if ((b = rsa->blinding) != NULL &&
+	    !CRYPTO_THREADID_cmp(&cur, BN_BLINDING_thread_id(b))) {
+		*slot = RSA_BLINDING_KEY;
+		return b;
 	}
 
-	ret = rsa->blinding;
-	if (ret == NULL)
-		goto err;
+	if ((pool = __atomic_load_n(&rsa->blinding_pool,
+	    __ATOMIC_ACQUIRE)) == NULL) {
+		if (posix_memalign((void **)&pool, 64, sizeof(*pool)) != 0) {
+			RSAerror(ERR_R_MALLOC_FAILURE);
+			return NULL;
+		}
+		memset(pool, 0, sizeof(*pool));
+		if (!__sync_bool_compare_and_swap(&rsa->blinding_pool, NULL,
+		    pool)) {
+			free(pool);
+			pool = rsa->blinding_pool;
+		}
+	}
 
-	CRYPTO_THREADID_current(&cur);
-	if (!CRYPTO_THREADID_cmp(&cur, BN_BLINDING_thread_id(ret))) {
-		/* rsa->blinding is ours! */
-		*local = 1;
-	} else {
-		/* resort to rsa->mt_blinding instead */
-		/*
-		 * Instruct rsa_blinding_convert(), rsa_blinding_invert()
-		 * that the BN_BLINDING is shared, meaning that accesses
-		 * require locks, and that the blinding factor must be
-		 * stored outside the BN_BLINDING
-		 */
-		*local = 0;
+	h = CRYPTO_THREADID_hash(&cur);
+	h ^= h >> 16;
+	h ^= h >> 8;
 
-		if (rsa->mt_blinding == NULL) {
-			if (!got_write_lock) {
-				CRYPTO_r_unlock(CRYPTO_LOCK_RSA);
-				CRYPTO_w_lock(CRYPTO_LOCK_RSA);
-				got_write_lock = 1;
+	for (i = 0; i < RSA_BLINDING_POOL_SIZE; i++) {
+		n = (h + i) % RSA_BLINDING_POOL_SIZE;
+		if (!__sync_bool_compare_and_swap(&pool->slot[n].busy, 0, 1))
+			continue;
+		if (pool->slot[n].blinding == NULL) {
+			pool->slot[n].blinding = RSA_setup_blinding(rsa, ctx);
+			if (pool->slot[n].blinding == NULL) {
+				__sync_lock_release(&pool->slot[n].busy);
+				return NULL;
 			}
-
-			if (rsa->mt_blinding == NULL)
-				rsa->mt_blinding = RSA_setup_blinding(rsa, ctx);
 		}
-		ret = rsa->mt_blinding;
+		*slot = n;
+		return pool->slot[n].blinding;
 	}
 
-err:
-	if (got_write_lock)
-		CRYPTO_w_unlock(CRYPTO_LOCK_RSA);
-	else
-		CRYPTO_r_unlock(CRYPTO_LOCK_RSA);
-	return ret;
+	/* All slots are in use, so make a blinding for this operation only. */
+	*slot = RSA_BLINDING_ONCE;
+	return RSA_setup_blinding(rsa, ctx);
 }
 
-static int
-rsa_blinding_convert(BN_BLINDING *b, BIGNUM *f, BIGNUM *unblind, BN_CTX *ctx)
+static void
+rsa_put_blinding(RSA *rsa, BN_BLINDING *b, int slot)
 {
-	if (unblind == NULL)
-		/*
-		 * Local blinding: store the unblinding factor
-		 * in BN_BLINDING.
-		 */
-		return BN_BLINDING_convert_ex(f, NULL, b, ctx);
-	else {
-		/*
-		 * Shared blinding: store the unblinding factor
-		 * outside BN_BLINDING.
-		 */
-		int ret;
-		CRYPTO_w_lock(CRYPTO_LOCK_RSA_BLINDING);
-		ret = BN_BLINDING_convert_ex(f, unblind, b, ctx);
-		CRYPTO_w_unlock(CRYPTO_LOCK_RSA_BLINDING);
-		return ret;
+	if (slot == RSA_BLINDING_KEY)
+		return;
+	if (slot == RSA_BLINDING_ONCE) {
+		BN_BLINDING_free(b);
+		return;
 	}
-}
-
-static int
-rsa_blinding_invert(BN_BLINDING *b, BIGNUM *f, BIGNUM *unblind, BN_CTX *ctx)
-{
-	/*
-	 * For local blinding, unblind is set to NULL, and BN_BLINDING_invert_ex
-	 * will use the unblinding factor stored in BN_BLINDING.
-	 * If BN_BLINDING is shared between threads, unblind must be non-null:
-	 * BN_BLINDING_invert_ex will then use the local unblinding factor,
-	 * and will only read the modulus from BN_BLINDING.
-	 * In both cases it's safe to access the blinding without a lock.
-	 */
-	return BN_BLINDING_invert_ex(f, unblind, b, ctx);
+	__sync_lock_release(&rsa->blinding_pool->slot[slot].busy);
 }
 
 /* signing */
@@ -354,13 +342,7 @@ RSA_eay_private_encrypt(int flen, const unsigned char *from, unsigned char *to,
 	int i, j, k, num = 0, r = -1;
 	unsigned char *buf = NULL;
 	BN_CTX *ctx = NULL;
-	int local_blinding = 0;
-	/*
-	 * Used only if the blinding structure is shared. A non-NULL unblind
-	 * instructs rsa_blinding_convert() and rsa_blinding_invert() to store
-	 * the unblinding factor outside the blinding structure.
-	 */
-	BIGNUM *unblind = NULL;
+	int blinding_slot = -1;
 	BN_BLINDING *blinding = NULL;
 
 	if ((ctx = BN_CTX_new()) == NULL)
@@ -404,19 +386,12 @@ RSA_eay_private_encrypt(int flen, const unsigned char *from, unsigned char *to,
 	}
 
 	if (!(rsa->flags & RSA_FLAG_NO_BLINDING)) {
-		blinding = rsa_get_blinding(rsa, &local_blinding, ctx);
+		blinding = rsa_get_blinding(rsa, &blinding_slot, ctx);
 		if (blinding == NULL) {
 			RSAerror(ERR_R_INTERNAL_ERROR);
 			goto err;
 		}
-	}
-
-	if (blinding != NULL) {
-		if (!local_blinding && ((unblind = BN_CTX_get(ctx)) == NULL)) {
-			RSAerror(ERR_R_MALLOC_FAILURE);
-			goto err;
-		}
-		if (!rsa_blinding_convert(blinding, f, unblind, ctx))
+		if (!BN_BLINDING_convert(f, blinding, ctx))
 			goto err;
 	}
 
@@ -443,7 +418,7 @@ RSA_eay_private_encrypt(int flen, const unsigned char *from, unsigned char *to,
 	}
 
 	if (blinding)
-		if (!rsa_blinding_invert(blinding, ret, unblind, ctx))
+		if (!BN_BLINDING_invert(ret, blinding, ctx))
 			goto err;
 
 	if (padding == RSA_X931_PADDING) {
@@ -465,6 +440,8 @@ RSA_eay_private_encrypt(int flen, const unsigned char *from, unsigned char *to,
 
 	r = num;
 err:
+	if (blinding != NULL)
+		rsa_put_blinding(rsa, blinding, blinding_slot);
 	if (ctx != NULL) {
 		BN_CTX_end(ctx);
 		BN_CTX_free(ctx);
@@ -482,13 +459,7 @@ RSA_eay_private_decrypt(int flen, const unsigned char *from, unsigned char *to,
 	unsigned char *p;
 	unsigned char *buf = NULL;
 	BN_CTX *ctx = NULL;
-	int local_blinding = 0;
-	/*
-	 * Used only if the blinding structure is shared. A non-NULL unblind
-	 * instructs rsa_blinding_convert() and rsa_blinding_invert() to store
-	 * the unblinding factor outside the blinding structure.
-	 */
-	BIGNUM *unblind = NULL;
+	int blinding_slot = -1;
 	BN_BLINDING *blinding = NULL;
 
 	if ((ctx = BN_CTX_new()) == NULL)
@@ -522,19 +493,12 @@ RSA_eay_private_decrypt(int flen, const unsigned char *from, unsigned char *to,
 	}
 
 	if (!(rsa->flags & RSA_FLAG_NO_BLINDING)) {
-		blinding = rsa_get_blinding(rsa, &local_blinding, ctx);
+		blinding = rsa_get_blinding(rsa, &blinding_slot, ctx);
 		if (blinding == NULL) {
 			RSAerror(ERR_R_INTERNAL_ERROR);
 			goto err;
 		}
-	}
-
-	if (blinding != NULL) {
-		if (!local_blinding && ((unblind = BN_CTX_get(ctx)) == NULL)) {
-			RSAerror(ERR_R_MALLOC_FAILURE);
-			goto err;
-		}
-		if (!rsa_blinding_convert(blinding, f, unblind, ctx))
+		if (!BN_BLINDING_convert(f, blinding, ctx))
 			goto err;
 	}
 
@@ -562,7 +526,7 @@ RSA_eay_private_decrypt(int flen, const unsigned char *from, unsigned char *to,
 	}
 
 	if (blinding)
-		if (!rsa_blinding_invert(blinding, ret, unblind, ctx))
+		if (!BN_BLINDING_invert(ret, blinding, ctx))
 			goto err;
 
 	p = buf;
@@ -588,6 +552,8 @@ RSA_eay_private_decrypt(int flen, const unsigned char *from, unsigned char *to,
 		RSAerror(RSA_R_PADDING_CHECK_FAILED);
 
 err:
+	if (blinding != NULL)
+		rsa_put_blinding(rsa, blinding, blinding_slot);
 	if (ctx != NULL) {
 		BN_CTX_end(ctx);
 		BN_CTX_free(ctx);
@@ -699,15 +665,16 @@ err:
 static int
 RSA_eay_mod_exp(BIGNUM *r0, const BIGNUM *I, RSA *rsa, BN_CTX *ctx)
 {
-	BIGNUM *r1, *m1, *vrfy;
+	BIGNUM *r1, *r2, *m1, *vrfy;
 	BIGNUM dmp1, dmq1, c, pr1;
 	int ret = 0;
 
 	BN_CTX_start(ctx);
 	r1 = BN_CTX_get(ctx);
+	r2 = BN_CTX_get(ctx);
 	m1 = BN_CTX_get(ctx);
 	vrfy = BN_CTX_get(ctx);
-	if (r1 == NULL || m1 == NULL || vrfy == NULL) {
+	if (r1 == NULL || r2 == NULL || m1 == NULL || vrfy == NULL) {
 		RSAerror(ERR_R_MALLOC_FAILURE);
 		goto err;
 	}
@@ -739,35 +706,37 @@ RSA_eay_mod_exp(BIGNUM *r0, const BIGNUM *I, RSA *rsa, BN_CTX *ctx)
 		    CRYPTO_LOCK_RSA, rsa->n, ctx))
 			goto err;
 
-	/* compute I mod q */
+	/* compute I mod q and I mod p */
 	BN_init(&c);
 	BN_with_flags(&c, I, BN_FLG_CONSTTIME);
 
 	if (!BN_mod_ct(r1, &c, rsa->q, ctx))
 		goto err;
+	if (!BN_mod_ct(r2, &c, rsa->p, ctx))
+		goto err;
 
-	/* compute r1^dmq1 mod q */
 	BN_init(&dmq1);
 	BN_with_flags(&dmq1, rsa->dmq1, BN_FLG_CONSTTIME);
-
-	if (!rsa->meth->bn_mod_exp(m1, r1, &dmq1, rsa->q, ctx,
-	    rsa->_method_mod_q))
-		goto err;
-
-	/* compute I mod p */
-	BN_init(&c);
-	BN_with_flags(&c, I, BN_FLG_CONSTTIME);
-
-	if (!BN_mod_ct(r1, &c, rsa->p, ctx))
-		goto err;
-
-	/* compute r1^dmp1 mod p */
 	BN_init(&dmp1);
 	BN_with_flags(&dmp1, rsa->dmp1, BN_FLG_CONSTTIME);
 
-	if (!rsa->meth->bn_mod_exp(r0, r1, &dmp1, rsa->p, ctx,
-	    rsa->_method_mod_p))
-		goto err;
+	if (rsa->meth->bn_mod_exp == BN_mod_exp_mont_ct) {
+		/* compute r1^dmq1 mod q and r2^dmp1 mod p together */
+		if (!bn_mod_exp_mont_consttime_x2(m1, r1, &dmq1, rsa->q,
+		    rsa->_method_mod_q, r0, r2, &dmp1, rsa->p,
+		    rsa->_method_mod_p, ctx))
+			goto err;
+	} else {
+		/* compute r1^dmq1 mod q */
+		if (!rsa->meth->bn_mod_exp(m1, r1, &dmq1, rsa->q, ctx,
+		    rsa->_method_mod_q))
+			goto err;
+
+		/* compute r2^dmp1 mod p */
+		if (!rsa->meth->bn_mod_exp(r0, r2, &dmp1, rsa->p, ctx,
+		    rsa->_method_mod_p))
+			goto err;
+	}
 
 	if (!BN_sub(r0, r0, m1))
 		goto err;
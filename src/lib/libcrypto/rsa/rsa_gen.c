@@ -72,7 +72,9 @@
 #include "bn_lcl.h"
 #include "rsa_locl.h"
 
-static int rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value, BN_GENCB *cb);
+static int rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value,
+    int nthreads, int (*start_thread)(void (*)(void *), void *, void *),
+    void *arg, BN_GENCB *cb);
 
 /*
  * NB: this wrapper would normally be placed in rsa_lib.c and the static
@@ -86,11 +88,39 @@ RSA_generate_key_ex(RSA *rsa, int bits, BIGNUM *e_value, BN_GENCB *cb)
 {
 	if (rsa->meth->rsa_keygen)
 		return rsa->meth->rsa_keygen(rsa, bits, e_value, cb);
-	return rsa_builtin_keygen(rsa, bits, e_value, cb);
+	return rsa_builtin_keygen(rsa, bits, e_value, 1, NULL, NULL, cb);
+}
+
+/*
+ * Like RSA_generate_key_ex(), but search for the primes with
+ * BN_generate_prime_mt() on threads provided by the caller.
+ */
+int
+RSA_generate_key_mt(RSA *rsa, int bits, BIGNUM *e_value, int nthreads,
+    int (*start_thread)(void (*work)(void *), void *work_arg, void *arg),
+    void *arg, BN_GENCB *cb)
+{
+	if (rsa->meth->rsa_keygen)
+		return rsa->meth->rsa_keygen(rsa, bits, e_value, cb);
+	return rsa_builtin_keygen(rsa, bits, e_value, nthreads, start_thread,
+	    arg, cb);
+}
+
+static int
+rsa_generate_prime(BIGNUM *p, int bits, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb)
+{
+	if (start_thread == NULL)
+		return BN_generate_prime_ex(p, bits, 0, NULL, NULL, cb);
+	return BN_generate_prime_mt(p, bits, 0, NULL, NULL, nthreads,
+	    start_thread, arg, cb);
 }
 
 static int
-rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value, BN_GENCB *cb)
+rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb)
 {
 	BIGNUM *r0 = NULL, *r1 = NULL, *r2 = NULL, *r3 = NULL, *tmp;
 	BIGNUM pr0, d, p;
@@ -135,7 +165,8 @@ rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value, BN_GENCB *cb)
 
 	/* generate p and q */
 	for (;;) {
-		if (!BN_generate_prime_ex(rsa->p, bitsp, 0, NULL, NULL, cb))
+		if (!rsa_generate_prime(rsa->p, bitsp, nthreads, start_thread,
+		    arg, cb))
 			goto err;
 		if (!BN_sub(r2, rsa->p, BN_value_one()))
 			goto err;
@@ -156,8 +187,8 @@ rsa_builtin_keygen(RSA *rsa, int bits, BIGNUM *e_value, BN_GENCB *cb)
 		 */
 		unsigned int degenerate = 0;
 		do {
-			if (!BN_generate_prime_ex(rsa->q, bitsq, 0, NULL, NULL,
-			    cb))
+			if (!rsa_generate_prime(rsa->q, bitsq, nthreads,
+			    start_thread, arg, cb))
 				goto err;
 		} while (BN_cmp(rsa->p, rsa->q) == 0 &&
 		    ++degenerate < 3);
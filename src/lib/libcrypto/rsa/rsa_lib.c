@@ -209,7 +209,7 @@ RSA_free(RSA *r)
 	BN_clear_free(r->dmq1);
 	BN_clear_free(r->iqmp);
 	BN_BLINDING_free(r->blinding);
-	BN_BLINDING_free(r->mt_blinding);
+	rsa_blinding_pool_free(r->blinding_pool);
 	RSA_PSS_PARAMS_free(r->pss);
 	free(r);
 }
@@ -45,6 +45,21 @@ struct rsa_meth_st {
 	int (*rsa_keygen)(RSA *rsa, int bits, BIGNUM *e, BN_GENCB *cb);
 };
 
+/*
+ * Blinding factors for private key operations, see rsa_get_blinding().
+ * Each slot is aligned to, and fills, a 64 byte cache line so that threads
+ * working on different slots do not write to the same line. The pool must
+ * therefore be allocated with posix_memalign().
+ */
+#define RSA_BLINDING_POOL_SIZE	64
+
+typedef struct rsa_blinding_pool_st {
+	struct {
+		BN_BLINDING *blinding;
+		int busy;
+	} __attribute((aligned(64))) slot[RSA_BLINDING_POOL_SIZE];
+} RSA_BLINDING_POOL;
+
 struct rsa_st {
 	/* The first parameter is used to pickup errors where
 	 * this is passed instead of aEVP_PKEY, it is set to 0 */
@@ -79,11 +94,12 @@ struct rsa_st {
 	/* all BIGNUM values are actually in the following data, if it is not
 	 * NULL */
 	BN_BLINDING *blinding;
-	BN_BLINDING *mt_blinding;
+	RSA_BLINDING_POOL *blinding_pool;
 };
 
 RSA_PSS_PARAMS *rsa_pss_params_create(const EVP_MD *sigmd, const EVP_MD *mgf1md,
     int saltlen);
+void rsa_blinding_pool_free(RSA_BLINDING_POOL *pool);
 int rsa_pss_get_param(const RSA_PSS_PARAMS *pss, const EVP_MD **pmd,
     const EVP_MD **pmgf1md, int *psaltlen);
 
@@ -59,8 +59,11 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <dirent.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <unistd.h>
@@ -77,10 +80,36 @@ typedef struct lookup_dir_hashes_st {
 	int suffix;
 } BY_DIR_HASH;
 
+/* A file named <hash>.<suffix> or <hash>.r<suffix> in a directory. */
+typedef struct lookup_dir_file_st {
+	unsigned long hash;
+	int type;
+	int suffix;
+} BY_DIR_FILE;
+
+/*
+ * The files of a directory, sorted by hash, type and suffix. If the
+ * directory could not be listed, the files are looked for one by one.
+ */
+typedef struct lookup_dir_index_st {
+	BY_DIR_FILE *files;
+	size_t num;
+	int listed;
+} BY_DIR_INDEX;
+
+/*
+ * How long the index of a directory is used before checking whether the
+ * directory has changed, in seconds.
+ */
+#define BY_DIR_INDEX_TTL	5
+
 typedef struct lookup_dir_entry_st {
 	char *dir;
 	int dir_type;
 	STACK_OF(BY_DIR_HASH) *hashes;
+	BY_DIR_INDEX *index;
+	struct timespec mtime;	/* of dir when index was built */
+	time_t checked;		/* when mtime was last compared */
 } BY_DIR_ENTRY;
 
 typedef struct lookup_dir_st {
@@ -178,11 +207,21 @@ by_dir_hash_cmp(const BY_DIR_HASH * const *a,
 	return 0;
 }
 
+static void
+by_dir_index_free(BY_DIR_INDEX *index)
+{
+	if (index == NULL)
+		return;
+	free(index->files);
+	free(index);
+}
+
 static void
 by_dir_entry_free(BY_DIR_ENTRY *ent)
 {
 	free(ent->dir);
 	sk_BY_DIR_HASH_pop_free(ent->hashes, by_dir_hash_free);
+	by_dir_index_free(ent->index);
 	free(ent);
 }
 
@@ -241,6 +280,8 @@ add_cert_dir(BY_DIR *ctx, const char *dir, int type)
 				return 0;
 			}
 			ent->dir_type = type;
+			ent->index = NULL;
+			ent->checked = 0;
 			ent->hashes = sk_BY_DIR_HASH_new(by_dir_hash_cmp);
 			ent->dir = strndup(ss, (size_t)len);
 			if (ent->dir == NULL || ent->hashes == NULL) {
@@ -248,6 +289,11 @@ add_cert_dir(BY_DIR *ctx, const char *dir, int type)
 				by_dir_entry_free(ent);
 				return 0;
 			}
+			/*
+			 * Lookups under the read lock must not have to sort
+			 * the hashes, so the stack is always kept sorted.
+			 */
+			sk_BY_DIR_HASH_sort(ent->hashes);
 			if (!sk_BY_DIR_ENTRY_push(ctx->dirs, ent)) {
 				X509error(ERR_R_MALLOC_FAILURE);
 				by_dir_entry_free(ent);
@@ -258,41 +304,224 @@ add_cert_dir(BY_DIR *ctx, const char *dir, int type)
 	return 1;
 }
 
+static int
+by_dir_file_cmp(const void *va, const void *vb)
+{
+	const BY_DIR_FILE *a = va, *b = vb;
+
+	if (a->hash != b->hash)
+		return a->hash < b->hash ? -1 : 1;
+	if (a->type != b->type)
+		return a->type < b->type ? -1 : 1;
+	if (a->suffix != b->suffix)
+		return a->suffix < b->suffix ? -1 : 1;
+	return 0;
+}
+
+/*
+ * Parse a file name the way get_cert_by_subject() would have built it.
+ * Anything else is not looked at, so it is left out of the index.
+ */
+static int
+by_dir_file_parse(const char *name, BY_DIR_FILE *file)
+{
+	const char *p = name;
+	int i;
+
+	file->hash = 0;
+	for (i = 0; i < 8; i++, p++) {
+		if (*p >= '0' && *p <= '9')
+			file->hash = file->hash << 4 | (*p - '0');
+		else if (*p >= 'a' && *p <= 'f')
+			file->hash = file->hash << 4 | (*p - 'a' + 10);
+		else
+			return 0;
+	}
+	if (*p++ != '.')
+		return 0;
+	file->type = X509_LU_X509;
+	if (*p == 'r') {
+		file->type = X509_LU_CRL;
+		p++;
+	}
+	if (*p < '0' || *p > '9' || (*p == '0' && p[1] != '\0'))
+		return 0;
+	for (file->suffix = 0; *p >= '0' && *p <= '9'; p++) {
+		if (file->suffix > (INT_MAX - 9) / 10)
+			return 0;
+		file->suffix = file->suffix * 10 + (*p - '0');
+	}
+
+	return *p == '\0';
+}
+
+static void
+by_dir_mtime(const char *dir, struct timespec *mtime)
+{
+	struct stat st;
+
+	if (stat(dir, &st) == -1) {
+		mtime->tv_sec = 0;
+		mtime->tv_nsec = 0;
+		return;
+	}
+	*mtime = st.st_mtim;
+}
+
+/*
+ * Read the names of the files in dir into a new index. A directory that
+ * cannot be read, such as one that may be searched but not listed, gives
+ * an index that is not listed. The caller takes the mtime of dir before,
+ * so that changes made while it is read are seen next time.
+ */
+static BY_DIR_INDEX *
+by_dir_index_new(const char *dir)
+{
+	BY_DIR_INDEX *index;
+	BY_DIR_FILE *files;
+	struct dirent *dp;
+	size_t max = 0;
+	DIR *dirp;
+
+	if ((index = calloc(1, sizeof(*index))) == NULL)
+		return NULL;
+	if ((dirp = opendir(dir)) == NULL)
+		return index;
+	for (;;) {
+		errno = 0;
+		if ((dp = readdir(dirp)) == NULL)
+			break;
+		if (index->num == max) {
+			max = max == 0 ? 64 : 2 * max;
+			if ((files = reallocarray(index->files, max,
+			    sizeof(*files))) == NULL) {
+				closedir(dirp);
+				by_dir_index_free(index);
+				return NULL;
+			}
+			index->files = files;
+		}
+		if (by_dir_file_parse(dp->d_name, &index->files[index->num]))
+			index->num++;
+	}
+	if (errno != 0) {
+		closedir(dirp);
+		free(index->files);
+		index->files = NULL;
+		index->num = 0;
+		return index;
+	}
+	closedir(dirp);
+	index->listed = 1;
+
+	if (index->num > 0)
+		qsort(index->files, index->num, sizeof(*index->files),
+		    by_dir_file_cmp);
+
+	return index;
+}
+
+/*
+ * Return how many of the files <hash>.<suffix>, <hash>.<suffix + 1>, ...
+ * of the given type are in the index, stopping at the first one missing,
+ * or -1 if the directory could not be listed. Needs the lock.
+ */
+static int
+by_dir_index_count(const BY_DIR_INDEX *index, unsigned long hash, int type,
+    int suffix)
+{
+	BY_DIR_FILE key;
+	const BY_DIR_FILE *file;
+	int n = 0;
+
+	if (index == NULL || !index->listed)
+		return -1;
+	if (index->num == 0)
+		return 0;
+
+	key.hash = hash;
+	key.type = type;
+	key.suffix = suffix;
+	if ((file = bsearch(&key, index->files, index->num, sizeof(key),
+	    by_dir_file_cmp)) == NULL)
+		return 0;
+	for (; file < &index->files[index->num]; file++, n++) {
+		if (file->hash != hash || file->type != type ||
+		    file->suffix != suffix + n)
+			break;
+	}
+
+	return n;
+}
+
+/*
+ * Make sure the index of ent is there and not older than BY_DIR_INDEX_TTL
+ * seconds. Once it is, the directory is only read again if its mtime has
+ * changed. Until then, lookups for names that have no file in a listed
+ * directory don't cost a system call.
+ */
+static int
+by_dir_index_refresh(BY_DIR_ENTRY *ent)
+{
+	BY_DIR_INDEX *index, *old;
+	struct timespec mtime, now;
+	int fresh;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	fresh = ent->index != NULL && now.tv_sec >= ent->checked &&
+	    now.tv_sec - ent->checked < BY_DIR_INDEX_TTL;
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+	if (fresh)
+		return 1;
+
+	by_dir_mtime(ent->dir, &mtime);
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	fresh = ent->index != NULL && mtime.tv_sec == ent->mtime.tv_sec &&
+	    mtime.tv_nsec == ent->mtime.tv_nsec;
+	if (fresh)
+		ent->checked = now.tv_sec;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	if (fresh)
+		return 1;
+
+	if ((index = by_dir_index_new(ent->dir)) == NULL) {
+		X509error(ERR_R_MALLOC_FAILURE);
+		return 0;
+	}
+
+	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	old = ent->index;
+	ent->index = index;
+	ent->mtime = mtime;
+	ent->checked = now.tv_sec;
+	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+
+	by_dir_index_free(old);
+
+	return 1;
+}
+
 static int
 get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
     X509_OBJECT *ret)
 {
 	BY_DIR *ctx;
-	union	{
-		struct	{
-			X509 st_x509;
-			X509_CINF st_x509_cinf;
-		} x509;
-		struct	{
-			X509_CRL st_crl;
-			X509_CRL_INFO st_crl_info;
-		} crl;
-	} data;
 	int ok = 0;
-	int i, j, k;
+	int i, j, k, n, probe;
 	unsigned long h;
 	BUF_MEM *b = NULL;
-	X509_OBJECT stmp, *tmp;
+	X509_OBJECT *tmp;
 	const char *postfix="";
 
 	if (name == NULL)
 		return 0;
 
-	stmp.type = type;
 	if (type == X509_LU_X509) {
-		data.x509.st_x509.cert_info = &data.x509.st_x509_cinf;
-		data.x509.st_x509_cinf.subject = name;
-		stmp.data.x509 = &data.x509.st_x509;
 		postfix="";
 	} else if (type == X509_LU_CRL) {
-		data.crl.st_crl.crl = &data.crl.st_crl_info;
-		data.crl.st_crl_info.issuer = name;
-		stmp.data.crl = &data.crl.st_crl;
 		postfix="r";
 	} else {
 		X509error(X509_R_WRONG_LOOKUP_TYPE);
@@ -318,31 +547,33 @@ get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 			X509error(ERR_R_MALLOC_FAILURE);
 			goto finish;
 		}
+		if (!by_dir_index_refresh(ent))
+			goto finish;
+		CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+		k = 0;
+		hent = NULL;
 		if (type == X509_LU_CRL) {
 			htmp.hash = h;
-			CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
 			idx = sk_BY_DIR_HASH_find(ent->hashes, &htmp);
 			if (idx >= 0) {
 				hent = sk_BY_DIR_HASH_value(ent->hashes, idx);
 				k = hent->suffix;
-			} else {
-				hent = NULL;
-				k = 0;
 			}
-			CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
-		} else {
-			k = 0;
-			hent = NULL;
 		}
-		for (;;) {
+		n = by_dir_index_count(ent->index, h, type, k);
+		CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+		/* Without an index, try the files until one is missing. */
+		probe = n == -1;
+		while (probe || n-- > 0) {
 			(void) snprintf(b->data, b->max, "%s/%08lx.%s%d",
 			    ent->dir, h, postfix, k);
 
-			{
+			if (probe) {
 				struct stat st;
 				if (stat(b->data, &st) < 0)
 					break;
 			}
+
 			/* found one. */
 			if (type == X509_LU_X509) {
 				if ((X509_load_cert_file(xl, b->data,
@@ -358,10 +589,7 @@ get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 		}
 
 		/* we have added it to the cache so now pull it out again */
-		CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-		j = sk_X509_OBJECT_find(xl->store_ctx->objs, &stmp);
-		tmp = sk_X509_OBJECT_value(xl->store_ctx->objs, j);
-		CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+		tmp = x509_store_get0_by_subject(xl->store_ctx, type, name);
 
 		/* If a CRL, update the last file suffix added for this */
 		if (type == X509_LU_CRL) {
@@ -392,6 +620,7 @@ get_cert_by_subject(X509_LOOKUP *xl, int type, X509_NAME *name,
 					ok = 0;
 					goto finish;
 				}
+				sk_BY_DIR_HASH_sort(ent->hashes);
 			} else if (hent->suffix < k)
 				hent->suffix = k;
 
@@ -71,11 +71,6 @@ static ERR_STRING_DATA X509_str_functs[] = {
 	{0, NULL}
 };
 
-static ERR_STRING_DATA X509V3_str_functs[] = {
-	{ERR_FUNC(0xfff), "CRYPTO_internal"},
-	{0, NULL}
-};
-
 static ERR_STRING_DATA X509_str_reasons[] = {
 	{ERR_REASON(X509_R_BAD_X509_FILETYPE)    , "bad x509 filetype"},
 	{ERR_REASON(X509_R_BASE64_DECODE_ERROR)  , "base64 decode error"},
@@ -107,6 +102,16 @@ static ERR_STRING_DATA X509_str_reasons[] = {
 	{0, NULL}
 };
 
+#undef ERR_FUNC
+#undef ERR_REASON
+#define ERR_FUNC(func) ERR_PACK(ERR_LIB_X509V3,func,0)
+#define ERR_REASON(reason) ERR_PACK(ERR_LIB_X509V3,0,reason)
+
+static ERR_STRING_DATA X509V3_str_functs[] = {
+	{ERR_FUNC(0xfff), "CRYPTO_internal"},
+	{0, NULL}
+};
+
 static ERR_STRING_DATA X509V3_str_reasons[] = {
 	{ERR_REASON(X509V3_R_BAD_IP_ADDRESS)     , "bad ip address"},
 	{ERR_REASON(X509V3_R_BAD_OBJECT)         , "bad object"},
@@ -29,82 +29,553 @@
  * validity of "child". It allows us to skip doing the public key math
  * when validating a certificate chain. It does not allow us to skip
  * any other steps of validation (times, names, key usage, etc.)
+ *
+ * The cache is split into shards by a prefix of the parent and child
+ * hashes, each with its own lock, table and CLOCK eviction. Lookups do
+ * not lock: a shard has a sequence count that is odd while the shard is
+ * being changed, and a lookup that overlaps a change is retried, or done
+ * with the lock held if the shard keeps changing.
+ *
+ * A table that is replaced may still be read by lookups that started
+ * before. Each thread announces the epoch it started a lookup in, and a
+ * replaced table is only freed once no thread is in a lookup that started
+ * in the epoch it was replaced in or earlier. The same per thread state
+ * holds the hit, miss and eviction counters, so that lookups do not write
+ * to memory shared with other threads.
  */
 
+#include <sys/types.h>
+
 #include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "x509_issuer_cache.h"
 
+#define X509_ISSUER_CACHE_SHARDS	16	/* power of 2 */
+#define X509_ISSUER_CACHE_RETRIES	2
+
+struct x509_issuer {
+	unsigned char parent_md[EVP_MAX_MD_SIZE];
+	unsigned char child_md[EVP_MAX_MD_SIZE];
+	unsigned char valid;		/* Result of signature validation. */
+	unsigned char used;		/* Set on hits, cleared by CLOCK. */
+};
+
+struct x509_issuer_table {
+	struct x509_issuer *entries;
+	uint32_t *index;		/* entry number + 1, or 0 if empty */
+	size_t index_mask;		/* index size - 1, at least 2 * capacity */
+	size_t capacity;
+	size_t count;
+	size_t hand;			/* CLOCK hand */
+	/* A table that was replaced, kept for lookups that still use it */
+	struct x509_issuer_table *prev;
+	unsigned long epoch;		/* in which it was replaced */
+};
+
+struct x509_issuer_shard {
+	pthread_mutex_t mutex;
+	unsigned int seq;		/* odd while the table is changed */
+	struct x509_issuer_table *table;
+	struct x509_issuer_table *retired;
+};
+
+/* Only written by its own thread. */
+struct x509_issuer_thread {
+	unsigned long epoch;		/* of the current lookup, or 0 */
+	struct x509_issuer_cache_stats stats;
+	struct x509_issuer_thread *next;
+};
+
+static size_t x509_issuer_cache_max = X509_ISSUER_CACHE_MAX;
+static struct x509_issuer_shard x509_issuer_shards[X509_ISSUER_CACHE_SHARDS];
+static pthread_once_t x509_issuer_shards_once = PTHREAD_ONCE_INIT;
+
+static unsigned long x509_issuer_epoch = 1;
+static pthread_key_t x509_issuer_thread_key;
+static int x509_issuer_thread_key_ok;
+static pthread_mutex_t x509_issuer_threads_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct x509_issuer_thread *x509_issuer_threads;
+/* Counters of exited threads, and of threads without their own. */
+static struct x509_issuer_cache_stats x509_issuer_stats_shared;
+
+static void
+x509_issuer_thread_exit(void *arg)
+{
+	struct x509_issuer_thread *t = arg, **tp;
+
+	(void) pthread_mutex_lock(&x509_issuer_threads_mutex);
+	for (tp = &x509_issuer_threads; *tp != NULL; tp = &(*tp)->next) {
+		if (*tp == t) {
+			*tp = t->next;
+			break;
+		}
+	}
+	__atomic_add_fetch(&x509_issuer_stats_shared.hits, t->stats.hits,
+	    __ATOMIC_RELAXED);
+	__atomic_add_fetch(&x509_issuer_stats_shared.misses, t->stats.misses,
+	    __ATOMIC_RELAXED);
+	__atomic_add_fetch(&x509_issuer_stats_shared.evictions,
+	    t->stats.evictions, __ATOMIC_RELAXED);
+	(void) pthread_mutex_unlock(&x509_issuer_threads_mutex);
+
+	free(t);
+}
+
+static void
+x509_issuer_shards_init(void)
+{
+	int i;
+
+	for (i = 0; i < X509_ISSUER_CACHE_SHARDS; i++)
+		pthread_mutex_init(&x509_issuer_shards[i].mutex, NULL);
+	if (pthread_key_create(&x509_issuer_thread_key,
+	    x509_issuer_thread_exit) == 0)
+		x509_issuer_thread_key_ok = 1;
+}
+
+/*
+ * Return the state of this thread, or NULL if it cannot have one. Such
+ * a thread looks entries up with the shard locked.
+ */
+static struct x509_issuer_thread *
+x509_issuer_thread_get(void)
+{
+	struct x509_issuer_thread *t;
+
+	if (pthread_once(&x509_issuer_shards_once,
+	    x509_issuer_shards_init) != 0)
+		return NULL;
+	if (!x509_issuer_thread_key_ok)
+		return NULL;
+	if ((t = pthread_getspecific(x509_issuer_thread_key)) != NULL)
+		return t;
+
+	if ((t = calloc(1, sizeof(*t))) == NULL)
+		return NULL;
+	if (pthread_setspecific(x509_issuer_thread_key, t) != 0) {
+		free(t);
+		return NULL;
+	}
+	(void) pthread_mutex_lock(&x509_issuer_threads_mutex);
+	t->next = x509_issuer_threads;
+	x509_issuer_threads = t;
+	(void) pthread_mutex_unlock(&x509_issuer_threads_mutex);
+
+	return t;
+}
+
+#define X509_ISSUER_HITS	offsetof(struct x509_issuer_cache_stats, hits)
+#define X509_ISSUER_MISSES	offsetof(struct x509_issuer_cache_stats, misses)
+#define X509_ISSUER_EVICTIONS	\
+	offsetof(struct x509_issuer_cache_stats, evictions)
+
+/*
+ * Count an event in the counters of thread t, which only t writes, or in
+ * the shared counters if t is NULL.
+ */
+static void
+x509_issuer_count(struct x509_issuer_thread *t, size_t counter)
+{
+	unsigned long *c;
+
+	if (t == NULL) {
+		c = (unsigned long *)((char *)&x509_issuer_stats_shared +
+		    counter);
+		__atomic_add_fetch(c, 1, __ATOMIC_RELAXED);
+		return;
+	}
+	c = (unsigned long *)((char *)&t->stats + counter);
+	__atomic_store_n(c, *c + 1, __ATOMIC_RELAXED);
+}
+
+/*
+ * Announce that thread t starts a lookup. After this, a table that is
+ * replaced is not freed until t is done.
+ */
+static void
+x509_issuer_thread_enter(struct x509_issuer_thread *t)
+{
+	__atomic_store_n(&t->epoch, __atomic_load_n(&x509_issuer_epoch,
+	    __ATOMIC_ACQUIRE), __ATOMIC_RELAXED);
+	/* Pairs with the fence in x509_issuer_oldest_epoch(). */
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static void
+x509_issuer_thread_leave(struct x509_issuer_thread *t)
+{
+	__atomic_store_n(&t->epoch, 0, __ATOMIC_RELEASE);
+}
+
+/*
+ * Return the oldest epoch in which a running lookup started. Tables
+ * replaced in an earlier epoch are no longer in use.
+ */
+static unsigned long
+x509_issuer_oldest_epoch(void)
+{
+	struct x509_issuer_thread *t;
+	unsigned long oldest, epoch;
+
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	oldest = __atomic_load_n(&x509_issuer_epoch, __ATOMIC_RELAXED);
+	(void) pthread_mutex_lock(&x509_issuer_threads_mutex);
+	for (t = x509_issuer_threads; t != NULL; t = t->next) {
+		epoch = __atomic_load_n(&t->epoch, __ATOMIC_ACQUIRE);
+		if (epoch != 0 && epoch < oldest)
+			oldest = epoch;
+	}
+	(void) pthread_mutex_unlock(&x509_issuer_threads_mutex);
+
+	return oldest;
+}
+
+/*
+ * Mix the leading bytes of both hashes. The child's are taken from a
+ * different offset than the parent's so that self signed certificates,
+ * where both hashes are the same, do not all end up in the same place.
+ */
+static uint32_t
+x509_issuer_hash(const unsigned char *parent_md, const unsigned char *child_md)
+{
+	uint32_t p, c;
+
+	memcpy(&p, parent_md, sizeof(p));
+	memcpy(&c, child_md + sizeof(c), sizeof(c));
+
+	return p ^ c;
+}
+
+static struct x509_issuer_shard *
+x509_issuer_shard_get(uint32_t hash)
+{
+	return &x509_issuer_shards[hash >> 28 & (X509_ISSUER_CACHE_SHARDS - 1)];
+}
+
 static int
-x509_issuer_cmp(struct x509_issuer *x1, struct x509_issuer *x2)
+x509_issuer_cmp(const struct x509_issuer *x, const unsigned char *parent_md,
+    const unsigned char *child_md)
 {
 	int pcmp;
-	if ((pcmp = memcmp(x1->parent_md, x2->parent_md, EVP_MAX_MD_SIZE)) != 0)
+
+	if ((pcmp = memcmp(x->parent_md, parent_md, EVP_MAX_MD_SIZE)) != 0)
 		return pcmp;
-	return memcmp(x1->child_md, x2->child_md, EVP_MAX_MD_SIZE);
+	return memcmp(x->child_md, child_md, EVP_MAX_MD_SIZE);
 }
 
-static size_t x509_issuer_cache_count;
-static size_t x509_issuer_cache_max = X509_ISSUER_CACHE_MAX;
-static RB_HEAD(x509_issuer_tree, x509_issuer) x509_issuer_cache =
-    RB_INITIALIZER(&x509_issuer_cache);
-static TAILQ_HEAD(lruqueue, x509_issuer) x509_issuer_lru =
-    TAILQ_HEAD_INITIALIZER(x509_issuer_lru);
-static pthread_mutex_t x509_issuer_tree_mutex = PTHREAD_MUTEX_INITIALIZER;
+static void
+x509_issuer_table_free(struct x509_issuer_table *table)
+{
+	struct x509_issuer_table *prev;
 
-RB_PROTOTYPE(x509_issuer_tree, x509_issuer, entry, x509_issuer_cmp);
-RB_GENERATE(x509_issuer_tree, x509_issuer, entry, x509_issuer_cmp);
+	for (; table != NULL; table = prev) {
+		prev = table->prev;
+		free(table->entries);
+		free(table->index);
+		free(table);
+	}
+}
+
+static struct x509_issuer_table *
+x509_issuer_table_new(size_t capacity)
+{
+	struct x509_issuer_table *table;
+	size_t size;
+
+	if (capacity > UINT32_MAX / 4)
+		return NULL;
+	for (size = 2; size < 2 * capacity; size *= 2)
+		;
+	if ((table = calloc(1, sizeof(*table))) == NULL)
+		return NULL;
+	table->capacity = capacity;
+	table->index_mask = size - 1;
+	if ((table->entries = calloc(capacity, sizeof(*table->entries))) ==
+	    NULL)
+		goto err;
+	if ((table->index = calloc(size, sizeof(*table->index))) == NULL)
+		goto err;
+
+	return table;
+
+ err:
+	x509_issuer_table_free(table);
+
+	return NULL;
+}
+
+/*
+ * Look up an entry in the table, using linear probing in an index of at
+ * least twice the capacity. Returns the index position, or -1 if there is no
+ * such entry. The number of probes is bounded, so that a lookup without
+ * the lock cannot loop on an index that is being changed.
+ */
+static ssize_t
+x509_issuer_table_find(struct x509_issuer_table *table, uint32_t hash,
+    const unsigned char *parent_md, const unsigned char *child_md)
+{
+	size_t mask = table->index_mask;
+	size_t i, probes;
+	uint32_t n;
+
+	i = hash & mask;
+	for (probes = 0; probes <= mask; probes++) {
+		if ((n = table->index[i]) == 0 || n > table->capacity)
+			break;
+		if (x509_issuer_cmp(&table->entries[n - 1], parent_md,
+		    child_md) == 0)
+			return i;
+		i = (i + 1) & mask;
+	}
+
+	return -1;
+}
+
+/*
+ * Remove index position i, moving later entries of the same probe
+ * sequence back so that they are still found. Must be called with the
+ * shard locked and its sequence count odd.
+ */
+static void
+x509_issuer_table_unindex(struct x509_issuer_table *table, size_t i)
+{
+	struct x509_issuer *x;
+	size_t mask = table->index_mask;
+	size_t j, home;
+	uint32_t n;
+
+	for (j = (i + 1) & mask; (n = table->index[j]) != 0;
+	    j = (j + 1) & mask) {
+		x = &table->entries[n - 1];
+		home = x509_issuer_hash(x->parent_md, x->child_md) & mask;
+		/* Move it back unless its home lies cyclically in (i, j]. */
+		if (i <= j ? (home <= i || home > j) : (home <= i && home > j)) {
+			table->index[i] = n;
+			i = j;
+		}
+	}
+	table->index[i] = 0;
+}
+
+/*
+ * Return the number of a free entry, evicting one if the table is full.
+ * An entry that was used since the hand last passed gets another round.
+ */
+static size_t
+x509_issuer_table_slot(struct x509_issuer_thread *t,
+    struct x509_issuer_table *table)
+{
+	struct x509_issuer *x;
+	size_t slot;
+	ssize_t i;
+
+	if (table->count < table->capacity)
+		return table->count++;
+
+	for (;;) {
+		slot = table->hand;
+		table->hand = (table->hand + 1) % table->capacity;
+		x = &table->entries[slot];
+		if (!__atomic_load_n(&x->used, __ATOMIC_RELAXED))
+			break;
+		__atomic_store_n(&x->used, 0, __ATOMIC_RELAXED);
+	}
+
+	i = x509_issuer_table_find(table, x509_issuer_hash(x->parent_md,
+	    x->child_md), x->parent_md, x->child_md);
+	if (i >= 0)
+		x509_issuer_table_unindex(table, i);
+	x509_issuer_count(t, X509_ISSUER_EVICTIONS);
+
+	return slot;
+}
+
+static void
+x509_issuer_shard_write_begin(struct x509_issuer_shard *shard)
+{
+	__atomic_store_n(&shard->seq, shard->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void
+x509_issuer_shard_write_end(struct x509_issuer_shard *shard)
+{
+	__atomic_store_n(&shard->seq, shard->seq + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Retire the table of a shard, which must be locked. The memory is
+ * released by x509_issuer_shard_reclaim() once no lookup uses it.
+ */
+static void
+x509_issuer_shard_retire(struct x509_issuer_shard *shard)
+{
+	struct x509_issuer_table *table;
+
+	if ((table = shard->table) == NULL)
+		return;
+	x509_issuer_shard_write_begin(shard);
+	__atomic_store_n(&shard->table, NULL, __ATOMIC_RELAXED);
+	x509_issuer_shard_write_end(shard);
+	table->epoch = __atomic_fetch_add(&x509_issuer_epoch, 1,
+	    __ATOMIC_SEQ_CST);
+	table->prev = shard->retired;
+	shard->retired = table;
+}
+
+/*
+ * Free the retired tables of a shard, which must be locked, that no
+ * lookup can still be using.
+ */
+static void
+x509_issuer_shard_reclaim(struct x509_issuer_shard *shard)
+{
+	struct x509_issuer_table **tp, *table;
+	unsigned long oldest;
+
+	if (shard->retired == NULL)
+		return;
+	oldest = x509_issuer_oldest_epoch();
+	for (tp = &shard->retired; (table = *tp) != NULL; ) {
+		if (table->epoch >= oldest) {
+			tp = &table->prev;
+			continue;
+		}
+		*tp = table->prev;
+		table->prev = NULL;
+		x509_issuer_table_free(table);
+	}
+}
 
 /*
  * Set the maximum number of cached entries. On additions to the cache
  * the least recently used entries will be discarded so that the cache
  * stays under the maximum number of entries.  Setting a maximum of 0
- * disables the cache.
+ * disables the cache. Changing the maximum discards all entries.
  */
 int
 x509_issuer_cache_set_max(size_t max)
 {
-	if (pthread_mutex_lock(&x509_issuer_tree_mutex) != 0)
+	struct x509_issuer_shard *shard;
+	int i;
+
+	if (pthread_once(&x509_issuer_shards_once,
+	    x509_issuer_shards_init) != 0)
 		return 0;
-	x509_issuer_cache_max = max;
-	(void) pthread_mutex_unlock(&x509_issuer_tree_mutex);
+	for (i = 0; i < X509_ISSUER_CACHE_SHARDS; i++) {
+		shard = &x509_issuer_shards[i];
+		if (pthread_mutex_lock(&shard->mutex) != 0)
+			return 0;
+		x509_issuer_shard_retire(shard);
+		x509_issuer_shard_reclaim(shard);
+		(void) pthread_mutex_unlock(&shard->mutex);
+	}
+	__atomic_store_n(&x509_issuer_cache_max, max, __ATOMIC_RELAXED);
 
 	return 1;
 }
 
 /*
- * Free the oldest entry in the issuer cache. Returns 1
- * if an entry was successfuly freed, 0 otherwise. Must
- * be called with x509_issuer_tree_mutex held.
+ * Free the entire issuer cache, discarding all entries. Lookups must not
+ * run at the same time.
  */
 void
-x509_issuer_cache_free_oldest()
+x509_issuer_cache_free()
 {
-	struct x509_issuer *old;
+	struct x509_issuer_shard *shard;
+	int i;
 
-	if (x509_issuer_cache_count == 0)
+	if (pthread_once(&x509_issuer_shards_once,
+	    x509_issuer_shards_init) != 0)
 		return;
-	old = TAILQ_LAST(&x509_issuer_lru, lruqueue);
-	TAILQ_REMOVE(&x509_issuer_lru, old, queue);
-	RB_REMOVE(x509_issuer_tree, &x509_issuer_cache, old);
-	free(old->parent_md);
-	free(old->child_md);
-	free(old);
-	x509_issuer_cache_count--;
+	for (i = 0; i < X509_ISSUER_CACHE_SHARDS; i++) {
+		shard = &x509_issuer_shards[i];
+		if (pthread_mutex_lock(&shard->mutex) != 0)
+			continue;
+		x509_issuer_shard_retire(shard);
+		x509_issuer_table_free(shard->retired);
+		shard->retired = NULL;
+		(void) pthread_mutex_unlock(&shard->mutex);
+	}
 }
 
 /*
- * Free the entire issuer cache, discarding all entries.
+ * Runs when libcrypto is unloaded. Delete the key so that threads exiting
+ * afterwards don't call x509_issuer_thread_exit(). No thread can get at
+ * its state after that, so free the states of all threads.
  */
-void
-x509_issuer_cache_free()
+static void __attribute__((__destructor__))
+x509_issuer_cache_unload(void)
 {
-	if (pthread_mutex_lock(&x509_issuer_tree_mutex) != 0)
+	struct x509_issuer_thread *t;
+
+	if (!x509_issuer_thread_key_ok)
 		return;
-	while (x509_issuer_cache_count > 0)
-		x509_issuer_cache_free_oldest();
-	(void) pthread_mutex_unlock(&x509_issuer_tree_mutex);
+	x509_issuer_thread_key_ok = 0;
+	(void) pthread_key_delete(x509_issuer_thread_key);
+
+	(void) pthread_mutex_lock(&x509_issuer_threads_mutex);
+	while ((t = x509_issuer_threads) != NULL) {
+		x509_issuer_threads = t->next;
+		free(t);
+	}
+	(void) pthread_mutex_unlock(&x509_issuer_threads_mutex);
+
+	x509_issuer_cache_free();
+}
+
+/*
+ * Sum the hit, miss and eviction counters of all threads.
+ */
+void
+x509_issuer_cache_stats(struct x509_issuer_cache_stats *stats)
+{
+	struct x509_issuer_thread *t;
+
+	(void) pthread_mutex_lock(&x509_issuer_threads_mutex);
+	stats->hits = __atomic_load_n(&x509_issuer_stats_shared.hits,
+	    __ATOMIC_RELAXED);
+	stats->misses = __atomic_load_n(&x509_issuer_stats_shared.misses,
+	    __ATOMIC_RELAXED);
+	stats->evictions = __atomic_load_n(&x509_issuer_stats_shared.evictions,
+	    __ATOMIC_RELAXED);
+	for (t = x509_issuer_threads; t != NULL; t = t->next) {
+		stats->hits += __atomic_load_n(&t->stats.hits,
+		    __ATOMIC_RELAXED);
+		stats->misses += __atomic_load_n(&t->stats.misses,
+		    __ATOMIC_RELAXED);
+		stats->evictions += __atomic_load_n(&t->stats.evictions,
+		    __ATOMIC_RELAXED);
+	}
+	(void) pthread_mutex_unlock(&x509_issuer_threads_mutex);
+}
+
+/*
+ * Look up parent and child in the current table of a shard. Returns the
+ * cached result, or -1 if there is none.
+ */
+static int
+x509_issuer_shard_find(struct x509_issuer_shard *shard, uint32_t hash,
+    unsigned char *parent_md, unsigned char *child_md)
+{
+	struct x509_issuer_table *table;
+	struct x509_issuer *x;
+	ssize_t i;
+
+	table = __atomic_load_n(&shard->table, __ATOMIC_ACQUIRE);
+	if (table == NULL)
+		return -1;
+	if ((i = x509_issuer_table_find(table, hash, parent_md,
+	    child_md)) < 0)
+		return -1;
+	x = &table->entries[table->index[i] - 1];
+	if (!__atomic_load_n(&x->used, __ATOMIC_RELAXED))
+		__atomic_store_n(&x->used, 1, __ATOMIC_RELAXED);
+	return x->valid;
 }
 
 /*
@@ -118,25 +589,47 @@ x509_issuer_cache_free()
 int
 x509_issuer_cache_find(unsigned char *parent_md, unsigned char *child_md)
 {
-	struct x509_issuer candidate, *found;
-	int ret = -1;
-
-	memset(&candidate, 0, sizeof(candidate));
-	candidate.parent_md = parent_md;
-	candidate.child_md = child_md;
+	struct x509_issuer_shard *shard;
+	struct x509_issuer_thread *t;
+	unsigned int seq;
+	uint32_t hash;
+	int tries, ret = -1;
 
-	if (x509_issuer_cache_max == 0)
+	if (__atomic_load_n(&x509_issuer_cache_max, __ATOMIC_RELAXED) == 0)
 		return -1;
 
-	if (pthread_mutex_lock(&x509_issuer_tree_mutex) != 0)
-		return -1;
-	if ((found = RB_FIND(x509_issuer_tree, &x509_issuer_cache,
-	    &candidate)) != NULL) {
-		TAILQ_REMOVE(&x509_issuer_lru, found, queue);
-		TAILQ_INSERT_HEAD(&x509_issuer_lru, found, queue);
-		ret = found->valid;
+	hash = x509_issuer_hash(parent_md, child_md);
+	shard = x509_issuer_shard_get(hash);
+
+	if ((t = x509_issuer_thread_get()) == NULL)
+		goto locked;
+
+	x509_issuer_thread_enter(t);
+	for (tries = 0; tries < X509_ISSUER_CACHE_RETRIES; tries++) {
+		seq = __atomic_load_n(&shard->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1)
+			continue;
+		ret = x509_issuer_shard_find(shard, hash, parent_md, child_md);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&shard->seq, __ATOMIC_RELAXED) == seq) {
+			x509_issuer_thread_leave(t);
+			goto done;
+		}
 	}
-	(void) pthread_mutex_unlock(&x509_issuer_tree_mutex);
+	x509_issuer_thread_leave(t);
+
+	/* The shard kept changing, wait for it. */
+ locked:
+	if (pthread_once(&x509_issuer_shards_once,
+	    x509_issuer_shards_init) != 0)
+		return -1;
+	if (pthread_mutex_lock(&shard->mutex) != 0)
+		return -1;
+	ret = x509_issuer_shard_find(shard, hash, parent_md, child_md);
+	(void) pthread_mutex_unlock(&shard->mutex);
+
+ done:
+	x509_issuer_count(t, ret == -1 ? X509_ISSUER_MISSES : X509_ISSUER_HITS);
 
 	return ret;
 }
@@ -154,40 +647,52 @@ void
 x509_issuer_cache_add(unsigned char *parent_md, unsigned char *child_md,
     int valid)
 {
-	struct x509_issuer *new;
+	struct x509_issuer_shard *shard;
+	struct x509_issuer_thread *t;
+	struct x509_issuer_table *table;
+	struct x509_issuer *x;
+	size_t max, mask, slot, i;
+	uint32_t hash;
 
-	if (x509_issuer_cache_max == 0)
+	if ((max = __atomic_load_n(&x509_issuer_cache_max,
+	    __ATOMIC_RELAXED)) == 0)
 		return;
 	if (valid != 0 && valid != 1)
 		return;
 
-	if ((new = calloc(1, sizeof(struct x509_issuer))) == NULL)
+	hash = x509_issuer_hash(parent_md, child_md);
+	shard = x509_issuer_shard_get(hash);
+
+	t = x509_issuer_thread_get();
+	if (pthread_once(&x509_issuer_shards_once,
+	    x509_issuer_shards_init) != 0)
 		return;
-	if ((new->parent_md = calloc(1, EVP_MAX_MD_SIZE)) == NULL)
-		goto err;
-	memcpy(new->parent_md, parent_md, EVP_MAX_MD_SIZE);
-	if ((new->child_md = calloc(1, EVP_MAX_MD_SIZE)) == NULL)
+	if (pthread_mutex_lock(&shard->mutex) != 0)
+		return;
+	x509_issuer_shard_reclaim(shard);
+	if ((table = shard->table) == NULL) {
+		table = x509_issuer_table_new((max + X509_ISSUER_CACHE_SHARDS -
+		    1) / X509_ISSUER_CACHE_SHARDS);
+		if (table == NULL)
+			goto err;
+		__atomic_store_n(&shard->table, table, __ATOMIC_RELEASE);
+	}
+	if (x509_issuer_table_find(table, hash, parent_md, child_md) >= 0)
 		goto err;
-	memcpy(new->child_md, child_md, EVP_MAX_MD_SIZE);
 
-	new->valid = valid;
-
-	if (pthread_mutex_lock(&x509_issuer_tree_mutex) != 0)
-		goto err;
-	while (x509_issuer_cache_count >= x509_issuer_cache_max)
-		x509_issuer_cache_free_oldest();
-	if (RB_INSERT(x509_issuer_tree, &x509_issuer_cache, new) == NULL) {
-		TAILQ_INSERT_HEAD(&x509_issuer_lru, new, queue);
-		x509_issuer_cache_count++;
-		new = NULL;
-	}
-	(void) pthread_mutex_unlock(&x509_issuer_tree_mutex);
+	x509_issuer_shard_write_begin(shard);
+	slot = x509_issuer_table_slot(t, table);
+	x = &table->entries[slot];
+	memcpy(x->parent_md, parent_md, EVP_MAX_MD_SIZE);
+	memcpy(x->child_md, child_md, EVP_MAX_MD_SIZE);
+	x->valid = valid;
+	x->used = 0;
+	mask = table->index_mask;
+	for (i = hash & mask; table->index[i] != 0; i = (i + 1) & mask)
+		;
+	table->index[i] = slot + 1;
+	x509_issuer_shard_write_end(shard);
 
  err:
-	if (new != NULL) {
-		free(new->parent_md);
-		free(new->child_md);
-	}
-	free(new);
-	return;
+	(void) pthread_mutex_unlock(&shard->mutex);
 }
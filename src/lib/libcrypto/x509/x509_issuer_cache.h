@@ -19,28 +19,23 @@
 #ifndef HEADER_X509_ISSUER_CACHE_H
 #define HEADER_X509_ISSUER_CACHE_H
 
-#include <sys/tree.h>
-#include <sys/queue.h>
-
 #include <openssl/x509.h>
 
 __BEGIN_HIDDEN_DECLS
 
-struct x509_issuer {
-	RB_ENTRY(x509_issuer) entry;
-	TAILQ_ENTRY(x509_issuer) queue;	/* LRU of entries */
-	/* parent_md and child_md must point to EVP_MAX_MD_SIZE of memory */
-	unsigned char *parent_md;
-	unsigned char *child_md;
-	int valid;			/* Result of signature validation. */
-};
+#define X509_ISSUER_CACHE_MAX 40000	/* Approx 5.6 MB, entries 140 bytes */
 
-#define X509_ISSUER_CACHE_MAX 40000	/* Approx 7.5 MB, entries 200 bytes */
+struct x509_issuer_cache_stats {
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+};
 
 int x509_issuer_cache_set_max(size_t max);
 int x509_issuer_cache_find(unsigned char *parent_md, unsigned char *child_md);
 void x509_issuer_cache_add(unsigned char *parent_md, unsigned char *child_md,
     int valid);
+void x509_issuer_cache_stats(struct x509_issuer_cache_stats *stats);
 void x509_issuer_cache_free();
 
 __END_HIDDEN_DECLS
@@ -285,6 +285,8 @@ struct X509_VERIFY_PARAM_st {
 struct x509_store_st {
 	/* The following is a cache of trusted certs */
 	STACK_OF(X509_OBJECT) *objs;	/* Cache of all objects */
+	struct x509_object_index *subject_index; /* objs by subject name */
+	struct x509_object_index *skid_index;	/* certs in objs by SKID */
 
 	/* These are external lookup methods */
 	STACK_OF(X509_LOOKUP) *get_cert_methods;
@@ -372,6 +374,8 @@ struct x509_store_ctx_st {
 } /* X509_STORE_CTX */;
 
 int x509_check_cert_time(X509_STORE_CTX *ctx, X509 *x, int quiet);
+X509_OBJECT *x509_store_get0_by_subject(X509_STORE *store,
+    X509_LOOKUP_TYPE type, X509_NAME *name);
 
 int name_cmp(const char *name, const char *cmp);
 
@@ -56,7 +56,9 @@
  * [including the GNU Public Licence.]
  */
 
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <openssl/err.h>
@@ -179,6 +181,217 @@ x509_object_cmp(const X509_OBJECT * const *a, const X509_OBJECT * const *b)
 	return 0;
 }
 
+/*
+ * Besides the objs stack, the objects of a store are kept in two hash
+ * indexes: all objects by subject name (issuer name for CRLs), and
+ * certificates by subject key identifier. Looking objects up in the
+ * indexes doesn't change anything, so it only needs the read lock, and
+ * adding an object doesn't sort the stack. Objects are never removed.
+ */
+struct x509_object_index_entry {
+	X509_OBJECT *obj;
+	uint32_t hash;
+	struct x509_object_index_entry *next;
+};
+
+struct x509_object_index {
+	struct x509_object_index_entry **buckets;
+	size_t mask;
+	size_t count;
+};
+
+#define X509_OBJECT_INDEX_MIN_BUCKETS	64
+
+/* FNV-1a */
+static uint32_t
+x509_object_index_hash(const unsigned char *data, size_t len)
+{
+	uint32_t hash = 2166136261U;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		hash ^= data[i];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static X509_NAME *
+x509_object_name(const X509_OBJECT *obj)
+{
+	switch (obj->type) {
+	case X509_LU_X509:
+		return X509_get_subject_name(obj->data.x509);
+	case X509_LU_CRL:
+		return X509_CRL_get_issuer(obj->data.crl);
+	}
+	return NULL;
+}
+
+/* Hash the canonical encoding of name, which is what X509_NAME_cmp() uses. */
+static int
+x509_name_index_hash(X509_NAME *name, uint32_t *hash)
+{
+	if (name == NULL)
+		return 0;
+	if (name->canon_enc == NULL || name->modified) {
+		if (i2d_X509_NAME(name, NULL) < 0)
+			return 0;
+	}
+	*hash = x509_object_index_hash(name->canon_enc, name->canon_enclen);
+
+	return 1;
+}
+
+static int
+x509_skid_index_hash(const ASN1_OCTET_STRING *skid, uint32_t *hash)
+{
+	if (skid == NULL)
+		return 0;
+	*hash = x509_object_index_hash(skid->data, skid->length);
+
+	return 1;
+}
+
+static struct x509_object_index *
+x509_object_index_new(void)
+{
+	struct x509_object_index *index;
+
+	if ((index = calloc(1, sizeof(*index))) == NULL)
+		return NULL;
+	if ((index->buckets = calloc(X509_OBJECT_INDEX_MIN_BUCKETS,
+	    sizeof(*index->buckets))) == NULL) {
+		free(index);
+		return NULL;
+	}
+	index->mask = X509_OBJECT_INDEX_MIN_BUCKETS - 1;
+
+	return index;
+}
+
+static void
+x509_object_index_free(struct x509_object_index *index)
+{
+	struct x509_object_index_entry *entry, *next;
+	size_t i;
+
+	if (index == NULL)
+		return;
+	for (i = 0; i <= index->mask; i++) {
+		for (entry = index->buckets[i]; entry != NULL; entry = next) {
+			next = entry->next;
+			free(entry);
+		}
+	}
+	free(index->buckets);
+	free(index);
+}
+
+static struct x509_object_index_entry *
+x509_object_index_bucket(const struct x509_object_index *index, uint32_t hash)
+{
+	return index->buckets[hash & index->mask];
+}
+
+/* Append entry to its chain, so that matches are found in insertion order. */
+static void
+x509_object_index_link(struct x509_object_index_entry **buckets, size_t mask,
+    struct x509_object_index_entry *entry)
+{
+	struct x509_object_index_entry **tail;
+
+	for (tail = &buckets[entry->hash & mask]; *tail != NULL;
+	    tail = &(*tail)->next)
+		;
+	entry->next = NULL;
+	*tail = entry;
+}
+
+/*
+ * Add an entry to the index. Needs the write lock. This cannot fail: if the
+ * buckets cannot be grown, the chains just get longer.
+ */
+static void
+x509_object_index_insert(struct x509_object_index *index,
+    struct x509_object_index_entry *entry)
+{
+	struct x509_object_index_entry **buckets, *e, *next;
+	size_t i, mask;
+
+	if (index->count > index->mask &&
+	    (buckets = reallocarray(NULL, 2 * (index->mask + 1),
+	    sizeof(*buckets))) != NULL) {
+		mask = 2 * index->mask + 1;
+		memset(buckets, 0, (mask + 1) * sizeof(*buckets));
+		for (i = 0; i <= index->mask; i++) {
+			for (e = index->buckets[i]; e != NULL; e = next) {
+				next = e->next;
+				x509_object_index_link(buckets, mask, e);
+			}
+		}
+		free(index->buckets);
+		index->buckets = buckets;
+		index->mask = mask;
+	}
+	x509_object_index_link(index->buckets, index->mask, entry);
+	index->count++;
+}
+
+/* Return the first entry from e on for an object of this type and name. */
+static struct x509_object_index_entry *
+x509_object_index_by_subject(struct x509_object_index_entry *e, uint32_t hash,
+    X509_LOOKUP_TYPE type, X509_NAME *name)
+{
+	for (; e != NULL; e = e->next) {
+		if (e->hash != hash || e->obj->type != type)
+			continue;
+		if (X509_NAME_cmp(x509_object_name(e->obj), name) == 0)
+			return e;
+	}
+	return NULL;
+}
+
+/* Return the first entry from e on for a certificate with this SKID. */
+static struct x509_object_index_entry *
+x509_object_index_by_skid(struct x509_object_index_entry *e, uint32_t hash,
+    const ASN1_OCTET_STRING *skid)
+{
+	for (; e != NULL; e = e->next) {
+		if (e->hash != hash)
+			continue;
+		if (ASN1_OCTET_STRING_cmp(e->obj->data.x509->skid, skid) == 0)
+			return e;
+	}
+	return NULL;
+}
+
+/*
+ * Return the first object of the store with this type and name, without
+ * taking a reference. Takes the read lock.
+ */
+X509_OBJECT *
+x509_store_get0_by_subject(X509_STORE *store, X509_LOOKUP_TYPE type,
+    X509_NAME *name)
+{
+	struct x509_object_index_entry *e;
+	X509_OBJECT *obj = NULL;
+	uint32_t hash;
+
+	if (!x509_name_index_hash(name, &hash))
+		return NULL;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	e = x509_object_index_by_subject(x509_object_index_bucket(
+	    store->subject_index, hash), hash, type, name);
+	if (e != NULL)
+		obj = e->obj;
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
+
+	return obj;
+}
+
 X509_STORE *
 X509_STORE_new(void)
 {
@@ -189,6 +402,10 @@ X509_STORE_new(void)
 
 	if ((store->objs = sk_X509_OBJECT_new(x509_object_cmp)) == NULL)
 		goto err;
+	if ((store->subject_index = x509_object_index_new()) == NULL)
+		goto err;
+	if ((store->skid_index = x509_object_index_new()) == NULL)
+		goto err;
 	if ((store->get_cert_methods = sk_X509_LOOKUP_new_null()) == NULL)
 		goto err;
 	if ((store->param = X509_VERIFY_PARAM_new()) == NULL)
@@ -262,6 +479,8 @@ X509_STORE_free(X509_STORE *store)
 		X509_LOOKUP_free(lu);
 	}
 	sk_X509_LOOKUP_free(sk);
+	x509_object_index_free(store->subject_index);
+	x509_object_index_free(store->skid_index);
 	sk_X509_OBJECT_pop_free(store->objs, X509_OBJECT_free);
 
 	CRYPTO_free_ex_data(CRYPTO_EX_INDEX_X509_STORE, store, &store->ex_data);
@@ -333,9 +552,7 @@ X509_STORE_CTX_get_by_subject(X509_STORE_CTX *vs, X509_LOOKUP_TYPE type,
 
 	memset(&stmp, 0, sizeof(stmp));
 
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	tmp = X509_OBJECT_retrieve_by_subject(ctx->objs, type, name);
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	tmp = x509_store_get0_by_subject(ctx, type, name);
 
 	if (tmp == NULL || type == X509_LU_CRL) {
 		for (i = 0; i < sk_X509_LOOKUP_num(ctx->get_cert_methods); i++) {
@@ -357,15 +574,64 @@ X509_STORE_CTX_get_by_subject(X509_STORE_CTX *vs, X509_LOOKUP_TYPE type,
 	return 1;
 }
 
+/* Whether an object equal to obj is in the store. Needs the lock. */
+static int
+X509_STORE_has_object(X509_STORE *store, X509_OBJECT *obj, uint32_t hash)
+{
+	struct x509_object_index_entry *e;
+	X509_NAME *name = x509_object_name(obj);
+
+	for (e = x509_object_index_by_subject(x509_object_index_bucket(
+	    store->subject_index, hash), hash, obj->type, name); e != NULL;
+	    e = x509_object_index_by_subject(e->next, hash, obj->type, name)) {
+		if (obj->type == X509_LU_X509 &&
+		    X509_cmp(e->obj->data.x509, obj->data.x509) == 0)
+			return 1;
+		if (obj->type == X509_LU_CRL &&
+		    X509_CRL_match(e->obj->data.crl, obj->data.crl) == 0)
+			return 1;
+	}
+	return 0;
+}
+
 /* Add obj to the store. Takes ownership of obj. */
 static int
 X509_STORE_add_object(X509_STORE *store, X509_OBJECT *obj)
 {
+	struct x509_object_index_entry *subject_entry = NULL;
+	struct x509_object_index_entry *skid_entry = NULL;
+	ASN1_OCTET_STRING *skid = NULL;
+	uint32_t hash;
 	int ret = 0;
 
+	if (!x509_name_index_hash(x509_object_name(obj), &hash)) {
+		X509error(ERR_R_MALLOC_FAILURE);
+		goto err;
+	}
+	if ((subject_entry = calloc(1, sizeof(*subject_entry))) == NULL) {
+		X509error(ERR_R_MALLOC_FAILURE);
+		goto err;
+	}
+	subject_entry->obj = obj;
+	subject_entry->hash = hash;
+
+	if (obj->type == X509_LU_X509) {
+		/* Caches the extensions, including the SKID. */
+		(void)X509_check_purpose(obj->data.x509, -1, 0);
+		skid = obj->data.x509->skid;
+	}
+	if (skid != NULL) {
+		if ((skid_entry = calloc(1, sizeof(*skid_entry))) == NULL) {
+			X509error(ERR_R_MALLOC_FAILURE);
+			goto err;
+		}
+		skid_entry->obj = obj;
+		(void)x509_skid_index_hash(skid, &skid_entry->hash);
+	}
+
 	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
 
-	if (X509_OBJECT_retrieve_match(store->objs, obj) != NULL) {
+	if (X509_STORE_has_object(store, obj, hash)) {
 		/* Object is already present in the store. That's fine. */
 		ret = 1;
 		goto out;
@@ -375,12 +641,21 @@ X509_STORE_add_object(X509_STORE *store, X509_OBJECT *obj)
 		X509error(ERR_R_MALLOC_FAILURE);
 		goto out;
 	}
+	x509_object_index_insert(store->subject_index, subject_entry);
+	subject_entry = NULL;
+	if (skid_entry != NULL) {
+		x509_object_index_insert(store->skid_index, skid_entry);
+		skid_entry = NULL;
+	}
 
 	obj = NULL;
 	ret = 1;
 
  out:
 	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+ err:
+	free(subject_entry);
+	free(skid_entry);
 	X509_OBJECT_free(obj);
 
 	return ret;
@@ -530,24 +805,27 @@ X509_OBJECT_get0_X509_CRL(X509_OBJECT *xo)
 static STACK_OF(X509) *
 X509_get1_certs_from_cache(X509_STORE *store, X509_NAME *name)
 {
+	struct x509_object_index_entry *e;
 	STACK_OF(X509) *sk = NULL;
 	X509 *x = NULL;
-	X509_OBJECT *obj;
-	int i, idx, cnt;
+	uint32_t hash;
 
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
+	if (!x509_name_index_hash(name, &hash))
+		return NULL;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
 
-	idx = x509_object_idx_cnt(store->objs, X509_LU_X509, name, &cnt);
-	if (idx < 0)
+	e = x509_object_index_by_subject(x509_object_index_bucket(
+	    store->subject_index, hash), hash, X509_LU_X509, name);
+	if (e == NULL)
 		goto err;
 
 	if ((sk = sk_X509_new_null()) == NULL)
 		goto err;
 
-	for (i = 0; i < cnt; i++, idx++) {
-		obj = sk_X509_OBJECT_value(store->objs, idx);
-
-		x = obj->data.x509;
+	for (; e != NULL; e = x509_object_index_by_subject(e->next, hash,
+	    X509_LU_X509, name)) {
+		x = e->obj->data.x509;
 		if (!X509_up_ref(x)) {
 			x = NULL;
 			goto err;
@@ -556,12 +834,12 @@ X509_get1_certs_from_cache(X509_STORE *store, X509_NAME *name)
 			goto err;
 	}
 
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
 
 	return sk;
 
  err:
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
 	sk_X509_pop_free(sk, X509_free);
 	X509_free(x);
 
@@ -594,10 +872,11 @@ STACK_OF(X509_CRL) *
 X509_STORE_get1_crls(X509_STORE_CTX *ctx, X509_NAME *name)
 {
 	X509_STORE *store = ctx->store;
+	struct x509_object_index_entry *e;
 	STACK_OF(X509_CRL) *sk = NULL;
 	X509_CRL *x = NULL;
 	X509_OBJECT *obj = NULL;
-	int i, idx, cnt;
+	uint32_t hash;
 
 	if (store == NULL)
 		return NULL;
@@ -610,18 +889,21 @@ X509_STORE_get1_crls(X509_STORE_CTX *ctx, X509_NAME *name)
 	X509_OBJECT_free(obj);
 	obj = NULL;
 
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	idx = x509_object_idx_cnt(store->objs, X509_LU_CRL, name, &cnt);
-	if (idx < 0)
+	if (!x509_name_index_hash(name, &hash))
+		return NULL;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+	e = x509_object_index_by_subject(x509_object_index_bucket(
+	    store->subject_index, hash), hash, X509_LU_CRL, name);
+	if (e == NULL)
 		goto err;
 
 	if ((sk = sk_X509_CRL_new_null()) == NULL)
 		goto err;
 
-	for (i = 0; i < cnt; i++, idx++) {
-		obj = sk_X509_OBJECT_value(store->objs, idx);
-
-		x = obj->data.crl;
+	for (; e != NULL; e = x509_object_index_by_subject(e->next, hash,
+	    X509_LU_CRL, name)) {
+		x = e->obj->data.crl;
 		if (!X509_CRL_up_ref(x)) {
 			x = NULL;
 			goto err;
@@ -630,11 +912,11 @@ X509_STORE_get1_crls(X509_STORE_CTX *ctx, X509_NAME *name)
 			goto err;
 	}
 
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
 	return sk;
 
  err:
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
 	X509_CRL_free(x);
 	sk_X509_CRL_pop_free(sk, X509_CRL_free);
 	return NULL;
@@ -682,10 +964,12 @@ X509_OBJECT_retrieve_match(STACK_OF(X509_OBJECT) *h, X509_OBJECT *x)
 int
 X509_STORE_CTX_get1_issuer(X509 **out_issuer, X509_STORE_CTX *ctx, X509 *x)
 {
+	struct x509_object_index_entry *e;
 	X509_NAME *xn;
 	X509_OBJECT *obj, *pobj;
 	X509 *issuer = NULL;
-	int i, idx, ret;
+	uint32_t hash;
+	int ret;
 
 	*out_issuer = NULL;
 
@@ -719,19 +1003,40 @@ X509_STORE_CTX_get1_issuer(X509 **out_issuer, X509_STORE_CTX *ctx, X509 *x)
 	if (ctx->store == NULL)
 		return 0;
 
-	/* Else find index of first cert accepted by 'check_issued' */
-	CRYPTO_w_lock(CRYPTO_LOCK_X509_STORE);
-	idx = X509_OBJECT_idx_by_subject(ctx->store->objs, X509_LU_X509, xn);
-	if (idx != -1) /* should be true as we've had at least one match */ {
-		/* Look through all matching certs for suitable issuer */
-		for (i = idx; i < sk_X509_OBJECT_num(ctx->store->objs); i++) {
-			pobj = sk_X509_OBJECT_value(ctx->store->objs, i);
-			/* See if we've run past the matches */
-			if (pobj->type != X509_LU_X509)
-				break;
+	CRYPTO_r_lock(CRYPTO_LOCK_X509_STORE);
+
+	/*
+	 * Try the certificates whose SKID matches the AKID of x first. If one
+	 * of them is valid now, there's no need to look at the others with
+	 * the same name. Issuers without SKID can still match, so otherwise
+	 * all certificates with the issuer name need to be checked.
+	 */
+	(void)X509_check_purpose(x, -1, 0);
+	if (x->akid != NULL &&
+	    x509_skid_index_hash(x->akid->keyid, &hash)) {
+		for (e = x509_object_index_by_skid(x509_object_index_bucket(
+		    ctx->store->skid_index, hash), hash, x->akid->keyid);
+		    e != NULL; e = x509_object_index_by_skid(e->next, hash,
+		    x->akid->keyid)) {
+			pobj = e->obj;
 			if (X509_NAME_cmp(xn,
-			    X509_get_subject_name(pobj->data.x509)))
-				break;
+			    X509_get_subject_name(pobj->data.x509)) != 0)
+				continue;
+			if (ctx->check_issued(ctx, x, pobj->data.x509) &&
+			    x509_check_cert_time(ctx, pobj->data.x509, -1)) {
+				issuer = pobj->data.x509;
+				goto found;
+			}
+		}
+	}
+
+	/* Else find the first cert accepted by 'check_issued' */
+	if (x509_name_index_hash(xn, &hash)) {
+		for (e = x509_object_index_by_subject(x509_object_index_bucket(
+		    ctx->store->subject_index, hash), hash, X509_LU_X509, xn);
+		    e != NULL; e = x509_object_index_by_subject(e->next, hash,
+		    X509_LU_X509, xn)) {
+			pobj = e->obj;
 			if (ctx->check_issued(ctx, x, pobj->data.x509)) {
 				issuer = pobj->data.x509;
 				/*
@@ -745,6 +1050,8 @@ X509_STORE_CTX_get1_issuer(X509 **out_issuer, X509_STORE_CTX *ctx, X509 *x)
 			}
 		}
 	}
+
+ found:
 	ret = 0;
 	if (issuer != NULL) {
 		if (!X509_up_ref(issuer)) {
@@ -754,7 +1061,7 @@ X509_STORE_CTX_get1_issuer(X509 **out_issuer, X509_STORE_CTX *ctx, X509 *x)
 			ret = 1;
 		}
 	}
-	CRYPTO_w_unlock(CRYPTO_LOCK_X509_STORE);
+	CRYPTO_r_unlock(CRYPTO_LOCK_X509_STORE);
 	return ret;
 }
 
@@ -163,6 +163,47 @@ OPENSSL_ia32_cpuid:
 	or	%r9,%rax
 	ret
 .size	OPENSSL_ia32_cpuid,.-OPENSSL_ia32_cpuid
+
+.globl	OPENSSL_ia32_cpuid_ext
+.type	OPENSSL_ia32_cpuid_ext,\@abi-omnipotent
+.align	16
+OPENSSL_ia32_cpuid_ext:
+	mov	%rbx,%r8		# save %rbx
+
+	xor	%eax,%eax
+	cpuid
+	xor	%r9d,%r9d
+	cmp	\$7,%eax		# structured extended features leaf
+	jb	.Lext_done
+
+	mov	\$7,%eax
+	xor	%ecx,%ecx
+	cpuid
+	mov	%ebx,%r9d
+
+	mov	\$1,%eax
+	cpuid
+	bt	\$IA32CAP_BIT1_OSXSAVE,%ecx	# check OSXSAVE bit
+	jnc	.Lext_clear_avx2
+	xor	%ecx,%ecx		# XCR0
+	.byte	0x0f,0x01,0xd0		# xgetbv
+	mov	%eax,%r10d
+	and	\$6,%eax		# isolate XMM and YMM state support
+	cmp	\$6,%eax
+	jne	.Lext_clear_avx2
+	and	\$0xe0,%r10d		# isolate opmask and ZMM state support
+	cmp	\$0xe0,%r10d
+	je	.Lext_done
+	jmp	.Lext_clear_avx512
+.Lext_clear_avx2:
+	and	\$(~IA32CAP_MASK2_AVX2),%r9d
+.Lext_clear_avx512:
+	and	\$(~IA32CAP_MASK2_AVX512),%r9d
+.Lext_done:
+	mov	%r9d,%eax
+	mov	%r8,%rbx		# restore %rbx
+	ret
+.size	OPENSSL_ia32_cpuid_ext,.-OPENSSL_ia32_cpuid_ext
 ___
 
 print<<___;
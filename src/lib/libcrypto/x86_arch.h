@@ -37,6 +37,11 @@
  * Assembly routines usually address OPENSSL_ia32cap_P as two 32-bit words,
  * hence two sets of bit numbers and masks. OPENSSL_cpu_caps() returns the
  * complete 64-bit word.
+ *
+ * On amd64, OPENSSL_cpu_caps_ext() returns the value of %ebx after
+ * "cpuid 7" (structured extended features), as computed at runtime by
+ * OPENSSL_ia32_cpuid_ext(). The AVX2 and AVX-512 bits are cleared if the
+ * operating system does not save the corresponding register state.
  */
 
 /* bit numbers for the low word */
@@ -61,6 +66,18 @@
 
 #define	IA32CAP_BIT1_AMD_XOP	11
 
+/* bit numbers for the extended features word */
+#define	IA32CAP_BIT2_BMI1	3
+#define	IA32CAP_BIT2_AVX2	5
+#define	IA32CAP_BIT2_BMI2	8
+#define	IA32CAP_BIT2_AVX512F	16
+#define	IA32CAP_BIT2_AVX512DQ	17
+#define	IA32CAP_BIT2_ADX	19
+#define	IA32CAP_BIT2_AVX512IFMA	21
+#define	IA32CAP_BIT2_AVX512CD	28
+#define	IA32CAP_BIT2_AVX512BW	30
+#define	IA32CAP_BIT2_AVX512VL	31
+
 /* bit masks for the low word */
 #define	IA32CAP_MASK0_MMX	(1 << IA32CAP_BIT0_MMX)
 #define	IA32CAP_MASK0_FXSR	(1 << IA32CAP_BIT0_FXSR)
@@ -80,6 +97,24 @@
 
 #define	IA32CAP_MASK1_AMD_XOP	(1 << IA32CAP_BIT1_AMD_XOP)
 
+/* bit masks for the extended features word */
+#define	IA32CAP_MASK2_BMI1	(1U << IA32CAP_BIT2_BMI1)
+#define	IA32CAP_MASK2_AVX2	(1U << IA32CAP_BIT2_AVX2)
+#define	IA32CAP_MASK2_BMI2	(1U << IA32CAP_BIT2_BMI2)
+#define	IA32CAP_MASK2_AVX512F	(1U << IA32CAP_BIT2_AVX512F)
+#define	IA32CAP_MASK2_AVX512DQ	(1U << IA32CAP_BIT2_AVX512DQ)
+#define	IA32CAP_MASK2_ADX	(1U << IA32CAP_BIT2_ADX)
+#define	IA32CAP_MASK2_AVX512IFMA (1U << IA32CAP_BIT2_AVX512IFMA)
+#define	IA32CAP_MASK2_AVX512CD	(1U << IA32CAP_BIT2_AVX512CD)
+#define	IA32CAP_MASK2_AVX512BW	(1U << IA32CAP_BIT2_AVX512BW)
+#define	IA32CAP_MASK2_AVX512VL	(1U << IA32CAP_BIT2_AVX512VL)
+
+/* all the bits which depend upon ZMM state being saved by the OS */
+#define	IA32CAP_MASK2_AVX512	(IA32CAP_MASK2_AVX512F | \
+	IA32CAP_MASK2_AVX512DQ | IA32CAP_MASK2_AVX512IFMA | \
+	IA32CAP_MASK2_AVX512CD | IA32CAP_MASK2_AVX512BW | \
+	IA32CAP_MASK2_AVX512VL)
+
 /* bit masks for OPENSSL_cpu_caps() */
 #define	CPUCAP_MASK_MMX		IA32CAP_MASK0_MMX
 #define	CPUCAP_MASK_FXSR	IA32CAP_MASK0_FXSR
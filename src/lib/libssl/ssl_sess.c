@@ -169,7 +169,7 @@ SSL_get1_session(SSL *ssl)
 	CRYPTO_w_lock(CRYPTO_LOCK_SSL_SESSION);
 	sess = ssl->session;
 	if (sess)
-		sess->references++;
+		CRYPTO_add(&sess->references, 1, CRYPTO_LOCK_SSL_SESSION);
 	CRYPTO_w_unlock(CRYPTO_LOCK_SSL_SESSION);
 
 	return (sess);
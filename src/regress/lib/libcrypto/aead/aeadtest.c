@@ -179,6 +179,24 @@ run_aead_test(const EVP_AEAD *aead, unsigned char bufs[NUM_TYPES][BUF_MAX],
 		goto err;
 	}
 
+	/* The ChaCha20 AEADs leave an in-place buffer alone on failure. */
+	if (aead == EVP_aead_chacha20_poly1305() ||
+	    aead == EVP_aead_xchacha20_poly1305()) {
+		memcpy(out2, out, lengths[CT]);
+		if (EVP_AEAD_CTX_open(ctx, out, &out_len2, lengths[IN],
+		    bufs[NONCE], lengths[NONCE], out, out_len, bufs[AD],
+		    lengths[AD])) {
+			fprintf(stderr, "Decrypted bad data in place on "
+			    "line %u\n", line_no);
+			goto err;
+		}
+		if (memcmp(out, out2, lengths[CT]) != 0) {
+			fprintf(stderr, "Failed open changed the input on "
+			    "line %u\n", line_no);
+			goto err;
+		}
+	}
+
 	ret = 1;
 
  err:
@@ -0,0 +1,244 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+
+#include "bn_lcl.h"
+
+#define N_BIGNUMS	4
+#define N_ITERATIONS	100
+#define N_THREADS	4
+#define N_RSA_OPS	16
+
+/*
+ * BN_CTX_free() now keeps the BN_CTX for reuse, so it must clear the values
+ * of all its bignums, including those already released by BN_CTX_end().
+ */
+static int
+test_ctx_clear(void)
+{
+	BN_CTX *ctx;
+	BIGNUM *bn;
+	int i, failed = 1;
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		errx(1, "BN_CTX_new");
+
+	BN_CTX_start(ctx);
+	BN_CTX_start(ctx);
+	if ((bn = BN_CTX_get(ctx)) == NULL)
+		errx(1, "BN_CTX_get");
+	if (!BN_set_bit(bn, 1023) || !BN_sub_word(bn, 1))
+		errx(1, "BN_set_bit");
+	BN_CTX_end(ctx);
+
+	/* The BN_CTX goes to the cache of this thread, which is empty. */
+	BN_CTX_free(ctx);
+	ctx = NULL;
+	for (i = 0; i < bn->dmax; i++) {
+		if (bn->d[i] != 0) {
+			fprintf(stderr, "FAIL: limb %d not cleared by "
+			    "BN_CTX_free\n", i);
+			goto err;
+		}
+	}
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		errx(1, "BN_CTX_new");
+	BN_CTX_start(ctx);
+	if ((bn = BN_CTX_get(ctx)) == NULL)
+		errx(1, "BN_CTX_get");
+	if (!BN_is_zero(bn)) {
+		fprintf(stderr, "FAIL: reused BN_CTX returned non-zero "
+		    "bignum\n");
+		goto err;
+	}
+	BN_CTX_end(ctx);
+
+	failed = 0;
+
+ err:
+	BN_CTX_free(ctx);
+
+	return failed;
+}
+
+/*
+ * Once the cached BN_CTX has grown to the size of an operation, setting up
+ * a new BN_CTX for every operation must no longer allocate: the BN_CTX and
+ * its pool items come from the cache, and its bignums keep their limbs.
+ */
+static void *
+test_ctx_reuse(void *arg)
+{
+	struct bn_ctx_stats before, after;
+	BIGNUM *a, *b, *m, *r, *t;
+	BN_ULONG *limbs[N_BIGNUMS];
+	BN_CTX *ctx;
+	int *failed = arg;
+	int i, j;
+
+	if ((a = BN_new()) == NULL || (b = BN_new()) == NULL ||
+	    (m = BN_new()) == NULL || (r = BN_new()) == NULL)
+		errx(1, "BN_new");
+	if (!BN_rand(m, 2048, 0, 1) || !BN_rand_range(a, m) ||
+	    !BN_rand_range(b, m))
+		errx(1, "BN_rand");
+
+	for (i = 0; i < N_ITERATIONS + 2; i++) {
+		if (i == 2) {
+			if (!bn_ctx_stats(&before))
+				errx(1, "bn_ctx_stats");
+		}
+		if ((ctx = BN_CTX_new()) == NULL)
+			errx(1, "BN_CTX_new");
+		BN_CTX_start(ctx);
+		for (j = 0; j < N_BIGNUMS; j++) {
+			if ((t = BN_CTX_get(ctx)) == NULL)
+				errx(1, "BN_CTX_get");
+			if (!BN_set_bit(t, 2047))
+				errx(1, "BN_set_bit");
+			if (i > 2 && t->d != limbs[j]) {
+				fprintf(stderr, "FAIL: limbs of bignum %d "
+				    "reallocated\n", j);
+				*failed = 1;
+			}
+			limbs[j] = t->d;
+		}
+		BN_CTX_end(ctx);
+		if (!BN_mod_mul(r, a, b, m, ctx))
+			errx(1, "BN_mod_mul");
+		BN_CTX_free(ctx);
+	}
+	if (!bn_ctx_stats(&after))
+		errx(1, "bn_ctx_stats");
+
+	if (after.ctx_new - before.ctx_new != N_ITERATIONS ||
+	    after.ctx_reused - before.ctx_reused != N_ITERATIONS) {
+		fprintf(stderr, "FAIL: %lu of %lu BN_CTX_new calls reused\n",
+		    after.ctx_reused - before.ctx_reused,
+		    after.ctx_new - before.ctx_new);
+		*failed = 1;
+	}
+	if (after.pool_allocs != before.pool_allocs) {
+		fprintf(stderr, "FAIL: %lu pool allocations\n",
+		    after.pool_allocs - before.pool_allocs);
+		*failed = 1;
+	}
+
+	BN_free(a);
+	BN_free(b);
+	BN_free(m);
+	BN_free(r);
+
+	return NULL;
+}
+
+/*
+ * After a few warm-up operations, RSA private key operations must get all
+ * their BN_CTXs from the cache and must not allocate pool items.
+ */
+static int
+test_rsa_private(void)
+{
+	struct bn_ctx_stats before, after;
+	unsigned char in[32] = { 0 }, *out;
+	RSA *rsa;
+	BIGNUM *e;
+	int i, failed = 0;
+
+	if ((rsa = RSA_new()) == NULL || (e = BN_new()) == NULL)
+		errx(1, "RSA_new");
+	if (!BN_set_word(e, RSA_F4) ||
+	    !RSA_generate_key_ex(rsa, 2048, e, NULL))
+		errx(1, "RSA_generate_key_ex");
+	if ((out = malloc(RSA_size(rsa))) == NULL)
+		errx(1, "malloc");
+
+	for (i = 0; i < N_RSA_OPS + 4; i++) {
+		if (i == 4) {
+			if (!bn_ctx_stats(&before))
+				errx(1, "bn_ctx_stats");
+		}
+		if (RSA_private_encrypt(sizeof(in), in, out, rsa,
+		    RSA_PKCS1_PADDING) != RSA_size(rsa))
+			errx(1, "RSA_private_encrypt");
+	}
+	if (!bn_ctx_stats(&after))
+		errx(1, "bn_ctx_stats");
+
+	if (after.ctx_new == before.ctx_new ||
+	    after.ctx_reused - before.ctx_reused !=
+	    after.ctx_new - before.ctx_new) {
+		fprintf(stderr, "FAIL: RSA: %lu of %lu BN_CTX_new calls "
+		    "reused\n", after.ctx_reused - before.ctx_reused,
+		    after.ctx_new - before.ctx_new);
+		failed = 1;
+	}
+	if (after.pool_allocs != before.pool_allocs) {
+		fprintf(stderr, "FAIL: RSA: %lu pool allocations\n",
+		    after.pool_allocs - before.pool_allocs);
+		failed = 1;
+	}
+
+	free(out);
+	BN_free(e);
+	RSA_free(rsa);
+
+	return failed;
+}
+
+static int
+test_ctx_reuse_threads(void)
+{
+	pthread_t threads[N_THREADS];
+	int failed[N_THREADS] = { 0 };
+	int i, ret = 0;
+
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, test_ctx_reuse,
+		    &failed[i]) != 0)
+			errx(1, "pthread_create");
+	}
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+		ret |= failed[i];
+	}
+
+	return ret;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	failed |= test_ctx_clear();
+	test_ctx_reuse(&failed);
+	failed |= test_ctx_reuse_threads();
+	failed |= test_rsa_private();
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
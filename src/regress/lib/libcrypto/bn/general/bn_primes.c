@@ -15,10 +15,18 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <pthread.h>
+#include <stdlib.h>
+
 #include <openssl/bn.h>
 
 #include "bn_prime.h"
 
+int bn_generate_prime_from(BIGNUM *ret, const BIGNUM *start, int safe,
+    const BIGNUM *step, int nthreads,
+    int (*start_thread)(void (*)(void *), void *, void *), void *arg,
+    BN_GENCB *cb);
+
 static int
 test_bn_is_prime_fasttest(int do_trial_division)
 {
@@ -76,6 +84,164 @@ test_bn_is_prime_fasttest(int do_trial_division)
 	return failed;
 }
 
+static const struct prime_mt_test {
+	const char *start;
+	int safe;
+	BN_ULONG step;
+} prime_mt_tests[] = {
+	{
+		/* 2^511 + 2^510 + 1 */
+		.start = "C0000000000000000000000000000000"
+		    "00000000000000000000000000000000"
+		    "00000000000000000000000000000000"
+		    "00000000000000000000000000000001",
+		.safe = 0,
+		.step = 2,
+	},
+	{
+		/* 11 mod 24, as for DH_GENERATOR_2 */
+		.start = "D0000000000000000000000000000000"
+		    "00000000000000000000000000000013",
+		.safe = 1,
+		.step = 24,
+	},
+};
+
+#define N_PRIME_MT_TESTS \
+    (sizeof(prime_mt_tests) / sizeof(prime_mt_tests[0]))
+
+struct prime_mt_work {
+	void (*work)(void *);
+	void *work_arg;
+};
+
+static void *
+prime_mt_thread(void *arg)
+{
+	struct prime_mt_work *w = arg;
+
+	w->work(w->work_arg);
+	free(w);
+
+	return NULL;
+}
+
+static int
+prime_mt_start_thread(void (*work)(void *), void *work_arg, void *arg)
+{
+	struct prime_mt_work *w;
+	pthread_t thread;
+	int *started = arg;
+
+	if ((w = malloc(sizeof(*w))) == NULL)
+		return 0;
+	w->work = work;
+	w->work_arg = work_arg;
+	if (pthread_create(&thread, NULL, prime_mt_thread, w) != 0) {
+		free(w);
+		return 0;
+	}
+	pthread_detach(thread);
+	(*started)++;
+
+	return 1;
+}
+
+static int
+prime_mt_refuse_thread(void (*work)(void *), void *work_arg, void *arg)
+{
+	return 0;
+}
+
+/*
+ * The result of the threaded search must only depend on the starting point,
+ * not on the number of threads.
+ */
+static int
+test_bn_generate_prime_mt(void)
+{
+	const struct prime_mt_test *pt;
+	BIGNUM *start = NULL, *step = NULL, *want = NULL, *got = NULL;
+	const int nthreads[] = { 2, 4, 8 };
+	size_t i, j;
+	int started = 0;
+	int failed = 1;
+
+	if ((step = BN_new()) == NULL || (want = BN_new()) == NULL ||
+	    (got = BN_new()) == NULL) {
+		fprintf(stderr, "BN_new failed\n");
+		goto err;
+	}
+
+	for (i = 0; i < N_PRIME_MT_TESTS; i++) {
+		pt = &prime_mt_tests[i];
+
+		if (!BN_hex2bn(&start, pt->start) ||
+		    !BN_set_word(step, pt->step)) {
+			fprintf(stderr, "test %zu: setup failed\n", i);
+			goto err;
+		}
+		if (!bn_generate_prime_from(want, start, pt->safe, step, 1,
+		    NULL, NULL, NULL)) {
+			fprintf(stderr, "test %zu: 1 thread failed\n", i);
+			goto err;
+		}
+		if (BN_cmp(want, start) < 0 ||
+		    BN_is_prime_fasttest_ex(want, BN_prime_checks, NULL, 1,
+		    NULL) != 1) {
+			fprintf(stderr, "test %zu: bad prime\n", i);
+			goto err;
+		}
+		for (j = 0; j < sizeof(nthreads) / sizeof(nthreads[0]); j++) {
+			started = 0;
+			if (!bn_generate_prime_from(got, start, pt->safe, step,
+			    nthreads[j], prime_mt_start_thread, &started,
+			    NULL)) {
+				fprintf(stderr, "test %zu: %d threads failed\n",
+				    i, nthreads[j]);
+				goto err;
+			}
+			if (BN_cmp(got, want) != 0) {
+				fprintf(stderr, "test %zu: %d threads gave a "
+				    "different prime\n", i, nthreads[j]);
+				goto err;
+			}
+			if (started != nthreads[j] - 1) {
+				fprintf(stderr, "test %zu: %d threads started "
+				    "%d workers\n", i, nthreads[j], started);
+				goto err;
+			}
+		}
+	}
+
+	if (!BN_generate_prime_mt(got, 512, 0, NULL, NULL, 4,
+	    prime_mt_start_thread, &started, NULL) ||
+	    BN_num_bits(got) != 512 ||
+	    BN_is_prime_fasttest_ex(got, BN_prime_checks, NULL, 1, NULL) != 1) {
+		fprintf(stderr, "BN_generate_prime_mt failed\n");
+		goto err;
+	}
+
+	/* Without threads from the caller, the search runs on its own. */
+	if (!BN_generate_prime_mt(got, 512, 0, NULL, NULL, 4,
+	    prime_mt_refuse_thread, NULL, NULL) ||
+	    BN_num_bits(got) != 512 ||
+	    BN_is_prime_fasttest_ex(got, BN_prime_checks, NULL, 1, NULL) != 1) {
+		fprintf(stderr, "BN_generate_prime_mt without threads "
+		    "failed\n");
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	BN_free(start);
+	BN_free(step);
+	BN_free(want);
+	BN_free(got);
+	return failed;
+}
+
 int
 main(void)
 {
@@ -83,6 +249,7 @@ main(void)
 
 	failed |= test_bn_is_prime_fasttest(0);
 	failed |= test_bn_is_prime_fasttest(1);
+	failed |= test_bn_generate_prime_mt();
 
 	printf("%s\n", failed ? "FAILED" : "SUCCESS");
 
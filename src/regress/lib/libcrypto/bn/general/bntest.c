@@ -84,6 +84,8 @@
 #include <openssl/x509.h>
 #include <openssl/err.h>
 
+#include "bn_lcl.h"
+
 int BN_mod_exp_ct(BIGNUM *r, const BIGNUM *a, const BIGNUM *p,
     const BIGNUM *m, BN_CTX *ctx);
 int BN_mod_exp_nonct(BIGNUM *r, const BIGNUM *a, const BIGNUM *p,
@@ -110,6 +112,7 @@ int test_div_word(BIO *bp);
 int test_div_recp(BIO *bp, BN_CTX *ctx);
 int test_mul(BIO *bp);
 int test_sqr(BIO *bp, BN_CTX *ctx);
+int test_mul_sizes(BIO *bp, BN_CTX *ctx);
 int test_mont(BIO *bp, BN_CTX *ctx);
 int test_mod(BIO *bp, BN_CTX *ctx);
 int test_mod_mul(BIO *bp, BN_CTX *ctx);
@@ -244,6 +247,11 @@ main(int argc, char *argv[])
 		goto err;
 	(void)BIO_flush(out);
 
+	message(out, "BN_mul and BN_sqr at kernel sizes");
+	if (!test_mul_sizes(out, ctx))
+		goto err;
+	(void)BIO_flush(out);
+
 	message(out, "BN_div");
 	if (!test_div(out, ctx))
 		goto err;
@@ -777,6 +785,97 @@ test_mul(BIO *bp)
 	return (rc);
 }
 
+static int
+check_words(const BIGNUM *c, BIGNUM *d, const BN_ULONG *r, int n)
+{
+	if (bn_wexpand(d, n) == NULL)
+		return -1;
+	memcpy(d->d, r, n * sizeof(BN_ULONG));
+	d->top = n;
+	d->neg = 0;
+	bn_correct_top(d);
+
+	return BN_ucmp(c, d) == 0;
+}
+
+/*
+ * Compare BN_mul() and BN_sqr() with bn_mul_normal() and bn_sqr_normal() at
+ * the sizes that have dedicated kernels, and at sizes where the Karatsuba
+ * recursion bottoms out in them. Some operands are all ones, so that carries
+ * run through every word.
+ */
+int
+test_mul_sizes(BIO *bp, BN_CTX *ctx)
+{
+	static const int sizes[] = { 4, 6, 8, 9, 16, 32, 64 };
+	BIGNUM *a = NULL, *b = NULL, *c = NULL, *d = NULL;
+	BN_ULONG r[2 * 64], t[2 * 64];
+	size_t i;
+	int j, n, nb, ok, rc = 0;
+
+	if ((a = BN_new()) == NULL)
+		goto err;
+	if ((b = BN_new()) == NULL)
+		goto err;
+	if ((c = BN_new()) == NULL)
+		goto err;
+	if ((d = BN_new()) == NULL)
+		goto err;
+
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+		n = sizes[i];
+		for (j = 0; j < num1; j++) {
+			/* Every other b is one word shorter. */
+			nb = n - (j & 1);
+
+			if (j < 4) {
+				BN_zero(a);
+				CHECK_GOTO(BN_set_bit(a, n * BN_BITS2));
+				CHECK_GOTO(BN_sub_word(a, 1));
+			} else
+				CHECK_GOTO(BN_bntest_rand(a, n * BN_BITS2, 0, 0));
+			if (j < 2) {
+				BN_zero(b);
+				CHECK_GOTO(BN_set_bit(b, nb * BN_BITS2));
+				CHECK_GOTO(BN_sub_word(b, 1));
+			} else
+				CHECK_GOTO(BN_bntest_rand(b, nb * BN_BITS2, 0, 0));
+			if (a->top != n || b->top != nb) {
+				fprintf(stderr, "Operands have %d and %d words, "
+				    "want %d and %d\n", a->top, b->top, n, nb);
+				goto err;
+			}
+
+			CHECK_GOTO(BN_mul(c, a, b, ctx));
+			bn_mul_normal(r, a->d, n, b->d, nb);
+			CHECK_GOTO((ok = check_words(c, d, r, n + nb)) != -1);
+			if (!ok) {
+				fprintf(stderr, "Multiplication test failed for "
+				    "%d by %d words!\n", n, nb);
+				goto err;
+			}
+
+			CHECK_GOTO(BN_sqr(c, a, ctx));
+			bn_sqr_normal(r, a->d, n, t);
+			CHECK_GOTO((ok = check_words(c, d, r, 2 * n)) != -1);
+			if (!ok) {
+				fprintf(stderr, "Squaring test failed for "
+				    "%d words!\n", n);
+				goto err;
+			}
+		}
+	}
+
+	rc = 1;
+
+ err:
+	BN_free(a);
+	BN_free(b);
+	BN_free(c);
+	BN_free(d);
+	return (rc);
+}
+
 int
 test_sqr(BIO *bp, BN_CTX *ctx)
 {
@@ -2575,12 +2674,14 @@ int
 test_mod_exp_sizes(BIO *bp, BN_CTX *ctx)
 {
 	BN_MONT_CTX *mont_ctx = NULL;
-	BIGNUM *p = NULL, *x = NULL, *y = NULL, *r = NULL, *r2 = NULL;
+	BIGNUM *p = NULL, *m = NULL, *x = NULL, *y = NULL, *r = NULL;
+	BIGNUM *r2 = NULL;
 	int size;
 	int rc = 0;
 
 	BN_CTX_start(ctx);
 	CHECK_GOTO(p = BN_CTX_get(ctx));
+	CHECK_GOTO(m = BN_CTX_get(ctx));
 	CHECK_GOTO(x = BN_CTX_get(ctx));
 	CHECK_GOTO(y = BN_CTX_get(ctx));
 	CHECK_GOTO(r = BN_CTX_get(ctx));
@@ -2615,6 +2716,21 @@ test_mod_exp_sizes(BIO *bp, BN_CTX *ctx)
 		}
 	}
 
+	/* Moduli of RSA CRT sizes, which may take a different code path. */
+	for (size = 1024; size <= 2048; size += 512) {
+		if (!BN_rand(m, size, 0, 1) ||
+		    !BN_rand(x, size, -1, 0) ||
+		    !BN_rand(y, size, -1, 0) ||
+		    !BN_mod_exp_mont_consttime(r, x, y, m, ctx, NULL) ||
+		    !BN_mod_exp(r2, x, y, m, ctx))
+			goto err;
+
+		if (BN_cmp(r, r2) != 0) {
+			printf("Incorrect answer at modulus size %d\n", size);
+			goto err;
+		}
+	}
+
 	rc = 1;
 
  err:
@@ -16,6 +16,7 @@
  */
 
 #include <err.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -456,6 +457,84 @@ crypto_xchacha_20_test(void)
 	return (failed);
 }
 
+/*
+ * Compare bulk encryption, which may use multi-block implementations,
+ * against one block at a time, with counters that cross 2^32 blocks.
+ */
+static int
+crypto_chacha_20_bulk_test(void)
+{
+	static const uint64_t counters[] = {
+		0, 1, 0xfffffff0ULL, 0xfffffffdULL, 0x1fffffff9ULL,
+		0xffffffffffffffe9ULL,
+	};
+	static const size_t lens[] = {
+		64, 255, 256, 511, 512, 1024, 1088, 1500, 2049, 4096,
+	};
+	unsigned char key[32], iv[8];
+	unsigned char *in, *out, *want;
+	size_t i, j, k, n;
+	uint64_t counter;
+	ChaCha_ctx ctx;
+	int failed = 0;
+
+	for (k = 0; k < sizeof(key); k++)
+		key[k] = k * 7;
+	for (k = 0; k < sizeof(iv); k++)
+		iv[k] = k * 13;
+
+	for (i = 0; i < sizeof(counters) / sizeof(*counters); i++) {
+		for (j = 0; j < sizeof(lens) / sizeof(*lens); j++) {
+			if ((in = malloc(lens[j])) == NULL)
+				errx(1, "malloc in");
+			if ((out = malloc(lens[j])) == NULL)
+				errx(1, "malloc out");
+			if ((want = malloc(lens[j])) == NULL)
+				errx(1, "malloc want");
+			for (k = 0; k < lens[j]; k++)
+				in[k] = k;
+
+			counter = counters[i];
+			for (k = 0; k < lens[j]; k += n) {
+				if ((n = lens[j] - k) > 64)
+					n = 64;
+				CRYPTO_chacha_20(want + k, in + k, n, key, iv,
+				    counter++);
+			}
+
+			CRYPTO_chacha_20(out, in, lens[j], key, iv,
+			    counters[i]);
+			if (memcmp(out, want, lens[j]) != 0) {
+				printf("ChaCha bulk CRYPTO_chacha_20 failed "
+				    "(counter %llx, len %zu)\n",
+				    (unsigned long long)counters[i], lens[j]);
+				failed = 1;
+			}
+
+			for (k = 0; k < sizeof(iv); k++)
+				in[k] = counters[i] >> (8 * k);
+			ChaCha_set_key(&ctx, key, 256);
+			ChaCha_set_iv(&ctx, iv, in);
+			for (k = 0; k < sizeof(iv); k++)
+				in[k] = k;
+			ChaCha(&ctx, out, in, 3);
+			ChaCha(&ctx, out + 3, in + 3, lens[j] - 3);
+			if (memcmp(out, want, lens[j]) != 0) {
+				printf("ChaCha bulk ChaCha failed "
+				    "(counter %llx, len %zu)\n",
+				    (unsigned long long)counters[i], lens[j]);
+				failed = 1;
+			}
+
+			free(in);
+			free(out);
+			free(want);
+		}
+	}
+
+	return (failed);
+}
+
 int
 main(int argc, char **argv)
 {
@@ -505,5 +584,8 @@ main(int argc, char **argv)
 	if (crypto_xchacha_20_test() != 0)
 		failed = 1;
 
+	if (crypto_chacha_20_bulk_test() != 0)
+		failed = 1;
+
 	return failed;
 }
@@ -0,0 +1,345 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "curve25519_internal.h"
+
+/* Tests 1 to 3 of RFC 8032, section 7.1. */
+struct ed25519_test {
+	const uint8_t private_key[64];
+	const uint8_t message[2];
+	size_t message_len;
+	const uint8_t signature[64];
+};
+
+static const struct ed25519_test ed25519_tests[] = {
+	{
+		.private_key = {
+			0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60,
+			0xba, 0x84, 0x4a, 0xf4, 0x92, 0xec, 0x2c, 0xc4,
+			0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32, 0x69, 0x19,
+			0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60,
+			0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+			0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+			0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+			0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a,
+		},
+		.message_len = 0,
+		.signature = {
+			0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+			0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+			0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+			0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+			0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+			0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+			0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+			0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b,
+		},
+	},
+	{
+		.private_key = {
+			0x4c, 0xcd, 0x08, 0x9b, 0x28, 0xff, 0x96, 0xda,
+			0x9d, 0xb6, 0xc3, 0x46, 0xec, 0x11, 0x4e, 0x0f,
+			0x5b, 0x8a, 0x31, 0x9f, 0x35, 0xab, 0xa6, 0x24,
+			0xda, 0x8c, 0xf6, 0xed, 0x4f, 0xb8, 0xa6, 0xfb,
+			0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a,
+			0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+			0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c,
+			0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c,
+		},
+		.message = { 0x72 },
+		.message_len = 1,
+		.signature = {
+			0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8,
+			0x72, 0x0e, 0x82, 0x0b, 0x5f, 0x64, 0x25, 0x40,
+			0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50, 0x3f, 0x8f,
+			0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda,
+			0x08, 0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e,
+			0x45, 0x8f, 0x36, 0x13, 0xd0, 0xf1, 0x1d, 0x8c,
+			0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a, 0xee,
+			0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00,
+		},
+	},
+	{
+		.private_key = {
+			0xc5, 0xaa, 0x8d, 0xf4, 0x3f, 0x9f, 0x83, 0x7b,
+			0xed, 0xb7, 0x44, 0x2f, 0x31, 0xdc, 0xb7, 0xb1,
+			0x66, 0xd3, 0x85, 0x35, 0x07, 0x6f, 0x09, 0x4b,
+			0x85, 0xce, 0x3a, 0x2e, 0x0b, 0x44, 0x58, 0xf7,
+			0xfc, 0x51, 0xcd, 0x8e, 0x62, 0x18, 0xa1, 0xa3,
+			0x8d, 0xa4, 0x7e, 0xd0, 0x02, 0x30, 0xf0, 0x58,
+			0x08, 0x16, 0xed, 0x13, 0xba, 0x33, 0x03, 0xac,
+			0x5d, 0xeb, 0x91, 0x15, 0x48, 0x90, 0x80, 0x25,
+		},
+		.message = { 0xaf, 0x82 },
+		.message_len = 2,
+		.signature = {
+			0x62, 0x91, 0xd6, 0x57, 0xde, 0xec, 0x24, 0x02,
+			0x48, 0x27, 0xe6, 0x9c, 0x3a, 0xbe, 0x01, 0xa3,
+			0x0c, 0xe5, 0x48, 0xa2, 0x84, 0x74, 0x3a, 0x44,
+			0x5e, 0x36, 0x80, 0xd7, 0xdb, 0x5a, 0xc3, 0xac,
+			0x18, 0xff, 0x9b, 0x53, 0x8d, 0x16, 0xf2, 0x90,
+			0xae, 0x67, 0xf7, 0x60, 0x98, 0x4d, 0xc6, 0x59,
+			0x4a, 0x7c, 0x15, 0xe9, 0x71, 0x6e, 0xd2, 0x8d,
+			0xc0, 0x27, 0xbe, 0xce, 0xea, 0x1e, 0xc4, 0x0a,
+		},
+	},
+};
+
+#define N_ED25519_TESTS (sizeof(ed25519_tests) / sizeof(ed25519_tests[0]))
+
+#define N_KEYS		8
+#define N_MESSAGES	150	/* more than two batches of 64 */
+#define MESSAGE_LEN	100
+
+static uint8_t private_keys[N_KEYS][64];
+static uint8_t public_keys[N_KEYS][32];
+static uint8_t messages[N_MESSAGES][MESSAGE_LEN];
+static uint8_t signatures[N_MESSAGES][64];
+
+static const uint8_t *message_ptrs[N_MESSAGES];
+static size_t message_lens[N_MESSAGES];
+static const uint8_t *signature_ptrs[N_MESSAGES];
+static const uint8_t *public_key_ptrs[N_MESSAGES];
+
+static int
+test_rfc8032(void)
+{
+	const struct ed25519_test *t;
+	uint8_t sig[64];
+	size_t i;
+	int failed = 0;
+
+	for (i = 0; i < N_ED25519_TESTS; i++) {
+		t = &ed25519_tests[i];
+		if (!ED25519_sign(sig, t->message, t->message_len,
+		    t->private_key)) {
+			fprintf(stderr, "FAIL: test %zu: ED25519_sign\n", i + 1);
+			failed = 1;
+			continue;
+		}
+		if (memcmp(sig, t->signature, sizeof(sig)) != 0) {
+			fprintf(stderr, "FAIL: test %zu: signature mismatch\n",
+			    i + 1);
+			failed = 1;
+		}
+		if (!ED25519_verify(t->message, t->message_len, t->signature,
+		    t->private_key + 32)) {
+			fprintf(stderr, "FAIL: test %zu: signature did not "
+			    "verify\n", i + 1);
+			failed = 1;
+		}
+		memcpy(sig, t->signature, sizeof(sig));
+		sig[i] ^= 1;
+		if (ED25519_verify(t->message, t->message_len, sig,
+		    t->private_key + 32)) {
+			fprintf(stderr, "FAIL: test %zu: bad signature "
+			    "verified\n", i + 1);
+			failed = 1;
+		}
+	}
+
+	return failed;
+}
+
+static void
+make_signatures(void)
+{
+	int i, k;
+
+	for (k = 0; k < N_KEYS; k++)
+		ED25519_keypair(public_keys[k], private_keys[k]);
+	arc4random_buf(messages, sizeof(messages));
+	for (i = 0; i < N_MESSAGES; i++) {
+		k = i % N_KEYS;
+		message_lens[i] = i % MESSAGE_LEN;
+		if (!ED25519_sign(signatures[i], messages[i], message_lens[i],
+		    private_keys[k]))
+			errx(1, "ED25519_sign");
+		message_ptrs[i] = messages[i];
+		signature_ptrs[i] = signatures[i];
+		public_key_ptrs[i] = public_keys[k];
+	}
+}
+
+/*
+ * Signing with an expanded key must give the same signature as
+ * ED25519_sign, and both verify functions must agree with ED25519_verify.
+ */
+static int
+test_expanded_key(void)
+{
+	ED25519_EXPANDED_KEY *keys[N_KEYS], *public[N_KEYS];
+	uint8_t sig[64];
+	int i, k, want, failed = 0;
+
+	for (k = 0; k < N_KEYS; k++) {
+		if ((keys[k] = ED25519_expanded_key_from_private(
+		    private_keys[k])) == NULL)
+			errx(1, "ED25519_expanded_key_from_private");
+		if ((public[k] = ED25519_expanded_key_from_public(
+		    public_keys[k])) == NULL)
+			errx(1, "ED25519_expanded_key_from_public");
+	}
+
+	for (i = 0; i < N_MESSAGES; i++) {
+		k = i % N_KEYS;
+		if (!ED25519_sign_with_expanded_key(sig, messages[i],
+		    message_lens[i], keys[k])) {
+			fprintf(stderr, "FAIL: ED25519_sign_with_expanded_key\n");
+			failed = 1;
+			continue;
+		}
+		if (memcmp(sig, signatures[i], sizeof(sig)) != 0) {
+			fprintf(stderr, "FAIL: message %d: signature differs "
+			    "from ED25519_sign\n", i);
+			failed = 1;
+		}
+		if (ED25519_sign_with_expanded_key(sig, messages[i],
+		    message_lens[i], public[k])) {
+			fprintf(stderr, "FAIL: signed with a public key\n");
+			failed = 1;
+		}
+
+		/* Every other signature is broken. */
+		memcpy(sig, signatures[i], sizeof(sig));
+		if (i & 1)
+			sig[i % sizeof(sig)] ^= 0x10;
+		want = ED25519_verify(messages[i], message_lens[i], sig,
+		    public_keys[k]);
+		if (want != !(i & 1)) {
+			fprintf(stderr, "FAIL: message %d: ED25519_verify "
+			    "returned %d\n", i, want);
+			failed = 1;
+		}
+		if (ED25519_verify_with_expanded_key(messages[i],
+		    message_lens[i], sig, keys[k]) != want ||
+		    ED25519_verify_with_expanded_key(messages[i],
+		    message_lens[i], sig, public[k]) != want) {
+			fprintf(stderr, "FAIL: message %d: expanded key "
+			    "verification differs from ED25519_verify\n", i);
+			failed = 1;
+		}
+	}
+
+	for (k = 0; k < N_KEYS; k++) {
+		ED25519_expanded_key_free(keys[k]);
+		ED25519_expanded_key_free(public[k]);
+	}
+
+	return failed;
+}
+
+/*
+ * Check a batch, and that valid[] agrees with ED25519_verify for every
+ * signature.
+ */
+static int
+check_batch(const char *name, size_t num, int want)
+{
+	int valid[N_MESSAGES];
+	size_t i;
+	int ret, failed = 0;
+
+	memset(valid, 0xff, sizeof(valid));
+	ret = ED25519_verify_batch(message_ptrs, message_lens, signature_ptrs,
+	    public_key_ptrs, num, valid);
+	if (ret != want) {
+		fprintf(stderr, "FAIL: %s: ED25519_verify_batch returned %d\n",
+		    name, ret);
+		failed = 1;
+	}
+	for (i = 0; i < num; i++) {
+		if (valid[i] != ED25519_verify(message_ptrs[i],
+		    message_lens[i], signature_ptrs[i], public_key_ptrs[i])) {
+			fprintf(stderr, "FAIL: %s: valid[%zu] is %d\n", name,
+			    i, valid[i]);
+			failed = 1;
+		}
+	}
+	if (ED25519_verify_batch(message_ptrs, message_lens, signature_ptrs,
+	    public_key_ptrs, num, NULL) != want) {
+		fprintf(stderr, "FAIL: %s: result differs without valid[]\n",
+		    name);
+		failed = 1;
+	}
+
+	return failed;
+}
+
+static int
+test_batch(void)
+{
+	static const uint8_t zero[32];
+	uint8_t sig[64];
+	int failed = 0;
+
+	failed |= check_batch("empty batch", 0, 1);
+	failed |= check_batch("one signature", 1, 1);
+	failed |= check_batch("all valid", N_MESSAGES, 1);
+
+	/* A changed message, in the second batch of 64. */
+	messages[110][0] ^= 1;
+	failed |= check_batch("changed message", N_MESSAGES, 0);
+	messages[110][0] ^= 1;
+
+	/* A changed R, in the last and partial batch. */
+	signatures[140][3] ^= 1;
+	failed |= check_batch("changed R", N_MESSAGES, 0);
+	signatures[140][3] ^= 1;
+
+	/* A changed s, and one with the high bits of s set. */
+	signatures[5][40] ^= 1;
+	signatures[70][63] |= 0xe0;
+	failed |= check_batch("changed s", N_MESSAGES, 0);
+	signatures[5][40] ^= 1;
+	signatures[70][63] &= 0x1f;
+
+	/* The wrong public key, a small order one and a small order R. */
+	public_key_ptrs[10] = public_keys[(10 + 1) % N_KEYS];
+	public_key_ptrs[20] = zero;
+	memcpy(sig, signatures[30], sizeof(sig));
+	memset(signatures[30], 0, 32);
+	failed |= check_batch("wrong public key", N_MESSAGES, 0);
+	public_key_ptrs[10] = public_keys[10 % N_KEYS];
+	public_key_ptrs[20] = public_keys[20 % N_KEYS];
+	memcpy(signatures[30], sig, sizeof(sig));
+
+	failed |= check_batch("all valid again", N_MESSAGES, 1);
+
+	return failed;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	make_signatures();
+
+	failed |= test_rfc8032();
+	failed |= test_expanded_key();
+	failed |= test_batch();
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
@@ -128,11 +128,54 @@ x25519_small_order_test(void)
 	return 1;
 }
 
+/*
+ * RFC 7748 section 5: the top bit of the u-coordinate is ignored and
+ * values of u in [p, 2^255) must be accepted and reduced modulo p.
+ */
+static int
+x25519_noncanonical_test(void)
+{
+	/* p + 9 = 2^255 - 10 */
+	static const uint8_t kPointPPlus9[32] = {
+		0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f,
+	};
+	uint8_t scalar[32], point[32], out1[32], out2[32];
+	unsigned i;
+
+	memset(scalar, 0x5a, sizeof(scalar));
+
+	memset(point, 0, sizeof(point));
+	point[0] = 9;
+	X25519(out1, scalar, point);
+	X25519(out2, scalar, kPointPPlus9);
+	if (memcmp(out1, out2, sizeof(out1)) != 0) {
+		fprintf(stderr, "X25519 did not reduce u = p + 9.\n");
+		return 0;
+	}
+
+	for (i = 0; i < 32; i++)
+		point[i] = 0x11 * i;
+	point[31] &= 0x7f;
+	X25519(out1, scalar, point);
+	point[31] |= 0x80;
+	X25519(out2, scalar, point);
+	if (memcmp(out1, out2, sizeof(out1)) != 0) {
+		fprintf(stderr, "X25519 did not ignore the top bit of u.\n");
+		return 0;
+	}
+
+	return 1;
+}
+
 int
 main(int argc, char **argv) {
 	if (!x25519_test() ||
 	    !x25519_iterated_test() ||
-	    !x25519_small_order_test())
+	    !x25519_small_order_test() ||
+	    !x25519_noncanonical_test())
 		return 1;
 
 	printf("PASS\n");
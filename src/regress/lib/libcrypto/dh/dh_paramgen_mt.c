@@ -0,0 +1,126 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openssl/bn.h>
+#include <openssl/dh.h>
+
+/*
+ * Generate parameters with DH_generate_parameters_mt() on threads started
+ * by the test and check that DH_check() accepts them.
+ */
+
+#define N_THREADS	4
+
+struct paramgen_work {
+	void (*work)(void *);
+	void *work_arg;
+};
+
+static void *
+paramgen_thread(void *arg)
+{
+	struct paramgen_work *w = arg;
+
+	w->work(w->work_arg);
+	free(w);
+
+	return NULL;
+}
+
+static int
+paramgen_start_thread(void (*work)(void *), void *work_arg, void *arg)
+{
+	struct paramgen_work *w;
+	pthread_t thread;
+	int *started = arg;
+
+	if ((w = malloc(sizeof(*w))) == NULL)
+		return 0;
+	w->work = work;
+	w->work_arg = work_arg;
+	if (pthread_create(&thread, NULL, paramgen_thread, w) != 0) {
+		free(w);
+		return 0;
+	}
+	pthread_detach(thread);
+	(*started)++;
+
+	return 1;
+}
+
+static int
+test_paramgen(int bits, int generator, int nthreads)
+{
+	DH *dh = NULL;
+	int codes;
+	int started = 0;
+	int failed = 1;
+
+	if ((dh = DH_new()) == NULL)
+		errx(1, "DH_new");
+
+	if (!DH_generate_parameters_mt(dh, bits, generator, nthreads,
+	    paramgen_start_thread, &started, NULL)) {
+		fprintf(stderr, "FAIL: %d bits, g = %d, %d threads: "
+		    "DH_generate_parameters_mt failed\n", bits, generator,
+		    nthreads);
+		goto err;
+	}
+	if (BN_num_bits(DH_get0_p(dh)) != bits) {
+		fprintf(stderr, "FAIL: %d bits, g = %d, %d threads: got %d "
+		    "bits\n", bits, generator, nthreads,
+		    BN_num_bits(DH_get0_p(dh)));
+		goto err;
+	}
+	if (!BN_is_word(DH_get0_g(dh), generator)) {
+		fprintf(stderr, "FAIL: %d bits, g = %d, %d threads: wrong "
+		    "generator\n", bits, generator, nthreads);
+		goto err;
+	}
+	if (!DH_check(dh, &codes) || codes != 0) {
+		fprintf(stderr, "FAIL: %d bits, g = %d, %d threads: DH_check "
+		    "codes %x\n", bits, generator, nthreads, codes);
+		goto err;
+	}
+	if (started != nthreads - 1) {
+		fprintf(stderr, "FAIL: %d bits, g = %d, %d threads: %d workers "
+		    "started\n", bits, generator, nthreads, started);
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	DH_free(dh);
+
+	return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int failed = 0;
+
+	failed |= test_paramgen(512, DH_GENERATOR_2, 2);
+	failed |= test_paramgen(512, DH_GENERATOR_2, N_THREADS);
+	failed |= test_paramgen(512, DH_GENERATOR_5, N_THREADS);
+
+	return failed;
+}
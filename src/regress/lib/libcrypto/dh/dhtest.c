@@ -92,6 +92,80 @@ cb(int p, int n, BN_GENCB *arg)
 	return 1;
 }
 
+/*
+ * Check DH_generate_key() against BN_mod_exp() for the RFC 3526 groups,
+ * some of which have precomputed tables, with full and short exponents.
+ */
+static int
+rfc3526_groups_test(void)
+{
+	BIGNUM *(*get_prime[])(BIGNUM *) = {
+		BN_get_rfc3526_prime_1536,
+		BN_get_rfc3526_prime_2048,
+		BN_get_rfc3526_prime_3072,
+		BN_get_rfc3526_prime_4096,
+	};
+	long lengths[] = { 0, 1, 64, 225 };
+	BN_CTX *ctx = NULL;
+	BIGNUM *p = NULL, *g = NULL, *want = NULL;
+	DH *dh = NULL;
+	size_t i, j;
+	int k;
+	int failed = 1;
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		goto err;
+	if ((want = BN_new()) == NULL)
+		goto err;
+
+	for (i = 0; i < sizeof(get_prime) / sizeof(get_prime[0]); i++) {
+		for (j = 0; j < sizeof(lengths) / sizeof(lengths[0]); j++) {
+			for (k = 0; k < 4; k++) {
+				DH_free(dh);
+				if ((dh = DH_new()) == NULL)
+					goto err;
+				if ((p = get_prime[i](NULL)) == NULL)
+					goto err;
+				if ((g = BN_new()) == NULL)
+					goto err;
+				if (!BN_set_word(g, 2))
+					goto err;
+				if (!DH_set0_pqg(dh, p, NULL, g))
+					goto err;
+				p = g = NULL;
+				if (!DH_set_length(dh, lengths[j]))
+					goto err;
+				if (k == 3)
+					DH_clear_flags(dh, DH_FLAG_CACHE_MONT_P);
+
+				if (!DH_generate_key(dh))
+					goto err;
+				if (!BN_mod_exp(want, DH_get0_g(dh),
+				    DH_get0_priv_key(dh), DH_get0_p(dh), ctx))
+					goto err;
+				if (BN_cmp(want, DH_get0_pub_key(dh)) != 0) {
+					fprintf(stderr, "FAIL: %d-bit group, "
+					    "length %ld: wrong public key\n",
+					    BN_num_bits(DH_get0_p(dh)),
+					    lengths[j]);
+					goto err;
+				}
+			}
+		}
+	}
+
+	failed = 0;
+
+ err:
+	BN_CTX_free(ctx);
+	BN_free(p);
+	BN_free(g);
+	BN_free(want);
+	DH_free(dh);
+
+	return failed;
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -159,6 +233,9 @@ main(int argc, char *argv[])
 		goto err;
 	}
 
+	if (rfc3526_groups_test())
+		goto err;
+
 	ret = 0;
 err:
 	ERR_print_errors_fp(stderr);
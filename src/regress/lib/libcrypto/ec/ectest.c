@@ -1229,6 +1229,225 @@ internal_curve_test(void)
 	return;
 }
 
+/*
+ * Compare point multiplication on a named curve, which may use a specialised
+ * method, against the same curve built from its explicit parameters.
+ */
+static void
+named_curve_mul_test(int nid)
+{
+	EC_GROUP *named = NULL, *explicit = NULL;
+	EC_POINT *P = NULL, *Q = NULL, *R = NULL, *S = NULL;
+	BIGNUM *p, *a, *b, *x, *y, *order, *k, *m;
+	BN_CTX *ctx;
+	int i;
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		ABORT;
+	BN_CTX_start(ctx);
+	if ((p = BN_CTX_get(ctx)) == NULL || (a = BN_CTX_get(ctx)) == NULL ||
+	    (b = BN_CTX_get(ctx)) == NULL || (x = BN_CTX_get(ctx)) == NULL ||
+	    (y = BN_CTX_get(ctx)) == NULL ||
+	    (order = BN_CTX_get(ctx)) == NULL ||
+	    (k = BN_CTX_get(ctx)) == NULL || (m = BN_CTX_get(ctx)) == NULL)
+		ABORT;
+
+	fprintf(stdout, "%s named vs explicit curve multiplication ... ",
+	    OBJ_nid2sn(nid));
+	fflush(stdout);
+
+	if ((named = EC_GROUP_new_by_curve_name(nid)) == NULL)
+		ABORT;
+	if (!EC_GROUP_get_curve(named, p, a, b, ctx))
+		ABORT;
+	if (!EC_GROUP_get_order(named, order, ctx))
+		ABORT;
+	if ((explicit = EC_GROUP_new_curve_GFp(p, a, b, ctx)) == NULL)
+		ABORT;
+	if ((P = EC_POINT_new(explicit)) == NULL)
+		ABORT;
+	if (!EC_POINT_get_affine_coordinates(named,
+	    EC_GROUP_get0_generator(named), x, y, ctx))
+		ABORT;
+	if (!EC_POINT_set_affine_coordinates(explicit, P, x, y, ctx))
+		ABORT;
+	if (!EC_GROUP_set_generator(explicit, P, order, BN_value_one()))
+		ABORT;
+	EC_POINT_free(P);
+
+	if ((P = EC_POINT_new(named)) == NULL ||
+	    (Q = EC_POINT_new(named)) == NULL ||
+	    (R = EC_POINT_new(explicit)) == NULL ||
+	    (S = EC_POINT_new(explicit)) == NULL)
+		ABORT;
+
+	for (i = 0; i < 16; i++) {
+		if (!BN_rand_range(k, order) || !BN_rand_range(m, order))
+			ABORT;
+
+		/* fixed point multiplication */
+		if (!EC_POINT_mul(named, P, k, NULL, NULL, ctx))
+			ABORT;
+		if (!EC_POINT_mul(explicit, R, k, NULL, NULL, ctx))
+			ABORT;
+		if (!EC_POINT_get_affine_coordinates(explicit, R, x, y, ctx))
+			ABORT;
+		if (!EC_POINT_set_affine_coordinates(named, Q, x, y, ctx))
+			ABORT;
+		if (EC_POINT_cmp(named, P, Q, ctx) != 0)
+			ABORT;
+
+		/* random point multiplication, R = k * G */
+		if (!EC_POINT_mul(named, Q, NULL, P, m, ctx))
+			ABORT;
+		if (!EC_POINT_mul(explicit, S, NULL, R, m, ctx))
+			ABORT;
+		if (!EC_POINT_get_affine_coordinates(explicit, S, x, y, ctx))
+			ABORT;
+		if (!EC_POINT_set_affine_coordinates(named, P, x, y, ctx))
+			ABORT;
+		if (EC_POINT_cmp(named, P, Q, ctx) != 0)
+			ABORT;
+
+		/* simultaneous multiplication with the point S = m * k * G */
+		if (!EC_POINT_mul(named, Q, m, P, k, ctx))
+			ABORT;
+		if (!EC_POINT_mul(explicit, R, m, S, k, ctx))
+			ABORT;
+		if (!EC_POINT_get_affine_coordinates(explicit, R, x, y, ctx))
+			ABORT;
+		if (!EC_POINT_set_affine_coordinates(named, P, x, y, ctx))
+			ABORT;
+		if (EC_POINT_cmp(named, P, Q, ctx) != 0)
+			ABORT;
+	}
+
+	fprintf(stdout, "ok\n");
+	group_order_tests(named);
+
+	EC_POINT_free(P);
+	EC_POINT_free(Q);
+	EC_POINT_free(R);
+	EC_POINT_free(S);
+	EC_GROUP_free(named);
+	EC_GROUP_free(explicit);
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+}
+
+/*
+ * Compare generator multiplication, which uses the precomputed comb for
+ * P-384 and P-521, against multiplication of the generator as an arbitrary
+ * point, for each of the generic prime field methods.
+ */
+static void
+generator_comb_test(int nid)
+{
+	const EC_METHOD *(*meths[])(void) = {
+		EC_GFp_simple_method,
+		EC_GFp_mont_method,
+		EC_GFp_nist_method,
+	};
+	EC_GROUP *named = NULL, *group = NULL;
+	EC_POINT *G = NULL, *P = NULL, *Q = NULL;
+	BIGNUM *p, *a, *b, *x, *y, *order, *k;
+	BN_CTX *ctx;
+	size_t i;
+	int j;
+
+	if ((ctx = BN_CTX_new()) == NULL)
+		ABORT;
+	BN_CTX_start(ctx);
+	if ((p = BN_CTX_get(ctx)) == NULL || (a = BN_CTX_get(ctx)) == NULL ||
+	    (b = BN_CTX_get(ctx)) == NULL || (x = BN_CTX_get(ctx)) == NULL ||
+	    (y = BN_CTX_get(ctx)) == NULL ||
+	    (order = BN_CTX_get(ctx)) == NULL || (k = BN_CTX_get(ctx)) == NULL)
+		ABORT;
+
+	fprintf(stdout, "%s generator multiplication ... ", OBJ_nid2sn(nid));
+	fflush(stdout);
+
+	if ((named = EC_GROUP_new_by_curve_name(nid)) == NULL)
+		ABORT;
+	if (!EC_GROUP_get_curve(named, p, a, b, ctx))
+		ABORT;
+	if (!EC_GROUP_get_order(named, order, ctx))
+		ABORT;
+	if (!EC_POINT_get_affine_coordinates(named,
+	    EC_GROUP_get0_generator(named), x, y, ctx))
+		ABORT;
+
+	for (i = 0; i < sizeof(meths) / sizeof(meths[0]); i++) {
+		if ((group = EC_GROUP_new(meths[i]())) == NULL)
+			ABORT;
+		if (!EC_GROUP_set_curve(group, p, a, b, ctx))
+			ABORT;
+		if ((G = EC_POINT_new(group)) == NULL ||
+		    (P = EC_POINT_new(group)) == NULL ||
+		    (Q = EC_POINT_new(group)) == NULL)
+			ABORT;
+		if (!EC_POINT_set_affine_coordinates(group, G, x, y, ctx))
+			ABORT;
+		if (!EC_GROUP_set_generator(group, G, order, BN_value_one()))
+			ABORT;
+
+		for (j = 0; j < 24; j++) {
+			switch (j) {
+			case 0:
+				BN_zero(k);
+				break;
+			case 1:
+				if (!BN_one(k))
+					ABORT;
+				break;
+			case 2:
+				if (!BN_sub(k, order, BN_value_one()))
+					ABORT;
+				break;
+			case 3:
+				if (!BN_copy(k, order))
+					ABORT;
+				break;
+			case 4:
+				if (!BN_add(k, order, BN_value_one()))
+					ABORT;
+				break;
+			case 5:
+				if (!BN_rand(k, BN_num_bits(order) + 64, 0, 0))
+					ABORT;
+				break;
+			case 6:
+				if (!BN_rand_range(k, order))
+					ABORT;
+				BN_set_negative(k, 1);
+				break;
+			default:
+				if (!BN_rand_range(k, order))
+					ABORT;
+				break;
+			}
+
+			if (!EC_POINT_mul(group, P, k, NULL, NULL, ctx))
+				ABORT;
+			if (!EC_POINT_mul(group, Q, NULL, G, k, ctx))
+				ABORT;
+			if (EC_POINT_cmp(group, P, Q, ctx) != 0)
+				ABORT;
+		}
+
+		EC_POINT_free(G);
+		EC_POINT_free(P);
+		EC_POINT_free(Q);
+		EC_GROUP_free(group);
+	}
+
+	fprintf(stdout, "ok\n");
+
+	EC_GROUP_free(named);
+	BN_CTX_end(ctx);
+	BN_CTX_free(ctx);
+}
+
 #ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
 /* nistp_test_params contains magic numbers for testing our optimized
  * implementations of several NIST curves with characteristic > 3. */
@@ -1443,6 +1662,10 @@ main(int argc, char *argv[])
 #endif
 	/* test the internal curves */
 	internal_curve_test();
+	named_curve_mul_test(NID_X9_62_prime256v1);
+	named_curve_mul_test(NID_secp384r1);
+	generator_comb_test(NID_secp384r1);
+	generator_comb_test(NID_secp521r1);
 
 #ifndef OPENSSL_NO_ENGINE
 	ENGINE_cleanup();
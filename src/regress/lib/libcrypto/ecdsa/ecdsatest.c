@@ -261,6 +261,19 @@ test_builtin(void)
 		printf(".");
 		fflush(stdout);
 
+		/*
+		 * The remaining checks use precomputed multiples of the
+		 * public keys.
+		 */
+		if (!EC_KEY_precompute_public_mult(eckey, NULL) ||
+		    !EC_KEY_precompute_public_mult(wrong_eckey, NULL))
+			goto err;
+		if (ECDSA_verify(0, digest, 20, signature, sig_len, eckey) != 1)
+			goto err;
+
+		printf(".");
+		fflush(stdout);
+
 		/* verify signature with the wrong key */
 		if (ECDSA_verify(0, digest, 20, signature, sig_len,
 		    wrong_eckey) == 1)
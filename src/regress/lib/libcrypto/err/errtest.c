@@ -0,0 +1,205 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/err.h>
+
+static int
+check_string(const char *name, const char *got, const char *want)
+{
+	if (got == NULL && want == NULL)
+		return 0;
+	if (got != NULL && want != NULL && strcmp(got, want) == 0)
+		return 0;
+
+	fprintf(stderr, "FAIL: %s: got \"%s\", want \"%s\"\n", name,
+	    got != NULL ? got : "(null)", want != NULL ? want : "(null)");
+	return 1;
+}
+
+/* The strings of libcrypto itself come from the built-in table. */
+static int
+test_builtin_strings(void)
+{
+	char buf[256], want[256];
+	int failed = 0;
+
+	ERR_load_crypto_strings();
+
+	failed |= check_string("BN div by zero",
+	    ERR_error_string(ERR_PACK(ERR_LIB_BN, 0xfff, BN_R_DIV_BY_ZERO),
+	    NULL), "error:03FFF067:bignum routines:CRYPTO_internal:"
+	    "div by zero");
+	failed |= check_string("EC invalid form",
+	    ERR_error_string(ERR_PACK(ERR_LIB_EC, 0xfff, EC_R_INVALID_FORM),
+	    buf), "error:10FFF068:elliptic curve routines:CRYPTO_internal:"
+	    "invalid form");
+	failed |= check_string("RSA malloc failure",
+	    ERR_error_string(ERR_PACK(ERR_LIB_RSA, 0xfff,
+	    ERR_R_MALLOC_FAILURE), buf), "error:04FFF041:rsa routines:"
+	    "CRYPTO_internal:malloc failure");
+	failed |= check_string("RSA unknown reason",
+	    ERR_error_string(ERR_PACK(ERR_LIB_RSA, 0xfff, 1000), buf),
+	    "error:04FFF3E8:rsa routines:CRYPTO_internal:reason(1000)");
+
+	snprintf(want, sizeof(want), "error:02FFF002:system library:"
+	    "func(4095):%s", strerror(ENOENT));
+	failed |= check_string("SYS ENOENT",
+	    ERR_error_string(ERR_PACK(ERR_LIB_SYS, 0xfff, ENOENT), buf),
+	    want);
+
+	failed |= check_string("BN library",
+	    ERR_lib_error_string(ERR_PACK(ERR_LIB_BN, 0, 0)),
+	    "bignum routines");
+	failed |= check_string("EC reason",
+	    ERR_reason_error_string(ERR_PACK(ERR_LIB_EC, 0,
+	    EC_R_INVALID_FORM)), "invalid form");
+
+	return failed;
+}
+
+/* Unloading a built-in string hides it until it is loaded again. */
+static int
+test_builtin_unload(void)
+{
+	ERR_STRING_DATA reasons[] = {
+		{ ERR_PACK(0, 0, BN_R_DIV_BY_ZERO), "div by zero" },
+		{ 0, NULL },
+	};
+	unsigned long e = ERR_PACK(ERR_LIB_BN, 0, BN_R_DIV_BY_ZERO);
+	int failed = 0;
+
+	ERR_unload_strings(ERR_LIB_BN, reasons);
+	failed |= check_string("BN unloaded", ERR_reason_error_string(e),
+	    NULL);
+
+	ERR_load_strings(ERR_LIB_BN, reasons);
+	failed |= check_string("BN reloaded", ERR_reason_error_string(e),
+	    "div by zero");
+
+	return failed;
+}
+
+/* A different string for a built-in code replaces it until unloaded. */
+static int
+test_builtin_override(void)
+{
+	ERR_STRING_DATA builtin[] = {
+		{ ERR_PACK(0, 0, BN_R_DIV_BY_ZERO), "div by zero" },
+		{ 0, NULL },
+	};
+	ERR_STRING_DATA override[] = {
+		{ ERR_PACK(0, 0, BN_R_DIV_BY_ZERO), "divided by zero" },
+		{ 0, NULL },
+	};
+	unsigned long e = ERR_PACK(ERR_LIB_BN, 0, BN_R_DIV_BY_ZERO);
+	int failed = 0;
+
+	ERR_load_strings(ERR_LIB_BN, override);
+	failed |= check_string("BN override", ERR_reason_error_string(e),
+	    "divided by zero");
+	failed |= check_string("BN override error string",
+	    ERR_error_string(ERR_PACK(ERR_LIB_BN, 0xfff, BN_R_DIV_BY_ZERO),
+	    NULL), "error:03FFF067:bignum routines:CRYPTO_internal:"
+	    "divided by zero");
+
+	ERR_load_strings(ERR_LIB_BN, builtin);
+	failed |= check_string("BN builtin again", ERR_reason_error_string(e),
+	    "div by zero");
+
+	ERR_load_strings(ERR_LIB_BN, override);
+	ERR_unload_strings(ERR_LIB_BN, override);
+	failed |= check_string("BN override unloaded",
+	    ERR_reason_error_string(e), NULL);
+
+	ERR_load_strings(ERR_LIB_BN, builtin);
+	failed |= check_string("BN builtin restored",
+	    ERR_reason_error_string(e), "div by zero");
+
+	return failed;
+}
+
+/* Strings of a library that is not part of libcrypto. */
+static int
+test_library_strings(void)
+{
+	ERR_STRING_DATA lib_str[] = {
+		{ 0, "test library" },
+		{ 0, NULL },
+	};
+	ERR_STRING_DATA reason_str[] = {
+		{ ERR_PACK(0, 0, 100), "first reason" },
+		{ ERR_PACK(0, 0, 101), "second reason" },
+		{ 0, NULL },
+	};
+	char want[256];
+	int lib, i, failed = 0;
+
+	lib = ERR_get_next_error_library();
+	lib_str[0].error = ERR_PACK(lib, 0, 0);
+
+	for (i = 0; i < 2; i++) {
+		failed |= check_string("library before load",
+		    ERR_lib_error_string(ERR_PACK(lib, 0, 0)), NULL);
+		failed |= check_string("reason before load",
+		    ERR_reason_error_string(ERR_PACK(lib, 0, 100)), NULL);
+
+		ERR_load_strings(0, lib_str);
+		ERR_load_strings(lib, reason_str);
+
+		failed |= check_string("library",
+		    ERR_lib_error_string(ERR_PACK(lib, 0, 0)),
+		    "test library");
+		failed |= check_string("first reason",
+		    ERR_reason_error_string(ERR_PACK(lib, 0, 100)),
+		    "first reason");
+		failed |= check_string("second reason",
+		    ERR_reason_error_string(ERR_PACK(lib, 0, 101)),
+		    "second reason");
+
+		snprintf(want, sizeof(want), "error:%08lX:test library:"
+		    "func(4095):second reason", ERR_PACK(lib, 0xfff, 101));
+		failed |= check_string("error string",
+		    ERR_error_string(ERR_PACK(lib, 0xfff, 101), NULL), want);
+
+		ERR_unload_strings(lib, reason_str);
+		ERR_unload_strings(0, lib_str);
+
+		failed |= check_string("library after unload",
+		    ERR_lib_error_string(ERR_PACK(lib, 0, 0)), NULL);
+		failed |= check_string("reason after unload",
+		    ERR_reason_error_string(ERR_PACK(lib, 0, 101)), NULL);
+	}
+
+	return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int failed = 0;
+
+	failed |= test_builtin_strings();
+	failed |= test_builtin_unload();
+	failed |= test_builtin_override();
+	failed |= test_library_strings();
+
+	return failed;
+}
@@ -0,0 +1,191 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/err.h>
+
+#define N_ERRORS	8
+#define N_EXITS		100
+
+static pthread_barrier_t barrier;
+
+struct queue_arg {
+	int lib;
+	int failed;
+};
+
+static void
+barrier_wait(void)
+{
+	int ret;
+
+	ret = pthread_barrier_wait(&barrier);
+	if (ret != 0 && ret != PTHREAD_BARRIER_SERIAL_THREAD)
+		errx(1, "pthread_barrier_wait: %s", strerror(ret));
+}
+
+/*
+ * Fill this thread's error queue while the other thread fills its own,
+ * then check that only this thread's errors come back, in order.
+ */
+static void *
+queue_thread(void *arg)
+{
+	struct queue_arg *qa = arg;
+	unsigned long e;
+	const char *data;
+	char buf[16];
+	int flags, i;
+
+	if (ERR_peek_error() != 0) {
+		fprintf(stderr, "FAIL: lib %d: new thread has errors\n",
+		    qa->lib);
+		qa->failed = 1;
+	}
+
+	barrier_wait();
+	for (i = 0; i < N_ERRORS; i++) {
+		ERR_put_error(qa->lib, 0xfff, 100 + i, __FILE__, __LINE__);
+		snprintf(buf, sizeof(buf), "%d:%d", qa->lib, i);
+		ERR_add_error_data(1, buf);
+	}
+	barrier_wait();
+
+	for (i = 0; i < N_ERRORS; i++) {
+		e = ERR_get_error_line_data(NULL, NULL, &data, &flags);
+		snprintf(buf, sizeof(buf), "%d:%d", qa->lib, i);
+		if (ERR_GET_LIB(e) != qa->lib ||
+		    ERR_GET_REASON(e) != 100 + i ||
+		    (flags & ERR_TXT_STRING) == 0 || strcmp(data, buf) != 0) {
+			fprintf(stderr, "FAIL: lib %d: error %d is %08lx "
+			    "\"%s\"\n", qa->lib, i, e, data);
+			qa->failed = 1;
+		}
+	}
+	if ((e = ERR_get_error()) != 0) {
+		fprintf(stderr, "FAIL: lib %d: extra error %08lx\n", qa->lib,
+		    e);
+		qa->failed = 1;
+	}
+	barrier_wait();
+
+	return NULL;
+}
+
+static int
+test_queue_isolation(void)
+{
+	pthread_t thread[2];
+	struct queue_arg qa[2];
+	int i, ret, failed = 0;
+
+	if ((ret = pthread_barrier_init(&barrier, NULL, 2)) != 0)
+		errx(1, "pthread_barrier_init: %s", strerror(ret));
+
+	for (i = 0; i < 2; i++) {
+		qa[i].lib = ERR_LIB_USER + i;
+		qa[i].failed = 0;
+		if ((ret = pthread_create(&thread[i], NULL, queue_thread,
+		    &qa[i])) != 0)
+			errx(1, "pthread_create: %s", strerror(ret));
+	}
+	for (i = 0; i < 2; i++) {
+		if ((ret = pthread_join(thread[i], NULL)) != 0)
+			errx(1, "pthread_join: %s", strerror(ret));
+		failed |= qa[i].failed;
+	}
+
+	pthread_barrier_destroy(&barrier);
+
+	if (ERR_peek_error() != 0) {
+		fprintf(stderr, "FAIL: main thread sees thread errors\n");
+		failed = 1;
+	}
+
+	return failed;
+}
+
+static void *
+exit_thread(void *arg)
+{
+	int *failed = arg;
+
+	if (ERR_peek_error() != 0) {
+		fprintf(stderr, "FAIL: thread sees errors of an exited "
+		    "thread\n");
+		*failed = 1;
+	}
+
+	/* Leave errors behind for the thread exit to clean up. */
+	ERR_put_error(ERR_LIB_USER, 0xfff, 100, __FILE__, __LINE__);
+	ERR_add_error_data(1, "left behind");
+
+	return NULL;
+}
+
+/*
+ * Threads that exit with errors queued must not hand them to later
+ * threads, which may well get the same thread ID.
+ */
+static int
+test_thread_exit(void)
+{
+	pthread_t thread;
+	int i, ret, failed = 0;
+
+	for (i = 0; i < N_EXITS; i++) {
+		if ((ret = pthread_create(&thread, NULL, exit_thread,
+		    &failed)) != 0)
+			errx(1, "pthread_create: %s", strerror(ret));
+		if ((ret = pthread_join(thread, NULL)) != 0)
+			errx(1, "pthread_join: %s", strerror(ret));
+	}
+
+	return failed;
+}
+
+/* ERR_remove_thread_state() empties the queue of the calling thread. */
+static int
+test_remove_state(void)
+{
+	int failed = 0;
+
+	ERR_put_error(ERR_LIB_USER, 0xfff, 100, __FILE__, __LINE__);
+	ERR_remove_thread_state(NULL);
+	if (ERR_peek_error() != 0) {
+		fprintf(stderr, "FAIL: errors left after "
+		    "ERR_remove_thread_state\n");
+		failed = 1;
+	}
+
+	return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int failed = 0;
+
+	failed |= test_queue_isolation();
+	failed |= test_thread_exit();
+	failed |= test_remove_state();
+
+	return failed;
+}
@@ -0,0 +1,204 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <openssl/crypto.h>
+
+#define N_INDEXES	64
+#define N_THREADS	4
+
+static int class_index;
+static int n_new, n_dup, n_free;
+static int done;
+
+static int
+new_cb(void *parent, void *ptr, CRYPTO_EX_DATA *ad, int idx, long argl,
+    void *argp)
+{
+	if (idx != argl)
+		errx(1, "new_cb: index %d has argl %ld", idx, argl);
+	__sync_add_and_fetch(&n_new, 1);
+	return CRYPTO_set_ex_data(ad, idx, argp);
+}
+
+static int
+dup_cb(CRYPTO_EX_DATA *to, CRYPTO_EX_DATA *from, void *from_d, int idx,
+    long argl, void *argp)
+{
+	if (idx != argl)
+		errx(1, "dup_cb: index %d has argl %ld", idx, argl);
+	__sync_add_and_fetch(&n_dup, 1);
+	return 1;
+}
+
+static void
+free_cb(void *parent, void *ptr, CRYPTO_EX_DATA *ad, int idx, long argl,
+    void *argp)
+{
+	if (idx != argl)
+		errx(1, "free_cb: index %d has argl %ld", idx, argl);
+	__sync_add_and_fetch(&n_free, 1);
+}
+
+static int
+test_no_callbacks(void)
+{
+	CRYPTO_EX_DATA ad, dup = { 0 };
+	int failed = 1;
+
+	if (!CRYPTO_new_ex_data(class_index, NULL, &ad))
+		errx(1, "CRYPTO_new_ex_data");
+	if (CRYPTO_get_ex_data(&ad, 0) != NULL) {
+		fprintf(stderr, "FAIL: new ex_data is not empty\n");
+		goto err;
+	}
+	if (!CRYPTO_set_ex_data(&ad, 3, &ad))
+		errx(1, "CRYPTO_set_ex_data");
+	if (!CRYPTO_dup_ex_data(class_index, &dup, &ad))
+		errx(1, "CRYPTO_dup_ex_data");
+	if (CRYPTO_get_ex_data(&dup, 3) != NULL) {
+		fprintf(stderr, "FAIL: ex_data without index was copied\n");
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	CRYPTO_free_ex_data(class_index, NULL, &ad);
+	CRYPTO_free_ex_data(class_index, NULL, &dup);
+
+	return failed;
+}
+
+static int
+test_callbacks(void)
+{
+	CRYPTO_EX_DATA ad, dup = { 0 };
+	int i, idx, failed = 1;
+
+	for (i = 0; i < 2; i++) {
+		idx = CRYPTO_get_ex_new_index(class_index, i, &n_new, new_cb,
+		    dup_cb, free_cb);
+		if (idx != i) {
+			fprintf(stderr, "FAIL: got index %d, want %d\n", idx,
+			    i);
+			return 1;
+		}
+	}
+
+	n_new = n_dup = n_free = 0;
+	if (!CRYPTO_new_ex_data(class_index, NULL, &ad))
+		errx(1, "CRYPTO_new_ex_data");
+	if (n_new != 2 || CRYPTO_get_ex_data(&ad, 1) != &n_new) {
+		fprintf(stderr, "FAIL: new_func called %d times\n", n_new);
+		goto err;
+	}
+	if (!CRYPTO_dup_ex_data(class_index, &dup, &ad))
+		errx(1, "CRYPTO_dup_ex_data");
+	if (n_dup != 2 || CRYPTO_get_ex_data(&dup, 1) != &n_new) {
+		fprintf(stderr, "FAIL: dup_func called %d times\n", n_dup);
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	CRYPTO_free_ex_data(class_index, NULL, &ad);
+	CRYPTO_free_ex_data(class_index, NULL, &dup);
+	if (!failed && n_free != 4) {
+		fprintf(stderr, "FAIL: free_func called %d times\n", n_free);
+		failed = 1;
+	}
+
+	return failed;
+}
+
+/*
+ * Objects are created and freed while indexes are added, both to their
+ * class and to new classes. Every callback must see the argl that was
+ * registered with its index.
+ */
+static void *
+new_free_thread(void *arg)
+{
+	CRYPTO_EX_DATA ad;
+
+	while (!__atomic_load_n(&done, __ATOMIC_RELAXED)) {
+		if (!CRYPTO_new_ex_data(class_index, NULL, &ad))
+			errx(1, "CRYPTO_new_ex_data");
+		CRYPTO_free_ex_data(class_index, NULL, &ad);
+	}
+
+	return NULL;
+}
+
+static int
+test_register_threads(void)
+{
+	pthread_t threads[N_THREADS];
+	int i, idx, other_class, failed = 0;
+
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, new_free_thread,
+		    NULL) != 0)
+			errx(1, "pthread_create");
+	}
+	for (i = 2; i < N_INDEXES; i++) {
+		idx = CRYPTO_get_ex_new_index(class_index, i, &n_new, new_cb,
+		    dup_cb, free_cb);
+		if (idx != i) {
+			fprintf(stderr, "FAIL: got index %d, want %d\n", idx,
+			    i);
+			failed = 1;
+		}
+		if ((other_class = CRYPTO_ex_data_new_class()) < 0)
+			errx(1, "CRYPTO_ex_data_new_class");
+		idx = CRYPTO_get_ex_new_index(other_class, 0, NULL, new_cb,
+		    dup_cb, free_cb);
+		if (idx != 0) {
+			fprintf(stderr, "FAIL: got index %d in new class\n",
+			    idx);
+			failed = 1;
+		}
+	}
+	__atomic_store_n(&done, 1, __ATOMIC_RELAXED);
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+	}
+
+	return failed;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	if ((class_index = CRYPTO_ex_data_new_class()) < 0)
+		errx(1, "CRYPTO_ex_data_new_class");
+
+	failed |= test_no_callbacks();
+	failed |= test_callbacks();
+	failed |= test_register_threads();
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
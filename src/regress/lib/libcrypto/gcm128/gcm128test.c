@@ -55,6 +55,7 @@
 #include <string.h>
 
 #include <openssl/aes.h>
+#include <openssl/evp.h>
 #include <openssl/modes.h>
 
 /* XXX - something like this should be in the public headers. */
@@ -913,6 +914,85 @@ fail:
 	return (ret);
 }
 
+/*
+ * Compare EVP_AEAD, which uses the fastest available CTR and GHASH
+ * implementations, against a block at a time CRYPTO_gcm128_encrypt() for
+ * lengths that exercise the bulk code paths and their tails.
+ */
+static int
+do_gcm128_bulk_test(size_t key_len, size_t len)
+{
+	EVP_AEAD_CTX *aead_ctx = NULL;
+	GCM128_CONTEXT ctx;
+	AES_KEY key;
+	uint8_t K[32], IV[12], A[20], T[16];
+	uint8_t *P = NULL, *C = NULL, *out = NULL;
+	size_t i, out_len;
+	int ret = 1;
+
+	for (i = 0; i < sizeof(K); i++)
+		K[i] = i * 7 + len;
+	for (i = 0; i < sizeof(IV); i++)
+		IV[i] = 0xff - i;
+	for (i = 0; i < sizeof(A); i++)
+		A[i] = i;
+
+	if ((P = malloc(len + 1)) == NULL)
+		err(1, "malloc");
+	if ((C = malloc(len + 1)) == NULL)
+		err(1, "malloc");
+	if ((out = malloc(len + sizeof(T))) == NULL)
+		err(1, "malloc");
+	for (i = 0; i < len; i++)
+		P[i] = i * 13 + (i >> 8);
+
+	AES_set_encrypt_key(K, key_len * 8, &key);
+	CRYPTO_gcm128_init(&ctx, &key, (block128_f)AES_encrypt);
+	CRYPTO_gcm128_setiv(&ctx, IV, sizeof(IV));
+	CRYPTO_gcm128_aad(&ctx, A, sizeof(A));
+	CRYPTO_gcm128_encrypt(&ctx, P, C, len);
+	CRYPTO_gcm128_tag(&ctx, T, sizeof(T));
+
+	if ((aead_ctx = EVP_AEAD_CTX_new()) == NULL)
+		errx(1, "EVP_AEAD_CTX_new");
+	if (!EVP_AEAD_CTX_init(aead_ctx, key_len == 16 ?
+	    EVP_aead_aes_128_gcm() : EVP_aead_aes_256_gcm(), K, key_len,
+	    EVP_AEAD_DEFAULT_TAG_LENGTH, NULL))
+		errx(1, "EVP_AEAD_CTX_init");
+
+	if (!EVP_AEAD_CTX_seal(aead_ctx, out, &out_len, len + sizeof(T),
+	    IV, sizeof(IV), P, len, A, sizeof(A))) {
+		fprintf(stderr, "BULK %zu/%zu: seal failed\n", key_len, len);
+		goto fail;
+	}
+	if (out_len != len + sizeof(T) || memcmp(out, C, len) != 0 ||
+	    memcmp(out + len, T, sizeof(T)) != 0) {
+		fprintf(stderr, "BULK %zu/%zu: seal mismatch\n", key_len, len);
+		goto fail;
+	}
+
+	/* Decrypt in place. */
+	if (!EVP_AEAD_CTX_open(aead_ctx, out, &out_len, len + sizeof(T),
+	    IV, sizeof(IV), out, len + sizeof(T), A, sizeof(A))) {
+		fprintf(stderr, "BULK %zu/%zu: open failed\n", key_len, len);
+		goto fail;
+	}
+	if (out_len != len || memcmp(out, P, len) != 0) {
+		fprintf(stderr, "BULK %zu/%zu: open mismatch\n", key_len, len);
+		goto fail;
+	}
+
+	ret = 0;
+
+fail:
+	EVP_AEAD_CTX_free(aead_ctx);
+	free(P);
+	free(C);
+	free(out);
+
+	return ret;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -922,5 +1002,10 @@ main(int argc, char **argv)
 	for (i = 0; i < N_TESTS; i++)
 		ret |= do_gcm128_test(i + 1, &gcm128_tests[i]);
 
+	for (i = 0; i < 16 * 1024 + 100; i += (i < 1024) ? 1 : 997) {
+		ret |= do_gcm128_bulk_test(16, i);
+		ret |= do_gcm128_bulk_test(32, i);
+	}
+
 	return ret;
 }
@@ -0,0 +1,285 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <openssl/crypto.h>
+
+#define N_THREADS	8
+#define N_ADDS		100000
+#define TIMEOUT		10
+
+#define BENCH_THREADS	64
+#define BENCH_SECONDS	1
+
+static int counter;
+static unsigned char *seen;
+static volatile int inside;
+static volatile int stop;
+static double deadline;
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int
+run_threads(int n, void *(*fn)(void *))
+{
+	pthread_t threads[BENCH_THREADS];
+	int failed[BENCH_THREADS] = { 0 };
+	int i, ret = 0;
+
+	for (i = 0; i < n; i++) {
+		if (pthread_create(&threads[i], NULL, fn, &failed[i]) != 0)
+			errx(1, "pthread_create");
+	}
+	for (i = 0; i < n; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+		ret |= failed[i];
+	}
+
+	return ret;
+}
+
+/*
+ * Every increment must return a value no other increment returned.
+ */
+static void *
+add_thread(void *arg)
+{
+	int *failed = arg;
+	int i, v;
+
+	for (i = 0; i < N_ADDS; i++) {
+		v = CRYPTO_add(&counter, 1, CRYPTO_LOCK_X509);
+		if (v < 1 || v > N_THREADS * N_ADDS) {
+			*failed = 1;
+			continue;
+		}
+		seen[v - 1]++;
+	}
+
+	return NULL;
+}
+
+static void *
+sub_thread(void *arg)
+{
+	int i;
+
+	for (i = 0; i < N_ADDS; i++)
+		CRYPTO_add(&counter, -1, CRYPTO_LOCK_X509);
+
+	return NULL;
+}
+
+static int
+test_add(void)
+{
+	int i, failed;
+
+	if ((seen = calloc(N_THREADS, N_ADDS)) == NULL)
+		err(1, NULL);
+	counter = 0;
+
+	failed = run_threads(N_THREADS, add_thread);
+	if (failed)
+		fprintf(stderr, "FAIL: CRYPTO_add returned a bad value\n");
+	if (counter != N_THREADS * N_ADDS) {
+		fprintf(stderr, "FAIL: counter is %d, want %d\n", counter,
+		    N_THREADS * N_ADDS);
+		failed = 1;
+	}
+	for (i = 0; i < N_THREADS * N_ADDS; i++) {
+		if (seen[i] != 1) {
+			fprintf(stderr, "FAIL: CRYPTO_add returned %d "
+			    "%d times\n", i + 1, seen[i]);
+			failed = 1;
+			break;
+		}
+	}
+
+	free(seen);
+	seen = NULL;
+
+	run_threads(N_THREADS, sub_thread);
+	if (counter != 0) {
+		fprintf(stderr, "FAIL: counter is %d, want 0\n", counter);
+		failed = 1;
+	}
+
+	return failed;
+}
+
+/*
+ * All readers must be able to hold the lock at the same time.
+ */
+static void *
+read_thread(void *arg)
+{
+	int *failed = arg;
+
+	CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+	__sync_add_and_fetch(&inside, 1);
+	while (inside < N_THREADS) {
+		if (now() > deadline) {
+			*failed = 1;
+			break;
+		}
+		usleep(1000);
+	}
+	CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+
+	return NULL;
+}
+
+static int
+test_read_shared(void)
+{
+	int failed;
+
+	inside = 0;
+	deadline = now() + TIMEOUT;
+	if ((failed = run_threads(N_THREADS, read_thread)) != 0)
+		fprintf(stderr, "FAIL: readers did not share the lock\n");
+
+	return failed;
+}
+
+/*
+ * Writers must exclude each other and readers.
+ */
+static void *
+write_thread(void *arg)
+{
+	int *failed = arg;
+	int i;
+
+	for (i = 0; i < 1000; i++) {
+		if (i & 1) {
+			CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+			if (inside != 0)
+				*failed = 1;
+			CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+			continue;
+		}
+		CRYPTO_w_lock(CRYPTO_LOCK_SSL_CTX);
+		if (inside++ != 0)
+			*failed = 1;
+		usleep(10);
+		if (--inside != 0)
+			*failed = 1;
+		CRYPTO_w_unlock(CRYPTO_LOCK_SSL_CTX);
+	}
+
+	return NULL;
+}
+
+static int
+test_write_exclusive(void)
+{
+	int failed;
+
+	inside = 0;
+	if ((failed = run_threads(N_THREADS, write_thread)) != 0)
+		fprintf(stderr, "FAIL: writer did not hold the lock "
+		    "exclusively\n");
+
+	return failed;
+}
+
+/*
+ * What a resumed handshake does with the library locks: look the session
+ * up in the cache and take a reference to it under the read lock, then
+ * drop the reference again.
+ */
+static void *
+bench_thread(void *arg)
+{
+	unsigned long *ops = arg;
+	unsigned long n = 0;
+
+	while (!stop) {
+		CRYPTO_r_lock(CRYPTO_LOCK_SSL_CTX);
+		CRYPTO_add(&counter, 1, CRYPTO_LOCK_SSL_SESSION);
+		CRYPTO_r_unlock(CRYPTO_LOCK_SSL_CTX);
+		CRYPTO_add(&counter, -1, CRYPTO_LOCK_SSL_SESSION);
+		n++;
+	}
+	*ops = n;
+
+	return NULL;
+}
+
+static void
+bench(void)
+{
+	pthread_t threads[BENCH_THREADS];
+	unsigned long ops[BENCH_THREADS];
+	unsigned long total;
+	int i, n;
+
+	for (n = 1; n <= BENCH_THREADS; n *= 2) {
+		stop = 0;
+		for (i = 0; i < n; i++) {
+			if (pthread_create(&threads[i], NULL, bench_thread,
+			    &ops[i]) != 0)
+				errx(1, "pthread_create");
+		}
+		sleep(BENCH_SECONDS);
+		stop = 1;
+		total = 0;
+		for (i = 0; i < n; i++) {
+			if (pthread_join(threads[i], NULL) != 0)
+				errx(1, "pthread_join");
+			total += ops[i];
+		}
+		printf("%2d threads: %8.0f lookups/ms\n", n,
+		    total / (BENCH_SECONDS * 1000.0));
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	if (argc == 2 && strcmp(argv[1], "-b") == 0) {
+		bench();
+		return 0;
+	}
+
+	failed |= test_add();
+	failed |= test_read_shared();
+	failed |= test_write_exclusive();
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
@@ -110,8 +110,9 @@ poly1305_power_on_self_test(void)
 	poly1305_context total_ctx;
 	unsigned char all_key[32];
 	unsigned char all_msg[256];
-	unsigned char mac[16];
-	size_t i, j;
+	unsigned char long_msg[4133];
+	unsigned char mac[16], long_mac[16];
+	size_t i, j, k;
 	int result = 1;
 
 	for (i = 0; i < sizeof(mac); i++)
@@ -154,6 +155,34 @@ poly1305_power_on_self_test(void)
 	CRYPTO_poly1305_finish(&total_ctx, mac);
 	result &= poly1305_verify(total_mac, mac);
 
+	/*
+	 * long messages, which may be handled by a SIMD implementation,
+	 * against the same messages fed in short pieces
+	 */
+	for (i = 0; i < 2; i++) {
+		for (j = 0; j < sizeof(all_key); j++)
+			all_key[j] = i ? 0xff : j;
+		for (j = 0; j < sizeof(long_msg); j++)
+			long_msg[j] = i ? 0xff : j * 7;
+		for (k = 1; k < sizeof(long_msg); k = k * 3 + 1) {
+			poly1305_auth(mac, long_msg, k, all_key);
+			CRYPTO_poly1305_init(&ctx, all_key);
+			for (j = 0; j < k; j += 15)
+				CRYPTO_poly1305_update(&ctx, long_msg + j,
+				    k - j < 15 ? k - j : 15);
+			CRYPTO_poly1305_finish(&ctx, long_mac);
+			result &= poly1305_verify(long_mac, mac);
+
+			/* start with a partial block */
+			CRYPTO_poly1305_init(&ctx, all_key);
+			CRYPTO_poly1305_update(&ctx, long_msg, k / 3);
+			CRYPTO_poly1305_update(&ctx, long_msg + k / 3,
+			    k - k / 3);
+			CRYPTO_poly1305_finish(&ctx, long_mac);
+			result &= poly1305_verify(long_mac, mac);
+		}
+	}
+
 	return result;
 }
 
@@ -0,0 +1,175 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+
+/*
+ * Private key operations on one key from many threads at once. There are
+ * more threads than blinding slots in a key, so some of them have to use
+ * blinding factors made for a single operation. Every signature must be
+ * the one computed beforehand, and every ciphertext must decrypt to its
+ * message.
+ */
+
+#define N_THREADS	80
+#define N_ROUNDS	4
+#define N_MESSAGES	8
+#define MESSAGE_LEN	32
+
+static RSA *rsa;
+static int rsa_size;
+
+static unsigned char messages[N_MESSAGES][MESSAGE_LEN];
+static unsigned char *signatures[N_MESSAGES];
+static unsigned char *ciphertexts[N_MESSAGES];
+
+static int
+check_private_ops(const char *name, int round)
+{
+	unsigned char *buf;
+	int i, len, failed = 1;
+
+	if ((buf = malloc(rsa_size)) == NULL)
+		err(1, NULL);
+
+	for (i = 0; i < N_MESSAGES; i++) {
+		len = RSA_private_encrypt(MESSAGE_LEN, messages[i], buf, rsa,
+		    RSA_PKCS1_PADDING);
+		if (len != rsa_size || memcmp(buf, signatures[i], len) != 0) {
+			fprintf(stderr, "FAIL: %s: round %d: wrong signature "
+			    "for message %d\n", name, round, i);
+			goto done;
+		}
+		len = RSA_private_decrypt(rsa_size, ciphertexts[i], buf, rsa,
+		    RSA_PKCS1_PADDING);
+		if (len != MESSAGE_LEN ||
+		    memcmp(buf, messages[i], MESSAGE_LEN) != 0) {
+			fprintf(stderr, "FAIL: %s: round %d: wrong plaintext "
+			    "for message %d\n", name, round, i);
+			goto done;
+		}
+	}
+
+	failed = 0;
+
+ done:
+	free(buf);
+
+	return failed;
+}
+
+static void *
+worker(void *arg)
+{
+	int *failed = arg;
+	int i;
+
+	for (i = 0; i < N_ROUNDS && !*failed; i++)
+		*failed = check_private_ops("thread", i);
+
+	return NULL;
+}
+
+static int
+run_threads(const char *name)
+{
+	pthread_t threads[N_THREADS];
+	int failed[N_THREADS] = { 0 };
+	int i, main_failed = 0, ret = 0;
+
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, worker, &failed[i]) != 0)
+			errx(1, "pthread_create");
+	}
+
+	/* The main thread works on the key at the same time. */
+	for (i = 0; i < N_ROUNDS && !main_failed; i++)
+		main_failed = check_private_ops("main thread", i);
+
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+		ret |= failed[i];
+	}
+	ret |= main_failed;
+
+	if (ret)
+		fprintf(stderr, "FAIL: %s\n", name);
+
+	return ret;
+}
+
+int
+main(int argc, char *argv[])
+{
+	BIGNUM *e;
+	int i, failed = 0;
+
+	if ((rsa = RSA_new()) == NULL)
+		errx(1, "RSA_new");
+	if ((e = BN_new()) == NULL)
+		errx(1, "BN_new");
+	if (!BN_set_word(e, RSA_F4))
+		errx(1, "BN_set_word");
+	if (!RSA_generate_key_ex(rsa, 1024, e, NULL))
+		errx(1, "RSA_generate_key_ex");
+	rsa_size = RSA_size(rsa);
+
+	/* PKCS#1 v1.5 signatures do not depend on the blinding. */
+	arc4random_buf(messages, sizeof(messages));
+	for (i = 0; i < N_MESSAGES; i++) {
+		if ((signatures[i] = malloc(rsa_size)) == NULL ||
+		    (ciphertexts[i] = malloc(rsa_size)) == NULL)
+			err(1, NULL);
+		if (RSA_private_encrypt(MESSAGE_LEN, messages[i],
+		    signatures[i], rsa, RSA_PKCS1_PADDING) != rsa_size)
+			errx(1, "RSA_private_encrypt");
+		if (RSA_public_encrypt(MESSAGE_LEN, messages[i],
+		    ciphertexts[i], rsa, RSA_PKCS1_PADDING) != rsa_size)
+			errx(1, "RSA_public_encrypt");
+	}
+
+	failed |= run_threads("blinding");
+
+	if (!RSA_blinding_on(rsa, NULL))
+		errx(1, "RSA_blinding_on");
+	failed |= run_threads("blinding with RSA_blinding_on");
+
+	RSA_blinding_off(rsa);
+	failed |= run_threads("RSA_blinding_off");
+
+	if (!RSA_blinding_on(rsa, NULL))
+		errx(1, "RSA_blinding_on");
+	failed |= run_threads("blinding turned back on");
+
+	for (i = 0; i < N_MESSAGES; i++) {
+		free(signatures[i]);
+		free(ciphertexts[i]);
+	}
+	BN_free(e);
+	RSA_free(rsa);
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
@@ -0,0 +1,126 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <openssl/bn.h>
+#include <openssl/rsa.h>
+
+/*
+ * Generate keys with RSA_generate_key_mt() on threads started by the test
+ * and check that they are usable keys of the requested size.
+ */
+
+#define N_THREADS	4
+
+struct keygen_work {
+	void (*work)(void *);
+	void *work_arg;
+};
+
+static void *
+keygen_thread(void *arg)
+{
+	struct keygen_work *w = arg;
+
+	w->work(w->work_arg);
+	free(w);
+
+	return NULL;
+}
+
+static int
+keygen_start_thread(void (*work)(void *), void *work_arg, void *arg)
+{
+	struct keygen_work *w;
+	pthread_t thread;
+	int *started = arg;
+
+	if ((w = malloc(sizeof(*w))) == NULL)
+		return 0;
+	w->work = work;
+	w->work_arg = work_arg;
+	if (pthread_create(&thread, NULL, keygen_thread, w) != 0) {
+		free(w);
+		return 0;
+	}
+	pthread_detach(thread);
+	(*started)++;
+
+	return 1;
+}
+
+static int
+test_keygen(int bits, int nthreads)
+{
+	RSA *rsa = NULL;
+	BIGNUM *e = NULL;
+	int started = 0;
+	int failed = 1;
+
+	if ((rsa = RSA_new()) == NULL)
+		errx(1, "RSA_new");
+	if ((e = BN_new()) == NULL)
+		errx(1, "BN_new");
+	if (!BN_set_word(e, RSA_F4))
+		errx(1, "BN_set_word");
+
+	if (!RSA_generate_key_mt(rsa, bits, e, nthreads, keygen_start_thread,
+	    &started, NULL)) {
+		fprintf(stderr, "FAIL: %d bits, %d threads: "
+		    "RSA_generate_key_mt failed\n", bits, nthreads);
+		goto err;
+	}
+	if (RSA_bits(rsa) != bits) {
+		fprintf(stderr, "FAIL: %d bits, %d threads: got %d bits\n",
+		    bits, nthreads, RSA_bits(rsa));
+		goto err;
+	}
+	if (RSA_check_key(rsa) != 1) {
+		fprintf(stderr, "FAIL: %d bits, %d threads: bad key\n", bits,
+		    nthreads);
+		goto err;
+	}
+
+	/* Each prime search hands out nthreads - 1 workers. */
+	if (started < 2 * (nthreads - 1) || started % (nthreads - 1) != 0) {
+		fprintf(stderr, "FAIL: %d bits, %d threads: %d workers "
+		    "started\n", bits, nthreads, started);
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	RSA_free(rsa);
+	BN_free(e);
+
+	return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int failed = 0;
+
+	failed |= test_keygen(1024, 2);
+	failed |= test_keygen(1024, N_THREADS);
+	failed |= test_keygen(2048, N_THREADS);
+
+	return failed;
+}
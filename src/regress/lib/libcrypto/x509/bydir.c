@@ -0,0 +1,173 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/stat.h>
+
+#include <dirent.h>
+#include <err.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+#include <openssl/x509_vfy.h>
+
+static int
+certs_from_file(const char *filename, STACK_OF(X509) **certs)
+{
+	STACK_OF(X509_INFO) *xis;
+	X509 *x;
+	BIO *bio;
+	int i;
+
+	if ((*certs = sk_X509_new_null()) == NULL)
+		errx(1, "sk_X509_new_null");
+	if ((bio = BIO_new_file(filename, "r")) == NULL)
+		errx(1, "failed to open %s", filename);
+	if ((xis = PEM_X509_INFO_read_bio(bio, NULL, NULL, NULL)) == NULL)
+		errx(1, "failed to read PEM");
+	for (i = 0; i < sk_X509_INFO_num(xis); i++) {
+		if ((x = sk_X509_INFO_value(xis, i)->x509) == NULL)
+			continue;
+		if (!X509_up_ref(x) || !sk_X509_push(*certs, x))
+			errx(1, "sk_X509_push");
+	}
+	sk_X509_INFO_pop_free(xis, X509_INFO_free);
+	BIO_free(bio);
+
+	return sk_X509_num(*certs);
+}
+
+static void
+write_hashed(const char *dir, X509 *x, char *path, size_t len)
+{
+	FILE *fp;
+
+	snprintf(path, len, "%s/%08lx.0", dir, X509_subject_name_hash(x));
+	if ((fp = fopen(path, "w")) == NULL)
+		err(1, "%s", path);
+	if (!PEM_write_X509(fp, x))
+		errx(1, "PEM_write_X509");
+	fclose(fp);
+}
+
+/*
+ * Look up the subject of want in a store with a hashed directory. It must
+ * be found if want is in the directory, and not be found otherwise.
+ */
+static int
+lookup(const char *dir, X509 *want, int present)
+{
+	X509_STORE *store;
+	X509_STORE_CTX *ctx;
+	X509_LOOKUP *lu;
+	X509_OBJECT *obj;
+	int failed = 1;
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	if ((lu = X509_STORE_add_lookup(store, X509_LOOKUP_hash_dir())) == NULL)
+		errx(1, "X509_STORE_add_lookup");
+	if (!X509_LOOKUP_add_dir(lu, dir, X509_FILETYPE_PEM))
+		errx(1, "X509_LOOKUP_add_dir");
+	if ((ctx = X509_STORE_CTX_new()) == NULL)
+		errx(1, "X509_STORE_CTX_new");
+	if (!X509_STORE_CTX_init(ctx, store, NULL, NULL))
+		errx(1, "X509_STORE_CTX_init");
+
+	obj = X509_STORE_CTX_get_obj_by_subject(ctx, X509_LU_X509,
+	    X509_get_subject_name(want));
+	if (present && obj == NULL) {
+		fprintf(stderr, "FAIL: certificate not found in %s\n", dir);
+		goto done;
+	}
+	if (present && X509_cmp(X509_OBJECT_get0_X509(obj), want) != 0) {
+		fprintf(stderr, "FAIL: wrong certificate found in %s\n", dir);
+		goto done;
+	}
+	if (!present && obj != NULL) {
+		fprintf(stderr, "FAIL: certificate found in %s\n", dir);
+		goto done;
+	}
+
+	failed = 0;
+
+ done:
+	X509_OBJECT_free(obj);
+	X509_STORE_CTX_free(ctx);
+	X509_STORE_free(store);
+
+	return failed;
+}
+
+int
+main(int argc, char *argv[])
+{
+	char dir[] = "/tmp/bydirXXXXXX";
+	char path[PATH_MAX];
+	STACK_OF(X509) *certs;
+	X509 *ca, *other;
+	DIR *dirp;
+	int failed = 0;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s roots.pem\n", argv[0]);
+		exit(1);
+	}
+	if (certs_from_file(argv[1], &certs) < 2)
+		errx(1, "need two certificates in %s", argv[1]);
+	ca = sk_X509_value(certs, 0);
+	other = sk_X509_value(certs, 1);
+	if (X509_subject_name_hash(ca) == X509_subject_name_hash(other))
+		errx(1, "certificates have the same hash");
+
+	if (mkdtemp(dir) == NULL)
+		err(1, "mkdtemp");
+	write_hashed(dir, ca, path, sizeof(path));
+
+	failed |= lookup(dir, ca, 1);
+	failed |= lookup(dir, other, 0);
+
+	/*
+	 * A directory that may be searched but not listed must still work,
+	 * by looking for the files one by one.
+	 */
+	if (chmod(dir, 0311) == -1)
+		err(1, "chmod");
+	if ((dirp = opendir(dir)) != NULL) {
+		fprintf(stderr, "directory can be listed, e.g. as root; "
+		    "index used\n");
+		closedir(dirp);
+	}
+	failed |= lookup(dir, ca, 1);
+	failed |= lookup(dir, other, 0);
+
+	if (chmod(dir, 0700) == -1)
+		err(1, "chmod");
+	if (unlink(path) == -1)
+		err(1, "unlink");
+	if (rmdir(dir) == -1)
+		err(1, "rmdir");
+
+	sk_X509_pop_free(certs, X509_free);
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
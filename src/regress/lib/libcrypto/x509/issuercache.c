@@ -0,0 +1,272 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "x509_issuer_cache.h"
+
+#define N_KEYS		4096
+#define N_LOOKUPS	200000
+#define N_THREADS	4
+
+static unsigned char parent[N_KEYS][EVP_MAX_MD_SIZE];
+static unsigned char child[N_KEYS][EVP_MAX_MD_SIZE];
+
+/*
+ * Keys that differ only after the prefix the cache hashes, so they all
+ * land in the same shard and probe the same index positions.
+ */
+static void
+make_colliding_keys(void)
+{
+	int i;
+
+	memset(parent, 0, sizeof(parent));
+	memset(child, 0, sizeof(child));
+	for (i = 0; i < N_KEYS; i++) {
+		child[i][8] = i & 0xff;
+		child[i][9] = i >> 8;
+	}
+}
+
+static void
+make_random_keys(void)
+{
+	arc4random_buf(parent, sizeof(parent));
+	arc4random_buf(child, sizeof(child));
+}
+
+static int
+test_find_add(void)
+{
+	int failed = 1;
+
+	make_random_keys();
+	if (!x509_issuer_cache_set_max(X509_ISSUER_CACHE_MAX))
+		errx(1, "x509_issuer_cache_set_max");
+
+	if (x509_issuer_cache_find(parent[0], child[0]) != -1) {
+		fprintf(stderr, "FAIL: found entry in empty cache\n");
+		goto err;
+	}
+	x509_issuer_cache_add(parent[0], child[0], 1);
+	x509_issuer_cache_add(parent[0], child[0], 0);
+	x509_issuer_cache_add(parent[1], child[1], 0);
+	x509_issuer_cache_add(parent[2], child[2], 2);
+	if (x509_issuer_cache_find(parent[0], child[0]) != 1) {
+		fprintf(stderr, "FAIL: entry was replaced\n");
+		goto err;
+	}
+	if (x509_issuer_cache_find(parent[1], child[1]) != 0) {
+		fprintf(stderr, "FAIL: invalid signature not cached\n");
+		goto err;
+	}
+	if (x509_issuer_cache_find(parent[2], child[2]) != -1) {
+		fprintf(stderr, "FAIL: bad validation result cached\n");
+		goto err;
+	}
+	if (x509_issuer_cache_find(parent[0], child[1]) != -1) {
+		fprintf(stderr, "FAIL: found entry for wrong child\n");
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	x509_issuer_cache_free();
+
+	return failed;
+}
+
+/*
+ * With four entries per shard, adding a fifth must evict the first one
+ * that was not used since it was added.
+ */
+static int
+test_clock_eviction(void)
+{
+	struct x509_issuer_cache_stats before, after;
+	int i, want, failed = 1;
+
+	make_colliding_keys();
+	if (!x509_issuer_cache_set_max(4 * 16))
+		errx(1, "x509_issuer_cache_set_max");
+	x509_issuer_cache_stats(&before);
+
+	for (i = 0; i < 4; i++)
+		x509_issuer_cache_add(parent[i], child[i], 1);
+	if (x509_issuer_cache_find(parent[0], child[0]) != 1) {
+		fprintf(stderr, "FAIL: entry 0 not found\n");
+		goto err;
+	}
+	x509_issuer_cache_add(parent[4], child[4], 1);
+
+	for (i = 0; i < 5; i++) {
+		want = i == 1 ? -1 : 1;
+		if (x509_issuer_cache_find(parent[i], child[i]) != want) {
+			fprintf(stderr, "FAIL: entry %d %sfound\n", i,
+			    want == -1 ? "" : "not ");
+			goto err;
+		}
+	}
+
+	x509_issuer_cache_stats(&after);
+	if (after.hits - before.hits != 5 || after.misses - before.misses != 1 ||
+	    after.evictions - before.evictions != 1) {
+		fprintf(stderr, "FAIL: %lu hits, %lu misses, %lu evictions\n",
+		    after.hits - before.hits, after.misses - before.misses,
+		    after.evictions - before.evictions);
+		goto err;
+	}
+
+	failed = 0;
+
+ err:
+	x509_issuer_cache_free();
+
+	return failed;
+}
+
+/*
+ * Lookups racing with additions and evictions must never return a result
+ * that was not added for the same parent and child.
+ */
+static void *
+lookup_thread(void *arg)
+{
+	int *failed = arg;
+	int i, k, ret;
+
+	for (i = 0; i < N_LOOKUPS; i++) {
+		k = arc4random_uniform(N_KEYS);
+		ret = x509_issuer_cache_find(parent[k], child[k]);
+		if (ret == -1)
+			x509_issuer_cache_add(parent[k], child[k], k & 1);
+		else if (ret != (k & 1))
+			*failed = 1;
+	}
+
+	return NULL;
+}
+
+static int
+test_threads(int colliding)
+{
+	pthread_t threads[N_THREADS];
+	int failed[N_THREADS] = { 0 };
+	int i, ret = 0;
+
+	if (colliding)
+		make_colliding_keys();
+	else
+		make_random_keys();
+	if (!x509_issuer_cache_set_max(N_KEYS / 2))
+		errx(1, "x509_issuer_cache_set_max");
+
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, lookup_thread,
+		    &failed[i]) != 0)
+			errx(1, "pthread_create");
+	}
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+		ret |= failed[i];
+	}
+	if (ret)
+		fprintf(stderr, "FAIL: wrong result with %s keys\n",
+		    colliding ? "colliding" : "random");
+
+	x509_issuer_cache_free();
+
+	return ret;
+}
+
+/*
+ * Tables replaced by x509_issuer_cache_set_max() while lookups run must
+ * be freed once those lookups are done, and not before.
+ */
+static volatile int stop;
+
+static void *
+find_thread(void *arg)
+{
+	int *failed = arg;
+	int k, ret;
+
+	while (!stop) {
+		k = arc4random_uniform(N_KEYS);
+		ret = x509_issuer_cache_find(parent[k], child[k]);
+		if (ret != -1 && ret != (k & 1))
+			*failed = 1;
+	}
+
+	return NULL;
+}
+
+static int
+test_set_max_threads(void)
+{
+	pthread_t threads[N_THREADS];
+	int failed[N_THREADS] = { 0 };
+	int i, k, ret = 0;
+
+	make_random_keys();
+	stop = 0;
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, find_thread,
+		    &failed[i]) != 0)
+			errx(1, "pthread_create");
+	}
+	for (i = 0; i < 1000; i++) {
+		if (!x509_issuer_cache_set_max(N_KEYS / 2 + i))
+			errx(1, "x509_issuer_cache_set_max");
+		for (k = 0; k < 64; k++)
+			x509_issuer_cache_add(parent[k], child[k], k & 1);
+	}
+	stop = 1;
+	for (i = 0; i < N_THREADS; i++) {
+		if (pthread_join(threads[i], NULL) != 0)
+			errx(1, "pthread_join");
+		ret |= failed[i];
+	}
+	if (ret)
+		fprintf(stderr, "FAIL: wrong result while replacing tables\n");
+
+	x509_issuer_cache_free();
+
+	return ret;
+}
+
+int
+main(int argc, char *argv[])
+{
+	int failed = 0;
+
+	failed |= test_find_add();
+	failed |= test_clock_eviction();
+	failed |= test_threads(0);
+	failed |= test_threads(1);
+	failed |= test_set_max_threads();
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}
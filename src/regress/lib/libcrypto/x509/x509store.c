@@ -0,0 +1,522 @@
+/*	$OpenBSD$ */
+/*
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <err.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#include "x509_lcl.h"
+
+#define CHECK_TIME	1700000000
+#define DAY		(24 * 60 * 60)
+
+#define N_GROW_CERTS	200
+
+/* The subject names of these CAs have the same hash in the store index. */
+#define COLLIDING_CN_1	"test ca 329599"
+#define COLLIDING_CN_2	"test ca 532382"
+
+static EVP_PKEY *key;
+
+static void
+make_key(void)
+{
+	EC_KEY *ec;
+
+	if ((ec = EC_KEY_new_by_curve_name(NID_X9_62_prime256v1)) == NULL)
+		errx(1, "EC_KEY_new_by_curve_name");
+	if (!EC_KEY_generate_key(ec))
+		errx(1, "EC_KEY_generate_key");
+	if ((key = EVP_PKEY_new()) == NULL)
+		errx(1, "EVP_PKEY_new");
+	if (!EVP_PKEY_assign_EC_KEY(key, ec))
+		errx(1, "EVP_PKEY_assign_EC_KEY");
+}
+
+static ASN1_OCTET_STRING *
+key_id(int id)
+{
+	ASN1_OCTET_STRING *kid;
+	unsigned char data[4];
+
+	data[0] = id >> 24;
+	data[1] = id >> 16;
+	data[2] = id >> 8;
+	data[3] = id;
+
+	if ((kid = ASN1_OCTET_STRING_new()) == NULL)
+		errx(1, "ASN1_OCTET_STRING_new");
+	if (!ASN1_OCTET_STRING_set(kid, data, sizeof(data)))
+		errx(1, "ASN1_OCTET_STRING_set");
+
+	return kid;
+}
+
+static X509_NAME *
+make_name(const char *cn)
+{
+	X509_NAME *name;
+
+	if ((name = X509_NAME_new()) == NULL)
+		errx(1, "X509_NAME_new");
+	if (!X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+	    (const unsigned char *)cn, -1, -1, 0))
+		errx(1, "X509_NAME_add_entry_by_txt");
+
+	return name;
+}
+
+/*
+ * Make a certificate valid from CHECK_TIME + not_before days to
+ * CHECK_TIME + not_after days. A negative skid or akid leaves out the
+ * key identifier extension. The signatures are not checked by the store.
+ */
+static X509 *
+make_cert(const char *subject, const char *issuer, long serial,
+    int not_before, int not_after, int skid, int akid)
+{
+	AUTHORITY_KEYID *akeyid;
+	ASN1_OCTET_STRING *kid;
+	X509_NAME *name;
+	X509 *x;
+
+	if ((x = X509_new()) == NULL)
+		errx(1, "X509_new");
+	if (!X509_set_version(x, 2))
+		errx(1, "X509_set_version");
+	if (!ASN1_INTEGER_set(X509_get_serialNumber(x), serial))
+		errx(1, "ASN1_INTEGER_set");
+
+	name = make_name(subject);
+	if (!X509_set_subject_name(x, name))
+		errx(1, "X509_set_subject_name");
+	X509_NAME_free(name);
+	name = make_name(issuer);
+	if (!X509_set_issuer_name(x, name))
+		errx(1, "X509_set_issuer_name");
+	X509_NAME_free(name);
+
+	if (ASN1_TIME_set(X509_getm_notBefore(x),
+	    CHECK_TIME + (time_t)not_before * DAY) == NULL)
+		errx(1, "ASN1_TIME_set");
+	if (ASN1_TIME_set(X509_getm_notAfter(x),
+	    CHECK_TIME + (time_t)not_after * DAY) == NULL)
+		errx(1, "ASN1_TIME_set");
+	if (!X509_set_pubkey(x, key))
+		errx(1, "X509_set_pubkey");
+
+	if (skid >= 0) {
+		kid = key_id(skid);
+		if (!X509_add1_ext_i2d(x, NID_subject_key_identifier, kid, 0,
+		    0))
+			errx(1, "X509_add1_ext_i2d");
+		ASN1_OCTET_STRING_free(kid);
+	}
+	if (akid >= 0) {
+		if ((akeyid = AUTHORITY_KEYID_new()) == NULL)
+			errx(1, "AUTHORITY_KEYID_new");
+		akeyid->keyid = key_id(akid);
+		if (!X509_add1_ext_i2d(x, NID_authority_key_identifier, akeyid,
+		    0, 0))
+			errx(1, "X509_add1_ext_i2d");
+		AUTHORITY_KEYID_free(akeyid);
+	}
+
+	if (!X509_sign(x, key, EVP_sha256()))
+		errx(1, "X509_sign");
+
+	return x;
+}
+
+static X509_STORE_CTX *
+make_ctx(X509_STORE *store, X509 *leaf)
+{
+	X509_STORE_CTX *ctx;
+
+	if ((ctx = X509_STORE_CTX_new()) == NULL)
+		errx(1, "X509_STORE_CTX_new");
+	if (!X509_STORE_CTX_init(ctx, store, leaf, NULL))
+		errx(1, "X509_STORE_CTX_init");
+	X509_STORE_CTX_set_time(ctx, 0, CHECK_TIME);
+
+	return ctx;
+}
+
+static int
+check_count(const char *name, X509_STORE *store, int want)
+{
+	int got;
+
+	got = sk_X509_OBJECT_num(X509_STORE_get0_objects(store));
+	if (got != want) {
+		fprintf(stderr, "FAIL: %s: store has %d objects, want %d\n",
+		    name, got, want);
+		return 1;
+	}
+	return 0;
+}
+
+/* Check that the store's certificates named subject are want, in order. */
+static int
+check_certs(const char *name, X509_STORE *store, const char *subject,
+    X509 **want, int n_want)
+{
+	STACK_OF(X509) *certs;
+	X509_STORE_CTX *ctx;
+	X509_NAME *xn;
+	int i, failed = 0;
+
+	ctx = make_ctx(store, NULL);
+	xn = make_name(subject);
+
+	if ((certs = X509_STORE_get1_certs(ctx, xn)) == NULL) {
+		if (n_want != 0) {
+			fprintf(stderr, "FAIL: %s: no certs for %s\n", name,
+			    subject);
+			failed = 1;
+		}
+		goto done;
+	}
+	if (sk_X509_num(certs) != n_want) {
+		fprintf(stderr, "FAIL: %s: %d certs for %s, want %d\n", name,
+		    sk_X509_num(certs), subject, n_want);
+		failed = 1;
+		goto done;
+	}
+	for (i = 0; i < n_want; i++) {
+		if (X509_cmp(sk_X509_value(certs, i), want[i]) != 0) {
+			fprintf(stderr, "FAIL: %s: cert %d for %s differs\n",
+			    name, i, subject);
+			failed = 1;
+		}
+	}
+
+ done:
+	sk_X509_pop_free(certs, X509_free);
+	X509_NAME_free(xn);
+	X509_STORE_CTX_free(ctx);
+
+	return failed;
+}
+
+static int
+check_issuer(const char *name, X509_STORE *store, X509 *leaf, X509 *want)
+{
+	X509_STORE_CTX *ctx;
+	X509 *issuer = NULL;
+	int failed = 0;
+
+	ctx = make_ctx(store, leaf);
+
+	if (X509_STORE_CTX_get1_issuer(&issuer, ctx, leaf) != 1) {
+		fprintf(stderr, "FAIL: %s: no issuer found\n", name);
+		failed = 1;
+	} else if (X509_cmp(issuer, want) != 0) {
+		fprintf(stderr, "FAIL: %s: wrong issuer, serial %ld\n", name,
+		    ASN1_INTEGER_get(X509_get_serialNumber(issuer)));
+		failed = 1;
+	}
+
+	X509_free(issuer);
+	X509_STORE_CTX_free(ctx);
+
+	return failed;
+}
+
+/* Adding a certificate that is already in the store doesn't add it again. */
+static int
+test_duplicates(void)
+{
+	X509_STORE *store;
+	X509 *ca[2], *copy;
+	int failed = 0;
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	ca[0] = make_cert("test ca", "test ca", 1, -1, 1, 1, -1);
+	ca[1] = make_cert("test ca", "test ca", 2, -1, 1, 1, -1);
+	if ((copy = X509_dup(ca[0])) == NULL)
+		errx(1, "X509_dup");
+
+	if (!X509_STORE_add_cert(store, ca[0])) {
+		fprintf(stderr, "FAIL: duplicates: add failed\n");
+		failed = 1;
+	}
+	failed |= check_count("duplicates: first add", store, 1);
+
+	if (!X509_STORE_add_cert(store, ca[0])) {
+		fprintf(stderr, "FAIL: duplicates: second add failed\n");
+		failed = 1;
+	}
+	failed |= check_count("duplicates: second add", store, 1);
+
+	if (!X509_STORE_add_cert(store, copy)) {
+		fprintf(stderr, "FAIL: duplicates: adding a copy failed\n");
+		failed = 1;
+	}
+	failed |= check_count("duplicates: copy", store, 1);
+
+	/* Same name and key identifier, but a different certificate. */
+	if (!X509_STORE_add_cert(store, ca[1])) {
+		fprintf(stderr, "FAIL: duplicates: add of other cert failed\n");
+		failed = 1;
+	}
+	failed |= check_count("duplicates: other cert", store, 2);
+	failed |= check_certs("duplicates", store, "test ca", ca, 2);
+
+	X509_free(copy);
+	X509_free(ca[0]);
+	X509_free(ca[1]);
+	X509_STORE_free(store);
+
+	return failed;
+}
+
+static uint32_t
+name_hash(const char *cn)
+{
+	X509_NAME *xn;
+	uint32_t hash = 2166136261U;
+	int i;
+
+	xn = make_name(cn);
+	/* Encoding the name sets its canonical encoding. */
+	if (i2d_X509_NAME(xn, NULL) <= 0)
+		errx(1, "i2d_X509_NAME");
+	for (i = 0; i < xn->canon_enclen; i++) {
+		hash ^= xn->canon_enc[i];
+		hash *= 16777619U;
+	}
+	X509_NAME_free(xn);
+
+	return hash;
+}
+
+/*
+ * Certificates whose names have the same hash end up in the same chain of
+ * the subject index, but lookups only return those with the name asked for.
+ */
+static int
+test_name_collision(void)
+{
+	X509_STORE *store;
+	X509 *ca1[3], *ca2[2];
+	int i, failed = 0;
+
+	if (name_hash(COLLIDING_CN_1) != name_hash(COLLIDING_CN_2)) {
+		fprintf(stderr, "FAIL: \"%s\" and \"%s\" don't collide\n",
+		    COLLIDING_CN_1, COLLIDING_CN_2);
+		return 1;
+	}
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	for (i = 0; i < 3; i++)
+		ca1[i] = make_cert(COLLIDING_CN_1, COLLIDING_CN_1, 10 + i,
+		    -1, 1, 1, -1);
+	for (i = 0; i < 2; i++)
+		ca2[i] = make_cert(COLLIDING_CN_2, COLLIDING_CN_2, 20 + i,
+		    -1, 1, 1, -1);
+
+	/* Interleave the two names in the chain. */
+	if (!X509_STORE_add_cert(store, ca1[0]) ||
+	    !X509_STORE_add_cert(store, ca2[0]) ||
+	    !X509_STORE_add_cert(store, ca1[1]) ||
+	    !X509_STORE_add_cert(store, ca2[1]) ||
+	    !X509_STORE_add_cert(store, ca1[2])) {
+		fprintf(stderr, "FAIL: collision: add failed\n");
+		failed = 1;
+	}
+	failed |= check_count("collision", store, 5);
+
+	failed |= check_certs("collision", store, COLLIDING_CN_1, ca1, 3);
+	failed |= check_certs("collision", store, COLLIDING_CN_2, ca2, 2);
+	failed |= check_certs("collision", store, "test ca", NULL, 0);
+
+	/* A duplicate of a cert with the other name is still a duplicate. */
+	if (!X509_STORE_add_cert(store, ca2[1])) {
+		fprintf(stderr, "FAIL: collision: duplicate add failed\n");
+		failed = 1;
+	}
+	failed |= check_count("collision: duplicate", store, 5);
+
+	for (i = 0; i < 3; i++)
+		X509_free(ca1[i]);
+	for (i = 0; i < 2; i++)
+		X509_free(ca2[i]);
+	X509_STORE_free(store);
+
+	return failed;
+}
+
+/*
+ * The issuer is looked up by the AKID of the certificate first, and a
+ * currently valid issuer with a matching SKID wins over other issuers with
+ * the same name. Without one, all issuers with the name are scanned in
+ * order, and an expired issuer is only returned if nothing else matches.
+ */
+static int
+test_issuer(void)
+{
+	X509_STORE *store;
+	X509 *ca_expired, *ca_noskid, *ca_valid, *leaf, *leaf_other;
+	int failed = 0;
+
+	ca_expired = make_cert("test ca", "test ca", 1, -2, -1, 2, -1);
+	ca_noskid = make_cert("test ca", "test ca", 2, -1, 1, -1, -1);
+	ca_valid = make_cert("test ca", "test ca", 3, -1, 1, 2, -1);
+	leaf = make_cert("test leaf", "test ca", 4, -1, 1, -1, 2);
+	leaf_other = make_cert("test leaf", "test ca", 5, -1, 1, -1, 9);
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	if (!X509_STORE_add_cert(store, ca_expired) ||
+	    !X509_STORE_add_cert(store, ca_noskid) ||
+	    !X509_STORE_add_cert(store, ca_valid))
+		errx(1, "X509_STORE_add_cert");
+
+	failed |= check_issuer("issuer: valid SKID match", store, leaf,
+	    ca_valid);
+	failed |= check_issuer("issuer: no SKID match", store, leaf_other,
+	    ca_noskid);
+	X509_STORE_free(store);
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	if (!X509_STORE_add_cert(store, ca_expired) ||
+	    !X509_STORE_add_cert(store, ca_noskid))
+		errx(1, "X509_STORE_add_cert");
+
+	failed |= check_issuer("issuer: expired SKID match", store, leaf,
+	    ca_noskid);
+	X509_STORE_free(store);
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	if (!X509_STORE_add_cert(store, ca_expired))
+		errx(1, "X509_STORE_add_cert");
+
+	failed |= check_issuer("issuer: only expired", store, leaf,
+	    ca_expired);
+	X509_STORE_free(store);
+
+	X509_free(ca_expired);
+	X509_free(ca_noskid);
+	X509_free(ca_valid);
+	X509_free(leaf);
+	X509_free(leaf_other);
+
+	return failed;
+}
+
+static int
+check_grown_store(const char *name, X509_STORE *store, X509 **ca,
+    X509 **leaf)
+{
+	char cn[32];
+	int i, failed = 0;
+
+	failed |= check_count(name, store, N_GROW_CERTS);
+	for (i = 0; i < N_GROW_CERTS; i++) {
+		snprintf(cn, sizeof(cn), "test ca %d", i);
+		failed |= check_certs(name, store, cn, &ca[i], 1);
+		failed |= check_issuer(name, store, leaf[i], ca[i]);
+	}
+
+	return failed;
+}
+
+/*
+ * Both indexes stay consistent with the objects while they grow, when all
+ * certificates are added again, and when they are added to a new store in
+ * a different order. Objects can't be removed from a store, so freeing the
+ * store is the only way to start over.
+ */
+static int
+test_grow(void)
+{
+	X509_STORE *store;
+	X509 *ca[N_GROW_CERTS], *copy[N_GROW_CERTS], *leaf[N_GROW_CERTS];
+	char cn[32];
+	int i, failed = 0;
+
+	for (i = 0; i < N_GROW_CERTS; i++) {
+		snprintf(cn, sizeof(cn), "test ca %d", i);
+		ca[i] = make_cert(cn, cn, 100 + i, -1, 1, 100 + i, -1);
+		leaf[i] = make_cert("test leaf", cn, 1000 + i, -1, 1, -1,
+		    100 + i);
+		if ((copy[i] = X509_dup(ca[i])) == NULL)
+			errx(1, "X509_dup");
+	}
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	for (i = 0; i < N_GROW_CERTS; i++) {
+		if (!X509_STORE_add_cert(store, ca[i]))
+			errx(1, "X509_STORE_add_cert");
+	}
+	failed |= check_grown_store("grow", store, ca, leaf);
+
+	for (i = 0; i < N_GROW_CERTS; i++) {
+		if (!X509_STORE_add_cert(store, copy[i]))
+			errx(1, "X509_STORE_add_cert");
+	}
+	failed |= check_grown_store("grow: added again", store, ca, leaf);
+	X509_STORE_free(store);
+
+	if ((store = X509_STORE_new()) == NULL)
+		errx(1, "X509_STORE_new");
+	for (i = N_GROW_CERTS - 1; i >= 0; i--) {
+		if (!X509_STORE_add_cert(store, copy[i]))
+			errx(1, "X509_STORE_add_cert");
+	}
+	failed |= check_grown_store("grow: new store", store, ca, leaf);
+	X509_STORE_free(store);
+
+	for (i = 0; i < N_GROW_CERTS; i++) {
+		X509_free(ca[i]);
+		X509_free(copy[i]);
+		X509_free(leaf[i]);
+	}
+
+	return failed;
+}
+
+int
+main(int argc, char **argv)
+{
+	int failed = 0;
+
+	make_key();
+
+	failed |= test_duplicates();
+	failed |= test_name_collision();
+	failed |= test_issuer();
+	failed |= test_grow();
+
+	EVP_PKEY_free(key);
+
+	if (!failed)
+		printf("SUCCESS\n");
+
+	return failed;
+}